@@ -0,0 +1,154 @@
+#include "CalibreMessageBuffer.h"
+
+#include <HardwareSerial.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr size_t MAX_MESSAGE_LENGTH = 1000000;
+// Longest length prefix accepted, MAX_MESSAGE_LENGTH has 7 digits
+constexpr size_t MAX_PREFIX_LENGTH = 12;
+// Unread data without a '[' in it is dropped once it grows past this
+constexpr size_t MAX_GARBAGE_LENGTH = 1000;
+}  // namespace
+
+CalibreMessageBuffer::~CalibreMessageBuffer() { release(); }
+
+bool CalibreMessageBuffer::allocate(const size_t size, const size_t minSize) {
+  release();
+  for (bufferSize = size; bufferSize >= minSize; bufferSize /= 2) {
+    buffer = static_cast<uint8_t*>(malloc(bufferSize));
+    if (buffer) {
+      return true;
+    }
+  }
+  bufferSize = 0;
+  return false;
+}
+
+void CalibreMessageBuffer::release() {
+  free(buffer);
+  buffer = nullptr;
+  bufferSize = 0;
+  clear();
+}
+
+void CalibreMessageBuffer::clear() {
+  start = 0;
+  end = 0;
+  discardRemaining = 0;
+}
+
+uint8_t* CalibreMessageBuffer::prepareWrite(const size_t wanted, size_t* space) {
+  if (start == end) {
+    start = 0;
+    end = 0;
+  } else if (start > 0 && bufferSize - end < wanted) {
+    // Move the unread data to the front, this only happens once per buffer's worth of data
+    memmove(buffer, buffer + start, end - start);
+    end -= start;
+    start = 0;
+  }
+
+  *space = std::min(wanted, bufferSize - end);
+  return buffer + end;
+}
+
+void CalibreMessageBuffer::commitWrite(const size_t size) { end += std::min(size, bufferSize - end); }
+
+CalibreMessageBuffer::Result CalibreMessageBuffer::next(std::string_view& message) {
+  if (discardRemaining > 0) {
+    const size_t toDiscard = std::min(discardRemaining, end - start);
+    start += toDiscard;
+    discardRemaining -= toDiscard;
+    if (discardRemaining > 0) {
+      return Result::NONE;
+    }
+  }
+
+  const auto data = reinterpret_cast<const char*>(buffer + start);
+  const size_t size = end - start;
+  if (size == 0) {
+    return Result::NONE;
+  }
+
+  // Find '[' which marks the start of JSON
+  const auto bracket = static_cast<const char*>(memchr(data, '[', size));
+  if (!bracket) {
+    // No '[' found - if buffer is getting large, something is wrong
+    if (size > MAX_GARBAGE_LENGTH) {
+      start = end;
+    }
+    return Result::NONE;
+  }
+  const size_t bracketPos = bracket - data;
+
+  // Try to extract length from digits before '['
+  // Calibre ALWAYS sends a length prefix, so if it's not valid digits, it's garbage
+  size_t msgLen = 0;
+  bool validPrefix = false;
+
+  if (bracketPos > 0 && bracketPos <= MAX_PREFIX_LENGTH) {
+    validPrefix = true;
+    for (size_t i = 0; i < bracketPos; i++) {
+      const char c = data[i];
+      if (c < '0' || c > '9') {
+        validPrefix = false;
+        break;
+      }
+      msgLen = msgLen * 10 + (c - '0');
+    }
+  }
+
+  if (!validPrefix) {
+    // Not a valid length prefix - discard everything up to '[' (or the '[' itself if there is nothing before it)
+    // and wait for more data that hopefully starts with a proper length prefix
+    start += bracketPos > 0 ? bracketPos : 1;
+    return Result::NONE;
+  }
+
+  // Sanity check the message length
+  if (msgLen > MAX_MESSAGE_LENGTH) {
+    start += bracketPos + 1;  // Skip past this '[' and try again
+    return Result::NONE;
+  }
+
+  const size_t totalNeeded = bracketPos + msgLen;
+  if (totalNeeded > bufferSize) {
+    // The caller answers from the opcode before the rest is dropped
+    const size_t opcodeEnd = std::min(size, bracketPos + 8);
+    const auto comma = static_cast<const char*>(memchr(bracket, ',', opcodeEnd - bracketPos));
+    if (!comma) {
+      if (opcodeEnd == size) {
+        return Result::NONE;  // Opcode not fully received yet
+      }
+      start += bracketPos + 1;  // Not a message after all, skip past this '[' and try again
+      return Result::NONE;
+    }
+
+    Serial.printf("[%lu] [CAL] Skipping %zu byte message, larger than receive buffer\n", millis(), msgLen);
+    message = std::string_view(bracket + 1, comma - bracket - 1);
+    discardRemaining = totalNeeded;
+    return Result::TOO_LARGE;
+  }
+
+  // Check if we have the complete message
+  if (size < totalNeeded) {
+    // Not enough data yet - wait for more
+    return Result::NONE;
+  }
+
+  // Hand out the message in place, the rest stays in the buffer (may contain binary data or next message)
+  message = std::string_view(data + bracketPos, msgLen);
+  start += totalNeeded;
+  return Result::MESSAGE;
+}
+
+size_t CalibreMessageBuffer::take(uint8_t* out, const size_t size) {
+  const size_t taken = std::min(size, end - start);
+  memcpy(out, buffer + start, taken);
+  start += taken;
+  return taken;
+}
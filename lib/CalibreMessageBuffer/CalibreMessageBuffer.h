@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Receive buffer for Calibre's wireless protocol, where each JSON message is sent as its length in decimal digits
+ * followed by the message itself: 6[3,{}]
+ *
+ * Unread data is buffer[start, end). Messages are handed out in place and the unread data is only moved back to the
+ * front when more room is needed, so a message costs no copies or allocations.
+ *
+ * Usage:
+ *   size_t space;
+ *   uint8_t* dest = messages.prepareWrite(client.available(), &space);
+ *   messages.commitWrite(client.read(dest, space));
+ *   std::string_view message;
+ *   if (messages.next(message) == CalibreMessageBuffer::Result::MESSAGE) {
+ *     // message is "[opcode,{...}]", valid until the next prepareWrite
+ *   }
+ */
+class CalibreMessageBuffer {
+ public:
+  enum class Result {
+    NONE,      // No complete message yet
+    MESSAGE,   // message holds the whole message
+    TOO_LARGE  // The message does not fit the buffer and is being dropped, message holds its opcode digits
+  };
+
+  CalibreMessageBuffer() = default;
+  ~CalibreMessageBuffer();
+
+  // Disable copy
+  CalibreMessageBuffer(const CalibreMessageBuffer&) = delete;
+  CalibreMessageBuffer& operator=(const CalibreMessageBuffer&) = delete;
+
+  /**
+   * Allocate the buffer, halving the size down to minSize when the heap is too fragmented for it.
+   * @return true if a buffer was allocated
+   */
+  bool allocate(size_t size, size_t minSize);
+  void release();
+  size_t capacity() const { return bufferSize; }
+  // Drops all buffered data
+  void clear();
+
+  /**
+   * Room for up to wanted more bytes, moving the unread data to the front if there is less than that after it.
+   * @param space Set to how many bytes may be written, 0 when the buffer is full
+   */
+  uint8_t* prepareWrite(size_t wanted, size_t* space);
+  void commitWrite(size_t size);
+
+  /**
+   * Take the next message off the buffer. Bytes that can't start a message are skipped, and a message larger than
+   * the buffer is dropped as it arrives. Calibre waits for a reply to every message, so TOO_LARGE is returned once
+   * for it with the opcode to answer.
+   */
+  Result next(std::string_view& message);
+
+  /**
+   * Move up to size unread bytes out, for binary data that arrived after a message.
+   * @return the number of bytes moved
+   */
+  size_t take(uint8_t* out, size_t size);
+  size_t unread() const { return end - start; }
+
+ private:
+  uint8_t* buffer = nullptr;
+  size_t bufferSize = 0;
+  size_t start = 0;
+  size_t end = 0;
+  size_t discardRemaining = 0;  // Rest of a message too large for the buffer, dropped as it arrives
+};
@@ -0,0 +1,114 @@
+#include "DoubleBufferedFileWriter.h"
+
+#include <HardwareSerial.h>
+
+#include <cstdlib>
+
+DoubleBufferedFileWriter::~DoubleBufferedFileWriter() { end(); }
+
+void DoubleBufferedFileWriter::writerTaskTrampoline(void* param) {
+  auto* self = static_cast<DoubleBufferedFileWriter*>(param);
+  self->writerTaskLoop();
+}
+
+bool DoubleBufferedFileWriter::begin(FsFile& targetFile, const size_t size) {
+  end();
+  file = &targetFile;
+  bufferSize = size;
+  buffers[0] = static_cast<uint8_t*>(malloc(bufferSize));
+  buffers[1] = static_cast<uint8_t*>(malloc(bufferSize));
+  filledBuffers = xQueueCreate(2, sizeof(int));
+  freeBuffers = xQueueCreate(2, sizeof(int));
+  writerDone = xSemaphoreCreateBinary();
+  bufferFill[0] = 0;
+  bufferFill[1] = 0;
+  activeBuffer = 0;
+  writeFailed = false;
+
+  if (!buffers[0] || !buffers[1] || !filledBuffers || !freeBuffers || !writerDone) {
+    Serial.printf("[%lu] [DBW] Failed to allocate %zu byte write buffers\n", millis(), bufferSize);
+    releaseBuffers();
+    return false;
+  }
+
+  // The caller starts filling buffer 0, buffer 1 is free for it to switch to
+  const int spareBuffer = 1;
+  xQueueSend(freeBuffers, &spareBuffer, 0);
+
+  // Runs below the network task so received data is taken off the socket first, writes happen while it waits
+  if (xTaskCreate(&DoubleBufferedFileWriter::writerTaskTrampoline, "FileWriterTask", 4096, this, 1,
+                  &writerTaskHandle) != pdPASS) {
+    Serial.printf("[%lu] [DBW] Failed to start writer task\n", millis());
+    writerTaskHandle = nullptr;
+    releaseBuffers();
+    return false;
+  }
+
+  return true;
+}
+
+uint8_t* DoubleBufferedFileWriter::reserve(size_t* room) {
+  if (bufferFill[activeBuffer] == bufferSize) {
+    xQueueSend(filledBuffers, &activeBuffer, portMAX_DELAY);
+    xQueueReceive(freeBuffers, &activeBuffer, portMAX_DELAY);
+    bufferFill[activeBuffer] = 0;
+  }
+  if (writeFailed) {
+    return nullptr;
+  }
+
+  *room = bufferSize - bufferFill[activeBuffer];
+  return buffers[activeBuffer] + bufferFill[activeBuffer];
+}
+
+void DoubleBufferedFileWriter::commit(const size_t size) { bufferFill[activeBuffer] += size; }
+
+bool DoubleBufferedFileWriter::end() {
+  if (writerTaskHandle) {
+    if (bufferFill[activeBuffer] > 0) {
+      xQueueSend(filledBuffers, &activeBuffer, portMAX_DELAY);
+    }
+    const int stop = -1;
+    xQueueSend(filledBuffers, &stop, portMAX_DELAY);
+    xSemaphoreTake(writerDone, portMAX_DELAY);
+    writerTaskHandle = nullptr;
+  }
+
+  releaseBuffers();
+  return !writeFailed;
+}
+
+void DoubleBufferedFileWriter::releaseBuffers() {
+  if (writerDone) {
+    vSemaphoreDelete(writerDone);
+    writerDone = nullptr;
+  }
+  if (filledBuffers) {
+    vQueueDelete(filledBuffers);
+    filledBuffers = nullptr;
+  }
+  if (freeBuffers) {
+    vQueueDelete(freeBuffers);
+    freeBuffers = nullptr;
+  }
+  free(buffers[0]);
+  free(buffers[1]);
+  buffers[0] = nullptr;
+  buffers[1] = nullptr;
+  activeBuffer = -1;
+}
+
+void DoubleBufferedFileWriter::writerTaskLoop() {
+  int index;
+  while (xQueueReceive(filledBuffers, &index, portMAX_DELAY) == pdTRUE && index >= 0) {
+    const size_t fill = bufferFill[index];
+    if (!writeFailed && file->write(buffers[index], fill) != fill) {
+      Serial.printf("[%lu] [DBW] SD write of %zu bytes failed\n", millis(), fill);
+      writeFailed = true;
+    }
+    xQueueSend(freeBuffers, &index, portMAX_DELAY);
+  }
+
+  xSemaphoreGive(writerDone);
+  vTaskDelete(nullptr);
+}
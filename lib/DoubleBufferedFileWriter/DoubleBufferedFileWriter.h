@@ -0,0 +1,71 @@
+#pragma once
+#include <SdFat.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Writes a stream to a file through two buffers: the caller fills one while a task of its own writes the other out,
+ * so receiving and SD writes overlap. A buffer size that is a multiple of the 512 byte sector size keeps every write
+ * after the first one sector aligned, so SdFat writes straight to the card instead of through its sector cache.
+ *
+ * Usage:
+ *   DoubleBufferedFileWriter writer;
+ *   writer.begin(file, 8 * 1024);
+ *   size_t room;
+ *   uint8_t* dest = writer.reserve(&room);  // null once a write has failed
+ *   writer.commit(client.read(dest, room));
+ *   ...
+ *   writer.end();
+ */
+class DoubleBufferedFileWriter {
+ public:
+  DoubleBufferedFileWriter() = default;
+  ~DoubleBufferedFileWriter();
+
+  // Disable copy
+  DoubleBufferedFileWriter(const DoubleBufferedFileWriter&) = delete;
+  DoubleBufferedFileWriter& operator=(const DoubleBufferedFileWriter&) = delete;
+
+  /**
+   * Allocate the buffers and start the writer task.
+   * @return false if either could not be had, nothing is left allocated then
+   */
+  bool begin(FsFile& file, size_t bufferSize);
+  bool active() const { return activeBuffer >= 0; }
+
+  /**
+   * Room in the active buffer. A full buffer is handed to the writer task first, which waits for it to free the other.
+   * @param room Set to how many bytes may be written, at least 1
+   * @return null if a write has failed
+   */
+  uint8_t* reserve(size_t* room);
+  void commit(size_t size);
+
+  /**
+   * Write out what is buffered, stop the writer task and free the buffers. Does nothing if not begun.
+   * @return false if any write failed
+   */
+  bool end();
+
+ private:
+  FsFile* file = nullptr;
+  size_t bufferSize = 0;
+  // Buffer indexes are passed through the queues, a negative index tells the writer task to stop
+  uint8_t* buffers[2] = {nullptr, nullptr};
+  size_t bufferFill[2] = {0, 0};
+  int activeBuffer = -1;
+  QueueHandle_t filledBuffers = nullptr;
+  QueueHandle_t freeBuffers = nullptr;
+  SemaphoreHandle_t writerDone = nullptr;
+  TaskHandle_t writerTaskHandle = nullptr;
+  volatile bool writeFailed = false;
+
+  static void writerTaskTrampoline(void* param);
+  void writerTaskLoop();
+  void releaseBuffers();
+};
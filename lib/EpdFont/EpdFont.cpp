@@ -4,6 +4,13 @@
 
 #include <algorithm>
 
+EpdFont::EpdFont(const EpdFontData* data) : asciiGlyphs(nullptr), data(data) {
+  const EpdGlyph* first = findGlyph(ASCII_FIRST);
+  if (first && findGlyph(ASCII_LAST) == first + (ASCII_LAST - ASCII_FIRST)) {
+    asciiGlyphs = first;
+  }
+}
+
 void EpdFont::getTextBounds(const char* string, const int startX, const int startY, int* minX, int* minY, int* maxX,
                             int* maxY) const {
   *minX = startX;
@@ -18,6 +25,7 @@ void EpdFont::getTextBounds(const char* string, const int startX, const int star
   int cursorX = startX;
   const int cursorY = startY;
   uint32_t cp;
+  const EpdGlyph* prevGlyph = nullptr;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&string)))) {
     const EpdGlyph* glyph = getGlyph(cp);
 
@@ -31,6 +39,9 @@ void EpdFont::getTextBounds(const char* string, const int startX, const int star
       continue;
     }
 
+    cursorX += getKerning(prevGlyph, glyph);
+    prevGlyph = glyph;
+
     *minX = std::min(*minX, cursorX + glyph->left);
     *maxX = std::max(*maxX, cursorX + glyph->left + glyph->width);
     *minY = std::min(*minY, cursorY + glyph->top - glyph->height);
@@ -57,6 +68,13 @@ bool EpdFont::hasPrintableChars(const char* string) const {
 }
 
 const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
+  if (asciiGlyphs && cp - ASCII_FIRST <= ASCII_LAST - ASCII_FIRST) {
+    return &asciiGlyphs[cp - ASCII_FIRST];
+  }
+  return findGlyph(cp);
+}
+
+const EpdGlyph* EpdFont::findGlyph(const uint32_t cp) const {
   const EpdUnicodeInterval* intervals = data->intervals;
   const int count = data->intervalCount;
 
@@ -83,3 +101,27 @@ const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
 
   return nullptr;
 }
+
+int EpdFont::getKerning(const EpdGlyph* left, const EpdGlyph* right) const {
+  if (!left || !data->kernPairs) return 0;
+
+  const uint8_t leftClass = data->kernLeftClasses[left - data->glyph];
+  const uint8_t rightClass = data->kernRightClasses[right - data->glyph];
+  if (leftClass == 0 || rightClass == 0) return 0;
+
+  // Binary search for the right class within the left class's pairs
+  int lo = data->kernPairOffsets[leftClass - 1];
+  int hi = data->kernPairOffsets[leftClass] - 1;
+  while (lo <= hi) {
+    const int mid = lo + (hi - lo) / 2;
+    const EpdKernPair& pair = data->kernPairs[mid];
+    if (rightClass < pair.rightClass) {
+      hi = mid - 1;
+    } else if (rightClass > pair.rightClass) {
+      lo = mid + 1;
+    } else {
+      return pair.adjustX;
+    }
+  }
+  return 0;
+}
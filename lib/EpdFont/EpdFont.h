@@ -2,14 +2,23 @@
 #include "EpdFontData.h"
 
 class EpdFont {
+  // Glyph for ' ' when the font has all of printable ASCII in one interval, which getGlyph then indexes directly
+  const EpdGlyph* asciiGlyphs;
+
   void getTextBounds(const char* string, int startX, int startY, int* minX, int* minY, int* maxX, int* maxY) const;
+  const EpdGlyph* findGlyph(uint32_t cp) const;
 
  public:
+  static constexpr uint32_t ASCII_FIRST = 0x20;
+  static constexpr uint32_t ASCII_LAST = 0x7E;
+
   const EpdFontData* data;
-  explicit EpdFont(const EpdFontData* data) : data(data) {}
+  explicit EpdFont(const EpdFontData* data);
   ~EpdFont() = default;
   void getTextDimensions(const char* string, int* w, int* h) const;
   bool hasPrintableChars(const char* string) const;
 
   const EpdGlyph* getGlyph(uint32_t cp) const;
+  // Adjustment to the advance of left when right follows it, both glyphs of this font (left may be null)
+  int getKerning(const EpdGlyph* left, const EpdGlyph* right) const;
 };
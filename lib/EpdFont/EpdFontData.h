@@ -22,6 +22,12 @@ typedef struct {
   uint32_t offset;  ///< Index of the first code point into the glyph array
 } EpdUnicodeInterval;
 
+/// Kerning adjustment for a left kerning class (given by its position in the pair table) and a right kerning class
+typedef struct {
+  uint8_t rightClass;  ///< Kerning class of the second glyph
+  int8_t adjustX;      ///< Added to the first glyph's advance (x axis)
+} EpdKernPair;
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
@@ -32,4 +38,8 @@ typedef struct {
   int ascender;                         ///< Maximal height of a glyph above the base line
   int descender;                        ///< Maximal height of a glyph below the base line
   bool is2Bit;
+  const uint8_t* kernLeftClasses;   ///< Kerning class as the first glyph of a pair, per glyph (0 = none)
+  const uint8_t* kernRightClasses;  ///< Kerning class as the second glyph of a pair, per glyph (0 = none)
+  const uint16_t* kernPairOffsets;  ///< First kerning pair of each left class, indexed by class - 1, then the end
+  const EpdKernPair* kernPairs;     ///< Kerning pairs, grouped by left class and sorted by right class
 } EpdFontData;
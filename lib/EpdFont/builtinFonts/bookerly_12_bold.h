@@ -3216,7 +3216,7 @@ static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 6, 20, 7, 1, 19, 30, 0 }, // !
@@ -4006,6 +4006,1550 @@ static const EpdUnicodeInterval bookerly_12_boldIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_12_boldKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3,
+    0, 4, 5, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 8, 9, 10, 0, 11, 0, 0, 0, 12,
+    13, 14, 15, 16, 10, 17, 18, 19, 20, 21, 22, 23, 23, 24, 25, 26,
+    27, 28, 0, 0, 0, 0, 29, 30, 31, 0, 32, 33, 34, 35, 0, 0,
+    36, 37, 35, 35, 30, 30, 38, 39, 40, 40, 41, 42, 42, 43, 42, 40,
+    44, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+    0, 0, 0, 48, 7, 7, 7, 7, 7, 7, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 10, 16, 10, 10, 10, 10, 10, 0, 49, 22, 22, 22,
+    22, 25, 50, 51, 29, 29, 29, 29, 29, 29, 32, 31, 32, 32, 32, 32,
+    0, 0, 52, 52, 30, 35, 30, 30, 30, 30, 30, 0, 30, 41, 41, 41,
+    41, 42, 30, 42, 7, 29, 7, 29, 53, 54, 9, 31, 9, 31, 9, 31,
+    9, 31, 10, 55, 10, 0, 0, 32, 0, 32, 0, 32, 0, 56, 0, 32,
+    0, 34, 0, 34, 0, 34, 0, 34, 0, 35, 0, 35, 0, 52, 0, 52,
+    0, 52, 0, 57, 0, 0, 12, 0, 12, 58, 13, 36, 36, 14, 37, 14,
+    37, 0, 55, 0, 0, 14, 59, 16, 35, 16, 35, 16, 35, 35, 16, 35,
+    10, 30, 10, 30, 10, 30, 0, 32, 19, 39, 19, 39, 19, 39, 20, 40,
+    20, 40, 20, 40, 20, 40, 21, 60, 21, 0, 21, 40, 22, 41, 22, 41,
+    22, 41, 22, 41, 22, 41, 22, 61, 23, 42, 25, 42, 25, 26, 40, 26,
+    40, 26, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 62, 62, 63, 0, 64, 65, 66, 66, 67, 68, 68,
+    69, 70, 66, 71, 66, 72, 73, 74, 75, 76, 62, 70, 74, 66, 66, 70,
+    66, 77, 66, 78, 66, 79, 80, 75, 71, 81, 82, 76, 66, 66, 76, 68,
+    66, 68, 78, 78, 66, 83, 84, 85, 86, 87, 40, 88, 40, 89, 89, 88,
+    89, 89, 89, 84, 89, 84, 31, 86, 90, 84, 91, 87, 89, 89, 87, 92,
+    89, 92, 84, 84, 89, 40, 40, 93, 86, 0, 40, 94, 95, 0, 92, 92,
+    96, 88, 89, 90, 89, 97, 98, 78, 84, 99, 100, 76, 87, 68, 92, 79,
+    84, 101, 102, 103, 86, 0, 0, 104, 105, 74, 40, 104, 105, 70, 88, 70,
+    88, 70, 88, 76, 87, 0, 0, 0, 0, 106, 107, 80, 31, 75, 86, 108,
+    90, 108, 90, 109, 110, 76, 87, 76, 87, 66, 89, 111, 96, 112, 40, 112,
+    40, 66, 70, 88, 62, 89, 76, 87, 67, 113, 76, 87, 66, 89, 76, 87,
+    37, 72, 83, 72, 83, 62, 40, 62, 40, 78, 84, 78, 84, 70, 88, 74,
+    40, 0, 0, 66, 89, 66, 89, 78, 84, 78, 84, 78, 84, 78, 84, 71,
+    90, 71, 90, 71, 90, 66, 89, 75, 86, 66, 89, 103, 86, 114, 110, 82,
+    91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 115, 116, 117, 115, 115, 116, 4,
+    115, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 47, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_12_boldKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 2, 3,
+    0, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    9, 0, 0, 0, 10, 0, 11, 12, 13, 12, 12, 12, 13, 12, 12, 14,
+    12, 12, 15, 12, 13, 12, 13, 12, 16, 17, 18, 19, 19, 20, 21, 0,
+    0, 22, 23, 0, 0, 0, 24, 25, 26, 26, 26, 27, 28, 25, 29, 30,
+    25, 25, 31, 31, 26, 32, 26, 31, 33, 34, 35, 36, 36, 37, 38, 39,
+    0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 0, 0, 43, 11, 11, 11, 11, 11, 11, 44, 13, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 0, 45, 18, 18, 18,
+    18, 21, 12, 46, 24, 24, 24, 47, 48, 24, 24, 26, 26, 26, 26, 49,
+    50, 29, 51, 52, 26, 31, 26, 26, 26, 26, 26, 0, 53, 35, 35, 35,
+    35, 38, 54, 38, 11, 55, 11, 56, 11, 24, 13, 26, 13, 26, 13, 26,
+    13, 26, 12, 26, 12, 26, 12, 26, 12, 26, 12, 26, 12, 26, 12, 26,
+    13, 28, 13, 57, 13, 28, 13, 28, 12, 25, 12, 58, 12, 52, 12, 52,
+    12, 52, 12, 29, 12, 29, 12, 29, 14, 59, 12, 25, 31, 12, 25, 12,
+    25, 12, 25, 12, 25, 12, 60, 12, 31, 12, 31, 12, 31, 31, 12, 31,
+    13, 26, 13, 26, 13, 26, 13, 26, 12, 31, 12, 31, 12, 61, 16, 33,
+    16, 33, 16, 33, 16, 62, 17, 34, 17, 34, 17, 34, 18, 35, 18, 35,
+    18, 35, 18, 35, 18, 35, 18, 35, 19, 36, 21, 38, 21, 0, 39, 0,
+    39, 0, 63, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 64, 64, 65, 64, 66, 67, 64, 64, 68, 69, 64,
+    65, 64, 64, 70, 64, 71, 64, 64, 64, 72, 64, 73, 74, 64, 64, 64,
+    69, 75, 64, 66, 64, 64, 66, 65, 70, 76, 77, 64, 78, 64, 64, 65,
+    64, 64, 0, 64, 79, 80, 81, 82, 82, 83, 84, 85, 86, 82, 82, 82,
+    87, 82, 82, 84, 82, 88, 84, 89, 90, 84, 91, 82, 92, 82, 82, 89,
+    82, 82, 86, 82, 93, 84, 84, 94, 82, 84, 95, 0, 96, 97, 87, 82,
+    94, 82, 82, 98, 82, 65, 89, 66, 84, 99, 90, 64, 82, 0, 100, 64,
+    88, 64, 82, 64, 82, 64, 82, 73, 85, 74, 86, 64, 82, 64, 82, 0,
+    0, 65, 89, 64, 82, 64, 82, 64, 82, 66, 84, 66, 84, 65, 89, 101,
+    90, 101, 90, 77, 91, 0, 89, 78, 92, 78, 92, 64, 94, 102, 103, 102,
+    103, 64, 73, 85, 64, 82, 69, 87, 64, 82, 64, 82, 78, 92, 0, 82,
+    94, 71, 80, 71, 80, 104, 80, 64, 84, 105, 106, 0, 106, 73, 85, 74,
+    86, 0, 107, 64, 82, 64, 82, 66, 84, 66, 84, 66, 84, 0, 86, 70,
+    98, 70, 108, 70, 98, 0, 92, 64, 82, 64, 82, 64, 82, 77, 91, 77,
+    91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 109, 110, 6, 109, 109, 110, 6,
+    109, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0, 0, 0, 0,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_boldKernPairOffsets[118] = {
+    0, 5, 21, 30, 59, 67, 111, 127, 132, 134, 144, 162, 176, 189, 200, 203,
+    220, 232, 249, 265, 269, 292, 305, 346, 354, 391, 392, 404, 425, 432, 440, 441,
+    443, 468, 476, 482, 486, 488, 493, 507, 508, 511, 534, 539, 549, 555, 560, 573,
+    613, 622, 641, 646, 657, 675, 684, 707, 711, 713, 717, 728, 730, 735, 736, 749,
+    751, 755, 760, 774, 791, 808, 827, 864, 888, 891, 897, 917, 924, 929, 946, 963,
+    965, 984, 999, 1009, 1018, 1021, 1027, 1031, 1035, 1036, 1049, 1052, 1061, 1071, 1074, 1081,
+    1090, 1097, 1102, 1128, 1141, 1172, 1179, 1195, 1216, 1219, 1224, 1230, 1268, 1287, 1291, 1305,
+    1307, 1315, 1332, 1367, 1403, 1432,
+};
+
+static const EpdKernPair bookerly_12_boldKernPairs[] = {
+    { 11, -1 },
+    { 28, -1 },
+    { 34, 1 },
+    { 57, -1 },
+    { 71, -1 },
+    { 13, -1 },
+    { 14, 2 },
+    { 30, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 45, -1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 59, 1 },
+    { 66, -1 },
+    { 68, 2 },
+    { 90, 1 },
+    { 96, 1 },
+    { 97, 1 },
+    { 98, 1 },
+    { 108, 1 },
+    { 11, -2 },
+    { 20, 1 },
+    { 28, -1 },
+    { 44, -3 },
+    { 57, -1 },
+    { 69, -2 },
+    { 71, -2 },
+    { 77, 1 },
+    { 104, -3 },
+    { 11, 1 },
+    { 13, -1 },
+    { 14, 1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -3 },
+    { 21, -2 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 45, -1 },
+    { 65, -2 },
+    { 66, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 71, 1 },
+    { 78, -2 },
+    { 89, -1 },
+    { 90, -2 },
+    { 92, -2 },
+    { 98, -2 },
+    { 99, -3 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -1 },
+    { 108, -2 },
+    { 109, -2 },
+    { 110, -1 },
+    { 11, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 44, -1 },
+    { 71, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 11, -2 },
+    { 13, -1 },
+    { 16, -1 },
+    { 24, -2 },
+    { 26, -2 },
+    { 27, -1 },
+    { 28, -2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 44, -4 },
+    { 45, -1 },
+    { 47, -2 },
+    { 48, -2 },
+    { 49, -2 },
+    { 53, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 76, -1 },
+    { 80, -2 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 93, -2 },
+    { 95, -2 },
+    { 104, -4 },
+    { 107, -1 },
+    { 1, -1 },
+    { 3, -2 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 17, -3 },
+    { 18, -2 },
+    { 19, -3 },
+    { 21, -3 },
+    { 22, -2 },
+    { 36, -2 },
+    { 38, -2 },
+    { 41, -1 },
+    { 44, 1 },
+    { 109, -3 },
+    { 110, -2 },
+    { 11, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 44, -1 },
+    { 13, -1 },
+    { 45, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 11, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 34, 1 },
+    { 44, -2 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 11, -2 },
+    { 24, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 44, -3 },
+    { 47, -1 },
+    { 48, -1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, 1 },
+    { 62, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 5, -1 },
+    { 13, -1 },
+    { 26, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 45, -1 },
+    { 49, -1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, -1 },
+    { 59, 1 },
+    { 3, -1 },
+    { 11, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 21, -2 },
+    { 22, -3 },
+    { 36, -1 },
+    { 38, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, 1 },
+    { 3, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 51, 2 },
+    { 52, 2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, 2 },
+    { 62, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 11, -3 },
+    { 28, -1 },
+    { 30, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 44, -3 },
+    { 57, -1 },
+    { 110, 1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 9, 1 },
+    { 11, -1 },
+    { 14, 2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, 1 },
+    { 30, 2 },
+    { 34, 1 },
+    { 38, 1 },
+    { 40, 2 },
+    { 44, -2 },
+    { 59, 2 },
+    { 3, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, 1 },
+    { 21, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 44, 1 },
+    { 45, -1 },
+    { 109, -2 },
+    { 110, -1 },
+    { 11, -1 },
+    { 28, -1 },
+    { 44, -1 },
+    { 57, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -3 },
+    { 11, -3 },
+    { 13, -1 },
+    { 15, -1 },
+    { 24, -1 },
+    { 26, -2 },
+    { 28, -2 },
+    { 33, -2 },
+    { 41, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 62, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 11, -2 },
+    { 28, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 44, -2 },
+    { 46, -1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 57, -1 },
+    { 62, -1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -3 },
+    { 11, -4 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 24, -2 },
+    { 25, 1 },
+    { 26, -2 },
+    { 28, -2 },
+    { 31, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -4 },
+    { 45, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -2 },
+    { 51, 2 },
+    { 52, 2 },
+    { 53, -2 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 59, 2 },
+    { 60, 1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -1 },
+    { 3, 1 },
+    { 13, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 44, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 59, 1 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -3 },
+    { 13, -2 },
+    { 16, -1 },
+    { 24, -2 },
+    { 26, -2 },
+    { 28, -2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 45, -2 },
+    { 47, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 51, 2 },
+    { 52, 2 },
+    { 53, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 59, 1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -1 },
+    { 59, 1 },
+    { 14, 1 },
+    { 30, 1 },
+    { 38, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 59, 1 },
+    { 68, 1 },
+    { 90, 1 },
+    { 96, 1 },
+    { 97, 1 },
+    { 98, 1 },
+    { 108, 1 },
+    { 13, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 21, -2 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 45, -1 },
+    { 65, -2 },
+    { 66, -1 },
+    { 70, -1 },
+    { 78, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 92, -1 },
+    { 98, -1 },
+    { 99, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 108, -1 },
+    { 3, -1 },
+    { 10, -1 },
+    { 22, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 22, -2 },
+    { 37, -1 },
+    { 60, 1 },
+    { 109, -1 },
+    { 22, -2 },
+    { 22, -1 },
+    { 60, 1 },
+    { 1, 3 },
+    { 2, 2 },
+    { 3, 2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 10, 2 },
+    { 22, 2 },
+    { 23, 2 },
+    { 30, 1 },
+    { 40, 2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, 2 },
+    { 51, 2 },
+    { 52, 3 },
+    { 55, 1 },
+    { 58, 3 },
+    { 59, 2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 109, 2 },
+    { 110, 2 },
+    { 1, 1 },
+    { 22, -1 },
+    { 26, -1 },
+    { 34, 1 },
+    { 49, -1 },
+    { 53, -1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 3, -1 },
+    { 22, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 26, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 49, -1 },
+    { 10, -1 },
+    { 109, -1 },
+    { 22, -1 },
+    { 30, 2 },
+    { 38, 1 },
+    { 59, 2 },
+    { 109, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 24, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 62, -1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 22, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, 1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 26, -1 },
+    { 49, -1 },
+    { 53, -1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 14, 2 },
+    { 19, 1 },
+    { 30, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 59, 1 },
+    { 68, 2 },
+    { 96, 1 },
+    { 97, 1 },
+    { 99, 1 },
+    { 14, 1 },
+    { 19, -1 },
+    { 30, 1 },
+    { 68, 1 },
+    { 97, 1 },
+    { 99, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 54, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 11, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 44, -1 },
+    { 65, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 78, -1 },
+    { 85, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 13, -1 },
+    { 14, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 21, -2 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 30, 1 },
+    { 33, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 68, 1 },
+    { 80, -1 },
+    { 84, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 97, 1 },
+    { 99, -2 },
+    { 101, -1 },
+    { 108, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 11, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 34, 1 },
+    { 44, -2 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -3 },
+    { 11, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, -2 },
+    { 22, -2 },
+    { 23, -1 },
+    { 28, -1 },
+    { 44, -3 },
+    { 57, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 40, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 54, 1 },
+    { 58, 1 },
+    { 60, 1 },
+    { 110, 1 },
+    { 1, -1 },
+    { 3, -2 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 17, -3 },
+    { 18, -2 },
+    { 19, -3 },
+    { 21, -3 },
+    { 22, -2 },
+    { 30, 1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 41, -1 },
+    { 44, 1 },
+    { 59, 1 },
+    { 109, -3 },
+    { 110, -2 },
+    { 3, -1 },
+    { 10, -1 },
+    { 22, -2 },
+    { 30, 2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 59, 2 },
+    { 109, -1 },
+    { 110, -1 },
+    { 2, 2 },
+    { 3, 2 },
+    { 10, 1 },
+    { 22, 2 },
+    { 23, 2 },
+    { 25, 3 },
+    { 27, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, 2 },
+    { 48, 1 },
+    { 50, 1 },
+    { 54, 3 },
+    { 58, 3 },
+    { 59, 2 },
+    { 60, 3 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 109, 2 },
+    { 110, 2 },
+    { 22, -1 },
+    { 30, 1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 30, 2 },
+    { 59, 2 },
+    { 25, 1 },
+    { 54, 1 },
+    { 58, 1 },
+    { 60, 1 },
+    { 10, -1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 50, 1 },
+    { 61, 1 },
+    { 109, -1 },
+    { 22, -1 },
+    { 30, 1 },
+    { 22, -1 },
+    { 30, 2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 59, 2 },
+    { 102, -1 },
+    { 3, -1 },
+    { 22, -2 },
+    { 65, -1 },
+    { 70, -1 },
+    { 78, -2 },
+    { 90, -1 },
+    { 92, -1 },
+    { 98, -1 },
+    { 99, -2 },
+    { 101, -2 },
+    { 102, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 76, -1 },
+    { 102, -1 },
+    { 71, -1 },
+    { 83, -1 },
+    { 85, -1 },
+    { 104, -1 },
+    { 76, -1 },
+    { 89, -1 },
+    { 92, -1 },
+    { 102, -1 },
+    { 103, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 76, -1 },
+    { 93, -1 },
+    { 96, 1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 3, -1 },
+    { 22, -2 },
+    { 65, -2 },
+    { 68, -1 },
+    { 70, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 78, -2 },
+    { 79, -1 },
+    { 85, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 98, -1 },
+    { 99, -2 },
+    { 101, -2 },
+    { 108, -1 },
+    { 109, -1 },
+    { 3, -2 },
+    { 22, -4 },
+    { 65, -2 },
+    { 70, -2 },
+    { 76, -1 },
+    { 78, -3 },
+    { 89, -1 },
+    { 90, -2 },
+    { 92, -2 },
+    { 98, -2 },
+    { 99, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -1 },
+    { 108, -2 },
+    { 109, -1 },
+    { 110, -1 },
+    { 41, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 74, -1 },
+    { 76, -2 },
+    { 78, -1 },
+    { 81, -1 },
+    { 84, -1 },
+    { 89, -2 },
+    { 90, -1 },
+    { 92, -2 },
+    { 98, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 105, -1 },
+    { 108, -1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 69, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 79, -2 },
+    { 80, -2 },
+    { 82, -2 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, -4 },
+    { 95, -2 },
+    { 96, 2 },
+    { 98, -1 },
+    { 101, 1 },
+    { 102, -1 },
+    { 103, -3 },
+    { 104, -4 },
+    { 106, -2 },
+    { 108, -1 },
+    { 1, -1 },
+    { 3, -2 },
+    { 5, -1 },
+    { 10, -1 },
+    { 22, -2 },
+    { 41, -1 },
+    { 65, -3 },
+    { 70, -1 },
+    { 71, 1 },
+    { 76, -1 },
+    { 78, -3 },
+    { 87, 1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 92, -2 },
+    { 98, -1 },
+    { 99, -3 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -1 },
+    { 104, 1 },
+    { 108, -1 },
+    { 109, -3 },
+    { 110, -2 },
+    { 65, -1 },
+    { 73, -1 },
+    { 102, -1 },
+    { 22, -1 },
+    { 71, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 99, -1 },
+    { 104, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -3 },
+    { 41, -1 },
+    { 66, -1 },
+    { 69, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 75, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 87, -2 },
+    { 93, -2 },
+    { 95, -2 },
+    { 96, 1 },
+    { 103, -2 },
+    { 104, -2 },
+    { 68, 1 },
+    { 76, -1 },
+    { 89, -1 },
+    { 92, -1 },
+    { 97, 1 },
+    { 102, -1 },
+    { 103, -2 },
+    { 65, -1 },
+    { 76, -1 },
+    { 77, 1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 22, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 93, -1 },
+    { 101, -1 },
+    { 104, -2 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 69, -1 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -1 },
+    { 79, -1 },
+    { 83, -2 },
+    { 90, 1 },
+    { 93, -1 },
+    { 97, 1 },
+    { 98, 1 },
+    { 104, -3 },
+    { 108, 1 },
+    { 110, 1 },
+    { 66, -1 },
+    { 76, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -2 },
+    { 64, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -2 },
+    { 83, -1 },
+    { 87, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 104, -2 },
+    { 3, 1 },
+    { 66, -1 },
+    { 76, -2 },
+    { 77, 1 },
+    { 83, 1 },
+    { 87, 1 },
+    { 89, -2 },
+    { 90, -1 },
+    { 92, -2 },
+    { 96, 1 },
+    { 98, -1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, 1 },
+    { 108, -1 },
+    { 3, -1 },
+    { 10, -1 },
+    { 22, -2 },
+    { 90, -1 },
+    { 92, -1 },
+    { 98, -1 },
+    { 103, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 22, -2 },
+    { 85, -1 },
+    { 91, -1 },
+    { 93, -1 },
+    { 109, -1 },
+    { 90, -1 },
+    { 98, -1 },
+    { 108, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 93, -1 },
+    { 97, 1 },
+    { 98, 1 },
+    { 103, -1 },
+    { 108, 1 },
+    { 41, -1 },
+    { 80, -1 },
+    { 84, -1 },
+    { 103, -2 },
+    { 103, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 80, -1 },
+    { 83, -2 },
+    { 84, -1 },
+    { 87, -2 },
+    { 93, -1 },
+    { 95, -1 },
+    { 97, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 84, -1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 3, -1 },
+    { 22, -3 },
+    { 89, -1 },
+    { 90, -2 },
+    { 92, -2 },
+    { 98, -2 },
+    { 108, -2 },
+    { 109, -1 },
+    { 110, -1 },
+    { 3, -1 },
+    { 22, -2 },
+    { 90, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 98, -1 },
+    { 103, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 89, -1 },
+    { 92, -1 },
+    { 103, -1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 23, 1 },
+    { 40, 1 },
+    { 94, 1 },
+    { 96, 1 },
+    { 110, 1 },
+    { 3, -1 },
+    { 22, -2 },
+    { 90, -1 },
+    { 92, -1 },
+    { 98, -1 },
+    { 103, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 22, -1 },
+    { 65, -1 },
+    { 70, -1 },
+    { 78, -1 },
+    { 99, -1 },
+    { 101, -2 },
+    { 102, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 92, -1 },
+    { 98, -1 },
+    { 108, -1 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 41, -1 },
+    { 42, -1 },
+    { 69, -2 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, -2 },
+    { 87, -2 },
+    { 89, -1 },
+    { 93, -2 },
+    { 95, -2 },
+    { 102, -1 },
+    { 103, -2 },
+    { 104, -4 },
+    { 106, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 88, 1 },
+    { 90, 1 },
+    { 92, 1 },
+    { 97, 1 },
+    { 98, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 76, -1 },
+    { 79, -2 },
+    { 80, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, -2 },
+    { 95, -2 },
+    { 98, -1 },
+    { 102, -2 },
+    { 103, -3 },
+    { 104, -3 },
+    { 106, -1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 83, -1 },
+    { 87, -1 },
+    { 93, -1 },
+    { 110, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 69, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -2 },
+    { 87, -1 },
+    { 93, -2 },
+    { 95, -1 },
+    { 96, 1 },
+    { 103, -1 },
+    { 104, -3 },
+    { 41, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 74, -1 },
+    { 76, -2 },
+    { 77, 1 },
+    { 78, -1 },
+    { 84, -1 },
+    { 89, -2 },
+    { 90, 1 },
+    { 92, -2 },
+    { 97, 1 },
+    { 98, 1 },
+    { 101, -1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, 1 },
+    { 105, -1 },
+    { 108, 1 },
+    { 41, -1 },
+    { 97, 1 },
+    { 103, -2 },
+    { 65, -1 },
+    { 78, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 102, -1 },
+    { 22, -1 },
+    { 90, -1 },
+    { 92, -1 },
+    { 98, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, -2 },
+    { 70, 1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 79, -2 },
+    { 80, -2 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -1 },
+    { 87, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -2 },
+    { 95, -1 },
+    { 96, 2 },
+    { 98, -1 },
+    { 99, 1 },
+    { 102, -1 },
+    { 103, -2 },
+    { 104, -2 },
+    { 106, -1 },
+    { 108, -1 },
+    { 3, 1 },
+    { 66, -1 },
+    { 68, 2 },
+    { 76, -2 },
+    { 77, 1 },
+    { 83, 1 },
+    { 85, 1 },
+    { 87, 1 },
+    { 89, -2 },
+    { 90, 1 },
+    { 92, -2 },
+    { 96, 1 },
+    { 97, 2 },
+    { 98, 1 },
+    { 100, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, 1 },
+    { 108, 1 },
+    { 84, -1 },
+    { 97, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 22, -4 },
+    { 65, -2 },
+    { 70, -2 },
+    { 76, -1 },
+    { 78, -3 },
+    { 89, -1 },
+    { 90, -2 },
+    { 92, -2 },
+    { 98, -2 },
+    { 99, -2 },
+    { 101, -2 },
+    { 102, -1 },
+    { 103, -1 },
+    { 108, -2 },
+    { 73, -1 },
+    { 79, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 103, -1 },
+    { 3, 1 },
+    { 66, -1 },
+    { 76, -2 },
+    { 77, 1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 83, 1 },
+    { 87, 1 },
+    { 89, -2 },
+    { 90, -1 },
+    { 92, -2 },
+    { 95, -1 },
+    { 96, 1 },
+    { 98, -1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 11, -2 },
+    { 17, 1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 43, -3 },
+    { 44, -3 },
+    { 49, -1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, -1 },
+    { 57, -1 },
+    { 59, 1 },
+    { 62, -1 },
+    { 65, 1 },
+    { 69, -1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 79, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 87, -1 },
+    { 90, 1 },
+    { 91, 1 },
+    { 93, -1 },
+    { 95, -1 },
+    { 96, 1 },
+    { 98, 1 },
+    { 104, -3 },
+    { 108, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 11, -3 },
+    { 13, -1 },
+    { 24, -1 },
+    { 26, -2 },
+    { 28, -2 },
+    { 33, -2 },
+    { 44, -4 },
+    { 45, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 62, -2 },
+    { 66, -1 },
+    { 69, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 87, -2 },
+    { 93, -2 },
+    { 95, -2 },
+    { 96, 1 },
+    { 103, -1 },
+    { 104, -4 },
+    { 11, 1 },
+    { 13, -1 },
+    { 14, 1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -3 },
+    { 21, -2 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -1 },
+    { 45, -1 },
+    { 65, -2 },
+    { 66, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 71, 1 },
+    { 78, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 92, -2 },
+    { 98, -1 },
+    { 99, -3 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -1 },
+    { 108, -1 },
+    { 109, -2 },
+    { 110, -1 },
+};
+
 static const EpdFontData bookerly_12_bold = {
     bookerly_12_boldBitmaps,
     bookerly_12_boldGlyphs,
@@ -4015,4 +5559,8 @@ static const EpdFontData bookerly_12_bold = {
     27,
     -7,
     true,
+    bookerly_12_boldKernLeftClasses,
+    bookerly_12_boldKernRightClasses,
+    bookerly_12_boldKernPairOffsets,
+    bookerly_12_boldKernPairs,
 };
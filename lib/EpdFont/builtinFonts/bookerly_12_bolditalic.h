@@ -3297,7 +3297,7 @@ static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 8, 20, 8, 1, 19, 40, 0 }, // !
@@ -4087,6 +4087,1713 @@ static const EpdUnicodeInterval bookerly_12_bolditalicIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_12_bolditalicKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 3, 4, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    6, 0, 0, 0, 0, 0, 7, 8, 9, 10, 11, 12, 13, 14, 14, 15,
+    16, 17, 18, 19, 10, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 0, 0, 0, 0, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+    43, 0, 40, 40, 34, 34, 44, 45, 35, 0, 33, 46, 46, 47, 46, 48,
+    49, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51,
+    0, 0, 0, 52, 7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11,
+    14, 14, 14, 14, 10, 19, 10, 10, 10, 10, 10, 0, 10, 25, 25, 25,
+    25, 29, 53, 54, 33, 33, 33, 33, 33, 33, 37, 55, 37, 37, 37, 37,
+    41, 56, 57, 57, 34, 40, 34, 34, 34, 34, 34, 0, 58, 33, 33, 33,
+    33, 46, 34, 46, 7, 33, 7, 33, 59, 60, 9, 35, 9, 35, 9, 35,
+    9, 35, 10, 61, 10, 36, 11, 37, 11, 37, 11, 37, 62, 63, 11, 37,
+    13, 39, 13, 39, 13, 39, 13, 39, 14, 40, 64, 40, 14, 57, 14, 57,
+    14, 57, 65, 66, 14, 33, 15, 42, 15, 67, 16, 43, 35, 17, 0, 17,
+    68, 0, 61, 0, 0, 17, 69, 19, 40, 19, 40, 19, 40, 40, 19, 42,
+    10, 34, 10, 34, 10, 34, 11, 37, 22, 45, 22, 45, 22, 45, 23, 35,
+    23, 35, 23, 55, 23, 35, 24, 70, 24, 0, 24, 0, 25, 33, 25, 33,
+    25, 33, 25, 33, 25, 33, 25, 60, 26, 46, 29, 46, 29, 30, 48, 30,
+    48, 30, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 11, 11, 71, 0, 0, 23, 72, 72, 73, 74, 74,
+    75, 76, 72, 77, 72, 78, 79, 80, 81, 82, 11, 76, 80, 72, 72, 76,
+    72, 83, 72, 84, 72, 85, 86, 81, 77, 87, 88, 82, 72, 72, 82, 74,
+    72, 74, 84, 84, 72, 89, 90, 91, 35, 92, 93, 94, 91, 89, 89, 95,
+    89, 89, 89, 96, 40, 96, 35, 40, 97, 92, 98, 99, 89, 89, 99, 100,
+    89, 101, 96, 96, 89, 93, 93, 102, 35, 35, 103, 41, 104, 105, 101, 101,
+    40, 95, 89, 97, 89, 106, 101, 84, 96, 107, 108, 82, 99, 74, 101, 85,
+    96, 109, 110, 111, 35, 0, 0, 112, 113, 80, 91, 114, 113, 76, 95, 76,
+    95, 76, 95, 82, 99, 0, 0, 0, 0, 115, 91, 86, 35, 81, 99, 116,
+    117, 116, 118, 119, 120, 82, 99, 82, 99, 72, 89, 121, 40, 0, 93, 0,
+    93, 72, 76, 94, 122, 123, 82, 99, 73, 105, 82, 99, 72, 0, 82, 99,
+    124, 78, 89, 78, 89, 11, 93, 11, 93, 84, 96, 84, 96, 76, 94, 80,
+    91, 125, 126, 72, 89, 72, 89, 84, 96, 84, 96, 84, 96, 84, 96, 77,
+    97, 77, 97, 77, 97, 72, 89, 81, 35, 72, 89, 111, 35, 127, 128, 88,
+    98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 4, 4, 4, 0, 0, 129, 130, 131, 129, 129, 130, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_12_bolditalicKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4,
+    0, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    10, 0, 0, 0, 11, 0, 12, 13, 14, 13, 15, 15, 14, 15, 15, 16,
+    15, 15, 17, 15, 14, 13, 14, 13, 18, 19, 20, 21, 21, 22, 23, 0,
+    0, 24, 25, 0, 0, 0, 26, 27, 26, 26, 26, 28, 29, 27, 30, 31,
+    27, 27, 32, 32, 26, 32, 26, 32, 33, 34, 35, 36, 36, 37, 38, 39,
+    0, 0, 40, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 0, 0, 44, 12, 12, 12, 12, 12, 12, 45, 14, 15, 15, 15, 15,
+    15, 15, 15, 15, 13, 15, 14, 14, 14, 14, 14, 0, 14, 20, 20, 20,
+    20, 23, 15, 46, 26, 26, 26, 26, 47, 26, 26, 26, 26, 26, 26, 26,
+    48, 30, 49, 49, 26, 32, 26, 26, 26, 26, 26, 0, 50, 35, 35, 35,
+    35, 36, 27, 36, 12, 26, 12, 26, 12, 26, 14, 26, 14, 26, 14, 26,
+    14, 47, 13, 26, 13, 26, 15, 26, 15, 26, 15, 26, 15, 26, 15, 26,
+    14, 29, 14, 29, 14, 29, 14, 29, 15, 27, 15, 51, 15, 49, 15, 49,
+    15, 49, 15, 30, 15, 32, 15, 30, 16, 52, 15, 27, 32, 15, 27, 15,
+    27, 15, 27, 15, 27, 15, 53, 15, 32, 15, 32, 15, 32, 32, 15, 32,
+    14, 26, 14, 26, 14, 26, 14, 26, 13, 32, 13, 32, 13, 32, 18, 33,
+    18, 33, 18, 33, 18, 54, 19, 34, 19, 34, 19, 34, 20, 35, 20, 35,
+    20, 35, 20, 35, 20, 35, 20, 35, 21, 36, 23, 36, 23, 0, 39, 0,
+    39, 0, 39, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 55, 55, 56, 55, 57, 58, 55, 55, 59, 60, 55,
+    56, 55, 55, 61, 55, 62, 55, 63, 55, 64, 55, 65, 66, 55, 55, 55,
+    60, 67, 55, 57, 55, 63, 57, 56, 61, 68, 69, 55, 70, 55, 55, 56,
+    55, 55, 71, 55, 72, 73, 74, 73, 75, 76, 73, 77, 78, 79, 79, 80,
+    81, 82, 80, 73, 80, 83, 73, 80, 84, 73, 85, 79, 86, 79, 79, 87,
+    79, 79, 78, 80, 88, 73, 73, 89, 75, 73, 90, 1, 91, 92, 81, 80,
+    89, 80, 79, 84, 79, 56, 80, 57, 73, 93, 94, 55, 80, 95, 96, 63,
+    80, 55, 97, 55, 75, 55, 80, 65, 77, 66, 78, 55, 80, 55, 80, 0,
+    0, 56, 0, 55, 80, 55, 80, 55, 80, 57, 73, 57, 73, 56, 80, 98,
+    84, 98, 84, 69, 85, 0, 0, 70, 86, 70, 86, 55, 89, 99, 100, 99,
+    100, 55, 65, 77, 55, 80, 60, 81, 55, 80, 55, 80, 70, 86, 0, 82,
+    101, 62, 73, 62, 73, 102, 73, 55, 73, 103, 104, 0, 104, 65, 77, 66,
+    78, 1, 105, 55, 79, 55, 79, 57, 73, 57, 73, 57, 73, 0, 78, 61,
+    84, 61, 84, 61, 84, 0, 86, 55, 75, 55, 79, 55, 75, 69, 85, 69,
+    85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 0, 6, 6, 6, 0, 0, 106, 107, 7, 106, 106, 107, 7,
+    0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 1, 0, 0, 0,
+    11, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_bolditalicKernPairOffsets[132] = {
+    0, 16, 20, 59, 61, 101, 105, 123, 132, 134, 142, 145, 157, 164, 172, 185,
+    197, 205, 210, 219, 230, 244, 260, 264, 283, 301, 324, 348, 362, 389, 392, 402,
+    445, 449, 455, 456, 457, 459, 477, 495, 498, 499, 501, 504, 511, 519, 526, 531,
+    534, 551, 565, 572, 592, 605, 606, 609, 613, 623, 633, 655, 662, 687, 693, 697,
+    708, 719, 722, 727, 729, 735, 737, 750, 757, 771, 783, 803, 822, 853, 881, 882,
+    894, 921, 927, 938, 949, 966, 970, 988, 1008, 1013, 1018, 1020, 1025, 1026, 1028, 1030,
+    1035, 1044, 1049, 1061, 1067, 1074, 1078, 1081, 1089, 1092, 1100, 1127, 1136, 1169, 1182, 1201,
+    1214, 1223, 1237, 1250, 1287, 1296, 1306, 1335, 1346, 1363, 1399, 1403, 1409, 1414, 1418, 1450,
+    1460, 1498, 1557, 1594,
+};
+
+static const EpdKernPair bookerly_12_bolditalicKernPairs[] = {
+    { 14, -1 },
+    { 16, 2 },
+    { 27, 2 },
+    { 28, 4 },
+    { 31, 4 },
+    { 38, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 57, -1 },
+    { 59, 2 },
+    { 64, 1 },
+    { 81, -1 },
+    { 84, 2 },
+    { 89, 2 },
+    { 92, 4 },
+    { 94, 2 },
+    { 12, -1 },
+    { 45, -2 },
+    { 62, -1 },
+    { 102, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 3 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -2 },
+    { 22, 1 },
+    { 23, -2 },
+    { 28, 1 },
+    { 31, 3 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, 3 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 69, 1 },
+    { 70, -2 },
+    { 72, 1 },
+    { 84, -1 },
+    { 86, -2 },
+    { 87, -2 },
+    { 92, 3 },
+    { 93, -2 },
+    { 94, -1 },
+    { 96, -1 },
+    { 98, -2 },
+    { 99, -3 },
+    { 100, -1 },
+    { 102, 1 },
+    { 106, -2 },
+    { 107, -2 },
+    { 23, -1 },
+    { 98, -1 },
+    { 12, -2 },
+    { 17, -1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 28, -1 },
+    { 29, -2 },
+    { 33, -2 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -2 },
+    { 45, -3 },
+    { 47, -2 },
+    { 50, -2 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -2 },
+    { 60, -1 },
+    { 62, -2 },
+    { 64, -2 },
+    { 67, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 81, -3 },
+    { 82, -2 },
+    { 85, -1 },
+    { 87, -1 },
+    { 88, -2 },
+    { 89, 1 },
+    { 90, -2 },
+    { 97, -2 },
+    { 100, -1 },
+    { 102, -3 },
+    { 104, -2 },
+    { 105, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 84, 1 },
+    { 94, 1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, 2 },
+    { 23, -2 },
+    { 24, -4 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -1 },
+    { 45, 1 },
+    { 50, 1 },
+    { 106, -2 },
+    { 107, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 12, -1 },
+    { 16, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 45, -1 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -2 },
+    { 26, -1 },
+    { 29, -1 },
+    { 45, -2 },
+    { 47, -1 },
+    { 50, -1 },
+    { 107, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 24, -1 },
+    { 106, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 27, 1 },
+    { 42, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 27, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 22, 1 },
+    { 27, 1 },
+    { 35, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 4, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -2 },
+    { 22, 1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 106, -2 },
+    { 21, -1 },
+    { 22, 1 },
+    { 24, -1 },
+    { 45, 1 },
+    { 106, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 12, -1 },
+    { 24, 1 },
+    { 27, 1 },
+    { 45, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -3 },
+    { 15, -1 },
+    { 17, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 45, -4 },
+    { 3, 5 },
+    { 5, 5 },
+    { 7, -1 },
+    { 10, 5 },
+    { 12, -1 },
+    { 16, 3 },
+    { 21, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, 5 },
+    { 29, 1 },
+    { 31, 2 },
+    { 40, 5 },
+    { 45, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, -2 },
+    { 22, 2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 42, -1 },
+    { 45, 2 },
+    { 106, -1 },
+    { 107, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -2 },
+    { 26, -1 },
+    { 33, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 45, -2 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 54, -1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -2 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 29, -2 },
+    { 33, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -4 },
+    { 47, -2 },
+    { 50, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 29, -2 },
+    { 33, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -4 },
+    { 47, -2 },
+    { 49, 1 },
+    { 50, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 27, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -2 },
+    { 13, 1 },
+    { 14, -1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -2 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 24, -1 },
+    { 16, 2 },
+    { 27, 2 },
+    { 28, 2 },
+    { 31, 2 },
+    { 38, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 59, 2 },
+    { 89, 2 },
+    { 92, 2 },
+    { 12, 2 },
+    { 13, 1 },
+    { 15, 1 },
+    { 16, 3 },
+    { 17, 1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -2 },
+    { 22, 2 },
+    { 23, -2 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 2 },
+    { 31, 1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 45, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 59, 3 },
+    { 60, 2 },
+    { 62, 2 },
+    { 63, 1 },
+    { 64, 2 },
+    { 65, 1 },
+    { 67, 1 },
+    { 69, 2 },
+    { 70, -2 },
+    { 72, 2 },
+    { 84, -1 },
+    { 85, 1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 89, 1 },
+    { 92, 1 },
+    { 93, -2 },
+    { 94, -1 },
+    { 98, -2 },
+    { 99, -2 },
+    { 102, 1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 106, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 53, 1 },
+    { 106, -1 },
+    { 24, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 29, -1 },
+    { 3, 1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 11, 1 },
+    { 24, 3 },
+    { 25, 1 },
+    { 27, 2 },
+    { 29, -1 },
+    { 40, 1 },
+    { 48, 2 },
+    { 49, 2 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 2 },
+    { 106, 1 },
+    { 107, 2 },
+    { 2, 1 },
+    { 4, 1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 3 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 106, 1 },
+    { 107, 2 },
+    { 4, -1 },
+    { 24, -2 },
+    { 106, -1 },
+    { 24, 1 },
+    { 24, 1 },
+    { 31, 1 },
+    { 24, -1 },
+    { 29, 1 },
+    { 50, 1 },
+    { 3, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 28, 2 },
+    { 31, 3 },
+    { 38, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 107, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 24, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 50, 1 },
+    { 107, 1 },
+    { 3, -1 },
+    { 24, -2 },
+    { 50, 1 },
+    { 16, 2 },
+    { 26, -1 },
+    { 27, 2 },
+    { 28, 2 },
+    { 31, 3 },
+    { 38, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 2 },
+    { 53, 2 },
+    { 59, 2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 84, 1 },
+    { 89, 2 },
+    { 92, 3 },
+    { 94, 1 },
+    { 16, 2 },
+    { 21, -1 },
+    { 23, -1 },
+    { 27, -1 },
+    { 28, 1 },
+    { 31, 2 },
+    { 46, 1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 59, 2 },
+    { 89, -1 },
+    { 92, 2 },
+    { 93, -1 },
+    { 98, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 19, -1 },
+    { 56, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 103, 1 },
+    { 16, 3 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, 3 },
+    { 31, 3 },
+    { 46, 3 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 59, 3 },
+    { 73, -1 },
+    { 76, -1 },
+    { 89, -1 },
+    { 92, 3 },
+    { 93, -1 },
+    { 98, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 12, -2 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 45, -2 },
+    { 106, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 24, 1 },
+    { 27, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 3, 1 },
+    { 4, 1 },
+    { 11, 1 },
+    { 24, 2 },
+    { 27, 2 },
+    { 40, 1 },
+    { 49, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 107, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 32, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 53, 1 },
+    { 106, -1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 4 },
+    { 17, 1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, 2 },
+    { 23, -2 },
+    { 24, -4 },
+    { 28, 3 },
+    { 29, 2 },
+    { 31, 4 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -1 },
+    { 45, 1 },
+    { 50, 1 },
+    { 106, -2 },
+    { 107, -2 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 4 },
+    { 106, -1 },
+    { 3, 2 },
+    { 4, 3 },
+    { 11, 2 },
+    { 24, 3 },
+    { 25, 2 },
+    { 27, 3 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 2 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 51, 3 },
+    { 53, 3 },
+    { 54, 1 },
+    { 106, 2 },
+    { 107, 2 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 16, 2 },
+    { 28, 2 },
+    { 31, 3 },
+    { 24, -2 },
+    { 28, 2 },
+    { 29, -1 },
+    { 31, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 27, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 16, 3 },
+    { 27, 1 },
+    { 28, 3 },
+    { 31, 3 },
+    { 42, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 24, 1 },
+    { 28, 3 },
+    { 31, 3 },
+    { 11, 1 },
+    { 27, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 107, 1 },
+    { 28, 1 },
+    { 31, 2 },
+    { 28, 1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 24, -2 },
+    { 56, -1 },
+    { 59, 1 },
+    { 61, -1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 69, 1 },
+    { 70, -2 },
+    { 92, 2 },
+    { 93, -2 },
+    { 98, -1 },
+    { 99, -1 },
+    { 106, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 86, -1 },
+    { 89, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 62, -1 },
+    { 63, 1 },
+    { 69, 1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 89, 1 },
+    { 105, -1 },
+    { 3, -1 },
+    { 4, -2 },
+    { 24, -2 },
+    { 56, -2 },
+    { 61, -1 },
+    { 70, -2 },
+    { 93, -2 },
+    { 98, -2 },
+    { 99, -2 },
+    { 105, -1 },
+    { 106, -2 },
+    { 107, -1 },
+    { 4, -1 },
+    { 24, -2 },
+    { 56, -3 },
+    { 57, -1 },
+    { 61, -1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -3 },
+    { 74, -1 },
+    { 84, -1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 93, -3 },
+    { 94, -1 },
+    { 98, -2 },
+    { 99, -2 },
+    { 100, -1 },
+    { 105, -1 },
+    { 106, -2 },
+    { 107, -2 },
+    { 4, 1 },
+    { 6, -1 },
+    { 42, -1 },
+    { 57, -1 },
+    { 60, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, 1 },
+    { 100, -2 },
+    { 102, 1 },
+    { 105, -1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 43, -1 },
+    { 60, -2 },
+    { 62, -3 },
+    { 63, 1 },
+    { 64, -2 },
+    { 69, 1 },
+    { 70, 1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 81, -4 },
+    { 82, -1 },
+    { 85, -1 },
+    { 88, -2 },
+    { 89, 2 },
+    { 90, -2 },
+    { 93, 1 },
+    { 98, 1 },
+    { 100, -2 },
+    { 102, -4 },
+    { 104, -1 },
+    { 105, -1 },
+    { 107, 1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -4 },
+    { 42, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 2 },
+    { 70, -3 },
+    { 72, 1 },
+    { 74, -1 },
+    { 84, -2 },
+    { 86, -2 },
+    { 87, -1 },
+    { 93, -3 },
+    { 94, -2 },
+    { 98, -2 },
+    { 99, -3 },
+    { 100, -2 },
+    { 102, 1 },
+    { 106, -2 },
+    { 107, -2 },
+    { 105, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 56, -1 },
+    { 61, -1 },
+    { 70, -1 },
+    { 93, -1 },
+    { 98, -1 },
+    { 99, -1 },
+    { 105, -1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 62, -2 },
+    { 64, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 84, 1 },
+    { 88, -2 },
+    { 90, -1 },
+    { 94, 1 },
+    { 100, -2 },
+    { 102, -2 },
+    { 104, -1 },
+    { 105, -1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 59, 2 },
+    { 67, 1 },
+    { 69, 1 },
+    { 84, 1 },
+    { 92, 2 },
+    { 94, 1 },
+    { 24, -1 },
+    { 60, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 87, -1 },
+    { 93, -1 },
+    { 99, -1 },
+    { 102, 1 },
+    { 106, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 70, -1 },
+    { 81, -1 },
+    { 88, -1 },
+    { 93, -1 },
+    { 98, -1 },
+    { 102, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 55, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -2 },
+    { 64, -2 },
+    { 67, -1 },
+    { 72, -1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 88, -2 },
+    { 102, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 100, -1 },
+    { 105, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 88, -1 },
+    { 93, -1 },
+    { 98, -1 },
+    { 102, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, 1 },
+    { 57, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 86, -1 },
+    { 89, 1 },
+    { 91, 1 },
+    { 98, 1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 105, -1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 100, -1 },
+    { 106, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, 1 },
+    { 106, -1 },
+    { 24, -3 },
+    { 106, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 106, -1 },
+    { 24, -2 },
+    { 24, -2 },
+    { 94, 1 },
+    { 24, -1 },
+    { 94, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 106, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 81, -1 },
+    { 88, -1 },
+    { 94, 1 },
+    { 24, -2 },
+    { 84, 1 },
+    { 94, 2 },
+    { 101, 1 },
+    { 107, 1 },
+    { 3, 1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 25, 1 },
+    { 40, 1 },
+    { 83, 1 },
+    { 84, 3 },
+    { 86, -1 },
+    { 92, 4 },
+    { 94, 3 },
+    { 100, -1 },
+    { 105, 1 },
+    { 4, -1 },
+    { 24, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 105, -1 },
+    { 107, -1 },
+    { 4, -1 },
+    { 24, -3 },
+    { 86, -1 },
+    { 87, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -1 },
+    { 4, -1 },
+    { 24, -2 },
+    { 92, 1 },
+    { 106, -1 },
+    { 24, -1 },
+    { 94, 1 },
+    { 105, -1 },
+    { 3, 1 },
+    { 4, 1 },
+    { 11, 1 },
+    { 24, 2 },
+    { 40, 1 },
+    { 89, 2 },
+    { 91, 2 },
+    { 107, 1 },
+    { 24, 1 },
+    { 81, -1 },
+    { 92, 1 },
+    { 24, -1 },
+    { 56, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 70, -1 },
+    { 93, -2 },
+    { 98, -1 },
+    { 99, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 42, -1 },
+    { 57, -1 },
+    { 60, -2 },
+    { 62, -3 },
+    { 64, -2 },
+    { 68, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 85, -1 },
+    { 88, -2 },
+    { 90, -1 },
+    { 97, -1 },
+    { 100, -2 },
+    { 102, -4 },
+    { 104, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 77, -1 },
+    { 81, -3 },
+    { 84, 1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 94, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, -2 },
+    { 64, -2 },
+    { 68, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 97, -2 },
+    { 100, -3 },
+    { 102, -3 },
+    { 104, -1 },
+    { 105, -1 },
+    { 107, 1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 42, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 81, -2 },
+    { 84, 1 },
+    { 88, -2 },
+    { 90, -1 },
+    { 94, 1 },
+    { 100, -1 },
+    { 107, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 60, -1 },
+    { 62, -2 },
+    { 64, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 81, -2 },
+    { 82, -1 },
+    { 88, -2 },
+    { 89, 1 },
+    { 94, 1 },
+    { 100, -1 },
+    { 102, -2 },
+    { 107, 1 },
+    { 55, 1 },
+    { 59, 3 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 2 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 84, 2 },
+    { 94, 2 },
+    { 102, 1 },
+    { 3, 1 },
+    { 8, 1 },
+    { 25, 1 },
+    { 40, 1 },
+    { 84, 3 },
+    { 92, 4 },
+    { 94, 3 },
+    { 101, 1 },
+    { 105, 1 },
+    { 55, 1 },
+    { 59, 3 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 2 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 84, 2 },
+    { 92, 3 },
+    { 94, 2 },
+    { 102, 1 },
+    { 24, -1 },
+    { 56, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 69, 2 },
+    { 70, -1 },
+    { 72, 2 },
+    { 93, -2 },
+    { 98, -2 },
+    { 102, 1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 57, -1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, -2 },
+    { 63, 1 },
+    { 64, -1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -2 },
+    { 82, -1 },
+    { 85, -1 },
+    { 88, -2 },
+    { 89, 1 },
+    { 90, -1 },
+    { 91, 1 },
+    { 97, -1 },
+    { 98, 1 },
+    { 100, -2 },
+    { 102, -2 },
+    { 104, -1 },
+    { 105, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 81, -1 },
+    { 88, -1 },
+    { 92, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 81, -1 },
+    { 88, -1 },
+    { 92, 1 },
+    { 94, 1 },
+    { 4, 1 },
+    { 7, -1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 55, 1 },
+    { 57, -1 },
+    { 59, 4 },
+    { 60, 2 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 2 },
+    { 65, 2 },
+    { 67, 2 },
+    { 68, -1 },
+    { 69, 2 },
+    { 72, 2 },
+    { 84, 2 },
+    { 86, -1 },
+    { 89, 1 },
+    { 91, 1 },
+    { 92, 4 },
+    { 94, 2 },
+    { 95, 1 },
+    { 98, 1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 101, 1 },
+    { 102, 2 },
+    { 105, 1 },
+    { 3, 1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 25, 1 },
+    { 40, 1 },
+    { 84, 3 },
+    { 92, 4 },
+    { 94, 1 },
+    { 101, 1 },
+    { 105, 1 },
+    { 107, 1 },
+    { 4, -3 },
+    { 24, -3 },
+    { 56, -3 },
+    { 61, -1 },
+    { 68, -1 },
+    { 70, -3 },
+    { 84, -1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 93, -3 },
+    { 94, -1 },
+    { 96, -1 },
+    { 98, -2 },
+    { 99, -2 },
+    { 100, -1 },
+    { 105, -2 },
+    { 107, -2 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 43, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 71, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 94, -1 },
+    { 97, -1 },
+    { 99, -1 },
+    { 100, -2 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 105, -1 },
+    { 24, -2 },
+    { 84, 1 },
+    { 92, 2 },
+    { 94, 1 },
+    { 6, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 100, -1 },
+    { 105, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 105, -1 },
+    { 84, 1 },
+    { 92, 2 },
+    { 94, 1 },
+    { 100, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, 1 },
+    { 57, -1 },
+    { 59, 2 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 78, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 88, -2 },
+    { 89, 1 },
+    { 90, -1 },
+    { 91, 1 },
+    { 92, 2 },
+    { 97, -1 },
+    { 98, 1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 104, -2 },
+    { 105, -1 },
+    { 24, -2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 84, 1 },
+    { 88, -1 },
+    { 92, 3 },
+    { 94, 1 },
+    { 107, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 12, -3 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 26, -2 },
+    { 28, -1 },
+    { 29, -2 },
+    { 33, -2 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, -2 },
+    { 45, -3 },
+    { 47, -2 },
+    { 50, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 58, -1 },
+    { 60, -2 },
+    { 62, -3 },
+    { 64, -2 },
+    { 67, -1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -1 },
+    { 76, -2 },
+    { 77, -1 },
+    { 81, -4 },
+    { 82, -1 },
+    { 88, -2 },
+    { 90, -2 },
+    { 93, -1 },
+    { 97, -1 },
+    { 102, -3 },
+    { 104, -1 },
+    { 1, -1 },
+    { 5, -4 },
+    { 7, -4 },
+    { 11, -1 },
+    { 12, -4 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 26, -2 },
+    { 28, -1 },
+    { 29, -3 },
+    { 30, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 45, -4 },
+    { 47, -2 },
+    { 48, -1 },
+    { 50, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -3 },
+    { 62, -4 },
+    { 64, -3 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 81, -4 },
+    { 82, -2 },
+    { 85, -1 },
+    { 88, -3 },
+    { 90, -2 },
+    { 93, -1 },
+    { 97, -2 },
+    { 100, -2 },
+    { 101, -1 },
+    { 102, -4 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 3 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -2 },
+    { 22, 1 },
+    { 23, -2 },
+    { 28, 2 },
+    { 31, 3 },
+    { 36, -1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, 3 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 69, 1 },
+    { 70, -2 },
+    { 72, 1 },
+    { 86, -2 },
+    { 87, -2 },
+    { 92, 3 },
+    { 93, -2 },
+    { 96, -1 },
+    { 98, -2 },
+    { 99, -3 },
+    { 100, -1 },
+    { 102, 1 },
+    { 106, -2 },
+    { 107, -2 },
+};
+
 static const EpdFontData bookerly_12_bolditalic = {
     bookerly_12_bolditalicBitmaps,
     bookerly_12_bolditalicGlyphs,
@@ -4096,4 +5803,8 @@ static const EpdFontData bookerly_12_bolditalic = {
     27,
     -7,
     true,
+    bookerly_12_bolditalicKernLeftClasses,
+    bookerly_12_bolditalicKernRightClasses,
+    bookerly_12_bolditalicKernPairOffsets,
+    bookerly_12_bolditalicKernPairs,
 };
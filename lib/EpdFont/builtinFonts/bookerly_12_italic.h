@@ -3065,7 +3065,7 @@ static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 7, 20, 8, 1, 19, 35, 0 }, // !
@@ -3855,6 +3855,1372 @@ static const EpdUnicodeInterval bookerly_12_italicIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_12_italicKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 3, 4, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 7, 0, 8, 9, 10, 11, 12, 12, 13,
+    14, 15, 16, 17, 8, 18, 19, 20, 21, 22, 23, 24, 24, 25, 26, 27,
+    28, 29, 0, 0, 0, 0, 30, 31, 32, 0, 33, 34, 35, 30, 0, 36,
+    37, 0, 30, 30, 31, 31, 38, 39, 32, 32, 30, 40, 40, 41, 40, 42,
+    43, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+    0, 0, 0, 46, 6, 6, 6, 6, 6, 6, 9, 0, 9, 9, 9, 9,
+    12, 12, 12, 12, 8, 17, 8, 8, 8, 8, 8, 0, 8, 23, 23, 23,
+    23, 26, 47, 48, 30, 30, 30, 30, 30, 30, 33, 49, 33, 33, 33, 33,
+    0, 0, 50, 50, 31, 30, 31, 31, 31, 31, 31, 0, 51, 30, 30, 30,
+    30, 40, 31, 40, 6, 30, 6, 30, 52, 53, 0, 32, 0, 32, 0, 32,
+    0, 32, 8, 54, 8, 0, 9, 33, 9, 33, 9, 33, 55, 56, 9, 33,
+    11, 35, 11, 35, 11, 35, 11, 35, 12, 30, 12, 30, 12, 57, 12, 50,
+    12, 50, 58, 59, 12, 30, 13, 36, 13, 60, 14, 37, 32, 15, 0, 15,
+    61, 0, 54, 0, 0, 15, 62, 17, 30, 17, 30, 17, 30, 30, 17, 63,
+    8, 31, 8, 31, 8, 31, 9, 33, 20, 39, 20, 39, 20, 39, 21, 32,
+    21, 32, 21, 49, 21, 32, 22, 49, 22, 0, 22, 32, 23, 30, 23, 30,
+    23, 30, 23, 30, 23, 30, 23, 64, 24, 40, 26, 40, 26, 27, 42, 27,
+    42, 27, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 9, 65, 0, 0, 21, 66, 66, 67, 68, 68,
+    69, 70, 66, 71, 66, 72, 0, 73, 74, 75, 9, 70, 73, 66, 66, 70,
+    66, 76, 66, 77, 66, 78, 79, 74, 71, 80, 81, 75, 66, 66, 75, 68,
+    66, 68, 77, 77, 66, 30, 82, 83, 0, 31, 33, 33, 83, 30, 30, 32,
+    30, 30, 30, 31, 84, 31, 32, 84, 85, 31, 86, 87, 30, 30, 87, 88,
+    30, 88, 31, 31, 30, 33, 33, 84, 0, 32, 32, 0, 89, 90, 88, 88,
+    84, 32, 30, 85, 30, 91, 88, 77, 31, 92, 93, 75, 87, 68, 88, 78,
+    31, 94, 95, 96, 0, 0, 0, 97, 98, 73, 83, 97, 98, 70, 32, 70,
+    32, 70, 32, 75, 87, 0, 0, 0, 0, 99, 83, 79, 32, 74, 87, 100,
+    85, 100, 85, 101, 102, 75, 87, 75, 87, 66, 30, 103, 84, 104, 33, 104,
+    33, 66, 70, 33, 105, 106, 75, 87, 107, 90, 75, 87, 66, 0, 75, 87,
+    0, 72, 30, 72, 30, 9, 33, 9, 33, 77, 31, 77, 31, 70, 33, 73,
+    83, 108, 109, 66, 30, 66, 30, 77, 31, 77, 31, 77, 31, 77, 31, 71,
+    85, 71, 85, 71, 85, 66, 30, 74, 0, 66, 30, 96, 0, 110, 111, 81,
+    86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 4, 4, 4, 0, 0, 112, 113, 114, 112, 112, 113, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_12_italicKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+    0, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    9, 0, 0, 0, 10, 0, 11, 12, 13, 12, 14, 14, 13, 14, 14, 15,
+    14, 14, 16, 14, 13, 12, 13, 12, 17, 18, 19, 20, 20, 21, 22, 0,
+    0, 23, 24, 0, 0, 0, 25, 26, 25, 25, 25, 27, 28, 26, 29, 30,
+    26, 26, 31, 31, 25, 32, 25, 31, 33, 34, 35, 36, 36, 37, 38, 39,
+    0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 0, 0, 43, 11, 11, 11, 11, 11, 11, 44, 13, 14, 14, 14, 14,
+    14, 14, 14, 14, 12, 14, 13, 13, 13, 13, 13, 0, 13, 19, 19, 19,
+    19, 22, 14, 45, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    46, 29, 47, 47, 25, 31, 25, 25, 25, 25, 25, 0, 48, 35, 35, 35,
+    35, 36, 49, 36, 11, 25, 11, 25, 11, 25, 13, 25, 13, 25, 13, 25,
+    13, 50, 12, 25, 12, 25, 14, 25, 14, 25, 14, 25, 14, 25, 14, 25,
+    13, 28, 13, 28, 13, 28, 13, 28, 14, 26, 14, 51, 14, 52, 14, 47,
+    14, 47, 14, 29, 14, 31, 14, 29, 15, 53, 14, 26, 31, 14, 26, 14,
+    26, 14, 26, 14, 26, 14, 26, 14, 31, 14, 31, 14, 31, 31, 14, 31,
+    13, 25, 13, 25, 13, 25, 13, 25, 12, 31, 12, 31, 12, 31, 17, 33,
+    17, 33, 17, 33, 17, 54, 18, 34, 18, 34, 18, 34, 19, 35, 19, 35,
+    19, 35, 19, 35, 19, 35, 19, 35, 20, 36, 22, 36, 22, 0, 39, 0,
+    39, 0, 39, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 55, 55, 56, 55, 57, 17, 55, 55, 58, 59, 55,
+    56, 55, 55, 60, 55, 61, 55, 62, 55, 63, 55, 64, 17, 55, 55, 55,
+    59, 65, 55, 57, 55, 62, 57, 56, 60, 66, 67, 55, 68, 55, 55, 56,
+    55, 55, 17, 55, 69, 70, 71, 70, 72, 73, 70, 74, 75, 76, 76, 77,
+    78, 79, 77, 70, 77, 77, 70, 77, 80, 70, 81, 76, 82, 76, 76, 83,
+    76, 76, 75, 77, 84, 70, 70, 85, 72, 70, 86, 17, 87, 88, 78, 77,
+    85, 77, 76, 80, 76, 56, 77, 57, 70, 89, 80, 55, 77, 0, 90, 62,
+    77, 55, 91, 55, 72, 55, 77, 64, 74, 17, 75, 55, 77, 55, 77, 0,
+    0, 56, 0, 55, 77, 55, 77, 55, 77, 57, 70, 57, 70, 56, 77, 92,
+    80, 92, 80, 67, 81, 0, 0, 68, 82, 68, 82, 55, 85, 93, 94, 93,
+    94, 55, 64, 74, 55, 77, 59, 78, 55, 77, 55, 77, 68, 82, 0, 79,
+    17, 61, 70, 61, 70, 95, 70, 55, 70, 96, 97, 0, 97, 64, 74, 17,
+    75, 17, 98, 55, 76, 55, 76, 57, 70, 57, 70, 57, 70, 0, 75, 60,
+    80, 60, 80, 60, 80, 0, 82, 55, 72, 55, 76, 55, 72, 67, 81, 67,
+    81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 99, 100, 6, 99, 99, 100, 6,
+    0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 1, 0, 0, 0,
+    10, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_italicKernPairOffsets[115] = {
+    0, 23, 27, 61, 65, 103, 120, 129, 139, 142, 156, 163, 168, 174, 183, 193,
+    196, 201, 217, 234, 249, 253, 269, 283, 301, 307, 331, 332, 342, 369, 372, 377,
+    378, 379, 396, 410, 412, 415, 422, 429, 434, 437, 440, 452, 465, 472, 491, 505,
+    506, 509, 518, 526, 547, 553, 577, 583, 586, 595, 603, 605, 609, 611, 614, 617,
+    623, 634, 640, 650, 660, 676, 697, 726, 749, 760, 786, 788, 792, 804, 826, 827,
+    843, 858, 862, 864, 868, 874, 876, 884, 890, 896, 899, 903, 927, 928, 957, 968,
+    985, 990, 993, 999, 1035, 1052, 1060, 1073, 1074, 1076, 1078, 1089, 1094, 1097, 1118, 1122,
+    1164, 1221, 1254,
+};
+
+static const EpdKernPair bookerly_12_italicKernPairs[] = {
+    { 13, -1 },
+    { 15, 2 },
+    { 22, 1 },
+    { 25, -1 },
+    { 26, 2 },
+    { 27, 4 },
+    { 28, 2 },
+    { 30, 4 },
+    { 38, 2 },
+    { 48, -1 },
+    { 49, 2 },
+    { 50, -1 },
+    { 51, 2 },
+    { 57, -1 },
+    { 58, 2 },
+    { 60, 1 },
+    { 63, 1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 78, -1 },
+    { 85, 2 },
+    { 88, 4 },
+    { 92, 1 },
+    { 11, -2 },
+    { 44, -2 },
+    { 61, -2 },
+    { 95, -2 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -2 },
+    { 27, 1 },
+    { 30, 2 },
+    { 36, -2 },
+    { 38, -2 },
+    { 44, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 2 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, -2 },
+    { 69, 1 },
+    { 80, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 88, 2 },
+    { 89, -2 },
+    { 90, -1 },
+    { 92, -2 },
+    { 93, -3 },
+    { 94, -1 },
+    { 95, 1 },
+    { 99, -2 },
+    { 100, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 22, -1 },
+    { 92, -1 },
+    { 11, -2 },
+    { 13, -1 },
+    { 16, -1 },
+    { 25, -2 },
+    { 27, -1 },
+    { 28, -2 },
+    { 33, -2 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -2 },
+    { 44, -3 },
+    { 48, -2 },
+    { 50, -2 },
+    { 54, -2 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -2 },
+    { 63, -2 },
+    { 65, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -1 },
+    { 78, -3 },
+    { 79, -2 },
+    { 81, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 86, -2 },
+    { 91, -2 },
+    { 94, -1 },
+    { 95, -3 },
+    { 97, -2 },
+    { 3, -2 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 23, -4 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 41, -1 },
+    { 99, -2 },
+    { 100, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -1 },
+    { 23, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 44, -1 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -2 },
+    { 25, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 44, -2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 54, -1 },
+    { 100, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 99, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 21, 1 },
+    { 35, -1 },
+    { 41, -1 },
+    { 44, 1 },
+    { 3, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -2 },
+    { 23, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 99, -2 },
+    { 20, -1 },
+    { 23, -1 },
+    { 99, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 11, -1 },
+    { 44, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -2 },
+    { 14, -1 },
+    { 16, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 28, -1 },
+    { 44, -3 },
+    { 48, -1 },
+    { 50, -1 },
+    { 2, 6 },
+    { 4, 5 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, 5 },
+    { 15, 2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, 6 },
+    { 27, 1 },
+    { 28, 2 },
+    { 30, 2 },
+    { 32, 1 },
+    { 40, 6 },
+    { 44, -1 },
+    { 49, 1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 16, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 2 },
+    { 22, -2 },
+    { 23, -2 },
+    { 41, -1 },
+    { 44, 1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 3, 2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -2 },
+    { 25, -1 },
+    { 33, -1 },
+    { 41, -1 },
+    { 44, -2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 54, -1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -2 },
+    { 25, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 54, -1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 13, -1 },
+    { 25, -2 },
+    { 28, -2 },
+    { 33, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -3 },
+    { 48, -2 },
+    { 50, -2 },
+    { 54, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 21, 1 },
+    { 44, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -3 },
+    { 13, -1 },
+    { 25, -2 },
+    { 27, -1 },
+    { 28, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 47, 1 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 54, -2 },
+    { 20, -1 },
+    { 15, 1 },
+    { 25, -1 },
+    { 27, 2 },
+    { 30, 1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 58, 1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 88, 1 },
+    { 11, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 2 },
+    { 22, -2 },
+    { 28, 2 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 44, 1 },
+    { 56, -1 },
+    { 59, 2 },
+    { 61, 1 },
+    { 63, 2 },
+    { 64, 1 },
+    { 67, 2 },
+    { 68, -2 },
+    { 69, 2 },
+    { 80, -1 },
+    { 81, 1 },
+    { 82, -2 },
+    { 83, -1 },
+    { 89, -2 },
+    { 92, -2 },
+    { 93, -2 },
+    { 95, 1 },
+    { 3, -1 },
+    { 23, -2 },
+    { 99, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, -2 },
+    { 99, -1 },
+    { 23, -1 },
+    { 23, -2 },
+    { 2, 1 },
+    { 3, 2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 10, 1 },
+    { 23, 2 },
+    { 26, 1 },
+    { 28, -1 },
+    { 46, 1 },
+    { 47, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 52, 2 },
+    { 53, 1 },
+    { 99, 1 },
+    { 100, 2 },
+    { 3, 1 },
+    { 6, -1 },
+    { 24, 1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 2 },
+    { 31, 1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 99, 1 },
+    { 100, 2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -2 },
+    { 28, 1 },
+    { 48, 1 },
+    { 2, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, -1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 23, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 100, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 23, -2 },
+    { 48, 1 },
+    { 100, 1 },
+    { 2, -1 },
+    { 23, -2 },
+    { 48, 1 },
+    { 15, 1 },
+    { 25, -1 },
+    { 27, 1 },
+    { 30, 2 },
+    { 44, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 58, 1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 88, 2 },
+    { 95, -1 },
+    { 15, 2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 30, 2 },
+    { 49, -1 },
+    { 51, -1 },
+    { 58, 2 },
+    { 85, -1 },
+    { 88, 2 },
+    { 89, -1 },
+    { 92, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 18, -1 },
+    { 56, -1 },
+    { 66, 1 },
+    { 68, -1 },
+    { 96, 1 },
+    { 15, 2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, 2 },
+    { 30, 2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 58, 2 },
+    { 70, -1 },
+    { 73, -1 },
+    { 85, -1 },
+    { 88, 2 },
+    { 89, -1 },
+    { 92, -1 },
+    { 2, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 11, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 23, -2 },
+    { 44, -2 },
+    { 99, -1 },
+    { 23, -1 },
+    { 27, 1 },
+    { 30, 1 },
+    { 2, 1 },
+    { 3, 2 },
+    { 23, 2 },
+    { 26, 2 },
+    { 47, 1 },
+    { 49, 2 },
+    { 51, 2 },
+    { 52, 1 },
+    { 100, 1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, -2 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 99, -1 },
+    { 3, -2 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 3 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 23, -4 },
+    { 27, 3 },
+    { 28, 1 },
+    { 30, 3 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 41, -1 },
+    { 99, -2 },
+    { 100, -2 },
+    { 3, -1 },
+    { 23, -2 },
+    { 27, 3 },
+    { 28, 1 },
+    { 30, 4 },
+    { 99, -1 },
+    { 2, 3 },
+    { 3, 3 },
+    { 10, 2 },
+    { 23, 2 },
+    { 24, 1 },
+    { 26, 3 },
+    { 27, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 46, 1 },
+    { 49, 3 },
+    { 50, 1 },
+    { 51, 3 },
+    { 54, 1 },
+    { 99, 2 },
+    { 100, 2 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 15, 2 },
+    { 27, 2 },
+    { 30, 2 },
+    { 23, -2 },
+    { 27, 2 },
+    { 30, 2 },
+    { 2, 1 },
+    { 3, 1 },
+    { 23, 2 },
+    { 26, 1 },
+    { 47, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 100, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 15, 2 },
+    { 27, 2 },
+    { 30, 2 },
+    { 41, -1 },
+    { 27, 2 },
+    { 30, 2 },
+    { 26, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 100, 1 },
+    { 27, 1 },
+    { 30, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -2 },
+    { 3, -1 },
+    { 23, -2 },
+    { 27, 3 },
+    { 28, 1 },
+    { 30, 3 },
+    { 99, -1 },
+    { 23, -2 },
+    { 56, -2 },
+    { 58, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 82, -1 },
+    { 89, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 99, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 82, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 3, -2 },
+    { 23, -2 },
+    { 56, -2 },
+    { 60, -1 },
+    { 68, -2 },
+    { 82, -1 },
+    { 89, -2 },
+    { 92, -2 },
+    { 93, -1 },
+    { 99, -2 },
+    { 3, -2 },
+    { 23, -2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 68, -2 },
+    { 71, -1 },
+    { 80, -2 },
+    { 82, -2 },
+    { 83, -1 },
+    { 89, -2 },
+    { 92, -2 },
+    { 93, -2 },
+    { 99, -2 },
+    { 100, -2 },
+    { 3, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 57, -1 },
+    { 63, 1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 69, 1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 82, -2 },
+    { 83, -2 },
+    { 94, -2 },
+    { 95, 1 },
+    { 98, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 23, 1 },
+    { 56, 1 },
+    { 59, -2 },
+    { 60, 2 },
+    { 61, -3 },
+    { 63, -2 },
+    { 64, 1 },
+    { 67, 1 },
+    { 68, 2 },
+    { 70, -2 },
+    { 73, 1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 78, -3 },
+    { 79, -1 },
+    { 84, -1 },
+    { 85, 1 },
+    { 86, -1 },
+    { 87, 1 },
+    { 89, 1 },
+    { 92, 2 },
+    { 94, -1 },
+    { 95, -3 },
+    { 97, -1 },
+    { 100, 1 },
+    { 3, -2 },
+    { 10, -1 },
+    { 23, -4 },
+    { 41, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 64, 1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 68, -3 },
+    { 71, -1 },
+    { 76, -1 },
+    { 80, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 89, -3 },
+    { 92, -2 },
+    { 93, -3 },
+    { 94, -2 },
+    { 99, -2 },
+    { 100, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 56, -1 },
+    { 60, -1 },
+    { 68, -1 },
+    { 89, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 3, 2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 41, -1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, -2 },
+    { 63, -2 },
+    { 69, -1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 78, -3 },
+    { 79, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 94, -2 },
+    { 95, -2 },
+    { 97, -1 },
+    { 98, -1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 58, 2 },
+    { 88, 2 },
+    { 23, -1 },
+    { 89, -1 },
+    { 93, -1 },
+    { 99, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 58, -1 },
+    { 61, -1 },
+    { 68, -1 },
+    { 78, -1 },
+    { 89, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 23, -1 },
+    { 55, -1 },
+    { 59, -2 },
+    { 61, -2 },
+    { 63, -2 },
+    { 65, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 78, -3 },
+    { 79, -1 },
+    { 84, -1 },
+    { 95, -3 },
+    { 94, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -2 },
+    { 56, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 68, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 89, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 57, -1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 69, 1 },
+    { 82, -2 },
+    { 83, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, 1 },
+    { 99, -1 },
+    { 23, -3 },
+    { 99, -1 },
+    { 3, -1 },
+    { 23, -2 },
+    { 82, -1 },
+    { 99, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 78, -1 },
+    { 23, -2 },
+    { 100, 1 },
+    { 2, 1 },
+    { 23, -2 },
+    { 24, 1 },
+    { 40, 1 },
+    { 80, 1 },
+    { 82, -1 },
+    { 88, 3 },
+    { 98, 1 },
+    { 3, -1 },
+    { 23, -3 },
+    { 82, -1 },
+    { 83, -1 },
+    { 98, -1 },
+    { 99, -2 },
+    { 2, 1 },
+    { 3, 2 },
+    { 23, 2 },
+    { 85, 2 },
+    { 87, 1 },
+    { 100, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 78, -1 },
+    { 56, -1 },
+    { 59, 1 },
+    { 68, -1 },
+    { 89, -2 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 57, -1 },
+    { 59, -2 },
+    { 61, -3 },
+    { 63, -2 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 78, -4 },
+    { 79, -1 },
+    { 84, -2 },
+    { 91, -1 },
+    { 94, -1 },
+    { 95, -3 },
+    { 97, -1 },
+    { 98, -1 },
+    { 77, 1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 59, -2 },
+    { 60, 1 },
+    { 61, -3 },
+    { 63, -2 },
+    { 66, -1 },
+    { 68, 1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -3 },
+    { 79, -2 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 91, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 97, -2 },
+    { 98, -2 },
+    { 100, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 41, -1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 78, -2 },
+    { 79, -1 },
+    { 84, -1 },
+    { 94, -1 },
+    { 100, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 59, -1 },
+    { 61, -2 },
+    { 63, -2 },
+    { 69, -1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 78, -2 },
+    { 79, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 95, -2 },
+    { 100, 1 },
+    { 58, 3 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 88, 3 },
+    { 80, 1 },
+    { 88, 3 },
+    { 98, 1 },
+    { 23, -1 },
+    { 56, -1 },
+    { 63, 1 },
+    { 68, -1 },
+    { 89, -2 },
+    { 92, -2 },
+    { 3, 1 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 57, -1 },
+    { 59, -2 },
+    { 60, 1 },
+    { 61, -2 },
+    { 63, -2 },
+    { 66, -1 },
+    { 68, 1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -3 },
+    { 79, -2 },
+    { 81, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, 1 },
+    { 86, -2 },
+    { 87, 1 },
+    { 91, -1 },
+    { 94, -2 },
+    { 95, -2 },
+    { 97, -1 },
+    { 98, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 57, -1 },
+    { 58, 3 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 69, 1 },
+    { 82, -2 },
+    { 83, -1 },
+    { 88, 2 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, 1 },
+    { 2, 1 },
+    { 23, -2 },
+    { 24, 1 },
+    { 40, 1 },
+    { 80, 1 },
+    { 88, 4 },
+    { 98, 1 },
+    { 100, 1 },
+    { 3, -3 },
+    { 56, -2 },
+    { 60, -1 },
+    { 66, -1 },
+    { 68, -3 },
+    { 76, -1 },
+    { 80, -1 },
+    { 82, -2 },
+    { 83, -1 },
+    { 89, -3 },
+    { 90, -1 },
+    { 92, -2 },
+    { 100, -2 },
+    { 92, -1 },
+    { 60, 1 },
+    { 66, -1 },
+    { 23, -2 },
+    { 88, 2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 61, -1 },
+    { 74, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 88, 1 },
+    { 94, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 57, -1 },
+    { 61, -1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 75, -1 },
+    { 77, -2 },
+    { 79, -1 },
+    { 82, -2 },
+    { 83, -1 },
+    { 84, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 97, -2 },
+    { 23, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 100, 1 },
+    { 1, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 11, -3 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 25, -2 },
+    { 27, -1 },
+    { 28, -2 },
+    { 33, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 43, -2 },
+    { 44, -3 },
+    { 48, -2 },
+    { 50, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 59, -2 },
+    { 61, -3 },
+    { 62, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -1 },
+    { 78, -4 },
+    { 79, -2 },
+    { 81, -1 },
+    { 84, -2 },
+    { 86, -2 },
+    { 89, -1 },
+    { 91, -1 },
+    { 95, -3 },
+    { 97, -1 },
+    { 98, -1 },
+    { 1, -2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 10, -1 },
+    { 11, -4 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 25, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 44, -4 },
+    { 46, -1 },
+    { 48, -2 },
+    { 50, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -3 },
+    { 61, -4 },
+    { 62, -1 },
+    { 63, -3 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -1 },
+    { 78, -4 },
+    { 79, -2 },
+    { 81, -1 },
+    { 84, -3 },
+    { 86, -2 },
+    { 89, -1 },
+    { 91, -2 },
+    { 94, -2 },
+    { 95, -4 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -2 },
+    { 27, 2 },
+    { 30, 2 },
+    { 36, -2 },
+    { 44, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 2 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, -2 },
+    { 69, 1 },
+    { 80, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 88, 2 },
+    { 89, -2 },
+    { 90, -1 },
+    { 92, -2 },
+    { 93, -3 },
+    { 94, -1 },
+    { 95, 1 },
+    { 99, -2 },
+    { 100, -2 },
+};
+
 static const EpdFontData bookerly_12_italic = {
     bookerly_12_italicBitmaps,
     bookerly_12_italicGlyphs,
@@ -3864,4 +5230,8 @@ static const EpdFontData bookerly_12_italic = {
     27,
     -7,
     true,
+    bookerly_12_italicKernLeftClasses,
+    bookerly_12_italicKernRightClasses,
+    bookerly_12_italicKernPairOffsets,
+    bookerly_12_italicKernPairs,
 };
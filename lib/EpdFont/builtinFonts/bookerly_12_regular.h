@@ -2956,7 +2956,7 @@ static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 4, 20, 7, 2, 19, 20, 0 }, // !
@@ -3746,6 +3746,1455 @@ static const EpdUnicodeInterval bookerly_12_regularIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_12_regularKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3,
+    0, 4, 5, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 8, 9, 10, 0, 11, 0, 12, 12, 13,
+    14, 15, 16, 17, 10, 18, 19, 20, 21, 22, 23, 24, 24, 25, 26, 27,
+    28, 29, 0, 0, 0, 0, 30, 31, 32, 12, 33, 34, 35, 36, 37, 0,
+    0, 38, 36, 36, 31, 31, 39, 40, 41, 42, 43, 44, 44, 45, 44, 42,
+    46, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49,
+    0, 0, 0, 50, 7, 7, 7, 7, 7, 7, 0, 9, 0, 0, 0, 0,
+    12, 12, 12, 12, 10, 17, 10, 10, 10, 10, 10, 0, 51, 23, 23, 23,
+    23, 26, 52, 53, 30, 30, 30, 30, 30, 30, 33, 32, 33, 33, 33, 33,
+    37, 37, 54, 54, 55, 36, 31, 31, 31, 31, 31, 0, 31, 43, 43, 43,
+    43, 44, 31, 44, 7, 30, 7, 30, 56, 57, 9, 32, 9, 32, 9, 32,
+    9, 32, 10, 58, 10, 12, 0, 33, 0, 33, 0, 33, 59, 60, 0, 33,
+    0, 35, 0, 35, 0, 35, 0, 35, 12, 36, 12, 36, 12, 54, 12, 54,
+    12, 54, 61, 62, 12, 37, 13, 0, 13, 63, 14, 0, 0, 15, 38, 15,
+    38, 0, 58, 0, 0, 15, 64, 17, 36, 17, 36, 17, 36, 36, 17, 36,
+    10, 31, 10, 31, 10, 31, 0, 33, 20, 40, 20, 40, 20, 40, 21, 41,
+    21, 41, 21, 41, 21, 41, 22, 42, 22, 0, 22, 42, 23, 43, 23, 43,
+    23, 43, 23, 43, 23, 43, 23, 65, 24, 44, 26, 44, 26, 27, 42, 27,
+    42, 27, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 66, 66, 67, 0, 68, 69, 70, 70, 71, 72, 72,
+    73, 74, 70, 75, 70, 76, 77, 78, 79, 80, 66, 74, 78, 70, 70, 74,
+    70, 81, 70, 82, 70, 83, 84, 79, 75, 85, 86, 80, 70, 70, 80, 72,
+    70, 72, 82, 82, 70, 87, 88, 0, 89, 90, 91, 92, 42, 93, 93, 92,
+    93, 93, 93, 88, 93, 88, 32, 89, 94, 88, 95, 90, 93, 93, 90, 96,
+    93, 96, 88, 88, 93, 91, 91, 97, 89, 0, 41, 98, 99, 0, 96, 96,
+    100, 92, 93, 94, 93, 101, 102, 82, 88, 103, 104, 80, 90, 72, 96, 83,
+    88, 105, 106, 107, 89, 0, 0, 108, 109, 78, 42, 108, 109, 74, 92, 74,
+    92, 74, 92, 80, 90, 0, 0, 0, 0, 110, 111, 84, 32, 79, 89, 112,
+    94, 112, 94, 113, 114, 80, 90, 80, 90, 70, 93, 115, 100, 116, 91, 116,
+    91, 70, 74, 92, 66, 93, 80, 90, 71, 117, 80, 90, 70, 93, 80, 90,
+    118, 76, 87, 76, 87, 66, 91, 66, 91, 82, 88, 82, 88, 74, 92, 78,
+    42, 0, 0, 70, 93, 70, 93, 82, 88, 82, 88, 82, 88, 82, 88, 75,
+    94, 75, 94, 75, 94, 70, 93, 79, 89, 70, 93, 107, 89, 119, 95, 86,
+    95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 120, 121, 4, 120, 120, 121, 4,
+    120, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_12_regularKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4,
+    0, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    10, 0, 0, 0, 11, 0, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15,
+    13, 13, 16, 13, 14, 13, 14, 13, 17, 18, 19, 20, 20, 21, 22, 0,
+    0, 23, 24, 0, 0, 0, 25, 26, 27, 27, 27, 28, 29, 26, 30, 31,
+    26, 26, 32, 32, 27, 33, 27, 32, 34, 35, 36, 37, 37, 38, 39, 40,
+    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 0, 0, 44, 12, 12, 12, 12, 12, 12, 45, 14, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 0, 46, 19, 19, 19,
+    19, 22, 13, 47, 25, 25, 25, 48, 49, 25, 25, 27, 27, 27, 27, 50,
+    51, 30, 52, 53, 27, 32, 27, 27, 27, 27, 27, 0, 27, 36, 36, 36,
+    36, 39, 26, 39, 12, 54, 12, 55, 12, 25, 14, 27, 14, 27, 14, 27,
+    14, 27, 13, 27, 13, 27, 13, 27, 13, 27, 13, 27, 13, 27, 13, 27,
+    14, 29, 14, 29, 14, 29, 14, 29, 13, 26, 13, 56, 13, 53, 13, 53,
+    13, 53, 13, 30, 13, 30, 13, 30, 15, 57, 13, 26, 32, 13, 26, 13,
+    26, 13, 26, 13, 26, 13, 58, 13, 32, 13, 32, 13, 32, 32, 13, 32,
+    14, 27, 14, 27, 14, 27, 14, 27, 13, 32, 13, 32, 13, 59, 17, 34,
+    17, 34, 17, 34, 17, 60, 18, 35, 18, 35, 18, 35, 19, 36, 19, 36,
+    19, 36, 19, 36, 19, 36, 19, 36, 20, 37, 22, 39, 22, 0, 40, 0,
+    40, 0, 61, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 62, 62, 63, 62, 64, 65, 62, 62, 66, 67, 62,
+    63, 62, 62, 68, 62, 69, 62, 62, 62, 70, 62, 71, 0, 62, 62, 62,
+    67, 72, 62, 64, 62, 62, 64, 63, 68, 73, 74, 62, 75, 62, 62, 63,
+    62, 62, 0, 62, 76, 77, 78, 79, 79, 80, 81, 82, 83, 79, 79, 79,
+    84, 79, 79, 81, 79, 85, 81, 86, 87, 81, 88, 79, 89, 79, 79, 86,
+    79, 79, 83, 79, 90, 81, 81, 91, 79, 81, 92, 0, 93, 94, 84, 79,
+    91, 79, 79, 95, 79, 63, 86, 64, 81, 96, 87, 62, 79, 0, 0, 62,
+    85, 62, 79, 62, 79, 62, 79, 71, 82, 0, 83, 62, 79, 62, 79, 0,
+    0, 63, 86, 62, 79, 62, 79, 62, 79, 64, 81, 64, 81, 63, 86, 97,
+    87, 97, 87, 74, 88, 0, 86, 75, 89, 75, 89, 62, 91, 98, 99, 98,
+    99, 62, 71, 82, 62, 79, 67, 84, 62, 79, 62, 79, 75, 89, 0, 79,
+    91, 69, 77, 69, 77, 100, 77, 62, 81, 0, 101, 0, 101, 71, 82, 0,
+    83, 0, 102, 62, 79, 62, 79, 64, 81, 64, 81, 64, 81, 0, 83, 68,
+    95, 68, 95, 68, 95, 0, 89, 62, 79, 62, 79, 62, 79, 74, 88, 74,
+    88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 0, 6, 6, 6, 0, 0, 103, 104, 7, 103, 103, 104, 7,
+    103, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 1, 0, 0, 0,
+    11, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_regularKernPairOffsets[122] = {
+    0, 4, 12, 22, 51, 61, 106, 122, 127, 129, 139, 156, 158, 174, 187, 197,
+    201, 215, 229, 246, 262, 264, 288, 299, 333, 344, 380, 381, 389, 409, 416, 420,
+    421, 424, 447, 453, 458, 461, 462, 467, 480, 483, 484, 486, 503, 506, 515, 522,
+    526, 539, 576, 584, 600, 606, 611, 615, 633, 642, 667, 668, 673, 676, 681, 686,
+    699, 703, 704, 716, 718, 721, 726, 741, 755, 770, 787, 824, 847, 850, 856, 879,
+    886, 892, 908, 926, 927, 945, 960, 970, 974, 980, 984, 986, 991, 992, 1006, 1009,
+    1017, 1026, 1032, 1034, 1042, 1049, 1053, 1079, 1092, 1123, 1130, 1145, 1162, 1167, 1173, 1178,
+    1216, 1235, 1239, 1252, 1254, 1262, 1264, 1281, 1307, 1337,
+};
+
+static const EpdKernPair bookerly_12_regularKernPairs[] = {
+    { 12, -1 },
+    { 29, -1 },
+    { 35, 1 },
+    { 69, -1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 31, 1 },
+    { 46, -1 },
+    { 57, 1 },
+    { 64, -1 },
+    { 66, 1 },
+    { 94, 1 },
+    { 12, -2 },
+    { 20, 1 },
+    { 21, 1 },
+    { 29, -1 },
+    { 45, -3 },
+    { 67, -2 },
+    { 69, -2 },
+    { 74, 1 },
+    { 96, 1 },
+    { 100, -3 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 46, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 66, 1 },
+    { 68, -2 },
+    { 69, 1 },
+    { 73, -1 },
+    { 75, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, -2 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -2 },
+    { 99, -1 },
+    { 103, -2 },
+    { 104, -1 },
+    { 12, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 45, -1 },
+    { 63, -1 },
+    { 69, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 100, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 17, -1 },
+    { 25, -2 },
+    { 27, -2 },
+    { 28, -1 },
+    { 29, -2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 45, -4 },
+    { 46, -1 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, -2 },
+    { 55, -2 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 73, -1 },
+    { 77, -2 },
+    { 80, -3 },
+    { 81, -2 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 90, -2 },
+    { 92, -2 },
+    { 93, 1 },
+    { 100, -4 },
+    { 102, -1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -1 },
+    { 11, -1 },
+    { 12, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 22, -3 },
+    { 23, -2 },
+    { 37, -2 },
+    { 39, -2 },
+    { 42, -1 },
+    { 45, 1 },
+    { 103, -2 },
+    { 104, -2 },
+    { 20, -1 },
+    { 23, -1 },
+    { 27, 1 },
+    { 45, -1 },
+    { 50, 1 },
+    { 14, -1 },
+    { 46, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 35, 1 },
+    { 45, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 12, -2 },
+    { 25, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 45, -3 },
+    { 48, -1 },
+    { 49, -1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 57, 1 },
+    { 60, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 25, -1 },
+    { 34, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 60, -1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 27, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 46, -1 },
+    { 50, -1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 57, 1 },
+    { 4, -1 },
+    { 12, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 23, -3 },
+    { 37, -1 },
+    { 39, -1 },
+    { 103, -1 },
+    { 18, -1 },
+    { 21, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 12, -1 },
+    { 25, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 60, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 12, -2 },
+    { 18, 1 },
+    { 29, -1 },
+    { 31, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 45, -3 },
+    { 57, 1 },
+    { 104, 1 },
+    { 3, 1 },
+    { 5, 1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 12, -1 },
+    { 15, 2 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, 1 },
+    { 31, 2 },
+    { 35, 1 },
+    { 39, 1 },
+    { 41, 2 },
+    { 45, -2 },
+    { 57, 2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 45, 1 },
+    { 103, -2 },
+    { 104, -1 },
+    { 29, -1 },
+    { 45, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -3 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 16, -1 },
+    { 25, -1 },
+    { 27, -2 },
+    { 29, -2 },
+    { 34, -2 },
+    { 42, -1 },
+    { 45, -2 },
+    { 46, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 60, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -2 },
+    { 29, -1 },
+    { 34, -1 },
+    { 45, -2 },
+    { 47, -1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 60, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -3 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 25, -2 },
+    { 26, 1 },
+    { 27, -2 },
+    { 29, -2 },
+    { 32, -1 },
+    { 34, -2 },
+    { 38, -1 },
+    { 40, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -4 },
+    { 46, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 52, 2 },
+    { 53, 2 },
+    { 54, -1 },
+    { 55, -2 },
+    { 56, 1 },
+    { 57, 2 },
+    { 58, 1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 4, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 21, 1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 45, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 57, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -3 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 25, -2 },
+    { 27, -2 },
+    { 29, -2 },
+    { 32, -1 },
+    { 34, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -3 },
+    { 46, -1 },
+    { 48, -2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 52, 1 },
+    { 53, 2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 57, 1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 57, 1 },
+    { 15, 1 },
+    { 31, 1 },
+    { 39, 1 },
+    { 57, 1 },
+    { 66, 1 },
+    { 87, 1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 14, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 46, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 68, -1 },
+    { 75, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -2 },
+    { 4, -1 },
+    { 11, -1 },
+    { 23, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 8, -1 },
+    { 23, -2 },
+    { 58, 1 },
+    { 103, -1 },
+    { 23, -2 },
+    { 11, -1 },
+    { 23, -1 },
+    { 58, 1 },
+    { 1, 2 },
+    { 2, 3 },
+    { 3, 2 },
+    { 4, 2 },
+    { 8, -1 },
+    { 11, 1 },
+    { 23, 2 },
+    { 24, 2 },
+    { 31, 1 },
+    { 41, 2 },
+    { 49, 1 },
+    { 50, 1 },
+    { 51, 2 },
+    { 52, 2 },
+    { 53, 3 },
+    { 54, 1 },
+    { 56, 2 },
+    { 57, 2 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 103, 2 },
+    { 104, 2 },
+    { 2, 1 },
+    { 23, -1 },
+    { 31, 1 },
+    { 35, 1 },
+    { 57, 1 },
+    { 104, 1 },
+    { 23, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 103, -1 },
+    { 103, -1 },
+    { 23, -1 },
+    { 31, 2 },
+    { 39, 1 },
+    { 57, 2 },
+    { 103, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 25, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 60, -1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 23, -1 },
+    { 23, -1 },
+    { 11, -1 },
+    { 23, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 26, -1 },
+    { 28, 1 },
+    { 29, -1 },
+    { 31, 1 },
+    { 34, -1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 56, -1 },
+    { 57, 1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 33, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 15, 2 },
+    { 31, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 57, 1 },
+    { 66, 2 },
+    { 87, 1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 15, 1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 31, 1 },
+    { 66, 1 },
+    { 94, 1 },
+    { 96, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 12, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 45, -1 },
+    { 63, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 75, -1 },
+    { 82, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 100, -1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 34, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 66, 1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 23, -1 },
+    { 35, 1 },
+    { 45, -2 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -2 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -1 },
+    { 45, -3 },
+    { 11, -1 },
+    { 23, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 26, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 56, 1 },
+    { 58, 1 },
+    { 8, -2 },
+    { 23, -1 },
+    { 58, 1 },
+    { 103, -1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -1 },
+    { 11, -1 },
+    { 12, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 22, -3 },
+    { 23, -2 },
+    { 31, 1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 42, -1 },
+    { 45, 1 },
+    { 57, 1 },
+    { 103, -2 },
+    { 104, -2 },
+    { 4, -1 },
+    { 11, -1 },
+    { 23, -2 },
+    { 31, 2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 57, 2 },
+    { 103, -1 },
+    { 104, -1 },
+    { 1, 1 },
+    { 3, 2 },
+    { 4, 2 },
+    { 11, 1 },
+    { 23, 2 },
+    { 24, 2 },
+    { 26, 3 },
+    { 28, 1 },
+    { 30, 1 },
+    { 31, 2 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 2 },
+    { 49, 1 },
+    { 51, 1 },
+    { 56, 3 },
+    { 57, 2 },
+    { 58, 3 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 103, 2 },
+    { 104, 2 },
+    { 31, 1 },
+    { 11, -1 },
+    { 23, -1 },
+    { 31, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 31, 1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 31, 2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 57, 2 },
+    { 103, -1 },
+    { 26, 1 },
+    { 56, 1 },
+    { 58, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 28, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 51, 1 },
+    { 59, 1 },
+    { 103, -1 },
+    { 11, -1 },
+    { 23, -2 },
+    { 31, 2 },
+    { 57, 2 },
+    { 98, -1 },
+    { 4, -1 },
+    { 23, -2 },
+    { 63, -1 },
+    { 68, -1 },
+    { 75, -2 },
+    { 87, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -1 },
+    { 103, -1 },
+    { 73, -1 },
+    { 98, -1 },
+    { 80, -1 },
+    { 82, -1 },
+    { 100, -1 },
+    { 73, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 98, -1 },
+    { 99, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 90, -1 },
+    { 92, -1 },
+    { 93, 1 },
+    { 98, -1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 4, -1 },
+    { 23, -2 },
+    { 63, -2 },
+    { 66, -1 },
+    { 68, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 75, -2 },
+    { 82, -1 },
+    { 87, -1 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 103, -1 },
+    { 4, -2 },
+    { 23, -3 },
+    { 63, -2 },
+    { 68, -2 },
+    { 75, -3 },
+    { 86, -1 },
+    { 87, -2 },
+    { 89, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -2 },
+    { 99, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 42, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 68, -1 },
+    { 73, -2 },
+    { 75, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 89, -2 },
+    { 95, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 98, -2 },
+    { 99, -2 },
+    { 103, -1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -3 },
+    { 42, -2 },
+    { 43, -1 },
+    { 64, -2 },
+    { 65, -1 },
+    { 67, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 72, -1 },
+    { 73, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 79, -2 },
+    { 80, -3 },
+    { 81, -3 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -4 },
+    { 92, -2 },
+    { 93, 2 },
+    { 95, -1 },
+    { 96, 1 },
+    { 97, 1 },
+    { 98, -1 },
+    { 99, -3 },
+    { 100, -4 },
+    { 101, -2 },
+    { 102, -1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -1 },
+    { 11, -1 },
+    { 23, -2 },
+    { 42, -1 },
+    { 63, -2 },
+    { 68, -2 },
+    { 69, 1 },
+    { 73, -1 },
+    { 75, -3 },
+    { 84, 1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 89, -2 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -2 },
+    { 98, -2 },
+    { 99, -1 },
+    { 100, 1 },
+    { 103, -2 },
+    { 104, -2 },
+    { 63, -1 },
+    { 71, -1 },
+    { 98, -1 },
+    { 23, -1 },
+    { 68, -1 },
+    { 75, -1 },
+    { 81, 1 },
+    { 96, -1 },
+    { 100, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -3 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 64, -1 },
+    { 67, -2 },
+    { 69, -3 },
+    { 70, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 76, -2 },
+    { 77, -1 },
+    { 80, -2 },
+    { 81, -2 },
+    { 84, -2 },
+    { 90, -3 },
+    { 92, -2 },
+    { 93, 1 },
+    { 99, -2 },
+    { 100, -2 },
+    { 66, 1 },
+    { 73, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 94, 1 },
+    { 98, -1 },
+    { 99, -2 },
+    { 63, -1 },
+    { 73, -1 },
+    { 74, 1 },
+    { 89, -1 },
+    { 93, 1 },
+    { 99, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 23, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 80, -1 },
+    { 84, -1 },
+    { 90, -1 },
+    { 97, -1 },
+    { 100, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 63, 1 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 76, -1 },
+    { 80, -1 },
+    { 84, -1 },
+    { 87, 1 },
+    { 90, -1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 100, -3 },
+    { 104, 1 },
+    { 64, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 62, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 80, -1 },
+    { 84, -1 },
+    { 90, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 100, -2 },
+    { 4, 1 },
+    { 64, -1 },
+    { 72, 1 },
+    { 73, -1 },
+    { 74, 1 },
+    { 80, 1 },
+    { 84, 1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 89, -2 },
+    { 93, 1 },
+    { 95, -1 },
+    { 98, -2 },
+    { 99, -2 },
+    { 100, 1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 23, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 8, -1 },
+    { 23, -2 },
+    { 90, -1 },
+    { 103, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 80, -1 },
+    { 84, -1 },
+    { 90, -1 },
+    { 23, -1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 99, -1 },
+    { 11, -1 },
+    { 23, -1 },
+    { 23, -1 },
+    { 42, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 99, -2 },
+    { 99, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 80, -1 },
+    { 84, -2 },
+    { 85, 1 },
+    { 87, 1 },
+    { 89, 1 },
+    { 90, -1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 85, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 4, -2 },
+    { 23, -3 },
+    { 86, -1 },
+    { 87, -2 },
+    { 89, -1 },
+    { 95, -2 },
+    { 103, -1 },
+    { 104, -1 },
+    { 23, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 103, -1 },
+    { 91, 1 },
+    { 93, 1 },
+    { 23, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 23, -1 },
+    { 63, -1 },
+    { 68, -1 },
+    { 75, -1 },
+    { 96, -1 },
+    { 97, -2 },
+    { 98, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 42, -1 },
+    { 43, -1 },
+    { 67, -2 },
+    { 69, -3 },
+    { 70, -2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -2 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 86, -1 },
+    { 90, -3 },
+    { 92, -2 },
+    { 97, 1 },
+    { 98, -1 },
+    { 99, -2 },
+    { 100, -4 },
+    { 101, -1 },
+    { 102, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 80, -1 },
+    { 84, -1 },
+    { 85, 1 },
+    { 87, 1 },
+    { 89, 1 },
+    { 90, -1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -3 },
+    { 64, -1 },
+    { 65, -1 },
+    { 67, -2 },
+    { 69, -3 },
+    { 70, -2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 79, -2 },
+    { 80, -2 },
+    { 81, -2 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -2 },
+    { 95, -1 },
+    { 98, -2 },
+    { 99, -3 },
+    { 100, -3 },
+    { 101, -1 },
+    { 102, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 80, -1 },
+    { 84, -1 },
+    { 90, -1 },
+    { 104, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -2 },
+    { 84, -1 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 100, -3 },
+    { 42, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 66, 1 },
+    { 68, -1 },
+    { 73, -2 },
+    { 74, 1 },
+    { 75, -1 },
+    { 81, -1 },
+    { 86, -2 },
+    { 89, -2 },
+    { 94, 1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 98, -2 },
+    { 99, -2 },
+    { 100, 1 },
+    { 42, -1 },
+    { 87, 1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 99, -2 },
+    { 63, -1 },
+    { 68, -1 },
+    { 75, -1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -1 },
+    { 23, -2 },
+    { 87, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 103, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -3 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 67, -2 },
+    { 68, 1 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 76, -2 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, 2 },
+    { 95, -1 },
+    { 96, 1 },
+    { 97, 1 },
+    { 98, -1 },
+    { 99, -2 },
+    { 100, -2 },
+    { 101, -1 },
+    { 4, 1 },
+    { 64, -1 },
+    { 66, 2 },
+    { 72, 1 },
+    { 73, -1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 80, 1 },
+    { 82, 1 },
+    { 84, 1 },
+    { 86, -2 },
+    { 87, 1 },
+    { 89, -2 },
+    { 93, 1 },
+    { 94, 2 },
+    { 95, 1 },
+    { 98, -2 },
+    { 99, -2 },
+    { 100, 1 },
+    { 85, 1 },
+    { 94, 2 },
+    { 103, 1 },
+    { 104, 1 },
+    { 23, -3 },
+    { 63, -2 },
+    { 68, -2 },
+    { 73, -1 },
+    { 75, -3 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -1 },
+    { 99, -1 },
+    { 71, -1 },
+    { 76, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 77, -1 },
+    { 80, -1 },
+    { 84, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 99, -1 },
+    { 99, -1 },
+    { 103, -1 },
+    { 4, 1 },
+    { 64, -1 },
+    { 72, 1 },
+    { 73, -2 },
+    { 74, 1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 80, 1 },
+    { 84, 1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 89, -2 },
+    { 93, 1 },
+    { 95, -1 },
+    { 98, -2 },
+    { 99, -2 },
+    { 100, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 12, -2 },
+    { 18, 1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 44, -3 },
+    { 45, -3 },
+    { 50, -1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 57, 1 },
+    { 60, -1 },
+    { 63, 1 },
+    { 67, -1 },
+    { 69, -2 },
+    { 70, -2 },
+    { 76, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 84, -1 },
+    { 90, -1 },
+    { 92, -1 },
+    { 93, 1 },
+    { 100, -3 },
+    { 5, -2 },
+    { 7, -2 },
+    { 12, -2 },
+    { 14, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 29, -2 },
+    { 34, -2 },
+    { 45, -4 },
+    { 46, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 57, 1 },
+    { 60, -2 },
+    { 64, -1 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 84, -2 },
+    { 90, -2 },
+    { 92, -2 },
+    { 99, -1 },
+    { 100, -4 },
+};
+
 static const EpdFontData bookerly_12_regular = {
     bookerly_12_regularBitmaps,
     bookerly_12_regularGlyphs,
@@ -3755,4 +5204,8 @@ static const EpdFontData bookerly_12_regular = {
     27,
     -7,
     true,
+    bookerly_12_regularKernLeftClasses,
+    bookerly_12_regularKernRightClasses,
+    bookerly_12_regularKernPairOffsets,
+    bookerly_12_regularKernPairs,
 };
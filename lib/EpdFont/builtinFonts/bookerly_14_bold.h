@@ -4203,7 +4203,7 @@ static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 6, 23, 8, 2, 22, 35, 0 }, // !
@@ -4993,6 +4993,2123 @@ static const EpdUnicodeInterval bookerly_14_boldIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_14_boldKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3,
+    0, 4, 5, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 16,
+    17, 18, 19, 20, 11, 21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30,
+    31, 32, 0, 0, 0, 0, 33, 34, 35, 36, 37, 38, 39, 40, 36, 41,
+    42, 43, 40, 40, 34, 34, 44, 45, 46, 47, 48, 49, 49, 50, 49, 51,
+    52, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55,
+    0, 0, 0, 56, 8, 8, 8, 8, 8, 8, 12, 10, 12, 12, 12, 12,
+    15, 15, 15, 15, 11, 20, 11, 11, 11, 11, 11, 0, 57, 26, 26, 26,
+    26, 29, 58, 59, 33, 33, 33, 33, 33, 33, 37, 35, 37, 37, 37, 37,
+    36, 36, 60, 60, 34, 40, 34, 34, 34, 34, 34, 0, 34, 48, 48, 48,
+    48, 49, 34, 49, 8, 33, 8, 33, 61, 62, 10, 35, 10, 35, 10, 35,
+    10, 35, 11, 63, 11, 64, 12, 37, 12, 37, 12, 37, 65, 66, 12, 37,
+    14, 39, 14, 39, 14, 39, 14, 39, 15, 40, 15, 40, 15, 60, 15, 60,
+    15, 60, 15, 67, 15, 36, 16, 41, 16, 68, 17, 42, 42, 18, 43, 18,
+    43, 0, 63, 0, 0, 18, 69, 20, 40, 20, 40, 20, 40, 40, 20, 40,
+    11, 34, 11, 34, 11, 34, 12, 37, 23, 45, 23, 45, 23, 45, 24, 46,
+    24, 46, 24, 46, 24, 46, 25, 47, 25, 70, 25, 47, 26, 48, 26, 48,
+    26, 48, 26, 48, 26, 48, 26, 71, 27, 49, 29, 49, 29, 30, 51, 30,
+    51, 30, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 72, 72, 73, 0, 74, 75, 76, 76, 77, 78, 78,
+    79, 80, 76, 81, 76, 82, 83, 84, 85, 86, 72, 80, 84, 76, 76, 80,
+    76, 87, 76, 88, 76, 89, 90, 85, 81, 91, 92, 86, 76, 76, 86, 78,
+    76, 78, 88, 88, 76, 93, 94, 95, 96, 97, 98, 99, 100, 101, 101, 99,
+    101, 101, 101, 94, 101, 94, 102, 96, 103, 94, 104, 97, 101, 101, 97, 105,
+    101, 105, 94, 94, 101, 98, 98, 106, 96, 12, 107, 108, 109, 0, 105, 105,
+    110, 99, 101, 103, 101, 111, 112, 88, 94, 113, 114, 86, 97, 78, 105, 89,
+    94, 115, 116, 117, 96, 0, 0, 118, 119, 84, 100, 118, 119, 80, 99, 80,
+    99, 80, 99, 86, 97, 0, 0, 0, 0, 120, 121, 90, 102, 85, 96, 122,
+    103, 122, 103, 123, 124, 86, 97, 86, 97, 76, 101, 125, 110, 126, 98, 126,
+    98, 76, 80, 99, 127, 128, 86, 97, 77, 129, 86, 97, 76, 101, 86, 97,
+    130, 82, 93, 82, 93, 72, 98, 72, 98, 88, 94, 88, 94, 80, 99, 84,
+    100, 131, 101, 76, 101, 76, 101, 88, 94, 88, 94, 88, 94, 88, 94, 81,
+    103, 81, 103, 81, 103, 76, 101, 85, 96, 76, 101, 117, 96, 132, 124, 92,
+    104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 133, 134, 135, 133, 133, 134, 4,
+    133, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_14_boldKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 2, 3,
+    0, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    9, 0, 0, 0, 10, 0, 11, 12, 13, 12, 12, 12, 13, 12, 12, 14,
+    12, 12, 15, 12, 13, 12, 13, 12, 16, 17, 18, 19, 19, 20, 21, 22,
+    0, 23, 24, 0, 0, 0, 25, 26, 27, 27, 27, 28, 29, 30, 31, 32,
+    30, 30, 33, 33, 27, 34, 27, 33, 35, 36, 37, 38, 38, 39, 40, 41,
+    0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    0, 0, 0, 45, 11, 11, 11, 11, 11, 11, 46, 13, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 0, 47, 18, 18, 18,
+    18, 21, 12, 48, 25, 25, 25, 49, 50, 25, 25, 27, 27, 27, 27, 51,
+    52, 31, 53, 54, 27, 33, 27, 27, 27, 27, 27, 0, 55, 37, 37, 37,
+    37, 40, 56, 40, 11, 57, 11, 58, 11, 25, 13, 27, 13, 27, 13, 27,
+    13, 27, 12, 27, 12, 27, 12, 27, 12, 27, 12, 27, 12, 27, 12, 27,
+    13, 29, 13, 59, 13, 29, 13, 29, 12, 30, 12, 60, 12, 54, 12, 54,
+    12, 54, 12, 31, 12, 31, 12, 31, 14, 61, 12, 30, 33, 12, 30, 12,
+    30, 12, 30, 12, 30, 12, 62, 12, 33, 12, 33, 12, 33, 33, 12, 33,
+    13, 27, 13, 27, 13, 27, 13, 27, 12, 33, 12, 33, 12, 63, 16, 35,
+    16, 64, 16, 35, 16, 65, 17, 36, 17, 36, 17, 36, 18, 37, 18, 37,
+    18, 37, 18, 37, 18, 37, 18, 37, 19, 38, 21, 40, 21, 22, 41, 22,
+    41, 22, 66, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 67, 67, 68, 67, 69, 70, 67, 67, 71, 72, 67,
+    68, 67, 67, 73, 67, 74, 67, 67, 67, 75, 67, 76, 77, 67, 67, 67,
+    72, 78, 67, 69, 67, 67, 69, 68, 73, 79, 80, 67, 81, 67, 67, 68,
+    67, 67, 82, 67, 83, 84, 85, 86, 86, 87, 88, 89, 90, 86, 86, 86,
+    91, 86, 86, 88, 86, 92, 88, 93, 94, 88, 95, 86, 96, 86, 86, 93,
+    86, 86, 97, 86, 98, 88, 88, 99, 86, 88, 100, 101, 102, 103, 91, 86,
+    99, 86, 86, 104, 86, 68, 93, 69, 88, 105, 94, 67, 86, 106, 107, 67,
+    92, 67, 86, 67, 86, 67, 86, 76, 89, 77, 90, 67, 86, 67, 86, 0,
+    0, 68, 93, 67, 86, 67, 86, 67, 86, 69, 88, 69, 88, 68, 93, 108,
+    94, 108, 94, 80, 95, 0, 93, 81, 96, 81, 96, 67, 99, 109, 110, 109,
+    110, 67, 76, 89, 67, 86, 72, 91, 67, 86, 67, 86, 81, 96, 0, 86,
+    99, 74, 84, 74, 84, 111, 84, 67, 88, 112, 113, 0, 113, 76, 89, 77,
+    90, 0, 114, 67, 86, 67, 86, 69, 88, 69, 88, 69, 88, 0, 90, 73,
+    104, 73, 115, 73, 104, 0, 96, 67, 86, 67, 86, 67, 86, 80, 95, 80,
+    95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 116, 117, 6, 116, 116, 117, 6,
+    116, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 0, 0, 0, 0, 0,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_boldKernPairOffsets[136] = {
+    0, 5, 31, 48, 80, 98, 155, 157, 176, 183, 186, 199, 200, 227, 231, 234,
+    255, 270, 282, 290, 315, 337, 356, 376, 385, 417, 442, 491, 508, 555, 558, 570,
+    598, 605, 617, 619, 622, 628, 657, 673, 679, 683, 696, 701, 706, 732, 735, 738,
+    743, 771, 778, 779, 796, 804, 813, 831, 880, 892, 917, 929, 943, 965, 974, 1000,
+    1002, 1004, 1012, 1017, 1024, 1039, 1040, 1047, 1049, 1064, 1066, 1079, 1086, 1110, 1137, 1156,
+    1178, 1223, 1251, 1260, 1273, 1304, 1312, 1324, 1345, 1367, 1371, 1393, 1412, 1424, 1440, 1445,
+    1453, 1458, 1463, 1471, 1476, 1477, 1480, 1496, 1502, 1515, 1526, 1530, 1537, 1546, 1556, 1565,
+    1574, 1608, 1622, 1657, 1666, 1687, 1711, 1718, 1725, 1732, 1778, 1805, 1812, 1827, 1830, 1832,
+    1834, 1844, 1847, 1849, 1873, 1921, 1972, 2004,
+};
+
+static const EpdKernPair bookerly_14_boldKernPairs[] = {
+    { 11, -1 },
+    { 29, -1 },
+    { 36, 1 },
+    { 59, -1 },
+    { 74, -1 },
+    { 13, -1 },
+    { 14, 2 },
+    { 25, -1 },
+    { 27, -1 },
+    { 32, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 61, 1 },
+    { 69, -1 },
+    { 71, 2 },
+    { 84, -1 },
+    { 88, -1 },
+    { 94, 1 },
+    { 102, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 115, 1 },
+    { 11, -2 },
+    { 19, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 46, -4 },
+    { 51, -1 },
+    { 55, -1 },
+    { 59, -1 },
+    { 72, -2 },
+    { 74, -2 },
+    { 80, 1 },
+    { 88, -1 },
+    { 105, 1 },
+    { 108, 1 },
+    { 111, -4 },
+    { 11, 1 },
+    { 13, -1 },
+    { 14, 1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -4 },
+    { 21, -3 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -3 },
+    { 40, -3 },
+    { 47, -1 },
+    { 61, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 71, 1 },
+    { 73, -1 },
+    { 74, 1 },
+    { 79, -1 },
+    { 81, -3 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, 1 },
+    { 96, -2 },
+    { 104, -2 },
+    { 105, -4 },
+    { 108, -3 },
+    { 109, -2 },
+    { 110, -1 },
+    { 115, -2 },
+    { 116, -2 },
+    { 117, -1 },
+    { 11, -1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 46, -1 },
+    { 68, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 79, 1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 111, -1 },
+    { 11, -3 },
+    { 13, -1 },
+    { 16, -1 },
+    { 22, -1 },
+    { 25, -3 },
+    { 27, -3 },
+    { 28, -1 },
+    { 29, -3 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -3 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 46, -4 },
+    { 47, -1 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -3 },
+    { 63, -1 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 79, -1 },
+    { 84, -3 },
+    { 86, -1 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 98, -3 },
+    { 100, -3 },
+    { 102, 1 },
+    { 104, -1 },
+    { 110, -1 },
+    { 111, -4 },
+    { 114, -1 },
+    { 115, -1 },
+    { 21, -1 },
+    { 108, -1 },
+    { 1, -1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 7, 1 },
+    { 10, -2 },
+    { 11, 1 },
+    { 17, -3 },
+    { 18, -2 },
+    { 19, -3 },
+    { 21, -3 },
+    { 23, -3 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, 1 },
+    { 40, -2 },
+    { 43, -1 },
+    { 46, 1 },
+    { 116, -3 },
+    { 117, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 46, -1 },
+    { 5, -1 },
+    { 13, -1 },
+    { 47, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 11, -1 },
+    { 14, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 36, 1 },
+    { 46, -2 },
+    { 48, -1 },
+    { 117, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 11, -3 },
+    { 15, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 35, -1 },
+    { 41, -1 },
+    { 46, -3 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 46, -1 },
+    { 43, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 39, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 5, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 1 },
+    { 27, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 40, -2 },
+    { 47, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 61, 1 },
+    { 3, -1 },
+    { 11, 1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, 1 },
+    { 21, -2 },
+    { 23, -3 },
+    { 38, -1 },
+    { 40, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, 1 },
+    { 21, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 61, 1 },
+    { 116, -1 },
+    { 3, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 19, 1 },
+    { 25, -1 },
+    { 26, 1 },
+    { 29, -1 },
+    { 30, 1 },
+    { 35, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 53, 2 },
+    { 54, 2 },
+    { 56, 1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, 2 },
+    { 62, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 1, 1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -3 },
+    { 11, -3 },
+    { 29, -1 },
+    { 32, 1 },
+    { 35, -1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 46, -4 },
+    { 53, 1 },
+    { 54, 1 },
+    { 59, -1 },
+    { 61, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 9, 1 },
+    { 11, -1 },
+    { 14, 3 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 24, 1 },
+    { 32, 3 },
+    { 36, 1 },
+    { 40, 1 },
+    { 42, 2 },
+    { 46, -2 },
+    { 48, -1 },
+    { 61, 3 },
+    { 3, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, 1 },
+    { 21, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 46, 1 },
+    { 47, -1 },
+    { 116, -2 },
+    { 117, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 11, -1 },
+    { 29, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 46, -1 },
+    { 59, -1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -4 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -4 },
+    { 13, -1 },
+    { 15, -1 },
+    { 25, -2 },
+    { 27, -2 },
+    { 29, -2 },
+    { 35, -2 },
+    { 41, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -3 },
+    { 47, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -2 },
+    { 11, -2 },
+    { 25, -1 },
+    { 29, -1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 3, 1 },
+    { 4, -4 },
+    { 5, -1 },
+    { 6, -4 },
+    { 7, -4 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -4 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 21, 1 },
+    { 25, -2 },
+    { 26, 1 },
+    { 27, -2 },
+    { 28, -1 },
+    { 29, -2 },
+    { 30, 1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -2 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, 1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -4 },
+    { 47, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -2 },
+    { 53, 2 },
+    { 54, 2 },
+    { 55, -2 },
+    { 56, 1 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, 1 },
+    { 61, 2 },
+    { 62, 1 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 117, 1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 13, -1 },
+    { 26, 1 },
+    { 30, 1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 46, 1 },
+    { 47, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 56, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -3 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -3 },
+    { 13, -2 },
+    { 16, -1 },
+    { 21, 1 },
+    { 25, -2 },
+    { 26, 1 },
+    { 27, -2 },
+    { 29, -3 },
+    { 30, 1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -2 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, 1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -3 },
+    { 47, -2 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -2 },
+    { 53, 2 },
+    { 54, 2 },
+    { 55, -2 },
+    { 56, 1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -3 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 117, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 61, 1 },
+    { 14, 1 },
+    { 32, 1 },
+    { 40, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 61, 1 },
+    { 71, 1 },
+    { 94, 1 },
+    { 102, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 115, 1 },
+    { 13, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -3 },
+    { 21, -2 },
+    { 27, -1 },
+    { 29, 1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 59, 1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 73, -1 },
+    { 81, -3 },
+    { 88, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 96, -1 },
+    { 104, -1 },
+    { 105, -3 },
+    { 108, -2 },
+    { 109, -2 },
+    { 115, -1 },
+    { 3, -1 },
+    { 10, -1 },
+    { 23, -3 },
+    { 38, -1 },
+    { 40, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 2, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 23, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 62, 1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 23, -2 },
+    { 117, 1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 116, -1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 62, 1 },
+    { 116, -1 },
+    { 1, 3 },
+    { 2, 3 },
+    { 3, 3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 10, 2 },
+    { 23, 3 },
+    { 24, 2 },
+    { 29, -1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 42, 3 },
+    { 49, 1 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 3 },
+    { 53, 3 },
+    { 54, 4 },
+    { 57, 1 },
+    { 58, 1 },
+    { 60, 3 },
+    { 61, 3 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 116, 2 },
+    { 117, 3 },
+    { 1, 1 },
+    { 3, 1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 32, 1 },
+    { 36, 1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 61, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 3, -1 },
+    { 23, -3 },
+    { 38, -2 },
+    { 40, -2 },
+    { 116, -1 },
+    { 117, -1 },
+    { 29, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 59, -1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 10, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 23, -1 },
+    { 32, 2 },
+    { 40, 1 },
+    { 61, 2 },
+    { 116, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 7, -2 },
+    { 10, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 35, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 7, -1 },
+    { 23, -1 },
+    { 116, -1 },
+    { 23, -1 },
+    { 32, 1 },
+    { 117, 1 },
+    { 23, -1 },
+    { 38, -1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 116, -1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, -1 },
+    { 36, 1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 3, 1 },
+    { 27, -1 },
+    { 36, 1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 23, -1 },
+    { 14, 2 },
+    { 19, 1 },
+    { 21, 1 },
+    { 32, 2 },
+    { 38, 1 },
+    { 40, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 61, 2 },
+    { 71, 2 },
+    { 94, 1 },
+    { 102, 1 },
+    { 103, 2 },
+    { 104, 1 },
+    { 105, 1 },
+    { 108, 1 },
+    { 115, 1 },
+    { 14, 1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 32, 1 },
+    { 71, 1 },
+    { 103, 1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 56, -1 },
+    { 68, -1 },
+    { 81, -1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 46, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 81, -1 },
+    { 89, -1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 111, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 21, -2 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 32, 1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 71, 1 },
+    { 84, -1 },
+    { 88, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 103, 1 },
+    { 105, -2 },
+    { 108, -1 },
+    { 115, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 11, -1 },
+    { 14, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 36, 1 },
+    { 46, -2 },
+    { 48, -1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -3 },
+    { 10, -1 },
+    { 11, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, -2 },
+    { 23, -2 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 46, -3 },
+    { 56, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 3, -1 },
+    { 7, -1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 63, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 26, 2 },
+    { 30, 2 },
+    { 42, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 56, 2 },
+    { 60, 2 },
+    { 62, 2 },
+    { 116, 1 },
+    { 117, 1 },
+    { 1, -1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 7, 1 },
+    { 10, -2 },
+    { 11, 1 },
+    { 14, 1 },
+    { 17, -3 },
+    { 18, -2 },
+    { 19, -3 },
+    { 21, -3 },
+    { 23, -3 },
+    { 32, 1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, 1 },
+    { 40, -2 },
+    { 43, -1 },
+    { 46, 1 },
+    { 61, 1 },
+    { 116, -3 },
+    { 117, -2 },
+    { 3, -1 },
+    { 10, -1 },
+    { 23, -3 },
+    { 32, 3 },
+    { 38, -1 },
+    { 40, -1 },
+    { 61, 3 },
+    { 116, -1 },
+    { 117, -1 },
+    { 2, 3 },
+    { 3, 2 },
+    { 10, 1 },
+    { 23, 2 },
+    { 24, 2 },
+    { 26, 3 },
+    { 28, 1 },
+    { 30, 3 },
+    { 31, 1 },
+    { 32, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 42, 2 },
+    { 50, 1 },
+    { 52, 1 },
+    { 56, 3 },
+    { 60, 3 },
+    { 61, 3 },
+    { 62, 3 },
+    { 63, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 116, 2 },
+    { 117, 2 },
+    { 38, -1 },
+    { 40, -1 },
+    { 32, 1 },
+    { 117, 1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 32, 1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 116, -1 },
+    { 32, 3 },
+    { 38, -1 },
+    { 40, -1 },
+    { 61, 3 },
+    { 116, -1 },
+    { 26, 1 },
+    { 29, -1 },
+    { 30, 1 },
+    { 56, 1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 10, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 52, 1 },
+    { 63, 1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 116, 1 },
+    { 23, -1 },
+    { 32, 2 },
+    { 38, -1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 61, 2 },
+    { 116, -1 },
+    { 109, -1 },
+    { 117, 1 },
+    { 3, -1 },
+    { 23, -3 },
+    { 68, -1 },
+    { 73, -1 },
+    { 79, -1 },
+    { 81, -2 },
+    { 94, -1 },
+    { 96, -1 },
+    { 104, -1 },
+    { 105, -2 },
+    { 108, -2 },
+    { 109, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 79, -1 },
+    { 109, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 94, -1 },
+    { 98, -1 },
+    { 104, -1 },
+    { 111, -1 },
+    { 115, -1 },
+    { 43, -1 },
+    { 79, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 102, 1 },
+    { 109, -1 },
+    { 110, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 98, -1 },
+    { 102, 1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 111, -1 },
+    { 3, -1 },
+    { 5, 1 },
+    { 23, -2 },
+    { 68, -2 },
+    { 71, -1 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -1 },
+    { 81, -3 },
+    { 83, -1 },
+    { 84, 1 },
+    { 85, 1 },
+    { 87, -1 },
+    { 88, 1 },
+    { 89, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 98, -1 },
+    { 104, -1 },
+    { 105, -2 },
+    { 108, -3 },
+    { 109, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 3, -3 },
+    { 23, -4 },
+    { 68, -2 },
+    { 69, -1 },
+    { 73, -2 },
+    { 79, -1 },
+    { 81, -4 },
+    { 85, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 96, -2 },
+    { 104, -2 },
+    { 105, -3 },
+    { 108, -3 },
+    { 109, -2 },
+    { 110, -1 },
+    { 115, -2 },
+    { 116, -1 },
+    { 117, -1 },
+    { 5, -1 },
+    { 43, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 79, -2 },
+    { 81, -1 },
+    { 85, -1 },
+    { 88, -1 },
+    { 93, -2 },
+    { 94, -1 },
+    { 96, -2 },
+    { 104, -1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 109, -2 },
+    { 110, -3 },
+    { 112, -1 },
+    { 113, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 4, -4 },
+    { 5, -1 },
+    { 6, -4 },
+    { 7, -3 },
+    { 43, -2 },
+    { 44, -1 },
+    { 69, -2 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, 1 },
+    { 74, -5 },
+    { 75, -3 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -2 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -3 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -2 },
+    { 96, -1 },
+    { 97, -3 },
+    { 98, -4 },
+    { 99, 1 },
+    { 100, -2 },
+    { 102, 2 },
+    { 104, -1 },
+    { 107, 1 },
+    { 108, 1 },
+    { 109, -1 },
+    { 110, -3 },
+    { 111, -5 },
+    { 112, -1 },
+    { 113, -2 },
+    { 115, -1 },
+    { 117, 1 },
+    { 1, -1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 7, 1 },
+    { 10, -2 },
+    { 23, -3 },
+    { 43, -1 },
+    { 68, -3 },
+    { 73, -1 },
+    { 74, 1 },
+    { 75, 1 },
+    { 79, -1 },
+    { 81, -4 },
+    { 85, -1 },
+    { 91, 1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, 1 },
+    { 96, -2 },
+    { 104, -1 },
+    { 105, -3 },
+    { 108, -3 },
+    { 109, -3 },
+    { 110, -1 },
+    { 111, 1 },
+    { 115, -1 },
+    { 116, -3 },
+    { 117, -2 },
+    { 68, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 81, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 98, -1 },
+    { 109, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 85, 1 },
+    { 87, -1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 111, -1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -4 },
+    { 8, -1 },
+    { 9, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 69, -1 },
+    { 72, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 90, -1 },
+    { 91, -2 },
+    { 97, -1 },
+    { 98, -2 },
+    { 100, -2 },
+    { 102, 1 },
+    { 109, -1 },
+    { 110, -3 },
+    { 111, -3 },
+    { 113, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 43, -1 },
+    { 71, 1 },
+    { 79, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 103, 1 },
+    { 109, -1 },
+    { 110, -2 },
+    { 68, -1 },
+    { 72, 1 },
+    { 73, -1 },
+    { 79, -1 },
+    { 80, 1 },
+    { 81, -1 },
+    { 102, 1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 116, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 23, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 91, -1 },
+    { 98, -1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 111, -2 },
+    { 1, 1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -3 },
+    { 72, -2 },
+    { 74, -3 },
+    { 75, -2 },
+    { 76, -1 },
+    { 83, -1 },
+    { 87, -2 },
+    { 91, -1 },
+    { 94, 1 },
+    { 98, -1 },
+    { 100, -1 },
+    { 102, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 111, -4 },
+    { 115, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 5, -1 },
+    { 69, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 4, -1 },
+    { 5, 1 },
+    { 6, -1 },
+    { 7, -2 },
+    { 67, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -2 },
+    { 77, -1 },
+    { 78, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 87, -1 },
+    { 91, -1 },
+    { 98, -1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 111, -2 },
+    { 3, 1 },
+    { 5, -1 },
+    { 69, -1 },
+    { 75, 1 },
+    { 79, -2 },
+    { 80, 1 },
+    { 87, 1 },
+    { 91, 1 },
+    { 93, -2 },
+    { 94, -1 },
+    { 95, 1 },
+    { 96, -2 },
+    { 99, 1 },
+    { 102, 1 },
+    { 104, -1 },
+    { 109, -2 },
+    { 110, -2 },
+    { 111, 1 },
+    { 115, -1 },
+    { 3, -1 },
+    { 10, -1 },
+    { 23, -3 },
+    { 91, 1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 96, -1 },
+    { 104, -1 },
+    { 110, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 2, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 23, -2 },
+    { 87, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 98, -1 },
+    { 104, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 89, -1 },
+    { 94, -1 },
+    { 98, -1 },
+    { 104, -1 },
+    { 115, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 87, -1 },
+    { 91, -1 },
+    { 92, 1 },
+    { 98, -1 },
+    { 117, 1 },
+    { 23, -1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 110, -1 },
+    { 115, 1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 89, -1 },
+    { 98, -1 },
+    { 116, -1 },
+    { 23, -1 },
+    { 43, -1 },
+    { 84, -1 },
+    { 88, -1 },
+    { 94, -1 },
+    { 104, -1 },
+    { 110, -2 },
+    { 115, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, -1 },
+    { 87, -1 },
+    { 116, -1 },
+    { 110, -1 },
+    { 23, -2 },
+    { 98, -1 },
+    { 117, 1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 84, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 91, -2 },
+    { 93, 1 },
+    { 96, 1 },
+    { 98, -2 },
+    { 100, -1 },
+    { 101, 1 },
+    { 103, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 3, 1 },
+    { 88, -1 },
+    { 92, 1 },
+    { 110, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 3, -1 },
+    { 23, -4 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 96, -2 },
+    { 98, -1 },
+    { 104, -2 },
+    { 110, -1 },
+    { 115, -2 },
+    { 116, -1 },
+    { 117, -1 },
+    { 3, -1 },
+    { 23, -3 },
+    { 94, -1 },
+    { 96, -1 },
+    { 98, -1 },
+    { 104, -1 },
+    { 110, -1 },
+    { 114, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 7, -1 },
+    { 23, -1 },
+    { 98, -1 },
+    { 116, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 96, -1 },
+    { 104, -1 },
+    { 110, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 42, 1 },
+    { 99, 2 },
+    { 102, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 3, -1 },
+    { 23, -3 },
+    { 94, -1 },
+    { 96, -1 },
+    { 104, -1 },
+    { 110, -1 },
+    { 114, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 5, 1 },
+    { 23, -1 },
+    { 68, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 81, -1 },
+    { 105, -1 },
+    { 108, -2 },
+    { 109, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 96, -1 },
+    { 98, -1 },
+    { 104, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 43, -1 },
+    { 44, -1 },
+    { 69, -1 },
+    { 72, -2 },
+    { 73, 1 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 86, -1 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -1 },
+    { 90, -2 },
+    { 91, -2 },
+    { 93, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 97, -2 },
+    { 98, -3 },
+    { 100, -2 },
+    { 108, 1 },
+    { 109, -1 },
+    { 110, -3 },
+    { 111, -5 },
+    { 113, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 87, -1 },
+    { 91, -1 },
+    { 92, 1 },
+    { 94, 1 },
+    { 96, 1 },
+    { 98, -1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 115, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 3, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -2 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 74, -3 },
+    { 75, -3 },
+    { 76, -1 },
+    { 79, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -1 },
+    { 90, -2 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -3 },
+    { 100, -2 },
+    { 104, -1 },
+    { 109, -3 },
+    { 110, -3 },
+    { 111, -3 },
+    { 113, -1 },
+    { 114, -1 },
+    { 115, -1 },
+    { 116, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 87, -1 },
+    { 88, -1 },
+    { 91, -1 },
+    { 98, -1 },
+    { 100, -1 },
+    { 117, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 72, -2 },
+    { 74, -3 },
+    { 75, -3 },
+    { 78, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 91, -1 },
+    { 98, -2 },
+    { 100, -1 },
+    { 102, 1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 111, -3 },
+    { 116, 1 },
+    { 117, 1 },
+    { 43, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 71, 1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 79, -2 },
+    { 80, 1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 88, -1 },
+    { 93, -2 },
+    { 94, 1 },
+    { 96, -2 },
+    { 103, 1 },
+    { 104, 1 },
+    { 108, -1 },
+    { 109, -2 },
+    { 110, -3 },
+    { 111, 1 },
+    { 112, -1 },
+    { 113, -1 },
+    { 115, 1 },
+    { 116, -1 },
+    { 43, -1 },
+    { 88, -1 },
+    { 94, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 110, -2 },
+    { 115, 1 },
+    { 68, -1 },
+    { 73, -1 },
+    { 81, -1 },
+    { 105, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 116, -1 },
+    { 23, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 96, -1 },
+    { 104, -1 },
+    { 115, -1 },
+    { 116, -1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -3 },
+    { 8, -1 },
+    { 9, -1 },
+    { 42, 1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 73, 1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -1 },
+    { 79, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 86, -1 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 98, -3 },
+    { 99, 1 },
+    { 100, -1 },
+    { 102, 2 },
+    { 104, -1 },
+    { 105, 1 },
+    { 108, 1 },
+    { 109, -1 },
+    { 110, -2 },
+    { 111, -3 },
+    { 113, -1 },
+    { 114, -1 },
+    { 115, -1 },
+    { 117, 1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 69, -1 },
+    { 71, 2 },
+    { 75, 1 },
+    { 76, 1 },
+    { 79, -2 },
+    { 80, 1 },
+    { 83, 1 },
+    { 87, 1 },
+    { 89, 1 },
+    { 91, 1 },
+    { 93, -2 },
+    { 94, 1 },
+    { 95, 1 },
+    { 96, -2 },
+    { 98, 1 },
+    { 99, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 2 },
+    { 104, 1 },
+    { 107, 1 },
+    { 109, -2 },
+    { 110, -2 },
+    { 111, 1 },
+    { 115, 1 },
+    { 3, 1 },
+    { 88, -1 },
+    { 92, 1 },
+    { 103, 1 },
+    { 110, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 23, -4 },
+    { 68, -3 },
+    { 69, -1 },
+    { 73, -2 },
+    { 79, -1 },
+    { 81, -4 },
+    { 93, -1 },
+    { 94, -2 },
+    { 96, -2 },
+    { 104, -2 },
+    { 105, -3 },
+    { 108, -3 },
+    { 109, -1 },
+    { 110, -1 },
+    { 115, -2 },
+    { 75, -1 },
+    { 76, -1 },
+    { 83, -1 },
+    { 76, -1 },
+    { 109, -1 },
+    { 93, -1 },
+    { 110, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 84, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 91, -1 },
+    { 98, -1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 110, -1 },
+    { 10, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 76, -1 },
+    { 98, -1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 69, -1 },
+    { 75, 1 },
+    { 79, -2 },
+    { 80, 1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 87, 1 },
+    { 88, -1 },
+    { 91, 1 },
+    { 93, -2 },
+    { 94, -1 },
+    { 95, 1 },
+    { 96, -2 },
+    { 97, -1 },
+    { 99, 1 },
+    { 100, -1 },
+    { 102, 1 },
+    { 104, -1 },
+    { 109, -2 },
+    { 110, -3 },
+    { 113, -1 },
+    { 115, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 11, -2 },
+    { 17, 1 },
+    { 19, 1 },
+    { 21, 1 },
+    { 26, 1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, 1 },
+    { 35, -1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 45, -3 },
+    { 46, -4 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, 1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 68, 1 },
+    { 72, -2 },
+    { 73, 1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 83, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 91, -1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 98, -1 },
+    { 99, 1 },
+    { 100, -1 },
+    { 102, 1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 106, 1 },
+    { 108, 1 },
+    { 111, -4 },
+    { 115, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 11, -4 },
+    { 13, -1 },
+    { 16, -1 },
+    { 19, 1 },
+    { 21, 1 },
+    { 25, -1 },
+    { 26, 1 },
+    { 27, -2 },
+    { 29, -2 },
+    { 30, 1 },
+    { 35, -2 },
+    { 41, -1 },
+    { 46, -5 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -2 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -2 },
+    { 56, 1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -2 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 87, -2 },
+    { 88, -2 },
+    { 91, -2 },
+    { 98, -2 },
+    { 99, 1 },
+    { 100, -2 },
+    { 102, 1 },
+    { 105, 1 },
+    { 108, 1 },
+    { 110, -1 },
+    { 111, -5 },
+    { 11, 1 },
+    { 13, -1 },
+    { 14, 1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -4 },
+    { 21, -3 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -3 },
+    { 40, -1 },
+    { 47, -1 },
+    { 61, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 71, 1 },
+    { 73, -1 },
+    { 74, 1 },
+    { 79, -1 },
+    { 81, -3 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, 1 },
+    { 96, -2 },
+    { 104, -1 },
+    { 105, -4 },
+    { 108, -3 },
+    { 109, -2 },
+    { 110, -1 },
+    { 115, -1 },
+    { 116, -2 },
+    { 117, -1 },
+};
+
 static const EpdFontData bookerly_14_bold = {
     bookerly_14_boldBitmaps,
     bookerly_14_boldGlyphs,
@@ -5002,4 +7119,8 @@ static const EpdFontData bookerly_14_bold = {
     31,
     -8,
     true,
+    bookerly_14_boldKernLeftClasses,
+    bookerly_14_boldKernRightClasses,
+    bookerly_14_boldKernPairOffsets,
+    bookerly_14_boldKernPairs,
 };
@@ -4391,7 +4391,7 @@ static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 9, 23, 10, 1, 22, 52, 0 }, // !
@@ -5181,6 +5181,2280 @@ static const EpdUnicodeInterval bookerly_14_bolditalicIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_14_bolditalicKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 3, 4, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    6, 0, 0, 0, 0, 0, 7, 8, 9, 10, 11, 12, 13, 14, 14, 15,
+    16, 17, 18, 19, 10, 20, 21, 22, 23, 24, 25, 26, 26, 27, 28, 29,
+    30, 31, 0, 0, 0, 0, 32, 33, 34, 35, 36, 37, 38, 39, 35, 40,
+    41, 42, 39, 39, 33, 33, 43, 44, 45, 46, 32, 47, 47, 48, 47, 49,
+    50, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52,
+    0, 0, 0, 53, 7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11,
+    14, 14, 14, 14, 10, 19, 10, 10, 10, 10, 10, 0, 10, 25, 25, 25,
+    25, 28, 54, 55, 32, 32, 32, 32, 32, 32, 36, 56, 36, 36, 36, 36,
+    35, 57, 58, 58, 33, 39, 33, 33, 33, 33, 33, 0, 59, 32, 32, 32,
+    32, 47, 33, 47, 7, 32, 7, 32, 60, 61, 9, 34, 9, 34, 9, 34,
+    9, 34, 10, 62, 10, 35, 11, 36, 11, 36, 11, 36, 63, 64, 11, 36,
+    13, 38, 13, 38, 13, 38, 13, 38, 14, 39, 65, 39, 14, 58, 14, 58,
+    14, 58, 66, 67, 14, 32, 15, 40, 15, 68, 16, 41, 69, 17, 42, 17,
+    70, 0, 62, 0, 0, 17, 71, 19, 39, 19, 39, 19, 39, 39, 19, 40,
+    10, 33, 10, 33, 10, 33, 11, 36, 22, 44, 22, 44, 22, 44, 23, 45,
+    23, 45, 23, 72, 23, 45, 24, 73, 24, 0, 24, 46, 25, 32, 25, 32,
+    25, 32, 25, 32, 25, 32, 25, 61, 26, 47, 28, 47, 28, 29, 49, 29,
+    49, 29, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 74, 74, 75, 0, 76, 77, 78, 78, 79, 80, 80,
+    81, 82, 78, 83, 78, 84, 85, 86, 87, 88, 74, 82, 86, 78, 78, 82,
+    78, 89, 78, 90, 78, 91, 92, 93, 83, 94, 95, 88, 78, 78, 88, 80,
+    78, 80, 90, 90, 78, 96, 97, 98, 99, 100, 101, 101, 98, 96, 96, 102,
+    96, 96, 96, 103, 104, 103, 105, 104, 106, 100, 107, 108, 96, 96, 108, 109,
+    96, 110, 103, 103, 96, 101, 101, 111, 99, 105, 112, 113, 114, 115, 110, 110,
+    104, 102, 96, 106, 96, 116, 110, 90, 103, 117, 118, 88, 108, 80, 110, 91,
+    103, 119, 120, 121, 99, 0, 0, 122, 123, 86, 98, 124, 123, 82, 102, 82,
+    102, 82, 102, 88, 108, 0, 0, 0, 0, 125, 126, 92, 105, 87, 108, 127,
+    128, 127, 128, 129, 130, 88, 108, 88, 108, 78, 96, 131, 104, 132, 101, 132,
+    101, 78, 82, 101, 133, 134, 88, 108, 79, 115, 88, 108, 78, 0, 88, 108,
+    135, 84, 96, 84, 96, 74, 101, 74, 101, 90, 103, 90, 103, 82, 101, 86,
+    98, 136, 137, 78, 96, 78, 96, 90, 103, 90, 103, 90, 103, 90, 103, 83,
+    106, 83, 106, 83, 106, 78, 96, 87, 99, 78, 96, 121, 99, 138, 139, 95,
+    107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 4, 4, 4, 0, 0, 140, 141, 142, 140, 140, 141, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_14_bolditalicKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4,
+    0, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    10, 0, 0, 0, 11, 0, 12, 13, 14, 13, 15, 15, 14, 15, 15, 16,
+    15, 15, 17, 15, 14, 13, 14, 13, 1, 18, 19, 20, 20, 21, 22, 23,
+    0, 24, 25, 0, 0, 0, 26, 27, 26, 26, 26, 28, 29, 27, 30, 31,
+    27, 27, 32, 32, 26, 32, 26, 32, 33, 34, 35, 36, 36, 37, 38, 39,
+    0, 0, 40, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 0, 0, 44, 12, 12, 12, 12, 12, 12, 45, 14, 15, 15, 15, 15,
+    15, 15, 15, 15, 13, 15, 14, 14, 14, 14, 14, 0, 14, 19, 19, 19,
+    19, 22, 15, 46, 26, 26, 26, 26, 47, 26, 26, 26, 26, 26, 26, 26,
+    48, 30, 49, 49, 26, 32, 26, 26, 26, 26, 26, 0, 50, 35, 35, 35,
+    35, 36, 51, 36, 12, 26, 12, 26, 12, 26, 14, 26, 14, 26, 14, 26,
+    14, 47, 13, 26, 13, 26, 15, 26, 15, 26, 15, 26, 15, 26, 15, 26,
+    14, 29, 14, 29, 14, 29, 14, 29, 15, 27, 15, 27, 15, 49, 15, 49,
+    15, 49, 15, 30, 15, 32, 15, 30, 16, 52, 15, 27, 32, 15, 27, 15,
+    27, 15, 27, 15, 27, 15, 53, 15, 32, 15, 32, 15, 32, 32, 15, 32,
+    14, 26, 14, 26, 14, 26, 14, 26, 13, 32, 13, 32, 13, 32, 1, 33,
+    1, 33, 1, 33, 1, 54, 18, 34, 18, 34, 18, 34, 19, 35, 19, 35,
+    19, 35, 19, 35, 19, 35, 19, 35, 20, 36, 22, 36, 22, 23, 39, 23,
+    39, 23, 39, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 55, 55, 56, 55, 57, 58, 55, 55, 59, 60, 55,
+    56, 55, 55, 61, 55, 62, 55, 63, 55, 64, 55, 65, 66, 55, 55, 55,
+    60, 67, 55, 57, 55, 63, 57, 56, 61, 68, 69, 55, 70, 55, 55, 56,
+    55, 55, 71, 55, 72, 73, 74, 73, 75, 76, 73, 77, 78, 79, 79, 80,
+    81, 82, 80, 73, 80, 83, 73, 80, 84, 73, 85, 79, 86, 79, 79, 87,
+    79, 79, 78, 80, 88, 73, 73, 89, 75, 73, 90, 91, 92, 93, 81, 80,
+    89, 80, 79, 84, 79, 56, 80, 57, 73, 94, 95, 55, 80, 96, 97, 63,
+    80, 55, 98, 55, 75, 55, 80, 65, 77, 66, 78, 55, 80, 55, 80, 0,
+    0, 56, 0, 55, 80, 55, 80, 55, 80, 57, 73, 57, 73, 56, 80, 99,
+    84, 99, 84, 69, 85, 0, 0, 70, 86, 70, 86, 55, 89, 100, 101, 100,
+    101, 55, 65, 77, 55, 80, 60, 81, 55, 80, 55, 80, 70, 86, 0, 82,
+    102, 62, 73, 62, 73, 103, 73, 55, 73, 104, 105, 0, 105, 65, 77, 66,
+    78, 106, 107, 55, 79, 55, 79, 57, 73, 57, 73, 57, 73, 0, 78, 61,
+    84, 61, 84, 61, 84, 0, 86, 55, 75, 55, 79, 55, 75, 69, 85, 69,
+    85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 0, 6, 6, 6, 0, 0, 108, 109, 7, 108, 108, 109, 7,
+    0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 1, 0, 0, 0,
+    11, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_bolditalicKernPairOffsets[143] = {
+    0, 21, 25, 75, 77, 124, 128, 153, 165, 167, 181, 184, 203, 212, 225, 241,
+    262, 273, 282, 301, 322, 341, 362, 368, 393, 413, 441, 464, 496, 502, 512, 559,
+    563, 571, 575, 579, 581, 604, 625, 631, 635, 639, 642, 650, 662, 668, 673, 680,
+    687, 693, 713, 727, 738, 759, 775, 776, 782, 789, 799, 812, 840, 847, 872, 878,
+    882, 898, 914, 921, 926, 931, 936, 944, 952, 959, 963, 981, 982, 991, 1011, 1034,
+    1050, 1075, 1106, 1146, 1180, 1185, 1201, 1233, 1240, 1260, 1281, 1307, 1313, 1345, 1371, 1400,
+    1408, 1419, 1422, 1424, 1435, 1437, 1442, 1453, 1461, 1465, 1476, 1486, 1498, 1510, 1522, 1531,
+    1540, 1543, 1551, 1556, 1564, 1595, 1609, 1643, 1662, 1684, 1699, 1709, 1725, 1740, 1744, 1790,
+    1802, 1837, 1852, 1874, 1878, 1918, 1922, 1931, 1938, 1944, 1985, 2000, 2043, 2113, 2161,
+};
+
+static const EpdKernPair bookerly_14_bolditalicKernPairs[] = {
+    { 14, -1 },
+    { 16, 3 },
+    { 26, -1 },
+    { 27, 2 },
+    { 28, 4 },
+    { 31, 4 },
+    { 38, 3 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 2 },
+    { 53, 2 },
+    { 57, -1 },
+    { 59, 3 },
+    { 64, 1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 81, -1 },
+    { 84, 2 },
+    { 89, 2 },
+    { 93, 4 },
+    { 95, 2 },
+    { 12, -1 },
+    { 45, -3 },
+    { 62, -1 },
+    { 103, -3 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 3 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 31, 3 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 48, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, 3 },
+    { 60, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -2 },
+    { 72, 1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 84, -1 },
+    { 86, -2 },
+    { 87, -2 },
+    { 91, -1 },
+    { 93, 3 },
+    { 94, -3 },
+    { 95, -1 },
+    { 97, -1 },
+    { 99, -2 },
+    { 100, -4 },
+    { 101, -1 },
+    { 103, 1 },
+    { 108, -3 },
+    { 109, -3 },
+    { 22, -1 },
+    { 99, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 26, -3 },
+    { 27, 1 },
+    { 28, -1 },
+    { 29, -3 },
+    { 32, -1 },
+    { 33, -3 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -2 },
+    { 45, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -3 },
+    { 57, -1 },
+    { 60, -1 },
+    { 62, -3 },
+    { 64, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 72, -1 },
+    { 73, -3 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -2 },
+    { 83, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 88, -3 },
+    { 89, 1 },
+    { 90, -3 },
+    { 98, -2 },
+    { 101, -1 },
+    { 103, -4 },
+    { 105, -2 },
+    { 107, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 84, 1 },
+    { 95, 1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 17, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -2 },
+    { 24, -5 },
+    { 29, 1 },
+    { 30, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -1 },
+    { 45, 1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 108, -3 },
+    { 109, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 45, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -3 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 42, -1 },
+    { 45, -3 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 109, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 12, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 108, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 34, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 27, 1 },
+    { 45, -1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 21, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 4, -2 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -2 },
+    { 24, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 108, -2 },
+    { 109, -1 },
+    { 12, 1 },
+    { 17, 1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, 1 },
+    { 24, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 108, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 12, -1 },
+    { 21, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -3 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 45, -4 },
+    { 47, -1 },
+    { 50, -1 },
+    { 54, -1 },
+    { 3, 6 },
+    { 5, 5 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, 5 },
+    { 12, -1 },
+    { 16, 3 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 25, 6 },
+    { 29, 1 },
+    { 31, 2 },
+    { 40, 6 },
+    { 45, -1 },
+    { 46, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 17, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, 2 },
+    { 22, -2 },
+    { 24, -3 },
+    { 28, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -1 },
+    { 45, 2 },
+    { 108, -2 },
+    { 109, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 18, -1 },
+    { 24, -1 },
+    { 4, 3 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -2 },
+    { 13, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 45, -3 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 4, 1 },
+    { 5, -4 },
+    { 6, -1 },
+    { 7, -4 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, 1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 29, -2 },
+    { 33, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -4 },
+    { 47, -2 },
+    { 49, 1 },
+    { 50, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 35, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 2, 1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, 1 },
+    { 14, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -3 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 16, 2 },
+    { 27, 2 },
+    { 28, 2 },
+    { 31, 3 },
+    { 38, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 59, 2 },
+    { 89, 2 },
+    { 93, 3 },
+    { 12, 2 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 4 },
+    { 17, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, 2 },
+    { 22, -3 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 2 },
+    { 31, 1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 39, 1 },
+    { 45, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 59, 4 },
+    { 60, 2 },
+    { 62, 2 },
+    { 63, 1 },
+    { 64, 2 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 2 },
+    { 70, -2 },
+    { 72, 2 },
+    { 84, -1 },
+    { 85, 1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 89, 1 },
+    { 93, 1 },
+    { 94, -3 },
+    { 95, -1 },
+    { 99, -3 },
+    { 100, -2 },
+    { 103, 1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 108, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 53, 1 },
+    { 108, -1 },
+    { 24, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 109, 1 },
+    { 8, 1 },
+    { 24, 1 },
+    { 33, 1 },
+    { 54, 1 },
+    { 24, -2 },
+    { 29, -1 },
+    { 3, 1 },
+    { 4, 3 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 11, 1 },
+    { 24, 3 },
+    { 25, 1 },
+    { 26, -1 },
+    { 27, 2 },
+    { 29, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 47, -1 },
+    { 48, 2 },
+    { 49, 2 },
+    { 50, -1 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 2 },
+    { 108, 1 },
+    { 109, 2 },
+    { 2, 1 },
+    { 4, 1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 3 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 108, 1 },
+    { 109, 2 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -3 },
+    { 33, 1 },
+    { 54, 1 },
+    { 108, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 31, 1 },
+    { 8, 1 },
+    { 24, -1 },
+    { 29, 1 },
+    { 50, 1 },
+    { 8, 1 },
+    { 33, 1 },
+    { 54, 1 },
+    { 3, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, 4 },
+    { 38, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 32, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 109, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 109, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 24, -2 },
+    { 32, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 50, 1 },
+    { 109, 1 },
+    { 3, -1 },
+    { 24, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 50, 1 },
+    { 109, 1 },
+    { 16, 2 },
+    { 26, -1 },
+    { 27, 2 },
+    { 28, 2 },
+    { 31, 3 },
+    { 33, -1 },
+    { 38, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 2 },
+    { 53, 2 },
+    { 54, -1 },
+    { 59, 2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 84, 1 },
+    { 89, 2 },
+    { 90, -1 },
+    { 93, 3 },
+    { 95, 1 },
+    { 16, 3 },
+    { 20, -1 },
+    { 22, -1 },
+    { 27, -1 },
+    { 28, 1 },
+    { 31, 2 },
+    { 46, 1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 59, 3 },
+    { 89, -1 },
+    { 93, 2 },
+    { 94, -1 },
+    { 99, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 56, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 94, -1 },
+    { 99, -1 },
+    { 104, 1 },
+    { 16, 4 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 4 },
+    { 46, 4 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 59, 4 },
+    { 73, -1 },
+    { 76, -1 },
+    { 89, -1 },
+    { 93, 4 },
+    { 94, -1 },
+    { 99, -1 },
+    { 3, -2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 24, -3 },
+    { 45, -2 },
+    { 108, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 109, 1 },
+    { 8, 1 },
+    { 24, 1 },
+    { 27, 1 },
+    { 33, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 3, 1 },
+    { 4, 2 },
+    { 11, 1 },
+    { 24, 3 },
+    { 27, 2 },
+    { 40, 1 },
+    { 49, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 109, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 53, 1 },
+    { 108, -1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 4 },
+    { 17, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -2 },
+    { 24, -5 },
+    { 28, 4 },
+    { 29, 2 },
+    { 30, -1 },
+    { 31, 4 },
+    { 32, -1 },
+    { 34, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -1 },
+    { 45, 1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 108, -3 },
+    { 109, -2 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 5 },
+    { 108, -1 },
+    { 3, 3 },
+    { 4, 4 },
+    { 11, 3 },
+    { 24, 4 },
+    { 25, 2 },
+    { 27, 4 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 2 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 51, 4 },
+    { 53, 4 },
+    { 54, 1 },
+    { 108, 2 },
+    { 109, 3 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 16, 3 },
+    { 28, 3 },
+    { 31, 4 },
+    { 24, -2 },
+    { 28, 3 },
+    { 29, -1 },
+    { 31, 3 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 32, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 16, 3 },
+    { 26, -1 },
+    { 27, 1 },
+    { 28, 3 },
+    { 31, 4 },
+    { 34, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 8, 1 },
+    { 24, 1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 31, 4 },
+    { 33, 1 },
+    { 54, 1 },
+    { 11, 1 },
+    { 27, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 109, 1 },
+    { 5, 1 },
+    { 7, 1 },
+    { 24, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 8, 1 },
+    { 28, 1 },
+    { 31, 2 },
+    { 33, 1 },
+    { 54, 1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 109, 1 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 101, -1 },
+    { 24, -2 },
+    { 56, -1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 69, 1 },
+    { 70, -2 },
+    { 72, 1 },
+    { 84, -1 },
+    { 93, 2 },
+    { 94, -2 },
+    { 95, -1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 108, -1 },
+    { 68, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 56, -1 },
+    { 77, -1 },
+    { 99, -1 },
+    { 107, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 68, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 89, 1 },
+    { 98, -1 },
+    { 100, -1 },
+    { 101, -1 },
+    { 105, -1 },
+    { 107, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, 1 },
+    { 64, -1 },
+    { 69, 1 },
+    { 72, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 89, 1 },
+    { 92, 1 },
+    { 98, -1 },
+    { 101, -1 },
+    { 103, -1 },
+    { 107, -1 },
+    { 3, -1 },
+    { 4, -2 },
+    { 24, -3 },
+    { 56, -2 },
+    { 61, -1 },
+    { 70, -3 },
+    { 72, 1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 94, -3 },
+    { 95, -1 },
+    { 99, -2 },
+    { 100, -2 },
+    { 107, -1 },
+    { 108, -2 },
+    { 109, -2 },
+    { 4, -1 },
+    { 24, -2 },
+    { 56, -3 },
+    { 57, -1 },
+    { 61, -1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -3 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -3 },
+    { 87, -1 },
+    { 94, -4 },
+    { 95, -1 },
+    { 99, -3 },
+    { 100, -3 },
+    { 101, -1 },
+    { 107, -1 },
+    { 108, -2 },
+    { 109, -2 },
+    { 4, 1 },
+    { 6, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 57, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 71, -1 },
+    { 72, 1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, 1 },
+    { 90, -1 },
+    { 95, -1 },
+    { 101, -2 },
+    { 103, 1 },
+    { 105, -1 },
+    { 107, -1 },
+    { 4, 2 },
+    { 5, -4 },
+    { 7, -4 },
+    { 8, -3 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 2 },
+    { 43, -1 },
+    { 56, 1 },
+    { 60, -2 },
+    { 62, -4 },
+    { 63, 1 },
+    { 64, -2 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -4 },
+    { 82, -1 },
+    { 83, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -3 },
+    { 89, 2 },
+    { 90, -2 },
+    { 92, 1 },
+    { 94, 1 },
+    { 98, -1 },
+    { 99, 1 },
+    { 101, -2 },
+    { 103, -5 },
+    { 105, -1 },
+    { 107, -1 },
+    { 109, 1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -5 },
+    { 42, -1 },
+    { 55, 1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 2 },
+    { 70, -4 },
+    { 72, 1 },
+    { 74, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 86, -2 },
+    { 87, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -4 },
+    { 95, -2 },
+    { 99, -2 },
+    { 100, -3 },
+    { 101, -2 },
+    { 103, 1 },
+    { 107, -1 },
+    { 108, -3 },
+    { 109, -2 },
+    { 56, -1 },
+    { 61, -1 },
+    { 70, -1 },
+    { 94, -1 },
+    { 107, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 56, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 70, -1 },
+    { 77, -1 },
+    { 94, -1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 103, -1 },
+    { 107, -1 },
+    { 4, 3 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 62, -3 },
+    { 63, 1 },
+    { 64, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -4 },
+    { 82, -1 },
+    { 84, 1 },
+    { 88, -2 },
+    { 89, 1 },
+    { 90, -1 },
+    { 92, 1 },
+    { 95, 1 },
+    { 99, 1 },
+    { 101, -3 },
+    { 103, -3 },
+    { 105, -1 },
+    { 107, -1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 59, 2 },
+    { 65, 1 },
+    { 67, 1 },
+    { 69, 1 },
+    { 84, 1 },
+    { 93, 3 },
+    { 95, 1 },
+    { 24, -1 },
+    { 42, -1 },
+    { 56, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -1 },
+    { 72, 1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 94, -1 },
+    { 100, -1 },
+    { 101, -1 },
+    { 103, 1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 88, -1 },
+    { 94, -1 },
+    { 99, -1 },
+    { 103, -1 },
+    { 107, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 55, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -3 },
+    { 64, -2 },
+    { 65, -1 },
+    { 67, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 84, 1 },
+    { 88, -2 },
+    { 90, -1 },
+    { 94, -1 },
+    { 95, 1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 103, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 68, -1 },
+    { 94, -1 },
+    { 101, -1 },
+    { 107, -1 },
+    { 4, 3 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 62, -2 },
+    { 63, 1 },
+    { 64, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -4 },
+    { 82, -1 },
+    { 84, 1 },
+    { 88, -2 },
+    { 89, 1 },
+    { 90, -1 },
+    { 92, 1 },
+    { 95, 1 },
+    { 99, 1 },
+    { 101, -3 },
+    { 103, -3 },
+    { 105, -1 },
+    { 107, -1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 88, -1 },
+    { 94, -1 },
+    { 99, -1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 57, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 86, -1 },
+    { 89, 1 },
+    { 92, 1 },
+    { 99, 1 },
+    { 100, -1 },
+    { 101, -2 },
+    { 103, 1 },
+    { 107, -1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 101, -1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 95, 1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 24, -3 },
+    { 107, -1 },
+    { 108, -1 },
+    { 24, -1 },
+    { 95, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 95, 1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 24, -2 },
+    { 95, 1 },
+    { 5, 1 },
+    { 7, 1 },
+    { 24, -2 },
+    { 84, 1 },
+    { 95, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 95, 1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -3 },
+    { 78, 1 },
+    { 86, -1 },
+    { 90, 1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 24, -1 },
+    { 84, 1 },
+    { 95, 1 },
+    { 109, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 88, -1 },
+    { 95, 1 },
+    { 98, -1 },
+    { 24, -2 },
+    { 79, 1 },
+    { 80, 1 },
+    { 83, 1 },
+    { 84, 1 },
+    { 86, 1 },
+    { 95, 2 },
+    { 102, 1 },
+    { 107, -1 },
+    { 109, 1 },
+    { 3, 2 },
+    { 8, 1 },
+    { 24, -2 },
+    { 25, 1 },
+    { 40, 1 },
+    { 83, 1 },
+    { 84, 3 },
+    { 86, -1 },
+    { 93, 5 },
+    { 95, 3 },
+    { 101, -1 },
+    { 107, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -4 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -3 },
+    { 78, 1 },
+    { 86, -1 },
+    { 90, 1 },
+    { 93, 1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 95, 1 },
+    { 101, -1 },
+    { 107, -1 },
+    { 8, 1 },
+    { 24, 1 },
+    { 90, 1 },
+    { 3, 1 },
+    { 4, 2 },
+    { 11, 1 },
+    { 24, 3 },
+    { 40, 1 },
+    { 89, 2 },
+    { 92, 2 },
+    { 109, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 81, -1 },
+    { 93, 1 },
+    { 24, -1 },
+    { 56, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 70, -1 },
+    { 94, -2 },
+    { 99, -1 },
+    { 100, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 42, -1 },
+    { 57, -1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, -3 },
+    { 64, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -4 },
+    { 82, -1 },
+    { 85, -1 },
+    { 88, -3 },
+    { 90, -1 },
+    { 98, -1 },
+    { 101, -3 },
+    { 103, -4 },
+    { 105, -1 },
+    { 107, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, 1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 83, 1 },
+    { 84, 1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 95, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, -2 },
+    { 64, -2 },
+    { 68, -1 },
+    { 70, 1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -4 },
+    { 82, -2 },
+    { 83, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 90, -1 },
+    { 98, -2 },
+    { 101, -3 },
+    { 103, -4 },
+    { 105, -1 },
+    { 107, -1 },
+    { 109, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 42, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 84, 1 },
+    { 88, -2 },
+    { 90, -1 },
+    { 95, 1 },
+    { 98, -1 },
+    { 101, -1 },
+    { 105, -1 },
+    { 107, -1 },
+    { 109, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 62, -3 },
+    { 64, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 81, -2 },
+    { 82, -1 },
+    { 88, -2 },
+    { 89, 1 },
+    { 90, -1 },
+    { 92, 1 },
+    { 95, 1 },
+    { 101, -1 },
+    { 103, -3 },
+    { 109, 1 },
+    { 55, 1 },
+    { 59, 4 },
+    { 60, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 2 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 84, 2 },
+    { 95, 2 },
+    { 96, 1 },
+    { 103, 1 },
+    { 3, 1 },
+    { 8, 1 },
+    { 25, 1 },
+    { 40, 1 },
+    { 83, 1 },
+    { 84, 3 },
+    { 93, 5 },
+    { 95, 3 },
+    { 102, 1 },
+    { 107, 1 },
+    { 55, 1 },
+    { 59, 4 },
+    { 60, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 2 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 84, 2 },
+    { 93, 4 },
+    { 95, 2 },
+    { 96, 1 },
+    { 103, 1 },
+    { 24, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 69, 2 },
+    { 70, -1 },
+    { 72, 2 },
+    { 94, -2 },
+    { 96, 1 },
+    { 99, -2 },
+    { 103, 1 },
+    { 24, -3 },
+    { 86, -1 },
+    { 87, -1 },
+    { 108, -1 },
+    { 2, 1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 56, 1 },
+    { 57, -1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, -2 },
+    { 63, 1 },
+    { 64, -1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 83, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -2 },
+    { 89, 1 },
+    { 90, -1 },
+    { 92, 1 },
+    { 94, 1 },
+    { 98, -1 },
+    { 99, 1 },
+    { 101, -3 },
+    { 103, -3 },
+    { 105, -1 },
+    { 107, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 88, -1 },
+    { 93, 1 },
+    { 95, 1 },
+    { 98, -1 },
+    { 4, 1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 42, -1 },
+    { 55, 1 },
+    { 57, -1 },
+    { 59, 4 },
+    { 60, 2 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 2 },
+    { 65, 2 },
+    { 67, 2 },
+    { 68, -1 },
+    { 69, 2 },
+    { 70, 1 },
+    { 72, 2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 84, 3 },
+    { 86, -1 },
+    { 89, 1 },
+    { 92, 1 },
+    { 93, 4 },
+    { 95, 3 },
+    { 96, 1 },
+    { 99, 1 },
+    { 100, -1 },
+    { 101, -2 },
+    { 102, 1 },
+    { 103, 2 },
+    { 107, 1 },
+    { 3, 1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 25, 1 },
+    { 40, 1 },
+    { 79, 1 },
+    { 80, 1 },
+    { 83, 1 },
+    { 84, 4 },
+    { 86, 1 },
+    { 93, 5 },
+    { 95, 1 },
+    { 102, 1 },
+    { 107, 1 },
+    { 109, 1 },
+    { 4, -3 },
+    { 24, -3 },
+    { 56, -3 },
+    { 57, -1 },
+    { 61, -1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -4 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 94, -4 },
+    { 95, -1 },
+    { 97, -1 },
+    { 99, -3 },
+    { 100, -3 },
+    { 101, -1 },
+    { 107, -2 },
+    { 109, -2 },
+    { 62, -1 },
+    { 70, -1 },
+    { 94, -1 },
+    { 99, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 43, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 95, -1 },
+    { 98, -1 },
+    { 100, -1 },
+    { 101, -2 },
+    { 103, -1 },
+    { 104, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -1 },
+    { 24, -2 },
+    { 84, 1 },
+    { 93, 3 },
+    { 95, 1 },
+    { 6, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 101, -1 },
+    { 107, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 62, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 107, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 84, 1 },
+    { 93, 3 },
+    { 95, 1 },
+    { 101, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 57, -1 },
+    { 59, 3 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 88, -2 },
+    { 89, 1 },
+    { 90, -1 },
+    { 92, 1 },
+    { 93, 2 },
+    { 98, -1 },
+    { 99, 1 },
+    { 100, -1 },
+    { 101, -2 },
+    { 103, 1 },
+    { 105, -2 },
+    { 107, -1 },
+    { 24, -2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 79, 1 },
+    { 80, 1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, 1 },
+    { 84, 1 },
+    { 86, 1 },
+    { 88, -1 },
+    { 93, 3 },
+    { 95, 1 },
+    { 107, -1 },
+    { 109, 1 },
+    { 1, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 12, -3 },
+    { 14, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 26, -2 },
+    { 28, -1 },
+    { 29, -2 },
+    { 33, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, -3 },
+    { 45, -3 },
+    { 47, -2 },
+    { 50, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, -3 },
+    { 62, -3 },
+    { 64, -2 },
+    { 67, -1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -1 },
+    { 76, -2 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -5 },
+    { 82, -1 },
+    { 85, -1 },
+    { 88, -2 },
+    { 90, -2 },
+    { 94, -1 },
+    { 98, -2 },
+    { 103, -3 },
+    { 105, -1 },
+    { 1, -1 },
+    { 5, -5 },
+    { 7, -5 },
+    { 11, -1 },
+    { 12, -4 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 26, -3 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -3 },
+    { 30, -1 },
+    { 32, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 45, -4 },
+    { 47, -3 },
+    { 48, -1 },
+    { 50, -3 },
+    { 51, -1 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -4 },
+    { 62, -4 },
+    { 64, -3 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -3 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -3 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -5 },
+    { 82, -2 },
+    { 83, -1 },
+    { 85, -1 },
+    { 88, -3 },
+    { 89, -1 },
+    { 90, -2 },
+    { 91, -1 },
+    { 94, -1 },
+    { 98, -2 },
+    { 99, -1 },
+    { 101, -2 },
+    { 102, -1 },
+    { 103, -4 },
+    { 106, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 3 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 28, 2 },
+    { 29, 1 },
+    { 30, -1 },
+    { 31, 3 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 48, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, 3 },
+    { 60, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -2 },
+    { 72, 1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 86, -2 },
+    { 87, -2 },
+    { 91, -1 },
+    { 93, 3 },
+    { 94, -3 },
+    { 97, -1 },
+    { 99, -2 },
+    { 100, -4 },
+    { 101, -1 },
+    { 103, 1 },
+    { 108, -3 },
+    { 109, -3 },
+};
+
 static const EpdFontData bookerly_14_bolditalic = {
     bookerly_14_bolditalicBitmaps,
     bookerly_14_bolditalicGlyphs,
@@ -5190,4 +7464,8 @@ static const EpdFontData bookerly_14_bolditalic = {
     31,
     -8,
     true,
+    bookerly_14_bolditalicKernLeftClasses,
+    bookerly_14_bolditalicKernRightClasses,
+    bookerly_14_bolditalicKernPairOffsets,
+    bookerly_14_bolditalicKernPairs,
 };
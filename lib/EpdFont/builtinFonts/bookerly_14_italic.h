@@ -4068,7 +4068,7 @@ static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 9, 23, 9, 1, 22, 52, 0 }, // !
@@ -4858,6 +4858,1864 @@ static const EpdUnicodeInterval bookerly_14_italicIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_14_italicKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 3, 4, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 7, 8, 9, 10, 11, 12, 13, 13, 14,
+    15, 16, 17, 18, 9, 19, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28,
+    29, 30, 0, 0, 0, 0, 31, 32, 33, 0, 34, 35, 36, 37, 0, 38,
+    39, 0, 37, 37, 32, 32, 40, 41, 42, 43, 31, 44, 44, 45, 44, 46,
+    47, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+    0, 0, 0, 51, 6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10,
+    13, 13, 13, 13, 9, 18, 9, 9, 9, 9, 9, 0, 9, 24, 24, 24,
+    24, 27, 52, 53, 31, 31, 31, 31, 31, 31, 34, 54, 34, 34, 34, 34,
+    0, 0, 55, 55, 32, 37, 32, 32, 32, 32, 32, 0, 56, 31, 31, 31,
+    31, 44, 32, 44, 6, 31, 6, 31, 57, 58, 8, 33, 8, 33, 8, 33,
+    8, 33, 9, 59, 9, 0, 10, 34, 10, 34, 10, 34, 60, 61, 10, 34,
+    12, 36, 12, 36, 12, 36, 12, 36, 13, 37, 13, 37, 13, 62, 13, 55,
+    13, 55, 63, 64, 13, 31, 14, 38, 14, 65, 15, 39, 66, 16, 0, 16,
+    67, 0, 59, 0, 0, 16, 68, 18, 37, 18, 37, 18, 37, 37, 18, 69,
+    9, 32, 9, 32, 9, 32, 10, 34, 21, 41, 21, 41, 21, 41, 22, 42,
+    22, 42, 22, 70, 22, 42, 23, 71, 23, 0, 23, 43, 24, 31, 24, 31,
+    24, 31, 24, 31, 24, 31, 24, 72, 25, 44, 27, 44, 27, 28, 46, 28,
+    46, 28, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 73, 73, 74, 0, 75, 76, 77, 77, 78, 79, 79,
+    80, 81, 77, 82, 77, 83, 84, 85, 86, 87, 73, 81, 85, 77, 77, 81,
+    77, 88, 77, 89, 77, 90, 91, 92, 82, 93, 94, 87, 77, 77, 87, 79,
+    77, 79, 89, 89, 77, 95, 96, 97, 0, 98, 99, 66, 97, 95, 95, 66,
+    95, 95, 95, 98, 100, 98, 33, 100, 101, 98, 102, 103, 95, 95, 103, 104,
+    95, 104, 98, 98, 95, 99, 99, 105, 0, 33, 106, 0, 107, 108, 104, 104,
+    100, 66, 95, 101, 95, 109, 104, 89, 98, 110, 111, 87, 103, 79, 104, 90,
+    98, 112, 113, 114, 0, 0, 0, 115, 116, 85, 97, 115, 116, 81, 66, 81,
+    66, 81, 66, 87, 103, 0, 0, 0, 0, 117, 118, 91, 33, 86, 103, 119,
+    101, 119, 101, 120, 121, 87, 103, 87, 103, 77, 95, 122, 100, 123, 99, 123,
+    99, 77, 81, 66, 124, 125, 87, 103, 78, 108, 87, 103, 77, 0, 87, 103,
+    126, 83, 95, 83, 95, 73, 99, 73, 99, 89, 98, 89, 98, 81, 66, 85,
+    97, 127, 128, 77, 95, 77, 95, 89, 98, 89, 98, 89, 98, 89, 98, 82,
+    101, 82, 101, 82, 101, 77, 95, 86, 0, 77, 95, 114, 0, 129, 130, 94,
+    102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 4, 4, 4, 0, 0, 131, 132, 133, 131, 131, 132, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_14_italicKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+    0, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    9, 0, 0, 0, 10, 0, 11, 12, 13, 12, 12, 12, 13, 12, 12, 14,
+    12, 12, 15, 12, 13, 12, 13, 12, 16, 17, 18, 19, 19, 20, 21, 22,
+    0, 23, 24, 0, 0, 0, 25, 26, 25, 25, 25, 27, 28, 26, 29, 30,
+    26, 26, 31, 31, 25, 32, 25, 31, 33, 34, 35, 36, 36, 37, 38, 39,
+    0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    0, 0, 0, 42, 11, 11, 11, 11, 11, 11, 43, 13, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 0, 13, 18, 18, 18,
+    18, 21, 12, 44, 25, 25, 25, 25, 45, 25, 25, 25, 25, 25, 25, 25,
+    46, 29, 47, 47, 25, 31, 25, 25, 25, 25, 25, 0, 48, 35, 35, 35,
+    35, 36, 49, 36, 11, 25, 11, 25, 11, 25, 13, 25, 13, 25, 13, 25,
+    13, 45, 12, 25, 12, 25, 12, 25, 12, 25, 12, 25, 12, 25, 12, 25,
+    13, 28, 13, 28, 13, 28, 13, 28, 12, 26, 12, 50, 12, 51, 12, 47,
+    12, 47, 12, 29, 12, 31, 12, 29, 14, 52, 12, 26, 31, 12, 26, 12,
+    26, 12, 26, 12, 26, 12, 53, 12, 31, 12, 31, 12, 31, 31, 12, 31,
+    13, 25, 13, 25, 13, 25, 13, 25, 12, 31, 12, 31, 12, 31, 16, 33,
+    16, 33, 16, 33, 16, 54, 17, 34, 17, 34, 17, 34, 18, 35, 18, 35,
+    18, 35, 18, 35, 18, 35, 18, 35, 19, 36, 21, 36, 21, 22, 39, 22,
+    39, 22, 39, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 55, 55, 56, 55, 57, 16, 55, 55, 58, 59, 55,
+    56, 55, 55, 60, 55, 61, 55, 62, 55, 63, 55, 64, 65, 55, 55, 55,
+    59, 66, 55, 57, 55, 62, 57, 56, 60, 67, 68, 55, 69, 55, 55, 56,
+    55, 55, 70, 55, 71, 72, 73, 72, 74, 75, 72, 76, 77, 78, 78, 79,
+    80, 81, 79, 72, 79, 79, 72, 79, 82, 72, 83, 78, 84, 78, 78, 85,
+    78, 78, 77, 79, 86, 72, 72, 87, 74, 72, 88, 89, 90, 91, 80, 79,
+    92, 79, 78, 82, 78, 56, 79, 57, 72, 93, 82, 55, 79, 0, 94, 62,
+    79, 55, 95, 55, 74, 55, 79, 64, 76, 65, 77, 55, 79, 55, 79, 0,
+    0, 56, 0, 55, 79, 55, 79, 55, 79, 57, 72, 57, 72, 56, 79, 96,
+    82, 96, 82, 68, 83, 0, 0, 69, 84, 69, 84, 55, 92, 97, 98, 97,
+    98, 55, 64, 76, 55, 79, 59, 80, 55, 79, 55, 79, 69, 84, 0, 81,
+    99, 61, 72, 61, 72, 100, 72, 55, 72, 101, 102, 0, 102, 64, 76, 65,
+    77, 22, 103, 55, 78, 55, 78, 57, 72, 57, 72, 57, 72, 0, 77, 60,
+    82, 60, 82, 60, 82, 0, 84, 55, 74, 55, 78, 55, 74, 68, 83, 68,
+    83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 104, 105, 6, 104, 104, 105, 6,
+    0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 0, 1, 0, 0, 0,
+    10, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_italicKernPairOffsets[134] = {
+    0, 25, 29, 78, 82, 124, 152, 164, 167, 180, 186, 203, 212, 224, 234, 253,
+    264, 271, 285, 306, 325, 344, 351, 369, 386, 410, 426, 454, 458, 468, 501, 504,
+    512, 513, 518, 543, 558, 563, 565, 568, 575, 586, 591, 593, 598, 601, 607, 625,
+    640, 644, 655, 677, 692, 693, 696, 706, 717, 748, 754, 778, 787, 794, 804, 819,
+    822, 827, 828, 830, 837, 840, 847, 851, 857, 863, 876, 877, 884, 905, 921, 931,
+    947, 975, 1010, 1044, 1045, 1060, 1089, 1091, 1100, 1115, 1145, 1150, 1180, 1206, 1232, 1237,
+    1246, 1249, 1258, 1261, 1267, 1275, 1277, 1284, 1294, 1301, 1307, 1314, 1317, 1321, 1348, 1349,
+    1378, 1393, 1413, 1419, 1422, 1428, 1432, 1473, 1501, 1508, 1523, 1526, 1528, 1530, 1531, 1538,
+    1543, 1574, 1581, 1625, 1697, 1745,
+};
+
+static const EpdKernPair bookerly_14_italicKernPairs[] = {
+    { 13, -1 },
+    { 14, 3 },
+    { 21, 1 },
+    { 25, -1 },
+    { 26, 2 },
+    { 27, 4 },
+    { 28, 2 },
+    { 30, 4 },
+    { 38, 2 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, 2 },
+    { 50, 2 },
+    { 53, 2 },
+    { 57, -1 },
+    { 58, 3 },
+    { 60, 1 },
+    { 63, 1 },
+    { 72, -1 },
+    { 75, -1 },
+    { 80, -1 },
+    { 87, 2 },
+    { 91, 4 },
+    { 92, 2 },
+    { 96, 1 },
+    { 11, -3 },
+    { 43, -3 },
+    { 61, -3 },
+    { 100, -3 },
+    { 11, 1 },
+    { 13, -1 },
+    { 14, 2 },
+    { 17, -1 },
+    { 18, -2 },
+    { 19, -3 },
+    { 20, 1 },
+    { 21, -2 },
+    { 25, -1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 30, 2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 43, 1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 2 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 69, -3 },
+    { 71, 1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -2 },
+    { 84, -3 },
+    { 85, -2 },
+    { 91, 2 },
+    { 93, -3 },
+    { 94, -1 },
+    { 96, -2 },
+    { 97, -4 },
+    { 98, -1 },
+    { 100, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 21, -1 },
+    { 96, -1 },
+    { 11, -3 },
+    { 13, -1 },
+    { 15, -1 },
+    { 25, -3 },
+    { 27, -1 },
+    { 28, -3 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -3 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -2 },
+    { 43, -4 },
+    { 45, -3 },
+    { 48, -3 },
+    { 54, -3 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -3 },
+    { 63, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 71, -1 },
+    { 72, -3 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -2 },
+    { 83, -1 },
+    { 85, -1 },
+    { 86, -3 },
+    { 88, -3 },
+    { 95, -2 },
+    { 98, -1 },
+    { 100, -4 },
+    { 102, -2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -4 },
+    { 20, 1 },
+    { 21, -3 },
+    { 23, -5 },
+    { 25, -1 },
+    { 28, 1 },
+    { 29, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 40, -1 },
+    { 43, 1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 51, -1 },
+    { 104, -3 },
+    { 105, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 21, -1 },
+    { 23, -1 },
+    { 43, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 19, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 25, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 25, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 40, -1 },
+    { 43, -3 },
+    { 45, -1 },
+    { 47, 1 },
+    { 48, -1 },
+    { 51, 1 },
+    { 54, -1 },
+    { 105, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 104, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 25, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 104, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 43, -1 },
+    { 47, 1 },
+    { 51, 1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 20, 1 },
+    { 25, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 43, 1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 54, -1 },
+    { 3, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, 1 },
+    { 21, -2 },
+    { 23, -3 },
+    { 36, -1 },
+    { 38, -1 },
+    { 104, -2 },
+    { 105, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, 1 },
+    { 23, -1 },
+    { 40, -1 },
+    { 104, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 11, -1 },
+    { 25, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 54, -1 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 43, -4 },
+    { 45, -1 },
+    { 48, -1 },
+    { 54, -1 },
+    { 2, 7 },
+    { 4, 5 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, 5 },
+    { 14, 3 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 24, 6 },
+    { 27, 1 },
+    { 28, 2 },
+    { 30, 2 },
+    { 32, 1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 49, 1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 1 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, 2 },
+    { 21, -3 },
+    { 23, -3 },
+    { 27, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 43, 1 },
+    { 104, -2 },
+    { 105, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 23, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 25, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 40, -1 },
+    { 43, -3 },
+    { 45, -1 },
+    { 48, -1 },
+    { 50, 1 },
+    { 54, -1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -2 },
+    { 13, -1 },
+    { 25, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 54, -1 },
+    { 3, 1 },
+    { 4, -4 },
+    { 5, -1 },
+    { 6, -4 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 13, -1 },
+    { 15, -1 },
+    { 23, 1 },
+    { 25, -2 },
+    { 28, -2 },
+    { 33, -1 },
+    { 37, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 43, -4 },
+    { 45, -2 },
+    { 47, 1 },
+    { 48, -2 },
+    { 51, 1 },
+    { 54, -1 },
+    { 105, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 1 },
+    { 20, 1 },
+    { 25, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 43, 1 },
+    { 45, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -3 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -3 },
+    { 13, -1 },
+    { 21, 1 },
+    { 23, 1 },
+    { 25, -2 },
+    { 27, -1 },
+    { 28, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 43, -3 },
+    { 45, -2 },
+    { 47, 1 },
+    { 48, -2 },
+    { 50, 1 },
+    { 51, 1 },
+    { 54, -2 },
+    { 105, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 19, -1 },
+    { 23, -1 },
+    { 14, 1 },
+    { 25, -1 },
+    { 27, 2 },
+    { 30, 1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 58, 1 },
+    { 72, -1 },
+    { 75, -1 },
+    { 91, 1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -3 },
+    { 20, 2 },
+    { 21, -3 },
+    { 28, 2 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 39, 1 },
+    { 43, 1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 59, 2 },
+    { 61, 1 },
+    { 63, 2 },
+    { 64, 1 },
+    { 66, 1 },
+    { 67, -1 },
+    { 68, 2 },
+    { 69, -2 },
+    { 71, 2 },
+    { 82, -1 },
+    { 83, 1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 93, -3 },
+    { 96, -3 },
+    { 97, -2 },
+    { 100, 1 },
+    { 3, -1 },
+    { 23, -2 },
+    { 104, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -2 },
+    { 53, 1 },
+    { 104, -1 },
+    { 23, -1 },
+    { 23, -2 },
+    { 26, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 53, -1 },
+    { 2, 1 },
+    { 3, 2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 10, 1 },
+    { 23, 2 },
+    { 25, -1 },
+    { 26, 1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 45, -1 },
+    { 46, 1 },
+    { 47, 1 },
+    { 48, -1 },
+    { 49, 1 },
+    { 50, 1 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 1 },
+    { 104, 1 },
+    { 105, 2 },
+    { 3, 1 },
+    { 6, -1 },
+    { 24, 1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 3 },
+    { 31, 1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 104, 1 },
+    { 105, 2 },
+    { 3, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -3 },
+    { 104, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -2 },
+    { 28, 1 },
+    { 48, 1 },
+    { 2, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, -1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 28, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 105, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 23, -1 },
+    { 105, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 23, -2 },
+    { 48, 1 },
+    { 105, 1 },
+    { 2, -1 },
+    { 23, -2 },
+    { 28, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 48, 1 },
+    { 14, 1 },
+    { 25, -1 },
+    { 27, 1 },
+    { 30, 2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 54, -1 },
+    { 58, 1 },
+    { 72, -1 },
+    { 75, -1 },
+    { 79, -1 },
+    { 88, -1 },
+    { 91, 2 },
+    { 100, -1 },
+    { 14, 2 },
+    { 19, -1 },
+    { 21, -1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 30, 2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 53, -1 },
+    { 58, 2 },
+    { 87, -1 },
+    { 91, 2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 56, -1 },
+    { 67, 1 },
+    { 69, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 101, 1 },
+    { 14, 3 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 2 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 53, -1 },
+    { 58, 3 },
+    { 72, -1 },
+    { 75, -1 },
+    { 87, -1 },
+    { 91, 2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 2, -2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 11, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -2 },
+    { 23, -2 },
+    { 43, -2 },
+    { 104, -1 },
+    { 23, -1 },
+    { 27, 1 },
+    { 30, 1 },
+    { 2, 1 },
+    { 3, 2 },
+    { 23, 2 },
+    { 26, 2 },
+    { 47, 1 },
+    { 49, 2 },
+    { 50, 2 },
+    { 51, 1 },
+    { 53, 2 },
+    { 105, 1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -2 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 53, 1 },
+    { 104, -1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 14, 4 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -4 },
+    { 20, 1 },
+    { 21, -3 },
+    { 23, -5 },
+    { 25, -1 },
+    { 27, 3 },
+    { 28, 1 },
+    { 29, -1 },
+    { 30, 4 },
+    { 31, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 40, -1 },
+    { 43, 1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 51, -1 },
+    { 104, -3 },
+    { 105, -2 },
+    { 3, -1 },
+    { 23, -2 },
+    { 27, 4 },
+    { 28, 1 },
+    { 30, 4 },
+    { 104, -1 },
+    { 2, 3 },
+    { 3, 3 },
+    { 10, 2 },
+    { 23, 3 },
+    { 24, 1 },
+    { 26, 3 },
+    { 27, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 45, 1 },
+    { 46, 1 },
+    { 49, 3 },
+    { 50, 3 },
+    { 53, 3 },
+    { 54, 1 },
+    { 104, 2 },
+    { 105, 3 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 14, 2 },
+    { 25, -1 },
+    { 27, 2 },
+    { 30, 2 },
+    { 45, -1 },
+    { 48, -1 },
+    { 23, -2 },
+    { 26, -1 },
+    { 27, 2 },
+    { 30, 2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 53, -1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 23, 2 },
+    { 26, 1 },
+    { 47, 1 },
+    { 49, 1 },
+    { 50, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 105, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 14, 2 },
+    { 25, -1 },
+    { 27, 2 },
+    { 30, 2 },
+    { 34, -1 },
+    { 35, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 104, -1 },
+    { 27, 3 },
+    { 28, 1 },
+    { 30, 3 },
+    { 26, 1 },
+    { 49, 1 },
+    { 50, 1 },
+    { 53, 1 },
+    { 105, 1 },
+    { 23, -2 },
+    { 27, 1 },
+    { 30, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 27, 1 },
+    { 30, 1 },
+    { 23, -1 },
+    { 27, 1 },
+    { 30, 1 },
+    { 105, 1 },
+    { 3, -1 },
+    { 23, -2 },
+    { 27, 3 },
+    { 28, 1 },
+    { 30, 4 },
+    { 104, -1 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 72, -1 },
+    { 75, -1 },
+    { 98, -1 },
+    { 23, -2 },
+    { 56, -2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 68, 1 },
+    { 69, -1 },
+    { 84, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 104, -1 },
+    { 67, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 56, -1 },
+    { 103, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 67, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 84, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 98, -1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 71, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 90, 1 },
+    { 100, -1 },
+    { 3, -2 },
+    { 23, -3 },
+    { 56, -2 },
+    { 60, -1 },
+    { 69, -2 },
+    { 84, -1 },
+    { 93, -3 },
+    { 96, -2 },
+    { 97, -1 },
+    { 104, -2 },
+    { 3, -2 },
+    { 23, -2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 69, -2 },
+    { 73, -1 },
+    { 82, -2 },
+    { 84, -2 },
+    { 85, -1 },
+    { 93, -3 },
+    { 96, -2 },
+    { 97, -2 },
+    { 104, -2 },
+    { 105, -2 },
+    { 3, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 40, -1 },
+    { 57, -1 },
+    { 63, 1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 71, 1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -1 },
+    { 84, -2 },
+    { 85, -2 },
+    { 88, -1 },
+    { 98, -2 },
+    { 100, 1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 3, 2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -3 },
+    { 23, 2 },
+    { 55, 1 },
+    { 56, 1 },
+    { 59, -2 },
+    { 60, 2 },
+    { 61, -3 },
+    { 63, -2 },
+    { 64, 1 },
+    { 68, 1 },
+    { 69, 2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 75, 1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -4 },
+    { 81, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 87, 1 },
+    { 88, -1 },
+    { 90, 1 },
+    { 92, 1 },
+    { 93, 1 },
+    { 95, -1 },
+    { 96, 2 },
+    { 98, -1 },
+    { 100, -4 },
+    { 102, -1 },
+    { 105, 1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 10, -1 },
+    { 23, -5 },
+    { 40, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 59, 1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 69, -4 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -2 },
+    { 84, -3 },
+    { 85, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 93, -4 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -2 },
+    { 100, 1 },
+    { 103, -1 },
+    { 104, -3 },
+    { 105, -2 },
+    { 93, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 56, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 69, -1 },
+    { 93, -2 },
+    { 96, -1 },
+    { 97, -1 },
+    { 100, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 40, -1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, -3 },
+    { 63, -2 },
+    { 69, 1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -4 },
+    { 81, -1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 90, 1 },
+    { 98, -3 },
+    { 100, -3 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 58, 3 },
+    { 91, 2 },
+    { 23, -1 },
+    { 40, -1 },
+    { 56, -1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 69, -1 },
+    { 93, -1 },
+    { 97, -1 },
+    { 104, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 69, -1 },
+    { 80, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 100, -1 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 23, -1 },
+    { 55, -1 },
+    { 58, -1 },
+    { 59, -2 },
+    { 61, -3 },
+    { 63, -3 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 100, -4 },
+    { 102, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 67, -1 },
+    { 93, -1 },
+    { 98, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 40, -1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, -3 },
+    { 63, -2 },
+    { 69, 1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -4 },
+    { 81, -1 },
+    { 86, -1 },
+    { 87, 1 },
+    { 88, -1 },
+    { 90, 1 },
+    { 98, -3 },
+    { 100, -3 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 86, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 40, -1 },
+    { 57, -1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 66, 1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 71, 1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 82, -1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 97, -1 },
+    { 98, -2 },
+    { 100, 1 },
+    { 103, -1 },
+    { 3, -1 },
+    { 23, -2 },
+    { 84, -1 },
+    { 85, -1 },
+    { 104, -1 },
+    { 3, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, 1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 104, -1 },
+    { 23, -3 },
+    { 103, -1 },
+    { 104, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -2 },
+    { 80, -1 },
+    { 81, -1 },
+    { 104, -1 },
+    { 23, -2 },
+    { 87, -1 },
+    { 92, -1 },
+    { 3, -1 },
+    { 23, -3 },
+    { 84, -1 },
+    { 85, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 80, -1 },
+    { 86, -1 },
+    { 95, -1 },
+    { 23, -2 },
+    { 105, 1 },
+    { 2, 2 },
+    { 23, -2 },
+    { 24, 1 },
+    { 82, 1 },
+    { 84, -1 },
+    { 91, 4 },
+    { 103, 1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, -4 },
+    { 82, -1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 94, -1 },
+    { 103, -1 },
+    { 104, -2 },
+    { 3, -1 },
+    { 23, -3 },
+    { 81, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, -1 },
+    { 98, -1 },
+    { 2, 1 },
+    { 3, 2 },
+    { 23, 2 },
+    { 87, 2 },
+    { 90, 1 },
+    { 92, 2 },
+    { 105, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 80, -1 },
+    { 56, -1 },
+    { 59, 1 },
+    { 69, -1 },
+    { 93, -2 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 8, -1 },
+    { 9, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 59, -2 },
+    { 60, 1 },
+    { 61, -4 },
+    { 63, -3 },
+    { 66, -1 },
+    { 67, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -4 },
+    { 81, -1 },
+    { 86, -2 },
+    { 95, -1 },
+    { 98, -1 },
+    { 100, -3 },
+    { 102, -1 },
+    { 103, -1 },
+    { 79, 1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 59, -2 },
+    { 60, 1 },
+    { 61, -3 },
+    { 63, -2 },
+    { 67, -1 },
+    { 69, 1 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 84, -1 },
+    { 85, -2 },
+    { 86, -2 },
+    { 95, -2 },
+    { 98, -3 },
+    { 100, -4 },
+    { 102, -2 },
+    { 103, -2 },
+    { 105, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 40, -1 },
+    { 72, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 86, -1 },
+    { 95, -1 },
+    { 98, -1 },
+    { 102, -1 },
+    { 105, 1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 40, -1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, -3 },
+    { 63, -2 },
+    { 71, -1 },
+    { 72, -1 },
+    { 75, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 90, 1 },
+    { 100, -3 },
+    { 105, 1 },
+    { 58, 4 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 66, 1 },
+    { 91, 4 },
+    { 82, 1 },
+    { 91, 4 },
+    { 103, 1 },
+    { 23, -1 },
+    { 56, -1 },
+    { 63, 1 },
+    { 69, -1 },
+    { 93, -2 },
+    { 96, -2 },
+    { 23, -3 },
+    { 84, -1 },
+    { 85, -1 },
+    { 104, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -3 },
+    { 8, -1 },
+    { 9, -1 },
+    { 23, 1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 57, -1 },
+    { 59, -2 },
+    { 60, 1 },
+    { 61, -2 },
+    { 63, -2 },
+    { 67, -1 },
+    { 69, 1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 83, -1 },
+    { 85, -1 },
+    { 86, -2 },
+    { 87, 1 },
+    { 88, -2 },
+    { 90, 1 },
+    { 92, 1 },
+    { 95, -1 },
+    { 96, 1 },
+    { 98, -2 },
+    { 100, -3 },
+    { 102, -1 },
+    { 103, -1 },
+    { 105, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 40, -1 },
+    { 57, -1 },
+    { 58, 4 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 66, 1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 71, 1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 82, 1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 91, 3 },
+    { 97, -1 },
+    { 98, -2 },
+    { 100, 1 },
+    { 103, -1 },
+    { 2, 1 },
+    { 23, -2 },
+    { 24, 1 },
+    { 82, 1 },
+    { 91, 5 },
+    { 103, 2 },
+    { 105, 1 },
+    { 3, -3 },
+    { 56, -3 },
+    { 57, -1 },
+    { 60, -1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 69, -3 },
+    { 78, -1 },
+    { 82, -1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 93, -4 },
+    { 94, -1 },
+    { 96, -3 },
+    { 105, -2 },
+    { 61, -1 },
+    { 69, -1 },
+    { 96, -1 },
+    { 60, 1 },
+    { 67, -1 },
+    { 23, -2 },
+    { 91, 2 },
+    { 98, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 61, -1 },
+    { 76, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 100, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 91, 1 },
+    { 98, -1 },
+    { 102, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 40, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 66, 1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 97, -1 },
+    { 98, -2 },
+    { 102, -2 },
+    { 103, -1 },
+    { 23, -2 },
+    { 72, -1 },
+    { 75, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 86, -1 },
+    { 105, 1 },
+    { 1, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 11, -3 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 25, -2 },
+    { 27, -1 },
+    { 28, -2 },
+    { 33, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 42, -3 },
+    { 43, -3 },
+    { 45, -2 },
+    { 48, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 57, -1 },
+    { 59, -3 },
+    { 61, -3 },
+    { 62, -1 },
+    { 63, -2 },
+    { 66, -1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -1 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 83, -1 },
+    { 86, -2 },
+    { 88, -2 },
+    { 93, -1 },
+    { 95, -2 },
+    { 100, -3 },
+    { 102, -1 },
+    { 103, -1 },
+    { 1, -2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 10, -1 },
+    { 11, -4 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 25, -3 },
+    { 26, -1 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -3 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 43, -4 },
+    { 45, -3 },
+    { 46, -1 },
+    { 48, -3 },
+    { 49, -1 },
+    { 50, -1 },
+    { 53, -1 },
+    { 54, -3 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -4 },
+    { 61, -4 },
+    { 62, -1 },
+    { 63, -4 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -3 },
+    { 83, -1 },
+    { 86, -3 },
+    { 87, -1 },
+    { 88, -3 },
+    { 89, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 95, -2 },
+    { 96, -1 },
+    { 98, -3 },
+    { 99, -1 },
+    { 100, -4 },
+    { 11, 1 },
+    { 13, -1 },
+    { 14, 2 },
+    { 17, -1 },
+    { 18, -2 },
+    { 19, -3 },
+    { 20, 1 },
+    { 21, -2 },
+    { 25, -1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 43, 1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 2 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 69, -3 },
+    { 71, 1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -2 },
+    { 84, -3 },
+    { 85, -2 },
+    { 91, 2 },
+    { 93, -3 },
+    { 94, -1 },
+    { 96, -2 },
+    { 97, -4 },
+    { 98, -1 },
+    { 100, 1 },
+    { 104, -3 },
+    { 105, -3 },
+};
+
 static const EpdFontData bookerly_14_italic = {
     bookerly_14_italicBitmaps,
     bookerly_14_italicGlyphs,
@@ -4867,4 +6725,8 @@ static const EpdFontData bookerly_14_italic = {
     31,
     -8,
     true,
+    bookerly_14_italicKernLeftClasses,
+    bookerly_14_italicKernRightClasses,
+    bookerly_14_italicKernPairOffsets,
+    bookerly_14_italicKernPairs,
 };
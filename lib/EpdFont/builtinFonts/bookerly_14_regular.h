@@ -3932,7 +3932,7 @@ static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 5, 23, 8, 2, 22, 29, 0 }, // !
@@ -4722,6 +4722,1931 @@ static const EpdUnicodeInterval bookerly_14_regularIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_14_regularKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3,
+    0, 4, 5, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 8, 9, 10, 11, 0, 12, 13, 14, 14, 15,
+    16, 17, 18, 19, 11, 20, 21, 22, 23, 24, 25, 26, 26, 27, 28, 29,
+    30, 31, 0, 0, 0, 0, 32, 33, 34, 35, 36, 37, 38, 39, 35, 40,
+    41, 42, 39, 39, 33, 33, 43, 44, 45, 46, 47, 48, 48, 49, 48, 50,
+    51, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54,
+    0, 0, 0, 55, 8, 8, 8, 8, 8, 8, 0, 10, 0, 0, 0, 0,
+    14, 14, 14, 14, 11, 19, 11, 11, 11, 11, 11, 0, 56, 25, 25, 25,
+    25, 28, 57, 58, 32, 32, 32, 32, 32, 32, 36, 34, 36, 36, 36, 36,
+    35, 35, 59, 59, 60, 39, 33, 33, 33, 33, 33, 0, 33, 47, 47, 47,
+    47, 48, 33, 48, 8, 32, 8, 32, 61, 62, 10, 34, 10, 34, 10, 34,
+    10, 34, 11, 63, 11, 35, 0, 36, 0, 36, 0, 36, 64, 65, 0, 36,
+    13, 38, 13, 38, 13, 38, 13, 38, 14, 39, 14, 39, 14, 59, 14, 59,
+    14, 59, 66, 67, 14, 35, 15, 40, 15, 68, 16, 41, 41, 17, 42, 17,
+    42, 0, 63, 0, 0, 17, 69, 19, 39, 19, 39, 19, 39, 39, 19, 39,
+    11, 33, 11, 33, 11, 33, 0, 36, 22, 44, 22, 44, 22, 44, 23, 45,
+    23, 45, 23, 45, 23, 45, 24, 70, 24, 0, 24, 46, 25, 47, 25, 47,
+    25, 47, 25, 47, 25, 47, 25, 71, 26, 48, 28, 48, 28, 29, 50, 29,
+    50, 29, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 72, 72, 73, 0, 74, 75, 76, 76, 77, 78, 78,
+    79, 80, 76, 81, 76, 82, 83, 84, 85, 86, 72, 80, 84, 76, 76, 80,
+    76, 87, 76, 88, 76, 89, 90, 85, 81, 91, 92, 86, 76, 76, 86, 78,
+    76, 78, 88, 88, 76, 93, 94, 95, 96, 97, 98, 99, 100, 101, 101, 99,
+    101, 101, 101, 94, 101, 94, 102, 96, 103, 94, 104, 97, 101, 101, 97, 105,
+    101, 105, 94, 94, 101, 98, 98, 106, 96, 107, 108, 109, 110, 111, 105, 105,
+    112, 99, 101, 103, 101, 113, 114, 88, 94, 115, 116, 86, 97, 78, 105, 89,
+    94, 117, 118, 119, 96, 0, 0, 120, 121, 84, 100, 120, 121, 80, 99, 80,
+    99, 80, 99, 86, 97, 0, 0, 0, 0, 122, 123, 90, 102, 85, 96, 124,
+    103, 124, 103, 125, 126, 86, 97, 86, 97, 76, 101, 127, 112, 128, 98, 128,
+    98, 76, 80, 99, 129, 130, 86, 97, 77, 131, 86, 97, 76, 101, 86, 97,
+    132, 82, 93, 82, 93, 72, 98, 72, 98, 88, 94, 88, 94, 80, 99, 84,
+    100, 133, 101, 76, 101, 76, 101, 88, 94, 88, 94, 88, 94, 88, 94, 81,
+    103, 81, 103, 81, 103, 76, 101, 85, 96, 76, 101, 119, 96, 134, 104, 92,
+    104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 135, 136, 4, 135, 135, 136, 4,
+    135, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 54, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_14_regularKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4,
+    0, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    10, 0, 0, 0, 11, 0, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15,
+    13, 13, 16, 13, 14, 13, 14, 13, 17, 18, 19, 20, 20, 21, 22, 23,
+    0, 24, 25, 0, 0, 0, 26, 27, 28, 28, 28, 29, 30, 31, 32, 33,
+    31, 31, 34, 34, 28, 35, 28, 34, 36, 37, 38, 39, 39, 40, 41, 42,
+    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+    0, 0, 0, 46, 12, 12, 12, 12, 12, 12, 47, 14, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 0, 48, 19, 19, 19,
+    19, 22, 13, 49, 26, 26, 26, 50, 51, 26, 26, 28, 28, 28, 28, 52,
+    53, 32, 54, 55, 28, 34, 28, 28, 28, 28, 28, 0, 56, 38, 38, 38,
+    38, 41, 31, 41, 12, 57, 12, 58, 12, 26, 14, 28, 14, 28, 14, 28,
+    14, 28, 13, 28, 13, 28, 13, 28, 13, 28, 13, 28, 13, 28, 13, 28,
+    14, 30, 14, 30, 14, 30, 14, 30, 13, 31, 13, 59, 13, 55, 13, 55,
+    13, 55, 13, 32, 13, 32, 13, 32, 15, 60, 13, 31, 34, 13, 31, 13,
+    31, 13, 31, 13, 31, 13, 61, 13, 34, 13, 34, 13, 34, 34, 13, 34,
+    14, 28, 14, 28, 14, 28, 14, 28, 13, 34, 13, 34, 13, 62, 17, 36,
+    17, 36, 17, 36, 17, 63, 18, 37, 18, 37, 18, 37, 19, 38, 19, 38,
+    19, 38, 19, 38, 19, 38, 19, 38, 20, 39, 22, 41, 22, 23, 42, 23,
+    42, 23, 64, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 65, 65, 66, 65, 67, 68, 65, 65, 69, 70, 65,
+    66, 65, 65, 71, 65, 72, 65, 65, 65, 73, 65, 74, 75, 65, 65, 65,
+    70, 76, 65, 67, 65, 65, 67, 66, 71, 77, 78, 65, 79, 65, 65, 66,
+    65, 65, 80, 65, 81, 82, 83, 84, 84, 85, 86, 87, 88, 84, 84, 84,
+    89, 84, 84, 86, 84, 90, 86, 91, 92, 86, 93, 84, 94, 84, 84, 91,
+    84, 84, 88, 84, 95, 86, 86, 96, 84, 86, 97, 98, 99, 100, 89, 84,
+    96, 84, 84, 92, 84, 66, 91, 67, 86, 101, 92, 65, 84, 102, 103, 65,
+    90, 65, 84, 65, 84, 65, 84, 74, 87, 75, 88, 65, 84, 65, 84, 0,
+    0, 66, 91, 65, 84, 65, 84, 65, 84, 67, 86, 67, 86, 66, 91, 104,
+    92, 104, 92, 78, 93, 0, 91, 79, 94, 79, 94, 65, 96, 105, 106, 105,
+    106, 65, 74, 87, 65, 84, 70, 89, 65, 84, 65, 84, 79, 94, 0, 84,
+    96, 72, 82, 72, 82, 107, 82, 65, 86, 108, 109, 0, 109, 74, 87, 75,
+    88, 0, 110, 65, 84, 65, 84, 67, 86, 67, 86, 67, 86, 0, 88, 71,
+    92, 71, 92, 71, 92, 0, 94, 65, 84, 65, 84, 65, 84, 78, 93, 78,
+    93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 0, 6, 6, 6, 0, 0, 111, 112, 7, 111, 111, 112, 7,
+    111, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 1, 0, 0, 0,
+    11, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_regularKernPairOffsets[137] = {
+    0, 4, 28, 42, 73, 88, 140, 142, 164, 172, 177, 190, 215, 219, 225, 247,
+    262, 273, 281, 296, 317, 337, 355, 363, 393, 413, 458, 476, 520, 523, 533, 558,
+    565, 572, 574, 577, 581, 610, 617, 623, 626, 630, 635, 641, 660, 664, 666, 673,
+    695, 700, 701, 712, 720, 728, 747, 792, 802, 825, 834, 846, 853, 878, 887, 913,
+    914, 920, 927, 932, 941, 956, 959, 968, 969, 981, 984, 995, 1003, 1027, 1051, 1068,
+    1087, 1129, 1158, 1167, 1177, 1207, 1216, 1228, 1247, 1268, 1272, 1293, 1312, 1323, 1332, 1335,
+    1343, 1347, 1351, 1356, 1360, 1361, 1364, 1381, 1386, 1397, 1406, 1407, 1412, 1417, 1425, 1427,
+    1435, 1444, 1451, 1484, 1496, 1529, 1538, 1559, 1581, 1586, 1593, 1598, 1639, 1666, 1672, 1685,
+    1688, 1690, 1692, 1702, 1706, 1708, 1731, 1769, 1812,
+};
+
+static const EpdKernPair bookerly_14_regularKernPairs[] = {
+    { 12, -1 },
+    { 30, -1 },
+    { 37, 1 },
+    { 72, -1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 33, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 67, -1 },
+    { 69, 1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 92, 1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 12, -2 },
+    { 20, 1 },
+    { 21, 1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 47, -4 },
+    { 52, -1 },
+    { 56, -1 },
+    { 70, -2 },
+    { 72, -2 },
+    { 78, 1 },
+    { 86, -1 },
+    { 101, 1 },
+    { 107, -4 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 22, -2 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 41, -2 },
+    { 48, -1 },
+    { 60, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 69, 1 },
+    { 71, -2 },
+    { 72, 1 },
+    { 73, 1 },
+    { 77, -1 },
+    { 79, -3 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, -2 },
+    { 101, -3 },
+    { 104, -2 },
+    { 105, -2 },
+    { 106, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 47, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 77, 1 },
+    { 79, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 23, -1 },
+    { 26, -3 },
+    { 28, -3 },
+    { 29, -1 },
+    { 30, -2 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -3 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 47, -4 },
+    { 48, -1 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 62, -1 },
+    { 63, -3 },
+    { 64, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 77, -1 },
+    { 82, -3 },
+    { 84, -1 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -2 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 95, -3 },
+    { 97, -3 },
+    { 99, 1 },
+    { 106, -1 },
+    { 107, -4 },
+    { 110, -1 },
+    { 22, -1 },
+    { 104, -1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -1 },
+    { 8, 1 },
+    { 11, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -3 },
+    { 24, -3 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 44, -1 },
+    { 47, 1 },
+    { 111, -3 },
+    { 112, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 33, 1 },
+    { 47, -1 },
+    { 52, 1 },
+    { 56, 1 },
+    { 6, -1 },
+    { 14, -1 },
+    { 36, -1 },
+    { 48, -1 },
+    { 63, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 37, 1 },
+    { 47, -2 },
+    { 49, -1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 12, -3 },
+    { 16, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 42, -1 },
+    { 47, -3 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 47, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 28, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 41, -2 },
+    { 48, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 60, 1 },
+    { 4, -1 },
+    { 12, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 24, -3 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 12, 1 },
+    { 18, -1 },
+    { 21, 1 },
+    { 22, -1 },
+    { 47, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 111, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 12, -1 },
+    { 26, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 12, -3 },
+    { 18, 1 },
+    { 30, -1 },
+    { 33, 1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 47, -4 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 63, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 3, 1 },
+    { 5, 1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 12, -1 },
+    { 15, 3 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 25, 1 },
+    { 30, 1 },
+    { 33, 3 },
+    { 37, 1 },
+    { 41, 2 },
+    { 43, 2 },
+    { 47, -2 },
+    { 49, -1 },
+    { 60, 3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 47, 1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 30, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 47, -1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 16, -1 },
+    { 26, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 36, -2 },
+    { 42, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 47, -3 },
+    { 48, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 12, -2 },
+    { 26, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 40, -1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 47, -2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 28, -2 },
+    { 29, -1 },
+    { 30, -3 },
+    { 31, 1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 47, -4 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -2 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 21, 1 },
+    { 27, 1 },
+    { 31, 1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 47, 1 },
+    { 48, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -3 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 28, -2 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, 1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 47, -3 },
+    { 48, -1 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 54, 1 },
+    { 55, 2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 112, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 15, 1 },
+    { 33, 1 },
+    { 41, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 69, 1 },
+    { 92, 1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 14, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 22, -2 },
+    { 28, -1 },
+    { 30, 1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 71, -1 },
+    { 79, -3 },
+    { 86, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 101, -3 },
+    { 104, -2 },
+    { 105, -2 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 8, -1 },
+    { 24, -2 },
+    { 61, 1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -2 },
+    { 112, 1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 61, 1 },
+    { 111, -1 },
+    { 1, 2 },
+    { 2, 3 },
+    { 3, 3 },
+    { 4, 3 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 11, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 32, 1 },
+    { 33, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 43, 3 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, 3 },
+    { 54, 2 },
+    { 55, 4 },
+    { 57, 1 },
+    { 59, 3 },
+    { 60, 3 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 111, 2 },
+    { 112, 3 },
+    { 2, 1 },
+    { 4, 1 },
+    { 24, -1 },
+    { 33, 1 },
+    { 37, 1 },
+    { 60, 1 },
+    { 112, 1 },
+    { 4, -1 },
+    { 24, -3 },
+    { 39, -2 },
+    { 41, -2 },
+    { 111, -1 },
+    { 112, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 30, -1 },
+    { 24, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 52, -1 },
+    { 11, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -1 },
+    { 33, 2 },
+    { 39, -1 },
+    { 41, 1 },
+    { 60, 2 },
+    { 111, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 11, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 111, -1 },
+    { 24, -1 },
+    { 112, 1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 24, -1 },
+    { 15, 2 },
+    { 33, 1 },
+    { 39, 2 },
+    { 41, 2 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 69, 2 },
+    { 92, 2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 15, 1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 33, 1 },
+    { 69, 1 },
+    { 100, 1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 66, -1 },
+    { 79, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 47, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 87, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 31, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, 1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 101, -2 },
+    { 104, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 24, -1 },
+    { 37, 1 },
+    { 47, -2 },
+    { 49, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -3 },
+    { 11, -1 },
+    { 12, -3 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -2 },
+    { 22, -2 },
+    { 24, -2 },
+    { 25, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 47, -3 },
+    { 59, -1 },
+    { 61, -1 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 3, 1 },
+    { 4, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 27, 1 },
+    { 31, 1 },
+    { 43, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 112, 1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 8, -2 },
+    { 24, -1 },
+    { 61, 1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -1 },
+    { 8, 1 },
+    { 11, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 1 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -3 },
+    { 24, -3 },
+    { 33, 1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 44, -1 },
+    { 47, 1 },
+    { 60, 1 },
+    { 111, -3 },
+    { 112, -2 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 33, 3 },
+    { 39, -1 },
+    { 41, -1 },
+    { 60, 3 },
+    { 111, -1 },
+    { 112, -1 },
+    { 1, 1 },
+    { 3, 3 },
+    { 4, 2 },
+    { 11, 1 },
+    { 24, 2 },
+    { 25, 2 },
+    { 27, 3 },
+    { 29, 1 },
+    { 31, 3 },
+    { 32, 1 },
+    { 33, 2 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 43, 2 },
+    { 51, 1 },
+    { 53, 1 },
+    { 59, 3 },
+    { 60, 3 },
+    { 61, 3 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 111, 2 },
+    { 112, 2 },
+    { 33, 1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 33, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 111, -1 },
+    { 33, 1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 33, 2 },
+    { 39, -1 },
+    { 41, -1 },
+    { 60, 2 },
+    { 111, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 27, 1 },
+    { 30, -1 },
+    { 31, 1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 11, -1 },
+    { 29, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 53, 1 },
+    { 62, 1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -1 },
+    { 33, 1 },
+    { 112, 1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 33, 2 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 60, 2 },
+    { 111, -1 },
+    { 112, -1 },
+    { 105, -1 },
+    { 4, -1 },
+    { 24, -2 },
+    { 66, -1 },
+    { 71, -1 },
+    { 79, -2 },
+    { 92, -1 },
+    { 94, -1 },
+    { 101, -2 },
+    { 104, -2 },
+    { 105, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 105, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 107, -1 },
+    { 44, -1 },
+    { 77, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 99, 1 },
+    { 105, -1 },
+    { 106, -2 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 93, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 99, 1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -1 },
+    { 4, -1 },
+    { 6, 1 },
+    { 24, -2 },
+    { 66, -2 },
+    { 69, -1 },
+    { 71, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 79, -2 },
+    { 81, -1 },
+    { 82, 1 },
+    { 83, 1 },
+    { 85, -1 },
+    { 86, 1 },
+    { 87, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 101, -2 },
+    { 104, -3 },
+    { 105, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, -2 },
+    { 24, -4 },
+    { 66, -2 },
+    { 67, -1 },
+    { 71, -2 },
+    { 77, -1 },
+    { 79, -3 },
+    { 83, -1 },
+    { 91, -1 },
+    { 92, -2 },
+    { 94, -2 },
+    { 101, -3 },
+    { 104, -2 },
+    { 105, -2 },
+    { 106, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 44, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 71, -1 },
+    { 77, -2 },
+    { 79, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 94, -2 },
+    { 101, -1 },
+    { 104, -1 },
+    { 105, -2 },
+    { 106, -3 },
+    { 108, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 111, -1 },
+    { 5, -4 },
+    { 6, -1 },
+    { 7, -4 },
+    { 8, -3 },
+    { 44, -2 },
+    { 45, -1 },
+    { 67, -2 },
+    { 68, -1 },
+    { 70, -3 },
+    { 71, 1 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -3 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -4 },
+    { 97, -3 },
+    { 99, 2 },
+    { 101, 1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 106, -3 },
+    { 107, -5 },
+    { 108, -1 },
+    { 109, -2 },
+    { 110, -1 },
+    { 112, 1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -1 },
+    { 8, 1 },
+    { 11, -2 },
+    { 24, -3 },
+    { 44, -1 },
+    { 66, -3 },
+    { 67, -1 },
+    { 70, 1 },
+    { 71, -2 },
+    { 72, 1 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, 1 },
+    { 79, -4 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, -2 },
+    { 101, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -1 },
+    { 107, 1 },
+    { 111, -3 },
+    { 112, -2 },
+    { 66, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 95, -1 },
+    { 105, -1 },
+    { 24, -1 },
+    { 71, -1 },
+    { 79, -1 },
+    { 83, 1 },
+    { 86, 1 },
+    { 95, -1 },
+    { 100, 1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 67, -1 },
+    { 70, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 81, -2 },
+    { 82, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 88, -1 },
+    { 89, -3 },
+    { 95, -3 },
+    { 97, -2 },
+    { 99, 1 },
+    { 105, -1 },
+    { 106, -3 },
+    { 107, -3 },
+    { 109, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 77, -1 },
+    { 91, -1 },
+    { 92, 1 },
+    { 94, -1 },
+    { 100, 1 },
+    { 105, -1 },
+    { 106, -2 },
+    { 66, -1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 77, -1 },
+    { 78, 1 },
+    { 94, -1 },
+    { 99, 1 },
+    { 104, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, 1 },
+    { 111, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 24, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -2 },
+    { 2, 1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 66, 1 },
+    { 70, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -1 },
+    { 81, -1 },
+    { 85, -2 },
+    { 89, -1 },
+    { 92, 1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 107, -4 },
+    { 111, 1 },
+    { 112, 1 },
+    { 6, -1 },
+    { 67, -1 },
+    { 81, 1 },
+    { 97, -1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 65, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 76, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -2 },
+    { 4, 1 },
+    { 67, -1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, 1 },
+    { 85, 1 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, -2 },
+    { 96, 1 },
+    { 99, 1 },
+    { 105, -2 },
+    { 106, -2 },
+    { 107, 1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 89, 1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 106, -1 },
+    { 110, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 8, -1 },
+    { 24, -2 },
+    { 85, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 87, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 85, -1 },
+    { 89, -1 },
+    { 90, 1 },
+    { 95, -1 },
+    { 112, 1 },
+    { 24, -1 },
+    { 92, 1 },
+    { 100, 1 },
+    { 106, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 95, -1 },
+    { 111, -1 },
+    { 24, -1 },
+    { 44, -1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 106, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 111, -1 },
+    { 106, -1 },
+    { 24, -2 },
+    { 95, -1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 82, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -2 },
+    { 90, 1 },
+    { 92, 1 },
+    { 94, 1 },
+    { 95, -2 },
+    { 97, -1 },
+    { 98, 1 },
+    { 100, 1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 90, 1 },
+    { 106, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 4, -2 },
+    { 24, -4 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, -1 },
+    { 24, -3 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 112, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 95, -1 },
+    { 111, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 3, 1 },
+    { 4, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 43, 1 },
+    { 96, 1 },
+    { 99, 1 },
+    { 112, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 4, -1 },
+    { 24, -3 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 6, 1 },
+    { 24, -1 },
+    { 66, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 101, -1 },
+    { 104, -2 },
+    { 105, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 111, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 67, -1 },
+    { 70, -2 },
+    { 71, 1 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 82, -2 },
+    { 84, -1 },
+    { 85, -3 },
+    { 86, -2 },
+    { 87, -1 },
+    { 88, -2 },
+    { 89, -3 },
+    { 91, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -3 },
+    { 97, -2 },
+    { 104, 1 },
+    { 105, -1 },
+    { 106, -3 },
+    { 107, -5 },
+    { 109, -1 },
+    { 110, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 90, 1 },
+    { 92, 1 },
+    { 94, 1 },
+    { 95, -1 },
+    { 100, 1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -3 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -2 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 82, -2 },
+    { 84, -2 },
+    { 85, -3 },
+    { 86, -2 },
+    { 87, -1 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -3 },
+    { 97, -2 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, -4 },
+    { 109, -1 },
+    { 110, -1 },
+    { 111, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 70, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -1 },
+    { 95, -2 },
+    { 97, -1 },
+    { 99, 1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -3 },
+    { 111, 1 },
+    { 112, 1 },
+    { 44, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, 1 },
+    { 71, -1 },
+    { 72, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 91, -2 },
+    { 92, 1 },
+    { 94, -2 },
+    { 100, 1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 105, -2 },
+    { 106, -3 },
+    { 107, 1 },
+    { 109, -1 },
+    { 111, -1 },
+    { 44, -1 },
+    { 86, -1 },
+    { 92, 1 },
+    { 100, 1 },
+    { 106, -2 },
+    { 66, -1 },
+    { 71, -1 },
+    { 79, -1 },
+    { 101, -2 },
+    { 104, -2 },
+    { 105, -1 },
+    { 111, -1 },
+    { 24, -3 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 111, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -3 },
+    { 9, -1 },
+    { 10, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -2 },
+    { 71, 1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 81, -2 },
+    { 82, -2 },
+    { 84, -1 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -2 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, 1 },
+    { 97, -2 },
+    { 99, 2 },
+    { 101, 1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 106, -2 },
+    { 107, -3 },
+    { 109, -1 },
+    { 110, -1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 67, -1 },
+    { 69, 2 },
+    { 70, 1 },
+    { 72, 1 },
+    { 73, 1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, 1 },
+    { 81, 1 },
+    { 85, 1 },
+    { 87, 1 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, 1 },
+    { 93, 1 },
+    { 94, -2 },
+    { 95, 1 },
+    { 96, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 2 },
+    { 103, 1 },
+    { 105, -2 },
+    { 106, -2 },
+    { 107, 1 },
+    { 4, 1 },
+    { 90, 1 },
+    { 100, 2 },
+    { 106, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 24, -4 },
+    { 66, -3 },
+    { 67, -1 },
+    { 71, -2 },
+    { 77, -1 },
+    { 79, -3 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 101, -3 },
+    { 104, -3 },
+    { 105, -1 },
+    { 106, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 81, -1 },
+    { 74, -1 },
+    { 105, -1 },
+    { 91, -1 },
+    { 106, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 82, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 106, -1 },
+    { 11, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 74, -1 },
+    { 95, -1 },
+    { 4, 1 },
+    { 67, -1 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 85, 1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, -2 },
+    { 96, 1 },
+    { 97, -1 },
+    { 99, 1 },
+    { 105, -2 },
+    { 106, -3 },
+    { 107, 1 },
+    { 109, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 12, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 27, 1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 31, 1 },
+    { 36, -1 },
+    { 46, -3 },
+    { 47, -4 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 63, -1 },
+    { 66, 1 },
+    { 70, -2 },
+    { 71, 1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 81, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 96, 1 },
+    { 97, -1 },
+    { 99, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 104, 1 },
+    { 107, -4 },
+    { 5, -2 },
+    { 7, -2 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -2 },
+    { 36, -2 },
+    { 42, -1 },
+    { 47, -5 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 95, -2 },
+    { 97, -2 },
+    { 99, 1 },
+    { 101, 1 },
+    { 104, 1 },
+    { 106, -1 },
+    { 107, -5 },
+};
+
 static const EpdFontData bookerly_14_regular = {
     bookerly_14_regularBitmaps,
     bookerly_14_regularGlyphs,
@@ -4731,4 +6656,8 @@ static const EpdFontData bookerly_14_regular = {
     31,
     -8,
     true,
+    bookerly_14_regularKernLeftClasses,
+    bookerly_14_regularKernRightClasses,
+    bookerly_14_regularKernPairOffsets,
+    bookerly_14_regularKernPairs,
 };
@@ -5546,7 +5546,7 @@ static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 11, 26, 11, 1, 25, 72, 0 }, // !
@@ -6336,6 +6336,2282 @@ static const EpdUnicodeInterval bookerly_16_bolditalicIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_16_bolditalicKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 3, 4, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    6, 0, 0, 0, 0, 0, 7, 8, 9, 10, 11, 12, 13, 14, 14, 15,
+    16, 17, 18, 19, 10, 20, 21, 22, 23, 24, 25, 26, 26, 27, 28, 29,
+    30, 31, 0, 0, 0, 0, 32, 33, 34, 35, 36, 37, 38, 39, 35, 40,
+    41, 42, 39, 39, 33, 33, 43, 44, 45, 46, 32, 47, 47, 48, 47, 49,
+    50, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52,
+    0, 0, 0, 53, 7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11,
+    14, 14, 14, 14, 10, 19, 10, 10, 10, 10, 10, 0, 10, 25, 25, 25,
+    25, 28, 54, 55, 32, 32, 32, 32, 32, 32, 36, 56, 36, 36, 36, 36,
+    35, 57, 58, 58, 33, 39, 33, 33, 33, 33, 33, 0, 59, 32, 32, 32,
+    32, 47, 33, 47, 7, 32, 7, 32, 60, 61, 9, 34, 9, 34, 9, 34,
+    9, 34, 10, 62, 10, 35, 11, 36, 11, 36, 11, 36, 63, 64, 11, 36,
+    13, 38, 13, 38, 13, 38, 13, 38, 14, 39, 65, 39, 14, 58, 14, 58,
+    14, 58, 66, 67, 14, 32, 15, 40, 15, 68, 16, 41, 69, 17, 42, 17,
+    70, 0, 62, 0, 0, 17, 71, 19, 39, 19, 39, 19, 39, 39, 19, 40,
+    10, 33, 10, 33, 10, 33, 11, 36, 22, 44, 22, 44, 22, 44, 23, 45,
+    23, 45, 23, 72, 23, 45, 24, 73, 24, 0, 24, 46, 25, 32, 25, 32,
+    25, 32, 25, 32, 25, 32, 25, 61, 26, 47, 28, 47, 28, 29, 49, 29,
+    49, 29, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 74, 74, 75, 0, 76, 77, 78, 78, 79, 80, 80,
+    81, 82, 78, 83, 78, 84, 85, 86, 87, 88, 74, 82, 86, 78, 78, 82,
+    78, 89, 78, 90, 78, 91, 92, 87, 83, 93, 94, 88, 78, 78, 88, 80,
+    78, 80, 90, 90, 78, 95, 96, 97, 98, 99, 100, 101, 97, 95, 95, 102,
+    95, 95, 95, 103, 104, 103, 105, 104, 106, 99, 107, 108, 95, 95, 108, 109,
+    95, 110, 103, 103, 95, 100, 100, 111, 98, 105, 112, 113, 114, 115, 110, 110,
+    104, 102, 95, 106, 95, 116, 110, 90, 103, 117, 118, 88, 108, 80, 110, 91,
+    103, 119, 120, 121, 98, 0, 0, 122, 123, 86, 97, 124, 123, 82, 102, 82,
+    102, 82, 102, 88, 108, 0, 0, 0, 0, 125, 126, 92, 105, 87, 108, 127,
+    128, 127, 128, 129, 130, 88, 108, 88, 108, 78, 95, 131, 104, 132, 100, 132,
+    100, 78, 82, 101, 133, 134, 88, 108, 79, 115, 88, 108, 78, 0, 88, 108,
+    135, 84, 95, 84, 95, 74, 100, 74, 100, 90, 103, 90, 103, 82, 101, 86,
+    97, 136, 137, 78, 95, 78, 95, 90, 103, 90, 103, 90, 103, 90, 103, 83,
+    106, 83, 106, 83, 106, 78, 95, 87, 98, 78, 95, 121, 98, 138, 139, 94,
+    107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 4, 4, 4, 0, 0, 140, 141, 142, 140, 140, 141, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_16_bolditalicKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4,
+    0, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    10, 0, 0, 0, 11, 0, 12, 13, 14, 13, 15, 15, 14, 15, 15, 16,
+    15, 15, 17, 15, 14, 13, 14, 13, 1, 18, 19, 20, 20, 21, 22, 23,
+    0, 24, 25, 0, 0, 0, 26, 27, 26, 26, 26, 28, 29, 27, 30, 31,
+    27, 27, 32, 32, 26, 32, 26, 32, 33, 34, 35, 36, 36, 37, 38, 39,
+    0, 0, 40, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 0, 0, 44, 12, 12, 12, 12, 12, 12, 45, 14, 15, 15, 15, 15,
+    15, 15, 15, 15, 13, 15, 14, 14, 14, 14, 14, 0, 14, 19, 19, 19,
+    19, 22, 15, 46, 26, 26, 26, 26, 47, 26, 26, 26, 26, 26, 26, 26,
+    48, 30, 49, 49, 26, 32, 26, 26, 26, 26, 26, 0, 50, 35, 35, 35,
+    35, 36, 51, 36, 12, 26, 12, 26, 12, 26, 14, 26, 14, 26, 14, 26,
+    14, 47, 13, 26, 13, 26, 15, 26, 15, 26, 15, 26, 15, 26, 15, 26,
+    14, 29, 14, 29, 14, 29, 14, 29, 15, 27, 15, 27, 15, 49, 15, 49,
+    15, 49, 15, 30, 15, 32, 15, 30, 16, 52, 15, 27, 32, 15, 27, 15,
+    27, 15, 27, 15, 27, 15, 53, 15, 32, 15, 32, 15, 32, 32, 15, 32,
+    14, 26, 14, 26, 14, 26, 14, 26, 13, 32, 13, 32, 13, 32, 1, 33,
+    1, 33, 1, 33, 1, 54, 18, 34, 18, 34, 18, 34, 19, 35, 19, 35,
+    19, 35, 19, 35, 19, 35, 19, 35, 20, 36, 22, 36, 22, 23, 39, 23,
+    39, 23, 55, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 56, 56, 57, 56, 58, 59, 56, 56, 60, 61, 56,
+    57, 56, 56, 62, 56, 63, 56, 64, 56, 65, 56, 66, 67, 56, 56, 56,
+    61, 68, 56, 58, 56, 64, 58, 57, 62, 69, 70, 56, 71, 56, 56, 57,
+    56, 56, 72, 56, 73, 74, 75, 74, 76, 77, 74, 78, 79, 80, 80, 81,
+    82, 83, 81, 74, 81, 84, 74, 81, 85, 74, 86, 80, 87, 80, 80, 88,
+    80, 80, 79, 81, 89, 74, 74, 90, 76, 74, 91, 92, 93, 94, 82, 81,
+    95, 81, 80, 85, 80, 57, 81, 58, 74, 96, 97, 56, 81, 98, 99, 64,
+    81, 56, 100, 56, 76, 56, 81, 66, 78, 67, 79, 56, 81, 56, 81, 0,
+    0, 57, 0, 56, 81, 56, 81, 56, 81, 58, 74, 58, 74, 57, 81, 101,
+    85, 101, 85, 70, 86, 0, 0, 71, 87, 71, 87, 56, 95, 102, 103, 102,
+    103, 56, 66, 78, 56, 81, 61, 82, 56, 81, 56, 81, 71, 87, 0, 83,
+    104, 63, 74, 63, 74, 105, 74, 56, 74, 106, 107, 0, 107, 66, 78, 67,
+    79, 108, 109, 56, 80, 56, 80, 58, 74, 58, 74, 58, 74, 0, 79, 62,
+    85, 62, 85, 62, 85, 0, 87, 56, 76, 56, 80, 56, 76, 70, 86, 70,
+    86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 0, 6, 6, 6, 0, 0, 110, 111, 7, 110, 110, 111, 7,
+    0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 1, 0, 0, 0,
+    11, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_bolditalicKernPairOffsets[143] = {
+    0, 22, 26, 76, 78, 127, 131, 156, 168, 170, 184, 187, 206, 215, 228, 244,
+    265, 276, 285, 304, 325, 344, 365, 371, 396, 416, 444, 467, 500, 506, 517, 566,
+    570, 578, 582, 586, 588, 611, 633, 641, 645, 649, 652, 660, 672, 678, 683, 690,
+    697, 703, 724, 739, 750, 772, 788, 789, 795, 802, 812, 825, 853, 860, 886, 892,
+    896, 912, 928, 935, 940, 945, 950, 958, 966, 973, 977, 995, 996, 1005, 1026, 1050,
+    1066, 1091, 1123, 1164, 1198, 1203, 1219, 1252, 1259, 1279, 1300, 1326, 1332, 1358, 1388, 1396,
+    1407, 1410, 1412, 1423, 1425, 1427, 1432, 1443, 1453, 1457, 1468, 1478, 1490, 1502, 1514, 1525,
+    1534, 1537, 1546, 1551, 1559, 1590, 1604, 1638, 1657, 1680, 1695, 1705, 1721, 1736, 1740, 1787,
+    1799, 1835, 1850, 1872, 1876, 1916, 1920, 1929, 1936, 1942, 1984, 1999, 2043, 2115, 2163,
+};
+
+static const EpdKernPair bookerly_16_bolditalicKernPairs[] = {
+    { 14, -1 },
+    { 16, 3 },
+    { 26, -1 },
+    { 27, 2 },
+    { 28, 5 },
+    { 31, 5 },
+    { 38, 3 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 2 },
+    { 53, 2 },
+    { 58, -1 },
+    { 60, 3 },
+    { 65, 1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 82, -1 },
+    { 85, 3 },
+    { 90, 2 },
+    { 94, 5 },
+    { 95, 2 },
+    { 97, 3 },
+    { 12, -1 },
+    { 45, -3 },
+    { 63, -1 },
+    { 105, -3 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 4 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 31, 4 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -1 },
+    { 45, 1 },
+    { 48, -1 },
+    { 56, 1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 60, 4 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 69, -1 },
+    { 70, 1 },
+    { 71, -3 },
+    { 73, 2 },
+    { 75, -1 },
+    { 80, -1 },
+    { 85, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 92, -1 },
+    { 94, 4 },
+    { 96, -3 },
+    { 97, -2 },
+    { 99, -1 },
+    { 101, -2 },
+    { 102, -4 },
+    { 103, -1 },
+    { 105, 1 },
+    { 110, -3 },
+    { 111, -3 },
+    { 22, -1 },
+    { 101, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -2 },
+    { 26, -3 },
+    { 27, 1 },
+    { 28, -2 },
+    { 29, -3 },
+    { 32, -1 },
+    { 33, -3 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 45, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -3 },
+    { 55, -2 },
+    { 58, -1 },
+    { 61, -1 },
+    { 63, -3 },
+    { 65, -2 },
+    { 68, -2 },
+    { 69, -1 },
+    { 73, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -2 },
+    { 79, -2 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -1 },
+    { 86, -2 },
+    { 88, -1 },
+    { 89, -3 },
+    { 90, 1 },
+    { 91, -3 },
+    { 95, 1 },
+    { 100, -2 },
+    { 103, -2 },
+    { 105, -4 },
+    { 107, -2 },
+    { 109, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 85, 1 },
+    { 97, 1 },
+    { 4, -2 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 17, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -2 },
+    { 24, -5 },
+    { 29, 1 },
+    { 30, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -1 },
+    { 45, 2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 110, -3 },
+    { 111, -3 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 24, -1 },
+    { 29, -1 },
+    { 45, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -2 },
+    { 45, -1 },
+    { 46, -1 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 42, -1 },
+    { 45, -3 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 111, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 12, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 110, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 34, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -1 },
+    { 13, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 27, 1 },
+    { 45, -1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 21, 2 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 4, -2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -2 },
+    { 24, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 110, -2 },
+    { 111, -1 },
+    { 12, 1 },
+    { 17, 1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, 2 },
+    { 24, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 110, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 12, -1 },
+    { 21, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -4 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 45, -5 },
+    { 47, -1 },
+    { 50, -1 },
+    { 54, -1 },
+    { 3, 6 },
+    { 5, 6 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, 6 },
+    { 12, -1 },
+    { 16, 3 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -2 },
+    { 25, 7 },
+    { 29, 1 },
+    { 31, 2 },
+    { 40, 6 },
+    { 45, -1 },
+    { 46, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 12, 2 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 17, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, 2 },
+    { 22, -2 },
+    { 24, -3 },
+    { 28, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -1 },
+    { 45, 2 },
+    { 110, -2 },
+    { 111, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 18, -1 },
+    { 24, -1 },
+    { 4, 3 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 45, -3 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 110, 1 },
+    { 111, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 4, 1 },
+    { 5, -4 },
+    { 6, -1 },
+    { 7, -4 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -4 },
+    { 13, 1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 22, 1 },
+    { 24, 2 },
+    { 26, -2 },
+    { 27, 2 },
+    { 29, -2 },
+    { 33, -2 },
+    { 37, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -5 },
+    { 47, -2 },
+    { 49, 1 },
+    { 50, -2 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 2 },
+    { 54, -2 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 21, 2 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 35, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 2, 1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, 1 },
+    { 14, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 2 },
+    { 22, 1 },
+    { 24, 2 },
+    { 26, -1 },
+    { 27, 2 },
+    { 28, -1 },
+    { 29, -2 },
+    { 32, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -3 },
+    { 47, -1 },
+    { 49, 2 },
+    { 50, -1 },
+    { 51, 2 },
+    { 53, 2 },
+    { 54, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 16, 2 },
+    { 27, 2 },
+    { 28, 2 },
+    { 31, 3 },
+    { 38, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 60, 2 },
+    { 90, 2 },
+    { 94, 3 },
+    { 95, 2 },
+    { 12, 2 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 4 },
+    { 17, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 2 },
+    { 22, -3 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 3 },
+    { 31, 1 },
+    { 36, -2 },
+    { 37, 1 },
+    { 38, -2 },
+    { 39, 1 },
+    { 45, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 56, 1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 60, 4 },
+    { 61, 2 },
+    { 63, 2 },
+    { 64, 1 },
+    { 65, 3 },
+    { 66, 2 },
+    { 68, 1 },
+    { 69, -1 },
+    { 70, 2 },
+    { 71, -3 },
+    { 73, 2 },
+    { 85, -2 },
+    { 86, 1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 90, 1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 96, -3 },
+    { 97, -2 },
+    { 101, -3 },
+    { 102, -2 },
+    { 105, 1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 110, -1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 53, 1 },
+    { 110, -1 },
+    { 24, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 111, 1 },
+    { 8, 1 },
+    { 24, 1 },
+    { 33, 1 },
+    { 54, 1 },
+    { 24, -2 },
+    { 29, -1 },
+    { 3, 1 },
+    { 4, 3 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 11, 1 },
+    { 24, 4 },
+    { 25, 2 },
+    { 26, -1 },
+    { 27, 3 },
+    { 29, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, 2 },
+    { 47, -1 },
+    { 48, 2 },
+    { 49, 3 },
+    { 50, -1 },
+    { 51, 3 },
+    { 52, 1 },
+    { 53, 3 },
+    { 110, 1 },
+    { 111, 2 },
+    { 2, 1 },
+    { 4, 1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 4 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 2 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 55, 1 },
+    { 110, 2 },
+    { 111, 2 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -3 },
+    { 33, 1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 54, 1 },
+    { 110, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 31, 1 },
+    { 8, 1 },
+    { 24, -1 },
+    { 29, 1 },
+    { 50, 1 },
+    { 8, 1 },
+    { 33, 1 },
+    { 54, 1 },
+    { 3, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 28, 3 },
+    { 29, 1 },
+    { 31, 4 },
+    { 38, 2 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 32, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 111, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 111, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 24, -2 },
+    { 32, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 50, 1 },
+    { 111, 1 },
+    { 3, -1 },
+    { 24, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 50, 1 },
+    { 111, 1 },
+    { 16, 2 },
+    { 26, -1 },
+    { 27, 2 },
+    { 28, 2 },
+    { 31, 4 },
+    { 33, -1 },
+    { 38, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 2 },
+    { 53, 2 },
+    { 54, -1 },
+    { 60, 2 },
+    { 74, -1 },
+    { 77, -1 },
+    { 85, 1 },
+    { 90, 2 },
+    { 91, -1 },
+    { 94, 4 },
+    { 95, 2 },
+    { 97, 1 },
+    { 16, 3 },
+    { 20, -2 },
+    { 22, -1 },
+    { 27, -1 },
+    { 28, 2 },
+    { 31, 2 },
+    { 46, 2 },
+    { 51, -1 },
+    { 53, -1 },
+    { 60, 3 },
+    { 90, -1 },
+    { 94, 2 },
+    { 95, -1 },
+    { 96, -2 },
+    { 101, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 57, -1 },
+    { 69, 1 },
+    { 71, -1 },
+    { 96, -1 },
+    { 101, -1 },
+    { 106, 1 },
+    { 16, 4 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 4 },
+    { 46, 4 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 60, 4 },
+    { 74, -1 },
+    { 77, -1 },
+    { 90, -1 },
+    { 94, 4 },
+    { 95, -1 },
+    { 96, -1 },
+    { 101, -1 },
+    { 3, -2 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 24, -3 },
+    { 45, -2 },
+    { 110, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 111, 1 },
+    { 8, 1 },
+    { 24, 1 },
+    { 27, 1 },
+    { 33, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 3, 1 },
+    { 4, 2 },
+    { 11, 1 },
+    { 24, 3 },
+    { 27, 3 },
+    { 40, 1 },
+    { 49, 2 },
+    { 51, 3 },
+    { 53, 3 },
+    { 111, 1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 53, 1 },
+    { 110, -1 },
+    { 4, -2 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 5 },
+    { 17, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -2 },
+    { 24, -5 },
+    { 28, 4 },
+    { 29, 2 },
+    { 30, -1 },
+    { 31, 5 },
+    { 32, -1 },
+    { 34, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -1 },
+    { 45, 2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 110, -3 },
+    { 111, -3 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 28, 5 },
+    { 29, 1 },
+    { 31, 5 },
+    { 110, -1 },
+    { 3, 3 },
+    { 4, 4 },
+    { 11, 3 },
+    { 24, 4 },
+    { 25, 2 },
+    { 27, 4 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 2 },
+    { 31, 2 },
+    { 32, 2 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 3 },
+    { 47, 1 },
+    { 48, 2 },
+    { 51, 4 },
+    { 53, 4 },
+    { 54, 1 },
+    { 55, 2 },
+    { 110, 2 },
+    { 111, 3 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 16, 3 },
+    { 28, 3 },
+    { 31, 4 },
+    { 24, -2 },
+    { 28, 3 },
+    { 29, -1 },
+    { 31, 3 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 32, 1 },
+    { 35, 1 },
+    { 36, 2 },
+    { 38, 2 },
+    { 42, -1 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 16, 4 },
+    { 26, -1 },
+    { 27, 1 },
+    { 28, 4 },
+    { 31, 4 },
+    { 34, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 8, 1 },
+    { 24, 1 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 4 },
+    { 33, 1 },
+    { 54, 1 },
+    { 11, 2 },
+    { 27, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 111, 2 },
+    { 5, 1 },
+    { 7, 1 },
+    { 24, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 8, 1 },
+    { 28, 2 },
+    { 31, 2 },
+    { 33, 1 },
+    { 54, 1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 111, 1 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 103, -1 },
+    { 24, -2 },
+    { 57, -1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 70, 1 },
+    { 71, -2 },
+    { 73, 1 },
+    { 85, -1 },
+    { 94, 2 },
+    { 96, -2 },
+    { 97, -1 },
+    { 101, -1 },
+    { 102, -1 },
+    { 110, -1 },
+    { 69, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 57, -1 },
+    { 78, -1 },
+    { 101, -1 },
+    { 109, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 90, 1 },
+    { 95, 1 },
+    { 100, -1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 107, -1 },
+    { 109, -1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 24, 1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 63, -1 },
+    { 64, 1 },
+    { 65, -1 },
+    { 70, 1 },
+    { 73, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -1 },
+    { 90, 1 },
+    { 93, 1 },
+    { 95, 1 },
+    { 100, -1 },
+    { 103, -1 },
+    { 105, -1 },
+    { 109, -1 },
+    { 3, -2 },
+    { 4, -2 },
+    { 24, -3 },
+    { 57, -2 },
+    { 62, -1 },
+    { 71, -3 },
+    { 73, 1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 96, -3 },
+    { 97, -1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 109, -1 },
+    { 110, -2 },
+    { 111, -2 },
+    { 4, -1 },
+    { 24, -3 },
+    { 57, -4 },
+    { 58, -1 },
+    { 62, -1 },
+    { 69, -2 },
+    { 70, 1 },
+    { 71, -4 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 84, -1 },
+    { 85, -2 },
+    { 87, -3 },
+    { 88, -1 },
+    { 96, -4 },
+    { 97, -2 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -2 },
+    { 109, -2 },
+    { 110, -3 },
+    { 111, -2 },
+    { 4, 1 },
+    { 6, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 58, -1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 65, 2 },
+    { 66, 1 },
+    { 68, 1 },
+    { 69, -1 },
+    { 70, 2 },
+    { 72, -1 },
+    { 73, 1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 90, 1 },
+    { 91, -1 },
+    { 95, 1 },
+    { 97, -1 },
+    { 103, -3 },
+    { 105, 1 },
+    { 107, -1 },
+    { 109, -1 },
+    { 4, 3 },
+    { 5, -4 },
+    { 7, -4 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 24, 2 },
+    { 43, -1 },
+    { 57, 1 },
+    { 61, -3 },
+    { 63, -4 },
+    { 64, 1 },
+    { 65, -3 },
+    { 69, -1 },
+    { 70, 1 },
+    { 71, 1 },
+    { 73, -2 },
+    { 74, -2 },
+    { 78, -2 },
+    { 79, -2 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -5 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -3 },
+    { 90, 2 },
+    { 91, -2 },
+    { 93, 1 },
+    { 95, 2 },
+    { 96, 1 },
+    { 100, -1 },
+    { 101, 1 },
+    { 103, -3 },
+    { 105, -6 },
+    { 107, -1 },
+    { 109, -1 },
+    { 111, 2 },
+    { 4, -2 },
+    { 11, -1 },
+    { 24, -5 },
+    { 42, -1 },
+    { 56, 1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 66, 2 },
+    { 68, 1 },
+    { 69, -1 },
+    { 70, 2 },
+    { 71, -4 },
+    { 73, 1 },
+    { 75, -1 },
+    { 81, -1 },
+    { 84, -1 },
+    { 85, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 96, -4 },
+    { 97, -2 },
+    { 101, -3 },
+    { 102, -4 },
+    { 103, -2 },
+    { 105, 2 },
+    { 109, -1 },
+    { 110, -3 },
+    { 111, -3 },
+    { 57, -1 },
+    { 62, -1 },
+    { 71, -1 },
+    { 96, -1 },
+    { 109, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 57, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -1 },
+    { 71, -1 },
+    { 78, -1 },
+    { 96, -2 },
+    { 101, -2 },
+    { 102, -1 },
+    { 105, -1 },
+    { 109, -1 },
+    { 4, 3 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 42, -1 },
+    { 61, -2 },
+    { 63, -3 },
+    { 64, 1 },
+    { 65, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 85, 1 },
+    { 89, -2 },
+    { 90, 1 },
+    { 91, -1 },
+    { 93, 1 },
+    { 95, 1 },
+    { 97, 1 },
+    { 101, 1 },
+    { 103, -3 },
+    { 105, -3 },
+    { 107, -1 },
+    { 109, -1 },
+    { 110, 1 },
+    { 111, 1 },
+    { 60, 3 },
+    { 66, 1 },
+    { 68, 2 },
+    { 70, 1 },
+    { 85, 2 },
+    { 94, 3 },
+    { 97, 2 },
+    { 24, -1 },
+    { 42, -1 },
+    { 57, -1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 66, 2 },
+    { 68, 1 },
+    { 69, -1 },
+    { 70, 1 },
+    { 71, -1 },
+    { 73, 1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 96, -1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 105, 1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 57, -1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -1 },
+    { 89, -1 },
+    { 96, -1 },
+    { 101, -2 },
+    { 105, -1 },
+    { 109, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 24, -1 },
+    { 56, -1 },
+    { 61, -2 },
+    { 62, -1 },
+    { 63, -3 },
+    { 65, -2 },
+    { 66, -1 },
+    { 68, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 85, 1 },
+    { 89, -2 },
+    { 91, -1 },
+    { 96, -1 },
+    { 97, 1 },
+    { 101, -1 },
+    { 103, -1 },
+    { 105, -5 },
+    { 9, -1 },
+    { 10, -1 },
+    { 69, -1 },
+    { 96, -1 },
+    { 103, -1 },
+    { 109, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 56, -1 },
+    { 57, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 89, -1 },
+    { 96, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 105, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 58, -1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 68, 2 },
+    { 69, -1 },
+    { 70, 2 },
+    { 71, 1 },
+    { 73, 1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 87, -1 },
+    { 90, 1 },
+    { 93, 1 },
+    { 95, 1 },
+    { 101, 1 },
+    { 102, -1 },
+    { 103, -2 },
+    { 105, 1 },
+    { 109, -1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 87, -1 },
+    { 88, -1 },
+    { 103, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 2 },
+    { 82, -1 },
+    { 83, -1 },
+    { 97, 1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 24, -4 },
+    { 109, -1 },
+    { 110, -1 },
+    { 24, -1 },
+    { 97, 1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 97, 1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 24, -2 },
+    { 97, 1 },
+    { 24, -3 },
+    { 97, 1 },
+    { 5, 1 },
+    { 7, 1 },
+    { 24, -2 },
+    { 85, 1 },
+    { 97, 1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 82, -1 },
+    { 83, -1 },
+    { 97, 1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -3 },
+    { 79, 1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 91, 1 },
+    { 97, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 24, -1 },
+    { 85, 1 },
+    { 97, 1 },
+    { 111, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 89, -1 },
+    { 97, 1 },
+    { 100, -1 },
+    { 24, -2 },
+    { 80, 1 },
+    { 81, 1 },
+    { 84, 1 },
+    { 85, 1 },
+    { 87, 1 },
+    { 97, 2 },
+    { 104, 1 },
+    { 109, -1 },
+    { 111, 1 },
+    { 3, 2 },
+    { 8, 1 },
+    { 24, -3 },
+    { 25, 1 },
+    { 40, 1 },
+    { 84, 1 },
+    { 85, 4 },
+    { 87, -1 },
+    { 94, 6 },
+    { 97, 4 },
+    { 103, -1 },
+    { 109, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 85, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 97, -1 },
+    { 99, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 111, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -4 },
+    { 85, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 97, -1 },
+    { 99, -1 },
+    { 109, -1 },
+    { 110, -2 },
+    { 111, -1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -3 },
+    { 79, 1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 91, 1 },
+    { 94, 1 },
+    { 97, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 97, 1 },
+    { 103, -1 },
+    { 109, -1 },
+    { 8, 1 },
+    { 24, 1 },
+    { 91, 1 },
+    { 3, 1 },
+    { 4, 2 },
+    { 11, 1 },
+    { 24, 3 },
+    { 40, 1 },
+    { 90, 3 },
+    { 93, 2 },
+    { 95, 3 },
+    { 111, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 82, -1 },
+    { 94, 1 },
+    { 24, -2 },
+    { 57, -2 },
+    { 61, 1 },
+    { 62, -1 },
+    { 71, -1 },
+    { 96, -2 },
+    { 101, -2 },
+    { 102, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 42, -1 },
+    { 58, -1 },
+    { 61, -2 },
+    { 62, 1 },
+    { 63, -4 },
+    { 65, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, 1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -4 },
+    { 83, -2 },
+    { 86, -1 },
+    { 89, -3 },
+    { 91, -2 },
+    { 100, -1 },
+    { 103, -3 },
+    { 105, -5 },
+    { 107, -1 },
+    { 109, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 74, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, 1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, 1 },
+    { 85, 1 },
+    { 89, -2 },
+    { 91, -1 },
+    { 97, 1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -2 },
+    { 61, -2 },
+    { 62, 1 },
+    { 63, -3 },
+    { 65, -2 },
+    { 69, -2 },
+    { 71, 1 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -3 },
+    { 79, -3 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -1 },
+    { 87, -1 },
+    { 88, -2 },
+    { 89, -1 },
+    { 91, -1 },
+    { 100, -2 },
+    { 103, -3 },
+    { 105, -4 },
+    { 107, -1 },
+    { 109, -1 },
+    { 111, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 42, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -3 },
+    { 83, -1 },
+    { 85, 1 },
+    { 89, -2 },
+    { 91, -1 },
+    { 97, 1 },
+    { 100, -1 },
+    { 103, -1 },
+    { 107, -1 },
+    { 109, -1 },
+    { 111, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 61, -1 },
+    { 63, -3 },
+    { 65, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 82, -3 },
+    { 83, -1 },
+    { 89, -2 },
+    { 90, 1 },
+    { 91, -1 },
+    { 93, 1 },
+    { 95, 1 },
+    { 97, 2 },
+    { 103, -2 },
+    { 105, -3 },
+    { 111, 2 },
+    { 56, 1 },
+    { 60, 4 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 2 },
+    { 68, 1 },
+    { 69, -1 },
+    { 70, 2 },
+    { 73, 1 },
+    { 85, 2 },
+    { 97, 2 },
+    { 98, 1 },
+    { 105, 2 },
+    { 3, 1 },
+    { 8, 1 },
+    { 25, 1 },
+    { 40, 1 },
+    { 84, 1 },
+    { 85, 4 },
+    { 94, 6 },
+    { 97, 4 },
+    { 104, 1 },
+    { 109, 1 },
+    { 56, 1 },
+    { 60, 4 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 2 },
+    { 68, 1 },
+    { 69, -1 },
+    { 70, 2 },
+    { 73, 1 },
+    { 85, 2 },
+    { 94, 4 },
+    { 97, 2 },
+    { 98, 1 },
+    { 105, 2 },
+    { 24, -2 },
+    { 56, 1 },
+    { 57, -1 },
+    { 61, 2 },
+    { 63, 2 },
+    { 65, 2 },
+    { 66, 1 },
+    { 68, 1 },
+    { 70, 2 },
+    { 71, -1 },
+    { 73, 2 },
+    { 96, -2 },
+    { 98, 1 },
+    { 101, -2 },
+    { 105, 2 },
+    { 24, -4 },
+    { 87, -1 },
+    { 88, -1 },
+    { 110, -1 },
+    { 2, 1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 2 },
+    { 42, -1 },
+    { 43, -1 },
+    { 57, 1 },
+    { 58, -1 },
+    { 61, -2 },
+    { 62, 1 },
+    { 63, -3 },
+    { 64, 1 },
+    { 65, -2 },
+    { 69, -1 },
+    { 70, 2 },
+    { 71, 1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -3 },
+    { 90, 1 },
+    { 91, -1 },
+    { 93, 2 },
+    { 95, 2 },
+    { 96, 1 },
+    { 100, -1 },
+    { 101, 1 },
+    { 103, -3 },
+    { 105, -3 },
+    { 107, -2 },
+    { 109, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 89, -1 },
+    { 94, 1 },
+    { 97, 1 },
+    { 100, -1 },
+    { 4, 1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 42, -1 },
+    { 56, 2 },
+    { 58, -1 },
+    { 60, 5 },
+    { 61, 2 },
+    { 63, 2 },
+    { 64, 1 },
+    { 65, 2 },
+    { 66, 3 },
+    { 68, 2 },
+    { 69, -1 },
+    { 70, 3 },
+    { 71, 1 },
+    { 73, 2 },
+    { 74, -1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 85, 3 },
+    { 87, -1 },
+    { 90, 1 },
+    { 93, 1 },
+    { 94, 5 },
+    { 95, 1 },
+    { 97, 3 },
+    { 98, 1 },
+    { 101, 1 },
+    { 102, -1 },
+    { 103, -2 },
+    { 104, 1 },
+    { 105, 2 },
+    { 109, 1 },
+    { 3, 1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 25, 1 },
+    { 40, 1 },
+    { 80, 1 },
+    { 81, 1 },
+    { 84, 1 },
+    { 85, 4 },
+    { 87, 1 },
+    { 94, 6 },
+    { 97, 2 },
+    { 104, 1 },
+    { 109, 2 },
+    { 111, 1 },
+    { 4, -4 },
+    { 24, -4 },
+    { 57, -4 },
+    { 58, -1 },
+    { 62, -2 },
+    { 69, -1 },
+    { 70, 1 },
+    { 71, -4 },
+    { 80, -1 },
+    { 81, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 96, -4 },
+    { 97, -1 },
+    { 99, -1 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -1 },
+    { 109, -2 },
+    { 111, -2 },
+    { 63, -1 },
+    { 71, -1 },
+    { 96, -1 },
+    { 101, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 43, -1 },
+    { 56, -1 },
+    { 58, -2 },
+    { 59, -1 },
+    { 61, -1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 69, -2 },
+    { 70, -1 },
+    { 72, -1 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 89, -2 },
+    { 91, -2 },
+    { 97, -1 },
+    { 100, -2 },
+    { 102, -1 },
+    { 103, -2 },
+    { 105, -1 },
+    { 106, -2 },
+    { 107, -1 },
+    { 108, -1 },
+    { 109, -2 },
+    { 24, -2 },
+    { 85, 1 },
+    { 94, 3 },
+    { 97, 1 },
+    { 6, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 84, -1 },
+    { 88, -1 },
+    { 103, -1 },
+    { 109, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 63, -1 },
+    { 78, -1 },
+    { 82, -1 },
+    { 109, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 85, 2 },
+    { 94, 3 },
+    { 97, 2 },
+    { 103, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 58, -1 },
+    { 60, 3 },
+    { 61, -1 },
+    { 63, -1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 68, 2 },
+    { 69, -1 },
+    { 70, 2 },
+    { 71, 1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 79, -2 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 87, -1 },
+    { 89, -2 },
+    { 90, 1 },
+    { 91, -1 },
+    { 93, 1 },
+    { 94, 2 },
+    { 95, 1 },
+    { 100, -1 },
+    { 101, 1 },
+    { 102, -1 },
+    { 103, -2 },
+    { 105, 1 },
+    { 107, -2 },
+    { 109, -1 },
+    { 24, -2 },
+    { 74, -1 },
+    { 77, -1 },
+    { 80, 1 },
+    { 81, 1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, 1 },
+    { 85, 1 },
+    { 87, 1 },
+    { 89, -1 },
+    { 94, 4 },
+    { 97, 2 },
+    { 109, -1 },
+    { 111, 1 },
+    { 1, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 12, -4 },
+    { 14, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 26, -3 },
+    { 28, -1 },
+    { 29, -3 },
+    { 33, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, -2 },
+    { 44, -3 },
+    { 45, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -3 },
+    { 63, -4 },
+    { 65, -3 },
+    { 68, -1 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -1 },
+    { 77, -3 },
+    { 78, -1 },
+    { 79, -1 },
+    { 82, -5 },
+    { 83, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 91, -2 },
+    { 96, -1 },
+    { 100, -2 },
+    { 105, -4 },
+    { 107, -1 },
+    { 1, -1 },
+    { 5, -6 },
+    { 7, -6 },
+    { 11, -1 },
+    { 12, -5 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 26, -3 },
+    { 27, -1 },
+    { 28, -2 },
+    { 29, -4 },
+    { 30, -1 },
+    { 32, -1 },
+    { 33, -3 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 45, -5 },
+    { 47, -3 },
+    { 48, -1 },
+    { 50, -3 },
+    { 51, -1 },
+    { 53, -1 },
+    { 54, -3 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -4 },
+    { 63, -5 },
+    { 65, -4 },
+    { 66, -1 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -2 },
+    { 76, -1 },
+    { 77, -3 },
+    { 78, -2 },
+    { 79, -2 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -6 },
+    { 83, -3 },
+    { 84, -1 },
+    { 86, -1 },
+    { 89, -4 },
+    { 90, -1 },
+    { 91, -3 },
+    { 92, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 100, -2 },
+    { 101, -1 },
+    { 103, -2 },
+    { 104, -1 },
+    { 105, -5 },
+    { 108, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 4 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 28, 2 },
+    { 29, 1 },
+    { 30, -1 },
+    { 31, 4 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, 1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 48, -1 },
+    { 56, 1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 60, 4 },
+    { 61, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 69, -1 },
+    { 70, 1 },
+    { 71, -3 },
+    { 73, 2 },
+    { 75, -1 },
+    { 80, -1 },
+    { 87, -2 },
+    { 88, -2 },
+    { 92, -1 },
+    { 94, 4 },
+    { 96, -3 },
+    { 99, -1 },
+    { 101, -2 },
+    { 102, -4 },
+    { 103, -1 },
+    { 105, 1 },
+    { 110, -3 },
+    { 111, -3 },
+};
+
 static const EpdFontData bookerly_16_bolditalic = {
     bookerly_16_bolditalicBitmaps,
     bookerly_16_bolditalicGlyphs,
@@ -6345,4 +8621,8 @@ static const EpdFontData bookerly_16_bolditalic = {
     36,
     -9,
     true,
+    bookerly_16_bolditalicKernLeftClasses,
+    bookerly_16_bolditalicKernRightClasses,
+    bookerly_16_bolditalicKernPairOffsets,
+    bookerly_16_bolditalicKernPairs,
 };
@@ -5165,7 +5165,7 @@ static const EpdGlyph bookerly_16_italicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 10, 26, 10, 1, 25, 65, 0 }, // !
@@ -5955,6 +5955,1859 @@ static const EpdUnicodeInterval bookerly_16_italicIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_16_italicKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 3, 4, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 7, 8, 9, 10, 11, 12, 13, 13, 14,
+    15, 16, 17, 18, 9, 19, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28,
+    29, 30, 0, 0, 0, 0, 31, 32, 33, 0, 34, 35, 36, 37, 0, 38,
+    39, 0, 37, 37, 32, 32, 40, 41, 42, 43, 31, 44, 44, 45, 44, 46,
+    47, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+    0, 0, 0, 51, 6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10,
+    13, 13, 13, 13, 9, 18, 9, 9, 9, 9, 9, 0, 9, 24, 24, 24,
+    24, 27, 52, 53, 31, 31, 31, 31, 31, 31, 34, 54, 34, 34, 34, 34,
+    0, 0, 55, 55, 32, 37, 32, 32, 32, 32, 32, 0, 56, 31, 31, 31,
+    31, 44, 32, 44, 6, 31, 6, 31, 57, 58, 8, 33, 8, 33, 8, 33,
+    8, 33, 9, 59, 9, 0, 10, 34, 10, 34, 10, 34, 60, 61, 10, 34,
+    12, 36, 12, 36, 12, 36, 12, 36, 13, 37, 13, 37, 13, 55, 13, 55,
+    13, 55, 62, 63, 13, 31, 14, 38, 14, 64, 15, 39, 33, 16, 0, 16,
+    65, 0, 59, 0, 0, 16, 66, 18, 37, 18, 37, 18, 37, 37, 18, 67,
+    9, 32, 9, 32, 9, 32, 10, 34, 21, 41, 21, 41, 21, 41, 22, 42,
+    22, 42, 22, 68, 22, 42, 23, 69, 23, 0, 23, 43, 24, 31, 24, 31,
+    24, 31, 24, 31, 24, 31, 24, 70, 25, 44, 27, 44, 27, 28, 46, 28,
+    46, 28, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 71, 71, 72, 0, 73, 74, 75, 75, 76, 77, 77,
+    78, 79, 75, 80, 75, 81, 82, 83, 84, 85, 71, 79, 83, 75, 75, 79,
+    75, 86, 75, 87, 75, 88, 89, 90, 80, 91, 92, 85, 75, 75, 85, 77,
+    75, 77, 87, 87, 75, 93, 94, 95, 0, 96, 97, 98, 95, 93, 93, 33,
+    93, 93, 93, 96, 99, 96, 33, 99, 100, 96, 101, 102, 93, 93, 102, 103,
+    93, 103, 96, 96, 93, 97, 97, 104, 0, 33, 105, 0, 106, 107, 103, 103,
+    99, 33, 93, 100, 93, 108, 103, 87, 96, 109, 110, 85, 102, 77, 103, 88,
+    96, 111, 112, 113, 0, 0, 0, 114, 115, 83, 95, 114, 115, 79, 33, 79,
+    33, 79, 33, 85, 102, 0, 0, 0, 0, 116, 117, 89, 33, 84, 102, 118,
+    100, 118, 100, 119, 120, 85, 102, 85, 102, 75, 93, 121, 99, 122, 97, 122,
+    97, 75, 79, 98, 123, 124, 85, 102, 76, 107, 85, 102, 75, 0, 85, 102,
+    125, 81, 93, 81, 93, 71, 97, 71, 97, 87, 96, 87, 96, 79, 98, 83,
+    95, 126, 127, 75, 93, 75, 93, 87, 96, 87, 96, 87, 96, 87, 96, 80,
+    100, 80, 100, 80, 100, 75, 93, 84, 0, 75, 93, 113, 0, 128, 129, 92,
+    101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 4, 4, 4, 0, 0, 130, 131, 132, 130, 130, 131, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_16_italicKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+    0, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    9, 0, 0, 0, 10, 0, 11, 12, 13, 12, 14, 14, 13, 14, 14, 15,
+    14, 14, 16, 14, 13, 12, 13, 12, 17, 18, 19, 20, 20, 21, 22, 23,
+    0, 24, 25, 0, 0, 0, 26, 27, 26, 26, 26, 28, 29, 27, 30, 31,
+    27, 27, 32, 32, 26, 33, 26, 32, 34, 35, 36, 37, 37, 38, 39, 40,
+    0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 0, 0, 43, 11, 11, 11, 11, 11, 11, 44, 13, 14, 14, 14, 14,
+    14, 14, 14, 14, 12, 14, 13, 13, 13, 13, 13, 0, 13, 19, 19, 19,
+    19, 22, 14, 45, 26, 26, 26, 26, 46, 26, 26, 26, 26, 26, 26, 26,
+    47, 30, 48, 48, 26, 32, 26, 26, 26, 26, 26, 0, 49, 36, 36, 36,
+    36, 37, 50, 37, 11, 26, 11, 26, 11, 26, 13, 26, 13, 26, 13, 26,
+    13, 46, 12, 26, 12, 26, 14, 26, 14, 26, 14, 26, 14, 26, 14, 26,
+    13, 29, 13, 29, 13, 29, 13, 29, 14, 27, 14, 51, 14, 48, 14, 48,
+    14, 48, 14, 30, 14, 32, 14, 30, 15, 52, 14, 27, 32, 14, 27, 14,
+    27, 14, 27, 14, 27, 14, 53, 14, 32, 14, 32, 14, 32, 32, 14, 32,
+    13, 26, 13, 26, 13, 26, 13, 26, 12, 32, 12, 32, 12, 32, 17, 34,
+    17, 34, 17, 34, 17, 54, 18, 35, 18, 35, 18, 35, 19, 36, 19, 36,
+    19, 36, 19, 36, 19, 36, 19, 36, 20, 37, 22, 37, 22, 23, 40, 23,
+    40, 23, 55, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 56, 56, 57, 56, 58, 17, 56, 56, 59, 60, 56,
+    57, 56, 56, 61, 56, 62, 56, 63, 56, 64, 56, 65, 66, 56, 56, 56,
+    60, 67, 56, 58, 56, 63, 58, 57, 61, 68, 69, 56, 70, 56, 56, 57,
+    56, 56, 71, 56, 72, 73, 74, 73, 75, 76, 73, 77, 78, 79, 79, 80,
+    81, 82, 80, 73, 80, 80, 73, 80, 83, 73, 84, 79, 85, 79, 79, 86,
+    79, 79, 78, 80, 87, 73, 73, 88, 75, 73, 89, 90, 91, 92, 81, 80,
+    93, 80, 79, 83, 79, 57, 80, 58, 73, 94, 83, 56, 80, 0, 95, 63,
+    80, 56, 96, 56, 75, 56, 80, 65, 77, 66, 78, 56, 80, 56, 80, 0,
+    0, 57, 0, 56, 80, 56, 80, 56, 80, 58, 73, 58, 73, 57, 80, 97,
+    83, 97, 83, 69, 84, 0, 0, 70, 85, 70, 85, 56, 93, 98, 99, 98,
+    99, 56, 65, 77, 56, 80, 60, 81, 56, 80, 56, 80, 70, 85, 0, 82,
+    100, 62, 73, 62, 73, 101, 73, 56, 73, 102, 103, 0, 103, 65, 77, 66,
+    78, 104, 105, 56, 79, 56, 79, 58, 73, 58, 73, 58, 73, 0, 78, 61,
+    83, 61, 83, 61, 83, 0, 85, 56, 75, 56, 79, 56, 75, 69, 84, 69,
+    84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 106, 107, 6, 106, 106, 107, 6,
+    0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 1, 0, 0, 0,
+    10, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_italicKernPairOffsets[133] = {
+    0, 25, 29, 78, 82, 125, 152, 164, 167, 181, 187, 203, 212, 224, 233, 252,
+    263, 270, 284, 306, 326, 345, 352, 370, 387, 410, 426, 454, 458, 468, 502, 505,
+    513, 514, 519, 543, 558, 563, 565, 568, 575, 586, 591, 593, 598, 601, 607, 625,
+    640, 644, 655, 677, 693, 694, 697, 706, 717, 747, 753, 778, 787, 794, 809, 812,
+    817, 819, 826, 829, 836, 840, 846, 852, 865, 866, 873, 894, 910, 920, 936, 964,
+    999, 1033, 1034, 1049, 1078, 1080, 1089, 1104, 1134, 1139, 1169, 1195, 1221, 1226, 1235, 1238,
+    1247, 1250, 1251, 1257, 1265, 1267, 1274, 1284, 1291, 1297, 1304, 1307, 1311, 1338, 1339, 1368,
+    1383, 1403, 1409, 1412, 1418, 1422, 1463, 1491, 1498, 1513, 1516, 1518, 1520, 1521, 1528, 1533,
+    1564, 1571, 1617, 1692, 1740,
+};
+
+static const EpdKernPair bookerly_16_italicKernPairs[] = {
+    { 13, -1 },
+    { 15, 3 },
+    { 22, 1 },
+    { 26, -2 },
+    { 27, 2 },
+    { 28, 5 },
+    { 29, 2 },
+    { 31, 5 },
+    { 39, 3 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 58, -1 },
+    { 59, 3 },
+    { 61, 2 },
+    { 64, 1 },
+    { 73, -2 },
+    { 76, -2 },
+    { 81, -1 },
+    { 88, 2 },
+    { 92, 5 },
+    { 93, 2 },
+    { 97, 1 },
+    { 11, -3 },
+    { 44, -3 },
+    { 62, -3 },
+    { 101, -3 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 26, -1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, 3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 44, 1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, 2 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -3 },
+    { 72, 1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -2 },
+    { 85, -4 },
+    { 86, -2 },
+    { 92, 3 },
+    { 94, -3 },
+    { 95, -1 },
+    { 97, -2 },
+    { 98, -4 },
+    { 99, -1 },
+    { 101, 1 },
+    { 106, -3 },
+    { 107, -3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 22, -1 },
+    { 97, -1 },
+    { 11, -3 },
+    { 13, -1 },
+    { 16, -2 },
+    { 26, -3 },
+    { 28, -2 },
+    { 29, -3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -3 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -2 },
+    { 40, -2 },
+    { 44, -4 },
+    { 46, -3 },
+    { 49, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 58, -1 },
+    { 60, -1 },
+    { 62, -3 },
+    { 64, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 72, -1 },
+    { 73, -3 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -4 },
+    { 82, -2 },
+    { 84, -2 },
+    { 86, -1 },
+    { 87, -3 },
+    { 89, -3 },
+    { 96, -2 },
+    { 99, -2 },
+    { 101, -4 },
+    { 103, -2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 1 },
+    { 22, -3 },
+    { 24, -5 },
+    { 26, -1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 41, -1 },
+    { 44, 1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 106, -3 },
+    { 107, -3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 24, -1 },
+    { 44, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 20, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 26, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 26, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 41, -1 },
+    { 44, -3 },
+    { 46, -1 },
+    { 48, 1 },
+    { 49, -1 },
+    { 54, -1 },
+    { 107, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 11, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 106, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 26, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 106, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 44, -1 },
+    { 48, 1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 21, 2 },
+    { 26, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, 1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 54, -1 },
+    { 3, -2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -2 },
+    { 24, -3 },
+    { 37, -1 },
+    { 39, -1 },
+    { 106, -2 },
+    { 107, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, 1 },
+    { 24, -1 },
+    { 41, -1 },
+    { 106, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 11, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 38, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 54, -1 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 44, -4 },
+    { 46, -1 },
+    { 49, -1 },
+    { 54, -1 },
+    { 2, 8 },
+    { 4, 6 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, 6 },
+    { 15, 3 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -2 },
+    { 25, 7 },
+    { 28, 2 },
+    { 29, 3 },
+    { 31, 2 },
+    { 33, 1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 50, 1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 16, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 2 },
+    { 22, -3 },
+    { 24, -3 },
+    { 28, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, 1 },
+    { 106, -2 },
+    { 107, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 24, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 26, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 41, -1 },
+    { 44, -3 },
+    { 46, -1 },
+    { 49, -1 },
+    { 51, 1 },
+    { 54, -1 },
+    { 106, 1 },
+    { 107, 2 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -2 },
+    { 13, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 38, -1 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -1 },
+    { 49, -1 },
+    { 54, -1 },
+    { 3, 1 },
+    { 4, -4 },
+    { 5, -1 },
+    { 6, -4 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -4 },
+    { 13, -1 },
+    { 16, -1 },
+    { 24, 1 },
+    { 26, -2 },
+    { 29, -2 },
+    { 34, -2 },
+    { 38, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -4 },
+    { 46, -2 },
+    { 48, 1 },
+    { 49, -2 },
+    { 54, -2 },
+    { 107, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 16, 1 },
+    { 21, 2 },
+    { 26, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, 1 },
+    { 46, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 5, -2 },
+    { 6, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -4 },
+    { 13, -1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, -2 },
+    { 28, -1 },
+    { 29, -2 },
+    { 34, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -3 },
+    { 46, -2 },
+    { 48, 1 },
+    { 49, -2 },
+    { 51, 1 },
+    { 54, -2 },
+    { 55, -1 },
+    { 107, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 20, -1 },
+    { 24, -1 },
+    { 15, 2 },
+    { 26, -1 },
+    { 28, 2 },
+    { 31, 1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 59, 2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 92, 1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 16, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 2 },
+    { 22, -3 },
+    { 29, 3 },
+    { 37, -2 },
+    { 38, 1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 44, 1 },
+    { 55, 1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 60, 2 },
+    { 62, 1 },
+    { 64, 3 },
+    { 65, 2 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 2 },
+    { 70, -3 },
+    { 72, 2 },
+    { 83, -2 },
+    { 84, 1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 94, -3 },
+    { 97, -3 },
+    { 98, -2 },
+    { 101, 1 },
+    { 3, -1 },
+    { 24, -2 },
+    { 106, -1 },
+    { 3, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 53, 1 },
+    { 106, -1 },
+    { 24, -2 },
+    { 24, -2 },
+    { 27, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 2, 1 },
+    { 3, 2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 10, 1 },
+    { 24, 2 },
+    { 26, -1 },
+    { 27, 2 },
+    { 29, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 46, -1 },
+    { 47, 1 },
+    { 48, 2 },
+    { 49, -1 },
+    { 50, 2 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 2 },
+    { 106, 1 },
+    { 107, 2 },
+    { 3, 1 },
+    { 6, -1 },
+    { 25, 1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 31, 3 },
+    { 32, 1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 2 },
+    { 38, 1 },
+    { 39, 2 },
+    { 106, 2 },
+    { 107, 2 },
+    { 3, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 106, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 29, 1 },
+    { 49, 1 },
+    { 2, 2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 24, -2 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, 3 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 107, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 24, -1 },
+    { 107, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -2 },
+    { 24, -2 },
+    { 49, 1 },
+    { 107, 1 },
+    { 2, -1 },
+    { 24, -2 },
+    { 29, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 49, 1 },
+    { 15, 1 },
+    { 26, -1 },
+    { 28, 2 },
+    { 31, 2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 54, -1 },
+    { 59, 1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 80, -1 },
+    { 89, -1 },
+    { 92, 2 },
+    { 101, -1 },
+    { 15, 3 },
+    { 20, -2 },
+    { 22, -1 },
+    { 27, -1 },
+    { 28, 2 },
+    { 31, 2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 59, 3 },
+    { 88, -1 },
+    { 92, 2 },
+    { 93, -1 },
+    { 94, -2 },
+    { 97, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 94, -1 },
+    { 97, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 57, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 94, -1 },
+    { 97, -1 },
+    { 102, 1 },
+    { 15, 3 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, 3 },
+    { 46, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 59, 3 },
+    { 73, -1 },
+    { 76, -1 },
+    { 88, -1 },
+    { 92, 3 },
+    { 93, -1 },
+    { 94, -1 },
+    { 97, -1 },
+    { 2, -2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -2 },
+    { 11, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -2 },
+    { 22, -2 },
+    { 24, -3 },
+    { 44, -2 },
+    { 106, -1 },
+    { 24, -2 },
+    { 28, 1 },
+    { 31, 1 },
+    { 2, 1 },
+    { 3, 2 },
+    { 24, 2 },
+    { 27, 2 },
+    { 48, 1 },
+    { 50, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 107, 1 },
+    { 3, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 53, 1 },
+    { 106, -1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 4 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 1 },
+    { 22, -3 },
+    { 24, -5 },
+    { 26, -1 },
+    { 28, 4 },
+    { 29, 2 },
+    { 30, -1 },
+    { 31, 4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 41, -1 },
+    { 44, 1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 106, -3 },
+    { 107, -3 },
+    { 3, -1 },
+    { 24, -2 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 5 },
+    { 106, -1 },
+    { 2, 4 },
+    { 3, 4 },
+    { 10, 2 },
+    { 24, 3 },
+    { 25, 2 },
+    { 27, 4 },
+    { 28, 1 },
+    { 30, 2 },
+    { 31, 2 },
+    { 32, 1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 2 },
+    { 39, 2 },
+    { 40, 1 },
+    { 46, 1 },
+    { 47, 2 },
+    { 50, 4 },
+    { 51, 4 },
+    { 53, 4 },
+    { 54, 1 },
+    { 55, 2 },
+    { 106, 2 },
+    { 107, 3 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 15, 2 },
+    { 26, -1 },
+    { 28, 2 },
+    { 31, 3 },
+    { 46, -1 },
+    { 49, -1 },
+    { 24, -2 },
+    { 27, -1 },
+    { 28, 2 },
+    { 31, 2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 15, 3 },
+    { 26, -1 },
+    { 28, 3 },
+    { 31, 3 },
+    { 35, -1 },
+    { 36, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 106, -1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 31, 3 },
+    { 27, 2 },
+    { 50, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 107, 2 },
+    { 28, 1 },
+    { 31, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 2 },
+    { 39, 2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 107, 1 },
+    { 3, -1 },
+    { 24, -2 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 4 },
+    { 106, -1 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 99, -1 },
+    { 24, -2 },
+    { 57, -2 },
+    { 59, 2 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 69, 1 },
+    { 70, -1 },
+    { 85, -1 },
+    { 94, -2 },
+    { 97, -1 },
+    { 98, -1 },
+    { 106, -1 },
+    { 68, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 57, -1 },
+    { 105, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 68, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -1 },
+    { 96, -1 },
+    { 98, -1 },
+    { 99, -1 },
+    { 103, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 72, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 91, 1 },
+    { 101, -1 },
+    { 3, -2 },
+    { 24, -3 },
+    { 57, -2 },
+    { 61, -1 },
+    { 70, -2 },
+    { 85, -1 },
+    { 94, -3 },
+    { 97, -2 },
+    { 98, -1 },
+    { 106, -2 },
+    { 3, -2 },
+    { 24, -3 },
+    { 57, -2 },
+    { 58, -1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -3 },
+    { 74, -1 },
+    { 83, -2 },
+    { 85, -2 },
+    { 86, -1 },
+    { 94, -3 },
+    { 97, -3 },
+    { 98, -2 },
+    { 106, -3 },
+    { 107, -2 },
+    { 3, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 58, -1 },
+    { 64, 1 },
+    { 68, -2 },
+    { 69, 1 },
+    { 71, -1 },
+    { 72, 1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 85, -2 },
+    { 86, -2 },
+    { 89, -1 },
+    { 99, -3 },
+    { 101, 1 },
+    { 103, -1 },
+    { 105, -1 },
+    { 3, 3 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -3 },
+    { 24, 2 },
+    { 56, 1 },
+    { 57, 1 },
+    { 60, -3 },
+    { 61, 2 },
+    { 62, -4 },
+    { 64, -3 },
+    { 65, 1 },
+    { 69, 1 },
+    { 70, 2 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -4 },
+    { 82, -2 },
+    { 84, -1 },
+    { 87, -2 },
+    { 88, 2 },
+    { 89, -1 },
+    { 91, 1 },
+    { 93, 2 },
+    { 94, 1 },
+    { 96, -1 },
+    { 97, 2 },
+    { 99, -1 },
+    { 101, -4 },
+    { 103, -1 },
+    { 107, 2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 10, -1 },
+    { 24, -5 },
+    { 41, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 60, 1 },
+    { 61, -2 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 68, -2 },
+    { 69, 1 },
+    { 70, -4 },
+    { 71, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -2 },
+    { 85, -3 },
+    { 86, -2 },
+    { 90, -1 },
+    { 91, -1 },
+    { 94, -4 },
+    { 97, -3 },
+    { 98, -4 },
+    { 99, -2 },
+    { 101, 1 },
+    { 105, -1 },
+    { 106, -3 },
+    { 107, -3 },
+    { 94, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 57, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 70, -1 },
+    { 94, -2 },
+    { 97, -2 },
+    { 98, -1 },
+    { 101, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 41, -1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, -3 },
+    { 64, -2 },
+    { 70, 1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -4 },
+    { 82, -2 },
+    { 87, -2 },
+    { 89, -1 },
+    { 91, 1 },
+    { 99, -3 },
+    { 101, -3 },
+    { 103, -1 },
+    { 105, -1 },
+    { 106, 1 },
+    { 107, 2 },
+    { 59, 3 },
+    { 92, 3 },
+    { 24, -1 },
+    { 41, -1 },
+    { 57, -1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -1 },
+    { 94, -1 },
+    { 98, -1 },
+    { 106, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -2 },
+    { 57, -1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 70, -1 },
+    { 81, -1 },
+    { 94, -1 },
+    { 97, -1 },
+    { 101, -1 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 24, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 60, -3 },
+    { 62, -3 },
+    { 64, -3 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -4 },
+    { 82, -2 },
+    { 87, -2 },
+    { 89, -1 },
+    { 94, -1 },
+    { 97, -1 },
+    { 101, -4 },
+    { 103, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 68, -1 },
+    { 94, -1 },
+    { 99, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 41, -1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, -3 },
+    { 64, -2 },
+    { 70, 1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -4 },
+    { 82, -2 },
+    { 87, -2 },
+    { 88, 1 },
+    { 89, -1 },
+    { 91, 1 },
+    { 99, -3 },
+    { 101, -3 },
+    { 103, -1 },
+    { 105, -1 },
+    { 106, 1 },
+    { 107, 2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -2 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 87, -1 },
+    { 94, -1 },
+    { 97, -1 },
+    { 100, -1 },
+    { 101, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 98, -1 },
+    { 99, -2 },
+    { 101, 1 },
+    { 105, -1 },
+    { 3, -1 },
+    { 24, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 106, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, 1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 106, -1 },
+    { 24, -4 },
+    { 105, -1 },
+    { 106, -1 },
+    { 3, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 106, -1 },
+    { 24, -2 },
+    { 88, -1 },
+    { 93, -1 },
+    { 24, -3 },
+    { 3, -1 },
+    { 24, -3 },
+    { 85, -1 },
+    { 86, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -2 },
+    { 81, -1 },
+    { 87, -1 },
+    { 96, -1 },
+    { 24, -2 },
+    { 107, 1 },
+    { 2, 2 },
+    { 24, -3 },
+    { 25, 1 },
+    { 83, 2 },
+    { 85, -1 },
+    { 92, 4 },
+    { 105, 1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 24, -4 },
+    { 83, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 95, -1 },
+    { 105, -1 },
+    { 106, -2 },
+    { 3, -1 },
+    { 24, -3 },
+    { 82, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 99, -1 },
+    { 2, 1 },
+    { 3, 2 },
+    { 24, 2 },
+    { 88, 2 },
+    { 91, 1 },
+    { 93, 2 },
+    { 107, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 81, -1 },
+    { 57, -2 },
+    { 60, 1 },
+    { 70, -1 },
+    { 94, -2 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 56, -1 },
+    { 58, -1 },
+    { 60, -3 },
+    { 61, 1 },
+    { 62, -4 },
+    { 64, -3 },
+    { 67, -1 },
+    { 68, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -2 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -5 },
+    { 82, -2 },
+    { 87, -2 },
+    { 96, -1 },
+    { 99, -1 },
+    { 101, -4 },
+    { 103, -1 },
+    { 105, -1 },
+    { 80, 1 },
+    { 2, 2 },
+    { 3, 1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, -4 },
+    { 64, -2 },
+    { 68, -2 },
+    { 70, 1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 77, -3 },
+    { 78, -3 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -4 },
+    { 82, -2 },
+    { 85, -1 },
+    { 86, -2 },
+    { 87, -2 },
+    { 96, -2 },
+    { 99, -3 },
+    { 101, -4 },
+    { 103, -2 },
+    { 105, -2 },
+    { 107, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 41, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 87, -1 },
+    { 96, -1 },
+    { 99, -1 },
+    { 103, -1 },
+    { 107, 1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 41, -1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 62, -3 },
+    { 64, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 76, -1 },
+    { 81, -3 },
+    { 82, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 91, 1 },
+    { 101, -3 },
+    { 107, 1 },
+    { 59, 4 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 67, 1 },
+    { 92, 4 },
+    { 83, 1 },
+    { 92, 4 },
+    { 105, 1 },
+    { 24, -2 },
+    { 57, -1 },
+    { 64, 2 },
+    { 70, -1 },
+    { 94, -2 },
+    { 97, -2 },
+    { 24, -4 },
+    { 85, -1 },
+    { 86, -1 },
+    { 106, -1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 5, -2 },
+    { 6, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 24, 1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 58, -1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, -3 },
+    { 64, -2 },
+    { 68, -1 },
+    { 70, 1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 81, -4 },
+    { 82, -3 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -3 },
+    { 88, 1 },
+    { 89, -2 },
+    { 91, 1 },
+    { 93, 1 },
+    { 96, -2 },
+    { 97, 1 },
+    { 99, -2 },
+    { 101, -3 },
+    { 103, -2 },
+    { 105, -1 },
+    { 107, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 58, -1 },
+    { 59, 4 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 83, 1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 92, 3 },
+    { 98, -1 },
+    { 99, -2 },
+    { 101, 2 },
+    { 105, -1 },
+    { 2, 1 },
+    { 24, -2 },
+    { 25, 1 },
+    { 83, 2 },
+    { 92, 5 },
+    { 105, 2 },
+    { 107, 1 },
+    { 3, -4 },
+    { 57, -3 },
+    { 58, -1 },
+    { 61, -1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -4 },
+    { 79, -1 },
+    { 83, -2 },
+    { 85, -2 },
+    { 86, -1 },
+    { 94, -4 },
+    { 95, -1 },
+    { 97, -3 },
+    { 107, -2 },
+    { 62, -1 },
+    { 70, -1 },
+    { 97, -1 },
+    { 61, 1 },
+    { 68, -1 },
+    { 24, -2 },
+    { 92, 2 },
+    { 99, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 62, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 101, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 92, 2 },
+    { 99, -1 },
+    { 103, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 41, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 82, -2 },
+    { 83, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 87, -2 },
+    { 98, -1 },
+    { 99, -2 },
+    { 103, -2 },
+    { 105, -1 },
+    { 24, -2 },
+    { 73, -1 },
+    { 76, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 87, -1 },
+    { 107, 1 },
+    { 1, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 11, -4 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 26, -3 },
+    { 28, -1 },
+    { 29, -3 },
+    { 34, -2 },
+    { 38, -1 },
+    { 40, -1 },
+    { 43, -3 },
+    { 44, -4 },
+    { 46, -3 },
+    { 49, -3 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 60, -3 },
+    { 62, -4 },
+    { 63, -1 },
+    { 64, -3 },
+    { 67, -1 },
+    { 72, -2 },
+    { 73, -3 },
+    { 74, -1 },
+    { 76, -3 },
+    { 77, -2 },
+    { 78, -2 },
+    { 81, -5 },
+    { 82, -2 },
+    { 84, -1 },
+    { 87, -2 },
+    { 89, -2 },
+    { 94, -1 },
+    { 96, -2 },
+    { 101, -4 },
+    { 103, -1 },
+    { 105, -1 },
+    { 1, -2 },
+    { 4, -5 },
+    { 6, -5 },
+    { 10, -1 },
+    { 11, -5 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 26, -3 },
+    { 27, -1 },
+    { 28, -2 },
+    { 29, -4 },
+    { 30, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -3 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 44, -5 },
+    { 46, -3 },
+    { 47, -1 },
+    { 49, -3 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 54, -3 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 62, -5 },
+    { 63, -1 },
+    { 64, -4 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -3 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -6 },
+    { 82, -3 },
+    { 84, -1 },
+    { 87, -4 },
+    { 88, -1 },
+    { 89, -3 },
+    { 90, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 96, -3 },
+    { 97, -1 },
+    { 99, -3 },
+    { 100, -1 },
+    { 101, -5 },
+    { 104, -2 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 26, -1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, 3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 44, 1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, 2 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, -3 },
+    { 72, 1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -2 },
+    { 85, -4 },
+    { 86, -2 },
+    { 92, 3 },
+    { 94, -3 },
+    { 95, -1 },
+    { 97, -2 },
+    { 98, -4 },
+    { 99, -1 },
+    { 101, 1 },
+    { 106, -3 },
+    { 107, -3 },
+};
+
 static const EpdFontData bookerly_16_italic = {
     bookerly_16_italicBitmaps,
     bookerly_16_italicGlyphs,
@@ -5964,4 +7817,8 @@ static const EpdFontData bookerly_16_italic = {
     36,
     -9,
     true,
+    bookerly_16_italicKernLeftClasses,
+    bookerly_16_italicKernRightClasses,
+    bookerly_16_italicKernPairOffsets,
+    bookerly_16_italicKernPairs,
 };
@@ -5006,7 +5006,7 @@ static const EpdGlyph bookerly_16_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, // 	
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 6, 26, 9, 2, 25, 39, 0 }, // !
@@ -5796,6 +5796,1934 @@ static const EpdUnicodeInterval bookerly_16_regularIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_16_regularKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3,
+    0, 4, 5, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 8, 9, 10, 11, 0, 12, 13, 14, 14, 15,
+    16, 17, 18, 19, 11, 20, 21, 22, 23, 24, 25, 26, 26, 27, 28, 29,
+    30, 31, 0, 0, 0, 0, 32, 33, 34, 35, 36, 37, 38, 39, 35, 40,
+    41, 42, 39, 39, 33, 33, 43, 44, 45, 34, 46, 47, 47, 48, 47, 49,
+    50, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53,
+    0, 0, 0, 54, 8, 8, 8, 8, 8, 8, 0, 10, 0, 0, 0, 0,
+    14, 14, 14, 14, 11, 19, 11, 11, 11, 11, 11, 0, 55, 25, 25, 25,
+    25, 28, 56, 57, 32, 32, 32, 32, 32, 32, 36, 34, 36, 36, 36, 36,
+    35, 35, 58, 58, 59, 39, 33, 33, 33, 33, 33, 0, 33, 46, 46, 46,
+    46, 47, 33, 47, 8, 32, 8, 32, 60, 61, 10, 34, 10, 34, 10, 34,
+    10, 34, 11, 62, 11, 35, 0, 36, 0, 36, 0, 36, 63, 64, 0, 36,
+    13, 38, 13, 38, 13, 38, 13, 38, 14, 39, 14, 39, 14, 58, 14, 58,
+    14, 58, 65, 66, 14, 35, 15, 40, 15, 67, 16, 41, 41, 17, 42, 17,
+    42, 0, 62, 0, 0, 17, 68, 19, 39, 19, 39, 19, 39, 39, 19, 39,
+    11, 33, 11, 33, 11, 33, 0, 36, 22, 44, 22, 44, 22, 44, 23, 45,
+    23, 45, 23, 45, 23, 45, 24, 69, 24, 0, 24, 34, 25, 46, 25, 46,
+    25, 46, 25, 46, 25, 46, 25, 70, 26, 47, 28, 47, 28, 29, 49, 29,
+    49, 29, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 71, 71, 72, 0, 73, 74, 75, 75, 76, 77, 77,
+    78, 79, 75, 80, 75, 81, 82, 83, 84, 85, 71, 79, 83, 75, 75, 79,
+    75, 86, 75, 87, 75, 88, 89, 84, 80, 90, 91, 85, 75, 75, 85, 77,
+    75, 77, 87, 87, 75, 92, 93, 94, 95, 96, 97, 98, 99, 100, 100, 98,
+    100, 100, 100, 93, 100, 93, 101, 95, 102, 93, 103, 96, 100, 100, 96, 104,
+    100, 104, 93, 93, 100, 97, 97, 105, 95, 106, 107, 108, 109, 110, 104, 104,
+    111, 98, 100, 102, 100, 112, 113, 87, 93, 114, 115, 85, 96, 77, 104, 88,
+    93, 116, 117, 118, 95, 0, 0, 119, 120, 83, 99, 119, 120, 79, 98, 79,
+    98, 79, 98, 85, 96, 0, 0, 0, 0, 121, 122, 89, 101, 84, 95, 123,
+    102, 123, 102, 124, 125, 85, 96, 85, 96, 75, 100, 126, 111, 127, 97, 127,
+    97, 75, 79, 98, 128, 129, 85, 96, 76, 130, 85, 96, 75, 100, 85, 96,
+    131, 81, 92, 81, 92, 71, 97, 71, 97, 87, 93, 87, 93, 79, 98, 83,
+    99, 132, 100, 75, 100, 75, 100, 87, 93, 87, 93, 87, 93, 87, 93, 80,
+    102, 80, 102, 80, 102, 75, 100, 84, 95, 75, 100, 118, 95, 133, 103, 91,
+    103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 134, 135, 4, 134, 134, 135, 4,
+    134, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 53, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_16_regularKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4,
+    0, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    10, 0, 0, 0, 11, 0, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15,
+    13, 13, 16, 13, 14, 13, 14, 13, 17, 18, 19, 20, 20, 21, 22, 23,
+    0, 24, 25, 0, 0, 0, 26, 27, 28, 28, 28, 29, 30, 31, 32, 33,
+    31, 31, 34, 34, 28, 35, 28, 34, 36, 37, 38, 39, 39, 40, 41, 42,
+    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+    0, 0, 0, 46, 12, 12, 12, 12, 12, 12, 47, 14, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 0, 48, 19, 19, 19,
+    19, 22, 13, 49, 26, 26, 26, 50, 51, 26, 26, 28, 28, 28, 28, 52,
+    53, 32, 54, 55, 28, 34, 28, 28, 28, 28, 28, 0, 56, 38, 38, 38,
+    38, 41, 31, 41, 12, 57, 12, 58, 12, 26, 14, 28, 14, 28, 14, 28,
+    14, 28, 13, 28, 13, 28, 13, 28, 13, 28, 13, 28, 13, 28, 13, 28,
+    14, 30, 14, 30, 14, 30, 14, 30, 13, 31, 13, 59, 13, 55, 13, 55,
+    13, 55, 13, 32, 13, 32, 13, 32, 15, 60, 13, 31, 34, 13, 31, 13,
+    31, 13, 31, 13, 31, 13, 61, 13, 34, 13, 34, 13, 34, 34, 13, 34,
+    14, 28, 14, 28, 14, 28, 14, 28, 13, 34, 13, 34, 13, 62, 17, 36,
+    17, 36, 17, 36, 17, 63, 18, 37, 18, 37, 18, 37, 19, 38, 19, 38,
+    19, 38, 19, 38, 19, 38, 19, 38, 20, 39, 22, 41, 22, 23, 42, 23,
+    42, 23, 64, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 65, 65, 66, 65, 67, 68, 65, 65, 69, 70, 65,
+    66, 65, 65, 71, 65, 72, 65, 65, 65, 73, 65, 74, 75, 65, 65, 65,
+    70, 76, 65, 67, 65, 65, 67, 66, 71, 77, 78, 65, 79, 65, 65, 66,
+    65, 65, 80, 65, 81, 82, 83, 84, 84, 85, 86, 87, 88, 84, 84, 84,
+    89, 84, 84, 86, 84, 90, 86, 91, 92, 86, 93, 84, 94, 84, 84, 91,
+    84, 84, 88, 84, 95, 86, 86, 96, 84, 86, 97, 98, 99, 100, 89, 84,
+    96, 84, 84, 92, 84, 66, 91, 67, 86, 101, 92, 65, 84, 102, 103, 65,
+    90, 65, 84, 65, 84, 65, 84, 74, 87, 75, 88, 65, 84, 65, 84, 0,
+    0, 66, 91, 65, 84, 65, 84, 65, 84, 67, 86, 67, 86, 66, 91, 104,
+    92, 104, 92, 78, 93, 0, 91, 79, 94, 79, 94, 65, 96, 105, 106, 105,
+    106, 65, 74, 87, 65, 84, 70, 89, 65, 84, 65, 84, 79, 94, 0, 84,
+    96, 72, 82, 72, 82, 107, 82, 65, 86, 108, 109, 0, 109, 74, 87, 75,
+    88, 0, 110, 65, 84, 65, 84, 67, 86, 67, 86, 67, 86, 0, 88, 71,
+    92, 71, 92, 71, 92, 0, 94, 65, 84, 65, 84, 65, 84, 78, 93, 78,
+    93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 0, 6, 6, 6, 0, 0, 111, 112, 7, 111, 111, 112, 7,
+    111, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 1, 0, 0, 0,
+    11, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_regularKernPairOffsets[136] = {
+    0, 4, 28, 42, 73, 88, 140, 142, 164, 172, 177, 190, 215, 219, 225, 247,
+    262, 273, 281, 296, 317, 337, 355, 363, 393, 413, 458, 476, 520, 523, 533, 558,
+    565, 572, 574, 577, 581, 612, 619, 626, 629, 633, 638, 644, 663, 667, 674, 696,
+    701, 702, 713, 721, 729, 748, 793, 803, 826, 835, 847, 854, 879, 888, 914, 915,
+    921, 928, 933, 942, 957, 960, 969, 970, 982, 985, 996, 1004, 1028, 1052, 1069, 1088,
+    1130, 1159, 1168, 1178, 1208, 1217, 1229, 1248, 1269, 1273, 1294, 1313, 1324, 1333, 1336, 1344,
+    1348, 1352, 1357, 1361, 1362, 1365, 1382, 1387, 1398, 1408, 1409, 1414, 1419, 1427, 1429, 1438,
+    1447, 1454, 1487, 1499, 1532, 1541, 1562, 1584, 1589, 1596, 1601, 1642, 1669, 1675, 1688, 1691,
+    1693, 1695, 1705, 1709, 1711, 1734, 1772, 1815,
+};
+
+static const EpdKernPair bookerly_16_regularKernPairs[] = {
+    { 12, -2 },
+    { 30, -1 },
+    { 37, 1 },
+    { 72, -2 },
+    { 14, -1 },
+    { 15, 2 },
+    { 26, -1 },
+    { 28, -1 },
+    { 33, 2 },
+    { 39, 1 },
+    { 41, 1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 2 },
+    { 67, -1 },
+    { 69, 2 },
+    { 82, -1 },
+    { 86, -1 },
+    { 92, 1 },
+    { 99, 1 },
+    { 100, 2 },
+    { 12, -3 },
+    { 20, 1 },
+    { 21, 1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 47, -4 },
+    { 52, -1 },
+    { 56, -1 },
+    { 70, -3 },
+    { 72, -3 },
+    { 78, 1 },
+    { 86, -1 },
+    { 101, 1 },
+    { 107, -4 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 22, -3 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 41, -2 },
+    { 48, -1 },
+    { 60, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 69, 1 },
+    { 71, -2 },
+    { 72, 1 },
+    { 73, 1 },
+    { 77, -1 },
+    { 79, -3 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, -2 },
+    { 101, -3 },
+    { 104, -3 },
+    { 105, -2 },
+    { 106, -1 },
+    { 111, -3 },
+    { 112, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 47, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 77, 1 },
+    { 79, -1 },
+    { 101, -2 },
+    { 104, -2 },
+    { 107, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 23, -1 },
+    { 26, -3 },
+    { 28, -3 },
+    { 29, -1 },
+    { 30, -3 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 47, -5 },
+    { 48, -1 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 77, -1 },
+    { 82, -3 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 95, -3 },
+    { 97, -3 },
+    { 99, 1 },
+    { 106, -1 },
+    { 107, -5 },
+    { 110, -1 },
+    { 22, -1 },
+    { 104, -1 },
+    { 2, -2 },
+    { 4, -3 },
+    { 6, -1 },
+    { 8, 1 },
+    { 11, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 1 },
+    { 22, -4 },
+    { 24, -3 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 44, -1 },
+    { 47, 1 },
+    { 111, -3 },
+    { 112, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 28, 1 },
+    { 33, 1 },
+    { 47, -1 },
+    { 52, 1 },
+    { 56, 1 },
+    { 6, -1 },
+    { 14, -1 },
+    { 36, -1 },
+    { 48, -1 },
+    { 63, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 37, 1 },
+    { 47, -2 },
+    { 49, -1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 12, -3 },
+    { 16, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 42, -1 },
+    { 47, -4 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 47, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 40, -1 },
+    { 47, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 28, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 41, -2 },
+    { 48, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 60, 1 },
+    { 4, -1 },
+    { 12, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 22, -3 },
+    { 24, -4 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 12, 1 },
+    { 18, -1 },
+    { 21, 1 },
+    { 22, -1 },
+    { 47, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 111, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 12, -1 },
+    { 26, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 12, -3 },
+    { 18, 1 },
+    { 30, -1 },
+    { 33, 1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 47, -4 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 2 },
+    { 63, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 3, 2 },
+    { 5, 1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 12, -1 },
+    { 15, 3 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 25, 2 },
+    { 30, 1 },
+    { 33, 3 },
+    { 37, 1 },
+    { 41, 2 },
+    { 43, 2 },
+    { 47, -2 },
+    { 49, -1 },
+    { 60, 3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 47, 1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 30, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 47, -1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -4 },
+    { 14, -1 },
+    { 16, -1 },
+    { 26, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 36, -2 },
+    { 42, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 47, -3 },
+    { 48, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 12, -2 },
+    { 26, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 40, -1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 47, -2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -4 },
+    { 14, -1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 28, -2 },
+    { 29, -1 },
+    { 30, -3 },
+    { 31, 1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 47, -5 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -2 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 21, 1 },
+    { 27, 1 },
+    { 31, 1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -3 },
+    { 14, -2 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 28, -3 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, 1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -3 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 47, -4 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -3 },
+    { 54, 1 },
+    { 55, 2 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, -3 },
+    { 64, -1 },
+    { 112, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 15, 1 },
+    { 33, 1 },
+    { 41, 2 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 69, 1 },
+    { 92, 2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 14, -1 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -3 },
+    { 22, -3 },
+    { 28, -1 },
+    { 30, 1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 66, -3 },
+    { 67, -1 },
+    { 71, -1 },
+    { 79, -3 },
+    { 86, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 101, -3 },
+    { 104, -3 },
+    { 105, -2 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 8, -1 },
+    { 24, -2 },
+    { 61, 2 },
+    { 111, -2 },
+    { 112, -1 },
+    { 24, -2 },
+    { 112, 1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 61, 1 },
+    { 111, -1 },
+    { 1, 2 },
+    { 2, 3 },
+    { 3, 3 },
+    { 4, 3 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 11, 2 },
+    { 24, 3 },
+    { 25, 3 },
+    { 32, 1 },
+    { 33, 1 },
+    { 36, -1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 43, 3 },
+    { 50, 1 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 3 },
+    { 54, 3 },
+    { 55, 4 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, 3 },
+    { 60, 3 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 111, 3 },
+    { 112, 3 },
+    { 2, 1 },
+    { 4, 1 },
+    { 24, -1 },
+    { 33, 1 },
+    { 37, 1 },
+    { 60, 1 },
+    { 112, 1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 39, -2 },
+    { 41, -2 },
+    { 111, -2 },
+    { 112, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 30, -1 },
+    { 24, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 52, -1 },
+    { 11, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -2 },
+    { 33, 2 },
+    { 39, -1 },
+    { 41, 1 },
+    { 60, 2 },
+    { 111, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 11, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 111, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, 1 },
+    { 30, -2 },
+    { 31, -1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 111, 1 },
+    { 112, 2 },
+    { 4, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 111, 1 },
+    { 112, 2 },
+    { 24, -2 },
+    { 15, 2 },
+    { 33, 2 },
+    { 39, 2 },
+    { 41, 2 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 2 },
+    { 69, 2 },
+    { 92, 2 },
+    { 99, 1 },
+    { 100, 2 },
+    { 15, 1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 33, 1 },
+    { 69, 1 },
+    { 100, 1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 66, -1 },
+    { 79, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -2 },
+    { 47, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 87, -1 },
+    { 101, -1 },
+    { 104, -2 },
+    { 107, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 31, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, 1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 101, -2 },
+    { 104, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 24, -1 },
+    { 37, 1 },
+    { 47, -2 },
+    { 49, -1 },
+    { 3, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 11, -1 },
+    { 12, -3 },
+    { 13, -2 },
+    { 15, -1 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -2 },
+    { 22, -2 },
+    { 24, -3 },
+    { 25, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 47, -4 },
+    { 59, -1 },
+    { 61, -1 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 3, 1 },
+    { 4, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 27, 2 },
+    { 31, 2 },
+    { 43, 1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 59, 2 },
+    { 61, 2 },
+    { 112, 1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 8, -2 },
+    { 24, -1 },
+    { 61, 2 },
+    { 111, -1 },
+    { 112, -1 },
+    { 2, -2 },
+    { 4, -3 },
+    { 6, -1 },
+    { 8, 1 },
+    { 11, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 1 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 1 },
+    { 22, -4 },
+    { 24, -3 },
+    { 33, 1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 44, -1 },
+    { 47, 1 },
+    { 60, 1 },
+    { 111, -3 },
+    { 112, -2 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 33, 3 },
+    { 39, -1 },
+    { 41, -1 },
+    { 60, 3 },
+    { 111, -1 },
+    { 112, -1 },
+    { 1, 1 },
+    { 3, 3 },
+    { 4, 2 },
+    { 11, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 27, 4 },
+    { 29, 1 },
+    { 31, 4 },
+    { 32, 1 },
+    { 33, 2 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 43, 3 },
+    { 51, 1 },
+    { 53, 1 },
+    { 59, 4 },
+    { 60, 3 },
+    { 61, 4 },
+    { 62, 2 },
+    { 63, 2 },
+    { 64, 1 },
+    { 111, 2 },
+    { 112, 3 },
+    { 33, 1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 33, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 111, -1 },
+    { 33, 1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 33, 2 },
+    { 39, -1 },
+    { 41, -1 },
+    { 60, 2 },
+    { 111, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 27, 1 },
+    { 30, -1 },
+    { 31, 1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 11, -1 },
+    { 29, 1 },
+    { 32, 1 },
+    { 33, 2 },
+    { 34, 1 },
+    { 35, 2 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 2 },
+    { 40, 1 },
+    { 41, 2 },
+    { 53, 1 },
+    { 62, 1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -2 },
+    { 33, 1 },
+    { 112, 1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 33, 2 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 60, 2 },
+    { 111, -1 },
+    { 112, -1 },
+    { 105, -1 },
+    { 4, -1 },
+    { 24, -2 },
+    { 66, -1 },
+    { 71, -2 },
+    { 79, -2 },
+    { 92, -1 },
+    { 94, -1 },
+    { 101, -2 },
+    { 104, -2 },
+    { 105, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 105, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 107, -1 },
+    { 44, -1 },
+    { 77, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 99, 1 },
+    { 105, -2 },
+    { 106, -2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 93, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 99, 1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -2 },
+    { 4, -2 },
+    { 6, 1 },
+    { 24, -2 },
+    { 66, -2 },
+    { 69, -1 },
+    { 71, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, 1 },
+    { 83, 1 },
+    { 85, -1 },
+    { 86, 1 },
+    { 87, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 101, -2 },
+    { 104, -3 },
+    { 105, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, -3 },
+    { 24, -4 },
+    { 66, -2 },
+    { 67, -1 },
+    { 71, -2 },
+    { 77, -1 },
+    { 79, -4 },
+    { 83, -1 },
+    { 91, -1 },
+    { 92, -2 },
+    { 94, -2 },
+    { 101, -3 },
+    { 104, -2 },
+    { 105, -2 },
+    { 106, -2 },
+    { 111, -1 },
+    { 112, -2 },
+    { 44, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 71, -1 },
+    { 77, -2 },
+    { 79, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 91, -2 },
+    { 92, -2 },
+    { 94, -3 },
+    { 101, -1 },
+    { 104, -1 },
+    { 105, -2 },
+    { 106, -3 },
+    { 108, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 111, -1 },
+    { 5, -4 },
+    { 6, -2 },
+    { 7, -4 },
+    { 8, -4 },
+    { 44, -3 },
+    { 45, -2 },
+    { 67, -3 },
+    { 68, -1 },
+    { 70, -3 },
+    { 71, 1 },
+    { 72, -5 },
+    { 73, -4 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -3 },
+    { 84, -3 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -2 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -5 },
+    { 97, -3 },
+    { 99, 2 },
+    { 101, 1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 106, -4 },
+    { 107, -6 },
+    { 108, -1 },
+    { 109, -2 },
+    { 110, -1 },
+    { 112, 1 },
+    { 2, -2 },
+    { 4, -3 },
+    { 6, -1 },
+    { 8, 1 },
+    { 11, -2 },
+    { 24, -3 },
+    { 44, -1 },
+    { 66, -3 },
+    { 67, -1 },
+    { 70, 1 },
+    { 71, -2 },
+    { 72, 1 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 79, -4 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, -2 },
+    { 101, -4 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -2 },
+    { 107, 1 },
+    { 111, -3 },
+    { 112, -2 },
+    { 66, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 95, -1 },
+    { 105, -1 },
+    { 24, -1 },
+    { 71, -1 },
+    { 79, -1 },
+    { 83, 1 },
+    { 86, 1 },
+    { 95, -1 },
+    { 100, 1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 67, -1 },
+    { 70, -3 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 81, -2 },
+    { 82, -2 },
+    { 85, -3 },
+    { 86, -2 },
+    { 88, -1 },
+    { 89, -3 },
+    { 95, -4 },
+    { 97, -2 },
+    { 99, 1 },
+    { 105, -1 },
+    { 106, -3 },
+    { 107, -3 },
+    { 109, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 69, 1 },
+    { 72, 1 },
+    { 77, -1 },
+    { 91, -1 },
+    { 92, 1 },
+    { 94, -1 },
+    { 100, 1 },
+    { 105, -2 },
+    { 106, -2 },
+    { 66, -1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 77, -1 },
+    { 78, 1 },
+    { 94, -1 },
+    { 99, 1 },
+    { 104, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, 1 },
+    { 111, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 24, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -2 },
+    { 2, 1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 66, 1 },
+    { 70, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -1 },
+    { 81, -1 },
+    { 85, -2 },
+    { 89, -2 },
+    { 92, 1 },
+    { 95, -2 },
+    { 97, -1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 107, -4 },
+    { 111, 1 },
+    { 112, 1 },
+    { 6, -1 },
+    { 67, -1 },
+    { 81, 1 },
+    { 97, -1 },
+    { 5, -2 },
+    { 6, 1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 65, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -3 },
+    { 74, -2 },
+    { 76, -1 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -2 },
+    { 4, 1 },
+    { 67, -1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 85, 1 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, -2 },
+    { 93, 1 },
+    { 94, -2 },
+    { 96, 1 },
+    { 99, 2 },
+    { 105, -2 },
+    { 106, -2 },
+    { 107, 1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 89, 1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 106, -1 },
+    { 110, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 8, -1 },
+    { 24, -2 },
+    { 85, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 87, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 85, -2 },
+    { 89, -2 },
+    { 90, 1 },
+    { 95, -1 },
+    { 112, 1 },
+    { 24, -1 },
+    { 92, 1 },
+    { 100, 1 },
+    { 106, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 95, -1 },
+    { 111, -1 },
+    { 24, -2 },
+    { 44, -1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 106, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 111, -1 },
+    { 106, -1 },
+    { 24, -2 },
+    { 95, -1 },
+    { 112, 1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 90, 1 },
+    { 92, 1 },
+    { 94, 1 },
+    { 95, -2 },
+    { 97, -1 },
+    { 98, 1 },
+    { 100, 1 },
+    { 111, 1 },
+    { 112, 2 },
+    { 4, 1 },
+    { 90, 1 },
+    { 106, -1 },
+    { 111, 1 },
+    { 112, 2 },
+    { 4, -2 },
+    { 24, -4 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 91, -1 },
+    { 92, -2 },
+    { 94, -2 },
+    { 95, -1 },
+    { 106, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 112, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 95, -1 },
+    { 111, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 3, 1 },
+    { 4, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 43, 1 },
+    { 96, 2 },
+    { 99, 2 },
+    { 112, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 91, -1 },
+    { 92, -2 },
+    { 94, -2 },
+    { 106, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 6, 1 },
+    { 24, -1 },
+    { 66, -2 },
+    { 71, -2 },
+    { 74, -1 },
+    { 79, -1 },
+    { 101, -1 },
+    { 104, -2 },
+    { 105, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 111, -1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 67, -1 },
+    { 70, -3 },
+    { 71, 1 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -1 },
+    { 77, -1 },
+    { 81, -2 },
+    { 82, -2 },
+    { 84, -1 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 91, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -4 },
+    { 97, -2 },
+    { 104, 1 },
+    { 105, -2 },
+    { 106, -3 },
+    { 107, -5 },
+    { 109, -2 },
+    { 110, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 90, 1 },
+    { 92, 1 },
+    { 94, 1 },
+    { 95, -1 },
+    { 100, 1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -4 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -1 },
+    { 77, -2 },
+    { 81, -2 },
+    { 82, -3 },
+    { 84, -2 },
+    { 85, -3 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -3 },
+    { 97, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 107, -4 },
+    { 109, -2 },
+    { 110, -1 },
+    { 111, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 95, -2 },
+    { 97, -1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -3 },
+    { 70, -2 },
+    { 72, -2 },
+    { 73, -3 },
+    { 76, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 95, -2 },
+    { 97, -1 },
+    { 99, 1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -4 },
+    { 111, 1 },
+    { 112, 1 },
+    { 44, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, 2 },
+    { 71, -1 },
+    { 72, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 91, -2 },
+    { 92, 1 },
+    { 94, -3 },
+    { 100, 1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 105, -2 },
+    { 106, -3 },
+    { 107, 1 },
+    { 109, -1 },
+    { 111, -1 },
+    { 44, -1 },
+    { 86, -1 },
+    { 92, 1 },
+    { 100, 2 },
+    { 106, -2 },
+    { 66, -1 },
+    { 71, -1 },
+    { 79, -2 },
+    { 101, -2 },
+    { 104, -2 },
+    { 105, -1 },
+    { 111, -1 },
+    { 24, -3 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 111, -1 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 67, -2 },
+    { 68, -1 },
+    { 70, -2 },
+    { 71, 1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -1 },
+    { 77, -1 },
+    { 81, -2 },
+    { 82, -2 },
+    { 84, -1 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, 1 },
+    { 97, -2 },
+    { 99, 2 },
+    { 101, 1 },
+    { 104, 1 },
+    { 105, -2 },
+    { 106, -2 },
+    { 107, -3 },
+    { 109, -1 },
+    { 110, -1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 67, -1 },
+    { 69, 2 },
+    { 70, 1 },
+    { 72, 1 },
+    { 73, 1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 81, 1 },
+    { 85, 1 },
+    { 87, 1 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, 2 },
+    { 93, 1 },
+    { 94, -2 },
+    { 95, 1 },
+    { 96, 1 },
+    { 98, 1 },
+    { 99, 2 },
+    { 100, 2 },
+    { 103, 1 },
+    { 105, -2 },
+    { 106, -2 },
+    { 107, 1 },
+    { 4, 1 },
+    { 90, 1 },
+    { 100, 2 },
+    { 106, -1 },
+    { 111, 1 },
+    { 112, 2 },
+    { 24, -4 },
+    { 66, -3 },
+    { 67, -1 },
+    { 71, -3 },
+    { 77, -1 },
+    { 79, -4 },
+    { 91, -2 },
+    { 92, -2 },
+    { 94, -2 },
+    { 101, -3 },
+    { 104, -3 },
+    { 105, -2 },
+    { 106, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 81, -1 },
+    { 74, -1 },
+    { 105, -1 },
+    { 91, -1 },
+    { 106, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -1 },
+    { 95, -2 },
+    { 96, -1 },
+    { 97, -1 },
+    { 106, -1 },
+    { 11, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 74, -1 },
+    { 95, -1 },
+    { 4, 1 },
+    { 67, -1 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 85, 1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, -2 },
+    { 96, 1 },
+    { 97, -1 },
+    { 99, 2 },
+    { 105, -2 },
+    { 106, -3 },
+    { 107, 1 },
+    { 109, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 12, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 27, 1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 31, 1 },
+    { 36, -1 },
+    { 46, -4 },
+    { 47, -4 },
+    { 52, -1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 63, -1 },
+    { 66, 1 },
+    { 70, -2 },
+    { 71, 1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 81, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 95, -2 },
+    { 96, 1 },
+    { 97, -1 },
+    { 99, 2 },
+    { 101, 1 },
+    { 102, 1 },
+    { 104, 1 },
+    { 107, -4 },
+    { 5, -3 },
+    { 7, -3 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 26, -1 },
+    { 28, -2 },
+    { 30, -3 },
+    { 36, -3 },
+    { 42, -1 },
+    { 47, -6 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -2 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 63, -3 },
+    { 64, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -2 },
+    { 89, -2 },
+    { 95, -3 },
+    { 97, -3 },
+    { 99, 1 },
+    { 101, 1 },
+    { 104, 1 },
+    { 106, -2 },
+    { 107, -6 },
+};
+
 static const EpdFontData bookerly_16_regular = {
     bookerly_16_regularBitmaps,
     bookerly_16_regularGlyphs,
@@ -5805,4 +7733,8 @@ static const EpdFontData bookerly_16_regular = {
     36,
     -9,
     true,
+    bookerly_16_regularKernLeftClasses,
+    bookerly_16_regularKernRightClasses,
+    bookerly_16_regularKernPairOffsets,
+    bookerly_16_regularKernPairs,
 };
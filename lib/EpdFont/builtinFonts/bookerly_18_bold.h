@@ -7040,7 +7040,7 @@ static const EpdGlyph bookerly_18_boldGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, // 	
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 8, 30, 11, 2, 29, 60, 0 }, // !
@@ -7830,6 +7830,2399 @@ static const EpdUnicodeInterval bookerly_18_boldIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_18_boldKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3,
+    0, 4, 5, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    7, 0, 0, 0, 0, 8, 9, 10, 11, 12, 13, 14, 15, 16, 16, 17,
+    18, 19, 20, 21, 12, 22, 23, 24, 25, 26, 27, 28, 28, 29, 30, 31,
+    32, 33, 0, 0, 0, 0, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 41, 41, 35, 35, 46, 47, 48, 49, 50, 51, 51, 52, 51, 53,
+    54, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57,
+    0, 0, 0, 58, 9, 9, 9, 9, 9, 9, 13, 11, 13, 13, 13, 13,
+    16, 16, 16, 16, 12, 21, 12, 12, 12, 12, 12, 0, 59, 27, 27, 27,
+    27, 30, 60, 61, 34, 34, 34, 34, 34, 34, 38, 36, 38, 38, 38, 38,
+    42, 42, 62, 62, 35, 41, 35, 35, 35, 35, 35, 0, 35, 50, 50, 50,
+    50, 51, 35, 51, 9, 34, 9, 34, 63, 64, 11, 36, 11, 36, 11, 36,
+    11, 36, 12, 65, 12, 66, 13, 38, 13, 38, 13, 38, 67, 68, 13, 38,
+    15, 40, 15, 40, 15, 40, 15, 40, 16, 41, 16, 41, 16, 62, 16, 62,
+    16, 62, 16, 69, 16, 42, 17, 43, 17, 70, 18, 44, 44, 19, 45, 19,
+    45, 0, 65, 0, 0, 19, 71, 21, 41, 21, 41, 21, 41, 41, 21, 41,
+    12, 35, 12, 35, 12, 35, 13, 38, 24, 47, 24, 47, 24, 47, 25, 48,
+    25, 48, 25, 48, 25, 48, 26, 72, 26, 73, 26, 49, 27, 50, 27, 50,
+    27, 50, 27, 50, 27, 50, 27, 74, 28, 51, 30, 51, 30, 31, 53, 31,
+    53, 31, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 75, 75, 76, 0, 77, 78, 79, 79, 80, 81, 81,
+    82, 83, 79, 84, 79, 85, 86, 87, 88, 89, 75, 83, 87, 79, 79, 83,
+    79, 90, 79, 91, 79, 92, 93, 88, 84, 94, 95, 89, 79, 79, 89, 81,
+    79, 81, 91, 91, 79, 96, 97, 98, 99, 100, 101, 102, 103, 104, 104, 102,
+    104, 104, 104, 97, 104, 97, 105, 99, 106, 97, 107, 100, 104, 104, 100, 108,
+    104, 108, 97, 97, 104, 101, 101, 109, 99, 13, 110, 111, 112, 0, 108, 108,
+    113, 102, 104, 106, 104, 114, 115, 91, 97, 116, 117, 89, 100, 81, 108, 92,
+    97, 118, 119, 120, 99, 0, 0, 121, 122, 87, 103, 121, 122, 83, 102, 83,
+    102, 83, 102, 89, 100, 0, 0, 0, 0, 123, 124, 93, 105, 88, 99, 125,
+    106, 125, 106, 126, 127, 89, 100, 89, 100, 79, 104, 128, 113, 129, 101, 129,
+    101, 79, 83, 102, 130, 131, 89, 100, 80, 132, 89, 100, 79, 104, 89, 100,
+    133, 85, 96, 85, 96, 75, 101, 75, 101, 91, 97, 91, 97, 83, 102, 87,
+    103, 134, 135, 79, 104, 79, 104, 91, 97, 91, 97, 91, 97, 91, 97, 84,
+    106, 84, 106, 84, 106, 79, 104, 88, 99, 79, 104, 120, 99, 136, 137, 95,
+    107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 138, 139, 140, 138, 138, 139, 4,
+    138, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 57, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_18_boldKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 2, 3,
+    0, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    9, 0, 0, 0, 10, 0, 11, 12, 13, 12, 12, 12, 13, 12, 12, 14,
+    12, 12, 15, 12, 13, 12, 13, 12, 16, 17, 18, 19, 19, 20, 21, 22,
+    0, 23, 24, 0, 0, 0, 25, 26, 27, 27, 27, 28, 29, 30, 31, 32,
+    30, 30, 33, 33, 27, 34, 27, 33, 35, 36, 37, 38, 38, 39, 40, 41,
+    0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    0, 0, 0, 45, 11, 11, 11, 11, 11, 11, 46, 13, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 0, 47, 18, 18, 18,
+    18, 21, 12, 48, 25, 25, 25, 49, 50, 25, 25, 27, 27, 27, 27, 51,
+    52, 31, 53, 54, 27, 33, 27, 27, 27, 27, 55, 0, 56, 37, 37, 37,
+    37, 40, 57, 40, 11, 58, 11, 58, 11, 25, 13, 27, 13, 55, 13, 27,
+    13, 55, 12, 27, 12, 27, 12, 59, 12, 55, 12, 27, 12, 27, 12, 55,
+    13, 29, 13, 60, 13, 29, 13, 29, 12, 30, 12, 61, 12, 54, 12, 54,
+    12, 54, 12, 31, 12, 31, 12, 31, 14, 62, 12, 30, 33, 12, 30, 12,
+    30, 12, 30, 12, 30, 12, 63, 12, 33, 12, 33, 12, 33, 33, 12, 33,
+    13, 27, 13, 55, 13, 27, 13, 27, 12, 33, 12, 33, 12, 64, 16, 35,
+    16, 65, 16, 35, 16, 66, 17, 36, 17, 36, 17, 36, 18, 37, 18, 37,
+    18, 37, 18, 37, 18, 37, 18, 37, 19, 38, 21, 40, 21, 22, 41, 22,
+    41, 22, 67, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 68, 68, 69, 68, 70, 71, 68, 68, 72, 73, 68,
+    69, 68, 68, 74, 68, 75, 68, 68, 68, 76, 68, 77, 78, 68, 68, 68,
+    73, 79, 68, 70, 68, 68, 70, 69, 74, 80, 81, 68, 82, 68, 68, 69,
+    68, 68, 83, 68, 84, 85, 86, 87, 87, 88, 89, 90, 91, 87, 87, 87,
+    92, 87, 87, 89, 87, 93, 89, 94, 95, 89, 96, 87, 97, 87, 87, 94,
+    87, 87, 98, 87, 99, 89, 89, 100, 87, 89, 101, 102, 103, 104, 92, 87,
+    100, 87, 87, 105, 87, 69, 94, 70, 89, 106, 95, 68, 87, 107, 108, 68,
+    93, 68, 87, 68, 87, 68, 87, 77, 90, 78, 91, 68, 87, 68, 87, 0,
+    0, 69, 94, 68, 87, 68, 87, 68, 87, 70, 89, 70, 89, 69, 94, 109,
+    95, 109, 95, 81, 96, 0, 94, 82, 97, 82, 97, 68, 100, 110, 111, 110,
+    111, 68, 77, 90, 68, 87, 73, 92, 68, 87, 68, 87, 82, 97, 0, 87,
+    100, 75, 85, 75, 85, 112, 85, 68, 89, 113, 114, 0, 114, 77, 90, 78,
+    91, 0, 115, 68, 87, 68, 87, 70, 89, 70, 89, 70, 89, 0, 91, 74,
+    105, 74, 116, 74, 105, 0, 97, 68, 87, 68, 87, 68, 87, 81, 96, 81,
+    96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 117, 118, 6, 117, 117, 118, 6,
+    117, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 0, 0, 0, 0, 0,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_18_boldKernPairOffsets[141] = {
+    0, 5, 32, 51, 91, 114, 172, 176, 178, 201, 215, 232, 247, 248, 276, 280,
+    290, 322, 343, 355, 366, 400, 432, 455, 476, 487, 521, 555, 605, 623, 673, 676,
+    688, 718, 726, 739, 743, 746, 752, 785, 803, 810, 815, 819, 837, 842, 849, 877,
+    892, 896, 903, 934, 944, 945, 962, 970, 979, 997, 1047, 1061, 1093, 1105, 1119, 1145,
+    1155, 1181, 1183, 1185, 1193, 1200, 1207, 1222, 1226, 1227, 1236, 1238, 1253, 1255, 1269, 1278,
+    1308, 1335, 1354, 1377, 1423, 1454, 1463, 1479, 1511, 1523, 1538, 1560, 1586, 1593, 1615, 1635,
+    1647, 1664, 1670, 1679, 1684, 1689, 1698, 1708, 1709, 1712, 1730, 1739, 1752, 1764, 1773, 1780,
+    1789, 1800, 1809, 1818, 1852, 1866, 1901, 1910, 1931, 1955, 1962, 1969, 1976, 2023, 2051, 2061,
+    2076, 2079, 2081, 2083, 2093, 2099, 2101, 2103, 2128, 2138, 2188, 2240, 2280,
+};
+
+static const EpdKernPair bookerly_18_boldKernPairs[] = {
+    { 11, -2 },
+    { 29, -2 },
+    { 36, 2 },
+    { 60, -2 },
+    { 75, -2 },
+    { 13, -1 },
+    { 14, 2 },
+    { 25, -1 },
+    { 27, -1 },
+    { 32, 2 },
+    { 38, 1 },
+    { 40, 1 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 62, 2 },
+    { 70, -1 },
+    { 72, 2 },
+    { 85, -1 },
+    { 89, -1 },
+    { 95, 1 },
+    { 103, 1 },
+    { 104, 2 },
+    { 105, 1 },
+    { 116, 1 },
+    { 11, -3 },
+    { 19, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 46, -5 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 73, -3 },
+    { 75, -3 },
+    { 81, 1 },
+    { 89, -1 },
+    { 106, 1 },
+    { 109, 1 },
+    { 112, -5 },
+    { 11, 1 },
+    { 13, -2 },
+    { 14, 1 },
+    { 17, -3 },
+    { 18, -2 },
+    { 19, -5 },
+    { 21, -3 },
+    { 27, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -3 },
+    { 40, -3 },
+    { 47, -2 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 69, -3 },
+    { 70, -2 },
+    { 72, 1 },
+    { 74, -2 },
+    { 75, 1 },
+    { 80, -1 },
+    { 82, -4 },
+    { 89, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, 1 },
+    { 97, -3 },
+    { 105, -3 },
+    { 106, -5 },
+    { 109, -3 },
+    { 110, -3 },
+    { 111, -2 },
+    { 116, -3 },
+    { 117, -3 },
+    { 118, -2 },
+    { 11, -1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -2 },
+    { 38, -1 },
+    { 40, -1 },
+    { 46, -1 },
+    { 69, -1 },
+    { 72, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, 1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 95, -1 },
+    { 105, -1 },
+    { 106, -2 },
+    { 109, -2 },
+    { 112, -1 },
+    { 116, -1 },
+    { 11, -4 },
+    { 13, -2 },
+    { 16, -1 },
+    { 22, -1 },
+    { 25, -4 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -3 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -2 },
+    { 46, -5 },
+    { 47, -2 },
+    { 49, -4 },
+    { 50, -4 },
+    { 51, -3 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -3 },
+    { 56, -3 },
+    { 58, -4 },
+    { 59, -3 },
+    { 60, -3 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 73, -2 },
+    { 75, -4 },
+    { 76, -2 },
+    { 80, -2 },
+    { 85, -4 },
+    { 87, -1 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -2 },
+    { 98, -1 },
+    { 99, -3 },
+    { 101, -3 },
+    { 103, 1 },
+    { 105, -1 },
+    { 111, -1 },
+    { 112, -5 },
+    { 115, -1 },
+    { 116, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 106, -1 },
+    { 109, -1 },
+    { 21, -1 },
+    { 109, -1 },
+    { 1, -2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 7, 1 },
+    { 10, -2 },
+    { 11, 1 },
+    { 13, -1 },
+    { 17, -4 },
+    { 18, -2 },
+    { 19, -4 },
+    { 21, -4 },
+    { 23, -4 },
+    { 26, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -3 },
+    { 39, 1 },
+    { 40, -3 },
+    { 43, -1 },
+    { 46, 1 },
+    { 47, 1 },
+    { 117, -4 },
+    { 118, -3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -2 },
+    { 27, 1 },
+    { 46, -1 },
+    { 51, 1 },
+    { 55, 1 },
+    { 56, 1 },
+    { 59, 1 },
+    { 5, -1 },
+    { 13, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 35, -1 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 36, 1 },
+    { 46, -3 },
+    { 48, -1 },
+    { 118, 1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -3 },
+    { 11, -3 },
+    { 15, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 29, -2 },
+    { 35, -1 },
+    { 41, -1 },
+    { 46, -4 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 2 },
+    { 54, 2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 62, 2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 117, 1 },
+    { 118, 1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 46, -1 },
+    { 13, -1 },
+    { 27, -1 },
+    { 43, -1 },
+    { 47, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -2 },
+    { 13, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 32, 1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 46, -2 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 5, -1 },
+    { 11, 1 },
+    { 13, -2 },
+    { 15, 1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 40, -2 },
+    { 47, -2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 62, 1 },
+    { 3, -2 },
+    { 11, 1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -3 },
+    { 20, 1 },
+    { 21, -3 },
+    { 23, -4 },
+    { 38, -2 },
+    { 40, -2 },
+    { 117, -2 },
+    { 118, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, 1 },
+    { 21, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 62, 1 },
+    { 117, -1 },
+    { 3, 2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 19, 1 },
+    { 21, 1 },
+    { 25, -1 },
+    { 26, 1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, 1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 46, -2 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 2 },
+    { 54, 2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, 1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 62, 2 },
+    { 63, 1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 1, 1 },
+    { 3, 2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -4 },
+    { 11, -4 },
+    { 15, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 32, 1 },
+    { 35, -1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 46, -5 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 62, 1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 117, 1 },
+    { 118, 1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -2 },
+    { 9, 1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, 3 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 24, 2 },
+    { 29, 1 },
+    { 32, 3 },
+    { 36, 1 },
+    { 40, 1 },
+    { 42, 2 },
+    { 46, -3 },
+    { 48, -1 },
+    { 60, 1 },
+    { 62, 3 },
+    { 3, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 15, 1 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, 1 },
+    { 21, -3 },
+    { 26, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 46, 1 },
+    { 47, -1 },
+    { 117, -2 },
+    { 118, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 11, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 29, -2 },
+    { 38, -1 },
+    { 40, -1 },
+    { 46, -1 },
+    { 60, -2 },
+    { 4, -4 },
+    { 5, -1 },
+    { 6, -4 },
+    { 7, -5 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -4 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 25, -2 },
+    { 27, -2 },
+    { 29, -2 },
+    { 35, -3 },
+    { 41, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -4 },
+    { 47, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -2 },
+    { 56, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -1 },
+    { 117, 1 },
+    { 118, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 11, -2 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 22, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 29, -2 },
+    { 35, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 46, -3 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 62, 1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 3, 1 },
+    { 4, -5 },
+    { 5, -2 },
+    { 6, -5 },
+    { 7, -5 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -5 },
+    { 13, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 21, 1 },
+    { 25, -3 },
+    { 26, 1 },
+    { 27, -3 },
+    { 28, -1 },
+    { 29, -3 },
+    { 30, 1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -3 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, 1 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -5 },
+    { 47, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -3 },
+    { 53, 2 },
+    { 54, 2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, 1 },
+    { 58, -2 },
+    { 59, -3 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 2 },
+    { 63, 1 },
+    { 64, -1 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -1 },
+    { 118, 1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 13, -1 },
+    { 15, 1 },
+    { 26, 1 },
+    { 30, 1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 46, 1 },
+    { 47, 1 },
+    { 53, 2 },
+    { 54, 2 },
+    { 57, 1 },
+    { 61, 1 },
+    { 62, 2 },
+    { 63, 1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 5, -2 },
+    { 6, -3 },
+    { 7, -4 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -4 },
+    { 13, -2 },
+    { 15, -1 },
+    { 16, -2 },
+    { 21, 1 },
+    { 25, -3 },
+    { 26, 1 },
+    { 27, -3 },
+    { 28, -1 },
+    { 29, -4 },
+    { 30, 1 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -3 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, 1 },
+    { 43, -2 },
+    { 44, -2 },
+    { 46, -4 },
+    { 47, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 53, 2 },
+    { 54, 2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, 1 },
+    { 58, -1 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, 1 },
+    { 62, 2 },
+    { 63, 1 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 118, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 62, 1 },
+    { 14, 2 },
+    { 32, 2 },
+    { 40, 2 },
+    { 53, 1 },
+    { 54, 1 },
+    { 62, 2 },
+    { 72, 2 },
+    { 95, 2 },
+    { 103, 1 },
+    { 104, 2 },
+    { 105, 2 },
+    { 116, 2 },
+    { 13, -1 },
+    { 17, -3 },
+    { 18, -2 },
+    { 19, -4 },
+    { 21, -3 },
+    { 27, -1 },
+    { 29, 1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 69, -3 },
+    { 70, -1 },
+    { 74, -2 },
+    { 82, -4 },
+    { 89, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 105, -1 },
+    { 106, -4 },
+    { 109, -3 },
+    { 110, -2 },
+    { 116, -1 },
+    { 3, -2 },
+    { 10, -1 },
+    { 23, -4 },
+    { 37, -1 },
+    { 38, -2 },
+    { 40, -2 },
+    { 117, -2 },
+    { 118, -1 },
+    { 2, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -2 },
+    { 10, -1 },
+    { 23, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 63, 1 },
+    { 117, -2 },
+    { 118, -1 },
+    { 23, -2 },
+    { 29, -1 },
+    { 60, -1 },
+    { 118, 1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 117, -1 },
+    { 10, -1 },
+    { 23, -2 },
+    { 38, -1 },
+    { 40, -1 },
+    { 63, 1 },
+    { 117, -1 },
+    { 1, 4 },
+    { 2, 4 },
+    { 3, 4 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 10, 2 },
+    { 23, 4 },
+    { 24, 3 },
+    { 27, -1 },
+    { 29, -1 },
+    { 31, 1 },
+    { 32, 2 },
+    { 35, -1 },
+    { 42, 4 },
+    { 49, 1 },
+    { 50, 2 },
+    { 51, 2 },
+    { 52, 3 },
+    { 53, 3 },
+    { 54, 5 },
+    { 56, -1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 4 },
+    { 62, 4 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 2 },
+    { 117, 3 },
+    { 118, 3 },
+    { 1, 1 },
+    { 3, 1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 62, 1 },
+    { 117, 1 },
+    { 118, 2 },
+    { 3, -2 },
+    { 10, -1 },
+    { 23, -3 },
+    { 38, -2 },
+    { 40, -2 },
+    { 117, -2 },
+    { 118, -1 },
+    { 29, 1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 60, 1 },
+    { 117, -1 },
+    { 29, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 60, -1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 10, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 117, -1 },
+    { 118, -1 },
+    { 10, -1 },
+    { 23, -2 },
+    { 32, 3 },
+    { 38, -1 },
+    { 40, 1 },
+    { 62, 3 },
+    { 117, -1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -2 },
+    { 10, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 35, -1 },
+    { 36, 1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 117, 1 },
+    { 118, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 29, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 117, -1 },
+    { 23, -1 },
+    { 32, 1 },
+    { 117, 1 },
+    { 118, 1 },
+    { 10, -1 },
+    { 23, -2 },
+    { 38, -1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 117, -1 },
+    { 118, -1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -2 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, 1 },
+    { 29, -2 },
+    { 30, -1 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, -1 },
+    { 36, 1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, 2 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 117, 2 },
+    { 118, 2 },
+    { 3, 1 },
+    { 27, -1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 117, 1 },
+    { 118, 2 },
+    { 23, -1 },
+    { 14, 3 },
+    { 19, 1 },
+    { 21, 1 },
+    { 32, 2 },
+    { 38, 1 },
+    { 40, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 62, 2 },
+    { 72, 3 },
+    { 95, 1 },
+    { 103, 1 },
+    { 104, 2 },
+    { 105, 1 },
+    { 106, 1 },
+    { 109, 1 },
+    { 116, 1 },
+    { 14, 2 },
+    { 19, -1 },
+    { 21, -1 },
+    { 32, 2 },
+    { 72, 2 },
+    { 104, 2 },
+    { 106, -1 },
+    { 109, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -2 },
+    { 57, -1 },
+    { 69, -1 },
+    { 82, -1 },
+    { 106, -1 },
+    { 109, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 17, -1 },
+    { 19, -2 },
+    { 21, -2 },
+    { 46, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -1 },
+    { 82, -1 },
+    { 90, -1 },
+    { 106, -2 },
+    { 109, -2 },
+    { 112, -2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, 1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -3 },
+    { 21, -2 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 32, 1 },
+    { 33, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -2 },
+    { 70, -1 },
+    { 72, 1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 100, -1 },
+    { 101, -2 },
+    { 104, 1 },
+    { 106, -2 },
+    { 109, -2 },
+    { 116, -1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 36, 1 },
+    { 46, -3 },
+    { 48, -1 },
+    { 2, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -4 },
+    { 10, -1 },
+    { 11, -3 },
+    { 12, -2 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -3 },
+    { 20, -3 },
+    { 21, -3 },
+    { 23, -2 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 35, -1 },
+    { 46, -4 },
+    { 49, -1 },
+    { 50, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 3, -1 },
+    { 7, -1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 40, -2 },
+    { 64, -1 },
+    { 117, -2 },
+    { 118, -1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 26, 2 },
+    { 30, 2 },
+    { 42, 1 },
+    { 53, 2 },
+    { 54, 2 },
+    { 57, 2 },
+    { 61, 2 },
+    { 63, 2 },
+    { 117, 1 },
+    { 118, 1 },
+    { 1, -2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 7, 1 },
+    { 10, -2 },
+    { 11, 1 },
+    { 13, -1 },
+    { 14, 1 },
+    { 17, -4 },
+    { 18, -2 },
+    { 19, -4 },
+    { 21, -4 },
+    { 23, -4 },
+    { 26, -1 },
+    { 32, 2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -3 },
+    { 39, 1 },
+    { 40, -3 },
+    { 43, -1 },
+    { 46, 1 },
+    { 47, 1 },
+    { 62, 2 },
+    { 117, -4 },
+    { 118, -3 },
+    { 3, -2 },
+    { 10, -1 },
+    { 23, -4 },
+    { 32, 3 },
+    { 37, -1 },
+    { 38, -2 },
+    { 40, -2 },
+    { 62, 3 },
+    { 117, -2 },
+    { 118, -1 },
+    { 2, 3 },
+    { 3, 3 },
+    { 10, 2 },
+    { 23, 2 },
+    { 24, 2 },
+    { 26, 4 },
+    { 28, 2 },
+    { 30, 4 },
+    { 31, 2 },
+    { 32, 2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 42, 3 },
+    { 50, 2 },
+    { 52, 2 },
+    { 57, 4 },
+    { 61, 4 },
+    { 62, 3 },
+    { 63, 4 },
+    { 64, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 117, 2 },
+    { 118, 3 },
+    { 38, -1 },
+    { 40, -1 },
+    { 32, 1 },
+    { 118, 1 },
+    { 10, -1 },
+    { 23, -2 },
+    { 32, 2 },
+    { 38, -1 },
+    { 40, -1 },
+    { 62, 2 },
+    { 63, 1 },
+    { 117, -1 },
+    { 29, 1 },
+    { 32, 4 },
+    { 38, -1 },
+    { 40, -1 },
+    { 60, 1 },
+    { 62, 4 },
+    { 117, -1 },
+    { 26, 2 },
+    { 29, -1 },
+    { 30, 2 },
+    { 57, 2 },
+    { 60, -1 },
+    { 61, 2 },
+    { 63, 2 },
+    { 10, -1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 2 },
+    { 52, 1 },
+    { 64, 1 },
+    { 117, -1 },
+    { 118, -1 },
+    { 23, -1 },
+    { 32, 2 },
+    { 117, 1 },
+    { 118, 1 },
+    { 117, 1 },
+    { 10, -1 },
+    { 23, -2 },
+    { 32, 3 },
+    { 38, -1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 62, 3 },
+    { 117, -1 },
+    { 118, -1 },
+    { 110, -1 },
+    { 118, 1 },
+    { 3, -2 },
+    { 23, -4 },
+    { 69, -2 },
+    { 74, -2 },
+    { 80, -1 },
+    { 82, -2 },
+    { 95, -1 },
+    { 97, -1 },
+    { 105, -1 },
+    { 106, -3 },
+    { 109, -2 },
+    { 110, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 118, -1 },
+    { 80, -1 },
+    { 110, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 75, -1 },
+    { 77, -1 },
+    { 84, -1 },
+    { 88, -2 },
+    { 90, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 112, -1 },
+    { 116, -1 },
+    { 43, -1 },
+    { 70, -1 },
+    { 80, -2 },
+    { 89, -1 },
+    { 94, -1 },
+    { 97, -1 },
+    { 103, 1 },
+    { 110, -2 },
+    { 111, -2 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 70, -1 },
+    { 73, -2 },
+    { 75, -2 },
+    { 76, -1 },
+    { 80, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 98, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 110, -2 },
+    { 111, -2 },
+    { 112, -2 },
+    { 116, -1 },
+    { 3, -2 },
+    { 5, 1 },
+    { 23, -2 },
+    { 69, -3 },
+    { 72, -1 },
+    { 74, -3 },
+    { 76, -1 },
+    { 77, -1 },
+    { 82, -4 },
+    { 84, -1 },
+    { 85, 1 },
+    { 86, 1 },
+    { 88, -1 },
+    { 89, 1 },
+    { 90, -1 },
+    { 94, -1 },
+    { 95, -2 },
+    { 96, -1 },
+    { 97, -1 },
+    { 99, -1 },
+    { 105, -2 },
+    { 106, -3 },
+    { 109, -3 },
+    { 110, -1 },
+    { 116, -2 },
+    { 117, -2 },
+    { 118, -1 },
+    { 3, -3 },
+    { 23, -5 },
+    { 69, -3 },
+    { 70, -1 },
+    { 74, -2 },
+    { 80, -2 },
+    { 82, -4 },
+    { 86, -1 },
+    { 94, -2 },
+    { 95, -3 },
+    { 97, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 109, -4 },
+    { 110, -3 },
+    { 111, -2 },
+    { 116, -3 },
+    { 117, -2 },
+    { 118, -2 },
+    { 5, -1 },
+    { 43, -1 },
+    { 69, -2 },
+    { 70, -2 },
+    { 74, -1 },
+    { 75, 1 },
+    { 78, -1 },
+    { 80, -3 },
+    { 82, -2 },
+    { 86, -1 },
+    { 89, -1 },
+    { 94, -2 },
+    { 95, -2 },
+    { 97, -2 },
+    { 105, -2 },
+    { 106, -1 },
+    { 109, -1 },
+    { 110, -3 },
+    { 111, -3 },
+    { 113, -1 },
+    { 114, -1 },
+    { 116, -2 },
+    { 117, -1 },
+    { 4, -5 },
+    { 5, -2 },
+    { 6, -5 },
+    { 7, -4 },
+    { 43, -3 },
+    { 44, -2 },
+    { 70, -3 },
+    { 71, -2 },
+    { 73, -3 },
+    { 74, 1 },
+    { 75, -6 },
+    { 76, -4 },
+    { 77, -1 },
+    { 78, -2 },
+    { 79, -2 },
+    { 80, -3 },
+    { 83, -1 },
+    { 84, -3 },
+    { 85, -4 },
+    { 87, -3 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -4 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -3 },
+    { 99, -6 },
+    { 100, 1 },
+    { 101, -3 },
+    { 103, 2 },
+    { 105, -2 },
+    { 106, 1 },
+    { 108, 1 },
+    { 109, 2 },
+    { 110, -1 },
+    { 111, -4 },
+    { 112, -6 },
+    { 113, -1 },
+    { 114, -3 },
+    { 116, -2 },
+    { 118, 1 },
+    { 1, -2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 7, 1 },
+    { 10, -2 },
+    { 23, -4 },
+    { 43, -1 },
+    { 69, -4 },
+    { 70, -1 },
+    { 74, -2 },
+    { 75, 1 },
+    { 76, 1 },
+    { 77, 1 },
+    { 80, -2 },
+    { 82, -5 },
+    { 86, -1 },
+    { 88, 1 },
+    { 92, 1 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, 1 },
+    { 97, -3 },
+    { 105, -2 },
+    { 106, -4 },
+    { 109, -3 },
+    { 110, -3 },
+    { 111, -2 },
+    { 112, 1 },
+    { 116, -2 },
+    { 117, -4 },
+    { 118, -3 },
+    { 69, -1 },
+    { 75, -1 },
+    { 77, -1 },
+    { 82, -1 },
+    { 84, -1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 99, -1 },
+    { 110, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, -2 },
+    { 69, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 86, 1 },
+    { 88, -1 },
+    { 89, 1 },
+    { 106, -1 },
+    { 109, -1 },
+    { 112, -1 },
+    { 4, -4 },
+    { 5, -1 },
+    { 6, -4 },
+    { 7, -5 },
+    { 8, -1 },
+    { 9, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 73, -3 },
+    { 75, -4 },
+    { 76, -3 },
+    { 77, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 84, -2 },
+    { 85, -2 },
+    { 88, -3 },
+    { 89, -2 },
+    { 91, -1 },
+    { 92, -3 },
+    { 98, -1 },
+    { 99, -3 },
+    { 101, -3 },
+    { 103, 1 },
+    { 110, -1 },
+    { 111, -3 },
+    { 112, -4 },
+    { 114, -1 },
+    { 117, 1 },
+    { 118, 1 },
+    { 43, -1 },
+    { 70, -1 },
+    { 72, 2 },
+    { 75, 1 },
+    { 80, -2 },
+    { 81, 1 },
+    { 89, -1 },
+    { 94, -1 },
+    { 97, -1 },
+    { 104, 2 },
+    { 110, -2 },
+    { 111, -2 },
+    { 69, -1 },
+    { 73, 1 },
+    { 74, -1 },
+    { 80, -1 },
+    { 81, 1 },
+    { 82, -1 },
+    { 95, -1 },
+    { 103, 1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 111, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 23, -1 },
+    { 68, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 84, -1 },
+    { 88, -2 },
+    { 92, -2 },
+    { 99, -2 },
+    { 106, -1 },
+    { 109, -1 },
+    { 112, -3 },
+    { 1, 1 },
+    { 3, 2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -4 },
+    { 68, -1 },
+    { 73, -2 },
+    { 75, -4 },
+    { 76, -3 },
+    { 77, -1 },
+    { 79, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 88, -2 },
+    { 89, -1 },
+    { 92, -1 },
+    { 95, 1 },
+    { 99, -2 },
+    { 101, -1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 112, -5 },
+    { 116, 1 },
+    { 117, 1 },
+    { 118, 1 },
+    { 5, -1 },
+    { 70, -1 },
+    { 80, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 101, -1 },
+    { 4, -2 },
+    { 5, 1 },
+    { 6, -2 },
+    { 7, -2 },
+    { 68, -1 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -3 },
+    { 77, -3 },
+    { 78, -1 },
+    { 79, -1 },
+    { 81, -2 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 88, -2 },
+    { 92, -1 },
+    { 99, -1 },
+    { 106, -1 },
+    { 109, -1 },
+    { 112, -3 },
+    { 3, 1 },
+    { 5, -1 },
+    { 70, -1 },
+    { 76, 1 },
+    { 79, 1 },
+    { 80, -2 },
+    { 81, 1 },
+    { 88, 1 },
+    { 92, 1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 96, 1 },
+    { 97, -2 },
+    { 100, 1 },
+    { 103, 2 },
+    { 105, -1 },
+    { 110, -3 },
+    { 111, -2 },
+    { 112, 1 },
+    { 116, -1 },
+    { 3, -2 },
+    { 10, -1 },
+    { 23, -4 },
+    { 92, 1 },
+    { 94, -1 },
+    { 95, -2 },
+    { 97, -2 },
+    { 105, -2 },
+    { 111, -1 },
+    { 116, -2 },
+    { 117, -2 },
+    { 118, -1 },
+    { 2, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -2 },
+    { 10, -1 },
+    { 23, -2 },
+    { 88, -1 },
+    { 90, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 99, -1 },
+    { 105, -1 },
+    { 116, -1 },
+    { 117, -2 },
+    { 118, -1 },
+    { 90, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 99, -1 },
+    { 105, -1 },
+    { 116, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 85, -1 },
+    { 88, -2 },
+    { 92, -2 },
+    { 93, 1 },
+    { 99, -2 },
+    { 118, 1 },
+    { 23, -1 },
+    { 104, 2 },
+    { 105, 1 },
+    { 111, -1 },
+    { 116, 1 },
+    { 10, -1 },
+    { 23, -2 },
+    { 90, -1 },
+    { 99, -1 },
+    { 117, -1 },
+    { 23, -1 },
+    { 43, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 95, -1 },
+    { 105, -1 },
+    { 111, -2 },
+    { 116, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 23, -2 },
+    { 88, -1 },
+    { 90, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 105, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 111, -1 },
+    { 23, -2 },
+    { 99, -1 },
+    { 118, 1 },
+    { 3, 1 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -2 },
+    { 85, -1 },
+    { 88, -2 },
+    { 89, -1 },
+    { 92, -2 },
+    { 94, 1 },
+    { 97, 1 },
+    { 99, -2 },
+    { 100, -1 },
+    { 101, -1 },
+    { 102, 1 },
+    { 104, 2 },
+    { 117, 2 },
+    { 118, 2 },
+    { 3, 1 },
+    { 89, -1 },
+    { 93, 1 },
+    { 95, 1 },
+    { 105, 1 },
+    { 111, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 118, 2 },
+    { 3, -1 },
+    { 23, -4 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, -1 },
+    { 97, -3 },
+    { 99, -1 },
+    { 105, -3 },
+    { 111, -1 },
+    { 116, -3 },
+    { 117, -1 },
+    { 118, -2 },
+    { 3, -2 },
+    { 10, -1 },
+    { 23, -3 },
+    { 95, -2 },
+    { 97, -2 },
+    { 99, -1 },
+    { 105, -2 },
+    { 111, -1 },
+    { 115, -1 },
+    { 116, -2 },
+    { 117, -2 },
+    { 118, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 85, -1 },
+    { 96, -1 },
+    { 99, -1 },
+    { 117, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 105, -1 },
+    { 111, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 42, 1 },
+    { 100, 2 },
+    { 103, 2 },
+    { 117, 1 },
+    { 118, 1 },
+    { 3, -2 },
+    { 10, -1 },
+    { 23, -3 },
+    { 95, -2 },
+    { 97, -2 },
+    { 105, -2 },
+    { 111, -1 },
+    { 115, -1 },
+    { 116, -2 },
+    { 117, -2 },
+    { 118, -1 },
+    { 5, 1 },
+    { 23, -2 },
+    { 69, -1 },
+    { 74, -2 },
+    { 77, -1 },
+    { 82, -2 },
+    { 106, -2 },
+    { 109, -2 },
+    { 110, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 97, -2 },
+    { 99, -1 },
+    { 105, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 4, -4 },
+    { 5, -2 },
+    { 6, -4 },
+    { 43, -1 },
+    { 44, -1 },
+    { 70, -1 },
+    { 73, -3 },
+    { 74, 1 },
+    { 75, -5 },
+    { 76, -4 },
+    { 77, -2 },
+    { 78, -1 },
+    { 80, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 87, -2 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -2 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 98, -3 },
+    { 99, -3 },
+    { 101, -3 },
+    { 109, 1 },
+    { 110, -2 },
+    { 111, -3 },
+    { 112, -6 },
+    { 114, -2 },
+    { 117, 1 },
+    { 118, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 88, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 95, 2 },
+    { 97, 1 },
+    { 99, -1 },
+    { 104, 1 },
+    { 105, 2 },
+    { 116, 2 },
+    { 117, 1 },
+    { 118, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -3 },
+    { 70, -1 },
+    { 71, -2 },
+    { 73, -3 },
+    { 75, -4 },
+    { 76, -3 },
+    { 77, -1 },
+    { 80, -2 },
+    { 84, -2 },
+    { 85, -3 },
+    { 87, -2 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -2 },
+    { 91, -2 },
+    { 92, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -2 },
+    { 99, -3 },
+    { 101, -3 },
+    { 105, -1 },
+    { 110, -3 },
+    { 111, -4 },
+    { 112, -4 },
+    { 114, -2 },
+    { 115, -2 },
+    { 116, -1 },
+    { 117, 1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 88, -2 },
+    { 89, -1 },
+    { 92, -2 },
+    { 99, -2 },
+    { 101, -1 },
+    { 118, 1 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -3 },
+    { 73, -2 },
+    { 75, -3 },
+    { 76, -3 },
+    { 79, -1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 88, -3 },
+    { 89, -1 },
+    { 92, -2 },
+    { 99, -3 },
+    { 101, -1 },
+    { 103, 2 },
+    { 110, -1 },
+    { 111, -1 },
+    { 112, -4 },
+    { 117, 1 },
+    { 118, 1 },
+    { 43, -1 },
+    { 69, -2 },
+    { 70, -1 },
+    { 72, 2 },
+    { 74, -1 },
+    { 78, -1 },
+    { 80, -3 },
+    { 81, 1 },
+    { 82, -2 },
+    { 86, -1 },
+    { 89, -1 },
+    { 94, -2 },
+    { 95, 1 },
+    { 97, -2 },
+    { 104, 2 },
+    { 105, 1 },
+    { 109, -1 },
+    { 110, -3 },
+    { 111, -3 },
+    { 112, 1 },
+    { 113, -1 },
+    { 114, -1 },
+    { 116, 1 },
+    { 117, -1 },
+    { 43, -1 },
+    { 89, -1 },
+    { 95, 1 },
+    { 104, 2 },
+    { 105, 1 },
+    { 111, -2 },
+    { 116, 1 },
+    { 69, -2 },
+    { 74, -1 },
+    { 82, -2 },
+    { 106, -2 },
+    { 109, -2 },
+    { 110, -2 },
+    { 117, -1 },
+    { 23, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 105, -1 },
+    { 116, -1 },
+    { 117, -2 },
+    { 3, 1 },
+    { 4, -3 },
+    { 5, -2 },
+    { 6, -3 },
+    { 7, -4 },
+    { 8, -1 },
+    { 9, -1 },
+    { 42, 1 },
+    { 43, -2 },
+    { 44, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 73, -3 },
+    { 74, 1 },
+    { 75, -3 },
+    { 76, -3 },
+    { 77, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 84, -2 },
+    { 85, -2 },
+    { 87, -1 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -2 },
+    { 92, -3 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -1 },
+    { 98, -2 },
+    { 99, -4 },
+    { 100, 1 },
+    { 101, -2 },
+    { 103, 2 },
+    { 105, -1 },
+    { 106, 1 },
+    { 109, 1 },
+    { 110, -2 },
+    { 111, -3 },
+    { 112, -4 },
+    { 114, -2 },
+    { 115, -1 },
+    { 116, -1 },
+    { 118, 1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 70, -1 },
+    { 72, 2 },
+    { 76, 1 },
+    { 77, 1 },
+    { 79, 1 },
+    { 80, -2 },
+    { 81, 1 },
+    { 84, 1 },
+    { 88, 1 },
+    { 90, 2 },
+    { 92, 1 },
+    { 94, -2 },
+    { 95, 2 },
+    { 96, 1 },
+    { 97, -2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 102, 1 },
+    { 103, 2 },
+    { 104, 2 },
+    { 105, 2 },
+    { 108, 2 },
+    { 110, -3 },
+    { 111, -2 },
+    { 112, 1 },
+    { 116, 2 },
+    { 3, 1 },
+    { 89, -1 },
+    { 93, 1 },
+    { 95, 1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 111, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 118, 2 },
+    { 23, -5 },
+    { 69, -3 },
+    { 70, -1 },
+    { 74, -2 },
+    { 80, -2 },
+    { 82, -4 },
+    { 94, -2 },
+    { 95, -2 },
+    { 97, -3 },
+    { 105, -2 },
+    { 106, -4 },
+    { 109, -4 },
+    { 110, -2 },
+    { 111, -2 },
+    { 116, -2 },
+    { 76, -1 },
+    { 77, -1 },
+    { 84, -1 },
+    { 77, -1 },
+    { 110, -1 },
+    { 94, -1 },
+    { 111, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 85, -1 },
+    { 88, -2 },
+    { 89, -1 },
+    { 92, -2 },
+    { 99, -2 },
+    { 100, -1 },
+    { 101, -1 },
+    { 111, -1 },
+    { 10, -1 },
+    { 95, -1 },
+    { 105, -1 },
+    { 116, -1 },
+    { 117, -1 },
+    { 118, -1 },
+    { 77, -1 },
+    { 99, -1 },
+    { 89, -1 },
+    { 111, -1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 70, -2 },
+    { 76, 1 },
+    { 79, 1 },
+    { 80, -2 },
+    { 81, 1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 88, 1 },
+    { 89, -1 },
+    { 92, 1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 96, 1 },
+    { 97, -2 },
+    { 98, -1 },
+    { 100, 1 },
+    { 101, -1 },
+    { 103, 2 },
+    { 105, -1 },
+    { 110, -3 },
+    { 111, -4 },
+    { 114, -1 },
+    { 116, -1 },
+    { 3, 1 },
+    { 89, -1 },
+    { 93, 1 },
+    { 95, 1 },
+    { 104, 2 },
+    { 105, 1 },
+    { 111, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 118, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 11, -3 },
+    { 17, 2 },
+    { 19, 1 },
+    { 21, 1 },
+    { 26, 1 },
+    { 27, -1 },
+    { 29, -2 },
+    { 30, 1 },
+    { 35, -1 },
+    { 38, 2 },
+    { 39, 2 },
+    { 40, 2 },
+    { 45, -4 },
+    { 46, -4 },
+    { 51, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, 1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 69, 2 },
+    { 73, -2 },
+    { 74, 1 },
+    { 75, -3 },
+    { 76, -2 },
+    { 84, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 92, -2 },
+    { 95, 2 },
+    { 96, 2 },
+    { 99, -2 },
+    { 100, 1 },
+    { 101, -1 },
+    { 103, 1 },
+    { 105, 2 },
+    { 106, 1 },
+    { 107, 1 },
+    { 109, 1 },
+    { 112, -4 },
+    { 116, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 11, -4 },
+    { 13, -2 },
+    { 16, -1 },
+    { 19, 1 },
+    { 21, 1 },
+    { 25, -2 },
+    { 26, 1 },
+    { 27, -3 },
+    { 29, -3 },
+    { 30, 1 },
+    { 35, -3 },
+    { 41, -1 },
+    { 46, -6 },
+    { 47, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -3 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, 1 },
+    { 58, -2 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 73, -3 },
+    { 75, -4 },
+    { 76, -3 },
+    { 77, -1 },
+    { 84, -2 },
+    { 85, -2 },
+    { 88, -3 },
+    { 89, -3 },
+    { 92, -3 },
+    { 99, -3 },
+    { 100, 1 },
+    { 101, -3 },
+    { 103, 1 },
+    { 106, 1 },
+    { 109, 1 },
+    { 111, -1 },
+    { 112, -6 },
+    { 11, 1 },
+    { 13, -2 },
+    { 14, 1 },
+    { 17, -3 },
+    { 18, -2 },
+    { 19, -5 },
+    { 21, -3 },
+    { 27, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -3 },
+    { 40, -1 },
+    { 47, -2 },
+    { 51, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 69, -3 },
+    { 70, -2 },
+    { 72, 1 },
+    { 74, -2 },
+    { 75, 1 },
+    { 80, -1 },
+    { 82, -4 },
+    { 89, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 96, 1 },
+    { 97, -3 },
+    { 105, -1 },
+    { 106, -5 },
+    { 109, -3 },
+    { 110, -3 },
+    { 111, -2 },
+    { 116, -1 },
+    { 117, -3 },
+    { 118, -2 },
+};
+
 static const EpdFontData bookerly_18_bold = {
     bookerly_18_boldBitmaps,
     bookerly_18_boldGlyphs,
@@ -7839,4 +10232,8 @@ static const EpdFontData bookerly_18_bold = {
     40,
     -10,
     true,
+    bookerly_18_boldKernLeftClasses,
+    bookerly_18_boldKernRightClasses,
+    bookerly_18_boldKernPairOffsets,
+    bookerly_18_boldKernPairs,
 };
@@ -7248,7 +7248,7 @@ static const EpdGlyph bookerly_18_bolditalicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, // 	
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 12, 30, 13, 1, 29, 90, 0 }, // !
@@ -8038,6 +8038,2448 @@ static const EpdUnicodeInterval bookerly_18_bolditalicIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_18_bolditalicKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 3, 4, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    6, 0, 0, 0, 0, 0, 7, 8, 9, 10, 11, 12, 13, 14, 14, 15,
+    16, 17, 18, 19, 10, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 0, 0, 0, 0, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+    43, 44, 40, 40, 34, 34, 45, 46, 47, 48, 33, 49, 49, 50, 49, 51,
+    52, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54,
+    0, 0, 0, 55, 7, 7, 7, 7, 7, 7, 11, 9, 11, 11, 11, 11,
+    14, 14, 14, 14, 10, 19, 10, 10, 10, 10, 10, 0, 10, 25, 25, 25,
+    25, 29, 56, 57, 33, 33, 33, 33, 33, 33, 37, 58, 37, 37, 37, 37,
+    41, 59, 60, 60, 34, 40, 34, 34, 34, 34, 34, 0, 61, 33, 33, 33,
+    33, 49, 34, 49, 7, 33, 7, 33, 62, 63, 9, 35, 9, 35, 9, 35,
+    9, 35, 10, 64, 10, 36, 11, 37, 11, 37, 11, 37, 65, 66, 11, 37,
+    13, 39, 13, 39, 13, 39, 13, 39, 14, 40, 67, 40, 14, 60, 14, 60,
+    14, 60, 68, 69, 14, 33, 15, 42, 15, 70, 16, 43, 71, 17, 44, 17,
+    72, 0, 64, 0, 0, 17, 73, 19, 40, 19, 40, 19, 40, 40, 19, 42,
+    10, 34, 10, 34, 10, 34, 11, 37, 22, 46, 22, 46, 22, 46, 23, 47,
+    23, 47, 23, 74, 23, 47, 24, 75, 24, 0, 24, 48, 25, 33, 25, 33,
+    25, 33, 25, 33, 25, 33, 25, 63, 26, 49, 29, 49, 29, 30, 51, 30,
+    51, 30, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 76, 76, 77, 0, 78, 79, 80, 80, 81, 82, 82,
+    83, 84, 80, 85, 80, 86, 87, 88, 89, 90, 76, 84, 88, 80, 80, 84,
+    80, 91, 80, 92, 80, 93, 94, 95, 85, 96, 97, 90, 80, 80, 90, 82,
+    80, 82, 92, 92, 80, 98, 99, 100, 101, 102, 101, 103, 100, 98, 98, 104,
+    98, 98, 98, 105, 106, 105, 107, 106, 108, 102, 109, 110, 98, 98, 110, 111,
+    98, 112, 105, 105, 98, 101, 101, 113, 101, 107, 114, 115, 116, 117, 112, 112,
+    106, 104, 98, 108, 98, 118, 112, 92, 105, 119, 120, 90, 110, 82, 112, 93,
+    105, 121, 122, 123, 101, 0, 0, 124, 125, 88, 100, 126, 125, 84, 104, 84,
+    104, 84, 104, 90, 110, 0, 0, 0, 0, 127, 128, 94, 107, 89, 110, 129,
+    130, 129, 130, 131, 132, 90, 110, 90, 110, 80, 98, 133, 106, 134, 101, 134,
+    101, 80, 84, 103, 135, 136, 90, 110, 81, 117, 90, 110, 80, 0, 90, 110,
+    137, 86, 98, 86, 98, 76, 101, 76, 101, 92, 105, 92, 105, 84, 103, 88,
+    100, 138, 139, 80, 98, 80, 98, 92, 105, 92, 105, 92, 105, 92, 105, 85,
+    108, 85, 108, 85, 108, 80, 98, 89, 101, 80, 98, 123, 101, 140, 141, 97,
+    109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 4, 4, 4, 0, 0, 142, 143, 144, 142, 142, 143, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_18_bolditalicKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4,
+    0, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    10, 0, 0, 0, 11, 0, 12, 13, 14, 13, 15, 15, 14, 15, 15, 16,
+    15, 15, 17, 15, 14, 13, 14, 13, 1, 18, 19, 20, 20, 21, 22, 23,
+    0, 24, 25, 0, 0, 0, 26, 27, 26, 26, 26, 28, 29, 27, 30, 31,
+    27, 27, 32, 32, 26, 32, 26, 32, 33, 34, 35, 36, 36, 37, 38, 39,
+    0, 0, 40, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 0, 0, 44, 12, 12, 12, 12, 12, 12, 45, 14, 15, 15, 15, 15,
+    15, 15, 15, 15, 13, 15, 14, 14, 14, 14, 14, 0, 14, 19, 19, 19,
+    19, 22, 15, 46, 26, 26, 26, 26, 47, 26, 26, 26, 26, 26, 26, 26,
+    48, 30, 49, 49, 26, 32, 26, 26, 26, 26, 26, 0, 50, 35, 35, 35,
+    35, 36, 51, 36, 12, 26, 12, 26, 12, 26, 14, 26, 14, 26, 14, 26,
+    14, 52, 13, 26, 13, 26, 15, 26, 15, 26, 15, 26, 15, 26, 15, 26,
+    14, 29, 14, 29, 14, 29, 14, 29, 15, 27, 15, 53, 15, 49, 15, 49,
+    15, 49, 15, 30, 15, 32, 15, 30, 16, 54, 15, 27, 32, 15, 27, 15,
+    27, 15, 27, 15, 27, 15, 55, 15, 32, 15, 32, 15, 32, 32, 15, 32,
+    14, 26, 14, 26, 14, 26, 14, 26, 13, 32, 13, 32, 13, 32, 1, 33,
+    1, 33, 1, 33, 1, 56, 18, 34, 18, 34, 18, 34, 19, 35, 19, 35,
+    19, 35, 19, 35, 19, 35, 19, 35, 20, 36, 22, 36, 22, 23, 39, 23,
+    39, 23, 57, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 58, 58, 59, 58, 60, 61, 58, 58, 62, 63, 58,
+    59, 58, 58, 64, 58, 65, 58, 66, 58, 67, 58, 68, 69, 58, 58, 58,
+    70, 71, 58, 60, 58, 66, 60, 59, 64, 72, 73, 58, 74, 58, 58, 59,
+    58, 58, 75, 58, 76, 77, 78, 77, 79, 80, 77, 81, 82, 83, 83, 84,
+    85, 86, 84, 77, 84, 87, 77, 84, 88, 77, 89, 83, 90, 83, 83, 91,
+    83, 83, 82, 84, 92, 77, 77, 93, 79, 77, 94, 95, 96, 97, 85, 84,
+    93, 84, 83, 88, 83, 59, 84, 60, 77, 98, 99, 58, 84, 100, 101, 66,
+    84, 58, 102, 58, 79, 58, 84, 68, 81, 69, 82, 58, 84, 58, 84, 0,
+    0, 59, 0, 58, 84, 58, 84, 58, 84, 60, 77, 60, 77, 59, 84, 103,
+    88, 103, 88, 73, 89, 0, 0, 74, 90, 74, 90, 58, 93, 104, 105, 104,
+    105, 58, 68, 81, 58, 84, 70, 85, 58, 84, 58, 84, 74, 90, 0, 86,
+    106, 65, 77, 65, 77, 107, 77, 58, 77, 108, 109, 0, 109, 68, 81, 69,
+    82, 110, 111, 58, 83, 58, 83, 60, 77, 60, 77, 60, 77, 0, 82, 64,
+    88, 64, 88, 64, 88, 0, 90, 58, 79, 58, 83, 58, 79, 73, 89, 73,
+    89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 0, 6, 6, 6, 0, 0, 112, 113, 7, 112, 112, 113, 7,
+    0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 1, 0, 0, 0,
+    11, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_18_bolditalicKernPairOffsets[145] = {
+    0, 23, 27, 78, 80, 131, 135, 161, 174, 177, 193, 196, 220, 229, 246, 267,
+    290, 301, 311, 335, 357, 378, 399, 405, 432, 454, 484, 514, 539, 574, 581, 592,
+    642, 646, 654, 658, 662, 664, 689, 711, 719, 723, 727, 731, 734, 742, 755, 761,
+    766, 773, 780, 786, 808, 823, 834, 857, 873, 874, 880, 888, 899, 912, 941, 948,
+    976, 982, 986, 1006, 1026, 1033, 1039, 1044, 1049, 1057, 1065, 1072, 1076, 1095, 1096, 1105,
+    1127, 1153, 1169, 1194, 1226, 1270, 1306, 1311, 1328, 1362, 1370, 1392, 1415, 1444, 1451, 1485,
+    1512, 1542, 1550, 1561, 1564, 1566, 1577, 1579, 1584, 1595, 1605, 1609, 1620, 1630, 1642, 1654,
+    1666, 1677, 1686, 1689, 1697, 1702, 1711, 1743, 1757, 1793, 1812, 1836, 1852, 1862, 1879, 1895,
+    1899, 1946, 1958, 1994, 2009, 2031, 2035, 2076, 2080, 2089, 2096, 2102, 2144, 2159, 2205, 2279,
+    2328,
+};
+
+static const EpdKernPair bookerly_18_bolditalicKernPairs[] = {
+    { 14, -1 },
+    { 16, 4 },
+    { 26, -1 },
+    { 27, 3 },
+    { 28, 6 },
+    { 31, 6 },
+    { 38, 3 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 3 },
+    { 52, -1 },
+    { 53, 3 },
+    { 55, 3 },
+    { 60, -1 },
+    { 62, 4 },
+    { 67, 1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 85, -1 },
+    { 88, 3 },
+    { 93, 3 },
+    { 97, 6 },
+    { 99, 3 },
+    { 12, -2 },
+    { 45, -3 },
+    { 65, -2 },
+    { 107, -3 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 4 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -2 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 31, 4 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -2 },
+    { 45, 1 },
+    { 48, -1 },
+    { 58, 1 },
+    { 59, -2 },
+    { 60, -1 },
+    { 62, 4 },
+    { 63, 2 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 68, 2 },
+    { 70, 2 },
+    { 72, -1 },
+    { 73, 2 },
+    { 74, -3 },
+    { 76, 2 },
+    { 78, -1 },
+    { 83, -1 },
+    { 88, -2 },
+    { 90, -2 },
+    { 91, -3 },
+    { 95, -1 },
+    { 97, 4 },
+    { 98, -4 },
+    { 99, -2 },
+    { 101, -1 },
+    { 103, -2 },
+    { 104, -4 },
+    { 105, -1 },
+    { 107, 1 },
+    { 112, -4 },
+    { 113, -4 },
+    { 22, -1 },
+    { 103, -1 },
+    { 12, -3 },
+    { 14, -1 },
+    { 17, -2 },
+    { 26, -4 },
+    { 27, 1 },
+    { 28, -2 },
+    { 29, -4 },
+    { 32, -1 },
+    { 33, -3 },
+    { 34, -1 },
+    { 35, -2 },
+    { 37, -2 },
+    { 39, -2 },
+    { 45, -5 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, 1 },
+    { 52, -4 },
+    { 53, 1 },
+    { 55, 1 },
+    { 56, -3 },
+    { 57, -2 },
+    { 60, -1 },
+    { 63, -1 },
+    { 65, -3 },
+    { 67, -2 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 76, -2 },
+    { 77, -4 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -1 },
+    { 89, -2 },
+    { 91, -1 },
+    { 92, -3 },
+    { 93, 1 },
+    { 94, -3 },
+    { 102, -2 },
+    { 105, -2 },
+    { 107, -5 },
+    { 109, -2 },
+    { 111, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 88, 1 },
+    { 99, 1 },
+    { 4, -2 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -2 },
+    { 15, 1 },
+    { 17, 2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -3 },
+    { 24, -6 },
+    { 29, 1 },
+    { 30, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -1 },
+    { 45, 2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 112, -4 },
+    { 113, -3 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 24, -2 },
+    { 29, -1 },
+    { 45, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 14, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -2 },
+    { 14, 1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -1 },
+    { 24, -2 },
+    { 45, -1 },
+    { 46, -1 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 17, -1 },
+    { 21, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 42, -1 },
+    { 45, -4 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 113, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 12, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -1 },
+    { 24, -1 },
+    { 112, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 14, -1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 34, -1 },
+    { 37, -1 },
+    { 42, -2 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -1 },
+    { 13, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 2 },
+    { 45, -1 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 51, 2 },
+    { 52, -1 },
+    { 53, 2 },
+    { 55, 2 },
+    { 4, 1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 21, 2 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -2 },
+    { 45, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 2 },
+    { 52, -1 },
+    { 53, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 4, -2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 24, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 112, -2 },
+    { 113, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, 2 },
+    { 24, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 112, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 12, -2 },
+    { 14, -1 },
+    { 21, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -2 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -4 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 45, -5 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 3, 7 },
+    { 5, 7 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, 7 },
+    { 12, -2 },
+    { 14, 1 },
+    { 16, 4 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -1 },
+    { 24, -2 },
+    { 25, 8 },
+    { 29, 2 },
+    { 31, 2 },
+    { 40, 7 },
+    { 45, -1 },
+    { 46, -1 },
+    { 4, -1 },
+    { 6, -2 },
+    { 12, 2 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 17, 2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 2 },
+    { 22, -2 },
+    { 24, -4 },
+    { 28, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -2 },
+    { 45, 2 },
+    { 112, -2 },
+    { 113, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 18, -1 },
+    { 24, -1 },
+    { 4, 3 },
+    { 5, -4 },
+    { 7, -4 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 45, -3 },
+    { 47, -2 },
+    { 50, -2 },
+    { 51, 1 },
+    { 52, -2 },
+    { 53, 2 },
+    { 55, 1 },
+    { 56, -1 },
+    { 112, 1 },
+    { 113, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 24, 1 },
+    { 26, -2 },
+    { 27, 2 },
+    { 29, -2 },
+    { 33, -1 },
+    { 37, -1 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -2 },
+    { 50, -2 },
+    { 51, 2 },
+    { 52, -2 },
+    { 53, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 4, 1 },
+    { 5, -5 },
+    { 6, -1 },
+    { 7, -5 },
+    { 8, -3 },
+    { 9, -3 },
+    { 10, -3 },
+    { 12, -4 },
+    { 13, 1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 22, 1 },
+    { 24, 2 },
+    { 26, -2 },
+    { 27, 2 },
+    { 29, -2 },
+    { 33, -2 },
+    { 37, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -5 },
+    { 47, -2 },
+    { 49, 1 },
+    { 50, -2 },
+    { 51, 2 },
+    { 52, -2 },
+    { 53, 2 },
+    { 54, 1 },
+    { 55, 2 },
+    { 56, -2 },
+    { 4, 1 },
+    { 5, -5 },
+    { 6, -1 },
+    { 7, -5 },
+    { 8, -3 },
+    { 9, -3 },
+    { 10, -3 },
+    { 12, -4 },
+    { 13, 1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 22, 1 },
+    { 24, 2 },
+    { 26, -2 },
+    { 27, 2 },
+    { 29, -2 },
+    { 33, -2 },
+    { 37, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -5 },
+    { 47, -2 },
+    { 49, 2 },
+    { 50, -2 },
+    { 51, 2 },
+    { 52, -2 },
+    { 53, 2 },
+    { 54, 1 },
+    { 55, 2 },
+    { 56, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 17, 1 },
+    { 21, 2 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 35, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 47, -1 },
+    { 49, 2 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 2, 1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -3 },
+    { 10, -3 },
+    { 12, -4 },
+    { 13, 1 },
+    { 14, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 2 },
+    { 22, 1 },
+    { 24, 2 },
+    { 26, -2 },
+    { 27, 2 },
+    { 28, -1 },
+    { 29, -2 },
+    { 32, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 37, -2 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -4 },
+    { 47, -2 },
+    { 49, 2 },
+    { 50, -2 },
+    { 51, 2 },
+    { 52, -2 },
+    { 53, 2 },
+    { 55, 2 },
+    { 56, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -1 },
+    { 24, -1 },
+    { 16, 2 },
+    { 27, 3 },
+    { 28, 3 },
+    { 31, 3 },
+    { 38, 2 },
+    { 51, 3 },
+    { 53, 3 },
+    { 55, 3 },
+    { 62, 2 },
+    { 93, 3 },
+    { 97, 3 },
+    { 12, 2 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 5 },
+    { 17, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -3 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 3 },
+    { 31, 2 },
+    { 36, -2 },
+    { 37, 1 },
+    { 38, -2 },
+    { 39, 1 },
+    { 45, 1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, -2 },
+    { 60, -1 },
+    { 62, 5 },
+    { 63, 2 },
+    { 65, 2 },
+    { 66, 1 },
+    { 67, 3 },
+    { 68, 2 },
+    { 70, 2 },
+    { 71, 1 },
+    { 72, -1 },
+    { 73, 2 },
+    { 74, -3 },
+    { 76, 2 },
+    { 88, -2 },
+    { 89, 1 },
+    { 90, -3 },
+    { 91, -1 },
+    { 93, 1 },
+    { 97, 2 },
+    { 98, -4 },
+    { 99, -2 },
+    { 103, -3 },
+    { 104, -3 },
+    { 107, 1 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 112, -1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 55, 1 },
+    { 112, -1 },
+    { 24, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 113, 1 },
+    { 8, 1 },
+    { 24, 1 },
+    { 33, 1 },
+    { 56, 1 },
+    { 24, -2 },
+    { 29, -1 },
+    { 3, 2 },
+    { 4, 4 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 11, 2 },
+    { 24, 4 },
+    { 25, 2 },
+    { 26, -1 },
+    { 27, 3 },
+    { 29, -1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, 2 },
+    { 47, -1 },
+    { 48, 3 },
+    { 49, 3 },
+    { 50, -1 },
+    { 51, 3 },
+    { 52, -1 },
+    { 53, 3 },
+    { 54, 1 },
+    { 55, 3 },
+    { 112, 1 },
+    { 113, 3 },
+    { 2, 1 },
+    { 4, 2 },
+    { 7, -1 },
+    { 8, 1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 4 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 2 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 48, 1 },
+    { 49, 2 },
+    { 51, 1 },
+    { 57, 1 },
+    { 112, 2 },
+    { 113, 2 },
+    { 4, -2 },
+    { 8, 1 },
+    { 24, -3 },
+    { 33, 1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 56, 1 },
+    { 112, -1 },
+    { 8, 1 },
+    { 24, 2 },
+    { 33, 1 },
+    { 56, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 2 },
+    { 31, 2 },
+    { 8, 1 },
+    { 24, -1 },
+    { 29, 2 },
+    { 50, 2 },
+    { 8, 1 },
+    { 33, 1 },
+    { 56, 1 },
+    { 3, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 28, 3 },
+    { 29, 1 },
+    { 31, 4 },
+    { 38, 2 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 32, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 113, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 113, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 24, -2 },
+    { 32, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 50, 1 },
+    { 113, 1 },
+    { 3, -1 },
+    { 24, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 50, 1 },
+    { 113, 1 },
+    { 16, 2 },
+    { 26, -2 },
+    { 27, 2 },
+    { 28, 3 },
+    { 31, 4 },
+    { 33, -1 },
+    { 38, 2 },
+    { 47, -2 },
+    { 50, -2 },
+    { 51, 2 },
+    { 52, -2 },
+    { 53, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 62, 2 },
+    { 77, -2 },
+    { 80, -2 },
+    { 88, 2 },
+    { 93, 2 },
+    { 94, -1 },
+    { 97, 4 },
+    { 99, 2 },
+    { 16, 4 },
+    { 20, -2 },
+    { 22, -1 },
+    { 27, -1 },
+    { 28, 2 },
+    { 31, 2 },
+    { 46, 2 },
+    { 51, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 62, 4 },
+    { 93, -1 },
+    { 97, 2 },
+    { 98, -2 },
+    { 103, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 59, -1 },
+    { 72, 1 },
+    { 74, -2 },
+    { 98, -1 },
+    { 103, -1 },
+    { 108, 2 },
+    { 16, 5 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 4 },
+    { 46, 4 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 62, 5 },
+    { 77, -1 },
+    { 80, -1 },
+    { 93, -1 },
+    { 97, 4 },
+    { 98, -2 },
+    { 103, -2 },
+    { 3, -2 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -2 },
+    { 22, -2 },
+    { 24, -4 },
+    { 45, -2 },
+    { 112, -1 },
+    { 24, -2 },
+    { 28, 2 },
+    { 31, 2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 113, 1 },
+    { 8, 1 },
+    { 24, 2 },
+    { 27, 2 },
+    { 33, 1 },
+    { 51, 2 },
+    { 53, 2 },
+    { 55, 2 },
+    { 56, 1 },
+    { 3, 2 },
+    { 4, 2 },
+    { 11, 2 },
+    { 24, 3 },
+    { 27, 3 },
+    { 40, 1 },
+    { 49, 2 },
+    { 51, 3 },
+    { 53, 3 },
+    { 55, 3 },
+    { 113, 1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 32, 2 },
+    { 34, 1 },
+    { 35, 2 },
+    { 36, 2 },
+    { 38, 2 },
+    { 55, 1 },
+    { 112, -1 },
+    { 4, -2 },
+    { 11, -1 },
+    { 12, 1 },
+    { 14, -2 },
+    { 15, 1 },
+    { 16, 5 },
+    { 17, 2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -3 },
+    { 24, -6 },
+    { 28, 4 },
+    { 29, 2 },
+    { 30, -1 },
+    { 31, 6 },
+    { 32, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 42, -1 },
+    { 45, 2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 112, -4 },
+    { 113, -3 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 28, 5 },
+    { 29, 2 },
+    { 31, 6 },
+    { 112, -1 },
+    { 3, 3 },
+    { 4, 5 },
+    { 11, 3 },
+    { 24, 5 },
+    { 25, 2 },
+    { 27, 5 },
+    { 28, 2 },
+    { 29, 1 },
+    { 30, 2 },
+    { 31, 2 },
+    { 32, 2 },
+    { 34, 2 },
+    { 35, 2 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 3 },
+    { 47, 1 },
+    { 48, 2 },
+    { 51, 5 },
+    { 52, 2 },
+    { 53, 5 },
+    { 55, 5 },
+    { 56, 2 },
+    { 57, 2 },
+    { 112, 2 },
+    { 113, 4 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 16, 4 },
+    { 28, 4 },
+    { 31, 5 },
+    { 24, -2 },
+    { 28, 3 },
+    { 29, -1 },
+    { 31, 4 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 14, -1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 32, 1 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, -1 },
+    { 38, 2 },
+    { 42, -2 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 14, -1 },
+    { 16, 4 },
+    { 26, -1 },
+    { 27, 1 },
+    { 28, 4 },
+    { 31, 5 },
+    { 34, -1 },
+    { 37, -1 },
+    { 42, -2 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 8, 1 },
+    { 24, 2 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 5 },
+    { 33, 1 },
+    { 56, 1 },
+    { 11, 2 },
+    { 27, 3 },
+    { 51, 3 },
+    { 53, 3 },
+    { 55, 3 },
+    { 113, 2 },
+    { 5, 1 },
+    { 7, 1 },
+    { 24, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 8, 1 },
+    { 28, 2 },
+    { 31, 2 },
+    { 33, 1 },
+    { 56, 1 },
+    { 28, 1 },
+    { 31, 1 },
+    { 32, 2 },
+    { 34, 2 },
+    { 35, 2 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 28, 2 },
+    { 31, 2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 28, 2 },
+    { 31, 2 },
+    { 113, 1 },
+    { 4, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 105, -1 },
+    { 24, -2 },
+    { 59, -2 },
+    { 62, 2 },
+    { 63, 1 },
+    { 64, -1 },
+    { 65, 1 },
+    { 67, 2 },
+    { 68, 1 },
+    { 70, 1 },
+    { 73, 2 },
+    { 74, -3 },
+    { 76, 1 },
+    { 88, -1 },
+    { 97, 3 },
+    { 98, -3 },
+    { 99, -1 },
+    { 103, -2 },
+    { 104, -2 },
+    { 112, -2 },
+    { 72, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 24, -1 },
+    { 59, -1 },
+    { 81, -1 },
+    { 103, -1 },
+    { 111, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 42, -2 },
+    { 43, -1 },
+    { 60, -1 },
+    { 72, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 93, 1 },
+    { 102, -1 },
+    { 104, -1 },
+    { 105, -1 },
+    { 109, -1 },
+    { 111, -1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 24, 1 },
+    { 63, -1 },
+    { 64, 1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 67, -1 },
+    { 70, -1 },
+    { 73, 1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -1 },
+    { 93, 2 },
+    { 96, 1 },
+    { 102, -1 },
+    { 105, -1 },
+    { 107, -1 },
+    { 111, -1 },
+    { 3, -2 },
+    { 4, -2 },
+    { 24, -3 },
+    { 59, -3 },
+    { 64, -1 },
+    { 74, -3 },
+    { 76, 1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 98, -3 },
+    { 99, -1 },
+    { 103, -3 },
+    { 104, -3 },
+    { 111, -2 },
+    { 112, -2 },
+    { 113, -2 },
+    { 4, -2 },
+    { 24, -3 },
+    { 59, -4 },
+    { 60, -1 },
+    { 64, -2 },
+    { 72, -2 },
+    { 73, 1 },
+    { 74, -4 },
+    { 77, -1 },
+    { 78, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 87, -1 },
+    { 88, -2 },
+    { 90, -3 },
+    { 91, -1 },
+    { 98, -5 },
+    { 99, -2 },
+    { 103, -3 },
+    { 104, -3 },
+    { 105, -2 },
+    { 111, -2 },
+    { 112, -3 },
+    { 113, -3 },
+    { 4, 1 },
+    { 6, -1 },
+    { 24, 1 },
+    { 42, -2 },
+    { 60, -1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 67, 2 },
+    { 68, 2 },
+    { 70, 1 },
+    { 71, 1 },
+    { 72, -2 },
+    { 73, 2 },
+    { 75, -1 },
+    { 76, 2 },
+    { 77, -1 },
+    { 78, -1 },
+    { 80, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 90, -2 },
+    { 91, -1 },
+    { 93, 2 },
+    { 94, -1 },
+    { 99, -1 },
+    { 105, -3 },
+    { 107, 1 },
+    { 109, -1 },
+    { 111, -2 },
+    { 4, 3 },
+    { 5, -4 },
+    { 7, -4 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 24, 2 },
+    { 43, -1 },
+    { 59, 1 },
+    { 60, -1 },
+    { 63, -3 },
+    { 64, 1 },
+    { 65, -5 },
+    { 66, 1 },
+    { 67, -3 },
+    { 68, 1 },
+    { 70, -3 },
+    { 72, -1 },
+    { 73, 2 },
+    { 74, 2 },
+    { 76, -2 },
+    { 77, -3 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -6 },
+    { 86, -2 },
+    { 87, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -4 },
+    { 93, 3 },
+    { 94, -2 },
+    { 96, 1 },
+    { 98, 2 },
+    { 102, -1 },
+    { 103, 2 },
+    { 105, -3 },
+    { 107, -7 },
+    { 109, -1 },
+    { 111, -1 },
+    { 113, 2 },
+    { 4, -2 },
+    { 11, -1 },
+    { 24, -6 },
+    { 42, -1 },
+    { 58, 1 },
+    { 59, -2 },
+    { 60, -2 },
+    { 63, 2 },
+    { 64, -1 },
+    { 65, 1 },
+    { 67, 2 },
+    { 68, 2 },
+    { 70, 2 },
+    { 71, 2 },
+    { 72, -1 },
+    { 73, 2 },
+    { 74, -5 },
+    { 76, 2 },
+    { 78, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 87, -1 },
+    { 88, -2 },
+    { 90, -3 },
+    { 91, -2 },
+    { 95, -1 },
+    { 96, -1 },
+    { 98, -4 },
+    { 99, -2 },
+    { 103, -3 },
+    { 104, -4 },
+    { 105, -2 },
+    { 107, 2 },
+    { 111, -1 },
+    { 112, -4 },
+    { 113, -3 },
+    { 59, -1 },
+    { 64, -1 },
+    { 74, -1 },
+    { 98, -1 },
+    { 111, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 59, -1 },
+    { 60, 1 },
+    { 64, -2 },
+    { 65, -1 },
+    { 67, -1 },
+    { 74, -2 },
+    { 81, -1 },
+    { 98, -2 },
+    { 103, -2 },
+    { 104, -1 },
+    { 107, -1 },
+    { 111, -1 },
+    { 4, 3 },
+    { 5, -4 },
+    { 7, -4 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 42, -1 },
+    { 63, -2 },
+    { 65, -4 },
+    { 66, 1 },
+    { 67, -2 },
+    { 70, -2 },
+    { 73, 1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -4 },
+    { 86, -2 },
+    { 88, 1 },
+    { 92, -3 },
+    { 93, 1 },
+    { 94, -1 },
+    { 96, 1 },
+    { 99, 1 },
+    { 103, 1 },
+    { 105, -3 },
+    { 107, -3 },
+    { 109, -1 },
+    { 111, -1 },
+    { 112, 1 },
+    { 113, 1 },
+    { 60, -1 },
+    { 62, 3 },
+    { 68, 1 },
+    { 71, 2 },
+    { 73, 1 },
+    { 88, 2 },
+    { 97, 4 },
+    { 99, 2 },
+    { 24, -1 },
+    { 42, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, 2 },
+    { 70, 1 },
+    { 71, 1 },
+    { 72, -1 },
+    { 73, 2 },
+    { 74, -1 },
+    { 76, 1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 98, -1 },
+    { 104, -1 },
+    { 105, -1 },
+    { 107, 1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 59, -1 },
+    { 60, 1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -1 },
+    { 92, -1 },
+    { 98, -2 },
+    { 103, -2 },
+    { 107, -1 },
+    { 111, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 24, -1 },
+    { 58, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -4 },
+    { 67, -3 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 77, -1 },
+    { 80, -1 },
+    { 85, -4 },
+    { 86, -1 },
+    { 88, 1 },
+    { 92, -2 },
+    { 94, -1 },
+    { 98, -1 },
+    { 99, 1 },
+    { 103, -1 },
+    { 105, -1 },
+    { 107, -5 },
+    { 9, -1 },
+    { 10, -1 },
+    { 60, -1 },
+    { 72, -1 },
+    { 98, -1 },
+    { 105, -1 },
+    { 111, -1 },
+    { 4, 3 },
+    { 5, -4 },
+    { 7, -4 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 42, -1 },
+    { 63, -2 },
+    { 65, -3 },
+    { 66, 1 },
+    { 67, -2 },
+    { 70, -2 },
+    { 73, 1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -4 },
+    { 86, -2 },
+    { 88, 1 },
+    { 92, -3 },
+    { 93, 1 },
+    { 94, -1 },
+    { 96, 1 },
+    { 99, 1 },
+    { 103, 1 },
+    { 105, -3 },
+    { 107, -3 },
+    { 109, -1 },
+    { 111, -1 },
+    { 112, 1 },
+    { 113, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -2 },
+    { 10, -2 },
+    { 24, -3 },
+    { 58, -1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 92, -2 },
+    { 98, -2 },
+    { 103, -2 },
+    { 106, -1 },
+    { 107, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 63, 2 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 68, 2 },
+    { 70, 2 },
+    { 71, 2 },
+    { 72, -1 },
+    { 73, 2 },
+    { 74, 1 },
+    { 76, 1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 90, -2 },
+    { 93, 1 },
+    { 96, 2 },
+    { 103, 1 },
+    { 104, -2 },
+    { 105, -2 },
+    { 107, 1 },
+    { 111, -2 },
+    { 4, -1 },
+    { 8, 1 },
+    { 24, -2 },
+    { 90, -1 },
+    { 91, -1 },
+    { 105, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 99, 1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -4 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -2 },
+    { 99, 1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 99, 1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -3 },
+    { 99, 1 },
+    { 5, 1 },
+    { 7, 1 },
+    { 24, -2 },
+    { 88, 1 },
+    { 99, 1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 99, 1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, -2 },
+    { 8, 1 },
+    { 24, -3 },
+    { 82, 1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 94, 1 },
+    { 99, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -2 },
+    { 88, 1 },
+    { 99, 1 },
+    { 113, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 92, -2 },
+    { 99, 1 },
+    { 102, -1 },
+    { 24, -2 },
+    { 83, 1 },
+    { 84, 1 },
+    { 87, 1 },
+    { 88, 1 },
+    { 90, 1 },
+    { 99, 2 },
+    { 106, 1 },
+    { 111, -1 },
+    { 113, 1 },
+    { 3, 2 },
+    { 8, 1 },
+    { 24, -3 },
+    { 25, 1 },
+    { 40, 1 },
+    { 87, 1 },
+    { 88, 4 },
+    { 90, -1 },
+    { 97, 7 },
+    { 99, 4 },
+    { 105, -1 },
+    { 111, 2 },
+    { 4, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -3 },
+    { 88, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 113, -2 },
+    { 4, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -5 },
+    { 88, -1 },
+    { 90, -2 },
+    { 91, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 111, -1 },
+    { 112, -2 },
+    { 113, -2 },
+    { 4, -2 },
+    { 8, 1 },
+    { 24, -3 },
+    { 82, 1 },
+    { 88, -1 },
+    { 90, -1 },
+    { 94, 1 },
+    { 97, 2 },
+    { 99, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -2 },
+    { 99, 1 },
+    { 105, -1 },
+    { 111, -1 },
+    { 8, 1 },
+    { 24, 2 },
+    { 94, 1 },
+    { 3, 2 },
+    { 4, 2 },
+    { 11, 2 },
+    { 24, 3 },
+    { 40, 1 },
+    { 93, 3 },
+    { 96, 2 },
+    { 113, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 2 },
+    { 85, -1 },
+    { 97, 2 },
+    { 24, -2 },
+    { 59, -2 },
+    { 63, 1 },
+    { 64, -2 },
+    { 70, 1 },
+    { 74, -2 },
+    { 98, -2 },
+    { 103, -2 },
+    { 104, -1 },
+    { 5, -4 },
+    { 7, -4 },
+    { 8, -4 },
+    { 9, -3 },
+    { 10, -3 },
+    { 42, -2 },
+    { 60, -1 },
+    { 63, -2 },
+    { 64, 1 },
+    { 65, -4 },
+    { 67, -3 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, 1 },
+    { 76, -2 },
+    { 77, -3 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -2 },
+    { 85, -4 },
+    { 86, -2 },
+    { 89, -1 },
+    { 92, -4 },
+    { 94, -2 },
+    { 102, -1 },
+    { 105, -3 },
+    { 107, -5 },
+    { 109, -2 },
+    { 111, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 77, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 84, 1 },
+    { 85, -4 },
+    { 86, -1 },
+    { 87, 1 },
+    { 88, 1 },
+    { 92, -2 },
+    { 94, -1 },
+    { 99, 1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 9, -2 },
+    { 10, -2 },
+    { 42, -2 },
+    { 63, -2 },
+    { 64, 2 },
+    { 65, -3 },
+    { 67, -3 },
+    { 70, -2 },
+    { 72, -2 },
+    { 74, 1 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -5 },
+    { 86, -2 },
+    { 87, -1 },
+    { 90, -2 },
+    { 91, -2 },
+    { 92, -2 },
+    { 94, -2 },
+    { 102, -3 },
+    { 105, -4 },
+    { 107, -5 },
+    { 109, -2 },
+    { 111, -1 },
+    { 113, 2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 42, -1 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -3 },
+    { 86, -1 },
+    { 88, 1 },
+    { 92, -2 },
+    { 94, -1 },
+    { 99, 1 },
+    { 102, -1 },
+    { 105, -1 },
+    { 109, -1 },
+    { 111, -1 },
+    { 113, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 63, -2 },
+    { 65, -3 },
+    { 67, -2 },
+    { 70, -2 },
+    { 76, -2 },
+    { 77, -1 },
+    { 80, -1 },
+    { 85, -3 },
+    { 86, -1 },
+    { 92, -3 },
+    { 93, 2 },
+    { 94, -1 },
+    { 96, 1 },
+    { 99, 2 },
+    { 105, -2 },
+    { 107, -4 },
+    { 113, 2 },
+    { 58, 1 },
+    { 62, 4 },
+    { 63, 1 },
+    { 65, 2 },
+    { 66, 1 },
+    { 67, 2 },
+    { 68, 2 },
+    { 70, 1 },
+    { 71, 2 },
+    { 72, -1 },
+    { 73, 2 },
+    { 76, 2 },
+    { 88, 3 },
+    { 99, 3 },
+    { 100, 1 },
+    { 107, 2 },
+    { 3, 2 },
+    { 8, 2 },
+    { 25, 2 },
+    { 40, 1 },
+    { 87, 1 },
+    { 88, 4 },
+    { 97, 6 },
+    { 99, 4 },
+    { 106, 1 },
+    { 111, 2 },
+    { 58, 1 },
+    { 62, 4 },
+    { 63, 1 },
+    { 65, 2 },
+    { 66, 1 },
+    { 67, 2 },
+    { 68, 2 },
+    { 70, 1 },
+    { 71, 2 },
+    { 72, -1 },
+    { 73, 2 },
+    { 76, 2 },
+    { 88, 3 },
+    { 97, 4 },
+    { 99, 3 },
+    { 100, 1 },
+    { 107, 2 },
+    { 24, -2 },
+    { 58, 1 },
+    { 59, -2 },
+    { 63, 2 },
+    { 65, 2 },
+    { 67, 2 },
+    { 68, 1 },
+    { 70, 2 },
+    { 71, 2 },
+    { 73, 2 },
+    { 74, -1 },
+    { 76, 2 },
+    { 98, -3 },
+    { 100, 1 },
+    { 103, -3 },
+    { 107, 2 },
+    { 24, -4 },
+    { 90, -1 },
+    { 91, -1 },
+    { 112, -1 },
+    { 2, 1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 24, 2 },
+    { 42, -1 },
+    { 43, -1 },
+    { 59, 1 },
+    { 60, -1 },
+    { 63, -2 },
+    { 64, 2 },
+    { 65, -3 },
+    { 66, 1 },
+    { 67, -2 },
+    { 70, -2 },
+    { 72, -1 },
+    { 73, 2 },
+    { 74, 1 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -2 },
+    { 81, -1 },
+    { 82, -2 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -2 },
+    { 87, -1 },
+    { 89, -2 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -3 },
+    { 93, 2 },
+    { 94, -2 },
+    { 96, 2 },
+    { 98, 1 },
+    { 102, -2 },
+    { 103, 1 },
+    { 105, -3 },
+    { 107, -4 },
+    { 109, -2 },
+    { 111, -2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 92, -2 },
+    { 97, 1 },
+    { 99, 1 },
+    { 102, -1 },
+    { 4, 1 },
+    { 7, -2 },
+    { 9, -1 },
+    { 24, 1 },
+    { 25, 2 },
+    { 42, -1 },
+    { 58, 2 },
+    { 60, -1 },
+    { 62, 5 },
+    { 63, 2 },
+    { 65, 2 },
+    { 66, 2 },
+    { 67, 3 },
+    { 68, 3 },
+    { 70, 3 },
+    { 71, 3 },
+    { 72, -1 },
+    { 73, 3 },
+    { 74, 1 },
+    { 76, 2 },
+    { 77, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 88, 4 },
+    { 90, -2 },
+    { 93, 1 },
+    { 96, 2 },
+    { 97, 6 },
+    { 99, 4 },
+    { 100, 2 },
+    { 103, 1 },
+    { 104, -2 },
+    { 105, -2 },
+    { 106, 1 },
+    { 107, 2 },
+    { 111, 1 },
+    { 3, 2 },
+    { 8, 2 },
+    { 24, -2 },
+    { 25, 2 },
+    { 40, 1 },
+    { 83, 1 },
+    { 84, 1 },
+    { 87, 1 },
+    { 88, 4 },
+    { 90, 1 },
+    { 97, 7 },
+    { 99, 2 },
+    { 106, 1 },
+    { 111, 2 },
+    { 113, 1 },
+    { 4, -4 },
+    { 24, -4 },
+    { 59, -4 },
+    { 60, -1 },
+    { 64, -2 },
+    { 72, -1 },
+    { 73, 1 },
+    { 74, -5 },
+    { 83, -1 },
+    { 84, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 90, -2 },
+    { 91, -1 },
+    { 98, -5 },
+    { 99, -1 },
+    { 101, -1 },
+    { 103, -3 },
+    { 104, -3 },
+    { 105, -1 },
+    { 111, -2 },
+    { 113, -2 },
+    { 65, -1 },
+    { 74, -1 },
+    { 98, -1 },
+    { 103, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 43, -1 },
+    { 58, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 63, -2 },
+    { 67, -1 },
+    { 69, -2 },
+    { 70, -2 },
+    { 72, -2 },
+    { 73, -1 },
+    { 75, -1 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -2 },
+    { 80, -2 },
+    { 81, -2 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -2 },
+    { 94, -2 },
+    { 99, -2 },
+    { 102, -2 },
+    { 104, -2 },
+    { 105, -2 },
+    { 107, -1 },
+    { 108, -2 },
+    { 109, -2 },
+    { 110, -1 },
+    { 111, -2 },
+    { 24, -3 },
+    { 88, 2 },
+    { 97, 4 },
+    { 99, 2 },
+    { 6, -1 },
+    { 77, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 87, -1 },
+    { 91, -1 },
+    { 105, -2 },
+    { 111, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 65, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 111, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 88, 2 },
+    { 97, 4 },
+    { 99, 2 },
+    { 105, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 62, 3 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 68, 2 },
+    { 70, -1 },
+    { 71, 2 },
+    { 72, -1 },
+    { 73, 2 },
+    { 74, 1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 79, -2 },
+    { 80, -2 },
+    { 82, -2 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 90, -2 },
+    { 92, -2 },
+    { 93, 1 },
+    { 94, -2 },
+    { 96, 2 },
+    { 97, 2 },
+    { 102, -1 },
+    { 103, 1 },
+    { 104, -2 },
+    { 105, -2 },
+    { 107, 1 },
+    { 109, -2 },
+    { 111, -2 },
+    { 24, -2 },
+    { 77, -1 },
+    { 80, -1 },
+    { 83, 1 },
+    { 84, 1 },
+    { 85, -1 },
+    { 86, -2 },
+    { 87, 1 },
+    { 88, 2 },
+    { 90, 1 },
+    { 92, -1 },
+    { 97, 4 },
+    { 99, 2 },
+    { 111, -1 },
+    { 113, 1 },
+    { 1, -1 },
+    { 5, -4 },
+    { 7, -4 },
+    { 12, -4 },
+    { 14, -1 },
+    { 15, -2 },
+    { 17, -2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 26, -3 },
+    { 28, -1 },
+    { 29, -3 },
+    { 33, -3 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, -2 },
+    { 44, -4 },
+    { 45, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 52, -3 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -2 },
+    { 60, -1 },
+    { 61, -1 },
+    { 63, -4 },
+    { 65, -4 },
+    { 67, -3 },
+    { 70, -4 },
+    { 71, -2 },
+    { 76, -3 },
+    { 77, -3 },
+    { 78, -2 },
+    { 80, -3 },
+    { 81, -2 },
+    { 82, -1 },
+    { 85, -6 },
+    { 86, -2 },
+    { 89, -1 },
+    { 92, -2 },
+    { 94, -3 },
+    { 98, -1 },
+    { 102, -2 },
+    { 107, -4 },
+    { 109, -1 },
+    { 1, -2 },
+    { 5, -7 },
+    { 7, -7 },
+    { 11, -1 },
+    { 12, -6 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 26, -4 },
+    { 27, -1 },
+    { 28, -2 },
+    { 29, -4 },
+    { 30, -1 },
+    { 32, -1 },
+    { 33, -3 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 45, -6 },
+    { 47, -4 },
+    { 48, -1 },
+    { 50, -4 },
+    { 51, -1 },
+    { 52, -4 },
+    { 53, -1 },
+    { 55, -1 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -5 },
+    { 65, -6 },
+    { 67, -4 },
+    { 68, -1 },
+    { 69, -3 },
+    { 70, -5 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -1 },
+    { 75, -2 },
+    { 76, -3 },
+    { 77, -4 },
+    { 78, -3 },
+    { 79, -2 },
+    { 80, -4 },
+    { 81, -3 },
+    { 82, -2 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -7 },
+    { 86, -3 },
+    { 87, -1 },
+    { 89, -1 },
+    { 92, -4 },
+    { 93, -1 },
+    { 94, -3 },
+    { 95, -1 },
+    { 98, -1 },
+    { 102, -3 },
+    { 103, -1 },
+    { 105, -2 },
+    { 106, -2 },
+    { 107, -6 },
+    { 110, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 4 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -2 },
+    { 28, 3 },
+    { 29, 1 },
+    { 30, -1 },
+    { 31, 4 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, 2 },
+    { 42, -2 },
+    { 45, 1 },
+    { 48, -1 },
+    { 58, 1 },
+    { 59, -2 },
+    { 60, -1 },
+    { 62, 4 },
+    { 63, 2 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 68, 2 },
+    { 70, 2 },
+    { 72, -1 },
+    { 73, 2 },
+    { 74, -3 },
+    { 76, 2 },
+    { 78, -1 },
+    { 83, -1 },
+    { 90, -2 },
+    { 91, -3 },
+    { 95, -1 },
+    { 97, 4 },
+    { 98, -4 },
+    { 101, -1 },
+    { 103, -2 },
+    { 104, -4 },
+    { 105, -1 },
+    { 107, 1 },
+    { 112, -4 },
+    { 113, -4 },
+};
+
 static const EpdFontData bookerly_18_bolditalic = {
     bookerly_18_bolditalicBitmaps,
     bookerly_18_bolditalicGlyphs,
@@ -8047,4 +10489,8 @@ static const EpdFontData bookerly_18_bolditalic = {
     40,
     -10,
     true,
+    bookerly_18_bolditalicKernLeftClasses,
+    bookerly_18_bolditalicKernRightClasses,
+    bookerly_18_bolditalicKernPairOffsets,
+    bookerly_18_bolditalicKernPairs,
 };
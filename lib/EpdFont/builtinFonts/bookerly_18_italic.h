@@ -6766,7 +6766,7 @@ static const EpdGlyph bookerly_18_italicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, // 	
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 10, 30, 12, 2, 29, 75, 0 }, // !
@@ -7556,6 +7556,1937 @@ static const EpdUnicodeInterval bookerly_18_italicIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_18_italicKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    0, 3, 4, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 7, 8, 9, 10, 11, 12, 13, 13, 14,
+    15, 16, 17, 18, 9, 19, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28,
+    29, 30, 0, 0, 0, 0, 31, 32, 33, 0, 34, 35, 36, 37, 0, 38,
+    39, 0, 37, 37, 32, 32, 40, 41, 42, 43, 31, 44, 44, 45, 44, 46,
+    47, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+    0, 0, 0, 51, 6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10,
+    13, 13, 13, 13, 9, 18, 9, 9, 9, 9, 9, 0, 9, 24, 24, 24,
+    24, 27, 52, 53, 31, 31, 31, 31, 31, 31, 34, 54, 34, 34, 34, 34,
+    0, 0, 55, 55, 32, 37, 32, 32, 32, 32, 32, 0, 56, 31, 31, 31,
+    31, 44, 32, 44, 6, 31, 6, 31, 57, 58, 8, 33, 8, 33, 8, 33,
+    8, 33, 9, 59, 9, 0, 10, 34, 10, 34, 10, 34, 60, 61, 10, 34,
+    12, 36, 12, 36, 12, 36, 12, 36, 13, 37, 13, 37, 13, 55, 13, 55,
+    13, 55, 62, 63, 13, 31, 14, 38, 14, 64, 15, 39, 33, 16, 0, 16,
+    65, 0, 59, 0, 0, 16, 66, 18, 37, 18, 37, 18, 37, 37, 18, 67,
+    9, 32, 9, 32, 9, 32, 10, 34, 21, 41, 21, 41, 21, 41, 22, 42,
+    22, 42, 22, 68, 22, 42, 23, 69, 23, 0, 23, 43, 24, 31, 24, 31,
+    24, 31, 24, 31, 24, 31, 24, 58, 25, 44, 27, 44, 27, 28, 46, 28,
+    46, 28, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 70, 70, 71, 0, 72, 73, 74, 74, 75, 76, 76,
+    77, 78, 74, 79, 74, 80, 81, 82, 83, 84, 70, 78, 82, 74, 74, 78,
+    74, 85, 74, 86, 74, 87, 88, 89, 79, 90, 91, 84, 74, 74, 84, 76,
+    74, 76, 86, 86, 74, 92, 93, 94, 0, 95, 96, 97, 94, 92, 92, 33,
+    92, 92, 92, 95, 98, 95, 33, 98, 99, 95, 100, 101, 92, 92, 101, 102,
+    92, 102, 95, 95, 92, 96, 96, 103, 0, 33, 104, 0, 105, 106, 102, 102,
+    98, 33, 92, 99, 92, 107, 102, 86, 95, 108, 109, 84, 101, 76, 102, 87,
+    95, 110, 111, 112, 0, 0, 0, 113, 114, 82, 94, 113, 114, 78, 33, 78,
+    33, 78, 33, 84, 101, 0, 0, 0, 0, 115, 116, 88, 33, 83, 101, 117,
+    99, 117, 99, 118, 119, 84, 101, 84, 101, 74, 92, 120, 98, 121, 96, 121,
+    96, 74, 78, 97, 122, 123, 84, 101, 75, 106, 84, 101, 74, 0, 84, 101,
+    124, 80, 92, 80, 92, 70, 96, 70, 96, 86, 95, 86, 95, 78, 97, 82,
+    94, 125, 126, 74, 92, 74, 92, 86, 95, 86, 95, 86, 95, 86, 95, 79,
+    99, 79, 99, 79, 99, 74, 92, 83, 0, 74, 92, 112, 0, 127, 128, 91,
+    100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 4, 4, 4, 0, 0, 129, 130, 131, 129, 129, 130, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_18_italicKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+    0, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    9, 0, 0, 0, 10, 0, 11, 12, 13, 12, 14, 14, 13, 14, 14, 15,
+    14, 14, 16, 14, 13, 12, 13, 12, 17, 18, 19, 20, 20, 21, 22, 23,
+    0, 24, 25, 0, 0, 0, 26, 27, 26, 26, 26, 28, 29, 27, 30, 31,
+    27, 27, 32, 32, 26, 33, 26, 32, 34, 35, 36, 37, 37, 38, 39, 40,
+    0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 0, 0, 44, 11, 11, 11, 11, 11, 11, 45, 13, 14, 14, 14, 14,
+    14, 14, 14, 14, 12, 14, 13, 13, 13, 13, 13, 0, 13, 19, 19, 19,
+    19, 22, 14, 46, 26, 26, 26, 26, 47, 26, 26, 26, 26, 26, 26, 26,
+    48, 30, 49, 49, 26, 32, 26, 26, 26, 26, 26, 0, 50, 36, 36, 36,
+    36, 37, 51, 37, 11, 26, 11, 26, 11, 26, 13, 26, 13, 26, 13, 26,
+    13, 52, 12, 26, 12, 26, 14, 26, 14, 26, 14, 26, 14, 26, 14, 26,
+    13, 29, 13, 29, 13, 29, 13, 29, 14, 27, 14, 53, 14, 49, 14, 49,
+    14, 49, 14, 30, 14, 32, 14, 30, 15, 54, 14, 27, 32, 14, 27, 14,
+    27, 14, 27, 14, 27, 14, 55, 14, 32, 14, 32, 14, 32, 32, 14, 32,
+    13, 26, 13, 26, 13, 26, 13, 26, 12, 32, 12, 32, 12, 32, 17, 34,
+    17, 34, 17, 34, 17, 56, 18, 35, 18, 35, 18, 35, 19, 36, 19, 36,
+    19, 36, 19, 36, 19, 36, 19, 36, 20, 37, 22, 37, 22, 23, 40, 23,
+    40, 23, 57, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 58, 58, 59, 58, 60, 17, 58, 58, 61, 62, 58,
+    59, 58, 58, 63, 58, 64, 58, 65, 58, 66, 58, 67, 68, 58, 58, 58,
+    62, 69, 58, 60, 58, 65, 60, 59, 63, 70, 71, 58, 72, 58, 58, 59,
+    58, 58, 73, 58, 74, 75, 76, 75, 77, 78, 75, 79, 80, 81, 81, 82,
+    83, 84, 82, 75, 82, 82, 75, 82, 85, 75, 86, 81, 87, 81, 81, 88,
+    81, 81, 80, 82, 89, 75, 75, 90, 77, 75, 91, 92, 93, 94, 83, 82,
+    95, 82, 81, 85, 81, 59, 82, 60, 75, 96, 85, 58, 82, 0, 97, 65,
+    82, 58, 98, 58, 77, 58, 82, 67, 79, 68, 80, 58, 82, 58, 82, 0,
+    0, 59, 0, 58, 82, 58, 82, 58, 82, 60, 75, 60, 75, 59, 82, 99,
+    85, 99, 85, 71, 86, 0, 0, 72, 87, 72, 87, 58, 95, 100, 101, 100,
+    101, 58, 67, 79, 58, 82, 62, 83, 58, 82, 58, 82, 72, 87, 0, 84,
+    102, 64, 75, 64, 75, 103, 75, 58, 75, 104, 105, 0, 105, 67, 79, 68,
+    80, 106, 107, 58, 81, 58, 81, 60, 75, 60, 75, 60, 75, 0, 80, 63,
+    85, 63, 85, 63, 85, 0, 87, 58, 77, 58, 81, 58, 77, 71, 86, 71,
+    86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 108, 109, 6, 108, 108, 109, 6,
+    0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0, 1, 0, 0, 0,
+    10, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_18_italicKernPairOffsets[132] = {
+    0, 26, 30, 80, 84, 128, 156, 169, 174, 190, 198, 216, 225, 242, 255, 275,
+    286, 294, 312, 335, 358, 377, 386, 405, 423, 448, 466, 495, 500, 511, 545, 548,
+    556, 557, 562, 587, 603, 610, 612, 615, 622, 634, 639, 641, 646, 649, 655, 674,
+    689, 693, 704, 727, 743, 744, 747, 756, 767, 798, 804, 831, 842, 849, 869, 872,
+    877, 879, 886, 889, 896, 900, 907, 920, 921, 930, 954, 972, 982, 998, 1027, 1063,
+    1097, 1098, 1113, 1142, 1144, 1154, 1171, 1202, 1208, 1238, 1264, 1290, 1295, 1304, 1307, 1316,
+    1319, 1320, 1327, 1335, 1337, 1345, 1355, 1363, 1369, 1376, 1379, 1383, 1410, 1411, 1441, 1456,
+    1477, 1483, 1486, 1492, 1496, 1537, 1565, 1573, 1588, 1591, 1593, 1595, 1596, 1603, 1608, 1639,
+    1646, 1693, 1769, 1818,
+};
+
+static const EpdKernPair bookerly_18_italicKernPairs[] = {
+    { 13, -1 },
+    { 15, 4 },
+    { 22, 1 },
+    { 26, -2 },
+    { 27, 2 },
+    { 28, 6 },
+    { 29, 2 },
+    { 31, 6 },
+    { 39, 3 },
+    { 47, -2 },
+    { 50, -2 },
+    { 51, 2 },
+    { 52, -2 },
+    { 53, 2 },
+    { 55, 2 },
+    { 60, -1 },
+    { 61, 4 },
+    { 63, 2 },
+    { 66, 1 },
+    { 75, -2 },
+    { 78, -2 },
+    { 83, -1 },
+    { 90, 2 },
+    { 94, 6 },
+    { 95, 2 },
+    { 99, 1 },
+    { 11, -4 },
+    { 45, -3 },
+    { 64, -4 },
+    { 103, -3 },
+    { 11, 2 },
+    { 13, -1 },
+    { 15, 3 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -2 },
+    { 26, -1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, 3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 45, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 59, -2 },
+    { 60, -1 },
+    { 61, 3 },
+    { 62, 2 },
+    { 64, 2 },
+    { 66, 1 },
+    { 67, 1 },
+    { 70, -1 },
+    { 71, 2 },
+    { 72, -4 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 87, -4 },
+    { 88, -3 },
+    { 94, 3 },
+    { 96, -4 },
+    { 97, -1 },
+    { 99, -2 },
+    { 100, -4 },
+    { 101, -1 },
+    { 103, 1 },
+    { 108, -4 },
+    { 109, -4 },
+    { 4, -1 },
+    { 6, -1 },
+    { 22, -1 },
+    { 99, -1 },
+    { 11, -3 },
+    { 13, -2 },
+    { 16, -2 },
+    { 26, -4 },
+    { 28, -2 },
+    { 29, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -3 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -2 },
+    { 40, -2 },
+    { 45, -5 },
+    { 47, -4 },
+    { 50, -4 },
+    { 52, -4 },
+    { 56, -3 },
+    { 57, -2 },
+    { 60, -2 },
+    { 62, -1 },
+    { 64, -3 },
+    { 66, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 74, -2 },
+    { 75, -4 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -2 },
+    { 79, -2 },
+    { 80, -2 },
+    { 81, -2 },
+    { 82, -1 },
+    { 83, -4 },
+    { 84, -3 },
+    { 86, -2 },
+    { 88, -1 },
+    { 89, -3 },
+    { 91, -3 },
+    { 98, -2 },
+    { 101, -2 },
+    { 103, -5 },
+    { 105, -2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -2 },
+    { 18, -2 },
+    { 19, -3 },
+    { 20, -4 },
+    { 21, 1 },
+    { 22, -4 },
+    { 24, -6 },
+    { 26, -1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 42, -1 },
+    { 45, 1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 52, -1 },
+    { 108, -4 },
+    { 109, -3 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -1 },
+    { 11, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 24, -2 },
+    { 28, -1 },
+    { 45, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -1 },
+    { 13, 1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -2 },
+    { 45, -1 },
+    { 46, -1 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 26, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 26, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 42, -1 },
+    { 45, -4 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 109, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 11, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -1 },
+    { 24, -1 },
+    { 108, -2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 13, -1 },
+    { 26, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -2 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 108, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -1 },
+    { 26, -1 },
+    { 45, -1 },
+    { 47, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 21, 2 },
+    { 26, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 42, -2 },
+    { 45, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 3, -2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, 1 },
+    { 22, -2 },
+    { 24, -3 },
+    { 37, -1 },
+    { 39, -1 },
+    { 108, -2 },
+    { 109, -1 },
+    { 13, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, 1 },
+    { 24, -1 },
+    { 42, -1 },
+    { 108, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 11, -2 },
+    { 13, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -2 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -3 },
+    { 8, -3 },
+    { 9, -3 },
+    { 11, -4 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 26, -2 },
+    { 29, -1 },
+    { 34, -1 },
+    { 45, -5 },
+    { 47, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 56, -1 },
+    { 2, 9 },
+    { 4, 7 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, 7 },
+    { 13, 1 },
+    { 15, 4 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -2 },
+    { 25, 8 },
+    { 28, 2 },
+    { 29, 3 },
+    { 31, 2 },
+    { 33, 1 },
+    { 41, 8 },
+    { 45, -1 },
+    { 46, -1 },
+    { 51, 2 },
+    { 3, -1 },
+    { 5, -2 },
+    { 11, 2 },
+    { 13, -2 },
+    { 16, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, 2 },
+    { 22, -3 },
+    { 24, -4 },
+    { 28, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 42, -2 },
+    { 45, 2 },
+    { 108, -2 },
+    { 109, -2 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 3, 2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -3 },
+    { 26, -2 },
+    { 29, -1 },
+    { 34, -1 },
+    { 42, -1 },
+    { 45, -3 },
+    { 47, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 53, 1 },
+    { 56, -1 },
+    { 108, 1 },
+    { 109, 2 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -2 },
+    { 13, -1 },
+    { 26, -2 },
+    { 29, -1 },
+    { 34, -1 },
+    { 38, -1 },
+    { 45, -2 },
+    { 46, -2 },
+    { 47, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 56, -1 },
+    { 3, 1 },
+    { 4, -5 },
+    { 5, -1 },
+    { 6, -5 },
+    { 7, -3 },
+    { 8, -3 },
+    { 9, -3 },
+    { 11, -4 },
+    { 13, -1 },
+    { 16, -1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, -2 },
+    { 29, -2 },
+    { 34, -2 },
+    { 38, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -5 },
+    { 47, -2 },
+    { 49, 1 },
+    { 50, -2 },
+    { 52, -2 },
+    { 56, -2 },
+    { 109, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, 1 },
+    { 13, -1 },
+    { 16, 1 },
+    { 21, 2 },
+    { 26, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 47, -1 },
+    { 50, 1 },
+    { 52, -1 },
+    { 3, 2 },
+    { 4, -4 },
+    { 5, -2 },
+    { 6, -4 },
+    { 7, -4 },
+    { 8, -2 },
+    { 9, -2 },
+    { 11, -4 },
+    { 13, -1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, -2 },
+    { 28, -1 },
+    { 29, -2 },
+    { 34, -2 },
+    { 36, -1 },
+    { 38, -2 },
+    { 40, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -4 },
+    { 47, -2 },
+    { 49, 1 },
+    { 50, -2 },
+    { 52, -2 },
+    { 53, 2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 109, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 24, -1 },
+    { 15, 2 },
+    { 26, -2 },
+    { 28, 3 },
+    { 31, 2 },
+    { 47, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 61, 2 },
+    { 75, -2 },
+    { 78, -2 },
+    { 94, 2 },
+    { 11, 1 },
+    { 13, -1 },
+    { 16, 1 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -3 },
+    { 29, 3 },
+    { 37, -2 },
+    { 38, 1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 45, 1 },
+    { 57, 1 },
+    { 59, -2 },
+    { 60, -1 },
+    { 62, 2 },
+    { 64, 1 },
+    { 66, 3 },
+    { 67, 2 },
+    { 69, 1 },
+    { 70, -1 },
+    { 71, 2 },
+    { 72, -3 },
+    { 74, 2 },
+    { 85, -2 },
+    { 86, 1 },
+    { 87, -3 },
+    { 88, -1 },
+    { 96, -4 },
+    { 99, -3 },
+    { 100, -3 },
+    { 103, 1 },
+    { 3, -1 },
+    { 24, -2 },
+    { 108, -1 },
+    { 3, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 55, 1 },
+    { 108, -1 },
+    { 24, -2 },
+    { 24, -2 },
+    { 27, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 2, 2 },
+    { 3, 3 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -2 },
+    { 10, 2 },
+    { 24, 3 },
+    { 26, -1 },
+    { 27, 2 },
+    { 29, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 47, -1 },
+    { 48, 1 },
+    { 49, 2 },
+    { 50, -1 },
+    { 51, 2 },
+    { 52, -1 },
+    { 53, 2 },
+    { 54, 1 },
+    { 55, 2 },
+    { 108, 1 },
+    { 109, 2 },
+    { 3, 2 },
+    { 6, -1 },
+    { 25, 1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 31, 4 },
+    { 32, 1 },
+    { 33, 1 },
+    { 35, 2 },
+    { 36, 1 },
+    { 37, 2 },
+    { 38, 1 },
+    { 39, 2 },
+    { 41, 1 },
+    { 108, 2 },
+    { 109, 2 },
+    { 3, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 37, -1 },
+    { 39, -1 },
+    { 108, -1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 24, -3 },
+    { 29, 2 },
+    { 50, 2 },
+    { 2, 2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 24, -2 },
+    { 28, 3 },
+    { 29, 1 },
+    { 31, 3 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -2 },
+    { 24, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 37, 2 },
+    { 39, 2 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 109, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -2 },
+    { 24, -1 },
+    { 109, 1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 24, -2 },
+    { 24, -2 },
+    { 50, 1 },
+    { 109, 1 },
+    { 2, -1 },
+    { 24, -2 },
+    { 29, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 50, 1 },
+    { 15, 2 },
+    { 26, -2 },
+    { 28, 2 },
+    { 31, 2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 45, -1 },
+    { 47, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 56, -1 },
+    { 61, 2 },
+    { 75, -2 },
+    { 78, -2 },
+    { 82, -1 },
+    { 91, -1 },
+    { 94, 2 },
+    { 103, -1 },
+    { 15, 3 },
+    { 20, -2 },
+    { 22, -1 },
+    { 27, -1 },
+    { 28, 2 },
+    { 31, 3 },
+    { 51, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 61, 3 },
+    { 90, -1 },
+    { 94, 3 },
+    { 95, -1 },
+    { 96, -2 },
+    { 99, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 96, -1 },
+    { 99, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 59, -1 },
+    { 70, 1 },
+    { 72, -2 },
+    { 96, -1 },
+    { 99, -1 },
+    { 104, 2 },
+    { 15, 4 },
+    { 19, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 31, 3 },
+    { 47, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 61, 4 },
+    { 75, -1 },
+    { 78, -1 },
+    { 90, -1 },
+    { 94, 3 },
+    { 95, -1 },
+    { 96, -2 },
+    { 99, -2 },
+    { 2, -2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -2 },
+    { 11, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -2 },
+    { 22, -2 },
+    { 24, -3 },
+    { 45, -2 },
+    { 108, -1 },
+    { 24, -2 },
+    { 28, 1 },
+    { 31, 2 },
+    { 2, 1 },
+    { 3, 2 },
+    { 24, 2 },
+    { 27, 2 },
+    { 49, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 55, 2 },
+    { 109, 1 },
+    { 3, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 35, 1 },
+    { 37, 2 },
+    { 39, 2 },
+    { 55, 1 },
+    { 108, -1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 13, -2 },
+    { 15, 4 },
+    { 18, -2 },
+    { 19, -3 },
+    { 20, -4 },
+    { 21, 1 },
+    { 22, -4 },
+    { 24, -6 },
+    { 26, -1 },
+    { 28, 4 },
+    { 29, 2 },
+    { 30, -1 },
+    { 31, 5 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -2 },
+    { 42, -1 },
+    { 45, 1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 52, -1 },
+    { 108, -4 },
+    { 109, -3 },
+    { 3, -1 },
+    { 24, -2 },
+    { 28, 4 },
+    { 29, 2 },
+    { 31, 5 },
+    { 108, -1 },
+    { 2, 4 },
+    { 3, 4 },
+    { 10, 2 },
+    { 24, 4 },
+    { 25, 2 },
+    { 27, 4 },
+    { 28, 1 },
+    { 30, 2 },
+    { 31, 2 },
+    { 32, 2 },
+    { 33, 2 },
+    { 35, 2 },
+    { 36, 2 },
+    { 37, 2 },
+    { 39, 2 },
+    { 40, 1 },
+    { 41, 2 },
+    { 47, 1 },
+    { 48, 2 },
+    { 51, 4 },
+    { 52, 2 },
+    { 53, 4 },
+    { 55, 4 },
+    { 56, 2 },
+    { 57, 2 },
+    { 108, 2 },
+    { 109, 4 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 15, 3 },
+    { 26, -1 },
+    { 28, 3 },
+    { 31, 3 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 24, -2 },
+    { 27, -1 },
+    { 28, 2 },
+    { 31, 3 },
+    { 51, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 13, -1 },
+    { 15, 3 },
+    { 26, -1 },
+    { 28, 3 },
+    { 31, 3 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 42, -2 },
+    { 43, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 108, -1 },
+    { 28, 4 },
+    { 29, 1 },
+    { 31, 4 },
+    { 27, 2 },
+    { 51, 2 },
+    { 53, 2 },
+    { 55, 2 },
+    { 109, 2 },
+    { 28, 1 },
+    { 31, 2 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 2 },
+    { 39, 2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 24, -3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -2 },
+    { 28, 2 },
+    { 31, 2 },
+    { 24, -1 },
+    { 28, 2 },
+    { 31, 2 },
+    { 109, 1 },
+    { 3, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 60, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 101, -1 },
+    { 24, -2 },
+    { 59, -2 },
+    { 61, 2 },
+    { 62, 1 },
+    { 64, 1 },
+    { 66, 2 },
+    { 71, 2 },
+    { 72, -2 },
+    { 87, -1 },
+    { 96, -2 },
+    { 99, -2 },
+    { 100, -2 },
+    { 108, -2 },
+    { 70, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 59, -1 },
+    { 96, -1 },
+    { 99, -1 },
+    { 107, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 42, -2 },
+    { 43, -1 },
+    { 60, -1 },
+    { 70, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 91, -1 },
+    { 98, -1 },
+    { 100, -1 },
+    { 101, -1 },
+    { 105, -1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 62, -1 },
+    { 63, 1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -1 },
+    { 93, 1 },
+    { 103, -1 },
+    { 3, -2 },
+    { 24, -3 },
+    { 59, -3 },
+    { 63, -2 },
+    { 72, -3 },
+    { 87, -1 },
+    { 96, -3 },
+    { 99, -3 },
+    { 100, -2 },
+    { 108, -2 },
+    { 3, -2 },
+    { 24, -3 },
+    { 59, -2 },
+    { 60, -1 },
+    { 70, -1 },
+    { 71, 1 },
+    { 72, -3 },
+    { 76, -1 },
+    { 85, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 96, -4 },
+    { 99, -3 },
+    { 100, -3 },
+    { 108, -3 },
+    { 109, -3 },
+    { 3, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 42, -2 },
+    { 60, -1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 70, -2 },
+    { 71, 1 },
+    { 73, -1 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -1 },
+    { 87, -3 },
+    { 88, -2 },
+    { 91, -1 },
+    { 101, -3 },
+    { 103, 1 },
+    { 105, -1 },
+    { 107, -1 },
+    { 3, 3 },
+    { 4, -5 },
+    { 6, -5 },
+    { 7, -3 },
+    { 24, 2 },
+    { 58, 1 },
+    { 59, 2 },
+    { 62, -3 },
+    { 63, 2 },
+    { 64, -4 },
+    { 66, -3 },
+    { 67, 2 },
+    { 71, 2 },
+    { 72, 2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 78, 1 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -4 },
+    { 84, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 90, 2 },
+    { 91, -2 },
+    { 93, 2 },
+    { 95, 2 },
+    { 96, 1 },
+    { 98, -1 },
+    { 99, 2 },
+    { 101, -2 },
+    { 103, -4 },
+    { 105, -2 },
+    { 108, 1 },
+    { 109, 2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 10, -1 },
+    { 24, -6 },
+    { 42, -1 },
+    { 59, -2 },
+    { 60, -2 },
+    { 62, 1 },
+    { 63, -2 },
+    { 64, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 70, -2 },
+    { 71, 1 },
+    { 72, -5 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 87, -4 },
+    { 88, -3 },
+    { 92, -1 },
+    { 93, -1 },
+    { 96, -4 },
+    { 99, -4 },
+    { 100, -4 },
+    { 101, -2 },
+    { 103, 1 },
+    { 107, -1 },
+    { 108, -4 },
+    { 109, -3 },
+    { 96, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -1 },
+    { 24, -2 },
+    { 59, -2 },
+    { 63, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 72, -2 },
+    { 96, -2 },
+    { 99, -2 },
+    { 100, -1 },
+    { 103, -1 },
+    { 3, 2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 42, -1 },
+    { 62, -2 },
+    { 63, 1 },
+    { 64, -3 },
+    { 66, -2 },
+    { 72, 1 },
+    { 74, -1 },
+    { 75, -2 },
+    { 77, -1 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 89, -2 },
+    { 91, -1 },
+    { 93, 1 },
+    { 101, -3 },
+    { 103, -3 },
+    { 105, -2 },
+    { 107, -1 },
+    { 108, 1 },
+    { 109, 2 },
+    { 61, 3 },
+    { 94, 3 },
+    { 24, -1 },
+    { 42, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 70, -1 },
+    { 71, 1 },
+    { 72, -1 },
+    { 96, -1 },
+    { 100, -1 },
+    { 108, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 24, -2 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 72, -1 },
+    { 83, -1 },
+    { 96, -1 },
+    { 99, -1 },
+    { 103, -1 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -3 },
+    { 8, -3 },
+    { 9, -3 },
+    { 24, -1 },
+    { 58, -1 },
+    { 61, -1 },
+    { 62, -3 },
+    { 63, -1 },
+    { 64, -4 },
+    { 66, -3 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -1 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 89, -2 },
+    { 91, -1 },
+    { 96, -1 },
+    { 99, -1 },
+    { 103, -5 },
+    { 105, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 60, -1 },
+    { 70, -1 },
+    { 96, -1 },
+    { 101, -1 },
+    { 3, 2 },
+    { 4, -4 },
+    { 6, -4 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 42, -1 },
+    { 62, -2 },
+    { 63, 1 },
+    { 64, -3 },
+    { 66, -2 },
+    { 72, 1 },
+    { 74, -1 },
+    { 75, -2 },
+    { 77, -1 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 89, -2 },
+    { 90, 1 },
+    { 91, -1 },
+    { 93, 1 },
+    { 101, -3 },
+    { 103, -3 },
+    { 105, -2 },
+    { 107, -1 },
+    { 108, 1 },
+    { 109, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 24, -3 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 89, -1 },
+    { 96, -2 },
+    { 99, -2 },
+    { 102, -1 },
+    { 103, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 69, 1 },
+    { 70, -2 },
+    { 71, 2 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 87, -2 },
+    { 88, -2 },
+    { 100, -2 },
+    { 101, -2 },
+    { 103, 1 },
+    { 107, -1 },
+    { 3, -1 },
+    { 24, -2 },
+    { 87, -1 },
+    { 88, -1 },
+    { 108, -1 },
+    { 3, 1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, 1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 108, -1 },
+    { 24, -4 },
+    { 107, -1 },
+    { 108, -1 },
+    { 3, -1 },
+    { 4, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 108, -1 },
+    { 24, -2 },
+    { 90, -1 },
+    { 95, -1 },
+    { 24, -3 },
+    { 3, -2 },
+    { 24, -3 },
+    { 85, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 24, -2 },
+    { 83, -2 },
+    { 89, -1 },
+    { 98, -1 },
+    { 24, -2 },
+    { 109, 1 },
+    { 2, 2 },
+    { 24, -3 },
+    { 25, 1 },
+    { 41, 1 },
+    { 85, 2 },
+    { 87, -1 },
+    { 94, 5 },
+    { 107, 1 },
+    { 3, -2 },
+    { 4, -1 },
+    { 6, -1 },
+    { 24, -5 },
+    { 85, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 97, -1 },
+    { 107, -1 },
+    { 108, -3 },
+    { 3, -2 },
+    { 24, -3 },
+    { 84, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -2 },
+    { 101, -1 },
+    { 2, 1 },
+    { 3, 2 },
+    { 24, 2 },
+    { 90, 2 },
+    { 93, 2 },
+    { 95, 2 },
+    { 109, 1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 83, -1 },
+    { 59, -2 },
+    { 62, 1 },
+    { 72, -2 },
+    { 96, -2 },
+    { 4, -4 },
+    { 5, -2 },
+    { 6, -4 },
+    { 8, -2 },
+    { 9, -2 },
+    { 58, -1 },
+    { 60, -1 },
+    { 62, -3 },
+    { 63, 1 },
+    { 64, -4 },
+    { 66, -3 },
+    { 69, -1 },
+    { 70, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 77, -1 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -5 },
+    { 84, -2 },
+    { 89, -2 },
+    { 98, -1 },
+    { 101, -2 },
+    { 103, -4 },
+    { 105, -2 },
+    { 107, -2 },
+    { 82, 2 },
+    { 2, 2 },
+    { 3, 2 },
+    { 4, -3 },
+    { 6, -3 },
+    { 62, -2 },
+    { 63, 2 },
+    { 64, -4 },
+    { 66, -3 },
+    { 70, -2 },
+    { 72, 1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -3 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -5 },
+    { 84, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 98, -3 },
+    { 101, -4 },
+    { 103, -5 },
+    { 105, -2 },
+    { 107, -2 },
+    { 109, 2 },
+    { 3, 1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 42, -1 },
+    { 75, -2 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -3 },
+    { 84, -1 },
+    { 89, -2 },
+    { 98, -1 },
+    { 101, -1 },
+    { 105, -1 },
+    { 109, 1 },
+    { 4, -3 },
+    { 6, -3 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 42, -1 },
+    { 60, -1 },
+    { 62, -2 },
+    { 63, 1 },
+    { 64, -3 },
+    { 66, -3 },
+    { 74, -2 },
+    { 75, -1 },
+    { 78, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 89, -2 },
+    { 91, -1 },
+    { 93, 1 },
+    { 103, -4 },
+    { 109, 1 },
+    { 61, 4 },
+    { 62, 1 },
+    { 64, 1 },
+    { 66, 2 },
+    { 69, 1 },
+    { 94, 5 },
+    { 85, 2 },
+    { 94, 4 },
+    { 107, 1 },
+    { 24, -2 },
+    { 59, -1 },
+    { 66, 2 },
+    { 72, -1 },
+    { 96, -2 },
+    { 99, -2 },
+    { 24, -4 },
+    { 87, -1 },
+    { 88, -1 },
+    { 108, -1 },
+    { 3, 2 },
+    { 4, -4 },
+    { 5, -2 },
+    { 6, -4 },
+    { 7, -4 },
+    { 8, -2 },
+    { 9, -2 },
+    { 24, 1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 60, -1 },
+    { 62, -2 },
+    { 63, 2 },
+    { 64, -3 },
+    { 66, -3 },
+    { 70, -1 },
+    { 72, 1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 83, -4 },
+    { 84, -3 },
+    { 86, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, 1 },
+    { 91, -2 },
+    { 93, 1 },
+    { 95, 1 },
+    { 98, -2 },
+    { 99, 1 },
+    { 101, -2 },
+    { 103, -4 },
+    { 105, -2 },
+    { 107, -2 },
+    { 109, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 61, 4 },
+    { 62, 1 },
+    { 64, 1 },
+    { 66, 2 },
+    { 67, 2 },
+    { 69, 1 },
+    { 70, -2 },
+    { 71, 2 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 85, 1 },
+    { 87, -2 },
+    { 88, -2 },
+    { 94, 4 },
+    { 100, -2 },
+    { 101, -2 },
+    { 103, 2 },
+    { 107, -1 },
+    { 2, 2 },
+    { 24, -2 },
+    { 25, 2 },
+    { 41, 1 },
+    { 85, 2 },
+    { 94, 6 },
+    { 107, 2 },
+    { 109, 1 },
+    { 3, -4 },
+    { 59, -3 },
+    { 60, -1 },
+    { 63, -2 },
+    { 70, -1 },
+    { 71, 1 },
+    { 72, -4 },
+    { 81, -2 },
+    { 85, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 96, -5 },
+    { 97, -1 },
+    { 99, -3 },
+    { 109, -2 },
+    { 64, -1 },
+    { 72, -1 },
+    { 99, -1 },
+    { 63, 1 },
+    { 70, -1 },
+    { 24, -3 },
+    { 94, 2 },
+    { 101, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 64, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 103, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 94, 2 },
+    { 101, -2 },
+    { 105, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 42, -1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 64, -2 },
+    { 66, 1 },
+    { 67, 1 },
+    { 69, 1 },
+    { 70, -2 },
+    { 71, 2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 77, -2 },
+    { 78, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -2 },
+    { 84, -2 },
+    { 85, -1 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 100, -2 },
+    { 101, -2 },
+    { 105, -2 },
+    { 107, -1 },
+    { 24, -2 },
+    { 75, -1 },
+    { 78, -1 },
+    { 83, -1 },
+    { 84, -2 },
+    { 89, -1 },
+    { 109, 1 },
+    { 1, -1 },
+    { 4, -4 },
+    { 6, -4 },
+    { 11, -4 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 26, -3 },
+    { 28, -1 },
+    { 29, -3 },
+    { 34, -3 },
+    { 38, -1 },
+    { 40, -1 },
+    { 44, -4 },
+    { 45, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 52, -3 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -2 },
+    { 60, -1 },
+    { 62, -4 },
+    { 64, -4 },
+    { 65, -1 },
+    { 66, -3 },
+    { 69, -2 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -2 },
+    { 78, -3 },
+    { 79, -2 },
+    { 80, -2 },
+    { 83, -6 },
+    { 84, -3 },
+    { 86, -1 },
+    { 89, -3 },
+    { 91, -3 },
+    { 96, -1 },
+    { 98, -2 },
+    { 103, -4 },
+    { 105, -2 },
+    { 107, -1 },
+    { 1, -3 },
+    { 4, -5 },
+    { 6, -5 },
+    { 10, -2 },
+    { 11, -6 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 26, -4 },
+    { 27, -1 },
+    { 28, -2 },
+    { 29, -4 },
+    { 30, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -3 },
+    { 36, -1 },
+    { 38, -2 },
+    { 40, -1 },
+    { 45, -6 },
+    { 47, -4 },
+    { 48, -1 },
+    { 50, -4 },
+    { 51, -1 },
+    { 52, -4 },
+    { 53, -1 },
+    { 55, -1 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -5 },
+    { 64, -6 },
+    { 65, -2 },
+    { 66, -5 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -4 },
+    { 76, -3 },
+    { 77, -2 },
+    { 78, -4 },
+    { 79, -3 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -7 },
+    { 84, -3 },
+    { 86, -2 },
+    { 89, -4 },
+    { 90, -1 },
+    { 91, -3 },
+    { 92, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 98, -3 },
+    { 99, -1 },
+    { 101, -4 },
+    { 102, -2 },
+    { 103, -6 },
+    { 106, -2 },
+    { 11, 2 },
+    { 13, -1 },
+    { 15, 3 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 2 },
+    { 22, -2 },
+    { 26, -1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 31, 3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 45, 1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 59, -2 },
+    { 60, -1 },
+    { 61, 3 },
+    { 62, 2 },
+    { 64, 2 },
+    { 66, 1 },
+    { 67, 1 },
+    { 70, -1 },
+    { 71, 2 },
+    { 72, -4 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 87, -4 },
+    { 88, -3 },
+    { 94, 3 },
+    { 96, -4 },
+    { 97, -1 },
+    { 99, -2 },
+    { 100, -4 },
+    { 101, -1 },
+    { 103, 1 },
+    { 108, -4 },
+    { 109, -4 },
+};
+
 static const EpdFontData bookerly_18_italic = {
     bookerly_18_italicBitmaps,
     bookerly_18_italicGlyphs,
@@ -7565,4 +9496,8 @@ static const EpdFontData bookerly_18_italic = {
     40,
     -10,
     true,
+    bookerly_18_italicKernLeftClasses,
+    bookerly_18_italicKernRightClasses,
+    bookerly_18_italicKernPairOffsets,
+    bookerly_18_italicKernPairs,
 };
@@ -6590,7 +6590,7 @@ static const EpdGlyph bookerly_18_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, // 	
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 6, 30, 10, 3, 29, 45, 0 }, // !
@@ -7380,6 +7380,2141 @@ static const EpdUnicodeInterval bookerly_18_regularIntervals[] = {
     { 0x22EF, 0x22EF, 0x2D7 },
 };
 
+static const uint8_t bookerly_18_regularKernLeftClasses[728] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 3,
+    0, 4, 5, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    7, 0, 0, 0, 0, 8, 9, 10, 11, 12, 0, 13, 14, 15, 15, 16,
+    17, 18, 19, 20, 12, 21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30,
+    31, 32, 0, 0, 0, 0, 33, 34, 35, 36, 37, 38, 39, 40, 36, 41,
+    42, 43, 40, 40, 34, 34, 44, 45, 46, 47, 48, 49, 49, 50, 49, 51,
+    52, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55,
+    0, 0, 0, 56, 9, 9, 9, 9, 9, 9, 0, 11, 0, 0, 0, 0,
+    15, 15, 15, 15, 12, 20, 12, 12, 12, 12, 12, 0, 57, 26, 26, 26,
+    26, 29, 58, 59, 33, 33, 33, 33, 33, 33, 37, 35, 37, 37, 37, 37,
+    36, 36, 60, 60, 61, 40, 34, 34, 34, 34, 34, 0, 34, 48, 48, 48,
+    48, 49, 34, 49, 9, 33, 9, 33, 62, 63, 11, 35, 11, 35, 11, 35,
+    11, 35, 12, 64, 12, 36, 0, 37, 0, 37, 0, 37, 65, 66, 0, 37,
+    14, 39, 14, 39, 14, 39, 14, 39, 15, 40, 15, 40, 15, 60, 15, 60,
+    15, 60, 67, 68, 15, 36, 16, 41, 16, 69, 17, 42, 42, 18, 43, 18,
+    43, 0, 64, 0, 0, 18, 70, 20, 40, 20, 40, 20, 40, 40, 20, 40,
+    12, 34, 12, 34, 12, 34, 0, 37, 23, 45, 23, 45, 23, 45, 24, 46,
+    24, 46, 24, 46, 24, 46, 25, 71, 25, 0, 25, 47, 26, 48, 26, 48,
+    26, 48, 26, 48, 26, 48, 26, 72, 27, 49, 29, 49, 29, 30, 51, 30,
+    51, 30, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 73, 73, 74, 0, 75, 76, 77, 77, 78, 79, 79,
+    80, 81, 77, 82, 77, 83, 84, 85, 86, 87, 73, 81, 85, 77, 77, 81,
+    77, 88, 77, 89, 77, 90, 91, 86, 82, 92, 93, 87, 77, 77, 87, 79,
+    77, 79, 89, 89, 77, 94, 95, 96, 97, 98, 99, 100, 101, 102, 102, 100,
+    102, 102, 102, 95, 102, 95, 103, 97, 104, 95, 105, 98, 102, 102, 98, 106,
+    102, 106, 95, 95, 102, 99, 99, 107, 97, 108, 109, 110, 111, 112, 106, 106,
+    113, 100, 102, 104, 102, 114, 115, 89, 95, 116, 117, 87, 98, 79, 106, 90,
+    95, 118, 119, 120, 97, 0, 0, 121, 122, 85, 101, 121, 122, 81, 100, 81,
+    100, 81, 100, 87, 98, 0, 0, 0, 0, 123, 124, 91, 103, 86, 97, 125,
+    104, 125, 104, 126, 127, 87, 98, 87, 98, 77, 102, 128, 113, 129, 99, 129,
+    99, 77, 81, 100, 130, 131, 87, 98, 78, 132, 87, 98, 77, 102, 87, 98,
+    133, 83, 94, 83, 94, 73, 99, 73, 99, 89, 95, 89, 95, 81, 100, 85,
+    101, 134, 135, 77, 102, 77, 102, 89, 95, 89, 95, 89, 95, 89, 95, 82,
+    104, 82, 104, 82, 104, 77, 102, 86, 97, 77, 102, 120, 97, 136, 105, 93,
+    105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 5, 0, 5, 5, 5, 0, 0, 137, 138, 4, 137, 137, 138, 4,
+    137, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t bookerly_18_regularKernRightClasses[728] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 4,
+    0, 5, 6, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    10, 0, 0, 0, 11, 0, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15,
+    13, 13, 16, 13, 14, 13, 14, 13, 17, 18, 19, 20, 20, 21, 22, 23,
+    0, 24, 25, 0, 0, 0, 26, 27, 28, 28, 28, 29, 30, 31, 32, 33,
+    31, 31, 34, 34, 28, 35, 28, 34, 36, 37, 38, 39, 39, 40, 41, 42,
+    0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+    0, 0, 0, 46, 12, 12, 12, 12, 12, 12, 47, 14, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 0, 48, 19, 19, 19,
+    19, 22, 13, 49, 26, 26, 26, 50, 51, 26, 26, 28, 28, 28, 28, 52,
+    53, 32, 54, 55, 28, 34, 28, 28, 28, 28, 28, 0, 56, 38, 38, 38,
+    38, 41, 31, 41, 12, 57, 12, 57, 12, 26, 14, 28, 14, 28, 14, 28,
+    14, 28, 13, 28, 13, 28, 13, 58, 13, 58, 13, 28, 13, 28, 13, 28,
+    14, 30, 14, 30, 14, 30, 14, 30, 13, 31, 13, 59, 13, 55, 13, 55,
+    13, 55, 13, 32, 13, 32, 13, 32, 15, 60, 13, 31, 34, 13, 31, 13,
+    31, 13, 31, 13, 31, 13, 61, 13, 34, 13, 34, 13, 34, 34, 13, 34,
+    14, 28, 14, 28, 14, 28, 14, 28, 13, 34, 13, 34, 13, 62, 17, 36,
+    17, 36, 17, 36, 17, 63, 18, 37, 18, 37, 18, 37, 19, 38, 19, 38,
+    19, 38, 19, 38, 19, 38, 19, 38, 20, 39, 22, 41, 22, 23, 42, 23,
+    42, 23, 64, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 65, 65, 66, 65, 67, 68, 65, 65, 69, 70, 65,
+    66, 65, 65, 71, 65, 72, 65, 65, 65, 73, 65, 74, 75, 65, 65, 65,
+    70, 76, 65, 67, 65, 65, 67, 66, 71, 77, 78, 65, 79, 65, 65, 66,
+    65, 65, 80, 65, 81, 82, 83, 84, 84, 85, 86, 87, 88, 84, 84, 84,
+    89, 84, 84, 86, 84, 90, 86, 91, 92, 86, 93, 84, 94, 84, 84, 91,
+    84, 84, 88, 84, 95, 86, 86, 96, 84, 86, 97, 98, 99, 100, 89, 84,
+    96, 84, 84, 92, 84, 66, 91, 67, 86, 101, 92, 65, 84, 102, 103, 65,
+    90, 65, 84, 65, 84, 65, 84, 74, 87, 75, 88, 65, 84, 65, 84, 0,
+    0, 66, 91, 65, 84, 65, 84, 65, 84, 67, 86, 67, 86, 66, 91, 104,
+    92, 104, 92, 78, 93, 0, 91, 79, 94, 79, 94, 65, 96, 105, 106, 105,
+    106, 65, 74, 87, 65, 84, 70, 89, 65, 84, 65, 84, 79, 94, 0, 84,
+    96, 72, 82, 72, 82, 107, 82, 65, 86, 108, 109, 0, 109, 74, 87, 75,
+    88, 0, 110, 65, 84, 65, 84, 67, 86, 67, 86, 67, 86, 0, 88, 71,
+    92, 71, 92, 71, 92, 0, 94, 65, 84, 65, 84, 65, 84, 78, 93, 78,
+    93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 0, 6, 6, 6, 0, 0, 111, 112, 7, 111, 111, 112, 7,
+    111, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 1, 0, 0, 0,
+    11, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_18_regularKernPairOffsets[139] = {
+    0, 4, 28, 43, 82, 100, 152, 156, 158, 183, 196, 210, 225, 250, 254, 266,
+    292, 312, 323, 335, 357, 388, 410, 428, 436, 467, 494, 540, 558, 603, 606, 616,
+    642, 649, 660, 663, 666, 670, 702, 715, 722, 725, 737, 742, 749, 773, 784, 787,
+    794, 821, 832, 833, 844, 852, 860, 879, 924, 936, 965, 979, 991, 1002, 1030, 1039,
+    1065, 1066, 1072, 1085, 1090, 1099, 1114, 1118, 1127, 1128, 1140, 1143, 1154, 1164, 1190, 1214,
+    1231, 1251, 1293, 1324, 1333, 1349, 1380, 1391, 1405, 1425, 1450, 1456, 1477, 1496, 1507, 1520,
+    1525, 1534, 1538, 1542, 1547, 1552, 1553, 1556, 1575, 1582, 1593, 1603, 1604, 1613, 1618, 1626,
+    1628, 1637, 1646, 1653, 1686, 1698, 1731, 1740, 1761, 1784, 1789, 1796, 1801, 1843, 1870, 1878,
+    1891, 1894, 1896, 1898, 1908, 1913, 1915, 1917, 1940, 1979, 2022,
+};
+
+static const EpdKernPair bookerly_18_regularKernPairs[] = {
+    { 12, -2 },
+    { 30, -2 },
+    { 37, 2 },
+    { 72, -2 },
+    { 14, -1 },
+    { 15, 2 },
+    { 26, -1 },
+    { 28, -1 },
+    { 33, 2 },
+    { 39, 1 },
+    { 41, 1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 2 },
+    { 67, -1 },
+    { 69, 2 },
+    { 82, -1 },
+    { 86, -1 },
+    { 92, 1 },
+    { 99, 1 },
+    { 100, 2 },
+    { 12, -3 },
+    { 20, 2 },
+    { 21, 2 },
+    { 28, -1 },
+    { 30, -1 },
+    { 47, -5 },
+    { 52, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 70, -3 },
+    { 72, -3 },
+    { 78, 2 },
+    { 86, -1 },
+    { 101, 2 },
+    { 107, -5 },
+    { 12, 1 },
+    { 14, -2 },
+    { 15, 1 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -3 },
+    { 22, -3 },
+    { 27, -1 },
+    { 28, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 41, -2 },
+    { 48, -2 },
+    { 52, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 66, -3 },
+    { 67, -2 },
+    { 69, 1 },
+    { 71, -3 },
+    { 72, 1 },
+    { 73, 1 },
+    { 77, -1 },
+    { 79, -4 },
+    { 86, -1 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -2 },
+    { 93, 1 },
+    { 94, -2 },
+    { 101, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -2 },
+    { 111, -3 },
+    { 112, -2 },
+    { 12, -1 },
+    { 15, -1 },
+    { 18, -2 },
+    { 20, -2 },
+    { 22, -2 },
+    { 39, -1 },
+    { 41, -1 },
+    { 47, -1 },
+    { 66, -2 },
+    { 69, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 77, 1 },
+    { 79, -1 },
+    { 92, -1 },
+    { 101, -2 },
+    { 104, -2 },
+    { 107, -1 },
+    { 12, -4 },
+    { 14, -2 },
+    { 17, -1 },
+    { 23, -1 },
+    { 26, -4 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -3 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -1 },
+    { 42, -2 },
+    { 47, -5 },
+    { 48, -2 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -3 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -3 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 70, -3 },
+    { 72, -4 },
+    { 73, -3 },
+    { 77, -2 },
+    { 82, -4 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -2 },
+    { 95, -3 },
+    { 97, -3 },
+    { 99, 2 },
+    { 106, -1 },
+    { 107, -5 },
+    { 110, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 22, -1 },
+    { 104, -1 },
+    { 2, -2 },
+    { 4, -3 },
+    { 6, -1 },
+    { 8, 1 },
+    { 11, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 18, -4 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 1 },
+    { 22, -4 },
+    { 24, -4 },
+    { 27, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 44, -1 },
+    { 47, 1 },
+    { 48, 1 },
+    { 111, -3 },
+    { 112, -3 },
+    { 5, -1 },
+    { 7, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 24, -2 },
+    { 28, 1 },
+    { 33, 1 },
+    { 47, -1 },
+    { 52, 1 },
+    { 56, 1 },
+    { 58, 1 },
+    { 6, -1 },
+    { 14, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 24, -1 },
+    { 37, 1 },
+    { 47, -3 },
+    { 49, -1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 12, -3 },
+    { 16, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -2 },
+    { 36, -1 },
+    { 42, -1 },
+    { 47, -4 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 2 },
+    { 63, -1 },
+    { 64, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 47, -1 },
+    { 14, -1 },
+    { 28, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -2 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 47, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 6, -1 },
+    { 12, 1 },
+    { 14, -2 },
+    { 16, 1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 41, -2 },
+    { 48, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 4, -2 },
+    { 12, 2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 22, -3 },
+    { 24, -4 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 12, 1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, 1 },
+    { 22, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 47, 1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 111, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 47, -2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 5, -4 },
+    { 7, -4 },
+    { 8, -4 },
+    { 12, -4 },
+    { 13, -1 },
+    { 16, -1 },
+    { 18, 1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 33, 1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 47, -5 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, 2 },
+    { 63, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 3, 2 },
+    { 5, 1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 10, 1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, 4 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 24, -1 },
+    { 25, 2 },
+    { 30, 1 },
+    { 33, 3 },
+    { 37, 1 },
+    { 41, 2 },
+    { 43, 3 },
+    { 47, -3 },
+    { 49, -1 },
+    { 60, 3 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, -1 },
+    { 12, 2 },
+    { 14, -1 },
+    { 16, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, 1 },
+    { 22, -3 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 47, 1 },
+    { 111, -2 },
+    { 112, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 30, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 47, -1 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -5 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -4 },
+    { 14, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 26, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 36, -3 },
+    { 42, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 47, -4 },
+    { 48, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 63, -3 },
+    { 64, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 12, -3 },
+    { 14, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -2 },
+    { 36, -1 },
+    { 40, -1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 47, -3 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 4, 2 },
+    { 5, -4 },
+    { 6, -2 },
+    { 7, -4 },
+    { 8, -5 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -4 },
+    { 14, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 28, -3 },
+    { 29, -1 },
+    { 30, -3 },
+    { 31, 1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 47, -5 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -3 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -3 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 16, 1 },
+    { 21, 1 },
+    { 27, 1 },
+    { 31, 1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 12, -4 },
+    { 14, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 26, -2 },
+    { 27, 1 },
+    { 28, -3 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, 1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -3 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 45, -2 },
+    { 47, -4 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -3 },
+    { 54, 2 },
+    { 55, 3 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -3 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, -3 },
+    { 64, -1 },
+    { 112, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 1 },
+    { 15, 2 },
+    { 33, 2 },
+    { 41, 2 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 2 },
+    { 69, 2 },
+    { 92, 2 },
+    { 99, 1 },
+    { 100, 2 },
+    { 14, -1 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -4 },
+    { 22, -3 },
+    { 28, -1 },
+    { 30, 1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 66, -3 },
+    { 67, -1 },
+    { 71, -2 },
+    { 79, -4 },
+    { 86, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 101, -4 },
+    { 104, -3 },
+    { 105, -2 },
+    { 4, -2 },
+    { 11, -1 },
+    { 24, -4 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 24, -2 },
+    { 40, -1 },
+    { 61, 2 },
+    { 111, -2 },
+    { 112, -1 },
+    { 24, -2 },
+    { 30, -1 },
+    { 112, 1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 61, 1 },
+    { 111, -1 },
+    { 1, 2 },
+    { 2, 4 },
+    { 3, 4 },
+    { 4, 4 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 11, 2 },
+    { 24, 3 },
+    { 25, 3 },
+    { 28, -1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 36, -1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 43, 4 },
+    { 50, 1 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 4 },
+    { 54, 3 },
+    { 55, 5 },
+    { 56, -1 },
+    { 57, 1 },
+    { 59, 4 },
+    { 60, 4 },
+    { 62, 2 },
+    { 63, 1 },
+    { 64, 1 },
+    { 111, 3 },
+    { 112, 4 },
+    { 2, 1 },
+    { 4, 1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 60, 1 },
+    { 111, 1 },
+    { 112, 2 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 39, -2 },
+    { 41, -2 },
+    { 111, -2 },
+    { 112, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 30, -1 },
+    { 11, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 36, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 11, -1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 33, 2 },
+    { 39, -1 },
+    { 41, 1 },
+    { 60, 2 },
+    { 111, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 11, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 26, -1 },
+    { 30, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 111, -1 },
+    { 24, -2 },
+    { 111, 1 },
+    { 112, 1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -2 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, 1 },
+    { 30, -2 },
+    { 31, -1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, 2 },
+    { 61, -1 },
+    { 63, -1 },
+    { 111, 2 },
+    { 112, 2 },
+    { 4, 1 },
+    { 28, -1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 111, 2 },
+    { 112, 2 },
+    { 24, -2 },
+    { 15, 2 },
+    { 33, 2 },
+    { 39, 2 },
+    { 41, 2 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, 2 },
+    { 69, 2 },
+    { 92, 2 },
+    { 99, 1 },
+    { 100, 2 },
+    { 15, 2 },
+    { 20, -1 },
+    { 22, -2 },
+    { 33, 2 },
+    { 69, 2 },
+    { 100, 2 },
+    { 101, -1 },
+    { 104, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -2 },
+    { 66, -1 },
+    { 79, -1 },
+    { 101, -1 },
+    { 104, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 18, -1 },
+    { 20, -2 },
+    { 22, -2 },
+    { 47, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 87, -1 },
+    { 101, -2 },
+    { 104, -2 },
+    { 107, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 22, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 31, -1 },
+    { 34, -1 },
+    { 36, -2 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 69, 1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 97, -2 },
+    { 101, -2 },
+    { 104, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 19, -1 },
+    { 24, -1 },
+    { 37, 1 },
+    { 47, -3 },
+    { 49, -1 },
+    { 3, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -4 },
+    { 11, -1 },
+    { 12, -4 },
+    { 13, -2 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -3 },
+    { 22, -3 },
+    { 24, -3 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 47, -4 },
+    { 50, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 34, -1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 41, -2 },
+    { 62, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 3, 1 },
+    { 4, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 27, 2 },
+    { 31, 2 },
+    { 43, 1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 59, 2 },
+    { 61, 2 },
+    { 112, 1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 24, -1 },
+    { 40, -1 },
+    { 61, 2 },
+    { 111, -1 },
+    { 112, -1 },
+    { 2, -2 },
+    { 4, -3 },
+    { 6, -1 },
+    { 8, 1 },
+    { 11, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 16, 1 },
+    { 18, -4 },
+    { 19, -2 },
+    { 20, -4 },
+    { 21, 1 },
+    { 22, -4 },
+    { 24, -4 },
+    { 27, -1 },
+    { 33, 2 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 44, -1 },
+    { 47, 1 },
+    { 48, 1 },
+    { 60, 2 },
+    { 111, -3 },
+    { 112, -3 },
+    { 4, -2 },
+    { 11, -1 },
+    { 24, -4 },
+    { 33, 3 },
+    { 39, -1 },
+    { 41, -1 },
+    { 60, 3 },
+    { 111, -2 },
+    { 112, -1 },
+    { 1, 1 },
+    { 3, 3 },
+    { 4, 3 },
+    { 11, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 27, 4 },
+    { 29, 2 },
+    { 31, 4 },
+    { 32, 2 },
+    { 33, 2 },
+    { 37, 2 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 43, 3 },
+    { 51, 2 },
+    { 53, 2 },
+    { 59, 4 },
+    { 60, 3 },
+    { 61, 4 },
+    { 62, 2 },
+    { 63, 2 },
+    { 64, 1 },
+    { 111, 2 },
+    { 112, 3 },
+    { 33, 1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 33, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 111, -1 },
+    { 14, -1 },
+    { 28, -1 },
+    { 33, 1 },
+    { 39, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 33, 3 },
+    { 39, -1 },
+    { 41, -1 },
+    { 60, 3 },
+    { 111, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 27, 2 },
+    { 30, -1 },
+    { 31, 2 },
+    { 59, 2 },
+    { 61, 2 },
+    { 111, 2 },
+    { 112, 2 },
+    { 11, -1 },
+    { 29, 2 },
+    { 32, 2 },
+    { 33, 2 },
+    { 34, 2 },
+    { 35, 2 },
+    { 37, 2 },
+    { 38, 2 },
+    { 39, 2 },
+    { 40, 1 },
+    { 41, 2 },
+    { 53, 2 },
+    { 62, 2 },
+    { 111, -1 },
+    { 112, -1 },
+    { 24, -2 },
+    { 33, 1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 33, 3 },
+    { 39, -1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 60, 3 },
+    { 111, -1 },
+    { 112, -1 },
+    { 105, -1 },
+    { 4, -2 },
+    { 24, -2 },
+    { 66, -2 },
+    { 71, -2 },
+    { 79, -2 },
+    { 92, -1 },
+    { 94, -1 },
+    { 101, -3 },
+    { 104, -2 },
+    { 105, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 105, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 81, -1 },
+    { 85, -2 },
+    { 87, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 107, -1 },
+    { 44, -1 },
+    { 67, -1 },
+    { 77, -2 },
+    { 86, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 99, 1 },
+    { 105, -2 },
+    { 106, -2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 70, -2 },
+    { 72, -2 },
+    { 73, -1 },
+    { 77, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 95, -2 },
+    { 97, -1 },
+    { 99, 1 },
+    { 105, -2 },
+    { 106, -2 },
+    { 107, -2 },
+    { 4, -2 },
+    { 6, 1 },
+    { 24, -2 },
+    { 66, -2 },
+    { 69, -1 },
+    { 71, -3 },
+    { 73, -1 },
+    { 74, -1 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, 1 },
+    { 83, 1 },
+    { 85, -1 },
+    { 86, 1 },
+    { 87, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 101, -3 },
+    { 104, -3 },
+    { 105, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 4, -3 },
+    { 24, -4 },
+    { 66, -2 },
+    { 67, -1 },
+    { 71, -3 },
+    { 77, -1 },
+    { 79, -4 },
+    { 83, -1 },
+    { 91, -2 },
+    { 92, -3 },
+    { 94, -3 },
+    { 101, -3 },
+    { 104, -2 },
+    { 105, -3 },
+    { 106, -2 },
+    { 111, -1 },
+    { 112, -2 },
+    { 44, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 71, -1 },
+    { 72, 1 },
+    { 77, -3 },
+    { 79, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 91, -3 },
+    { 92, -2 },
+    { 94, -3 },
+    { 101, -1 },
+    { 104, -1 },
+    { 105, -3 },
+    { 106, -3 },
+    { 108, -1 },
+    { 109, -1 },
+    { 110, -1 },
+    { 111, -2 },
+    { 5, -5 },
+    { 6, -2 },
+    { 7, -5 },
+    { 8, -4 },
+    { 44, -3 },
+    { 45, -2 },
+    { 67, -3 },
+    { 68, -1 },
+    { 70, -4 },
+    { 71, 1 },
+    { 72, -6 },
+    { 73, -4 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -3 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -4 },
+    { 84, -3 },
+    { 85, -5 },
+    { 86, -4 },
+    { 87, -2 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -6 },
+    { 97, -3 },
+    { 99, 3 },
+    { 101, 1 },
+    { 104, 2 },
+    { 105, -1 },
+    { 106, -4 },
+    { 107, -6 },
+    { 108, -1 },
+    { 109, -2 },
+    { 110, -1 },
+    { 112, 1 },
+    { 2, -2 },
+    { 4, -3 },
+    { 6, -1 },
+    { 8, 1 },
+    { 11, -2 },
+    { 24, -4 },
+    { 44, -1 },
+    { 66, -4 },
+    { 67, -1 },
+    { 70, 1 },
+    { 71, -3 },
+    { 72, 1 },
+    { 73, 1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 79, -5 },
+    { 85, 1 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, -3 },
+    { 101, -4 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -2 },
+    { 107, 1 },
+    { 111, -3 },
+    { 112, -3 },
+    { 66, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 95, -1 },
+    { 105, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 66, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 83, 1 },
+    { 85, -1 },
+    { 86, 1 },
+    { 95, -1 },
+    { 100, 1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -1 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -5 },
+    { 9, -2 },
+    { 10, -2 },
+    { 44, -2 },
+    { 45, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -3 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 81, -2 },
+    { 82, -2 },
+    { 85, -3 },
+    { 86, -2 },
+    { 88, -1 },
+    { 89, -3 },
+    { 95, -4 },
+    { 97, -3 },
+    { 99, 2 },
+    { 105, -1 },
+    { 106, -4 },
+    { 107, -4 },
+    { 109, -1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 67, -1 },
+    { 69, 2 },
+    { 72, 1 },
+    { 77, -2 },
+    { 86, -1 },
+    { 91, -1 },
+    { 92, 1 },
+    { 94, -1 },
+    { 100, 2 },
+    { 105, -2 },
+    { 106, -2 },
+    { 66, -1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 77, -1 },
+    { 78, 1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 99, 2 },
+    { 101, -1 },
+    { 104, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, 1 },
+    { 111, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 24, -1 },
+    { 65, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 85, -2 },
+    { 89, -2 },
+    { 95, -2 },
+    { 101, -1 },
+    { 104, -2 },
+    { 107, -3 },
+    { 2, 1 },
+    { 4, 1 },
+    { 5, -4 },
+    { 7, -4 },
+    { 8, -4 },
+    { 65, -1 },
+    { 66, 1 },
+    { 70, -3 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -1 },
+    { 76, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 92, 1 },
+    { 95, -2 },
+    { 97, -1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 107, -5 },
+    { 111, 1 },
+    { 112, 1 },
+    { 6, -1 },
+    { 67, -1 },
+    { 81, 1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 97, -1 },
+    { 5, -2 },
+    { 6, 1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 65, -1 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -3 },
+    { 74, -3 },
+    { 76, -1 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -2 },
+    { 85, -2 },
+    { 89, -1 },
+    { 95, -1 },
+    { 101, -1 },
+    { 104, -1 },
+    { 107, -3 },
+    { 4, 1 },
+    { 67, -1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 85, 1 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, -2 },
+    { 93, 1 },
+    { 94, -2 },
+    { 96, 1 },
+    { 99, 2 },
+    { 105, -3 },
+    { 106, -2 },
+    { 107, 1 },
+    { 4, -2 },
+    { 11, -1 },
+    { 24, -4 },
+    { 89, 1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -2 },
+    { 106, -1 },
+    { 110, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 24, -2 },
+    { 85, -1 },
+    { 89, -1 },
+    { 93, -1 },
+    { 95, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 95, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -3 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 90, 1 },
+    { 95, -2 },
+    { 112, 1 },
+    { 24, -2 },
+    { 92, 1 },
+    { 100, 1 },
+    { 106, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 95, -1 },
+    { 111, -1 },
+    { 24, -2 },
+    { 44, -1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 106, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 24, -2 },
+    { 95, -1 },
+    { 111, -1 },
+    { 106, -1 },
+    { 24, -2 },
+    { 95, -1 },
+    { 112, 1 },
+    { 4, 2 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -2 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 90, 1 },
+    { 92, 1 },
+    { 93, 1 },
+    { 94, 2 },
+    { 95, -2 },
+    { 97, -1 },
+    { 98, 1 },
+    { 100, 2 },
+    { 111, 2 },
+    { 112, 2 },
+    { 4, 1 },
+    { 86, -1 },
+    { 90, 1 },
+    { 92, 1 },
+    { 106, -1 },
+    { 111, 2 },
+    { 112, 2 },
+    { 4, -2 },
+    { 24, -4 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -3 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 91, -1 },
+    { 92, -2 },
+    { 94, -2 },
+    { 95, -1 },
+    { 106, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 112, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 24, -2 },
+    { 82, -1 },
+    { 85, -1 },
+    { 95, -1 },
+    { 111, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 3, 1 },
+    { 4, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 43, 1 },
+    { 96, 2 },
+    { 99, 2 },
+    { 112, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 4, -1 },
+    { 11, -1 },
+    { 24, -3 },
+    { 91, -1 },
+    { 92, -2 },
+    { 94, -2 },
+    { 106, -1 },
+    { 111, -2 },
+    { 112, -1 },
+    { 6, 1 },
+    { 24, -2 },
+    { 66, -2 },
+    { 71, -2 },
+    { 74, -1 },
+    { 79, -2 },
+    { 101, -2 },
+    { 104, -2 },
+    { 105, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 111, -1 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 44, -1 },
+    { 45, -1 },
+    { 67, -1 },
+    { 70, -3 },
+    { 71, 1 },
+    { 72, -5 },
+    { 73, -4 },
+    { 74, -1 },
+    { 77, -2 },
+    { 81, -2 },
+    { 82, -2 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -3 },
+    { 89, -3 },
+    { 91, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -4 },
+    { 97, -3 },
+    { 104, 2 },
+    { 105, -2 },
+    { 106, -3 },
+    { 107, -6 },
+    { 109, -2 },
+    { 110, -2 },
+    { 111, 1 },
+    { 112, 1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 8, -1 },
+    { 85, -2 },
+    { 89, -2 },
+    { 90, 2 },
+    { 92, 2 },
+    { 94, 1 },
+    { 95, -1 },
+    { 100, 2 },
+    { 111, 1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -3 },
+    { 8, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 70, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -1 },
+    { 77, -2 },
+    { 81, -2 },
+    { 82, -3 },
+    { 84, -2 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -2 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -3 },
+    { 97, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 107, -5 },
+    { 109, -2 },
+    { 110, -2 },
+    { 111, 1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 95, -2 },
+    { 97, -1 },
+    { 112, 1 },
+    { 4, 2 },
+    { 5, -2 },
+    { 7, -2 },
+    { 8, -3 },
+    { 70, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 76, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 95, -2 },
+    { 97, -1 },
+    { 99, 2 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -4 },
+    { 111, 1 },
+    { 112, 1 },
+    { 44, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 69, 2 },
+    { 71, -1 },
+    { 72, 1 },
+    { 77, -3 },
+    { 78, 1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 86, -1 },
+    { 91, -3 },
+    { 92, 1 },
+    { 94, -3 },
+    { 100, 2 },
+    { 101, -1 },
+    { 104, -1 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, 1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 111, -1 },
+    { 44, -1 },
+    { 86, -1 },
+    { 92, 1 },
+    { 100, 2 },
+    { 106, -2 },
+    { 66, -2 },
+    { 71, -2 },
+    { 79, -2 },
+    { 101, -2 },
+    { 104, -2 },
+    { 105, -2 },
+    { 111, -1 },
+    { 24, -4 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 111, -2 },
+    { 5, -3 },
+    { 6, -2 },
+    { 7, -3 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, -1 },
+    { 44, -2 },
+    { 45, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 70, -3 },
+    { 71, 1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 81, -2 },
+    { 82, -2 },
+    { 84, -1 },
+    { 85, -3 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -4 },
+    { 96, 1 },
+    { 97, -2 },
+    { 99, 3 },
+    { 101, 1 },
+    { 104, 1 },
+    { 105, -2 },
+    { 106, -3 },
+    { 107, -4 },
+    { 109, -2 },
+    { 110, -1 },
+    { 112, 1 },
+    { 4, 1 },
+    { 67, -1 },
+    { 69, 2 },
+    { 70, 1 },
+    { 72, 1 },
+    { 73, 1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 81, 2 },
+    { 85, 1 },
+    { 87, 2 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, 2 },
+    { 93, 1 },
+    { 94, -2 },
+    { 95, 1 },
+    { 96, 1 },
+    { 98, 1 },
+    { 99, 2 },
+    { 100, 2 },
+    { 103, 1 },
+    { 105, -3 },
+    { 106, -2 },
+    { 107, 1 },
+    { 4, 1 },
+    { 86, -1 },
+    { 90, 1 },
+    { 92, 1 },
+    { 100, 3 },
+    { 106, -1 },
+    { 111, 2 },
+    { 112, 2 },
+    { 24, -5 },
+    { 66, -3 },
+    { 67, -1 },
+    { 71, -3 },
+    { 77, -1 },
+    { 79, -4 },
+    { 91, -2 },
+    { 92, -2 },
+    { 94, -2 },
+    { 101, -4 },
+    { 104, -4 },
+    { 105, -2 },
+    { 106, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 81, -1 },
+    { 74, -1 },
+    { 105, -1 },
+    { 91, -1 },
+    { 106, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 89, -2 },
+    { 95, -2 },
+    { 96, -1 },
+    { 97, -1 },
+    { 106, -1 },
+    { 11, -1 },
+    { 92, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 112, -1 },
+    { 74, -1 },
+    { 95, -1 },
+    { 86, -1 },
+    { 106, -1 },
+    { 4, 1 },
+    { 67, -2 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 82, -2 },
+    { 83, -1 },
+    { 85, 1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 89, 1 },
+    { 91, -2 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, -2 },
+    { 96, 1 },
+    { 97, -1 },
+    { 99, 2 },
+    { 105, -3 },
+    { 106, -4 },
+    { 107, 1 },
+    { 109, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 12, -3 },
+    { 18, 2 },
+    { 20, 1 },
+    { 22, 1 },
+    { 27, 1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 31, 1 },
+    { 36, -1 },
+    { 46, -4 },
+    { 47, -4 },
+    { 52, -1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 63, -1 },
+    { 66, 2 },
+    { 70, -2 },
+    { 71, 1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 81, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -2 },
+    { 95, -2 },
+    { 96, 1 },
+    { 97, -1 },
+    { 99, 2 },
+    { 101, 1 },
+    { 102, 1 },
+    { 104, 1 },
+    { 107, -4 },
+    { 5, -3 },
+    { 7, -3 },
+    { 12, -4 },
+    { 14, -2 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 26, -2 },
+    { 28, -2 },
+    { 30, -3 },
+    { 36, -3 },
+    { 42, -1 },
+    { 47, -6 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 60, 2 },
+    { 63, -3 },
+    { 64, -1 },
+    { 67, -2 },
+    { 68, -1 },
+    { 70, -3 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -1 },
+    { 81, -2 },
+    { 82, -2 },
+    { 85, -3 },
+    { 86, -2 },
+    { 89, -3 },
+    { 95, -3 },
+    { 97, -3 },
+    { 99, 1 },
+    { 101, 1 },
+    { 104, 1 },
+    { 106, -2 },
+    { 107, -6 },
+};
+
 static const EpdFontData bookerly_18_regular = {
     bookerly_18_regularBitmaps,
     bookerly_18_regularGlyphs,
@@ -7389,4 +9524,8 @@ static const EpdFontData bookerly_18_regular = {
     40,
     -10,
     true,
+    bookerly_18_regularKernLeftClasses,
+    bookerly_18_regularKernRightClasses,
+    bookerly_18_regularKernPairOffsets,
+    bookerly_18_regularKernPairs,
 };
@@ -3115,7 +3115,7 @@ static const uint8_t notosans_12_boldBitmaps[49639] = {
 
 static const EpdGlyph notosans_12_boldGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 5, 19, 7, 1, 18, 24, 0 }, // !
     { 10, 7, 12, 1, 18, 18, 24 }, // "
@@ -3964,6 +3964,434 @@ static const EpdUnicodeInterval notosans_12_boldIntervals[] = {
     { 0x2212, 0x2212, 0x341 },
 };
 
+static const uint8_t notosans_12_boldKernLeftClasses[834] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 0, 0, 7, 8, 9, 0, 0, 0, 0, 0, 10, 0,
+    0, 7, 11, 7, 0, 0, 12, 0, 13, 13, 0, 14, 0, 3, 0, 0,
+    0, 8, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 16, 0, 0, 0, 17, 17, 0, 17, 0, 3, 0, 0,
+    0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0,
+    21, 6, 6, 6, 6, 6, 6, 8, 0, 8, 8, 8, 8, 0, 0, 0,
+    0, 7, 0, 7, 7, 7, 7, 7, 0, 7, 0, 0, 0, 0, 14, 11,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0,
+    17, 6, 0, 6, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    24, 7, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 22, 0, 0, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 10, 0, 10, 24,
+    10, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 7,
+    0, 7, 0, 8, 0, 0, 16, 0, 16, 0, 16, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 0, 12, 27, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13, 17, 14, 17, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 28, 28, 29, 30, 31, 0, 0, 0, 0, 32, 32, 29, 33, 0, 34,
+    0, 35, 0, 0, 30, 36, 28, 33, 0, 0, 0, 33, 0, 0, 0, 37,
+    0, 38, 31, 30, 34, 39, 33, 36, 0, 0, 36, 32, 0, 32, 37, 37,
+    0, 40, 41, 42, 43, 44, 45, 46, 42, 42, 42, 46, 42, 42, 42, 45,
+    42, 45, 0, 43, 47, 45, 46, 44, 42, 42, 44, 48, 42, 48, 45, 45,
+    42, 45, 45, 49, 50, 0, 51, 0, 52, 28, 48, 48, 49, 46, 42, 47,
+    42, 37, 53, 54, 48, 31, 0, 35, 55, 35, 55, 0, 0, 0, 0, 53,
+    0, 0, 45, 37, 45, 34, 53, 34, 53, 47, 47, 37, 45, 37, 45, 37,
+    53, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 44, 54, 48, 38,
+    45, 56, 57, 58, 59, 0, 0, 60, 0, 53, 42, 60, 0, 33, 46, 33,
+    46, 33, 46, 36, 44, 58, 57, 0, 0, 0, 45, 31, 0, 56, 57, 61,
+    53, 61, 53, 60, 0, 36, 44, 36, 44, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 33, 46, 0, 0, 36, 44, 0, 0, 36, 44, 0, 0, 36, 44,
+    0, 35, 40, 35, 40, 28, 0, 28, 0, 37, 45, 37, 45, 33, 46, 53,
+    42, 0, 0, 0, 42, 0, 42, 37, 45, 37, 45, 37, 45, 37, 45, 34,
+    47, 34, 47, 34, 47, 0, 42, 56, 57, 0, 42, 58, 59, 60, 0, 33,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 20, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint8_t notosans_12_boldKernRightClasses[834] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 0, 13, 13, 0, 14, 0, 0, 0, 4,
+    0, 0, 0, 15, 16, 17, 17, 17, 0, 15, 16, 0, 18, 16, 16, 19,
+    19, 17, 19, 17, 19, 15, 0, 19, 0, 0, 0, 0, 20, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 23, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 0, 14, 0,
+    0, 17, 15, 15, 15, 15, 15, 15, 17, 17, 17, 17, 17, 0, 0, 0,
+    0, 0, 0, 17, 17, 17, 17, 17, 0, 17, 19, 19, 19, 19, 0, 16,
+    0, 9, 15, 9, 15, 9, 15, 10, 17, 10, 17, 10, 17, 10, 17, 0,
+    17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 10, 15, 10,
+    15, 10, 15, 10, 15, 0, 16, 0, 24, 0, 25, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 0, 16, 0, 16, 0, 16,
+    0, 16, 0, 0, 0, 19, 0, 19, 0, 0, 0, 0, 19, 10, 17, 10,
+    17, 10, 17, 10, 17, 0, 19, 0, 19, 0, 0, 0, 15, 0, 0, 0,
+    15, 0, 0, 12, 0, 12, 0, 12, 0, 0, 19, 0, 19, 0, 19, 0,
+    19, 0, 19, 0, 19, 13, 0, 14, 0, 14, 0, 20, 0, 20, 0, 20,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 26, 0, 27, 0, 0, 0, 28, 29, 0, 26, 0, 0, 30,
+    0, 31, 0, 0, 0, 32, 0, 33, 33, 0, 0, 0, 29, 0, 0, 27,
+    0, 0, 27, 26, 30, 34, 33, 0, 35, 0, 0, 26, 0, 0, 33, 0,
+    27, 36, 27, 7, 7, 37, 38, 27, 0, 7, 7, 7, 39, 7, 7, 38,
+    7, 7, 38, 40, 41, 38, 27, 7, 42, 7, 7, 40, 7, 7, 0, 7,
+    43, 38, 38, 44, 7, 38, 27, 0, 45, 46, 39, 7, 44, 7, 7, 41,
+    7, 10, 0, 0, 0, 0, 47, 31, 37, 0, 47, 0, 0, 0, 47, 33,
+    0, 35, 0, 10, 36, 48, 0, 48, 0, 10, 36, 10, 36, 10, 36, 10,
+    0, 10, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 44, 0,
+    47, 0, 47, 0, 0, 0, 47, 33, 27, 33, 0, 0, 47, 0, 47, 0,
+    44, 49, 40, 0, 47, 0, 47, 0, 47, 10, 36, 10, 36, 26, 40, 50,
+    51, 50, 51, 33, 27, 49, 40, 35, 42, 35, 42, 0, 47, 52, 53, 52,
+    53, 0, 33, 27, 0, 47, 54, 37, 0, 47, 0, 47, 35, 42, 0, 47,
+    0, 31, 55, 31, 55, 31, 55, 0, 36, 0, 55, 0, 55, 33, 27, 33,
+    0, 0, 0, 0, 7, 0, 7, 10, 36, 10, 36, 10, 36, 33, 0, 30,
+    41, 30, 41, 30, 41, 35, 42, 0, 47, 0, 7, 0, 0, 33, 27, 33,
+    27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 56, 2, 5, 0, 56, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 22, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint16_t notosans_12_boldKernPairOffsets[62] = {
+    0, 16, 18, 23, 37, 40, 45, 47, 48, 49, 51, 54, 63, 66, 74, 76,
+    78, 80, 82, 85, 90, 94, 95, 100, 107, 109, 110, 115, 116, 123, 137, 138,
+    143, 145, 160, 172, 181, 183, 191, 198, 200, 202, 203, 210, 216, 219, 220, 227,
+    235, 239, 249, 250, 252, 253, 258, 262, 281, 285, 293, 295, 297, 306,
+};
+
+static const EpdKernPair notosans_12_boldKernPairs[] = {
+    { 9, -2 },
+    { 15, -1 },
+    { 17, -2 },
+    { 19, -1 },
+    { 23, -2 },
+    { 25, 2 },
+    { 29, -1 },
+    { 31, -2 },
+    { 32, -2 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -1 },
+    { 40, 1 },
+    { 44, 1 },
+    { 45, 1 },
+    { 54, -2 },
+    { 12, -2 },
+    { 14, -1 },
+    { 11, 2 },
+    { 18, 1 },
+    { 28, 2 },
+    { 34, -1 },
+    { 46, 2 },
+    { 10, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 26, -1 },
+    { 28, 2 },
+    { 34, -1 },
+    { 35, -2 },
+    { 40, -1 },
+    { 42, -2 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 12, -1 },
+    { 26, -1 },
+    { 49, -1 },
+    { 2, -2 },
+    { 11, 1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 5, -1 },
+    { 12, -1 },
+    { 11, 2 },
+    { 5, -2 },
+    { 2, -2 },
+    { 14, -1 },
+    { 5, -3 },
+    { 9, -1 },
+    { 23, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 9, -2 },
+    { 15, -2 },
+    { 17, -2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -2 },
+    { 22, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 21, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 9, -2 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -2 },
+    { 22, -1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 2, 1 },
+    { 5, -4 },
+    { 2, 1 },
+    { 5, -1 },
+    { 11, 1 },
+    { 14, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 26, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 26, -2 },
+    { 49, -1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 4, 1 },
+    { 2, -2 },
+    { 11, 3 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 1, 3 },
+    { 2, 3 },
+    { 4, 4 },
+    { 8, 3 },
+    { 16, 1 },
+    { 24, 2 },
+    { 56, 2 },
+    { 4, 1 },
+    { 25, 3 },
+    { 11, 1 },
+    { 1, 3 },
+    { 2, 3 },
+    { 4, 4 },
+    { 8, 4 },
+    { 56, 2 },
+    { 28, 1 },
+    { 2, -2 },
+    { 26, -1 },
+    { 35, -1 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 56, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 22, -1 },
+    { 29, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 34, -1 },
+    { 2, -2 },
+    { 26, -2 },
+    { 35, -1 },
+    { 49, -1 },
+    { 56, -2 },
+    { 34, -1 },
+    { 52, -1 },
+    { 5, -2 },
+    { 21, -1 },
+    { 27, -1 },
+    { 29, -2 },
+    { 31, -3 },
+    { 32, -3 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -1 },
+    { 43, -1 },
+    { 44, 1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 2, -2 },
+    { 26, -2 },
+    { 28, 1 },
+    { 34, -1 },
+    { 35, -2 },
+    { 40, -1 },
+    { 42, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 52, -1 },
+    { 56, -1 },
+    { 5, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 32, 1 },
+    { 35, -1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 46, 2 },
+    { 5, -1 },
+    { 30, -1 },
+    { 5, -3 },
+    { 29, -2 },
+    { 31, -1 },
+    { 32, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 54, -2 },
+    { 5, -1 },
+    { 26, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 26, -1 },
+    { 30, -1 },
+    { 30, -1 },
+    { 41, -1 },
+    { 26, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 56, 1 },
+    { 26, -1 },
+    { 28, 2 },
+    { 32, 1 },
+    { 39, 1 },
+    { 42, -1 },
+    { 46, 2 },
+    { 26, -1 },
+    { 30, -1 },
+    { 41, -1 },
+    { 56, 1 },
+    { 5, -1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 43, -1 },
+    { 56, 1 },
+    { 2, -2 },
+    { 26, -2 },
+    { 35, -2 },
+    { 40, -2 },
+    { 41, -1 },
+    { 42, -1 },
+    { 51, -1 },
+    { 56, -1 },
+    { 26, -1 },
+    { 28, 1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 30, 1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 44, 1 },
+    { 45, 1 },
+    { 56, 1 },
+    { 30, -1 },
+    { 2, 1 },
+    { 44, 1 },
+    { 5, -1 },
+    { 2, -1 },
+    { 26, -1 },
+    { 35, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 2, -2 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 21, -2 },
+    { 22, -1 },
+    { 29, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 34, -1 },
+    { 36, -2 },
+    { 37, -2 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 47, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -2 },
+    { 5, -1 },
+    { 31, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 5, -1 },
+    { 31, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 47, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 5, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 52, -1 },
+    { 5, -2 },
+    { 31, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 47, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+};
+
 static const EpdFontData notosans_12_bold = {
     notosans_12_boldBitmaps,
     notosans_12_boldGlyphs,
@@ -3973,4 +4401,8 @@ static const EpdFontData notosans_12_bold = {
     27,
     -8,
     true,
+    notosans_12_boldKernLeftClasses,
+    notosans_12_boldKernRightClasses,
+    notosans_12_boldKernPairOffsets,
+    notosans_12_boldKernPairs,
 };
@@ -3316,7 +3316,7 @@ static const uint8_t notosans_12_bolditalicBitmaps[52863] = {
 
 static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 8, 19, 7, 0, 18, 38, 0 }, // !
     { 10, 7, 11, 2, 18, 18, 38 }, // "
@@ -4164,6 +4164,450 @@ static const EpdUnicodeInterval notosans_12_bolditalicIntervals[] = {
     { 0x2212, 0x2212, 0x340 },
 };
 
+static const uint8_t notosans_12_bolditalicKernLeftClasses[833] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 0, 0, 7, 8, 9, 0, 0, 0, 0, 0, 10, 0,
+    0, 7, 11, 7, 0, 0, 12, 0, 13, 13, 0, 14, 0, 3, 0, 0,
+    0, 15, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 17, 0, 0, 0, 18, 18, 0, 18, 0, 3, 0, 0,
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0,
+    21, 6, 6, 6, 6, 6, 6, 8, 0, 8, 8, 8, 8, 0, 0, 0,
+    0, 7, 0, 7, 7, 7, 7, 7, 0, 7, 0, 0, 0, 0, 14, 11,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0,
+    18, 6, 0, 6, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    23, 7, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 22, 0, 0, 25,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 10, 0, 10, 23,
+    10, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 7,
+    0, 7, 0, 8, 0, 0, 17, 0, 17, 0, 17, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 0, 12, 26, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13, 18, 14, 18, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 27, 28, 0, 0, 0, 0, 29, 27, 27, 30, 31, 0, 32,
+    0, 33, 34, 0, 28, 35, 0, 31, 0, 0, 0, 31, 0, 0, 0, 36,
+    0, 37, 0, 28, 32, 38, 31, 35, 0, 0, 35, 27, 0, 27, 36, 36,
+    0, 39, 40, 41, 39, 0, 39, 39, 41, 39, 39, 0, 39, 39, 39, 42,
+    43, 42, 39, 43, 44, 42, 0, 45, 39, 39, 45, 46, 39, 46, 42, 42,
+    39, 39, 39, 47, 39, 39, 39, 0, 48, 49, 46, 46, 43, 0, 39, 44,
+    39, 32, 50, 51, 46, 0, 0, 33, 52, 33, 52, 0, 0, 0, 0, 0,
+    41, 0, 0, 36, 42, 32, 50, 32, 50, 44, 44, 36, 42, 36, 42, 32,
+    50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 51, 46, 37,
+    42, 53, 54, 55, 56, 0, 57, 58, 0, 0, 41, 58, 0, 31, 39, 31,
+    39, 31, 39, 35, 0, 55, 54, 0, 57, 0, 42, 0, 0, 53, 0, 59,
+    50, 59, 50, 58, 0, 35, 0, 35, 0, 0, 0, 0, 57, 0, 39, 0,
+    39, 0, 31, 39, 0, 39, 35, 0, 0, 0, 35, 0, 0, 0, 35, 0,
+    0, 33, 0, 33, 0, 0, 39, 0, 39, 36, 42, 36, 42, 31, 39, 0,
+    41, 0, 0, 0, 0, 0, 0, 36, 42, 36, 42, 36, 42, 36, 42, 32,
+    44, 32, 44, 32, 44, 0, 39, 53, 54, 0, 39, 55, 56, 58, 0, 31,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 20, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t notosans_12_bolditalicKernRightClasses[833] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 7, 0, 8, 0, 0, 0, 8, 0, 0, 9, 0, 0, 0,
+    0, 8, 0, 8, 0, 0, 10, 0, 11, 11, 0, 12, 0, 0, 0, 4,
+    0, 0, 0, 13, 0, 14, 14, 14, 15, 16, 0, 0, 15, 0, 0, 17,
+    17, 14, 17, 14, 17, 13, 0, 17, 0, 0, 0, 0, 18, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 0, 8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 8, 8, 8, 8, 8, 0, 8, 0, 0, 0, 0, 12, 0,
+    15, 14, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 0, 0, 0,
+    0, 0, 17, 14, 14, 14, 14, 14, 0, 14, 17, 17, 17, 17, 0, 0,
+    0, 7, 13, 7, 13, 7, 13, 8, 14, 8, 14, 8, 14, 8, 14, 0,
+    14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 8, 16, 8,
+    16, 8, 16, 8, 16, 0, 0, 0, 21, 0, 22, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 15, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 17, 0, 17, 0, 17, 0, 0, 17, 8, 14, 8,
+    14, 8, 14, 8, 14, 0, 17, 0, 17, 0, 0, 0, 13, 0, 13, 0,
+    13, 0, 13, 10, 0, 10, 0, 10, 0, 0, 17, 0, 17, 0, 17, 0,
+    17, 0, 17, 0, 17, 11, 0, 12, 0, 12, 0, 18, 0, 18, 0, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 23, 0, 24, 25, 0, 0, 26, 27, 0, 23, 0, 0, 28,
+    0, 29, 0, 0, 0, 30, 0, 31, 32, 0, 0, 0, 27, 0, 0, 24,
+    0, 0, 24, 23, 28, 33, 31, 0, 34, 0, 0, 23, 0, 0, 32, 0,
+    35, 36, 0, 36, 37, 38, 36, 0, 37, 39, 39, 39, 40, 39, 39, 36,
+    39, 39, 36, 39, 41, 36, 39, 39, 42, 39, 39, 43, 39, 39, 0, 39,
+    44, 36, 36, 45, 37, 36, 46, 0, 32, 47, 40, 39, 45, 39, 39, 41,
+    39, 48, 49, 0, 0, 0, 50, 29, 51, 0, 50, 0, 0, 0, 50, 32,
+    37, 34, 50, 8, 52, 48, 49, 48, 49, 8, 52, 8, 52, 8, 52, 48,
+    49, 8, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 45, 0,
+    50, 0, 50, 0, 0, 0, 50, 31, 37, 32, 37, 0, 50, 0, 50, 0,
+    45, 53, 43, 0, 50, 0, 50, 0, 50, 8, 52, 8, 52, 23, 50, 54,
+    55, 54, 55, 31, 0, 53, 43, 34, 42, 34, 42, 0, 50, 56, 57, 56,
+    57, 0, 31, 0, 0, 50, 58, 51, 0, 50, 0, 50, 34, 42, 0, 50,
+    0, 29, 59, 29, 59, 29, 59, 0, 52, 0, 37, 0, 37, 31, 0, 32,
+    37, 0, 0, 0, 50, 0, 50, 8, 52, 8, 52, 8, 52, 32, 0, 28,
+    41, 28, 41, 28, 41, 34, 42, 0, 50, 0, 39, 0, 0, 31, 0, 31,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 60, 2, 5, 0, 60, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 20, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t notosans_12_bolditalicKernPairOffsets[60] = {
+    0, 18, 21, 30, 43, 47, 51, 53, 54, 55, 59, 61, 71, 73, 81, 82,
+    84, 86, 88, 92, 98, 101, 102, 107, 109, 110, 113, 120, 137, 139, 145, 150,
+    163, 178, 181, 190, 194, 203, 209, 210, 214, 216, 220, 224, 229, 237, 246, 252,
+    257, 259, 260, 266, 271, 289, 291, 301, 304, 307, 311, 322,
+};
+
+static const EpdKernPair notosans_12_bolditalicKernPairs[] = {
+    { 7, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 22, 2 },
+    { 25, 1 },
+    { 27, -1 },
+    { 28, 1 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, 1 },
+    { 32, 1 },
+    { 40, -1 },
+    { 45, 1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 58, -2 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -2 },
+    { 9, 2 },
+    { 15, 1 },
+    { 23, 1 },
+    { 26, 3 },
+    { 30, 1 },
+    { 32, 1 },
+    { 41, 1 },
+    { 45, 1 },
+    { 47, 2 },
+    { 8, -1 },
+    { 10, -2 },
+    { 11, -2 },
+    { 12, -2 },
+    { 23, -2 },
+    { 33, -1 },
+    { 34, -2 },
+    { 42, -2 },
+    { 43, -1 },
+    { 48, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 56, -2 },
+    { 10, -1 },
+    { 23, -1 },
+    { 34, -1 },
+    { 53, -1 },
+    { 2, -2 },
+    { 9, 2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 9, 2 },
+    { 5, -2 },
+    { 2, -2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 19, -1 },
+    { 5, -3 },
+    { 7, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 5, -1 },
+    { 19, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 9, 3 },
+    { 2, 2 },
+    { 4, 1 },
+    { 2, 1 },
+    { 5, -3 },
+    { 2, 1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 23, -1 },
+    { 53, -1 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 23, -2 },
+    { 34, -2 },
+    { 53, -1 },
+    { 9, 2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 4, 1 },
+    { 1, 2 },
+    { 2, 2 },
+    { 4, 2 },
+    { 21, 2 },
+    { 60, 1 },
+    { 4, 1 },
+    { 22, 3 },
+    { 9, 1 },
+    { 1, 1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 2, -2 },
+    { 23, -2 },
+    { 34, -2 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -2 },
+    { 60, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 20, -1 },
+    { 27, -2 },
+    { 29, -1 },
+    { 30, -2 },
+    { 33, -1 },
+    { 36, -2 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 42, -1 },
+    { 44, -1 },
+    { 45, 1 },
+    { 46, -1 },
+    { 26, 1 },
+    { 47, 1 },
+    { 2, -2 },
+    { 23, -2 },
+    { 34, -2 },
+    { 42, -1 },
+    { 43, -1 },
+    { 60, -1 },
+    { 6, -1 },
+    { 24, -1 },
+    { 33, -1 },
+    { 42, -1 },
+    { 56, -1 },
+    { 5, -2 },
+    { 19, -1 },
+    { 27, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 40, -1 },
+    { 45, 1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 2, -2 },
+    { 23, -2 },
+    { 24, -1 },
+    { 26, 1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 34, -2 },
+    { 41, -1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 48, -1 },
+    { 53, -1 },
+    { 54, -2 },
+    { 56, -1 },
+    { 60, -2 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 4, 1 },
+    { 26, 3 },
+    { 27, 1 },
+    { 30, 1 },
+    { 34, -1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, -1 },
+    { 47, 2 },
+    { 5, -1 },
+    { 23, -1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 5, -3 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 40, -1 },
+    { 51, -1 },
+    { 58, -2 },
+    { 5, -1 },
+    { 23, -1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 35, -1 },
+    { 54, -1 },
+    { 23, -1 },
+    { 23, -1 },
+    { 28, -1 },
+    { 34, -1 },
+    { 41, -1 },
+    { 23, -2 },
+    { 41, -1 },
+    { 23, -2 },
+    { 28, -1 },
+    { 34, -1 },
+    { 41, -1 },
+    { 2, -1 },
+    { 23, -1 },
+    { 41, -1 },
+    { 60, -1 },
+    { 5, -1 },
+    { 27, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 4, 1 },
+    { 23, -1 },
+    { 26, 3 },
+    { 27, 1 },
+    { 30, 1 },
+    { 34, -1 },
+    { 47, 2 },
+    { 60, -1 },
+    { 2, -2 },
+    { 23, -2 },
+    { 24, -1 },
+    { 34, -3 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 55, -1 },
+    { 60, -2 },
+    { 2, -1 },
+    { 23, -2 },
+    { 26, 2 },
+    { 41, -1 },
+    { 47, 1 },
+    { 60, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 23, 1 },
+    { 45, 1 },
+    { 60, 1 },
+    { 26, 2 },
+    { 47, 1 },
+    { 5, -1 },
+    { 2, -1 },
+    { 23, -1 },
+    { 34, -2 },
+    { 48, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 2, -2 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 5, -1 },
+    { 51, -1 },
+    { 5, -1 },
+    { 29, -2 },
+    { 33, -1 },
+    { 42, -1 },
+    { 46, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 5, -1 },
+    { 49, 1 },
+    { 51, -1 },
+    { 2, -2 },
+    { 42, -2 },
+    { 43, -1 },
+    { 26, 6 },
+    { 33, -1 },
+    { 42, -1 },
+    { 56, -1 },
+    { 5, -2 },
+    { 29, -2 },
+    { 33, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+};
+
 static const EpdFontData notosans_12_bolditalic = {
     notosans_12_bolditalicBitmaps,
     notosans_12_bolditalicGlyphs,
@@ -4173,4 +4617,8 @@ static const EpdFontData notosans_12_bolditalic = {
     27,
     -8,
     true,
+    notosans_12_bolditalicKernLeftClasses,
+    notosans_12_bolditalicKernRightClasses,
+    notosans_12_bolditalicKernPairOffsets,
+    notosans_12_bolditalicKernPairs,
 };
@@ -3037,7 +3037,7 @@ static const uint8_t notosans_12_italicBitmaps[48397] = {
 
 static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 7, 19, 7, 0, 18, 34, 0 }, // !
     { 9, 7, 10, 2, 18, 16, 34 }, // "
@@ -3885,6 +3885,442 @@ static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
     { 0x2212, 0x2212, 0x340 },
 };
 
+static const uint8_t notosans_12_italicKernLeftClasses[833] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 0, 0, 7, 8, 9, 0, 0, 0, 0, 0, 10, 0,
+    0, 7, 11, 7, 0, 0, 12, 0, 13, 13, 0, 14, 0, 3, 0, 0,
+    0, 8, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 16, 0, 0, 0, 17, 17, 0, 17, 0, 3, 0, 0,
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+    20, 6, 6, 6, 6, 6, 6, 8, 0, 8, 8, 8, 8, 0, 0, 0,
+    0, 7, 0, 7, 7, 7, 7, 7, 0, 7, 0, 0, 0, 0, 14, 11,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0,
+    17, 6, 0, 6, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    22, 7, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 21, 0, 0, 24,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 10, 0, 10, 22,
+    10, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 7,
+    0, 7, 0, 8, 0, 0, 16, 0, 16, 0, 16, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 0, 12, 21, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13, 17, 14, 17, 14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 25, 26, 0, 0, 0, 0, 27, 25, 25, 28, 29, 0, 30,
+    0, 31, 32, 0, 26, 33, 0, 29, 0, 0, 0, 29, 0, 0, 0, 34,
+    0, 35, 0, 26, 30, 36, 29, 33, 0, 0, 33, 25, 0, 25, 34, 34,
+    0, 37, 38, 39, 37, 0, 37, 37, 39, 37, 37, 37, 37, 37, 37, 40,
+    41, 40, 37, 41, 42, 40, 37, 43, 37, 37, 43, 44, 37, 44, 40, 40,
+    37, 37, 37, 45, 37, 37, 37, 0, 46, 47, 44, 44, 41, 37, 37, 42,
+    37, 30, 48, 49, 44, 0, 0, 31, 50, 31, 50, 0, 0, 0, 0, 0,
+    39, 0, 0, 34, 40, 30, 48, 30, 48, 42, 42, 34, 40, 34, 40, 30,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 49, 44, 35,
+    40, 51, 52, 53, 54, 0, 55, 56, 0, 0, 39, 56, 0, 29, 37, 29,
+    37, 29, 37, 33, 0, 53, 52, 0, 55, 0, 40, 0, 0, 51, 0, 57,
+    48, 57, 48, 56, 0, 33, 0, 33, 0, 0, 0, 0, 55, 0, 37, 0,
+    37, 0, 29, 37, 0, 37, 33, 0, 0, 0, 33, 0, 0, 0, 33, 0,
+    0, 31, 0, 31, 0, 0, 37, 0, 37, 34, 40, 34, 40, 29, 37, 0,
+    39, 0, 0, 0, 0, 0, 0, 34, 40, 34, 40, 34, 40, 34, 40, 30,
+    42, 30, 42, 30, 42, 0, 37, 51, 52, 0, 37, 53, 54, 56, 0, 29,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 19, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t notosans_12_italicKernRightClasses[833] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 7, 0, 8, 0, 0, 0, 8, 0, 0, 9, 0, 0, 0,
+    0, 8, 0, 8, 0, 0, 10, 0, 11, 11, 0, 12, 0, 0, 0, 4,
+    0, 0, 0, 13, 0, 14, 14, 14, 15, 16, 0, 0, 15, 0, 0, 17,
+    17, 14, 17, 14, 17, 13, 0, 17, 0, 0, 0, 0, 18, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 0, 8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 8, 8, 8, 8, 8, 0, 8, 0, 0, 0, 0, 12, 0,
+    15, 14, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 0, 0, 0,
+    0, 0, 17, 14, 14, 14, 14, 14, 0, 14, 17, 17, 17, 17, 0, 0,
+    0, 7, 13, 7, 13, 7, 13, 8, 14, 8, 14, 8, 14, 8, 14, 0,
+    14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 8, 16, 8,
+    16, 8, 16, 8, 16, 0, 0, 0, 1, 0, 21, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 15, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 17, 0, 17, 0, 17, 0, 0, 17, 8, 14, 8,
+    14, 8, 14, 8, 14, 0, 17, 0, 17, 0, 0, 0, 13, 0, 13, 0,
+    13, 0, 13, 10, 0, 10, 0, 10, 0, 0, 17, 0, 17, 0, 17, 0,
+    17, 0, 17, 0, 17, 11, 0, 12, 0, 12, 0, 18, 0, 18, 0, 18,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 22, 0, 23, 24, 0, 0, 25, 26, 0, 22, 0, 0, 27,
+    0, 28, 0, 0, 0, 29, 0, 30, 31, 0, 0, 0, 26, 0, 0, 23,
+    0, 0, 23, 22, 27, 32, 30, 0, 33, 0, 0, 22, 0, 0, 31, 0,
+    34, 35, 0, 35, 36, 37, 35, 38, 36, 38, 38, 38, 39, 38, 38, 35,
+    38, 38, 35, 38, 40, 35, 38, 38, 41, 38, 38, 42, 38, 38, 38, 38,
+    43, 35, 35, 44, 36, 35, 45, 0, 31, 46, 39, 38, 44, 38, 38, 40,
+    38, 47, 48, 0, 0, 0, 49, 28, 50, 0, 49, 0, 0, 0, 49, 31,
+    36, 33, 49, 8, 51, 47, 48, 47, 48, 8, 51, 8, 51, 8, 51, 47,
+    48, 8, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 44, 0,
+    49, 0, 49, 0, 0, 0, 49, 30, 36, 31, 36, 0, 49, 0, 49, 0,
+    44, 52, 42, 0, 49, 0, 49, 0, 49, 8, 51, 8, 51, 22, 49, 53,
+    54, 53, 54, 30, 38, 52, 42, 33, 41, 33, 41, 0, 49, 55, 56, 55,
+    56, 0, 30, 38, 0, 49, 57, 50, 0, 49, 0, 49, 33, 41, 0, 49,
+    0, 28, 58, 28, 58, 28, 58, 0, 51, 0, 36, 0, 36, 30, 38, 31,
+    36, 0, 0, 0, 49, 0, 49, 8, 51, 8, 51, 8, 51, 31, 38, 27,
+    40, 27, 40, 27, 40, 33, 41, 0, 49, 0, 38, 0, 0, 30, 38, 30,
+    38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 59, 2, 5, 0, 59, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 20, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t notosans_12_italicKernPairOffsets[58] = {
+    0, 18, 21, 30, 43, 47, 51, 53, 54, 55, 59, 61, 71, 73, 81, 83,
+    85, 87, 91, 97, 100, 101, 105, 107, 108, 115, 132, 134, 140, 145, 159, 173,
+    176, 185, 189, 198, 204, 205, 209, 211, 215, 219, 224, 232, 241, 246, 249, 251,
+    252, 258, 263, 281, 283, 293, 296, 299, 303, 314,
+};
+
+static const EpdKernPair notosans_12_italicKernPairs[] = {
+    { 7, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 21, 2 },
+    { 24, 1 },
+    { 26, -1 },
+    { 27, 1 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, 1 },
+    { 31, 1 },
+    { 39, -1 },
+    { 44, 1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 57, -2 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -2 },
+    { 9, 2 },
+    { 15, 1 },
+    { 22, 1 },
+    { 25, 3 },
+    { 29, 1 },
+    { 31, 1 },
+    { 40, 1 },
+    { 44, 1 },
+    { 46, 2 },
+    { 8, -1 },
+    { 10, -2 },
+    { 11, -2 },
+    { 12, -2 },
+    { 22, -2 },
+    { 32, -1 },
+    { 33, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 47, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 55, -2 },
+    { 10, -1 },
+    { 22, -1 },
+    { 33, -1 },
+    { 52, -1 },
+    { 2, -2 },
+    { 9, 2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 9, 2 },
+    { 5, -2 },
+    { 2, -2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 19, -1 },
+    { 5, -3 },
+    { 7, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 5, -1 },
+    { 19, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 2, 1 },
+    { 5, -3 },
+    { 2, 1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 22, -1 },
+    { 52, -1 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 22, -2 },
+    { 33, -2 },
+    { 52, -1 },
+    { 9, 2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 4, 1 },
+    { 1, 2 },
+    { 2, 2 },
+    { 4, 2 },
+    { 59, 1 },
+    { 4, 1 },
+    { 21, 3 },
+    { 9, 1 },
+    { 2, -2 },
+    { 22, -2 },
+    { 33, -2 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -2 },
+    { 59, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 20, -1 },
+    { 26, -2 },
+    { 28, -1 },
+    { 29, -2 },
+    { 32, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 41, -1 },
+    { 43, -1 },
+    { 44, 1 },
+    { 45, -1 },
+    { 25, 1 },
+    { 46, 1 },
+    { 2, -2 },
+    { 22, -2 },
+    { 33, -2 },
+    { 41, -1 },
+    { 42, -1 },
+    { 59, -1 },
+    { 6, -1 },
+    { 23, -1 },
+    { 32, -1 },
+    { 41, -1 },
+    { 55, -1 },
+    { 5, -2 },
+    { 19, -1 },
+    { 26, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 32, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 44, 1 },
+    { 50, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 2, -2 },
+    { 22, -2 },
+    { 23, -1 },
+    { 25, 1 },
+    { 32, -1 },
+    { 33, -2 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -2 },
+    { 47, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 55, -1 },
+    { 59, -2 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 4, 1 },
+    { 25, 3 },
+    { 26, 1 },
+    { 29, 1 },
+    { 33, -1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, -1 },
+    { 46, 2 },
+    { 5, -1 },
+    { 22, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 5, -3 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 39, -1 },
+    { 50, -1 },
+    { 57, -2 },
+    { 5, -1 },
+    { 22, -1 },
+    { 27, -2 },
+    { 30, -1 },
+    { 34, -1 },
+    { 53, -1 },
+    { 22, -1 },
+    { 22, -1 },
+    { 27, -1 },
+    { 33, -1 },
+    { 40, -1 },
+    { 22, -2 },
+    { 40, -1 },
+    { 22, -2 },
+    { 27, -1 },
+    { 33, -1 },
+    { 40, -1 },
+    { 2, -1 },
+    { 22, -1 },
+    { 40, -1 },
+    { 59, -1 },
+    { 5, -1 },
+    { 26, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 4, 1 },
+    { 22, -1 },
+    { 25, 3 },
+    { 26, 1 },
+    { 29, 1 },
+    { 33, -1 },
+    { 46, 1 },
+    { 59, -1 },
+    { 2, -2 },
+    { 22, -2 },
+    { 23, -1 },
+    { 33, -3 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 54, -1 },
+    { 59, -2 },
+    { 2, -1 },
+    { 22, -2 },
+    { 25, 2 },
+    { 40, -1 },
+    { 59, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 59, 1 },
+    { 25, 2 },
+    { 46, 1 },
+    { 5, -1 },
+    { 2, -1 },
+    { 22, -1 },
+    { 33, -2 },
+    { 47, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 2, -2 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 28, -1 },
+    { 32, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 5, -1 },
+    { 50, -1 },
+    { 5, -1 },
+    { 28, -2 },
+    { 32, -1 },
+    { 41, -1 },
+    { 45, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 5, -1 },
+    { 48, 1 },
+    { 50, -1 },
+    { 2, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 25, 6 },
+    { 32, -1 },
+    { 41, -1 },
+    { 55, -1 },
+    { 5, -2 },
+    { 28, -2 },
+    { 32, -1 },
+    { 36, -1 },
+    { 41, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+};
+
 static const EpdFontData notosans_12_italic = {
     notosans_12_italicBitmaps,
     notosans_12_italicGlyphs,
@@ -3894,4 +4330,8 @@ static const EpdFontData notosans_12_italic = {
     27,
     -8,
     true,
+    notosans_12_italicKernLeftClasses,
+    notosans_12_italicKernRightClasses,
+    notosans_12_italicKernPairOffsets,
+    notosans_12_italicKernPairs,
 };
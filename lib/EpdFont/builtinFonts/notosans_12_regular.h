@@ -2835,7 +2835,7 @@ static const uint8_t notosans_12_regularBitmaps[45168] = {
 
 static const EpdGlyph notosans_12_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // 
+    { 0, 0, 7, 0, 0, 0, 0 }, // 
     { 0, 0, 7, 0, 0, 0, 0 }, //  
     { 4, 19, 7, 1, 18, 19, 0 }, // !
     { 8, 7, 10, 1, 18, 14, 19 }, // "
@@ -3684,6 +3684,428 @@ static const EpdUnicodeInterval notosans_12_regularIntervals[] = {
     { 0x2212, 0x2212, 0x341 },
 };
 
+static const uint8_t notosans_12_regularKernLeftClasses[834] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 8, 9, 10, 0, 0, 0, 0, 0, 11, 0,
+    0, 8, 12, 8, 0, 0, 13, 0, 14, 14, 0, 15, 0, 3, 0, 0,
+    0, 9, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 17, 0, 0, 0, 18, 18, 0, 18, 0, 3, 0, 0,
+    0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0,
+    22, 7, 7, 7, 7, 7, 7, 9, 0, 9, 9, 9, 9, 0, 0, 0,
+    0, 8, 0, 8, 8, 8, 8, 8, 0, 8, 0, 0, 0, 0, 15, 12,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23,
+    23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0,
+    18, 7, 0, 7, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    25, 8, 0, 9, 0, 9, 0, 9, 0, 9, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 23, 0, 0, 27,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 11, 0, 11, 25,
+    11, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 8,
+    0, 8, 0, 9, 0, 0, 17, 0, 17, 0, 17, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 0, 13, 28, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 18, 15, 18, 15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 29, 29, 30, 31, 32, 0, 0, 0, 0, 33, 33, 30, 34, 0, 35,
+    0, 36, 0, 37, 31, 38, 29, 34, 37, 0, 0, 34, 0, 0, 0, 39,
+    0, 40, 32, 31, 35, 41, 34, 38, 0, 0, 38, 33, 0, 33, 39, 39,
+    0, 42, 43, 6, 44, 45, 46, 47, 6, 6, 6, 47, 6, 6, 6, 46,
+    6, 46, 0, 44, 48, 46, 47, 45, 6, 6, 45, 49, 6, 49, 46, 46,
+    6, 46, 46, 50, 44, 0, 51, 0, 52, 29, 49, 49, 50, 47, 6, 48,
+    6, 39, 53, 54, 49, 32, 0, 36, 55, 36, 55, 0, 0, 0, 0, 53,
+    0, 0, 46, 39, 46, 35, 53, 35, 53, 48, 48, 39, 46, 39, 46, 39,
+    53, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 45, 54, 49, 40,
+    46, 56, 57, 58, 59, 0, 0, 60, 0, 53, 6, 60, 0, 34, 47, 34,
+    47, 34, 47, 38, 45, 58, 57, 0, 0, 0, 46, 32, 0, 56, 57, 61,
+    53, 61, 53, 60, 0, 38, 45, 38, 45, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 34, 47, 0, 0, 38, 45, 0, 0, 38, 45, 0, 0, 38, 45,
+    0, 36, 42, 36, 42, 29, 0, 29, 0, 39, 46, 39, 46, 34, 47, 53,
+    6, 0, 0, 0, 6, 0, 6, 39, 46, 39, 46, 39, 46, 39, 46, 35,
+    48, 35, 48, 35, 48, 0, 6, 56, 57, 0, 6, 58, 59, 60, 0, 34,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 21, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint8_t notosans_12_regularKernRightClasses[834] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 0, 13, 13, 0, 14, 0, 0, 0, 4,
+    0, 0, 0, 15, 16, 17, 17, 17, 0, 15, 16, 0, 18, 16, 16, 19,
+    19, 17, 19, 17, 19, 15, 0, 19, 0, 0, 0, 0, 20, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 23, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 0, 14, 0,
+    0, 17, 15, 15, 15, 15, 15, 15, 17, 17, 17, 17, 17, 0, 0, 0,
+    0, 0, 0, 17, 17, 17, 17, 17, 0, 17, 19, 19, 19, 19, 0, 16,
+    0, 9, 15, 9, 15, 9, 15, 10, 17, 10, 17, 10, 17, 10, 17, 0,
+    17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 0, 17, 10, 15, 10,
+    15, 10, 15, 10, 15, 0, 16, 0, 24, 0, 25, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 0, 16, 0, 16, 0, 16,
+    0, 16, 0, 0, 0, 19, 0, 19, 0, 0, 0, 0, 19, 10, 17, 10,
+    17, 10, 17, 10, 17, 0, 19, 0, 19, 0, 0, 0, 15, 0, 0, 0,
+    15, 0, 0, 12, 0, 12, 0, 12, 0, 0, 19, 0, 19, 0, 19, 0,
+    19, 0, 19, 0, 19, 13, 0, 14, 0, 14, 0, 20, 0, 20, 0, 20,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 26, 0, 27, 0, 0, 0, 28, 29, 0, 26, 0, 0, 30,
+    0, 31, 0, 0, 0, 32, 0, 33, 33, 0, 0, 0, 29, 0, 0, 27,
+    0, 0, 27, 26, 30, 34, 33, 0, 35, 0, 0, 26, 0, 0, 33, 0,
+    27, 36, 27, 7, 7, 37, 38, 27, 0, 7, 7, 7, 39, 7, 7, 38,
+    7, 7, 38, 40, 41, 38, 27, 7, 42, 7, 7, 40, 7, 7, 0, 7,
+    43, 38, 38, 44, 7, 38, 27, 0, 45, 46, 39, 7, 44, 7, 7, 41,
+    7, 10, 0, 0, 0, 0, 47, 31, 37, 0, 47, 0, 0, 0, 47, 33,
+    0, 35, 0, 10, 36, 48, 0, 48, 0, 10, 36, 10, 36, 10, 36, 10,
+    0, 10, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 44, 0,
+    47, 0, 47, 0, 0, 0, 47, 33, 27, 33, 0, 0, 47, 0, 47, 0,
+    44, 49, 40, 0, 47, 0, 47, 0, 47, 10, 36, 10, 36, 26, 40, 50,
+    51, 50, 51, 33, 27, 49, 40, 35, 42, 35, 42, 0, 47, 52, 53, 52,
+    53, 0, 33, 27, 0, 47, 54, 37, 0, 47, 0, 47, 35, 42, 0, 47,
+    0, 31, 55, 31, 55, 31, 55, 0, 36, 0, 55, 0, 55, 33, 27, 33,
+    0, 0, 0, 0, 7, 0, 7, 10, 36, 10, 36, 10, 36, 33, 0, 30,
+    41, 30, 41, 30, 41, 35, 42, 0, 47, 0, 7, 0, 0, 33, 27, 33,
+    27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 56, 2, 5, 0, 56, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 22, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint16_t notosans_12_regularKernPairOffsets[62] = {
+    0, 16, 18, 23, 37, 40, 41, 46, 48, 49, 50, 52, 55, 64, 67, 75,
+    77, 79, 81, 83, 86, 91, 95, 96, 101, 108, 110, 111, 116, 117, 124, 138,
+    139, 144, 146, 161, 174, 175, 184, 186, 194, 203, 205, 207, 214, 220, 223, 224,
+    231, 239, 243, 244, 246, 247, 252, 256, 275, 279, 287, 289, 291, 300,
+};
+
+static const EpdKernPair notosans_12_regularKernPairs[] = {
+    { 9, -2 },
+    { 15, -1 },
+    { 17, -2 },
+    { 19, -1 },
+    { 23, -2 },
+    { 25, 2 },
+    { 29, -1 },
+    { 31, -2 },
+    { 32, -2 },
+    { 36, -1 },
+    { 37, -2 },
+    { 39, -1 },
+    { 40, 1 },
+    { 44, 1 },
+    { 45, 1 },
+    { 54, -2 },
+    { 12, -2 },
+    { 14, -1 },
+    { 11, 2 },
+    { 18, 1 },
+    { 28, 2 },
+    { 34, -1 },
+    { 46, 2 },
+    { 10, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 26, -1 },
+    { 28, 2 },
+    { 34, -1 },
+    { 35, -2 },
+    { 40, -1 },
+    { 42, -2 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 12, -1 },
+    { 26, -1 },
+    { 49, -1 },
+    { 26, -1 },
+    { 2, -2 },
+    { 11, 1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 5, -1 },
+    { 12, -1 },
+    { 11, 2 },
+    { 5, -2 },
+    { 2, -2 },
+    { 14, -1 },
+    { 5, -3 },
+    { 9, -1 },
+    { 23, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 9, -2 },
+    { 15, -2 },
+    { 17, -2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -2 },
+    { 22, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 21, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 9, -2 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -2 },
+    { 22, -1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 2, 1 },
+    { 5, -4 },
+    { 2, 1 },
+    { 5, -1 },
+    { 11, 1 },
+    { 14, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 26, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 26, -2 },
+    { 49, -1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 4, 1 },
+    { 2, -2 },
+    { 11, 3 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 1, 1 },
+    { 2, 1 },
+    { 4, 2 },
+    { 8, 2 },
+    { 16, 1 },
+    { 24, 2 },
+    { 56, 2 },
+    { 4, 1 },
+    { 25, 3 },
+    { 11, 1 },
+    { 1, 2 },
+    { 2, 2 },
+    { 4, 3 },
+    { 8, 3 },
+    { 56, 2 },
+    { 28, 1 },
+    { 2, -2 },
+    { 26, -1 },
+    { 35, -1 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 56, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 22, -1 },
+    { 29, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 34, -1 },
+    { 2, -2 },
+    { 26, -2 },
+    { 35, -1 },
+    { 49, -1 },
+    { 56, -2 },
+    { 34, -1 },
+    { 52, -1 },
+    { 5, -2 },
+    { 21, -1 },
+    { 27, -1 },
+    { 29, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -1 },
+    { 43, -1 },
+    { 44, 1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 2, -2 },
+    { 26, -2 },
+    { 28, 1 },
+    { 30, -1 },
+    { 34, -1 },
+    { 35, -2 },
+    { 40, -1 },
+    { 42, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 52, -1 },
+    { 56, -1 },
+    { 4, -1 },
+    { 5, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 32, 1 },
+    { 35, -1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 46, 2 },
+    { 5, -1 },
+    { 30, -1 },
+    { 5, -3 },
+    { 29, -2 },
+    { 31, -1 },
+    { 32, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 54, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 26, -1 },
+    { 30, -1 },
+    { 30, -1 },
+    { 41, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 56, 1 },
+    { 26, -1 },
+    { 28, 2 },
+    { 32, 1 },
+    { 39, 1 },
+    { 42, -1 },
+    { 46, 2 },
+    { 26, -1 },
+    { 30, -1 },
+    { 41, -1 },
+    { 56, 1 },
+    { 5, -1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 43, -1 },
+    { 56, 1 },
+    { 2, -2 },
+    { 26, -2 },
+    { 35, -2 },
+    { 40, -2 },
+    { 41, -1 },
+    { 42, -1 },
+    { 51, -1 },
+    { 56, -1 },
+    { 26, -1 },
+    { 28, 1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 30, -1 },
+    { 2, 1 },
+    { 44, 1 },
+    { 5, -1 },
+    { 2, -1 },
+    { 26, -1 },
+    { 35, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 2, -2 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 21, -2 },
+    { 22, -1 },
+    { 29, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 34, -1 },
+    { 36, -2 },
+    { 37, -2 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 47, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -2 },
+    { 5, -1 },
+    { 31, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 5, -1 },
+    { 31, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 47, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 5, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 52, -1 },
+    { 5, -2 },
+    { 31, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 42, -1 },
+    { 47, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+};
+
 static const EpdFontData notosans_12_regular = {
     notosans_12_regularBitmaps,
     notosans_12_regularGlyphs,
@@ -3693,4 +4115,8 @@ static const EpdFontData notosans_12_regular = {
     27,
     -8,
     true,
+    notosans_12_regularKernLeftClasses,
+    notosans_12_regularKernRightClasses,
+    notosans_12_regularKernPairOffsets,
+    notosans_12_regularKernPairs,
 };
@@ -4214,7 +4214,7 @@ static const uint8_t notosans_14_boldBitmaps[67224] = {
 
 static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 6, 22, 8, 1, 21, 33, 0 }, // !
     { 12, 8, 14, 1, 21, 24, 33 }, // "
@@ -5063,6 +5063,615 @@ static const EpdUnicodeInterval notosans_14_boldIntervals[] = {
     { 0x2212, 0x2212, 0x341 },
 };
 
+static const uint8_t notosans_14_boldKernLeftClasses[834] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 0, 7, 8, 9, 10, 0, 0, 0, 0, 7, 11, 0,
+    0, 8, 12, 8, 0, 0, 13, 14, 15, 15, 7, 16, 17, 3, 0, 0,
+    0, 18, 0, 0, 19, 20, 0, 19, 21, 0, 0, 0, 0, 0, 0, 0,
+    0, 19, 19, 0, 22, 0, 20, 0, 23, 23, 24, 23, 0, 3, 0, 0,
+    0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    28, 6, 6, 6, 6, 6, 6, 9, 7, 9, 9, 9, 9, 0, 0, 0,
+    0, 8, 0, 8, 8, 8, 8, 8, 0, 8, 14, 14, 14, 14, 16, 12,
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 19, 19, 19, 19, 0, 0, 29,
+    29, 19, 0, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 23, 19,
+    23, 6, 0, 6, 0, 30, 0, 7, 0, 7, 0, 7, 0, 7, 0, 8,
+    31, 8, 0, 9, 19, 9, 19, 9, 19, 9, 19, 9, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 29, 0, 0, 33,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 24, 11, 0, 11, 0, 11, 31,
+    11, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 19, 8,
+    19, 8, 19, 9, 19, 0, 22, 0, 22, 0, 22, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 20, 13, 34, 13, 20, 14, 0, 14, 0, 14, 0, 14,
+    0, 14, 0, 14, 0, 15, 23, 16, 23, 16, 17, 0, 17, 0, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 35, 35, 36, 37, 38, 14, 0, 0, 0, 39, 39, 36, 40, 0, 41,
+    0, 42, 0, 0, 37, 43, 35, 40, 0, 0, 0, 40, 0, 0, 0, 44,
+    0, 45, 38, 37, 41, 46, 40, 43, 0, 0, 43, 39, 0, 39, 44, 44,
+    0, 47, 48, 49, 50, 51, 52, 53, 49, 54, 54, 53, 54, 54, 54, 52,
+    54, 52, 55, 50, 56, 52, 53, 51, 54, 54, 51, 57, 54, 57, 52, 52,
+    54, 52, 52, 58, 59, 55, 60, 0, 61, 62, 57, 57, 63, 53, 54, 56,
+    54, 44, 64, 65, 57, 38, 55, 42, 66, 42, 66, 0, 0, 0, 0, 14,
+    0, 0, 52, 44, 52, 41, 64, 41, 64, 56, 56, 44, 52, 44, 52, 44,
+    64, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 51, 65, 57, 45,
+    52, 67, 68, 69, 70, 0, 0, 71, 0, 14, 49, 71, 0, 40, 53, 40,
+    53, 40, 53, 43, 51, 69, 68, 0, 0, 0, 52, 38, 55, 67, 68, 72,
+    14, 72, 14, 71, 0, 43, 51, 43, 51, 0, 0, 0, 0, 54, 73, 54,
+    73, 0, 40, 53, 0, 0, 43, 51, 0, 0, 43, 51, 0, 0, 43, 51,
+    0, 42, 47, 42, 47, 35, 73, 35, 73, 44, 52, 44, 52, 40, 53, 14,
+    49, 0, 0, 0, 54, 0, 54, 44, 52, 44, 52, 44, 52, 44, 52, 41,
+    56, 41, 56, 41, 56, 0, 54, 67, 68, 0, 54, 69, 70, 71, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint8_t notosans_14_boldKernRightClasses[834] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 0, 0, 0, 4,
+    0, 0, 0, 17, 18, 19, 19, 19, 0, 20, 18, 0, 21, 18, 18, 22,
+    22, 19, 22, 19, 22, 20, 0, 22, 23, 23, 23, 23, 3, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 26, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0,
+    0, 19, 17, 17, 17, 17, 17, 17, 19, 19, 19, 19, 19, 0, 0, 0,
+    0, 0, 0, 19, 19, 19, 19, 19, 0, 19, 22, 22, 22, 22, 23, 18,
+    23, 9, 17, 9, 17, 9, 17, 10, 19, 10, 19, 10, 19, 10, 19, 0,
+    19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 10, 20, 10,
+    20, 10, 20, 10, 20, 0, 18, 0, 27, 0, 28, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 18, 22, 0, 18, 0, 18, 0, 18,
+    0, 18, 0, 0, 0, 22, 0, 22, 0, 0, 0, 0, 22, 10, 19, 10,
+    19, 10, 19, 10, 19, 0, 22, 0, 22, 0, 0, 0, 20, 0, 0, 0,
+    20, 0, 0, 12, 0, 12, 0, 12, 0, 13, 22, 13, 22, 13, 22, 13,
+    22, 13, 22, 13, 22, 14, 23, 16, 23, 16, 0, 3, 0, 3, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 29, 0, 30, 31, 0, 0, 32, 33, 0, 29, 0, 0, 34,
+    0, 35, 0, 0, 0, 36, 0, 37, 38, 0, 0, 0, 33, 0, 0, 30,
+    0, 0, 30, 29, 34, 39, 37, 0, 40, 0, 0, 29, 0, 0, 38, 0,
+    41, 42, 43, 7, 7, 44, 45, 46, 47, 7, 7, 7, 48, 7, 7, 45,
+    7, 7, 45, 49, 50, 45, 46, 7, 51, 7, 7, 49, 7, 7, 47, 7,
+    52, 45, 45, 53, 7, 45, 54, 0, 55, 56, 48, 7, 53, 7, 7, 50,
+    7, 57, 58, 59, 0, 0, 60, 35, 44, 0, 60, 0, 0, 0, 60, 38,
+    0, 40, 0, 57, 42, 61, 58, 61, 58, 57, 42, 57, 42, 57, 42, 57,
+    58, 57, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 59, 53, 0,
+    60, 0, 60, 59, 0, 0, 60, 37, 46, 38, 47, 0, 60, 0, 60, 0,
+    53, 62, 49, 0, 60, 0, 60, 0, 60, 57, 42, 57, 42, 29, 49, 63,
+    64, 63, 64, 37, 46, 62, 49, 40, 51, 40, 51, 0, 60, 65, 66, 65,
+    66, 0, 37, 46, 0, 60, 67, 44, 0, 60, 0, 60, 40, 51, 0, 60,
+    0, 35, 68, 35, 68, 35, 68, 0, 42, 0, 68, 0, 68, 37, 46, 38,
+    47, 0, 0, 0, 7, 0, 7, 57, 42, 57, 42, 57, 42, 38, 47, 34,
+    50, 34, 50, 34, 50, 40, 51, 0, 60, 0, 7, 59, 0, 37, 46, 37,
+    46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 69, 2, 5, 0, 69, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 25, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint16_t notosans_14_boldKernPairOffsets[74] = {
+    0, 26, 29, 34, 51, 56, 62, 64, 68, 69, 73, 78, 83, 97, 98, 104,
+    115, 116, 117, 118, 119, 122, 126, 129, 130, 133, 136, 145, 149, 150, 156, 163,
+    165, 166, 171, 172, 185, 204, 210, 220, 229, 255, 271, 281, 287, 298, 308, 311,
+    316, 318, 327, 336, 342, 347, 348, 350, 360, 374, 379, 391, 394, 397, 399, 403,
+    405, 412, 420, 445, 450, 466, 469, 474, 485, 486,
+};
+
+static const EpdKernPair notosans_14_boldKernPairs[] = {
+    { 9, -2 },
+    { 12, 1 },
+    { 14, 1 },
+    { 17, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 26, -2 },
+    { 28, 2 },
+    { 29, 1 },
+    { 33, -1 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, 1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 47, 1 },
+    { 48, -1 },
+    { 49, 1 },
+    { 50, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 62, 1 },
+    { 67, -2 },
+    { 68, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -1 },
+    { 11, 3 },
+    { 21, 1 },
+    { 32, 3 },
+    { 39, -1 },
+    { 56, 2 },
+    { 10, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 29, -1 },
+    { 32, 2 },
+    { 34, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 49, -1 },
+    { 51, -2 },
+    { 57, -1 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 65, -2 },
+    { 12, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 49, -1 },
+    { 62, -1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 11, 1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 10, -1 },
+    { 24, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 11, 2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 5, -4 },
+    { 9, -1 },
+    { 15, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, 1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 12, 1 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -2 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 5, -1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 24, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 24, -1 },
+    { 11, 3 },
+    { 23, -1 },
+    { 2, 1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 5, -1 },
+    { 2, 1 },
+    { 5, -5 },
+    { 17, -1 },
+    { 19, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 19, -1 },
+    { 11, 1 },
+    { 12, -1 },
+    { 16, -1 },
+    { 12, -1 },
+    { 16, -1 },
+    { 29, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -2 },
+    { 29, -2 },
+    { 34, -1 },
+    { 37, -1 },
+    { 40, -1 },
+    { 62, -1 },
+    { 11, 3 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 4, 1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 11, 3 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 1, 3 },
+    { 2, 3 },
+    { 4, 4 },
+    { 8, 4 },
+    { 18, 1 },
+    { 27, 2 },
+    { 69, 3 },
+    { 4, 1 },
+    { 28, 3 },
+    { 11, 1 },
+    { 1, 4 },
+    { 2, 3 },
+    { 4, 5 },
+    { 8, 4 },
+    { 69, 3 },
+    { 32, 1 },
+    { 2, -2 },
+    { 29, -1 },
+    { 34, -1 },
+    { 40, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -1 },
+    { 69, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 25, -1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 33, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 39, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 24, -1 },
+    { 30, -1 },
+    { 39, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 65, -1 },
+    { 2, -3 },
+    { 29, -2 },
+    { 34, -1 },
+    { 40, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 62, -1 },
+    { 69, -2 },
+    { 2, 1 },
+    { 24, -1 },
+    { 30, -1 },
+    { 39, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 65, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 33, -2 },
+    { 35, -4 },
+    { 36, -3 },
+    { 39, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 2, -2 },
+    { 29, -2 },
+    { 30, -1 },
+    { 32, 1 },
+    { 34, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 69, -1 },
+    { 5, 1 },
+    { 32, 3 },
+    { 33, 1 },
+    { 36, 1 },
+    { 40, -1 },
+    { 44, 1 },
+    { 48, 1 },
+    { 50, 1 },
+    { 51, -1 },
+    { 56, 2 },
+    { 5, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 67, -1 },
+    { 5, -4 },
+    { 24, -1 },
+    { 33, -2 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 48, -1 },
+    { 67, -2 },
+    { 5, -1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 44, -1 },
+    { 62, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 46, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 41, -1 },
+    { 46, -1 },
+    { 50, -1 },
+    { 29, -1 },
+    { 46, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 44, -1 },
+    { 48, -1 },
+    { 69, 1 },
+    { 5, 1 },
+    { 29, -1 },
+    { 32, 3 },
+    { 33, 1 },
+    { 36, 1 },
+    { 44, 1 },
+    { 48, 1 },
+    { 51, -1 },
+    { 56, 2 },
+    { 29, -1 },
+    { 34, -1 },
+    { 37, -1 },
+    { 41, -1 },
+    { 46, -1 },
+    { 50, -1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 51, -1 },
+    { 66, -1 },
+    { 69, 1 },
+    { 29, -1 },
+    { 2, 1 },
+    { 29, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 69, 1 },
+    { 2, -2 },
+    { 29, -2 },
+    { 34, -1 },
+    { 40, -2 },
+    { 41, -1 },
+    { 46, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 58, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 29, -1 },
+    { 32, 1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 56, 1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 33, -1 },
+    { 34, 1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 44, -1 },
+    { 48, -1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 69, 1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 52, -1 },
+    { 2, 1 },
+    { 29, 1 },
+    { 53, 1 },
+    { 32, 1 },
+    { 56, 1 },
+    { 29, -1 },
+    { 32, 1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 5, -1 },
+    { 44, -1 },
+    { 2, -1 },
+    { 29, -1 },
+    { 40, -1 },
+    { 49, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 2, -2 },
+    { 42, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 58, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 33, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 39, -1 },
+    { 42, -2 },
+    { 44, -2 },
+    { 46, -1 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 5, -1 },
+    { 6, -1 },
+    { 35, -1 },
+    { 44, -1 },
+    { 48, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 29, 1 },
+    { 35, -2 },
+    { 42, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 57, -1 },
+    { 60, -1 },
+    { 62, 1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 5, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 5, -2 },
+    { 35, -2 },
+    { 42, -1 },
+    { 44, -1 },
+    { 51, -1 },
+    { 53, 1 },
+    { 57, -1 },
+    { 60, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 46, -1 },
+};
+
 static const EpdFontData notosans_14_bold = {
     notosans_14_boldBitmaps,
     notosans_14_boldGlyphs,
@@ -5072,4 +5681,8 @@ static const EpdFontData notosans_14_bold = {
     32,
     -9,
     true,
+    notosans_14_boldKernLeftClasses,
+    notosans_14_boldKernRightClasses,
+    notosans_14_boldKernPairOffsets,
+    notosans_14_boldKernPairs,
 };
@@ -4475,7 +4475,7 @@ static const uint8_t notosans_14_bolditalicBitmaps[71405] = {
 
 static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 10, 22, 8, 0, 21, 55, 0 }, // !
     { 12, 8, 13, 2, 21, 24, 55 }, // "
@@ -5323,6 +5323,641 @@ static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
     { 0x2212, 0x2212, 0x340 },
 };
 
+static const uint8_t notosans_14_bolditalicKernLeftClasses[833] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 8, 12, 0,
+    0, 9, 13, 9, 0, 0, 14, 7, 15, 15, 8, 16, 17, 3, 0, 0,
+    0, 18, 0, 0, 19, 20, 0, 19, 21, 0, 0, 0, 0, 22, 0, 0,
+    0, 19, 19, 0, 23, 0, 24, 0, 25, 25, 22, 25, 0, 3, 0, 0,
+    0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+    29, 6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10, 0, 0, 0,
+    0, 9, 0, 9, 9, 9, 9, 9, 0, 9, 7, 7, 7, 7, 16, 13,
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 19, 19, 19, 19, 0, 0, 0,
+    30, 19, 0, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 25, 19,
+    25, 6, 0, 6, 0, 6, 0, 8, 0, 8, 0, 8, 0, 8, 0, 9,
+    31, 9, 0, 10, 19, 10, 19, 10, 19, 10, 19, 10, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 30, 0, 0, 33,
+    0, 0, 0, 0, 0, 0, 0, 8, 22, 22, 12, 0, 12, 0, 12, 31,
+    12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 19, 9,
+    19, 9, 19, 10, 19, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 24, 14, 34, 14, 24, 7, 0, 7, 0, 7, 0, 7,
+    0, 7, 0, 7, 0, 15, 25, 16, 25, 16, 17, 0, 17, 0, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 35, 36, 37, 38, 0, 0, 39, 35, 35, 40, 41, 0, 42,
+    0, 43, 44, 45, 36, 46, 0, 41, 45, 0, 0, 41, 0, 0, 0, 47,
+    0, 48, 37, 36, 42, 49, 41, 46, 0, 0, 46, 35, 0, 35, 47, 47,
+    0, 50, 51, 52, 53, 54, 53, 55, 52, 50, 50, 56, 50, 50, 50, 57,
+    58, 57, 55, 58, 59, 57, 56, 60, 50, 50, 60, 61, 50, 61, 57, 57,
+    50, 53, 53, 62, 53, 55, 63, 0, 64, 65, 61, 61, 58, 56, 50, 59,
+    50, 42, 66, 67, 61, 37, 0, 43, 68, 43, 68, 0, 0, 0, 0, 45,
+    52, 0, 0, 47, 57, 42, 66, 42, 66, 59, 59, 47, 57, 47, 57, 42,
+    66, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 54, 67, 61, 48,
+    57, 69, 70, 71, 72, 0, 73, 74, 0, 45, 52, 74, 0, 41, 55, 41,
+    55, 41, 55, 46, 54, 71, 70, 0, 73, 0, 57, 37, 0, 69, 54, 75,
+    7, 75, 7, 74, 0, 46, 54, 46, 54, 0, 0, 0, 73, 50, 53, 50,
+    53, 0, 41, 55, 0, 55, 46, 54, 0, 0, 46, 54, 0, 0, 46, 54,
+    0, 43, 0, 43, 0, 0, 53, 0, 53, 47, 57, 47, 57, 41, 55, 45,
+    52, 0, 0, 0, 0, 0, 0, 47, 57, 47, 57, 47, 57, 47, 57, 42,
+    59, 42, 59, 42, 59, 0, 50, 69, 70, 0, 50, 71, 72, 74, 0, 41,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t notosans_14_bolditalicKernRightClasses[833] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 0, 0, 0, 4,
+    0, 0, 0, 17, 0, 18, 18, 18, 19, 20, 0, 0, 19, 0, 0, 21,
+    21, 18, 21, 18, 21, 20, 0, 21, 22, 22, 0, 22, 23, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 26, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0,
+    19, 18, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 0, 0, 0,
+    0, 0, 21, 18, 18, 18, 18, 18, 0, 18, 21, 21, 21, 21, 22, 0,
+    22, 9, 17, 9, 17, 9, 17, 10, 18, 10, 18, 10, 18, 10, 18, 0,
+    18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 10, 20, 10,
+    20, 10, 20, 10, 20, 0, 0, 0, 27, 0, 28, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 21, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 21, 0, 21, 0, 21, 0, 0, 21, 10, 18, 10,
+    18, 10, 18, 10, 18, 0, 21, 0, 21, 0, 0, 0, 20, 0, 20, 0,
+    20, 0, 20, 12, 0, 12, 0, 12, 0, 13, 21, 13, 21, 13, 21, 13,
+    21, 13, 21, 13, 21, 14, 22, 16, 22, 16, 0, 23, 0, 23, 0, 23,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 29, 0, 30, 31, 0, 0, 32, 33, 0, 29, 0, 0, 34,
+    0, 35, 0, 0, 0, 36, 0, 37, 38, 0, 0, 0, 33, 0, 0, 30,
+    0, 0, 30, 29, 34, 39, 37, 0, 40, 0, 0, 29, 0, 0, 38, 0,
+    41, 42, 43, 42, 44, 45, 42, 46, 44, 47, 47, 7, 48, 7, 7, 42,
+    7, 7, 42, 7, 49, 42, 50, 47, 51, 47, 47, 52, 47, 47, 46, 7,
+    53, 42, 42, 54, 44, 42, 55, 0, 56, 57, 48, 7, 54, 7, 47, 49,
+    47, 58, 59, 60, 0, 0, 61, 35, 62, 0, 61, 0, 0, 0, 61, 38,
+    44, 40, 61, 63, 64, 58, 59, 58, 59, 63, 64, 63, 64, 63, 64, 58,
+    59, 63, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 60, 54, 0,
+    61, 0, 61, 60, 0, 0, 61, 37, 44, 38, 44, 0, 61, 0, 61, 60,
+    54, 65, 52, 0, 61, 0, 61, 0, 61, 63, 64, 63, 64, 29, 61, 66,
+    67, 66, 67, 37, 46, 65, 52, 40, 51, 40, 51, 0, 61, 68, 69, 68,
+    69, 0, 37, 46, 0, 61, 70, 62, 0, 61, 0, 61, 40, 51, 0, 61,
+    0, 35, 71, 35, 71, 35, 71, 0, 64, 60, 44, 60, 44, 37, 46, 38,
+    44, 0, 0, 0, 61, 0, 61, 63, 64, 63, 64, 63, 64, 38, 46, 34,
+    49, 34, 49, 34, 49, 40, 51, 0, 61, 0, 47, 60, 0, 37, 46, 37,
+    46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 72, 2, 5, 0, 72, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 25, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t notosans_14_bolditalicKernPairOffsets[76] = {
+    0, 25, 28, 40, 55, 63, 68, 69, 71, 75, 76, 79, 85, 89, 103, 109,
+    122, 123, 124, 125, 126, 128, 129, 133, 135, 138, 140, 146, 154, 157, 158, 164,
+    166, 167, 172, 181, 203, 209, 210, 212, 219, 229, 253, 270, 277, 280, 290, 296,
+    306, 320, 321, 331, 335, 337, 339, 345, 349, 359, 366, 373, 388, 399, 407, 410,
+    416, 418, 420, 427, 437, 459, 462, 480, 484, 491, 498, 512,
+};
+
+static const EpdKernPair notosans_14_bolditalicKernPairs[] = {
+    { 9, -2 },
+    { 12, 1 },
+    { 14, 1 },
+    { 17, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, 1 },
+    { 33, -1 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 48, -1 },
+    { 49, 1 },
+    { 54, 1 },
+    { 56, 1 },
+    { 62, -2 },
+    { 64, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 11, 3 },
+    { 19, 1 },
+    { 29, 1 },
+    { 32, 3 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, -1 },
+    { 49, 1 },
+    { 54, 1 },
+    { 56, 1 },
+    { 57, 3 },
+    { 10, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 29, -2 },
+    { 39, -1 },
+    { 40, -2 },
+    { 51, -2 },
+    { 52, -1 },
+    { 58, -2 },
+    { 63, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 68, -2 },
+    { 12, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 37, -1 },
+    { 40, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 65, -1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 16, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 11, 2 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 24, -1 },
+    { 3, -1 },
+    { 5, -4 },
+    { 9, -1 },
+    { 15, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 17, -2 },
+    { 18, -2 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 3, -1 },
+    { 11, 3 },
+    { 22, -1 },
+    { 2, 1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 18, -1 },
+    { 2, 1 },
+    { 5, -3 },
+    { 17, -1 },
+    { 18, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 29, -1 },
+    { 40, -1 },
+    { 65, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -1 },
+    { 29, -2 },
+    { 34, -1 },
+    { 37, -1 },
+    { 40, -2 },
+    { 65, -1 },
+    { 11, 3 },
+    { 12, -1 },
+    { 16, -1 },
+    { 4, 1 },
+    { 1, 2 },
+    { 2, 2 },
+    { 4, 3 },
+    { 8, 2 },
+    { 27, 2 },
+    { 72, 1 },
+    { 4, 1 },
+    { 28, 3 },
+    { 11, 1 },
+    { 1, 1 },
+    { 2, 1 },
+    { 4, 2 },
+    { 8, 1 },
+    { 72, 1 },
+    { 2, -2 },
+    { 5, -1 },
+    { 29, -2 },
+    { 34, -1 },
+    { 40, -2 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -2 },
+    { 72, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 25, -1 },
+    { 30, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 36, -2 },
+    { 39, -1 },
+    { 42, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 56, 1 },
+    { 24, -1 },
+    { 32, 1 },
+    { 39, -1 },
+    { 51, -1 },
+    { 63, -1 },
+    { 68, -1 },
+    { 40, -1 },
+    { 32, 1 },
+    { 57, 1 },
+    { 2, -2 },
+    { 29, -2 },
+    { 34, -1 },
+    { 40, -2 },
+    { 51, -1 },
+    { 52, -1 },
+    { 72, -1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 24, -1 },
+    { 30, -1 },
+    { 32, 1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 51, -1 },
+    { 63, -1 },
+    { 68, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 30, -1 },
+    { 33, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 39, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 48, -2 },
+    { 51, -1 },
+    { 54, 2 },
+    { 55, -1 },
+    { 56, 1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 2, -2 },
+    { 29, -2 },
+    { 30, -1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, -1 },
+    { 39, -1 },
+    { 40, -3 },
+    { 49, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 58, -1 },
+    { 60, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 68, -1 },
+    { 72, -2 },
+    { 2, -1 },
+    { 40, -1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 68, -1 },
+    { 72, -1 },
+    { 5, -1 },
+    { 29, -1 },
+    { 40, -1 },
+    { 4, 1 },
+    { 32, 4 },
+    { 33, 1 },
+    { 36, 1 },
+    { 40, -1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 57, 3 },
+    { 5, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 40, -1 },
+    { 5, -4 },
+    { 29, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 48, -1 },
+    { 62, -1 },
+    { 70, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 34, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 48, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 29, -1 },
+    { 5, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 40, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 72, -1 },
+    { 5, -1 },
+    { 29, -2 },
+    { 49, -1 },
+    { 51, -1 },
+    { 29, -1 },
+    { 49, -1 },
+    { 5, -1 },
+    { 29, -1 },
+    { 29, -1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 51, -1 },
+    { 64, -1 },
+    { 69, -1 },
+    { 6, -1 },
+    { 29, -1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 5, -1 },
+    { 29, -2 },
+    { 34, -1 },
+    { 40, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 72, -1 },
+    { 2, -1 },
+    { 29, -1 },
+    { 40, -1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 72, -1 },
+    { 5, -1 },
+    { 33, -1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 62, -1 },
+    { 72, 1 },
+    { 2, -1 },
+    { 4, 1 },
+    { 29, -1 },
+    { 32, 4 },
+    { 33, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 48, 1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 57, 2 },
+    { 72, -1 },
+    { 2, -2 },
+    { 29, -3 },
+    { 30, -1 },
+    { 40, -4 },
+    { 49, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 59, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 72, -3 },
+    { 2, -1 },
+    { 29, -3 },
+    { 32, 3 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 57, 1 },
+    { 72, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 51, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 29, 1 },
+    { 34, 1 },
+    { 54, 1 },
+    { 72, 1 },
+    { 32, 2 },
+    { 57, 1 },
+    { 5, -1 },
+    { 62, -1 },
+    { 2, -1 },
+    { 29, -1 },
+    { 40, -2 },
+    { 52, -1 },
+    { 58, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 2, -2 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 59, -1 },
+    { 64, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 35, -1 },
+    { 39, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 55, -2 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -2 },
+    { 70, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 62, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 29, 1 },
+    { 35, -2 },
+    { 39, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 51, -1 },
+    { 54, 1 },
+    { 55, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, 1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 5, -1 },
+    { 59, 1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 2, -2 },
+    { 49, -1 },
+    { 51, -2 },
+    { 52, -1 },
+    { 59, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 32, 6 },
+    { 39, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 63, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 5, -2 },
+    { 35, -2 },
+    { 39, -1 },
+    { 44, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 54, 1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+};
+
 static const EpdFontData notosans_14_bolditalic = {
     notosans_14_bolditalicBitmaps,
     notosans_14_bolditalicGlyphs,
@@ -5332,4 +5967,8 @@ static const EpdFontData notosans_14_bolditalic = {
     32,
     -9,
     true,
+    notosans_14_bolditalicKernLeftClasses,
+    notosans_14_bolditalicKernRightClasses,
+    notosans_14_bolditalicKernPairOffsets,
+    notosans_14_bolditalicKernPairs,
 };
@@ -4083,7 +4083,7 @@ static const uint8_t notosans_14_italicBitmaps[65135] = {
 
 static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // 
+    { 0, 0, 8, 0, 0, 0, 0 }, // 
     { 0, 0, 8, 0, 0, 0, 0 }, //  
     { 9, 22, 8, 0, 21, 50, 0 }, // !
     { 10, 8, 11, 3, 21, 20, 50 }, // "
@@ -4931,6 +4931,642 @@ static const EpdUnicodeInterval notosans_14_italicIntervals[] = {
     { 0x2212, 0x2212, 0x340 },
 };
 
+static const uint8_t notosans_14_italicKernLeftClasses[833] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 8, 12, 0,
+    0, 9, 13, 9, 0, 0, 14, 7, 15, 15, 8, 16, 17, 3, 0, 0,
+    0, 18, 0, 0, 19, 20, 0, 19, 21, 0, 0, 0, 0, 22, 0, 0,
+    0, 19, 19, 0, 23, 0, 24, 0, 25, 25, 22, 25, 0, 3, 0, 0,
+    0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+    29, 6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10, 0, 0, 0,
+    0, 9, 0, 9, 9, 9, 9, 9, 0, 9, 7, 7, 7, 7, 16, 13,
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 19, 19, 19, 19, 0, 0, 0,
+    30, 19, 0, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 25, 19,
+    25, 6, 0, 6, 0, 6, 0, 8, 0, 8, 0, 8, 0, 8, 0, 9,
+    31, 9, 0, 10, 19, 10, 19, 10, 19, 10, 19, 10, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 30, 0, 0, 33,
+    0, 0, 0, 0, 0, 0, 0, 8, 22, 22, 12, 0, 12, 0, 12, 31,
+    12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 19, 9,
+    19, 9, 19, 10, 19, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 24, 14, 34, 14, 24, 7, 0, 7, 0, 7, 0, 7,
+    0, 7, 0, 7, 0, 15, 25, 16, 25, 16, 17, 0, 17, 0, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 35, 36, 37, 38, 0, 0, 39, 35, 35, 40, 41, 0, 42,
+    0, 43, 44, 45, 36, 46, 0, 41, 45, 0, 0, 41, 0, 0, 0, 47,
+    0, 48, 37, 36, 42, 49, 41, 46, 0, 0, 46, 35, 0, 35, 47, 47,
+    0, 50, 51, 52, 53, 54, 53, 55, 52, 50, 50, 56, 50, 50, 50, 57,
+    58, 57, 55, 58, 59, 57, 56, 60, 50, 50, 60, 61, 50, 61, 57, 57,
+    50, 53, 53, 62, 53, 55, 63, 0, 64, 65, 61, 61, 58, 56, 50, 59,
+    50, 42, 66, 67, 61, 37, 0, 43, 68, 43, 68, 0, 0, 0, 0, 45,
+    52, 0, 0, 47, 57, 42, 66, 42, 66, 59, 59, 47, 57, 47, 57, 42,
+    66, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 54, 67, 61, 48,
+    57, 69, 70, 71, 72, 0, 73, 74, 0, 45, 52, 74, 0, 41, 55, 41,
+    55, 41, 55, 46, 54, 71, 70, 0, 73, 0, 57, 37, 0, 69, 54, 75,
+    7, 75, 7, 74, 0, 46, 54, 46, 54, 0, 0, 0, 73, 50, 53, 50,
+    53, 0, 41, 55, 0, 55, 46, 54, 0, 0, 46, 54, 0, 0, 46, 54,
+    0, 43, 0, 43, 0, 0, 53, 0, 53, 47, 57, 47, 57, 41, 55, 45,
+    52, 0, 0, 0, 0, 0, 0, 47, 57, 47, 57, 47, 57, 47, 57, 42,
+    59, 42, 59, 42, 59, 0, 50, 69, 70, 0, 50, 71, 72, 74, 0, 41,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t notosans_14_italicKernRightClasses[833] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 0, 0, 0, 4,
+    0, 0, 0, 17, 0, 18, 18, 18, 19, 20, 0, 0, 19, 0, 0, 21,
+    21, 18, 21, 18, 21, 20, 0, 21, 22, 22, 0, 22, 23, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 26, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0,
+    19, 18, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 0, 0, 0,
+    0, 0, 21, 18, 18, 18, 18, 18, 0, 18, 21, 21, 21, 21, 22, 0,
+    22, 9, 17, 9, 17, 9, 17, 10, 18, 10, 18, 10, 18, 10, 18, 0,
+    18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 10, 20, 10,
+    20, 10, 20, 10, 20, 0, 0, 0, 1, 0, 27, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 21, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 21, 0, 21, 0, 21, 0, 0, 21, 10, 18, 10,
+    18, 10, 18, 10, 18, 0, 21, 0, 21, 0, 0, 0, 20, 0, 20, 0,
+    20, 0, 20, 12, 0, 12, 0, 12, 0, 13, 21, 13, 21, 13, 21, 13,
+    21, 13, 21, 13, 21, 14, 22, 16, 22, 16, 0, 23, 0, 23, 0, 23,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 28, 0, 29, 30, 0, 0, 31, 32, 0, 28, 0, 0, 33,
+    0, 34, 0, 0, 0, 35, 0, 36, 37, 0, 0, 0, 32, 0, 0, 29,
+    0, 0, 29, 28, 33, 38, 36, 0, 39, 0, 0, 28, 0, 0, 37, 0,
+    40, 41, 42, 41, 43, 44, 41, 45, 43, 46, 46, 7, 47, 7, 7, 41,
+    7, 7, 41, 7, 48, 41, 49, 46, 50, 46, 46, 51, 46, 46, 45, 7,
+    52, 41, 41, 53, 43, 41, 54, 0, 55, 56, 47, 7, 53, 7, 46, 48,
+    46, 57, 58, 59, 0, 0, 60, 34, 61, 0, 60, 0, 0, 0, 60, 37,
+    43, 39, 60, 62, 63, 57, 58, 57, 58, 62, 63, 62, 63, 62, 63, 57,
+    58, 62, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 59, 53, 0,
+    60, 0, 60, 59, 0, 0, 60, 36, 43, 37, 43, 0, 60, 0, 60, 59,
+    53, 64, 51, 0, 60, 0, 60, 0, 60, 62, 63, 62, 63, 28, 60, 65,
+    66, 65, 66, 36, 45, 64, 51, 39, 50, 39, 50, 0, 60, 67, 68, 67,
+    68, 0, 36, 45, 0, 60, 69, 61, 0, 60, 0, 60, 39, 50, 0, 60,
+    0, 34, 70, 34, 70, 34, 70, 0, 63, 59, 43, 59, 43, 36, 45, 37,
+    43, 0, 0, 0, 60, 0, 60, 62, 63, 62, 63, 62, 63, 37, 45, 33,
+    48, 33, 48, 33, 48, 39, 50, 0, 60, 0, 46, 59, 0, 36, 45, 36,
+    45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 71, 2, 5, 0, 71, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 25, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t notosans_14_italicKernPairOffsets[76] = {
+    0, 25, 28, 40, 55, 63, 68, 69, 71, 75, 76, 79, 85, 89, 103, 109,
+    122, 123, 124, 125, 126, 128, 129, 133, 135, 138, 140, 146, 154, 157, 158, 163,
+    165, 166, 169, 178, 202, 208, 209, 211, 218, 228, 252, 270, 277, 280, 290, 296,
+    306, 320, 321, 331, 335, 337, 339, 345, 349, 359, 366, 374, 389, 400, 408, 411,
+    417, 419, 421, 428, 438, 460, 463, 481, 485, 492, 499, 513,
+};
+
+static const EpdKernPair notosans_14_italicKernPairs[] = {
+    { 9, -2 },
+    { 12, 1 },
+    { 14, 1 },
+    { 17, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 1 },
+    { 32, -1 },
+    { 33, 1 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 47, -1 },
+    { 48, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 61, -2 },
+    { 63, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 11, 3 },
+    { 19, 1 },
+    { 28, 1 },
+    { 31, 3 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 48, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 56, 3 },
+    { 10, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 28, -2 },
+    { 38, -1 },
+    { 39, -2 },
+    { 50, -2 },
+    { 51, -1 },
+    { 57, -2 },
+    { 62, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 67, -2 },
+    { 12, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 36, -1 },
+    { 39, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 64, -1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 16, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 11, 2 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 24, -1 },
+    { 3, -1 },
+    { 5, -4 },
+    { 9, -1 },
+    { 15, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 17, -2 },
+    { 18, -2 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 3, -1 },
+    { 11, 3 },
+    { 22, -1 },
+    { 2, 1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 18, -1 },
+    { 2, 1 },
+    { 5, -4 },
+    { 17, -1 },
+    { 18, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 28, -1 },
+    { 39, -1 },
+    { 64, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -1 },
+    { 28, -2 },
+    { 33, -1 },
+    { 36, -1 },
+    { 39, -2 },
+    { 64, -1 },
+    { 11, 3 },
+    { 12, -1 },
+    { 16, -1 },
+    { 4, 1 },
+    { 1, 2 },
+    { 2, 2 },
+    { 4, 2 },
+    { 8, 2 },
+    { 71, 1 },
+    { 4, 1 },
+    { 27, 3 },
+    { 11, 1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 8, 1 },
+    { 2, -2 },
+    { 5, -1 },
+    { 28, -2 },
+    { 33, -1 },
+    { 39, -2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -2 },
+    { 71, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 25, -1 },
+    { 29, -1 },
+    { 32, -2 },
+    { 34, -1 },
+    { 35, -2 },
+    { 38, -1 },
+    { 41, -2 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 47, -2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 55, 1 },
+    { 24, -1 },
+    { 31, 1 },
+    { 38, -1 },
+    { 50, -1 },
+    { 62, -1 },
+    { 67, -1 },
+    { 39, -1 },
+    { 31, 1 },
+    { 56, 1 },
+    { 2, -2 },
+    { 28, -2 },
+    { 33, -1 },
+    { 39, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 71, -1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 31, 1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 50, -1 },
+    { 62, -1 },
+    { 67, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 29, -1 },
+    { 32, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 38, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 50, -1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 55, 1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 2, -2 },
+    { 28, -2 },
+    { 29, -1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, -1 },
+    { 38, -1 },
+    { 39, -3 },
+    { 47, 1 },
+    { 48, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 57, -1 },
+    { 59, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 71, -2 },
+    { 2, -1 },
+    { 39, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 67, -1 },
+    { 71, -1 },
+    { 5, -1 },
+    { 28, -1 },
+    { 39, -1 },
+    { 4, 1 },
+    { 31, 4 },
+    { 32, 1 },
+    { 35, 1 },
+    { 39, -1 },
+    { 47, 1 },
+    { 48, 1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 56, 3 },
+    { 5, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 39, -1 },
+    { 5, -4 },
+    { 28, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 47, -1 },
+    { 61, -1 },
+    { 69, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 28, -1 },
+    { 32, -1 },
+    { 33, -2 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 69, -1 },
+    { 28, -1 },
+    { 5, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 39, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 71, -1 },
+    { 5, -1 },
+    { 28, -2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 28, -1 },
+    { 48, -1 },
+    { 5, -1 },
+    { 28, -1 },
+    { 28, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 50, -1 },
+    { 63, -1 },
+    { 68, -1 },
+    { 6, -1 },
+    { 28, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 5, -1 },
+    { 28, -2 },
+    { 33, -1 },
+    { 39, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 71, -1 },
+    { 2, -1 },
+    { 28, -1 },
+    { 39, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 71, -1 },
+    { 5, -1 },
+    { 28, -1 },
+    { 32, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 61, -1 },
+    { 71, 1 },
+    { 2, -1 },
+    { 4, 1 },
+    { 28, -1 },
+    { 31, 4 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 47, 1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 56, 1 },
+    { 71, -1 },
+    { 2, -2 },
+    { 28, -3 },
+    { 29, -1 },
+    { 39, -4 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 58, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 71, -3 },
+    { 2, -1 },
+    { 28, -3 },
+    { 31, 2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 56, 1 },
+    { 71, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 50, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 28, 1 },
+    { 33, 1 },
+    { 53, 1 },
+    { 71, 1 },
+    { 31, 2 },
+    { 56, 1 },
+    { 5, -1 },
+    { 61, -1 },
+    { 2, -1 },
+    { 28, -1 },
+    { 39, -2 },
+    { 51, -1 },
+    { 57, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 2, -2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, 1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 34, -1 },
+    { 38, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -2 },
+    { 58, -1 },
+    { 60, -1 },
+    { 61, -2 },
+    { 62, -1 },
+    { 63, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 61, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 28, 1 },
+    { 34, -2 },
+    { 38, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 50, -1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, 1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 5, -1 },
+    { 58, 1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 2, -2 },
+    { 48, -1 },
+    { 50, -2 },
+    { 51, -1 },
+    { 58, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 31, 6 },
+    { 38, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 62, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 5, -2 },
+    { 34, -2 },
+    { 38, -1 },
+    { 43, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+};
+
 static const EpdFontData notosans_14_italic = {
     notosans_14_italicBitmaps,
     notosans_14_italicGlyphs,
@@ -4940,4 +5576,8 @@ static const EpdFontData notosans_14_italic = {
     32,
     -9,
     true,
+    notosans_14_italicKernLeftClasses,
+    notosans_14_italicKernRightClasses,
+    notosans_14_italicKernPairOffsets,
+    notosans_14_italicKernPairs,
 };
@@ -5789,7 +5789,7 @@ static const uint8_t notosans_16_bolditalicBitmaps[92423] = {
 
 static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 9, 0, 0, 0, 0 }, // 
     { 0, 0, 9, 0, 0, 0, 0 }, //  
     { 11, 25, 10, 0, 24, 69, 0 }, // !
     { 13, 9, 15, 3, 24, 30, 69 }, // "
@@ -6637,6 +6637,638 @@ static const EpdUnicodeInterval notosans_16_bolditalicIntervals[] = {
     { 0x2212, 0x2212, 0x340 },
 };
 
+static const uint8_t notosans_16_bolditalicKernLeftClasses[833] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 8, 12, 0,
+    0, 9, 13, 9, 0, 0, 14, 7, 15, 15, 8, 16, 17, 3, 0, 0,
+    0, 18, 0, 0, 19, 20, 0, 19, 21, 0, 0, 0, 0, 22, 0, 0,
+    0, 19, 19, 0, 23, 0, 24, 0, 25, 25, 22, 25, 0, 3, 0, 0,
+    0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+    29, 6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10, 0, 0, 0,
+    0, 9, 0, 9, 9, 9, 9, 9, 0, 9, 7, 7, 7, 7, 16, 13,
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 19, 19, 19, 19, 0, 0, 0,
+    30, 19, 0, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 25, 19,
+    25, 6, 0, 6, 0, 6, 0, 8, 0, 8, 0, 8, 0, 8, 0, 9,
+    31, 9, 0, 10, 19, 10, 19, 10, 19, 10, 19, 10, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 30, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 8, 22, 22, 12, 0, 12, 0, 12, 31,
+    12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 19, 9,
+    19, 9, 19, 10, 19, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 24, 14, 33, 14, 24, 7, 0, 7, 0, 7, 0, 7,
+    0, 7, 0, 7, 0, 15, 25, 16, 25, 16, 17, 0, 17, 0, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 34, 35, 36, 37, 0, 0, 38, 34, 34, 39, 40, 0, 41,
+    0, 42, 43, 44, 35, 45, 0, 40, 44, 0, 0, 40, 0, 0, 0, 46,
+    0, 47, 36, 35, 41, 48, 40, 45, 0, 0, 45, 34, 0, 34, 46, 46,
+    0, 49, 50, 51, 52, 53, 52, 54, 51, 49, 49, 55, 49, 49, 49, 56,
+    57, 56, 54, 57, 58, 56, 55, 59, 49, 49, 59, 60, 49, 60, 56, 56,
+    49, 52, 52, 61, 52, 54, 62, 0, 63, 64, 60, 60, 57, 55, 49, 58,
+    49, 41, 65, 66, 60, 36, 0, 42, 67, 42, 67, 0, 0, 0, 0, 44,
+    51, 0, 0, 46, 56, 41, 65, 41, 65, 58, 58, 46, 56, 46, 56, 41,
+    65, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 53, 66, 60, 47,
+    56, 68, 69, 70, 71, 0, 72, 73, 0, 44, 51, 73, 0, 40, 54, 40,
+    54, 40, 54, 45, 53, 70, 69, 0, 72, 0, 56, 36, 0, 68, 53, 74,
+    7, 74, 7, 73, 0, 45, 53, 45, 53, 0, 0, 0, 72, 49, 52, 49,
+    52, 0, 40, 54, 0, 54, 45, 53, 0, 0, 45, 53, 0, 0, 45, 53,
+    0, 42, 0, 42, 0, 0, 52, 0, 52, 46, 56, 46, 56, 40, 54, 44,
+    51, 0, 0, 0, 0, 0, 0, 46, 56, 46, 56, 46, 56, 46, 56, 41,
+    58, 41, 58, 41, 58, 0, 49, 68, 69, 0, 49, 70, 71, 73, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t notosans_16_bolditalicKernRightClasses[833] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 0, 0, 0, 4,
+    0, 0, 0, 17, 0, 18, 18, 18, 19, 20, 0, 0, 19, 0, 0, 20,
+    20, 18, 20, 18, 20, 20, 0, 20, 21, 21, 0, 21, 22, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 25, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0,
+    19, 18, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 0, 0, 0,
+    0, 0, 20, 18, 18, 18, 18, 18, 0, 18, 20, 20, 20, 20, 21, 0,
+    21, 9, 17, 9, 17, 9, 17, 10, 18, 10, 18, 10, 18, 10, 18, 0,
+    18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 10, 20, 10,
+    20, 10, 20, 10, 20, 0, 0, 0, 26, 0, 27, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 20, 0, 20, 0, 20, 0, 0, 20, 10, 18, 10,
+    18, 10, 18, 10, 18, 0, 20, 0, 20, 0, 0, 0, 20, 0, 20, 0,
+    20, 0, 20, 12, 0, 12, 0, 12, 0, 13, 20, 13, 20, 13, 20, 13,
+    20, 13, 20, 13, 20, 14, 21, 16, 21, 16, 0, 22, 0, 22, 0, 22,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 28, 0, 29, 30, 0, 0, 31, 32, 0, 28, 0, 0, 33,
+    0, 34, 0, 0, 0, 35, 0, 36, 37, 0, 0, 0, 32, 0, 0, 29,
+    0, 0, 29, 28, 33, 38, 36, 0, 39, 0, 0, 28, 0, 0, 37, 0,
+    40, 41, 42, 41, 43, 44, 41, 45, 43, 46, 46, 7, 47, 7, 7, 41,
+    7, 7, 41, 7, 48, 41, 49, 46, 50, 46, 46, 51, 46, 46, 45, 7,
+    52, 41, 41, 53, 43, 41, 54, 0, 55, 56, 47, 7, 53, 7, 46, 48,
+    46, 57, 58, 59, 0, 0, 60, 34, 61, 0, 60, 0, 0, 0, 60, 37,
+    43, 39, 60, 62, 63, 57, 58, 57, 58, 62, 63, 62, 63, 62, 63, 57,
+    58, 62, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 59, 53, 0,
+    60, 0, 60, 59, 0, 0, 60, 36, 43, 37, 43, 0, 60, 0, 60, 59,
+    53, 64, 51, 0, 60, 0, 60, 0, 60, 62, 63, 62, 63, 28, 60, 65,
+    66, 65, 66, 36, 45, 64, 51, 39, 50, 39, 50, 0, 60, 67, 68, 67,
+    68, 0, 36, 45, 0, 60, 69, 61, 0, 60, 0, 60, 39, 50, 0, 60,
+    0, 34, 70, 34, 70, 34, 70, 0, 63, 59, 43, 59, 43, 36, 45, 37,
+    43, 0, 0, 0, 60, 0, 60, 62, 63, 62, 63, 62, 63, 37, 45, 33,
+    48, 33, 48, 33, 48, 39, 50, 0, 60, 0, 46, 59, 0, 36, 45, 36,
+    45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 71, 2, 5, 0, 71, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t notosans_16_bolditalicKernPairOffsets[75] = {
+    0, 24, 27, 39, 54, 62, 67, 68, 70, 74, 75, 78, 84, 88, 101, 107,
+    119, 120, 121, 122, 123, 125, 126, 130, 132, 135, 137, 143, 151, 154, 155, 161,
+    163, 168, 177, 199, 205, 206, 208, 215, 225, 249, 266, 273, 276, 286, 292, 302,
+    316, 317, 327, 331, 333, 335, 341, 345, 355, 362, 369, 384, 396, 404, 407, 413,
+    415, 417, 424, 434, 456, 459, 477, 481, 488, 495, 509,
+};
+
+static const EpdKernPair notosans_16_bolditalicKernPairs[] = {
+    { 9, -2 },
+    { 12, 1 },
+    { 14, 1 },
+    { 17, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 1 },
+    { 32, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 47, -1 },
+    { 48, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 61, -2 },
+    { 63, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 11, 3 },
+    { 19, 1 },
+    { 28, 1 },
+    { 31, 4 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 48, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 56, 3 },
+    { 10, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 28, -2 },
+    { 38, -1 },
+    { 39, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 57, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 67, -2 },
+    { 12, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 36, -1 },
+    { 39, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 64, -1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 11, 2 },
+    { 12, -2 },
+    { 16, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 11, 2 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 2, -3 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 23, -1 },
+    { 3, -1 },
+    { 5, -4 },
+    { 9, -2 },
+    { 15, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, 1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 17, -3 },
+    { 18, -2 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 17, -2 },
+    { 18, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 3, -1 },
+    { 11, 4 },
+    { 21, -1 },
+    { 2, 1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 18, -1 },
+    { 2, 1 },
+    { 5, -4 },
+    { 17, -1 },
+    { 18, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 28, -1 },
+    { 39, -1 },
+    { 64, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -1 },
+    { 28, -2 },
+    { 33, -1 },
+    { 36, -1 },
+    { 39, -2 },
+    { 64, -1 },
+    { 11, 3 },
+    { 12, -2 },
+    { 16, -1 },
+    { 4, 1 },
+    { 1, 2 },
+    { 2, 3 },
+    { 4, 3 },
+    { 8, 3 },
+    { 26, 2 },
+    { 71, 1 },
+    { 4, 1 },
+    { 27, 4 },
+    { 1, 1 },
+    { 2, 1 },
+    { 4, 2 },
+    { 8, 1 },
+    { 71, 1 },
+    { 2, -3 },
+    { 5, -1 },
+    { 28, -2 },
+    { 33, -1 },
+    { 39, -3 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -2 },
+    { 71, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 32, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 38, -1 },
+    { 41, -2 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 47, -2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, 2 },
+    { 54, -1 },
+    { 55, 1 },
+    { 23, -1 },
+    { 31, 1 },
+    { 38, -1 },
+    { 50, -1 },
+    { 62, -1 },
+    { 67, -1 },
+    { 39, -1 },
+    { 31, 2 },
+    { 56, 1 },
+    { 2, -3 },
+    { 28, -2 },
+    { 33, -1 },
+    { 39, -3 },
+    { 50, -1 },
+    { 51, -2 },
+    { 71, -2 },
+    { 4, 1 },
+    { 6, -1 },
+    { 23, -1 },
+    { 29, -1 },
+    { 31, 1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 50, -1 },
+    { 62, -1 },
+    { 67, -2 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 29, -1 },
+    { 32, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 38, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 47, -2 },
+    { 50, -1 },
+    { 53, 2 },
+    { 54, -1 },
+    { 55, 1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -2 },
+    { 2, -2 },
+    { 28, -2 },
+    { 29, -1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, -1 },
+    { 38, -1 },
+    { 39, -3 },
+    { 48, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 57, -1 },
+    { 59, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 67, -2 },
+    { 71, -2 },
+    { 2, -1 },
+    { 39, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 67, -1 },
+    { 71, -1 },
+    { 5, -1 },
+    { 28, -1 },
+    { 39, -1 },
+    { 4, 1 },
+    { 31, 4 },
+    { 32, 1 },
+    { 35, 1 },
+    { 39, -1 },
+    { 47, 1 },
+    { 48, 1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 56, 3 },
+    { 5, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 39, -1 },
+    { 5, -4 },
+    { 28, -1 },
+    { 32, -2 },
+    { 33, -1 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -1 },
+    { 47, -1 },
+    { 61, -2 },
+    { 69, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 28, -2 },
+    { 32, -1 },
+    { 33, -2 },
+    { 34, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 69, -1 },
+    { 28, -1 },
+    { 5, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 39, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 71, -1 },
+    { 5, -1 },
+    { 28, -2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 28, -2 },
+    { 48, -1 },
+    { 5, -1 },
+    { 28, -1 },
+    { 28, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 50, -1 },
+    { 63, -1 },
+    { 68, -1 },
+    { 6, -1 },
+    { 28, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 5, -1 },
+    { 28, -2 },
+    { 33, -1 },
+    { 39, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 71, -1 },
+    { 2, -1 },
+    { 28, -1 },
+    { 39, -1 },
+    { 48, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 71, -1 },
+    { 5, -1 },
+    { 32, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 47, -2 },
+    { 61, -1 },
+    { 71, 1 },
+    { 2, -1 },
+    { 4, 1 },
+    { 28, -2 },
+    { 31, 4 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 47, 1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 56, 2 },
+    { 71, -1 },
+    { 2, -2 },
+    { 28, -3 },
+    { 29, -1 },
+    { 32, 1 },
+    { 39, -4 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 58, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 71, -3 },
+    { 2, -1 },
+    { 28, -3 },
+    { 31, 3 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 56, 1 },
+    { 71, -1 },
+    { 28, -1 },
+    { 33, -1 },
+    { 50, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 28, 1 },
+    { 33, 1 },
+    { 53, 1 },
+    { 71, 1 },
+    { 31, 3 },
+    { 56, 1 },
+    { 5, -1 },
+    { 61, -1 },
+    { 2, -1 },
+    { 28, -1 },
+    { 39, -2 },
+    { 51, -1 },
+    { 57, -1 },
+    { 64, -2 },
+    { 65, -1 },
+    { 2, -2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -2 },
+    { 52, 1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 23, -2 },
+    { 24, -1 },
+    { 34, -2 },
+    { 38, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -2 },
+    { 58, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -1 },
+    { 63, -2 },
+    { 66, -1 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 61, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 28, 1 },
+    { 34, -2 },
+    { 38, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 50, -2 },
+    { 53, 1 },
+    { 54, -1 },
+    { 60, -1 },
+    { 61, -2 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, 1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 5, -1 },
+    { 58, 2 },
+    { 61, -1 },
+    { 63, -1 },
+    { 2, -2 },
+    { 48, -1 },
+    { 50, -3 },
+    { 51, -2 },
+    { 58, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 31, 7 },
+    { 38, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 62, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 5, -2 },
+    { 34, -2 },
+    { 38, -1 },
+    { 43, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 60, -1 },
+    { 61, -2 },
+    { 62, -1 },
+    { 63, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+};
+
 static const EpdFontData notosans_16_bolditalic = {
     notosans_16_bolditalicBitmaps,
     notosans_16_bolditalicGlyphs,
@@ -6646,4 +7278,8 @@ static const EpdFontData notosans_16_bolditalic = {
     36,
     -10,
     true,
+    notosans_16_bolditalicKernLeftClasses,
+    notosans_16_bolditalicKernRightClasses,
+    notosans_16_bolditalicKernPairOffsets,
+    notosans_16_bolditalicKernPairs,
 };
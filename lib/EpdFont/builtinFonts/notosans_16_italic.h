@@ -5261,7 +5261,7 @@ static const uint8_t notosans_16_italicBitmaps[83982] = {
 
 static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 9, 0, 0, 0, 0 }, // 
     { 0, 0, 9, 0, 0, 0, 0 }, //  
     { 10, 25, 9, 0, 24, 63, 0 }, // !
     { 11, 9, 13, 3, 24, 25, 63 }, // "
@@ -6109,6 +6109,638 @@ static const EpdUnicodeInterval notosans_16_italicIntervals[] = {
     { 0x2212, 0x2212, 0x340 },
 };
 
+static const uint8_t notosans_16_italicKernLeftClasses[833] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 8, 12, 0,
+    0, 9, 13, 9, 0, 0, 14, 7, 15, 15, 8, 16, 17, 3, 0, 0,
+    0, 18, 0, 0, 19, 20, 0, 19, 21, 0, 0, 0, 0, 22, 0, 0,
+    0, 19, 19, 0, 23, 0, 24, 0, 25, 25, 22, 25, 0, 3, 0, 0,
+    0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+    29, 6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10, 0, 0, 0,
+    0, 9, 0, 9, 9, 9, 9, 9, 0, 9, 7, 7, 7, 7, 16, 13,
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 19, 19, 19, 19, 0, 0, 0,
+    30, 19, 0, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 25, 19,
+    25, 6, 0, 6, 0, 6, 0, 8, 0, 8, 0, 8, 0, 8, 0, 9,
+    31, 9, 0, 10, 19, 10, 19, 10, 19, 10, 19, 10, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 30, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 8, 22, 22, 12, 0, 12, 0, 12, 31,
+    12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 19, 9,
+    19, 9, 19, 10, 19, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 24, 14, 33, 14, 24, 7, 0, 7, 0, 7, 0, 7,
+    0, 7, 0, 7, 0, 15, 25, 16, 25, 16, 17, 0, 17, 0, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 34, 35, 36, 37, 0, 0, 38, 34, 34, 39, 40, 0, 41,
+    0, 42, 43, 44, 35, 45, 0, 40, 44, 0, 0, 40, 0, 0, 0, 46,
+    0, 47, 36, 35, 41, 48, 40, 45, 0, 0, 45, 34, 0, 34, 46, 46,
+    0, 49, 50, 51, 52, 53, 52, 54, 51, 49, 49, 55, 49, 49, 49, 56,
+    57, 56, 54, 57, 58, 56, 55, 59, 49, 49, 59, 60, 49, 60, 56, 56,
+    49, 52, 52, 61, 52, 54, 62, 0, 63, 64, 60, 60, 57, 55, 49, 58,
+    49, 41, 65, 66, 60, 36, 0, 42, 67, 42, 67, 0, 0, 0, 0, 44,
+    51, 0, 0, 46, 56, 41, 65, 41, 65, 58, 58, 46, 56, 46, 56, 41,
+    65, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 53, 66, 60, 47,
+    56, 68, 69, 70, 71, 0, 72, 73, 0, 44, 51, 73, 0, 40, 54, 40,
+    54, 40, 54, 45, 53, 70, 69, 0, 72, 0, 56, 36, 0, 68, 53, 74,
+    7, 74, 7, 73, 0, 45, 53, 45, 53, 0, 0, 0, 72, 49, 52, 49,
+    52, 0, 40, 54, 0, 54, 45, 53, 0, 0, 45, 53, 0, 0, 45, 53,
+    0, 42, 0, 42, 0, 0, 52, 0, 52, 46, 56, 46, 56, 40, 54, 44,
+    51, 0, 0, 0, 0, 0, 0, 46, 56, 46, 56, 46, 56, 46, 56, 41,
+    58, 41, 58, 41, 58, 0, 49, 68, 69, 0, 49, 70, 71, 73, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t notosans_16_italicKernRightClasses[833] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 0, 0, 0, 4,
+    0, 0, 0, 17, 0, 18, 18, 18, 19, 20, 0, 0, 19, 0, 0, 20,
+    20, 18, 20, 18, 20, 20, 0, 20, 21, 21, 0, 21, 22, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 25, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0,
+    19, 18, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 0, 0, 0,
+    0, 0, 20, 18, 18, 18, 18, 18, 0, 18, 20, 20, 20, 20, 21, 0,
+    21, 9, 17, 9, 17, 9, 17, 10, 18, 10, 18, 10, 18, 10, 18, 0,
+    18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 10, 20, 10,
+    20, 10, 20, 10, 20, 0, 0, 0, 1, 0, 26, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 20, 0, 20, 0, 20, 0, 0, 20, 10, 18, 10,
+    18, 10, 18, 10, 18, 0, 20, 0, 20, 0, 0, 0, 20, 0, 20, 0,
+    20, 0, 20, 12, 0, 12, 0, 12, 0, 13, 20, 13, 20, 13, 20, 13,
+    20, 13, 20, 13, 20, 14, 21, 16, 21, 16, 0, 22, 0, 22, 0, 22,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 27, 0, 28, 29, 0, 0, 30, 31, 0, 27, 0, 0, 32,
+    0, 33, 0, 0, 0, 34, 0, 35, 36, 0, 0, 0, 31, 0, 0, 28,
+    0, 0, 28, 27, 32, 37, 35, 0, 38, 0, 0, 27, 0, 0, 36, 0,
+    39, 40, 41, 40, 42, 43, 40, 44, 42, 45, 45, 7, 46, 7, 7, 40,
+    7, 7, 40, 7, 47, 40, 48, 45, 49, 45, 45, 50, 45, 45, 44, 7,
+    51, 40, 40, 52, 42, 40, 53, 0, 54, 55, 46, 7, 52, 7, 45, 47,
+    45, 56, 57, 58, 0, 0, 59, 33, 60, 0, 59, 0, 0, 0, 59, 36,
+    42, 38, 59, 61, 62, 56, 57, 56, 57, 61, 62, 61, 62, 61, 62, 56,
+    57, 61, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 58, 52, 0,
+    59, 0, 59, 58, 0, 0, 59, 35, 42, 36, 42, 0, 59, 0, 59, 58,
+    52, 63, 50, 0, 59, 0, 59, 0, 59, 61, 62, 61, 62, 27, 59, 64,
+    65, 64, 65, 35, 44, 63, 50, 38, 49, 38, 49, 0, 59, 66, 67, 66,
+    67, 0, 35, 44, 0, 59, 68, 60, 0, 59, 0, 59, 38, 49, 0, 59,
+    0, 33, 69, 33, 69, 33, 69, 0, 62, 58, 42, 58, 42, 35, 44, 36,
+    42, 0, 0, 0, 59, 0, 59, 61, 62, 61, 62, 61, 62, 36, 44, 32,
+    47, 32, 47, 32, 47, 38, 49, 0, 59, 0, 45, 58, 0, 35, 44, 35,
+    44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 70, 2, 5, 0, 70, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 24, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t notosans_16_italicKernPairOffsets[75] = {
+    0, 24, 27, 39, 54, 62, 67, 68, 70, 74, 75, 78, 84, 88, 101, 107,
+    119, 120, 121, 122, 123, 125, 126, 130, 132, 135, 137, 143, 151, 154, 155, 160,
+    162, 165, 174, 198, 204, 205, 207, 214, 224, 248, 266, 273, 276, 286, 292, 302,
+    316, 317, 327, 331, 333, 335, 341, 345, 355, 362, 370, 385, 396, 404, 407, 413,
+    415, 417, 424, 434, 456, 459, 477, 481, 488, 495, 509,
+};
+
+static const EpdKernPair notosans_16_italicKernPairs[] = {
+    { 9, -2 },
+    { 12, 1 },
+    { 14, 1 },
+    { 17, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 26, 2 },
+    { 27, 1 },
+    { 29, 1 },
+    { 31, -2 },
+    { 32, 1 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 46, -1 },
+    { 47, 1 },
+    { 52, 1 },
+    { 54, 1 },
+    { 60, -2 },
+    { 62, -2 },
+    { 68, -2 },
+    { 69, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 11, 3 },
+    { 19, 1 },
+    { 27, 1 },
+    { 30, 4 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, -1 },
+    { 47, 1 },
+    { 52, 1 },
+    { 54, 1 },
+    { 55, 3 },
+    { 10, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 27, -2 },
+    { 37, -1 },
+    { 38, -3 },
+    { 49, -2 },
+    { 50, -2 },
+    { 56, -2 },
+    { 61, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 66, -2 },
+    { 12, -1 },
+    { 27, -1 },
+    { 32, -1 },
+    { 35, -1 },
+    { 38, -2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 63, -1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 11, 2 },
+    { 12, -2 },
+    { 16, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 23, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 11, 2 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 2, -3 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 23, -1 },
+    { 3, -1 },
+    { 5, -4 },
+    { 9, -2 },
+    { 15, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, 1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 17, -3 },
+    { 18, -2 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 17, -2 },
+    { 18, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 3, -1 },
+    { 11, 3 },
+    { 21, -1 },
+    { 2, 1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 18, -1 },
+    { 2, 1 },
+    { 5, -4 },
+    { 17, -1 },
+    { 18, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 27, -1 },
+    { 38, -1 },
+    { 63, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -1 },
+    { 27, -2 },
+    { 32, -1 },
+    { 35, -1 },
+    { 38, -2 },
+    { 63, -1 },
+    { 11, 3 },
+    { 12, -2 },
+    { 16, -1 },
+    { 4, 1 },
+    { 1, 2 },
+    { 2, 2 },
+    { 4, 3 },
+    { 8, 3 },
+    { 70, 1 },
+    { 4, 1 },
+    { 26, 4 },
+    { 2, 1 },
+    { 4, 1 },
+    { 8, 1 },
+    { 2, -3 },
+    { 5, -1 },
+    { 27, -2 },
+    { 32, -1 },
+    { 38, -3 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 70, -2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 37, -1 },
+    { 40, -2 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -2 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, 2 },
+    { 53, -1 },
+    { 54, 1 },
+    { 23, -1 },
+    { 30, 1 },
+    { 37, -1 },
+    { 49, -1 },
+    { 61, -1 },
+    { 66, -1 },
+    { 38, -1 },
+    { 30, 2 },
+    { 55, 1 },
+    { 2, -3 },
+    { 27, -2 },
+    { 32, -1 },
+    { 38, -3 },
+    { 49, -1 },
+    { 50, -2 },
+    { 70, -2 },
+    { 4, 1 },
+    { 6, -1 },
+    { 23, -1 },
+    { 28, -1 },
+    { 30, 1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 49, -1 },
+    { 61, -1 },
+    { 66, -2 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 43, -1 },
+    { 46, -2 },
+    { 49, -1 },
+    { 52, 2 },
+    { 53, -1 },
+    { 54, 1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -2 },
+    { 2, -2 },
+    { 27, -2 },
+    { 28, -1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 38, -3 },
+    { 46, 1 },
+    { 47, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 56, -1 },
+    { 58, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 66, -2 },
+    { 70, -2 },
+    { 2, -1 },
+    { 38, -1 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 5, -1 },
+    { 27, -1 },
+    { 38, -1 },
+    { 4, 1 },
+    { 30, 4 },
+    { 31, 1 },
+    { 34, 1 },
+    { 38, -1 },
+    { 46, 1 },
+    { 47, 1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 55, 3 },
+    { 5, -1 },
+    { 27, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 5, -4 },
+    { 27, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -1 },
+    { 46, -1 },
+    { 60, -2 },
+    { 68, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 27, -2 },
+    { 31, -1 },
+    { 32, -2 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 46, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 68, -1 },
+    { 27, -1 },
+    { 5, -1 },
+    { 27, -1 },
+    { 32, -1 },
+    { 38, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 70, -1 },
+    { 5, -1 },
+    { 27, -2 },
+    { 47, -1 },
+    { 49, -1 },
+    { 27, -2 },
+    { 47, -1 },
+    { 5, -1 },
+    { 27, -1 },
+    { 27, -1 },
+    { 40, -1 },
+    { 43, -1 },
+    { 49, -1 },
+    { 62, -1 },
+    { 67, -1 },
+    { 6, -1 },
+    { 27, -1 },
+    { 40, -1 },
+    { 43, -1 },
+    { 5, -1 },
+    { 27, -2 },
+    { 32, -1 },
+    { 38, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 70, -1 },
+    { 2, -1 },
+    { 27, -1 },
+    { 38, -1 },
+    { 47, -2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 70, -1 },
+    { 5, -1 },
+    { 27, -1 },
+    { 31, -1 },
+    { 40, -1 },
+    { 43, -1 },
+    { 46, -2 },
+    { 60, -1 },
+    { 70, 1 },
+    { 2, -1 },
+    { 4, 1 },
+    { 27, -2 },
+    { 30, 4 },
+    { 31, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 46, 1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 55, 2 },
+    { 70, -1 },
+    { 2, -2 },
+    { 27, -3 },
+    { 28, -1 },
+    { 38, -4 },
+    { 47, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 57, -1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 70, -3 },
+    { 2, -1 },
+    { 27, -3 },
+    { 30, 3 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 55, 1 },
+    { 70, -1 },
+    { 27, -1 },
+    { 32, -1 },
+    { 49, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 27, 1 },
+    { 32, 1 },
+    { 52, 1 },
+    { 70, 1 },
+    { 30, 3 },
+    { 55, 1 },
+    { 5, -1 },
+    { 60, -1 },
+    { 2, -1 },
+    { 27, -1 },
+    { 38, -2 },
+    { 50, -1 },
+    { 56, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 2, -2 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, 1 },
+    { 57, -1 },
+    { 62, -1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 23, -2 },
+    { 24, -1 },
+    { 33, -2 },
+    { 37, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -2 },
+    { 57, -1 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -2 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 60, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 27, 1 },
+    { 33, -2 },
+    { 37, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 49, -2 },
+    { 52, 1 },
+    { 53, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, 1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 5, -1 },
+    { 57, 2 },
+    { 60, -1 },
+    { 62, -1 },
+    { 2, -2 },
+    { 47, -1 },
+    { 49, -3 },
+    { 50, -2 },
+    { 57, -1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 30, 7 },
+    { 37, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 61, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 5, -2 },
+    { 33, -2 },
+    { 37, -1 },
+    { 42, -1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, 1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+};
+
 static const EpdFontData notosans_16_italic = {
     notosans_16_italicBitmaps,
     notosans_16_italicGlyphs,
@@ -6118,4 +6750,8 @@ static const EpdFontData notosans_16_italic = {
     36,
     -10,
     true,
+    notosans_16_italicKernLeftClasses,
+    notosans_16_italicKernRightClasses,
+    notosans_16_italicKernPairOffsets,
+    notosans_16_italicKernPairs,
 };
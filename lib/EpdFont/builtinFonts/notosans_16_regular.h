@@ -4917,7 +4917,7 @@ static const uint8_t notosans_16_regularBitmaps[78480] = {
 
 static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // 
+    { 0, 0, 9, 0, 0, 0, 0 }, // 
     { 0, 0, 9, 0, 0, 0, 0 }, //  
     { 5, 25, 9, 2, 24, 32, 0 }, // !
     { 10, 9, 14, 2, 24, 23, 32 }, // "
@@ -5766,6 +5766,605 @@ static const EpdUnicodeInterval notosans_16_regularIntervals[] = {
     { 0x2212, 0x2212, 0x341 },
 };
 
+static const uint8_t notosans_16_regularKernLeftClasses[834] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0,
+    0, 0, 0, 7, 0, 8, 9, 10, 11, 0, 0, 0, 0, 8, 12, 0,
+    0, 9, 13, 9, 0, 0, 14, 15, 16, 16, 8, 17, 18, 3, 0, 0,
+    0, 19, 0, 0, 20, 21, 0, 20, 22, 0, 0, 0, 0, 0, 0, 0,
+    0, 20, 20, 0, 23, 0, 21, 0, 24, 24, 25, 24, 0, 3, 0, 0,
+    0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+    29, 7, 7, 7, 7, 7, 7, 10, 8, 10, 10, 10, 10, 0, 0, 0,
+    0, 9, 0, 9, 9, 9, 9, 9, 0, 9, 15, 15, 15, 15, 17, 13,
+    0, 0, 0, 0, 0, 0, 0, 20, 0, 20, 20, 20, 20, 0, 0, 30,
+    30, 20, 0, 20, 20, 20, 20, 20, 0, 20, 0, 0, 0, 0, 24, 20,
+    24, 7, 0, 7, 0, 31, 0, 8, 0, 8, 0, 8, 0, 8, 0, 9,
+    32, 9, 0, 10, 20, 10, 20, 10, 20, 10, 20, 10, 20, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 30, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 25, 12, 0, 12, 0, 12, 32,
+    12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 20, 9,
+    20, 9, 20, 10, 20, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 21, 14, 34, 14, 21, 15, 0, 15, 0, 15, 0, 15,
+    0, 15, 0, 15, 0, 16, 24, 17, 24, 17, 18, 0, 18, 0, 18, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 35, 35, 36, 37, 38, 15, 0, 0, 0, 39, 39, 36, 40, 0, 41,
+    0, 42, 0, 43, 37, 44, 35, 40, 43, 0, 0, 40, 0, 0, 0, 45,
+    0, 46, 38, 37, 41, 47, 40, 44, 0, 0, 44, 39, 0, 39, 45, 45,
+    0, 48, 49, 50, 51, 52, 53, 54, 50, 6, 6, 54, 6, 6, 6, 53,
+    6, 53, 55, 51, 56, 53, 54, 52, 6, 6, 52, 57, 6, 57, 53, 53,
+    6, 53, 53, 58, 51, 55, 59, 0, 60, 61, 57, 57, 62, 54, 6, 56,
+    6, 45, 63, 64, 57, 38, 55, 42, 65, 42, 65, 0, 0, 0, 0, 15,
+    0, 0, 53, 45, 53, 41, 63, 41, 63, 56, 56, 45, 53, 45, 53, 45,
+    63, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 52, 64, 57, 46,
+    53, 66, 67, 68, 69, 0, 0, 70, 0, 15, 50, 70, 0, 40, 54, 40,
+    54, 40, 54, 44, 52, 68, 67, 0, 0, 0, 53, 38, 55, 66, 67, 71,
+    15, 71, 15, 70, 0, 44, 52, 44, 52, 0, 0, 0, 0, 6, 72, 6,
+    72, 0, 40, 54, 0, 0, 44, 52, 0, 0, 44, 52, 0, 0, 44, 52,
+    0, 42, 48, 42, 48, 35, 72, 35, 72, 45, 53, 45, 53, 40, 54, 15,
+    50, 0, 0, 0, 6, 0, 6, 45, 53, 45, 53, 45, 53, 45, 53, 41,
+    56, 41, 56, 41, 56, 0, 6, 66, 67, 0, 6, 68, 69, 70, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint8_t notosans_16_regularKernRightClasses[834] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 0, 0, 0, 4,
+    0, 0, 0, 17, 18, 19, 19, 19, 0, 20, 18, 0, 21, 18, 18, 22,
+    22, 19, 22, 19, 22, 22, 0, 22, 23, 23, 23, 23, 3, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 26, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0,
+    0, 19, 17, 17, 17, 17, 17, 17, 19, 19, 19, 19, 19, 0, 0, 0,
+    0, 0, 0, 19, 19, 19, 19, 19, 0, 19, 22, 22, 22, 22, 23, 18,
+    23, 9, 17, 9, 17, 9, 17, 10, 19, 10, 19, 10, 19, 10, 19, 0,
+    19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 10, 20, 10,
+    20, 10, 20, 10, 20, 0, 18, 0, 27, 0, 28, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 18, 22, 0, 18, 0, 18, 0, 18,
+    0, 18, 0, 0, 0, 22, 0, 22, 0, 0, 0, 0, 22, 10, 19, 10,
+    19, 10, 19, 10, 19, 0, 22, 0, 22, 0, 0, 0, 22, 0, 0, 0,
+    22, 0, 0, 12, 0, 12, 0, 12, 0, 13, 22, 13, 22, 13, 22, 13,
+    22, 13, 22, 13, 22, 14, 23, 16, 23, 16, 0, 3, 0, 3, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 29, 0, 30, 31, 0, 0, 32, 33, 0, 29, 0, 0, 34,
+    0, 35, 0, 0, 0, 36, 0, 37, 38, 0, 0, 0, 33, 0, 0, 30,
+    0, 0, 30, 29, 34, 39, 37, 0, 40, 0, 0, 29, 0, 0, 38, 0,
+    41, 42, 43, 7, 7, 44, 45, 46, 47, 7, 7, 7, 48, 7, 7, 45,
+    7, 7, 45, 49, 50, 45, 46, 7, 51, 7, 7, 49, 7, 7, 47, 7,
+    52, 45, 45, 53, 7, 45, 54, 0, 55, 56, 48, 7, 53, 7, 7, 50,
+    7, 57, 58, 59, 0, 0, 60, 35, 44, 0, 60, 0, 0, 0, 60, 38,
+    0, 40, 0, 57, 42, 61, 58, 61, 58, 57, 42, 57, 42, 57, 42, 57,
+    58, 57, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 59, 53, 0,
+    60, 0, 60, 59, 0, 0, 60, 37, 46, 38, 47, 0, 60, 0, 60, 0,
+    53, 62, 49, 0, 60, 0, 60, 0, 60, 57, 42, 57, 42, 29, 49, 63,
+    64, 63, 64, 37, 46, 62, 49, 40, 51, 40, 51, 0, 60, 65, 66, 65,
+    66, 0, 37, 46, 0, 60, 67, 44, 0, 60, 0, 60, 40, 51, 0, 60,
+    0, 35, 68, 35, 68, 35, 68, 0, 42, 0, 68, 0, 68, 37, 46, 38,
+    47, 0, 0, 0, 7, 0, 7, 57, 42, 57, 42, 57, 42, 38, 47, 34,
+    50, 34, 50, 34, 50, 40, 51, 0, 60, 0, 7, 59, 0, 37, 46, 37,
+    46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 69, 2, 5, 0, 69, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 25, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint16_t notosans_16_regularKernPairOffsets[73] = {
+    0, 26, 29, 34, 51, 56, 57, 63, 65, 69, 70, 74, 79, 84, 98, 99,
+    105, 116, 117, 118, 119, 120, 123, 127, 130, 131, 134, 137, 146, 150, 151, 157,
+    164, 166, 171, 172, 185, 205, 211, 221, 230, 256, 272, 273, 283, 289, 300, 311,
+    314, 319, 321, 330, 339, 345, 350, 352, 362, 376, 381, 384, 387, 389, 393, 395,
+    402, 410, 435, 440, 456, 459, 464, 475, 476,
+};
+
+static const EpdKernPair notosans_16_regularKernPairs[] = {
+    { 9, -2 },
+    { 12, 1 },
+    { 14, 1 },
+    { 17, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 26, -3 },
+    { 28, 2 },
+    { 29, 1 },
+    { 33, -1 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, 1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 47, 1 },
+    { 48, -2 },
+    { 49, 1 },
+    { 50, 1 },
+    { 53, 1 },
+    { 55, 1 },
+    { 62, 1 },
+    { 67, -2 },
+    { 68, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -1 },
+    { 11, 3 },
+    { 21, 1 },
+    { 32, 3 },
+    { 39, -1 },
+    { 56, 2 },
+    { 10, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 29, -2 },
+    { 32, 2 },
+    { 34, -1 },
+    { 39, -1 },
+    { 40, -3 },
+    { 49, -1 },
+    { 51, -2 },
+    { 57, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 65, -2 },
+    { 12, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 49, -1 },
+    { 62, -1 },
+    { 29, -1 },
+    { 2, -2 },
+    { 10, -1 },
+    { 11, 2 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 10, -1 },
+    { 24, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 11, 2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 2, -3 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 5, -4 },
+    { 9, -2 },
+    { 15, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, 1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 12, 1 },
+    { 17, -3 },
+    { 19, -2 },
+    { 20, -2 },
+    { 22, -2 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 5, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 24, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -2 },
+    { 22, -1 },
+    { 24, -3 },
+    { 25, -1 },
+    { 24, -1 },
+    { 11, 3 },
+    { 23, -1 },
+    { 2, 1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 5, -1 },
+    { 2, 1 },
+    { 5, -5 },
+    { 17, -1 },
+    { 19, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 19, -1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 16, -1 },
+    { 12, -1 },
+    { 16, -1 },
+    { 29, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -3 },
+    { 29, -2 },
+    { 34, -1 },
+    { 37, -1 },
+    { 40, -1 },
+    { 62, -1 },
+    { 11, 3 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 4, 2 },
+    { 2, -2 },
+    { 10, -1 },
+    { 11, 4 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 1, 2 },
+    { 2, 2 },
+    { 4, 3 },
+    { 8, 3 },
+    { 18, 1 },
+    { 27, 2 },
+    { 69, 2 },
+    { 4, 2 },
+    { 28, 4 },
+    { 1, 2 },
+    { 2, 3 },
+    { 4, 4 },
+    { 8, 4 },
+    { 69, 2 },
+    { 32, 2 },
+    { 2, -2 },
+    { 29, -2 },
+    { 34, -1 },
+    { 40, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 69, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 25, -1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 33, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 39, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 24, -1 },
+    { 30, -1 },
+    { 39, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 65, -1 },
+    { 2, -3 },
+    { 29, -2 },
+    { 34, -1 },
+    { 40, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 62, -1 },
+    { 69, -2 },
+    { 2, 1 },
+    { 24, -1 },
+    { 30, -1 },
+    { 39, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 65, -2 },
+    { 2, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 33, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 39, -1 },
+    { 41, -1 },
+    { 42, -2 },
+    { 43, -1 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, 2 },
+    { 54, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -2 },
+    { 2, -2 },
+    { 29, -2 },
+    { 30, -1 },
+    { 32, 2 },
+    { 34, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 65, -2 },
+    { 69, -1 },
+    { 4, -1 },
+    { 5, 1 },
+    { 32, 3 },
+    { 33, 1 },
+    { 36, 1 },
+    { 40, -1 },
+    { 44, 1 },
+    { 48, 1 },
+    { 50, 1 },
+    { 51, -1 },
+    { 56, 2 },
+    { 5, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 67, -1 },
+    { 5, -4 },
+    { 24, -1 },
+    { 33, -2 },
+    { 34, -1 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 48, -1 },
+    { 67, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 44, -1 },
+    { 62, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 46, -1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 41, -1 },
+    { 46, -1 },
+    { 50, -1 },
+    { 29, -1 },
+    { 46, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 44, -1 },
+    { 48, -1 },
+    { 69, 1 },
+    { 5, 1 },
+    { 29, -1 },
+    { 32, 3 },
+    { 33, 1 },
+    { 36, 1 },
+    { 44, 1 },
+    { 48, 1 },
+    { 51, -1 },
+    { 56, 2 },
+    { 29, -1 },
+    { 34, -1 },
+    { 37, -1 },
+    { 41, -1 },
+    { 46, -1 },
+    { 50, -1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 51, -1 },
+    { 66, -1 },
+    { 69, 1 },
+    { 2, 1 },
+    { 29, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 48, -2 },
+    { 52, -1 },
+    { 69, 1 },
+    { 2, -3 },
+    { 29, -2 },
+    { 34, -1 },
+    { 40, -2 },
+    { 41, -1 },
+    { 46, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -1 },
+    { 58, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 29, -1 },
+    { 32, 1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 56, 1 },
+    { 29, -1 },
+    { 34, -1 },
+    { 52, -1 },
+    { 2, 1 },
+    { 29, 1 },
+    { 53, 1 },
+    { 32, 1 },
+    { 56, 1 },
+    { 29, -1 },
+    { 32, 1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 5, -1 },
+    { 44, -1 },
+    { 2, -1 },
+    { 29, -1 },
+    { 40, -1 },
+    { 49, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 2, -2 },
+    { 42, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 58, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 33, -1 },
+    { 35, -2 },
+    { 36, -2 },
+    { 39, -1 },
+    { 42, -2 },
+    { 44, -2 },
+    { 46, -1 },
+    { 47, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -3 },
+    { 5, -2 },
+    { 6, -1 },
+    { 35, -1 },
+    { 44, -1 },
+    { 48, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 29, 1 },
+    { 35, -2 },
+    { 42, -1 },
+    { 44, -2 },
+    { 46, -1 },
+    { 47, -1 },
+    { 51, -2 },
+    { 53, 1 },
+    { 57, -1 },
+    { 60, -1 },
+    { 62, 1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 5, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 49, -1 },
+    { 51, -2 },
+    { 57, -1 },
+    { 65, -2 },
+    { 66, -1 },
+    { 5, -2 },
+    { 35, -2 },
+    { 42, -2 },
+    { 44, -2 },
+    { 51, -1 },
+    { 53, 1 },
+    { 57, -1 },
+    { 60, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 46, -1 },
+};
+
 static const EpdFontData notosans_16_regular = {
     notosans_16_regularBitmaps,
     notosans_16_regularGlyphs,
@@ -5775,4 +6374,8 @@ static const EpdFontData notosans_16_regular = {
     36,
     -10,
     true,
+    notosans_16_regularKernLeftClasses,
+    notosans_16_regularKernRightClasses,
+    notosans_16_regularKernPairOffsets,
+    notosans_16_regularKernPairs,
 };
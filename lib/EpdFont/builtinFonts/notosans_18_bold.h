@@ -6770,7 +6770,7 @@ static const uint8_t notosans_18_boldBitmaps[108125] = {
 
 static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, // 
+    { 0, 0, 10, 0, 0, 0, 0 }, // 
     { 0, 0, 10, 0, 0, 0, 0 }, //  
     { 7, 28, 11, 2, 27, 49, 0 }, // !
     { 14, 10, 18, 2, 27, 35, 49 }, // "
@@ -7619,6 +7619,625 @@ static const EpdUnicodeInterval notosans_18_boldIntervals[] = {
     { 0x2212, 0x2212, 0x341 },
 };
 
+static const uint8_t notosans_18_boldKernLeftClasses[834] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 0, 7, 8, 9, 10, 0, 0, 0, 0, 7, 11, 0,
+    0, 8, 12, 8, 0, 0, 13, 14, 15, 15, 7, 16, 17, 3, 0, 0,
+    0, 18, 0, 0, 19, 20, 0, 19, 21, 0, 0, 0, 0, 0, 0, 0,
+    0, 19, 19, 0, 22, 0, 20, 0, 23, 23, 24, 23, 0, 3, 0, 0,
+    0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    28, 6, 6, 6, 6, 6, 6, 9, 7, 9, 9, 9, 9, 0, 0, 0,
+    0, 8, 0, 8, 8, 8, 8, 8, 0, 8, 14, 14, 14, 14, 16, 12,
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 19, 19, 19, 19, 0, 0, 29,
+    29, 19, 0, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 23, 19,
+    23, 6, 0, 6, 0, 30, 0, 7, 0, 7, 0, 7, 0, 7, 0, 8,
+    31, 8, 0, 9, 19, 9, 19, 9, 19, 9, 19, 9, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 29, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 24, 11, 0, 11, 0, 11, 31,
+    11, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 19, 8,
+    19, 8, 19, 9, 19, 0, 22, 0, 22, 0, 22, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 20, 13, 33, 13, 20, 14, 0, 14, 0, 14, 0, 14,
+    0, 14, 0, 14, 0, 15, 23, 16, 23, 16, 17, 0, 17, 0, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 34, 34, 35, 36, 37, 14, 0, 0, 0, 38, 38, 35, 39, 0, 40,
+    0, 41, 0, 42, 36, 43, 34, 39, 42, 0, 0, 39, 0, 0, 0, 44,
+    0, 45, 37, 36, 40, 46, 39, 43, 0, 0, 43, 38, 0, 38, 44, 44,
+    0, 47, 48, 49, 50, 51, 52, 53, 49, 54, 54, 53, 54, 54, 54, 52,
+    54, 52, 55, 50, 56, 52, 53, 51, 54, 54, 51, 57, 54, 57, 52, 52,
+    54, 52, 52, 58, 59, 55, 60, 0, 61, 62, 57, 57, 63, 53, 54, 56,
+    54, 44, 64, 65, 57, 37, 55, 41, 66, 41, 66, 0, 0, 0, 0, 67,
+    0, 0, 52, 44, 52, 40, 64, 40, 64, 56, 56, 44, 52, 44, 52, 44,
+    64, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 51, 65, 57, 45,
+    52, 68, 69, 70, 71, 0, 0, 72, 0, 67, 49, 72, 0, 39, 53, 39,
+    53, 39, 53, 43, 51, 70, 69, 0, 0, 0, 52, 37, 55, 68, 69, 73,
+    67, 73, 67, 72, 0, 43, 51, 43, 51, 0, 0, 0, 0, 54, 74, 54,
+    74, 0, 39, 53, 0, 0, 43, 51, 0, 0, 43, 51, 0, 0, 43, 51,
+    0, 41, 47, 41, 47, 34, 74, 34, 74, 44, 52, 44, 52, 39, 53, 67,
+    49, 0, 0, 0, 54, 0, 54, 44, 52, 44, 52, 44, 52, 44, 52, 40,
+    56, 40, 56, 40, 56, 0, 54, 68, 69, 0, 54, 70, 71, 72, 0, 39,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint8_t notosans_18_boldKernRightClasses[834] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 0, 0, 0, 4,
+    0, 0, 0, 17, 18, 19, 19, 19, 0, 20, 18, 0, 21, 18, 18, 22,
+    22, 19, 22, 19, 22, 23, 0, 22, 24, 24, 24, 24, 25, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 28, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0,
+    0, 19, 17, 17, 17, 17, 17, 17, 19, 19, 19, 19, 19, 0, 0, 0,
+    0, 0, 0, 19, 19, 19, 19, 19, 0, 19, 22, 22, 22, 22, 24, 18,
+    24, 9, 17, 9, 17, 9, 17, 10, 19, 10, 19, 10, 19, 10, 19, 0,
+    19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 10, 20, 10,
+    20, 10, 20, 10, 20, 0, 18, 0, 29, 0, 30, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 18, 22, 0, 18, 0, 18, 0, 18,
+    0, 18, 0, 0, 0, 22, 0, 22, 0, 0, 0, 0, 22, 10, 19, 10,
+    19, 10, 19, 10, 19, 0, 22, 0, 22, 0, 0, 0, 23, 0, 0, 0,
+    23, 0, 0, 12, 0, 12, 0, 12, 0, 13, 22, 13, 22, 13, 22, 13,
+    22, 13, 22, 13, 22, 14, 24, 16, 24, 16, 0, 25, 0, 25, 0, 25,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 31, 0, 32, 33, 0, 0, 34, 35, 0, 31, 0, 0, 36,
+    0, 37, 0, 0, 0, 38, 0, 39, 40, 0, 0, 0, 35, 0, 0, 32,
+    0, 0, 32, 31, 36, 41, 39, 0, 42, 0, 0, 31, 0, 0, 40, 0,
+    43, 44, 45, 7, 7, 46, 47, 48, 49, 7, 7, 7, 50, 7, 7, 47,
+    7, 7, 47, 51, 52, 47, 48, 7, 53, 7, 7, 51, 7, 7, 49, 7,
+    54, 47, 47, 55, 7, 47, 56, 0, 57, 58, 50, 7, 55, 7, 7, 52,
+    7, 59, 60, 61, 0, 0, 62, 37, 46, 0, 62, 0, 0, 0, 62, 40,
+    0, 42, 0, 59, 44, 63, 60, 63, 60, 59, 44, 59, 44, 59, 44, 59,
+    60, 59, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 61, 55, 0,
+    62, 0, 62, 61, 0, 0, 62, 39, 48, 40, 49, 0, 62, 0, 62, 0,
+    55, 64, 51, 0, 62, 0, 62, 0, 62, 59, 44, 59, 44, 31, 51, 63,
+    65, 63, 65, 39, 48, 64, 51, 42, 53, 42, 53, 0, 62, 66, 67, 66,
+    67, 0, 39, 48, 0, 62, 68, 46, 0, 62, 0, 62, 42, 53, 0, 62,
+    0, 37, 69, 37, 69, 37, 69, 0, 44, 0, 69, 0, 69, 39, 48, 40,
+    49, 0, 0, 0, 7, 0, 7, 59, 44, 59, 44, 59, 44, 40, 49, 36,
+    52, 36, 52, 36, 52, 42, 53, 0, 62, 0, 7, 61, 0, 39, 48, 39,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 70, 2, 5, 0, 70, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint16_t notosans_18_boldKernPairOffsets[75] = {
+    0, 27, 30, 35, 51, 56, 62, 64, 68, 69, 73, 78, 83, 99, 100, 106,
+    119, 120, 121, 122, 123, 126, 130, 133, 134, 137, 140, 149, 153, 154, 160, 167,
+    169, 174, 175, 187, 206, 212, 222, 231, 257, 272, 273, 283, 290, 301, 313, 316,
+    321, 323, 332, 343, 349, 356, 357, 359, 369, 383, 388, 400, 403, 407, 409, 413,
+    415, 421, 429, 430, 455, 460, 476, 479, 484, 495, 496,
+};
+
+static const EpdKernPair notosans_18_boldKernPairs[] = {
+    { 9, -3 },
+    { 12, 1 },
+    { 14, 1 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 28, -3 },
+    { 30, 3 },
+    { 31, 1 },
+    { 35, -1 },
+    { 36, 1 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, 1 },
+    { 44, -2 },
+    { 46, -3 },
+    { 49, 1 },
+    { 50, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 55, 1 },
+    { 57, 1 },
+    { 64, 1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -1 },
+    { 11, 3 },
+    { 21, 2 },
+    { 34, 4 },
+    { 41, -1 },
+    { 58, 2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 31, -2 },
+    { 34, 2 },
+    { 36, -1 },
+    { 41, -2 },
+    { 42, -3 },
+    { 51, -2 },
+    { 53, -2 },
+    { 59, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 66, -2 },
+    { 12, -2 },
+    { 31, -2 },
+    { 36, -1 },
+    { 51, -1 },
+    { 64, -2 },
+    { 2, -3 },
+    { 10, -1 },
+    { 11, 2 },
+    { 12, -3 },
+    { 14, -2 },
+    { 16, -2 },
+    { 10, -1 },
+    { 26, -1 },
+    { 5, -2 },
+    { 9, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 11, 2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 2, -3 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 5, -5 },
+    { 9, -2 },
+    { 15, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 8, 1 },
+    { 9, -3 },
+    { 10, -1 },
+    { 12, 1 },
+    { 17, -3 },
+    { 19, -3 },
+    { 20, -3 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -1 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -1 },
+    { 5, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -2 },
+    { 17, -1 },
+    { 19, -1 },
+    { 26, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -2 },
+    { 22, -1 },
+    { 23, -2 },
+    { 25, -1 },
+    { 26, -3 },
+    { 27, -1 },
+    { 26, -1 },
+    { 11, 4 },
+    { 24, -1 },
+    { 2, 1 },
+    { 2, 2 },
+    { 4, 2 },
+    { 5, -1 },
+    { 2, 2 },
+    { 5, -6 },
+    { 17, -1 },
+    { 19, -1 },
+    { 2, 2 },
+    { 5, -2 },
+    { 8, 1 },
+    { 19, -1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 16, -1 },
+    { 12, -1 },
+    { 16, -1 },
+    { 31, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -3 },
+    { 31, -2 },
+    { 36, -1 },
+    { 39, -1 },
+    { 42, -1 },
+    { 64, -2 },
+    { 11, 4 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 4, 2 },
+    { 2, -3 },
+    { 10, -1 },
+    { 11, 4 },
+    { 12, -3 },
+    { 14, -2 },
+    { 16, -2 },
+    { 1, 4 },
+    { 2, 4 },
+    { 4, 5 },
+    { 8, 5 },
+    { 18, 1 },
+    { 29, 3 },
+    { 70, 3 },
+    { 4, 2 },
+    { 30, 4 },
+    { 1, 5 },
+    { 2, 4 },
+    { 4, 6 },
+    { 8, 5 },
+    { 70, 4 },
+    { 34, 2 },
+    { 2, -3 },
+    { 31, -2 },
+    { 36, -1 },
+    { 42, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 61, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -1 },
+    { 70, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 27, -1 },
+    { 31, 1 },
+    { 32, -1 },
+    { 35, -1 },
+    { 37, -3 },
+    { 38, -1 },
+    { 41, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -2 },
+    { 47, -2 },
+    { 50, -1 },
+    { 53, -1 },
+    { 54, -2 },
+    { 56, -1 },
+    { 26, -1 },
+    { 32, -1 },
+    { 41, -1 },
+    { 53, -1 },
+    { 59, -1 },
+    { 66, -1 },
+    { 2, -3 },
+    { 31, -2 },
+    { 36, -1 },
+    { 42, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 64, -1 },
+    { 70, -2 },
+    { 2, 1 },
+    { 26, -1 },
+    { 32, -1 },
+    { 41, -2 },
+    { 45, -1 },
+    { 47, -1 },
+    { 53, -1 },
+    { 59, -1 },
+    { 66, -2 },
+    { 2, 1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 26, -2 },
+    { 27, -1 },
+    { 32, -2 },
+    { 33, -1 },
+    { 35, -3 },
+    { 37, -4 },
+    { 38, -4 },
+    { 41, -1 },
+    { 43, -1 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -4 },
+    { 47, -3 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -2 },
+    { 2, -3 },
+    { 31, -3 },
+    { 32, -1 },
+    { 34, 2 },
+    { 36, -1 },
+    { 41, -1 },
+    { 42, -2 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 61, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 66, -2 },
+    { 70, -2 },
+    { 53, -1 },
+    { 5, 1 },
+    { 34, 3 },
+    { 35, 1 },
+    { 38, 2 },
+    { 42, -1 },
+    { 46, 1 },
+    { 50, 1 },
+    { 52, 1 },
+    { 53, -1 },
+    { 58, 3 },
+    { 5, -2 },
+    { 31, -1 },
+    { 36, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 48, -1 },
+    { 68, -1 },
+    { 5, -5 },
+    { 26, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -1 },
+    { 44, -1 },
+    { 46, -2 },
+    { 50, -2 },
+    { 68, -2 },
+    { 5, -2 },
+    { 31, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 46, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 64, -1 },
+    { 31, -2 },
+    { 36, -1 },
+    { 48, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 43, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 31, -1 },
+    { 48, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 70, 2 },
+    { 5, 1 },
+    { 31, -1 },
+    { 34, 4 },
+    { 35, 1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 46, 1 },
+    { 50, 1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 58, 2 },
+    { 31, -2 },
+    { 36, -1 },
+    { 39, -1 },
+    { 43, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 32, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 53, -1 },
+    { 67, -1 },
+    { 70, 1 },
+    { 31, -1 },
+    { 2, 1 },
+    { 31, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 46, -2 },
+    { 47, -1 },
+    { 50, -2 },
+    { 54, -1 },
+    { 70, 2 },
+    { 2, -3 },
+    { 31, -2 },
+    { 36, -1 },
+    { 42, -3 },
+    { 43, -1 },
+    { 48, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -1 },
+    { 60, -1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 70, -1 },
+    { 31, -2 },
+    { 34, 2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 58, 1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 35, -1 },
+    { 36, 1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 55, 1 },
+    { 57, 1 },
+    { 70, 2 },
+    { 31, -1 },
+    { 36, -1 },
+    { 54, -1 },
+    { 2, 1 },
+    { 31, 1 },
+    { 55, 2 },
+    { 57, 1 },
+    { 34, 1 },
+    { 58, 1 },
+    { 31, -2 },
+    { 34, 2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 5, -2 },
+    { 46, -1 },
+    { 2, -2 },
+    { 31, -2 },
+    { 42, -2 },
+    { 51, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 2, -3 },
+    { 44, -1 },
+    { 51, -2 },
+    { 52, -1 },
+    { 53, -1 },
+    { 60, -1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 5, -2 },
+    { 5, -2 },
+    { 6, -2 },
+    { 26, -2 },
+    { 27, -1 },
+    { 31, 1 },
+    { 32, -1 },
+    { 35, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 41, -1 },
+    { 44, -3 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 59, -1 },
+    { 60, -1 },
+    { 62, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 5, -2 },
+    { 6, -1 },
+    { 37, -1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 31, 1 },
+    { 37, -2 },
+    { 44, -2 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 53, -2 },
+    { 55, 1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 64, 1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -2 },
+    { 5, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 51, -1 },
+    { 53, -2 },
+    { 59, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 5, -2 },
+    { 37, -2 },
+    { 44, -2 },
+    { 46, -2 },
+    { 53, -2 },
+    { 55, 1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 48, -1 },
+};
+
 static const EpdFontData notosans_18_bold = {
     notosans_18_boldBitmaps,
     notosans_18_boldGlyphs,
@@ -7628,4 +8247,8 @@ static const EpdFontData notosans_18_bold = {
     41,
     -11,
     true,
+    notosans_18_boldKernLeftClasses,
+    notosans_18_boldKernRightClasses,
+    notosans_18_boldKernPairOffsets,
+    notosans_18_boldKernPairs,
 };
@@ -6583,7 +6583,7 @@ static const uint8_t notosans_18_italicBitmaps[105127] = {
 
 static const EpdGlyph notosans_18_italicGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, // 
+    { 0, 0, 10, 0, 0, 0, 0 }, // 
     { 0, 0, 10, 0, 0, 0, 0 }, //  
     { 11, 28, 10, 0, 27, 77, 0 }, // !
     { 12, 10, 15, 4, 27, 30, 77 }, // "
@@ -7431,6 +7431,651 @@ static const EpdUnicodeInterval notosans_18_italicIntervals[] = {
     { 0x2212, 0x2212, 0x340 },
 };
 
+static const uint8_t notosans_18_italicKernLeftClasses[833] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0, 8, 12, 0,
+    0, 9, 13, 9, 0, 0, 14, 7, 15, 15, 8, 16, 17, 3, 0, 0,
+    0, 18, 0, 0, 19, 20, 0, 19, 21, 0, 0, 0, 0, 22, 0, 0,
+    0, 19, 19, 0, 23, 0, 24, 0, 25, 25, 22, 25, 0, 3, 0, 0,
+    0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+    29, 6, 6, 6, 6, 6, 6, 10, 8, 10, 10, 10, 10, 0, 0, 0,
+    0, 9, 0, 9, 9, 9, 9, 9, 0, 9, 7, 7, 7, 7, 16, 13,
+    0, 0, 0, 0, 0, 0, 0, 19, 0, 19, 19, 19, 19, 0, 0, 0,
+    30, 19, 0, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 25, 19,
+    25, 6, 0, 6, 0, 6, 0, 8, 0, 8, 0, 8, 0, 8, 0, 9,
+    31, 9, 0, 10, 19, 10, 19, 10, 19, 10, 19, 10, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 30, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 8, 22, 22, 12, 0, 12, 0, 12, 31,
+    12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 19, 9,
+    19, 9, 19, 10, 19, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 24, 14, 33, 14, 24, 7, 0, 7, 0, 7, 0, 7,
+    0, 7, 0, 7, 0, 15, 25, 16, 25, 16, 17, 0, 17, 0, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 34, 35, 36, 37, 0, 0, 38, 34, 34, 39, 40, 0, 41,
+    0, 42, 43, 44, 35, 45, 0, 40, 44, 0, 0, 40, 0, 0, 0, 46,
+    0, 47, 36, 35, 41, 48, 40, 45, 0, 0, 45, 34, 0, 34, 46, 46,
+    0, 49, 50, 51, 52, 53, 52, 54, 51, 49, 49, 55, 49, 49, 49, 56,
+    57, 56, 54, 57, 58, 56, 55, 59, 49, 49, 59, 60, 49, 60, 56, 56,
+    49, 52, 52, 61, 52, 54, 62, 0, 63, 64, 60, 60, 57, 55, 49, 58,
+    49, 41, 65, 66, 60, 36, 0, 42, 67, 42, 67, 0, 0, 0, 0, 44,
+    51, 0, 0, 46, 56, 41, 65, 41, 65, 58, 58, 46, 56, 46, 56, 41,
+    65, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 53, 66, 60, 47,
+    56, 68, 69, 70, 71, 0, 72, 73, 0, 44, 51, 73, 0, 40, 54, 40,
+    54, 40, 54, 45, 53, 70, 69, 0, 72, 0, 56, 36, 0, 68, 53, 74,
+    75, 74, 75, 73, 0, 45, 53, 45, 53, 0, 0, 0, 72, 49, 52, 49,
+    52, 0, 40, 54, 0, 54, 45, 53, 0, 0, 45, 53, 0, 0, 45, 53,
+    0, 42, 0, 42, 0, 0, 52, 0, 52, 46, 56, 46, 56, 40, 54, 44,
+    51, 0, 0, 0, 0, 0, 0, 46, 56, 46, 56, 46, 56, 46, 56, 41,
+    58, 41, 58, 41, 58, 0, 49, 68, 69, 0, 49, 70, 71, 73, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t notosans_18_italicKernRightClasses[833] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 0, 0, 0, 4,
+    0, 0, 0, 17, 0, 18, 18, 18, 19, 20, 0, 0, 19, 0, 0, 21,
+    21, 18, 21, 18, 21, 22, 0, 21, 23, 23, 0, 23, 24, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 27, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0,
+    19, 18, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 0, 0, 0,
+    0, 0, 21, 18, 18, 18, 18, 18, 0, 18, 21, 21, 21, 21, 23, 0,
+    23, 9, 17, 9, 17, 9, 17, 10, 18, 10, 18, 10, 18, 10, 18, 0,
+    18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 0, 18, 10, 20, 10,
+    20, 10, 20, 10, 20, 0, 0, 0, 28, 0, 29, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 0, 0, 21, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 21, 0, 21, 0, 21, 0, 0, 21, 10, 18, 10,
+    18, 10, 18, 10, 18, 0, 21, 0, 21, 0, 0, 0, 22, 0, 22, 0,
+    22, 0, 22, 12, 0, 12, 0, 12, 0, 13, 21, 13, 21, 13, 21, 13,
+    21, 13, 21, 13, 21, 14, 23, 16, 23, 16, 0, 24, 0, 24, 0, 24,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 30, 0, 31, 32, 0, 0, 33, 34, 0, 30, 0, 0, 35,
+    0, 36, 0, 0, 0, 37, 0, 38, 39, 0, 0, 0, 34, 0, 0, 31,
+    0, 0, 31, 30, 35, 40, 38, 0, 41, 0, 0, 30, 0, 0, 39, 0,
+    42, 43, 44, 43, 45, 46, 43, 47, 45, 48, 48, 7, 49, 7, 7, 43,
+    7, 7, 43, 7, 50, 43, 51, 48, 52, 48, 48, 53, 48, 48, 47, 7,
+    54, 43, 43, 55, 45, 43, 56, 0, 57, 58, 49, 7, 55, 7, 48, 50,
+    48, 59, 60, 61, 0, 0, 62, 36, 63, 0, 62, 0, 0, 0, 62, 39,
+    45, 41, 62, 64, 65, 59, 60, 59, 60, 64, 65, 64, 65, 64, 65, 59,
+    60, 64, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 61, 55, 0,
+    62, 0, 62, 61, 0, 0, 62, 38, 45, 39, 45, 0, 62, 0, 62, 61,
+    55, 66, 53, 0, 62, 0, 62, 0, 62, 64, 65, 64, 65, 30, 62, 67,
+    68, 67, 68, 38, 47, 66, 53, 41, 52, 41, 52, 0, 62, 69, 70, 69,
+    70, 0, 38, 47, 0, 62, 71, 63, 0, 62, 0, 62, 41, 52, 0, 62,
+    0, 36, 72, 36, 72, 36, 72, 0, 65, 61, 45, 61, 45, 38, 47, 39,
+    45, 0, 0, 0, 62, 0, 62, 64, 65, 64, 65, 64, 65, 39, 47, 35,
+    50, 35, 50, 35, 50, 41, 52, 0, 62, 0, 48, 61, 0, 38, 47, 38,
+    47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 73, 2, 5, 0, 73, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 26, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t notosans_18_italicKernPairOffsets[76] = {
+    0, 26, 29, 41, 56, 64, 69, 70, 72, 76, 77, 80, 86, 90, 105, 111,
+    125, 126, 127, 128, 129, 131, 132, 136, 138, 141, 143, 149, 157, 160, 161, 167,
+    169, 172, 181, 205, 211, 213, 215, 222, 232, 256, 274, 281, 284, 295, 301, 311,
+    326, 327, 337, 341, 343, 345, 351, 356, 366, 373, 381, 396, 408, 416, 419, 425,
+    427, 429, 436, 446, 468, 471, 489, 493, 500, 507, 521, 522,
+};
+
+static const EpdKernPair notosans_18_italicKernPairs[] = {
+    { 9, -3 },
+    { 12, 1 },
+    { 14, 1 },
+    { 17, -2 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 29, 3 },
+    { 30, 1 },
+    { 32, 1 },
+    { 34, -2 },
+    { 35, 1 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, 1 },
+    { 39, 2 },
+    { 41, 1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 55, 2 },
+    { 57, 2 },
+    { 63, -3 },
+    { 65, -2 },
+    { 71, -2 },
+    { 72, -1 },
+    { 12, -2 },
+    { 14, -2 },
+    { 16, -2 },
+    { 11, 3 },
+    { 19, 2 },
+    { 30, 1 },
+    { 33, 4 },
+    { 37, 2 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 50, 1 },
+    { 55, 2 },
+    { 57, 1 },
+    { 58, 3 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 30, -2 },
+    { 40, -2 },
+    { 41, -3 },
+    { 52, -2 },
+    { 53, -2 },
+    { 59, -2 },
+    { 64, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 69, -2 },
+    { 12, -2 },
+    { 30, -2 },
+    { 35, -1 },
+    { 38, -1 },
+    { 41, -2 },
+    { 52, -1 },
+    { 53, -1 },
+    { 66, -2 },
+    { 2, -3 },
+    { 10, -1 },
+    { 11, 3 },
+    { 12, -2 },
+    { 16, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 5, -2 },
+    { 9, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 11, 2 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 2, -3 },
+    { 10, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 25, -2 },
+    { 3, -1 },
+    { 5, -5 },
+    { 9, -2 },
+    { 15, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 8, 1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 17, -3 },
+    { 18, -3 },
+    { 20, -3 },
+    { 21, -2 },
+    { 22, -2 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 5, -2 },
+    { 8, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 25, -2 },
+    { 26, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 10, -1 },
+    { 17, -2 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 24, -1 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -1 },
+    { 3, -1 },
+    { 11, 3 },
+    { 23, -1 },
+    { 2, 1 },
+    { 2, 2 },
+    { 4, 2 },
+    { 18, -1 },
+    { 2, 2 },
+    { 5, -4 },
+    { 17, -1 },
+    { 18, -1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 2, 2 },
+    { 5, -2 },
+    { 8, 1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 30, -2 },
+    { 41, -1 },
+    { 66, -1 },
+    { 12, -2 },
+    { 14, -2 },
+    { 16, -2 },
+    { 30, -2 },
+    { 35, -1 },
+    { 38, -1 },
+    { 41, -2 },
+    { 66, -2 },
+    { 11, 4 },
+    { 12, -2 },
+    { 16, -1 },
+    { 4, 2 },
+    { 1, 2 },
+    { 2, 3 },
+    { 4, 3 },
+    { 8, 3 },
+    { 28, 3 },
+    { 73, 2 },
+    { 4, 2 },
+    { 29, 4 },
+    { 2, 1 },
+    { 4, 2 },
+    { 8, 1 },
+    { 2, -3 },
+    { 5, -1 },
+    { 30, -3 },
+    { 35, -1 },
+    { 41, -3 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 73, -3 },
+    { 4, 1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 26, -2 },
+    { 31, -1 },
+    { 34, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 40, -1 },
+    { 43, -3 },
+    { 45, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -3 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, 2 },
+    { 56, -1 },
+    { 57, 1 },
+    { 25, -1 },
+    { 33, 1 },
+    { 40, -1 },
+    { 52, -1 },
+    { 64, -1 },
+    { 69, -1 },
+    { 41, -1 },
+    { 52, -1 },
+    { 33, 2 },
+    { 58, 1 },
+    { 2, -3 },
+    { 30, -3 },
+    { 35, -1 },
+    { 41, -3 },
+    { 52, -1 },
+    { 53, -2 },
+    { 73, -2 },
+    { 4, 1 },
+    { 6, -1 },
+    { 25, -1 },
+    { 31, -1 },
+    { 33, 1 },
+    { 40, -2 },
+    { 41, -1 },
+    { 52, -1 },
+    { 64, -1 },
+    { 69, -2 },
+    { 5, -3 },
+    { 6, -1 },
+    { 7, -1 },
+    { 25, -2 },
+    { 26, -1 },
+    { 31, -1 },
+    { 34, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 40, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 49, -2 },
+    { 52, -1 },
+    { 55, 2 },
+    { 56, -1 },
+    { 57, 1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 2, -3 },
+    { 30, -2 },
+    { 31, -2 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, -1 },
+    { 40, -2 },
+    { 41, -3 },
+    { 49, 1 },
+    { 50, -1 },
+    { 52, -2 },
+    { 53, -2 },
+    { 59, -2 },
+    { 61, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 69, -2 },
+    { 73, -3 },
+    { 2, -1 },
+    { 41, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 69, -1 },
+    { 73, -1 },
+    { 5, -1 },
+    { 30, -1 },
+    { 41, -1 },
+    { 4, 2 },
+    { 33, 4 },
+    { 34, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 41, -1 },
+    { 49, 2 },
+    { 50, 1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 58, 4 },
+    { 5, -2 },
+    { 30, -2 },
+    { 35, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 41, -1 },
+    { 5, -5 },
+    { 30, -1 },
+    { 34, -2 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -1 },
+    { 49, -2 },
+    { 63, -2 },
+    { 71, -2 },
+    { 4, -1 },
+    { 5, -2 },
+    { 30, -2 },
+    { 34, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 49, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 71, -1 },
+    { 30, -1 },
+    { 5, -1 },
+    { 30, -2 },
+    { 35, -1 },
+    { 41, -1 },
+    { 47, -1 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 73, -1 },
+    { 5, -1 },
+    { 30, -2 },
+    { 50, -1 },
+    { 52, -1 },
+    { 30, -2 },
+    { 50, -1 },
+    { 5, -1 },
+    { 30, -1 },
+    { 30, -2 },
+    { 43, -1 },
+    { 46, -1 },
+    { 52, -1 },
+    { 65, -1 },
+    { 70, -1 },
+    { 6, -1 },
+    { 30, -1 },
+    { 43, -1 },
+    { 46, -1 },
+    { 48, -1 },
+    { 5, -1 },
+    { 30, -3 },
+    { 35, -1 },
+    { 41, -1 },
+    { 47, -1 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 73, -1 },
+    { 2, -1 },
+    { 30, -2 },
+    { 41, -1 },
+    { 50, -2 },
+    { 52, -1 },
+    { 53, -1 },
+    { 73, -2 },
+    { 5, -2 },
+    { 30, -1 },
+    { 34, -1 },
+    { 43, -1 },
+    { 46, -1 },
+    { 49, -2 },
+    { 63, -1 },
+    { 73, 1 },
+    { 2, -1 },
+    { 4, 2 },
+    { 30, -2 },
+    { 33, 5 },
+    { 34, 2 },
+    { 36, 1 },
+    { 37, 2 },
+    { 38, 1 },
+    { 40, -1 },
+    { 41, -2 },
+    { 49, 1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 58, 2 },
+    { 73, -1 },
+    { 2, -2 },
+    { 30, -3 },
+    { 31, -1 },
+    { 41, -4 },
+    { 47, -1 },
+    { 50, -2 },
+    { 52, -3 },
+    { 53, -3 },
+    { 60, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 73, -3 },
+    { 2, -1 },
+    { 30, -3 },
+    { 33, 3 },
+    { 50, -2 },
+    { 52, -1 },
+    { 53, -1 },
+    { 58, 1 },
+    { 73, -2 },
+    { 30, -1 },
+    { 35, -1 },
+    { 52, -1 },
+    { 2, 2 },
+    { 4, 1 },
+    { 30, 1 },
+    { 35, 1 },
+    { 55, 1 },
+    { 73, 2 },
+    { 33, 3 },
+    { 58, 1 },
+    { 5, -2 },
+    { 63, -1 },
+    { 2, -2 },
+    { 30, -2 },
+    { 41, -2 },
+    { 53, -1 },
+    { 59, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 2, -3 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, 1 },
+    { 60, -1 },
+    { 65, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 36, -2 },
+    { 40, -2 },
+    { 45, -1 },
+    { 47, -1 },
+    { 50, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -1 },
+    { 56, -2 },
+    { 60, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 63, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 30, 1 },
+    { 36, -2 },
+    { 40, -1 },
+    { 45, -1 },
+    { 47, -1 },
+    { 52, -2 },
+    { 55, 1 },
+    { 56, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, 1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 5, -1 },
+    { 60, 2 },
+    { 63, -1 },
+    { 65, -1 },
+    { 2, -3 },
+    { 50, -1 },
+    { 52, -3 },
+    { 53, -2 },
+    { 60, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 33, 8 },
+    { 40, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 64, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 5, -2 },
+    { 36, -2 },
+    { 40, -1 },
+    { 45, -2 },
+    { 52, -2 },
+    { 54, -1 },
+    { 55, 1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 5, -2 },
+};
+
 static const EpdFontData notosans_18_italic = {
     notosans_18_italicBitmaps,
     notosans_18_italicGlyphs,
@@ -7440,4 +8085,8 @@ static const EpdFontData notosans_18_italic = {
     41,
     -11,
     true,
+    notosans_18_italicKernLeftClasses,
+    notosans_18_italicKernRightClasses,
+    notosans_18_italicKernPairOffsets,
+    notosans_18_italicKernPairs,
 };
@@ -6171,7 +6171,7 @@ static const uint8_t notosans_18_regularBitmaps[98532] = {
 
 static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, // 
+    { 0, 0, 10, 0, 0, 0, 0 }, // 
     { 0, 0, 10, 0, 0, 0, 0 }, //  
     { 6, 28, 10, 2, 27, 42, 0 }, // !
     { 11, 10, 15, 2, 27, 28, 42 }, // "
@@ -7020,6 +7020,615 @@ static const EpdUnicodeInterval notosans_18_regularIntervals[] = {
     { 0x2212, 0x2212, 0x341 },
 };
 
+static const uint8_t notosans_18_regularKernLeftClasses[834] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0,
+    0, 0, 0, 7, 0, 8, 9, 10, 11, 0, 0, 0, 0, 8, 12, 0,
+    0, 9, 13, 9, 0, 0, 14, 15, 16, 16, 8, 17, 18, 3, 0, 0,
+    0, 19, 0, 0, 20, 21, 0, 20, 22, 0, 0, 0, 0, 0, 0, 0,
+    0, 20, 20, 0, 23, 0, 21, 0, 24, 24, 25, 24, 0, 3, 0, 0,
+    0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+    29, 7, 7, 7, 7, 7, 7, 10, 8, 10, 10, 10, 10, 0, 0, 0,
+    0, 9, 0, 9, 9, 9, 9, 9, 0, 9, 15, 15, 15, 15, 17, 13,
+    0, 0, 0, 0, 0, 0, 0, 20, 0, 20, 20, 20, 20, 0, 0, 30,
+    30, 20, 0, 20, 20, 20, 20, 20, 0, 20, 0, 0, 0, 0, 24, 20,
+    24, 7, 0, 7, 0, 31, 0, 8, 0, 8, 0, 8, 0, 8, 0, 9,
+    32, 9, 0, 10, 20, 10, 20, 10, 20, 10, 20, 10, 20, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 30, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 8, 0, 25, 12, 0, 12, 0, 12, 32,
+    12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 20, 9,
+    20, 9, 20, 10, 20, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 21, 14, 34, 14, 21, 15, 0, 15, 0, 15, 0, 15,
+    0, 15, 0, 15, 0, 16, 24, 17, 24, 17, 18, 0, 18, 0, 18, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 35, 35, 36, 37, 38, 15, 0, 0, 0, 39, 39, 36, 40, 0, 41,
+    0, 42, 0, 43, 37, 44, 35, 40, 43, 0, 0, 40, 0, 0, 0, 45,
+    0, 46, 38, 37, 41, 47, 40, 44, 0, 0, 44, 39, 0, 39, 45, 45,
+    0, 48, 49, 50, 51, 52, 53, 54, 50, 6, 6, 54, 6, 6, 6, 53,
+    6, 53, 55, 51, 56, 53, 54, 52, 6, 6, 52, 57, 6, 57, 53, 53,
+    6, 53, 53, 58, 51, 55, 59, 0, 60, 61, 57, 57, 62, 54, 6, 56,
+    6, 45, 63, 64, 57, 38, 55, 42, 65, 42, 65, 0, 0, 0, 0, 66,
+    0, 0, 53, 45, 53, 41, 63, 41, 63, 56, 56, 45, 53, 45, 53, 45,
+    63, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 52, 64, 57, 46,
+    53, 67, 68, 69, 70, 0, 0, 71, 0, 66, 50, 71, 0, 40, 54, 40,
+    54, 40, 54, 44, 52, 69, 68, 0, 0, 0, 53, 38, 55, 67, 68, 72,
+    66, 72, 66, 71, 0, 44, 52, 44, 52, 0, 0, 0, 0, 6, 73, 6,
+    73, 0, 40, 54, 0, 0, 44, 52, 0, 0, 44, 52, 0, 0, 44, 52,
+    0, 42, 48, 42, 48, 35, 73, 35, 73, 45, 53, 45, 53, 40, 54, 66,
+    50, 0, 0, 0, 6, 0, 6, 45, 53, 45, 53, 45, 53, 45, 53, 41,
+    56, 41, 56, 41, 56, 0, 6, 67, 68, 0, 6, 69, 70, 71, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint8_t notosans_18_regularKernRightClasses[834] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 3, 2, 0, 4, 0, 0, 5, 6,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0,
+    0, 8, 0, 9, 0, 10, 0, 0, 0, 10, 0, 0, 11, 0, 0, 0,
+    0, 10, 0, 10, 0, 0, 12, 13, 14, 14, 15, 16, 0, 0, 0, 4,
+    0, 0, 0, 17, 18, 19, 19, 19, 0, 20, 18, 0, 21, 18, 18, 22,
+    22, 19, 22, 19, 22, 23, 0, 22, 24, 24, 24, 24, 25, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 28, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 10, 13, 13, 13, 13, 16, 0,
+    0, 19, 17, 17, 17, 17, 17, 17, 19, 19, 19, 19, 19, 0, 0, 0,
+    0, 0, 0, 19, 19, 19, 19, 19, 0, 19, 22, 22, 22, 22, 24, 18,
+    24, 9, 17, 9, 17, 9, 17, 10, 19, 10, 19, 10, 19, 10, 19, 0,
+    19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 0, 19, 10, 20, 10,
+    20, 10, 20, 10, 20, 0, 18, 0, 29, 0, 30, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 18, 22, 0, 18, 0, 18, 0, 18,
+    0, 18, 0, 0, 0, 22, 0, 22, 0, 0, 0, 0, 22, 10, 19, 10,
+    19, 10, 19, 10, 19, 0, 22, 0, 22, 0, 0, 0, 23, 0, 0, 0,
+    23, 0, 0, 12, 0, 12, 0, 12, 0, 13, 22, 13, 22, 13, 22, 13,
+    22, 13, 22, 13, 22, 14, 24, 16, 24, 16, 0, 25, 0, 25, 0, 25,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 31, 0, 32, 33, 0, 0, 34, 35, 0, 31, 0, 0, 36,
+    0, 37, 0, 0, 0, 38, 0, 39, 40, 0, 0, 0, 35, 0, 0, 32,
+    0, 0, 32, 31, 36, 41, 39, 0, 42, 0, 0, 31, 0, 0, 40, 0,
+    43, 44, 45, 7, 7, 46, 47, 48, 49, 7, 7, 7, 50, 7, 7, 47,
+    7, 7, 47, 51, 52, 47, 48, 7, 53, 7, 7, 51, 7, 7, 49, 7,
+    54, 47, 47, 55, 7, 47, 56, 0, 57, 58, 50, 7, 55, 7, 7, 52,
+    7, 59, 60, 61, 0, 0, 62, 37, 46, 0, 62, 0, 0, 0, 62, 40,
+    0, 42, 0, 59, 44, 63, 60, 63, 60, 59, 44, 59, 44, 59, 44, 59,
+    60, 59, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 61, 55, 0,
+    62, 0, 62, 61, 0, 0, 62, 39, 48, 40, 49, 0, 62, 0, 62, 0,
+    55, 64, 51, 0, 62, 0, 62, 0, 62, 59, 44, 59, 44, 31, 51, 63,
+    65, 63, 65, 39, 48, 64, 51, 42, 53, 42, 53, 0, 62, 66, 67, 66,
+    67, 0, 39, 48, 0, 62, 68, 46, 0, 62, 0, 62, 42, 53, 0, 62,
+    0, 37, 69, 37, 69, 37, 69, 0, 44, 0, 69, 0, 69, 39, 48, 40,
+    49, 0, 0, 0, 7, 0, 7, 59, 44, 59, 44, 59, 44, 40, 49, 36,
+    52, 36, 52, 36, 52, 42, 53, 0, 62, 0, 7, 61, 0, 39, 48, 39,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 6, 0, 0, 70, 2, 5, 0, 70, 2, 5,
+    0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint16_t notosans_18_regularKernPairOffsets[74] = {
+    0, 27, 30, 35, 51, 56, 57, 63, 65, 69, 70, 74, 79, 84, 100, 101,
+    107, 120, 121, 122, 123, 124, 127, 131, 134, 135, 138, 141, 150, 154, 155, 161,
+    168, 170, 175, 176, 188, 208, 214, 224, 233, 259, 274, 276, 286, 293, 304, 317,
+    320, 325, 327, 336, 347, 353, 360, 362, 372, 386, 391, 394, 397, 399, 403, 405,
+    411, 419, 420, 445, 450, 466, 469, 474, 485, 486,
+};
+
+static const EpdKernPair notosans_18_regularKernPairs[] = {
+    { 9, -3 },
+    { 12, 1 },
+    { 14, 1 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 28, -3 },
+    { 30, 3 },
+    { 31, 1 },
+    { 35, -1 },
+    { 36, 1 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, 1 },
+    { 44, -2 },
+    { 46, -3 },
+    { 49, 1 },
+    { 50, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 55, 1 },
+    { 57, 1 },
+    { 64, 1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -1 },
+    { 11, 3 },
+    { 21, 2 },
+    { 34, 4 },
+    { 41, -1 },
+    { 58, 2 },
+    { 10, -2 },
+    { 12, -3 },
+    { 13, -1 },
+    { 14, -2 },
+    { 16, -2 },
+    { 31, -2 },
+    { 34, 2 },
+    { 36, -1 },
+    { 41, -2 },
+    { 42, -3 },
+    { 51, -2 },
+    { 53, -2 },
+    { 59, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 66, -2 },
+    { 12, -2 },
+    { 31, -2 },
+    { 36, -1 },
+    { 51, -1 },
+    { 64, -2 },
+    { 31, -1 },
+    { 2, -3 },
+    { 10, -1 },
+    { 11, 2 },
+    { 12, -3 },
+    { 14, -2 },
+    { 16, -2 },
+    { 10, -1 },
+    { 26, -1 },
+    { 5, -2 },
+    { 9, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 11, 2 },
+    { 4, 1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -1 },
+    { 2, -3 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 5, -5 },
+    { 9, -2 },
+    { 15, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 8, 1 },
+    { 9, -3 },
+    { 10, -1 },
+    { 12, 1 },
+    { 17, -3 },
+    { 19, -3 },
+    { 20, -3 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -1 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -1 },
+    { 5, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -2 },
+    { 17, -1 },
+    { 19, -1 },
+    { 26, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, 1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -2 },
+    { 22, -1 },
+    { 23, -2 },
+    { 25, -1 },
+    { 26, -3 },
+    { 27, -1 },
+    { 26, -1 },
+    { 11, 4 },
+    { 24, -1 },
+    { 2, 1 },
+    { 2, 2 },
+    { 4, 2 },
+    { 5, -1 },
+    { 2, 2 },
+    { 5, -6 },
+    { 17, -1 },
+    { 19, -1 },
+    { 2, 2 },
+    { 5, -2 },
+    { 8, 1 },
+    { 19, -1 },
+    { 11, 2 },
+    { 12, -1 },
+    { 16, -1 },
+    { 12, -1 },
+    { 16, -1 },
+    { 31, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -3 },
+    { 31, -2 },
+    { 36, -1 },
+    { 39, -1 },
+    { 42, -1 },
+    { 64, -2 },
+    { 11, 4 },
+    { 12, -2 },
+    { 14, -1 },
+    { 16, -2 },
+    { 4, 2 },
+    { 2, -3 },
+    { 10, -1 },
+    { 11, 4 },
+    { 12, -3 },
+    { 14, -2 },
+    { 16, -2 },
+    { 1, 2 },
+    { 2, 2 },
+    { 4, 3 },
+    { 8, 3 },
+    { 18, 1 },
+    { 29, 3 },
+    { 70, 3 },
+    { 4, 2 },
+    { 30, 5 },
+    { 1, 3 },
+    { 2, 3 },
+    { 4, 4 },
+    { 8, 4 },
+    { 70, 3 },
+    { 34, 2 },
+    { 2, -3 },
+    { 31, -2 },
+    { 36, -1 },
+    { 42, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 61, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -1 },
+    { 70, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 7, -1 },
+    { 27, -1 },
+    { 31, 1 },
+    { 32, -1 },
+    { 35, -1 },
+    { 37, -3 },
+    { 38, -1 },
+    { 41, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -2 },
+    { 47, -2 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -2 },
+    { 56, -1 },
+    { 26, -1 },
+    { 32, -1 },
+    { 41, -1 },
+    { 53, -1 },
+    { 59, -1 },
+    { 66, -1 },
+    { 2, -3 },
+    { 31, -2 },
+    { 36, -1 },
+    { 42, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 64, -1 },
+    { 70, -2 },
+    { 2, 1 },
+    { 26, -1 },
+    { 32, -1 },
+    { 41, -2 },
+    { 45, -1 },
+    { 47, -1 },
+    { 53, -1 },
+    { 59, -1 },
+    { 66, -2 },
+    { 2, 1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 26, -2 },
+    { 27, -1 },
+    { 32, -2 },
+    { 33, -1 },
+    { 35, -3 },
+    { 37, -4 },
+    { 38, -4 },
+    { 41, -1 },
+    { 43, -1 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -4 },
+    { 47, -2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -2 },
+    { 2, -3 },
+    { 31, -3 },
+    { 32, -1 },
+    { 34, 2 },
+    { 36, -1 },
+    { 41, -1 },
+    { 42, -2 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 61, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 66, -2 },
+    { 70, -2 },
+    { 4, -1 },
+    { 53, -1 },
+    { 5, 1 },
+    { 34, 3 },
+    { 35, 1 },
+    { 38, 2 },
+    { 42, -1 },
+    { 46, 1 },
+    { 50, 1 },
+    { 52, 1 },
+    { 53, -1 },
+    { 58, 3 },
+    { 5, -2 },
+    { 31, -1 },
+    { 36, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 48, -1 },
+    { 68, -1 },
+    { 5, -5 },
+    { 26, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -1 },
+    { 44, -1 },
+    { 46, -2 },
+    { 50, -2 },
+    { 68, -2 },
+    { 4, -1 },
+    { 5, -2 },
+    { 31, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 46, -1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 64, -1 },
+    { 31, -2 },
+    { 36, -2 },
+    { 48, -1 },
+    { 31, -1 },
+    { 36, -2 },
+    { 43, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 31, -1 },
+    { 48, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 70, 2 },
+    { 5, 1 },
+    { 31, -1 },
+    { 34, 4 },
+    { 35, 1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 46, 1 },
+    { 50, 1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 58, 2 },
+    { 31, -2 },
+    { 36, -2 },
+    { 39, -1 },
+    { 43, -1 },
+    { 48, -1 },
+    { 52, -1 },
+    { 32, -1 },
+    { 41, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 53, -1 },
+    { 67, -1 },
+    { 70, 1 },
+    { 2, 1 },
+    { 31, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 46, -2 },
+    { 47, -1 },
+    { 50, -2 },
+    { 54, -1 },
+    { 70, 2 },
+    { 2, -3 },
+    { 31, -2 },
+    { 36, -1 },
+    { 42, -3 },
+    { 43, -1 },
+    { 48, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -1 },
+    { 60, -1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 70, -1 },
+    { 31, -2 },
+    { 34, 2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 58, 1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 54, -1 },
+    { 2, 1 },
+    { 31, 1 },
+    { 55, 1 },
+    { 34, 1 },
+    { 58, 1 },
+    { 31, -2 },
+    { 34, 2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 5, -2 },
+    { 46, -1 },
+    { 2, -2 },
+    { 31, -2 },
+    { 42, -2 },
+    { 51, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 2, -3 },
+    { 44, -1 },
+    { 51, -2 },
+    { 52, -1 },
+    { 53, -1 },
+    { 60, -1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 5, -2 },
+    { 5, -2 },
+    { 6, -2 },
+    { 26, -2 },
+    { 27, -1 },
+    { 31, 1 },
+    { 32, -1 },
+    { 35, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 41, -1 },
+    { 44, -3 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 59, -1 },
+    { 60, -1 },
+    { 62, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 5, -2 },
+    { 6, -1 },
+    { 37, -1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 31, 1 },
+    { 37, -2 },
+    { 44, -2 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 53, -2 },
+    { 55, 1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 64, 1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -2 },
+    { 5, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 51, -1 },
+    { 53, -2 },
+    { 59, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 5, -2 },
+    { 37, -2 },
+    { 44, -2 },
+    { 46, -2 },
+    { 53, -2 },
+    { 55, 1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 48, -1 },
+};
+
 static const EpdFontData notosans_18_regular = {
     notosans_18_regularBitmaps,
     notosans_18_regularGlyphs,
@@ -7029,4 +7638,8 @@ static const EpdFontData notosans_18_regular = {
     41,
     -11,
     true,
+    notosans_18_regularKernLeftClasses,
+    notosans_18_regularKernRightClasses,
+    notosans_18_regularKernPairOffsets,
+    notosans_18_regularKernPairs,
 };
@@ -697,7 +697,7 @@ static const uint8_t notosans_8_regularBitmaps[10949] = {
 
 static const EpdGlyph notosans_8_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, // 
+    { 0, 0, 4, 0, 0, 0, 0 }, // 
     { 0, 0, 4, 0, 0, 0, 0 }, //  
     { 3, 13, 4, 1, 12, 5, 0 }, // !
     { 5, 5, 7, 1, 12, 4, 5 }, // "
@@ -1546,6 +1546,329 @@ static const EpdUnicodeInterval notosans_8_regularIntervals[] = {
     { 0x2212, 0x2212, 0x341 },
 };
 
+static const uint8_t notosans_8_regularKernLeftClasses[834] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 0, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 0, 0, 7, 8, 7, 0, 0, 0, 0, 0, 9, 0,
+    0, 7, 10, 7, 0, 0, 11, 0, 12, 12, 0, 13, 0, 3, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 16, 0, 0, 0, 17, 17, 0, 17, 0, 3, 0, 0,
+    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+    19, 6, 6, 6, 6, 6, 6, 8, 0, 8, 8, 8, 8, 0, 0, 0,
+    0, 7, 0, 7, 7, 7, 7, 7, 0, 7, 0, 0, 0, 0, 13, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+    20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0,
+    17, 6, 0, 6, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    22, 7, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 20, 0, 0, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 9, 0, 9, 22,
+    9, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 7,
+    0, 7, 0, 8, 0, 0, 16, 0, 16, 0, 16, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 0, 11, 24, 11, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 12, 17, 13, 17, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 25, 25, 26, 27, 0, 0, 0, 0, 0, 28, 28, 26, 29, 0, 30,
+    0, 31, 0, 0, 27, 32, 25, 29, 0, 0, 0, 29, 0, 0, 0, 33,
+    0, 34, 0, 27, 30, 35, 29, 32, 0, 0, 32, 28, 0, 28, 33, 33,
+    0, 36, 37, 0, 38, 39, 36, 0, 0, 0, 0, 0, 0, 0, 0, 36,
+    0, 36, 0, 38, 40, 36, 0, 39, 0, 0, 39, 41, 0, 41, 36, 36,
+    0, 36, 36, 42, 38, 0, 0, 0, 0, 0, 41, 41, 42, 0, 0, 40,
+    0, 33, 7, 43, 41, 0, 0, 31, 44, 31, 44, 0, 0, 0, 0, 7,
+    0, 0, 36, 33, 36, 30, 7, 30, 7, 40, 40, 33, 36, 33, 36, 33,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 39, 43, 41, 34,
+    36, 45, 46, 47, 0, 0, 0, 48, 0, 7, 0, 48, 0, 29, 0, 29,
+    0, 29, 0, 32, 39, 47, 46, 0, 0, 0, 36, 0, 0, 45, 46, 49,
+    7, 49, 7, 48, 0, 32, 39, 32, 39, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 29, 0, 0, 0, 32, 39, 0, 0, 32, 39, 0, 0, 32, 39,
+    0, 31, 36, 31, 36, 25, 0, 25, 0, 33, 36, 33, 36, 29, 0, 7,
+    0, 0, 0, 0, 0, 0, 0, 33, 36, 33, 36, 33, 36, 33, 36, 30,
+    40, 30, 40, 30, 40, 0, 0, 45, 46, 0, 0, 47, 0, 48, 0, 29,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 1, 1, 4, 0, 1, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint8_t notosans_8_regularKernRightClasses[834] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 3, 0, 0, 4, 5,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 0, 7, 0, 8, 0, 0, 0, 8, 0, 0, 9, 0, 0, 0,
+    0, 8, 0, 8, 0, 0, 10, 0, 11, 11, 0, 12, 0, 0, 0, 3,
+    0, 0, 0, 13, 0, 13, 13, 13, 0, 14, 0, 0, 15, 0, 0, 16,
+    16, 13, 16, 13, 16, 14, 0, 16, 0, 0, 0, 0, 16, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 18, 8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 8, 8, 8, 8, 8, 0, 8, 0, 0, 0, 0, 12, 0,
+    0, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0,
+    0, 0, 0, 13, 13, 13, 13, 13, 0, 13, 16, 16, 16, 16, 0, 0,
+    0, 7, 13, 7, 13, 7, 13, 8, 13, 8, 13, 8, 13, 8, 13, 0,
+    13, 0, 13, 0, 13, 0, 13, 0, 13, 0, 13, 0, 13, 8, 14, 8,
+    14, 8, 14, 8, 14, 0, 0, 0, 19, 0, 20, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 16, 0, 16, 0, 0, 0, 0, 16, 8, 13, 8,
+    13, 8, 13, 8, 13, 0, 16, 0, 16, 0, 0, 0, 14, 0, 0, 0,
+    14, 0, 0, 10, 0, 10, 0, 10, 0, 0, 16, 0, 16, 0, 16, 0,
+    16, 0, 16, 0, 16, 11, 0, 12, 0, 12, 0, 16, 0, 16, 0, 16,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 21, 0, 22, 0, 0, 0, 23, 24, 0, 21, 0, 0, 25,
+    0, 26, 0, 0, 0, 27, 0, 28, 0, 0, 0, 0, 24, 0, 0, 22,
+    0, 0, 22, 21, 25, 29, 28, 0, 30, 0, 0, 21, 0, 0, 0, 0,
+    0, 31, 22, 0, 0, 32, 33, 0, 0, 0, 0, 0, 34, 0, 0, 33,
+    0, 0, 33, 35, 36, 33, 0, 0, 37, 0, 0, 35, 0, 0, 0, 0,
+    33, 33, 33, 38, 0, 33, 0, 0, 0, 39, 34, 0, 38, 0, 0, 36,
+    0, 8, 0, 0, 0, 0, 40, 26, 32, 0, 40, 0, 0, 0, 40, 0,
+    0, 30, 0, 8, 31, 41, 0, 41, 0, 8, 31, 8, 31, 8, 31, 8,
+    0, 8, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 38, 0,
+    40, 0, 40, 0, 0, 0, 40, 28, 0, 0, 0, 0, 40, 0, 40, 0,
+    38, 42, 35, 0, 40, 0, 40, 0, 40, 8, 31, 8, 31, 21, 35, 41,
+    40, 41, 40, 28, 0, 42, 35, 30, 37, 30, 37, 0, 40, 43, 44, 43,
+    44, 0, 28, 0, 0, 40, 45, 32, 0, 40, 0, 40, 30, 37, 0, 40,
+    0, 26, 44, 26, 44, 26, 44, 0, 31, 0, 44, 0, 44, 28, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8, 31, 8, 31, 8, 31, 0, 0, 25,
+    36, 25, 36, 25, 36, 30, 37, 0, 40, 0, 0, 0, 0, 28, 0, 28,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 5, 5, 0, 0, 46, 2, 4, 0, 46, 2, 4,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const uint16_t notosans_8_regularKernPairOffsets[50] = {
+    0, 10, 11, 15, 28, 31, 36, 37, 38, 39, 41, 48, 50, 55, 56, 58,
+    60, 62, 66, 69, 70, 75, 81, 83, 88, 89, 93, 100, 103, 105, 117, 126,
+    129, 131, 138, 142, 144, 145, 148, 150, 154, 160, 163, 166, 168, 184, 186, 192,
+    194, 201,
+};
+
+static const EpdKernPair notosans_8_regularKernPairs[] = {
+    { 7, -1 },
+    { 13, -1 },
+    { 18, -1 },
+    { 20, 1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 45, -1 },
+    { 10, -1 },
+    { 9, 2 },
+    { 15, 1 },
+    { 23, 2 },
+    { 39, 1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 21, -1 },
+    { 23, 1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 10, -1 },
+    { 21, -1 },
+    { 42, -1 },
+    { 2, -1 },
+    { 9, 1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 4, -1 },
+    { 9, 1 },
+    { 2, -1 },
+    { 4, -2 },
+    { 7, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 4, -1 },
+    { 7, -1 },
+    { 4, -1 },
+    { 7, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 9, 2 },
+    { 2, 1 },
+    { 3, 1 },
+    { 2, 1 },
+    { 4, -3 },
+    { 2, 1 },
+    { 4, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 21, -1 },
+    { 42, -1 },
+    { 9, 2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 3, 1 },
+    { 2, -1 },
+    { 9, 2 },
+    { 10, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 1, 1 },
+    { 2, 1 },
+    { 3, 2 },
+    { 6, 2 },
+    { 19, 1 },
+    { 46, 1 },
+    { 3, 1 },
+    { 20, 2 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, 2 },
+    { 6, 2 },
+    { 46, 1 },
+    { 23, 1 },
+    { 2, -1 },
+    { 21, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 2, -2 },
+    { 21, -1 },
+    { 46, -1 },
+    { 29, -1 },
+    { 43, -1 },
+    { 4, -1 },
+    { 17, -1 },
+    { 22, -1 },
+    { 24, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 31, -1 },
+    { 32, -2 },
+    { 33, -1 },
+    { 34, -1 },
+    { 38, 1 },
+    { 45, -1 },
+    { 2, -1 },
+    { 21, -1 },
+    { 23, 1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 46, -1 },
+    { 23, 2 },
+    { 27, 1 },
+    { 39, 1 },
+    { 4, -1 },
+    { 25, -1 },
+    { 4, -2 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 45, -1 },
+    { 4, -1 },
+    { 21, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 21, -1 },
+    { 25, -1 },
+    { 25, -1 },
+    { 4, -1 },
+    { 32, -1 },
+    { 46, 1 },
+    { 23, 2 },
+    { 39, 1 },
+    { 4, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 46, 1 },
+    { 2, -1 },
+    { 21, -1 },
+    { 30, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 21, -1 },
+    { 23, 1 },
+    { 36, -1 },
+    { 2, -1 },
+    { 21, -1 },
+    { 30, -1 },
+    { 2, -1 },
+    { 35, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 17, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 40, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 4, -1 },
+    { 32, -1 },
+    { 4, -1 },
+    { 26, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 45, -1 },
+    { 37, -1 },
+    { 43, -1 },
+    { 4, -1 },
+    { 26, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 44, -1 },
+    { 45, -1 },
+};
+
 static const EpdFontData notosans_8_regular = {
     notosans_8_regularBitmaps,
     notosans_8_regularGlyphs,
@@ -1555,4 +1878,8 @@ static const EpdFontData notosans_8_regular = {
     18,
     -5,
     false,
+    notosans_8_regularKernLeftClasses,
+    notosans_8_regularKernRightClasses,
+    notosans_8_regularKernPairOffsets,
+    notosans_8_regularKernPairs,
 };
@@ -3462,4 +3462,8 @@ static const EpdFontData opendyslexic_10_bold = {
     28,
     -11,
     true,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
 };
@@ -4020,6 +4020,8203 @@ static const EpdUnicodeInterval opendyslexic_10_bolditalicIntervals[] = {
     { 0x2264, 0x2265, 0x2BF },
 };
 
+static const uint8_t opendyslexic_10_bolditalicKernLeftClasses[705] = {
+    0, 1, 2, 0, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 29, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 0, 48, 0, 0,
+    0, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 0, 76, 0, 0,
+    77, 78, 79, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0,
+    82, 0, 0, 82, 82, 83, 84, 0, 0, 0, 0, 85, 86, 87, 88, 0,
+    0, 0, 89, 0, 0, 89, 0, 90, 91, 0, 91, 92, 0, 93, 94, 0,
+    0, 0, 0, 95, 96, 97, 98, 0, 0, 0, 0, 99, 100, 101, 102, 103,
+    0, 0, 0, 0, 0, 104, 0, 105, 0, 0, 0, 106, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 87, 107, 87, 108, 0, 109, 87, 110, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111,
+    112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 113, 114, 115, 0, 116, 117, 115, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t opendyslexic_10_bolditalicKernRightClasses[705] = {
+    0, 1, 2, 0, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 23, 25, 26, 27, 28, 29, 30, 31, 32, 25, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 0, 47, 0, 0,
+    0, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+    63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 0, 75, 0, 0,
+    76, 77, 78, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0,
+    81, 0, 0, 81, 81, 82, 83, 0, 0, 0, 0, 84, 85, 0, 86, 0,
+    0, 0, 87, 0, 0, 87, 0, 88, 89, 0, 90, 89, 0, 91, 92, 0,
+    0, 0, 0, 93, 94, 95, 96, 0, 0, 0, 0, 97, 98, 99, 100, 101,
+    0, 0, 0, 0, 0, 102, 0, 103, 0, 0, 0, 104, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 105, 0, 106, 0, 107, 0, 108, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87,
+    109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 110, 111, 112, 0, 113, 114, 112, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t opendyslexic_10_bolditalicKernPairOffsets[118] = {
+    0, 23, 87, 176, 215, 247, 269, 297, 337, 349, 365, 410, 450, 501, 544, 583,
+    633, 683, 750, 797, 842, 926, 1016, 1104, 1201, 1292, 1378, 1475, 1568, 1658, 1742, 1842,
+    1930, 2019, 2116, 2208, 2300, 2399, 2485, 2573, 2671, 2767, 2865, 2962, 3052, 3150, 3242, 3273,
+    3296, 3394, 3484, 3572, 3667, 3754, 3849, 3935, 4031, 4126, 4220, 4317, 4407, 4499, 4595, 4685,
+    4774, 4871, 4964, 5061, 5145, 5237, 5329, 5420, 5507, 5600, 5691, 5720, 5750, 5840, 5922, 5968,
+    6026, 6116, 6189, 6260, 6348, 6429, 6509, 6512, 6593, 6677, 6760, 6845, 6930, 6973, 7021, 7102,
+    7183, 7261, 7343, 7373, 7388, 7428, 7478, 7530, 7609, 7690, 7765, 7796, 7831, 7845, 7889, 7953,
+    7979, 8001, 8020, 8046, 8069, 8087,
+};
+
+static const EpdKernPair opendyslexic_10_bolditalicKernPairs[] = {
+    { 1, 1 },
+    { 10, 1 },
+    { 21, -1 },
+    { 22, 1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 36, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 49, -1 },
+    { 53, -1 },
+    { 57, -3 },
+    { 63, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 76, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 5, -5 },
+    { 6, -3 },
+    { 7, -2 },
+    { 22, -5 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -1 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -3 },
+    { 47, -2 },
+    { 48, -4 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -2 },
+    { 91, -2 },
+    { 92, -3 },
+    { 101, -3 },
+    { 110, -2 },
+    { 111, -2 },
+    { 113, -2 },
+    { 114, -2 },
+    { 3, -5 },
+    { 4, -1 },
+    { 8, -3 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -6 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -5 },
+    { 44, -6 },
+    { 45, -3 },
+    { 48, -3 },
+    { 49, -4 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -3 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -6 },
+    { 73, -4 },
+    { 76, -6 },
+    { 77, -3 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -6 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -3 },
+    { 1, 1 },
+    { 3, -1 },
+    { 18, -2 },
+    { 21, -4 },
+    { 25, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -5 },
+    { 40, -1 },
+    { 41, -4 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -5 },
+    { 49, -1 },
+    { 53, -2 },
+    { 57, -4 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -3 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -1 },
+    { 76, -3 },
+    { 80, -2 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 5, -3 },
+    { 6, -1 },
+    { 22, -3 },
+    { 30, -5 },
+    { 31, -1 },
+    { 33, -1 },
+    { 38, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 48, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 57, -3 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 68, -1 },
+    { 71, -2 },
+    { 73, -2 },
+    { 74, -3 },
+    { 92, -1 },
+    { 101, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, 1 },
+    { 15, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 1 },
+    { 44, 2 },
+    { 48, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 2, 2 },
+    { 6, 1 },
+    { 7, -1 },
+    { 17, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 2 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 43, 1 },
+    { 45, 1 },
+    { 51, 1 },
+    { 54, 1 },
+    { 67, 1 },
+    { 74, 1 },
+    { 91, 1 },
+    { 101, 2 },
+    { 3, -2 },
+    { 15, -1 },
+    { 21, -4 },
+    { 22, -2 },
+    { 30, -8 },
+    { 31, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -1 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 57, -3 },
+    { 60, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 71, -3 },
+    { 72, -1 },
+    { 73, -2 },
+    { 76, -2 },
+    { 77, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -4 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 1, 2 },
+    { 9, 1 },
+    { 10, 2 },
+    { 22, 1 },
+    { 39, -5 },
+    { 53, -1 },
+    { 56, 1 },
+    { 63, -1 },
+    { 67, -2 },
+    { 69, -3 },
+    { 70, -1 },
+    { 72, -2 },
+    { 1, 2 },
+    { 9, 1 },
+    { 10, 2 },
+    { 22, 2 },
+    { 39, -5 },
+    { 53, -1 },
+    { 55, 1 },
+    { 58, 1 },
+    { 61, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, -2 },
+    { 69, -3 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, 1 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 25, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 30, -3 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -4 },
+    { 45, -1 },
+    { 49, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -4 },
+    { 58, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 66, -2 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, 1 },
+    { 76, -3 },
+    { 80, -3 },
+    { 82, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 101, 2 },
+    { 1, 1 },
+    { 3, -1 },
+    { 8, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -2 },
+    { 16, 1 },
+    { 18, -1 },
+    { 21, -4 },
+    { 22, 1 },
+    { 24, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 39, -4 },
+    { 40, -1 },
+    { 41, -4 },
+    { 42, -3 },
+    { 44, -5 },
+    { 49, -1 },
+    { 53, -1 },
+    { 57, -3 },
+    { 62, -1 },
+    { 63, -1 },
+    { 67, -3 },
+    { 68, -1 },
+    { 69, -4 },
+    { 70, -2 },
+    { 72, -4 },
+    { 76, -3 },
+    { 83, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 101, 2 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 109, -1 },
+    { 1, 1 },
+    { 3, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 21, -4 },
+    { 22, 1 },
+    { 24, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -2 },
+    { 44, -3 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 55, 1 },
+    { 57, -3 },
+    { 58, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, 1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, 1 },
+    { 73, 1 },
+    { 76, -3 },
+    { 77, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, 1 },
+    { 92, 1 },
+    { 96, -1 },
+    { 101, 2 },
+    { 102, -1 },
+    { 103, -1 },
+    { 109, -1 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 49, -1 },
+    { 57, -4 },
+    { 60, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 71, -2 },
+    { 73, -1 },
+    { 74, 1 },
+    { 76, -3 },
+    { 80, -2 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 101, 2 },
+    { 1, 1 },
+    { 3, -2 },
+    { 6, 1 },
+    { 21, -4 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -4 },
+    { 49, -1 },
+    { 53, -2 },
+    { 57, -4 },
+    { 60, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, 1 },
+    { 76, -3 },
+    { 80, -2 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 101, 2 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 49, -1 },
+    { 53, -2 },
+    { 57, -4 },
+    { 60, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -3 },
+    { 68, -1 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -1 },
+    { 74, 1 },
+    { 76, -3 },
+    { 80, -3 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 101, 2 },
+    { 104, -1 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -3 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 49, -1 },
+    { 53, -2 },
+    { 57, -4 },
+    { 60, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -1 },
+    { 74, 1 },
+    { 76, -2 },
+    { 80, -3 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 101, 2 },
+    { 104, -1 },
+    { 3, -3 },
+    { 18, 1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -2 },
+    { 47, 1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -3 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -2 },
+    { 75, 1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 79, 1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 91, 1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 109, -1 },
+    { 1, 1 },
+    { 3, -1 },
+    { 21, -4 },
+    { 24, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -4 },
+    { 49, -1 },
+    { 53, -1 },
+    { 57, -4 },
+    { 60, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 76, -3 },
+    { 80, -2 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 101, 2 },
+    { 104, -1 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 25, -1 },
+    { 26, -1 },
+    { 29, -1 },
+    { 30, -3 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -1 },
+    { 49, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -4 },
+    { 58, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 66, -2 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, 1 },
+    { 76, -3 },
+    { 80, -3 },
+    { 82, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 101, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -5 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 48, -6 },
+    { 49, -2 },
+    { 50, -6 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -3 },
+    { 54, -6 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -6 },
+    { 65, -4 },
+    { 66, -6 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -5 },
+    { 76, -3 },
+    { 77, -6 },
+    { 78, -1 },
+    { 80, -6 },
+    { 81, -4 },
+    { 82, -4 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -4 },
+    { 95, -6 },
+    { 96, -6 },
+    { 101, -1 },
+    { 102, -3 },
+    { 103, -5 },
+    { 104, -2 },
+    { 108, -1 },
+    { 109, -5 },
+    { 1, 1 },
+    { 3, -2 },
+    { 5, -3 },
+    { 8, -2 },
+    { 9, 1 },
+    { 10, 2 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 18, -2 },
+    { 20, 1 },
+    { 21, -4 },
+    { 22, 1 },
+    { 23, -1 },
+    { 24, -3 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -3 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -5 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -3 },
+    { 35, -1 },
+    { 36, -3 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -6 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -1 },
+    { 44, -6 },
+    { 45, -1 },
+    { 46, 1 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -4 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -1 },
+    { 72, -5 },
+    { 73, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -1 },
+    { 83, -3 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -3 },
+    { 88, -1 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, 1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 110, -1 },
+    { 112, 1 },
+    { 113, -1 },
+    { 2, 1 },
+    { 3, -4 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -6 },
+    { 45, -3 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -4 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, 1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -2 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 47, 1 },
+    { 48, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -6 },
+    { 68, -3 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -3 },
+    { 72, -6 },
+    { 73, -3 },
+    { 74, 1 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -3 },
+    { 110, 1 },
+    { 113, 1 },
+    { 2, 3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 6, 1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -7 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -3 },
+    { 47, 1 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, 1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -2 },
+    { 80, -6 },
+    { 81, -3 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -2 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 108, -1 },
+    { 109, -2 },
+    { 111, 1 },
+    { 114, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -3 },
+    { 11, -2 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -4 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -4 },
+    { 35, -2 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, 1 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -5 },
+    { 68, -4 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -2 },
+    { 72, -6 },
+    { 73, -2 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -4 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -4 },
+    { 109, -4 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -6 },
+    { 4, -2 },
+    { 7, 1 },
+    { 8, -1 },
+    { 9, -7 },
+    { 10, -6 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -5 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -10 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -4 },
+    { 47, 1 },
+    { 48, -4 },
+    { 49, -2 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -5 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -5 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -5 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -4 },
+    { 78, -1 },
+    { 80, -7 },
+    { 81, -5 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -2 },
+    { 93, -2 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 101, -1 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -3 },
+    { 108, -2 },
+    { 109, -4 },
+    { 110, 1 },
+    { 112, -4 },
+    { 1, -1 },
+    { 2, 1 },
+    { 3, -4 },
+    { 5, -2 },
+    { 6, 1 },
+    { 8, -1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -3 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, 1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -4 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -4 },
+    { 74, 1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -2 },
+    { 2, 3 },
+    { 3, -3 },
+    { 6, 1 },
+    { 7, 1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, 1 },
+    { 47, 1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, 1 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -3 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 109, -3 },
+    { 110, 1 },
+    { 111, 1 },
+    { 113, 1 },
+    { 114, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, 1 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -3 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 109, -3 },
+    { 1, -1 },
+    { 2, 4 },
+    { 3, -5 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 2 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 47, 2 },
+    { 48, -4 },
+    { 49, -2 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -4 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, 1 },
+    { 75, 2 },
+    { 76, -4 },
+    { 77, -4 },
+    { 78, -1 },
+    { 80, -5 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -4 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -4 },
+    { 110, 2 },
+    { 111, 1 },
+    { 113, 2 },
+    { 114, 1 },
+    { 3, -4 },
+    { 4, -3 },
+    { 5, -2 },
+    { 6, 1 },
+    { 8, -6 },
+    { 11, -3 },
+    { 14, -1 },
+    { 15, -5 },
+    { 17, -3 },
+    { 18, -4 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -7 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -7 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -6 },
+    { 35, -2 },
+    { 36, -7 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -2 },
+    { 44, -5 },
+    { 45, -2 },
+    { 46, 2 },
+    { 48, -5 },
+    { 49, -5 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -4 },
+    { 54, -5 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -6 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -6 },
+    { 68, -5 },
+    { 69, -7 },
+    { 70, -5 },
+    { 71, -2 },
+    { 72, -8 },
+    { 73, -2 },
+    { 76, -6 },
+    { 77, -5 },
+    { 79, -2 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -7 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -6 },
+    { 88, -2 },
+    { 89, -5 },
+    { 90, -5 },
+    { 93, -5 },
+    { 94, -5 },
+    { 95, -5 },
+    { 96, -5 },
+    { 101, -1 },
+    { 102, -6 },
+    { 103, -5 },
+    { 104, -5 },
+    { 109, -6 },
+    { 112, 1 },
+    { 2, -3 },
+    { 3, -3 },
+    { 5, -8 },
+    { 6, 1 },
+    { 8, -8 },
+    { 11, -1 },
+    { 15, -1 },
+    { 18, -4 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -7 },
+    { 42, -5 },
+    { 43, -2 },
+    { 44, -8 },
+    { 45, -2 },
+    { 46, 1 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -4 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -5 },
+    { 68, -3 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -6 },
+    { 73, -2 },
+    { 76, -6 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -3 },
+    { 109, -2 },
+    { 110, -4 },
+    { 111, -4 },
+    { 113, -4 },
+    { 114, -4 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 47, 1 },
+    { 48, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, 1 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -3 },
+    { 110, 1 },
+    { 111, 1 },
+    { 113, 1 },
+    { 114, 1 },
+    { 2, 3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 6, 1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, 1 },
+    { 47, 1 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, 1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -2 },
+    { 80, -6 },
+    { 81, -3 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -2 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 108, -1 },
+    { 109, -2 },
+    { 111, 2 },
+    { 114, 2 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -7 },
+    { 22, -5 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -10 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -6 },
+    { 47, 1 },
+    { 48, -4 },
+    { 49, -3 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -2 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -5 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -4 },
+    { 76, -4 },
+    { 77, -4 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -6 },
+    { 81, -5 },
+    { 82, -8 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -3 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 101, -1 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -2 },
+    { 108, -1 },
+    { 109, -4 },
+    { 111, 1 },
+    { 112, -5 },
+    { 113, 1 },
+    { 1, -2 },
+    { 2, 2 },
+    { 3, -6 },
+    { 4, -2 },
+    { 8, -2 },
+    { 11, -2 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -3 },
+    { 15, -3 },
+    { 16, -2 },
+    { 17, -2 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, -8 },
+    { 22, -3 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -5 },
+    { 30, -3 },
+    { 31, -5 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -6 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -5 },
+    { 44, -7 },
+    { 45, -5 },
+    { 46, 2 },
+    { 47, 1 },
+    { 48, -4 },
+    { 49, -5 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -5 },
+    { 59, -4 },
+    { 60, -5 },
+    { 61, -5 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -6 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -5 },
+    { 75, 1 },
+    { 76, -6 },
+    { 77, -4 },
+    { 78, -2 },
+    { 79, -3 },
+    { 80, -2 },
+    { 81, -3 },
+    { 82, -4 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -5 },
+    { 86, -5 },
+    { 87, -4 },
+    { 88, -1 },
+    { 89, -5 },
+    { 90, -5 },
+    { 91, -2 },
+    { 92, -2 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 101, -1 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -4 },
+    { 108, -2 },
+    { 109, -4 },
+    { 111, 1 },
+    { 112, 2 },
+    { 114, 1 },
+    { 2, 1 },
+    { 3, -3 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -2 },
+    { 11, -2 },
+    { 15, -2 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -5 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -4 },
+    { 35, -2 },
+    { 36, -5 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -5 },
+    { 40, -4 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -3 },
+    { 44, -6 },
+    { 45, -2 },
+    { 46, 1 },
+    { 48, -4 },
+    { 49, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -5 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 76, -6 },
+    { 77, -4 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -5 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -2 },
+    { 89, -4 },
+    { 90, -4 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 101, 1 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -4 },
+    { 109, -4 },
+    { 3, -5 },
+    { 5, -3 },
+    { 6, 1 },
+    { 8, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -4 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -3 },
+    { 46, 1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -4 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, 1 },
+    { 76, -6 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -6 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -2 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 9, -6 },
+    { 10, -5 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -7 },
+    { 16, -1 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -6 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -9 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -4 },
+    { 47, 1 },
+    { 48, -8 },
+    { 49, -2 },
+    { 50, -8 },
+    { 51, -8 },
+    { 52, -8 },
+    { 53, -4 },
+    { 54, -8 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -8 },
+    { 61, -8 },
+    { 62, -8 },
+    { 63, -9 },
+    { 64, -8 },
+    { 65, -8 },
+    { 66, -8 },
+    { 67, -6 },
+    { 68, -8 },
+    { 69, -8 },
+    { 70, -8 },
+    { 71, -8 },
+    { 72, -8 },
+    { 73, -8 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -7 },
+    { 78, -1 },
+    { 80, -8 },
+    { 81, -6 },
+    { 82, -6 },
+    { 83, -4 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -5 },
+    { 95, -8 },
+    { 96, -8 },
+    { 101, -4 },
+    { 102, -4 },
+    { 103, -8 },
+    { 104, -3 },
+    { 108, -6 },
+    { 109, -8 },
+    { 110, 1 },
+    { 112, -3 },
+    { 113, 1 },
+    { 2, 3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 47, 1 },
+    { 48, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, 1 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -3 },
+    { 80, -5 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -3 },
+    { 110, 1 },
+    { 111, 1 },
+    { 113, 1 },
+    { 114, 1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -6 },
+    { 4, -2 },
+    { 7, 2 },
+    { 8, -2 },
+    { 11, -3 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -5 },
+    { 16, -2 },
+    { 17, -3 },
+    { 18, -1 },
+    { 19, -3 },
+    { 20, -2 },
+    { 21, -4 },
+    { 22, -7 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -9 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -5 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -4 },
+    { 47, 1 },
+    { 48, -6 },
+    { 49, -2 },
+    { 50, -6 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -4 },
+    { 54, -6 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -4 },
+    { 59, -3 },
+    { 60, -6 },
+    { 61, -5 },
+    { 62, -6 },
+    { 63, -6 },
+    { 64, -6 },
+    { 65, -5 },
+    { 66, -7 },
+    { 67, -5 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -4 },
+    { 73, -6 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -6 },
+    { 78, -3 },
+    { 80, -8 },
+    { 81, -7 },
+    { 82, -7 },
+    { 83, -5 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -5 },
+    { 88, -5 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, -2 },
+    { 94, -5 },
+    { 95, -6 },
+    { 96, -6 },
+    { 101, -3 },
+    { 102, -4 },
+    { 103, -6 },
+    { 104, -3 },
+    { 108, -3 },
+    { 109, -6 },
+    { 110, 1 },
+    { 112, -2 },
+    { 113, 1 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -6 },
+    { 4, -2 },
+    { 7, 2 },
+    { 8, -1 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -2 },
+    { 22, -5 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -8 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -3 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 47, 1 },
+    { 48, -5 },
+    { 49, -2 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -4 },
+    { 54, -5 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -4 },
+    { 59, -3 },
+    { 60, -5 },
+    { 61, -5 },
+    { 62, -5 },
+    { 63, -5 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -6 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -6 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -5 },
+    { 78, -2 },
+    { 80, -7 },
+    { 81, -5 },
+    { 82, -5 },
+    { 83, -5 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, -2 },
+    { 94, -5 },
+    { 95, -5 },
+    { 96, -5 },
+    { 101, -2 },
+    { 102, -4 },
+    { 103, -5 },
+    { 104, -3 },
+    { 108, -2 },
+    { 109, -5 },
+    { 110, 1 },
+    { 112, -1 },
+    { 113, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -2 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, 1 },
+    { 8, -4 },
+    { 11, -3 },
+    { 14, -1 },
+    { 15, -4 },
+    { 17, -3 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -6 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -6 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -5 },
+    { 35, -2 },
+    { 36, -6 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, 1 },
+    { 48, -4 },
+    { 49, -3 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -4 },
+    { 54, -5 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -5 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -6 },
+    { 68, -5 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -2 },
+    { 72, -7 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -5 },
+    { 79, -2 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -6 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -5 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -5 },
+    { 101, -1 },
+    { 102, -4 },
+    { 103, -5 },
+    { 104, -4 },
+    { 109, -5 },
+    { 112, 1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -7 },
+    { 4, -3 },
+    { 7, 2 },
+    { 8, -3 },
+    { 11, -4 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -7 },
+    { 16, -2 },
+    { 17, -4 },
+    { 18, -1 },
+    { 19, -4 },
+    { 20, -3 },
+    { 21, -4 },
+    { 22, -6 },
+    { 23, -2 },
+    { 24, -6 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -9 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -6 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -4 },
+    { 48, -7 },
+    { 49, -2 },
+    { 50, -7 },
+    { 51, -7 },
+    { 52, -7 },
+    { 53, -5 },
+    { 54, -7 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -6 },
+    { 58, -4 },
+    { 59, -3 },
+    { 60, -7 },
+    { 61, -6 },
+    { 62, -7 },
+    { 63, -7 },
+    { 64, -7 },
+    { 65, -6 },
+    { 66, -8 },
+    { 67, -6 },
+    { 68, -5 },
+    { 69, -5 },
+    { 70, -5 },
+    { 71, -7 },
+    { 72, -5 },
+    { 73, -7 },
+    { 74, -1 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -7 },
+    { 78, -3 },
+    { 79, -1 },
+    { 80, -8 },
+    { 81, -6 },
+    { 82, -6 },
+    { 83, -6 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -6 },
+    { 88, -6 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -3 },
+    { 93, -2 },
+    { 94, -5 },
+    { 95, -7 },
+    { 96, -7 },
+    { 101, -4 },
+    { 102, -4 },
+    { 103, -7 },
+    { 104, -3 },
+    { 108, -4 },
+    { 109, -7 },
+    { 110, 1 },
+    { 112, -2 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -2 },
+    { 7, 1 },
+    { 8, -2 },
+    { 11, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -3 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -4 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, 1 },
+    { 47, 1 },
+    { 48, -4 },
+    { 49, -2 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -6 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -5 },
+    { 73, -3 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -4 },
+    { 78, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -5 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -4 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -4 },
+    { 110, 1 },
+    { 113, 1 },
+    { 2, 2 },
+    { 15, -2 },
+    { 18, 1 },
+    { 22, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 30, 2 },
+    { 34, 1 },
+    { 36, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 110, 1 },
+    { 113, 1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 3 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 43, 1 },
+    { 45, 1 },
+    { 46, 1 },
+    { 66, 1 },
+    { 101, 1 },
+    { 112, 1 },
+    { 1, 1 },
+    { 2, 1 },
+    { 3, -3 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -2 },
+    { 44, -6 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -3 },
+    { 49, -4 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -6 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 2 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 109, -3 },
+    { 1, 1 },
+    { 2, 1 },
+    { 3, -4 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -5 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -7 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -3 },
+    { 109, -2 },
+    { 2, 1 },
+    { 3, -3 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 15, -5 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -4 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -4 },
+    { 35, -2 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -8 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -3 },
+    { 44, -6 },
+    { 45, -2 },
+    { 47, -2 },
+    { 48, -4 },
+    { 49, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -6 },
+    { 77, -4 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 100, 2 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -3 },
+    { 109, -4 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 7, 1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -4 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 47, 1 },
+    { 48, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 75, 1 },
+    { 76, -4 },
+    { 77, -3 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, 4 },
+    { 98, 1 },
+    { 99, 4 },
+    { 100, 3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -2 },
+    { 105, 2 },
+    { 106, 5 },
+    { 107, 1 },
+    { 109, -3 },
+    { 110, 1 },
+    { 113, 1 },
+    { 2, 1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 15, -1 },
+    { 18, -4 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -3 },
+    { 44, -7 },
+    { 45, -3 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 7, 1 },
+    { 9, -3 },
+    { 10, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -3 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 48, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -4 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, -1 },
+    { 80, -5 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, 3 },
+    { 98, 1 },
+    { 99, 3 },
+    { 100, 3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -2 },
+    { 105, 2 },
+    { 106, 4 },
+    { 109, -3 },
+    { 111, 1 },
+    { 112, -1 },
+    { 114, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 9, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -4 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -8 },
+    { 40, -2 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -5 },
+    { 45, -3 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 100, 3 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 107, 1 },
+    { 108, -1 },
+    { 109, -2 },
+    { 111, 1 },
+    { 114, 1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -4 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -2 },
+    { 44, -7 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -6 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 109, -3 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -2 },
+    { 44, -4 },
+    { 45, -2 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, 2 },
+    { 98, 1 },
+    { 99, 4 },
+    { 100, 3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 105, 2 },
+    { 106, 4 },
+    { 107, 1 },
+    { 109, -3 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 19, -1 },
+    { 21, -3 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -4 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 47, 1 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -1 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, 2 },
+    { 98, 1 },
+    { 99, 4 },
+    { 100, 3 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 105, 3 },
+    { 106, 5 },
+    { 107, 1 },
+    { 109, -2 },
+    { 110, 1 },
+    { 111, 1 },
+    { 113, 1 },
+    { 114, 1 },
+    { 1, 1 },
+    { 3, -4 },
+    { 4, -3 },
+    { 5, -2 },
+    { 8, -5 },
+    { 11, -3 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, -5 },
+    { 16, 1 },
+    { 17, -3 },
+    { 18, -4 },
+    { 19, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -6 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -6 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -6 },
+    { 35, -2 },
+    { 36, -6 },
+    { 37, -2 },
+    { 38, -4 },
+    { 39, -8 },
+    { 40, -5 },
+    { 41, -8 },
+    { 42, -6 },
+    { 43, -2 },
+    { 44, -8 },
+    { 45, -2 },
+    { 46, 1 },
+    { 47, -1 },
+    { 48, -5 },
+    { 49, -5 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -4 },
+    { 54, -5 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -5 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -6 },
+    { 68, -5 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -2 },
+    { 72, -6 },
+    { 73, -2 },
+    { 76, -6 },
+    { 77, -5 },
+    { 79, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -6 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -6 },
+    { 88, -2 },
+    { 89, -5 },
+    { 90, -5 },
+    { 93, -5 },
+    { 94, -5 },
+    { 95, -5 },
+    { 96, -5 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, -1 },
+    { 102, -5 },
+    { 103, -5 },
+    { 104, -5 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 109, -5 },
+    { 110, -1 },
+    { 3, -3 },
+    { 4, -1 },
+    { 5, -2 },
+    { 8, -2 },
+    { 11, -1 },
+    { 15, -4 },
+    { 17, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -4 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -4 },
+    { 35, -2 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -5 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -2 },
+    { 44, -5 },
+    { 45, -2 },
+    { 48, -3 },
+    { 49, -4 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -5 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -5 },
+    { 71, -2 },
+    { 72, -5 },
+    { 73, -2 },
+    { 76, -6 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -2 },
+    { 89, -4 },
+    { 90, -4 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, 2 },
+    { 98, 1 },
+    { 99, 2 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 105, 1 },
+    { 106, 2 },
+    { 107, 1 },
+    { 109, -3 },
+    { 2, 2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 8, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 18, -4 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -2 },
+    { 44, -7 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -3 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 109, -2 },
+    { 1, 1 },
+    { 2, 1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -4 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -2 },
+    { 44, -7 },
+    { 45, -2 },
+    { 47, -2 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -6 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 109, -3 },
+    { 2, 1 },
+    { 3, -4 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -5 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -7 },
+    { 45, -3 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 2, 1 },
+    { 3, -4 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -5 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -7 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 1, 1 },
+    { 3, -5 },
+    { 4, -2 },
+    { 5, -2 },
+    { 8, -2 },
+    { 9, 1 },
+    { 10, 1 },
+    { 11, -2 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, -4 },
+    { 16, 1 },
+    { 17, -3 },
+    { 18, -4 },
+    { 19, -2 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -5 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -5 },
+    { 35, -2 },
+    { 36, -5 },
+    { 37, -2 },
+    { 38, -5 },
+    { 39, -8 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -2 },
+    { 44, -7 },
+    { 45, -2 },
+    { 48, -4 },
+    { 49, -5 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -5 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -5 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -6 },
+    { 77, -5 },
+    { 79, -4 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -5 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -5 },
+    { 88, -1 },
+    { 89, -5 },
+    { 90, -5 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -5 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, -1 },
+    { 102, -5 },
+    { 103, -4 },
+    { 104, -4 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 2 },
+    { 109, -5 },
+    { 112, 1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -5 },
+    { 4, -1 },
+    { 9, -4 },
+    { 10, -3 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -3 },
+    { 15, -3 },
+    { 18, -6 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -7 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -6 },
+    { 47, -1 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 76, -5 },
+    { 77, -3 },
+    { 78, -2 },
+    { 79, -3 },
+    { 80, -6 },
+    { 81, -4 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 100, 3 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 111, 1 },
+    { 112, -2 },
+    { 114, 1 },
+    { 1, 1 },
+    { 2, 1 },
+    { 3, -4 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -3 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -5 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -7 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -4 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -5 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, 1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -2 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 2 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -3 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 109, -2 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 15, -3 },
+    { 18, -4 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -2 },
+    { 44, -6 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -5 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 100, 2 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -2 },
+    { 109, -3 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 10, 1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 18, -4 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -2 },
+    { 44, -6 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 3 },
+    { 101, 1 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -3 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 109, -2 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 9, -4 },
+    { 10, -3 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -4 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -7 },
+    { 19, -1 },
+    { 22, -5 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -8 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -8 },
+    { 40, -2 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -5 },
+    { 45, -6 },
+    { 48, -4 },
+    { 49, -3 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -2 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -3 },
+    { 66, -5 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -4 },
+    { 76, -6 },
+    { 77, -4 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -6 },
+    { 81, -5 },
+    { 82, -5 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 100, 4 },
+    { 101, -1 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -2 },
+    { 108, -1 },
+    { 109, -4 },
+    { 112, -2 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 9, -3 },
+    { 10, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -3 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -7 },
+    { 19, -1 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -6 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -8 },
+    { 40, -2 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 47, -1 },
+    { 48, -4 },
+    { 49, -3 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -2 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -4 },
+    { 76, -5 },
+    { 77, -4 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -6 },
+    { 81, -4 },
+    { 82, -4 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 100, 4 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -2 },
+    { 108, -1 },
+    { 109, -3 },
+    { 2, 1 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -4 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -2 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -4 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -2 },
+    { 44, -6 },
+    { 45, -2 },
+    { 47, -2 },
+    { 48, -4 },
+    { 49, -3 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -3 },
+    { 54, -5 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -5 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -6 },
+    { 77, -5 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -5 },
+    { 100, 2 },
+    { 101, -1 },
+    { 102, -5 },
+    { 103, -5 },
+    { 104, -3 },
+    { 109, -5 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 9, -3 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -4 },
+    { 15, -3 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -7 },
+    { 19, -1 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -5 },
+    { 47, -1 },
+    { 48, -4 },
+    { 49, -3 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -2 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -4 },
+    { 76, -5 },
+    { 77, -4 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -6 },
+    { 81, -4 },
+    { 82, -4 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 100, 4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -2 },
+    { 108, -1 },
+    { 109, -4 },
+    { 112, -1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 13, 1 },
+    { 15, -4 },
+    { 16, 1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -2 },
+    { 44, -6 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -4 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -3 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -2 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 109, -3 },
+    { 111, 1 },
+    { 2, 2 },
+    { 15, -2 },
+    { 23, 1 },
+    { 25, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 2 },
+    { 44, 1 },
+    { 48, -1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 75, 1 },
+    { 110, 1 },
+    { 113, 1 },
+    { 5, -2 },
+    { 6, 1 },
+    { 11, 1 },
+    { 17, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 40, 1 },
+    { 44, -1 },
+    { 45, 1 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 54, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 74, 1 },
+    { 91, 1 },
+    { 101, 2 },
+    { 1, -2 },
+    { 3, -6 },
+    { 4, -3 },
+    { 8, -3 },
+    { 11, -3 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -3 },
+    { 15, -4 },
+    { 16, -3 },
+    { 17, -3 },
+    { 18, -2 },
+    { 19, -3 },
+    { 20, -3 },
+    { 21, -4 },
+    { 22, -4 },
+    { 23, -5 },
+    { 24, -5 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -6 },
+    { 31, -5 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -5 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -5 },
+    { 48, -5 },
+    { 49, -4 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -5 },
+    { 57, -7 },
+    { 58, -5 },
+    { 59, -5 },
+    { 60, -5 },
+    { 61, -5 },
+    { 62, -5 },
+    { 63, -6 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -5 },
+    { 68, -5 },
+    { 69, -5 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -5 },
+    { 76, -6 },
+    { 77, -5 },
+    { 78, -3 },
+    { 79, -2 },
+    { 80, -5 },
+    { 81, -4 },
+    { 82, -4 },
+    { 83, -5 },
+    { 84, -5 },
+    { 85, -5 },
+    { 86, -5 },
+    { 87, -5 },
+    { 88, -5 },
+    { 89, -5 },
+    { 90, -5 },
+    { 92, -3 },
+    { 93, -4 },
+    { 94, -5 },
+    { 95, -5 },
+    { 96, -5 },
+    { 102, -5 },
+    { 103, -5 },
+    { 104, -5 },
+    { 108, -3 },
+    { 109, -5 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -4 },
+    { 17, -1 },
+    { 18, -3 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -4 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -4 },
+    { 35, -2 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -3 },
+    { 44, -6 },
+    { 45, -2 },
+    { 48, -4 },
+    { 49, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -6 },
+    { 77, -4 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -3 },
+    { 109, -4 },
+    { 1, 1 },
+    { 3, -1 },
+    { 15, -1 },
+    { 21, -4 },
+    { 24, -2 },
+    { 27, -2 },
+    { 34, -2 },
+    { 36, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -2 },
+    { 44, -3 },
+    { 48, -2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 57, -3 },
+    { 62, -2 },
+    { 64, -2 },
+    { 66, -1 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 72, -4 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, 1 },
+    { 83, -2 },
+    { 87, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 92, 1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 3, -2 },
+    { 15, -1 },
+    { 18, 1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 24, -2 },
+    { 26, -1 },
+    { 27, -2 },
+    { 30, -3 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -2 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -1 },
+    { 38, -2 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -2 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 57, -3 },
+    { 58, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -1 },
+    { 77, -2 },
+    { 79, 1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 102, -1 },
+    { 103, -2 },
+    { 109, -2 },
+    { 1, -4 },
+    { 3, -7 },
+    { 4, -4 },
+    { 8, -3 },
+    { 11, -4 },
+    { 12, -4 },
+    { 13, -4 },
+    { 14, -5 },
+    { 15, -5 },
+    { 16, -4 },
+    { 17, -4 },
+    { 18, -9 },
+    { 19, -4 },
+    { 20, -4 },
+    { 21, -10 },
+    { 22, -6 },
+    { 23, -6 },
+    { 24, -6 },
+    { 25, -6 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -8 },
+    { 31, -6 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -7 },
+    { 39, -11 },
+    { 40, -6 },
+    { 41, -8 },
+    { 42, -7 },
+    { 43, -8 },
+    { 44, -8 },
+    { 45, -7 },
+    { 48, -6 },
+    { 49, -6 },
+    { 50, -6 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -6 },
+    { 56, -6 },
+    { 57, -9 },
+    { 58, -6 },
+    { 59, -6 },
+    { 60, -6 },
+    { 61, -6 },
+    { 62, -6 },
+    { 63, -7 },
+    { 64, -6 },
+    { 65, -7 },
+    { 66, -7 },
+    { 67, -6 },
+    { 68, -6 },
+    { 69, -6 },
+    { 70, -6 },
+    { 71, -7 },
+    { 72, -5 },
+    { 73, -7 },
+    { 76, -8 },
+    { 77, -6 },
+    { 78, -3 },
+    { 79, -5 },
+    { 80, -3 },
+    { 81, -6 },
+    { 82, -6 },
+    { 83, -6 },
+    { 84, -6 },
+    { 85, -6 },
+    { 86, -6 },
+    { 87, -6 },
+    { 88, -6 },
+    { 89, -6 },
+    { 90, -6 },
+    { 92, -4 },
+    { 93, -6 },
+    { 94, -6 },
+    { 95, -6 },
+    { 96, -6 },
+    { 102, -6 },
+    { 103, -6 },
+    { 104, -6 },
+    { 108, -4 },
+    { 109, -6 },
+    { 3, -2 },
+    { 8, -2 },
+    { 15, -1 },
+    { 18, -2 },
+    { 21, -4 },
+    { 23, -1 },
+    { 24, -3 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -3 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -3 },
+    { 35, -1 },
+    { 36, -3 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -6 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -1 },
+    { 44, -6 },
+    { 45, -1 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -4 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -1 },
+    { 72, -5 },
+    { 73, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -1 },
+    { 83, -3 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -3 },
+    { 88, -1 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 3, -1 },
+    { 8, -2 },
+    { 21, -3 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -2 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -5 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -2 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -4 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -1 },
+    { 72, -4 },
+    { 73, -1 },
+    { 76, -2 },
+    { 77, -2 },
+    { 80, -1 },
+    { 83, -2 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 48, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -5 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -6 },
+    { 68, -3 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -3 },
+    { 72, -6 },
+    { 73, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -3 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -3 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 109, -3 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -3 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 85, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 109, -3 },
+    { 30, 2 },
+    { 57, -1 },
+    { 101, 1 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -3 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, 1 },
+    { 86, 1 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 101, 1 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 109, -3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -6 },
+    { 45, -3 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -2 },
+    { 80, -6 },
+    { 81, -3 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 108, -1 },
+    { 109, -2 },
+    { 1, 5 },
+    { 4, 4 },
+    { 8, 4 },
+    { 11, 4 },
+    { 12, 4 },
+    { 13, 4 },
+    { 14, 4 },
+    { 15, 3 },
+    { 16, 4 },
+    { 17, 4 },
+    { 18, 4 },
+    { 19, 4 },
+    { 20, 4 },
+    { 21, 2 },
+    { 22, 2 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 2 },
+    { 28, 2 },
+    { 29, 2 },
+    { 31, 1 },
+    { 32, 2 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 2 },
+    { 36, 3 },
+    { 37, 2 },
+    { 39, 1 },
+    { 40, 2 },
+    { 41, 1 },
+    { 42, 1 },
+    { 44, 1 },
+    { 45, 2 },
+    { 48, 2 },
+    { 49, 2 },
+    { 50, 2 },
+    { 51, 2 },
+    { 52, 2 },
+    { 53, 2 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, 2 },
+    { 58, 2 },
+    { 59, 2 },
+    { 60, 1 },
+    { 61, 2 },
+    { 62, 2 },
+    { 63, 1 },
+    { 64, 2 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 2 },
+    { 68, 2 },
+    { 69, 2 },
+    { 70, 2 },
+    { 72, 2 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, 2 },
+    { 78, 5 },
+    { 79, 3 },
+    { 81, 2 },
+    { 82, 1 },
+    { 83, 2 },
+    { 84, 2 },
+    { 85, 2 },
+    { 86, 2 },
+    { 87, 2 },
+    { 88, 2 },
+    { 89, 2 },
+    { 90, 2 },
+    { 92, 4 },
+    { 93, 2 },
+    { 94, 2 },
+    { 95, 2 },
+    { 96, 2 },
+    { 102, 2 },
+    { 103, 2 },
+    { 104, 2 },
+    { 108, 4 },
+    { 109, 2 },
+    { 3, -5 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 48, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 76, -4 },
+    { 77, -3 },
+    { 80, -5 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 48, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 76, -4 },
+    { 77, -3 },
+    { 80, -5 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -3 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 108, -1 },
+    { 109, -3 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 18, -3 },
+    { 21, -3 },
+    { 22, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -7 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -2 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -2 },
+    { 47, -1 },
+    { 49, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -4 },
+    { 58, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 63, -2 },
+    { 65, -1 },
+    { 66, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -2 },
+    { 75, -1 },
+    { 101, 2 },
+    { 112, -3 },
+    { 1, 1 },
+    { 2, 1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 21, -4 },
+    { 24, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -4 },
+    { 49, -1 },
+    { 53, -1 },
+    { 57, -4 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 76, -3 },
+    { 80, -2 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 99, 3 },
+    { 100, 2 },
+    { 101, 2 },
+    { 104, -1 },
+    { 106, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -2 },
+    { 44, -4 },
+    { 45, -2 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 109, -3 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -6 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -2 },
+    { 44, -6 },
+    { 45, -2 },
+    { 48, -3 },
+    { 49, -4 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 76, -6 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 104, -3 },
+    { 109, -3 },
+    { 3, -3 },
+    { 8, -1 },
+    { 15, -1 },
+    { 18, -4 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -8 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -3 },
+    { 44, -7 },
+    { 45, -3 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -4 },
+    { 73, -3 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -5 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -4 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -4 },
+    { 35, -2 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -8 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -3 },
+    { 44, -6 },
+    { 45, -2 },
+    { 48, -4 },
+    { 49, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -4 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -6 },
+    { 77, -4 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -2 },
+    { 89, -4 },
+    { 90, -4 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, -3 },
+    { 109, -4 },
+    { 23, 2 },
+    { 25, 1 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 2 },
+    { 32, 1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, 2 },
+    { 40, 2 },
+    { 41, 1 },
+    { 42, 1 },
+    { 44, 1 },
+    { 49, 2 },
+    { 55, 1 },
+    { 56, 2 },
+    { 58, 1 },
+    { 59, 2 },
+    { 60, 1 },
+    { 61, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 71, 1 },
+    { 73, 1 },
+    { 91, 2 },
+    { 92, 1 },
+    { 101, 1 },
+    { 30, 2 },
+    { 49, 1 },
+    { 55, 1 },
+    { 56, 1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 71, 1 },
+    { 73, 1 },
+    { 92, 1 },
+    { 101, 1 },
+    { 23, 3 },
+    { 24, 1 },
+    { 25, 3 },
+    { 26, 3 },
+    { 27, 1 },
+    { 28, 3 },
+    { 29, 3 },
+    { 30, 2 },
+    { 31, 2 },
+    { 32, 3 },
+    { 33, 2 },
+    { 34, 1 },
+    { 35, 3 },
+    { 36, 1 },
+    { 37, 2 },
+    { 38, 2 },
+    { 39, 3 },
+    { 40, 3 },
+    { 41, 3 },
+    { 42, 3 },
+    { 43, 2 },
+    { 44, 3 },
+    { 45, 1 },
+    { 49, 4 },
+    { 53, 2 },
+    { 55, 3 },
+    { 56, 4 },
+    { 57, 1 },
+    { 58, 3 },
+    { 59, 4 },
+    { 60, 1 },
+    { 61, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 2 },
+    { 71, 1 },
+    { 73, 1 },
+    { 91, 3 },
+    { 92, 3 },
+    { 101, 1 },
+    { 23, 2 },
+    { 24, 1 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 2 },
+    { 30, 2 },
+    { 31, 1 },
+    { 32, 2 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 2 },
+    { 36, 1 },
+    { 37, 2 },
+    { 38, 1 },
+    { 39, 2 },
+    { 40, 2 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 3 },
+    { 45, 1 },
+    { 49, 3 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, 3 },
+    { 54, 1 },
+    { 55, 2 },
+    { 56, 3 },
+    { 58, 2 },
+    { 59, 3 },
+    { 60, 2 },
+    { 61, 2 },
+    { 62, 1 },
+    { 63, 2 },
+    { 64, 1 },
+    { 65, 2 },
+    { 66, 1 },
+    { 67, 3 },
+    { 68, 3 },
+    { 69, 4 },
+    { 70, 3 },
+    { 71, 2 },
+    { 72, 4 },
+    { 73, 1 },
+    { 91, 2 },
+    { 92, 2 },
+    { 101, 1 },
+    { 2, 3 },
+    { 6, 1 },
+    { 11, 1 },
+    { 13, 1 },
+    { 16, 1 },
+    { 17, 1 },
+    { 20, 1 },
+    { 21, -3 },
+    { 22, -2 },
+    { 23, 2 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, -5 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 39, -2 },
+    { 40, 2 },
+    { 42, 1 },
+    { 43, -1 },
+    { 45, -3 },
+    { 49, 1 },
+    { 53, 1 },
+    { 56, 1 },
+    { 57, -2 },
+    { 59, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 72, 2 },
+    { 91, 2 },
+    { 92, 2 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 3 },
+    { 100, 4 },
+    { 105, 1 },
+    { 106, 2 },
+    { 107, 1 },
+    { 111, 1 },
+    { 112, -1 },
+    { 113, 1 },
+    { 114, 1 },
+    { 3, -4 },
+    { 8, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -4 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 3, -4 },
+    { 8, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -3 },
+    { 30, -5 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -3 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -6 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -4 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -2 },
+    { 109, -2 },
+    { 3, -3 },
+    { 15, -1 },
+    { 18, -1 },
+    { 21, -3 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, -3 },
+    { 109, -2 },
+    { 23, 2 },
+    { 25, 1 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 2 },
+    { 30, 2 },
+    { 32, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, 2 },
+    { 40, 2 },
+    { 41, 2 },
+    { 42, 1 },
+    { 43, 1 },
+    { 44, 2 },
+    { 45, 1 },
+    { 49, 2 },
+    { 55, 1 },
+    { 56, 2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 71, 1 },
+    { 73, 1 },
+    { 91, 1 },
+    { 92, 1 },
+    { 101, 1 },
+    { 23, 3 },
+    { 25, 3 },
+    { 26, 3 },
+    { 28, 3 },
+    { 29, 3 },
+    { 30, 2 },
+    { 31, 2 },
+    { 32, 3 },
+    { 33, 2 },
+    { 35, 3 },
+    { 37, 2 },
+    { 38, 1 },
+    { 39, 3 },
+    { 40, 3 },
+    { 41, 3 },
+    { 42, 3 },
+    { 43, 3 },
+    { 44, 3 },
+    { 45, 2 },
+    { 49, 4 },
+    { 53, 1 },
+    { 55, 3 },
+    { 56, 3 },
+    { 58, 3 },
+    { 59, 3 },
+    { 60, 1 },
+    { 61, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 71, 1 },
+    { 73, 1 },
+    { 91, 3 },
+    { 92, 2 },
+    { 101, 1 },
+    { 30, 2 },
+    { 55, 1 },
+    { 56, 1 },
+    { 58, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 71, 1 },
+    { 73, 1 },
+    { 92, 1 },
+    { 101, 1 },
+    { 1, 1 },
+    { 3, -1 },
+    { 18, -2 },
+    { 21, -3 },
+    { 24, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 39, -6 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -2 },
+    { 44, -4 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 57, -3 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 76, -3 },
+    { 77, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 109, -1 },
+    { 1, 4 },
+    { 3, 1 },
+    { 4, 3 },
+    { 8, 1 },
+    { 11, 2 },
+    { 12, 4 },
+    { 13, 4 },
+    { 14, 4 },
+    { 15, 2 },
+    { 16, 4 },
+    { 17, 2 },
+    { 18, 3 },
+    { 19, 3 },
+    { 20, 3 },
+    { 22, 3 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 44, 1 },
+    { 45, 1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 55, 1 },
+    { 56, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 71, 1 },
+    { 73, 1 },
+    { 78, 4 },
+    { 79, 3 },
+    { 80, 1 },
+    { 81, 3 },
+    { 82, 3 },
+    { 84, 1 },
+    { 85, 1 },
+    { 86, 1 },
+    { 88, 2 },
+    { 89, 1 },
+    { 90, 1 },
+    { 92, 4 },
+    { 93, 1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 104, 1 },
+    { 108, 4 },
+    { 1, 3 },
+    { 4, 2 },
+    { 8, 1 },
+    { 11, 2 },
+    { 12, 2 },
+    { 13, 2 },
+    { 14, 2 },
+    { 15, 1 },
+    { 16, 2 },
+    { 17, 2 },
+    { 19, 2 },
+    { 20, 2 },
+    { 21, -2 },
+    { 22, 1 },
+    { 39, -4 },
+    { 41, -2 },
+    { 42, -1 },
+    { 44, -3 },
+    { 57, -1 },
+    { 76, -1 },
+    { 78, 2 },
+    { 79, 1 },
+    { 81, 1 },
+    { 82, 1 },
+    { 92, 2 },
+    { 108, 2 },
+    { 2, 3 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 40, 1 },
+    { 53, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 91, 1 },
+    { 111, 1 },
+    { 114, 1 },
+    { 2, 2 },
+    { 22, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, -2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 2 },
+    { 44, 1 },
+    { 47, 1 },
+    { 49, 1 },
+    { 75, 1 },
+    { 91, 1 },
+    { 110, 1 },
+    { 113, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 2 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, -2 },
+    { 41, -1 },
+    { 43, 1 },
+    { 44, -1 },
+    { 45, 1 },
+    { 55, 1 },
+    { 56, 1 },
+    { 59, 1 },
+    { 66, 1 },
+    { 69, -1 },
+    { 91, 1 },
+    { 92, 1 },
+    { 101, 2 },
+    { 2, 2 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 2 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 40, 1 },
+    { 53, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 91, 1 },
+    { 101, 1 },
+    { 111, 1 },
+    { 114, 1 },
+    { 2, 2 },
+    { 22, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, -2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 2 },
+    { 47, 1 },
+    { 49, 1 },
+    { 75, 1 },
+    { 91, 1 },
+    { 110, 1 },
+    { 113, 1 },
+};
+
 static const EpdFontData opendyslexic_10_bolditalic = {
     opendyslexic_10_bolditalicBitmaps,
     opendyslexic_10_bolditalicGlyphs,
@@ -4029,4 +12226,8 @@ static const EpdFontData opendyslexic_10_bolditalic = {
     28,
     -11,
     true,
+    opendyslexic_10_bolditalicKernLeftClasses,
+    opendyslexic_10_bolditalicKernRightClasses,
+    opendyslexic_10_bolditalicKernPairOffsets,
+    opendyslexic_10_bolditalicKernPairs,
 };
@@ -3589,6 +3589,3236 @@ static const EpdUnicodeInterval opendyslexic_10_italicIntervals[] = {
     { 0x2264, 0x2265, 0x2BF },
 };
 
+static const uint8_t opendyslexic_10_italicKernLeftClasses[705] = {
+    0, 1, 2, 0, 0, 0, 0, 2, 3, 4, 5, 0, 6, 7, 8, 0,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 20,
+    0, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 0, 48, 49, 0,
+    0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 0, 77, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 78, 79, 0, 0, 0, 0, 80, 80, 81, 80, 0,
+    0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 83, 84, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 86, 87, 88, 89,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0,
+    0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 80, 92, 80, 93, 94, 95, 80, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 98, 99, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t opendyslexic_10_italicKernRightClasses[705] = {
+    0, 1, 2, 0, 0, 0, 0, 3, 4, 5, 6, 0, 7, 8, 9, 0,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 0, 49, 50, 0,
+    0, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 0, 78, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 79, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 82, 83, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 85, 86, 87, 88,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 90, 0, 91, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 94, 95, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t opendyslexic_10_italicKernPairOffsets[100] = {
+    0, 6, 7, 53, 61, 66, 76, 84, 93, 107, 130, 137, 147, 174, 190, 205,
+    222, 233, 246, 249, 282, 349, 394, 433, 478, 519, 585, 653, 686, 720, 753, 810,
+    854, 906, 966, 1009, 1055, 1101, 1149, 1210, 1285, 1323, 1380, 1436, 1497, 1565, 1622, 1650,
+    1652, 1659, 1702, 1757, 1811, 1849, 1894, 1938, 1973, 2015, 2053, 2061, 2114, 2161, 2177, 2219,
+    2262, 2303, 2377, 2426, 2470, 2515, 2555, 2604, 2652, 2708, 2757, 2797, 2833, 2845, 2875, 2905,
+    2907, 2911, 2930, 2962, 2977, 2981, 2982, 2992, 3011, 3041, 3045, 3047, 3054, 3067, 3071, 3072,
+    3075, 3087, 3109, 3121,
+};
+
+static const EpdKernPair opendyslexic_10_italicKernPairs[] = {
+    { 22, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 35, -1 },
+    { 41, -1 },
+    { 66, -1 },
+    { 2, 2 },
+    { 10, -2 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -4 },
+    { 15, -1 },
+    { 16, -2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 22, -2 },
+    { 24, -3 },
+    { 27, -1 },
+    { 28, -2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -1 },
+    { 40, -2 },
+    { 45, -1 },
+    { 47, -2 },
+    { 51, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -2 },
+    { 83, -2 },
+    { 88, -3 },
+    { 2, 2 },
+    { 5, -2 },
+    { 17, -1 },
+    { 24, 1 },
+    { 46, -1 },
+    { 60, -1 },
+    { 66, -1 },
+    { 74, -1 },
+    { 2, 1 },
+    { 8, -2 },
+    { 41, -2 },
+    { 60, -1 },
+    { 74, -1 },
+    { 1, 1 },
+    { 5, -1 },
+    { 9, 1 },
+    { 28, -1 },
+    { 41, -5 },
+    { 46, -1 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, -1 },
+    { 75, -1 },
+    { 5, -1 },
+    { 6, -2 },
+    { 11, -1 },
+    { 40, -6 },
+    { 41, -2 },
+    { 46, -2 },
+    { 60, -1 },
+    { 74, -2 },
+    { 1, 1 },
+    { 9, 1 },
+    { 28, -1 },
+    { 41, -5 },
+    { 46, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 75, -3 },
+    { 2, 2 },
+    { 5, -2 },
+    { 13, -1 },
+    { 17, -1 },
+    { 22, -1 },
+    { 31, -3 },
+    { 43, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 74, -1 },
+    { 78, -1 },
+    { 95, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 14, -4 },
+    { 17, -3 },
+    { 31, -3 },
+    { 41, -3 },
+    { 43, -2 },
+    { 44, -2 },
+    { 46, -3 },
+    { 49, -3 },
+    { 50, -2 },
+    { 56, -1 },
+    { 60, -2 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, -1 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -3 },
+    { 93, -2 },
+    { 94, -3 },
+    { 2, 2 },
+    { 5, -2 },
+    { 14, -2 },
+    { 31, -3 },
+    { 46, -1 },
+    { 60, -2 },
+    { 78, -1 },
+    { 5, -2 },
+    { 31, -3 },
+    { 45, -1 },
+    { 46, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 78, -1 },
+    { 95, -1 },
+    { 5, -3 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 17, -2 },
+    { 19, -1 },
+    { 22, -1 },
+    { 31, -3 },
+    { 41, -2 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -2 },
+    { 49, -2 },
+    { 56, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 78, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 5, -1 },
+    { 19, -1 },
+    { 22, -1 },
+    { 31, -3 },
+    { 45, -1 },
+    { 56, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 5, -1 },
+    { 22, -1 },
+    { 31, -3 },
+    { 45, -1 },
+    { 56, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 14, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 31, -3 },
+    { 40, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 60, -2 },
+    { 63, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 88, -1 },
+    { 95, -2 },
+    { 5, -2 },
+    { 17, -1 },
+    { 31, -3 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 74, -1 },
+    { 78, -1 },
+    { 2, 2 },
+    { 5, -2 },
+    { 17, -1 },
+    { 22, -1 },
+    { 31, -3 },
+    { 43, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 74, -1 },
+    { 78, -1 },
+    { 95, -1 },
+    { 2, 3 },
+    { 40, 1 },
+    { 41, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 17, 1 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 2 },
+    { 30, 2 },
+    { 32, 1 },
+    { 33, 2 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 3 },
+    { 44, 3 },
+    { 45, 2 },
+    { 46, 2 },
+    { 47, 1 },
+    { 52, 2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 82, 2 },
+    { 5, -2 },
+    { 7, -1 },
+    { 10, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 17, -3 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -9 },
+    { 42, -6 },
+    { 43, -9 },
+    { 44, -8 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -4 },
+    { 49, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -5 },
+    { 71, -4 },
+    { 72, -6 },
+    { 73, -5 },
+    { 74, -2 },
+    { 75, -6 },
+    { 76, -2 },
+    { 78, -3 },
+    { 79, -4 },
+    { 80, -6 },
+    { 81, -4 },
+    { 82, 1 },
+    { 88, -1 },
+    { 92, -6 },
+    { 93, -4 },
+    { 94, -3 },
+    { 5, -2 },
+    { 17, -1 },
+    { 22, -5 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -7 },
+    { 47, -4 },
+    { 49, -1 },
+    { 54, 1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 78, -2 },
+    { 79, -6 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -4 },
+    { 93, -1 },
+    { 94, -1 },
+    { 14, -1 },
+    { 19, -1 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 56, -1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -4 },
+    { 79, -4 },
+    { 80, -4 },
+    { 81, -4 },
+    { 92, -4 },
+    { 5, -3 },
+    { 13, -1 },
+    { 17, -2 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -7 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -7 },
+    { 46, -8 },
+    { 47, -5 },
+    { 49, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, -2 },
+    { 65, 1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 70, 1 },
+    { 74, -2 },
+    { 78, -3 },
+    { 79, -7 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -4 },
+    { 95, -1 },
+    { 5, -1 },
+    { 14, -4 },
+    { 16, -1 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 56, -1 },
+    { 60, -2 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -3 },
+    { 79, -4 },
+    { 80, -5 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -5 },
+    { 94, -1 },
+    { 1, -2 },
+    { 7, -8 },
+    { 9, -6 },
+    { 11, -1 },
+    { 14, -3 },
+    { 18, -1 },
+    { 22, -8 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -3 },
+    { 39, -5 },
+    { 40, -7 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -6 },
+    { 51, -4 },
+    { 52, -2 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -1 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -3 },
+    { 76, -5 },
+    { 79, -10 },
+    { 80, -5 },
+    { 81, -5 },
+    { 83, -1 },
+    { 88, -1 },
+    { 90, 1 },
+    { 92, -5 },
+    { 95, -6 },
+    { 1, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 17, -1 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -7 },
+    { 47, -5 },
+    { 49, -1 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -4 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -4 },
+    { 76, -4 },
+    { 78, -2 },
+    { 79, -6 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -4 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 54, 1 },
+    { 60, -2 },
+    { 79, -4 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -4 },
+    { 2, 2 },
+    { 5, -1 },
+    { 14, -1 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -1 },
+    { 31, -6 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 47, -2 },
+    { 60, -2 },
+    { 79, -2 },
+    { 80, -3 },
+    { 81, -2 },
+    { 92, -3 },
+    { 22, -5 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -5 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -2 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 60, -1 },
+    { 66, -1 },
+    { 79, -5 },
+    { 80, -4 },
+    { 81, -4 },
+    { 92, -4 },
+    { 95, -1 },
+    { 5, -2 },
+    { 10, -2 },
+    { 14, -5 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -7 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -7 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -8 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -6 },
+    { 47, -4 },
+    { 49, -2 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 60, -2 },
+    { 65, -2 },
+    { 67, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -4 },
+    { 78, -1 },
+    { 79, -4 },
+    { 80, -7 },
+    { 81, -4 },
+    { 82, 1 },
+    { 88, -2 },
+    { 92, -8 },
+    { 93, -1 },
+    { 94, -2 },
+    { 5, -2 },
+    { 14, -6 },
+    { 17, -3 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -9 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -4 },
+    { 49, -4 },
+    { 56, -1 },
+    { 60, -2 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, -1 },
+    { 75, -4 },
+    { 78, -3 },
+    { 79, -4 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -5 },
+    { 93, -7 },
+    { 94, -7 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 79, -4 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 83, 1 },
+    { 88, 1 },
+    { 92, -4 },
+    { 5, 1 },
+    { 7, -2 },
+    { 9, -1 },
+    { 22, -5 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -8 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -2 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -2 },
+    { 76, -3 },
+    { 79, -5 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -4 },
+    { 95, -1 },
+    { 5, -2 },
+    { 13, -1 },
+    { 17, -1 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -7 },
+    { 46, -6 },
+    { 47, -5 },
+    { 49, -1 },
+    { 54, 1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 70, 1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 78, -2 },
+    { 79, -7 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -4 },
+    { 95, -1 },
+    { 2, 3 },
+    { 5, -1 },
+    { 7, -6 },
+    { 8, -5 },
+    { 9, -5 },
+    { 14, -3 },
+    { 22, -8 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -7 },
+    { 46, -5 },
+    { 47, -7 },
+    { 50, -1 },
+    { 51, -1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 78, -2 },
+    { 79, -11 },
+    { 80, -5 },
+    { 81, -4 },
+    { 82, 1 },
+    { 88, -1 },
+    { 92, -4 },
+    { 95, -7 },
+    { 5, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -1 },
+    { 17, -2 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -1 },
+    { 39, -3 },
+    { 40, -5 },
+    { 41, -4 },
+    { 42, -3 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -6 },
+    { 47, -4 },
+    { 52, -1 },
+    { 60, 1 },
+    { 63, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 76, -1 },
+    { 79, -4 },
+    { 80, -3 },
+    { 81, -3 },
+    { 92, -3 },
+    { 93, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 10, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -7 },
+    { 47, -4 },
+    { 49, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 60, -2 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 78, -2 },
+    { 79, -4 },
+    { 80, -5 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -5 },
+    { 93, -1 },
+    { 94, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 17, -1 },
+    { 22, -5 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -7 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -7 },
+    { 47, -4 },
+    { 49, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, 2 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 70, -1 },
+    { 71, 1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -2 },
+    { 78, -2 },
+    { 79, -6 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 83, 1 },
+    { 88, 1 },
+    { 92, -4 },
+    { 93, -2 },
+    { 94, -3 },
+    { 1, -2 },
+    { 2, 3 },
+    { 6, -2 },
+    { 7, -6 },
+    { 8, -2 },
+    { 9, -5 },
+    { 10, -1 },
+    { 11, -3 },
+    { 14, -5 },
+    { 16, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -3 },
+    { 22, -9 },
+    { 23, -4 },
+    { 24, -7 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -6 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -6 },
+    { 50, -3 },
+    { 51, -8 },
+    { 52, -2 },
+    { 53, -8 },
+    { 54, -8 },
+    { 55, -8 },
+    { 56, -4 },
+    { 57, -8 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -8 },
+    { 65, -8 },
+    { 66, -8 },
+    { 67, -8 },
+    { 68, -8 },
+    { 69, -8 },
+    { 70, -7 },
+    { 71, -8 },
+    { 72, -8 },
+    { 73, -8 },
+    { 74, -8 },
+    { 75, -8 },
+    { 76, -8 },
+    { 79, -9 },
+    { 80, -7 },
+    { 81, -6 },
+    { 82, 1 },
+    { 87, -2 },
+    { 88, -4 },
+    { 90, 1 },
+    { 92, -6 },
+    { 95, -5 },
+    { 2, 2 },
+    { 14, -1 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -2 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 52, 1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 74, -1 },
+    { 79, -6 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -4 },
+    { 95, -1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -3 },
+    { 16, -1 },
+    { 18, -1 },
+    { 21, -1 },
+    { 22, -10 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -6 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -7 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -6 },
+    { 51, -2 },
+    { 52, 1 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 57, -2 },
+    { 60, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -2 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -2 },
+    { 79, -10 },
+    { 80, -6 },
+    { 81, -6 },
+    { 82, 1 },
+    { 83, -1 },
+    { 88, -2 },
+    { 92, -6 },
+    { 95, -4 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 18, -1 },
+    { 22, -8 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -6 },
+    { 51, -2 },
+    { 52, 1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 60, -2 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -2 },
+    { 74, -2 },
+    { 76, -2 },
+    { 79, -8 },
+    { 80, -6 },
+    { 81, -5 },
+    { 82, 1 },
+    { 83, -1 },
+    { 88, -2 },
+    { 90, 1 },
+    { 92, -5 },
+    { 95, -3 },
+    { 10, -1 },
+    { 14, -3 },
+    { 16, -1 },
+    { 18, -1 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -7 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -7 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -7 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 51, -1 },
+    { 52, 1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 75, -2 },
+    { 76, 1 },
+    { 79, -4 },
+    { 80, -7 },
+    { 81, -4 },
+    { 82, 1 },
+    { 83, 1 },
+    { 88, -1 },
+    { 92, -7 },
+    { 94, -1 },
+    { 2, 2 },
+    { 4, -1 },
+    { 7, -3 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -5 },
+    { 16, -2 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -2 },
+    { 22, -9 },
+    { 23, -4 },
+    { 24, -7 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -7 },
+    { 37, -5 },
+    { 38, -5 },
+    { 39, -5 },
+    { 40, -7 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -6 },
+    { 50, -2 },
+    { 51, -4 },
+    { 52, 1 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -1 },
+    { 57, -3 },
+    { 60, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -3 },
+    { 79, -9 },
+    { 80, -7 },
+    { 81, -7 },
+    { 83, -1 },
+    { 88, -4 },
+    { 92, -7 },
+    { 95, -5 },
+    { 14, -5 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 52, 1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -2 },
+    { 79, -4 },
+    { 80, -6 },
+    { 81, -4 },
+    { 82, 1 },
+    { 83, 1 },
+    { 88, -1 },
+    { 92, -6 },
+    { 14, -4 },
+    { 16, -1 },
+    { 22, -4 },
+    { 24, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 51, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -1 },
+    { 57, -1 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -3 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -1 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -1 },
+    { 76, -4 },
+    { 88, -3 },
+    { 14, -1 },
+    { 52, -1 },
+    { 5, -2 },
+    { 11, -1 },
+    { 40, -1 },
+    { 41, -3 },
+    { 46, -2 },
+    { 60, -1 },
+    { 74, -2 },
+    { 2, 1 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -3 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 40, 1 },
+    { 41, -7 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, 1 },
+    { 46, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 87, 1 },
+    { 93, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 17, -4 },
+    { 22, -4 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, 1 },
+    { 31, -3 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, -8 },
+    { 42, 1 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -3 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -3 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, -2 },
+    { 82, 1 },
+    { 93, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -4 },
+    { 10, -1 },
+    { 14, -4 },
+    { 16, -1 },
+    { 17, -3 },
+    { 18, -1 },
+    { 22, -2 },
+    { 24, -1 },
+    { 27, -2 },
+    { 28, -4 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, 1 },
+    { 41, -7 },
+    { 42, -1 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -3 },
+    { 50, -1 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -3 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -1 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -1 },
+    { 77, -1 },
+    { 88, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 2, 2 },
+    { 14, -1 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 35, -2 },
+    { 41, -2 },
+    { 51, -2 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 84, 1 },
+    { 86, 2 },
+    { 87, 1 },
+    { 89, 1 },
+    { 90, 2 },
+    { 2, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 17, -3 },
+    { 22, -3 },
+    { 24, 1 },
+    { 25, 1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 41, -8 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -3 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -3 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -2 },
+    { 93, -1 },
+    { 2, 2 },
+    { 7, -2 },
+    { 9, -2 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -3 },
+    { 22, -5 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 35, -3 },
+    { 41, -2 },
+    { 47, -2 },
+    { 51, -2 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -3 },
+    { 77, -2 },
+    { 84, 1 },
+    { 87, 1 },
+    { 88, -2 },
+    { 95, -2 },
+    { 2, 2 },
+    { 5, -1 },
+    { 17, -4 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 35, -2 },
+    { 41, -8 },
+    { 46, -1 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -2 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -2 },
+    { 62, -1 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -2 },
+    { 87, 1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -3 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 40, 1 },
+    { 41, -7 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, 1 },
+    { 46, -3 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -3 },
+    { 76, -1 },
+    { 93, -1 },
+    { 2, 2 },
+    { 14, -1 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 45, 1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 87, 1 },
+    { 90, 2 },
+    { 2, 3 },
+    { 44, 1 },
+    { 70, -1 },
+    { 84, 1 },
+    { 86, 1 },
+    { 87, 2 },
+    { 89, 1 },
+    { 90, 2 },
+    { 5, -1 },
+    { 6, -3 },
+    { 8, -3 },
+    { 10, -2 },
+    { 14, -5 },
+    { 16, -2 },
+    { 17, -3 },
+    { 18, -1 },
+    { 22, -2 },
+    { 24, -2 },
+    { 27, -2 },
+    { 28, -5 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, -2 },
+    { 38, -2 },
+    { 41, -7 },
+    { 42, -2 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -4 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -4 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -4 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -1 },
+    { 69, -2 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -1 },
+    { 75, -4 },
+    { 76, -1 },
+    { 77, -1 },
+    { 88, -2 },
+    { 93, -3 },
+    { 94, -2 },
+    { 6, -1 },
+    { 10, -1 },
+    { 14, -3 },
+    { 16, -1 },
+    { 17, -1 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -4 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 40, 1 },
+    { 41, -4 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, 1 },
+    { 46, -1 },
+    { 50, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -1 },
+    { 75, -4 },
+    { 76, -1 },
+    { 77, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 2, 1 },
+    { 5, -1 },
+    { 17, -3 },
+    { 31, -3 },
+    { 34, 1 },
+    { 40, 1 },
+    { 41, -4 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, 1 },
+    { 46, -3 },
+    { 60, -2 },
+    { 70, -1 },
+    { 72, -1 },
+    { 75, -1 },
+    { 93, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -3 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 40, 1 },
+    { 41, -7 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, 1 },
+    { 46, -3 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -1 },
+    { 75, -3 },
+    { 76, -1 },
+    { 93, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 17, -4 },
+    { 22, -4 },
+    { 24, 1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 41, -8 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -3 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -3 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, -2 },
+    { 93, -1 },
+    { 95, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 17, -4 },
+    { 22, -4 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 35, -2 },
+    { 41, -8 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -3 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -3 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, -2 },
+    { 93, -1 },
+    { 95, -1 },
+    { 1, -2 },
+    { 9, -2 },
+    { 10, -1 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -6 },
+    { 18, -2 },
+    { 19, -1 },
+    { 21, -2 },
+    { 22, -5 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 26, -2 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -5 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -10 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -3 },
+    { 47, -2 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -2 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 77, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 88, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -4 },
+    { 8, -1 },
+    { 9, -3 },
+    { 11, -2 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -2 },
+    { 17, -5 },
+    { 22, -5 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 35, -3 },
+    { 41, -8 },
+    { 43, -1 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -3 },
+    { 75, -2 },
+    { 76, -3 },
+    { 77, -2 },
+    { 87, 1 },
+    { 88, -2 },
+    { 95, -4 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 14, -1 },
+    { 17, -4 },
+    { 22, -3 },
+    { 27, -2 },
+    { 28, -3 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 41, -8 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -2 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 87, 1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -2 },
+    { 14, -4 },
+    { 17, -3 },
+    { 21, -1 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 35, -2 },
+    { 41, -5 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -3 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 77, -2 },
+    { 87, 1 },
+    { 93, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 17, -3 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 40, 1 },
+    { 41, -7 },
+    { 43, -1 },
+    { 45, 1 },
+    { 46, -1 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 87, 1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -4 },
+    { 9, -2 },
+    { 11, -2 },
+    { 12, -3 },
+    { 13, -3 },
+    { 14, -2 },
+    { 17, -6 },
+    { 22, -6 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 35, -3 },
+    { 41, -8 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -3 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -1 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -3 },
+    { 77, -1 },
+    { 87, 1 },
+    { 88, -1 },
+    { 95, -4 },
+    { 1, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -2 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 17, -6 },
+    { 22, -5 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 35, -3 },
+    { 41, -8 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -3 },
+    { 87, 1 },
+    { 88, -1 },
+    { 95, -2 },
+    { 2, 1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, -2 },
+    { 10, -1 },
+    { 14, -4 },
+    { 16, -1 },
+    { 17, -4 },
+    { 18, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 24, -1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -4 },
+    { 35, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 41, -7 },
+    { 42, -1 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -2 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -4 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -3 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -4 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -1 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 77, -2 },
+    { 88, -2 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -2 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -1 },
+    { 17, -6 },
+    { 22, -5 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 35, -3 },
+    { 41, -8 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -3 },
+    { 77, -1 },
+    { 87, 1 },
+    { 88, -1 },
+    { 95, -3 },
+    { 5, -1 },
+    { 14, -3 },
+    { 17, -3 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -3 },
+    { 34, 1 },
+    { 35, -2 },
+    { 41, -8 },
+    { 43, -1 },
+    { 46, -1 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 87, 1 },
+    { 88, -1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -4 },
+    { 16, -2 },
+    { 18, -1 },
+    { 19, -1 },
+    { 22, -3 },
+    { 24, -2 },
+    { 28, -2 },
+    { 32, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 38, -3 },
+    { 40, -2 },
+    { 47, -3 },
+    { 51, -3 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -1 },
+    { 57, -1 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -3 },
+    { 83, -1 },
+    { 88, -3 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 17, -2 },
+    { 56, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -1 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 79, -4 },
+    { 80, -5 },
+    { 81, -4 },
+    { 92, -5 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 79, -4 },
+    { 80, -4 },
+    { 81, -4 },
+    { 92, -4 },
+    { 60, -2 },
+    { 90, 1 },
+    { 52, 2 },
+    { 60, -2 },
+    { 61, 1 },
+    { 90, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 2 },
+    { 31, -2 },
+    { 33, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 3 },
+    { 39, 1 },
+    { 42, 1 },
+    { 80, 1 },
+    { 81, 1 },
+    { 92, 1 },
+    { 5, -3 },
+    { 11, -2 },
+    { 12, -3 },
+    { 13, -1 },
+    { 14, -1 },
+    { 17, -5 },
+    { 22, -2 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 31, -3 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, -1 },
+    { 41, -4 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -3 },
+    { 49, -3 },
+    { 60, -2 },
+    { 66, -1 },
+    { 72, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -2 },
+    { 78, -3 },
+    { 93, -1 },
+    { 95, -6 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -1 },
+    { 31, -3 },
+    { 34, 1 },
+    { 41, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -2 },
+    { 60, -2 },
+    { 74, -1 },
+    { 90, 1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 60, -2 },
+    { 86, 1 },
+    { 87, 1 },
+    { 90, 1 },
+    { 60, -2 },
+    { 52, 2 },
+    { 58, 1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 83, 1 },
+    { 86, 3 },
+    { 87, 3 },
+    { 89, 2 },
+    { 90, 3 },
+    { 52, 2 },
+    { 56, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 70, 1 },
+    { 71, 1 },
+    { 72, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 83, 1 },
+    { 84, 1 },
+    { 86, 3 },
+    { 87, 3 },
+    { 89, 2 },
+    { 90, 4 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -3 },
+    { 14, -3 },
+    { 17, -2 },
+    { 22, -3 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 31, -3 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 41, -2 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -4 },
+    { 51, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 60, -2 },
+    { 65, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 87, 1 },
+    { 88, -3 },
+    { 95, -5 },
+    { 70, -1 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -2 },
+    { 57, 1 },
+    { 66, 2 },
+    { 52, 1 },
+    { 60, -1 },
+    { 84, 1 },
+    { 86, 2 },
+    { 87, 2 },
+    { 89, 1 },
+    { 90, 3 },
+    { 52, 2 },
+    { 58, 1 },
+    { 59, 2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 83, 1 },
+    { 84, 2 },
+    { 85, 1 },
+    { 86, 3 },
+    { 87, 1 },
+    { 89, 3 },
+    { 90, 4 },
+    { 91, 1 },
+    { 57, -3 },
+    { 60, -2 },
+    { 66, -2 },
+    { 75, -3 },
+    { 90, 1 },
+    { 30, 1 },
+    { 31, -1 },
+    { 38, 1 },
+    { 11, -1 },
+    { 14, -3 },
+    { 22, -3 },
+    { 31, -3 },
+    { 45, -1 },
+    { 47, -2 },
+    { 51, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 74, -2 },
+    { 76, -1 },
+    { 88, -2 },
+    { 14, -4 },
+    { 22, -4 },
+    { 31, -3 },
+    { 38, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 51, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, -1 },
+    { 57, -1 },
+    { 60, -2 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 74, -2 },
+    { 76, -2 },
+    { 88, -3 },
+    { 14, -6 },
+    { 17, -4 },
+    { 28, -1 },
+    { 41, -4 },
+    { 43, -3 },
+    { 44, -2 },
+    { 46, -4 },
+    { 60, -1 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, -1 },
+    { 75, -3 },
+};
+
 static const EpdFontData opendyslexic_10_italic = {
     opendyslexic_10_italicBitmaps,
     opendyslexic_10_italicGlyphs,
@@ -3598,4 +6828,8 @@ static const EpdFontData opendyslexic_10_italic = {
     28,
     -11,
     true,
+    opendyslexic_10_italicKernLeftClasses,
+    opendyslexic_10_italicKernRightClasses,
+    opendyslexic_10_italicKernPairOffsets,
+    opendyslexic_10_italicKernPairs,
 };
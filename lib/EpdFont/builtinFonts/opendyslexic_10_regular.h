@@ -3137,4 +3137,8 @@ static const EpdFontData opendyslexic_10_regular = {
     28,
     -11,
     true,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
 };
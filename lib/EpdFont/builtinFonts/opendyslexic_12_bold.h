@@ -4620,4 +4620,8 @@ static const EpdFontData opendyslexic_12_bold = {
     33,
     -13,
     true,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
 };
@@ -5419,6 +5419,8524 @@ static const EpdUnicodeInterval opendyslexic_12_bolditalicIntervals[] = {
     { 0x2264, 0x2265, 0x2BF },
 };
 
+static const uint8_t opendyslexic_12_bolditalicKernLeftClasses[705] = {
+    0, 1, 2, 0, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 11, 0, 0, 0, 0, 0, 20,
+    0, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 0, 48, 0, 0,
+    0, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 0, 76, 0, 0,
+    77, 78, 79, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0,
+    82, 0, 0, 82, 82, 83, 84, 0, 0, 0, 0, 85, 86, 87, 88, 0,
+    0, 0, 89, 0, 0, 90, 0, 91, 92, 0, 92, 93, 0, 94, 95, 0,
+    0, 0, 0, 96, 97, 98, 99, 0, 0, 0, 0, 100, 101, 102, 103, 104,
+    0, 0, 0, 0, 0, 105, 0, 106, 0, 0, 0, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 87, 108, 87, 109, 0, 110, 87, 111, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112,
+    113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 114, 115, 116, 0, 117, 118, 116, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t opendyslexic_12_bolditalicKernRightClasses[705] = {
+    0, 1, 2, 0, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 0, 49, 0, 0,
+    0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 0, 77, 0, 0,
+    78, 79, 80, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0,
+    83, 0, 0, 83, 83, 84, 85, 0, 0, 0, 0, 86, 87, 0, 88, 0,
+    0, 0, 89, 0, 0, 89, 0, 90, 91, 0, 92, 91, 0, 93, 94, 0,
+    0, 0, 0, 95, 96, 97, 98, 0, 0, 0, 0, 99, 100, 101, 102, 103,
+    0, 0, 0, 0, 0, 104, 0, 105, 0, 0, 0, 106, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 108, 0, 109, 0, 110, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89,
+    111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 112, 113, 114, 0, 115, 116, 114, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t opendyslexic_12_bolditalicKernPairOffsets[119] = {
+    0, 23, 89, 180, 220, 252, 276, 306, 346, 358, 374, 420, 460, 511, 554, 593,
+    643, 693, 761, 808, 894, 986, 1076, 1175, 1268, 1356, 1455, 1550, 1642, 1728, 1830, 1920,
+    2011, 2103, 2202, 2296, 2390, 2491, 2579, 2669, 2769, 2867, 2967, 3066, 3158, 3258, 3352, 3385,
+    3410, 3510, 3602, 3692, 3789, 3878, 3975, 4063, 4161, 4258, 4354, 4453, 4545, 4639, 4737, 4829,
+    4920, 5019, 5114, 5213, 5299, 5393, 5487, 5580, 5669, 5764, 5857, 5888, 5920, 6012, 6096, 6142,
+    6200, 6292, 6367, 6440, 6530, 6613, 6695, 6698, 6781, 6867, 6953, 7038, 7125, 7212, 7256, 7304,
+    7387, 7470, 7550, 7634, 7666, 7681, 7723, 7775, 7829, 7910, 7993, 8070, 8103, 8140, 8154, 8198,
+    8264, 8290, 8314, 8335, 8363, 8388, 8408,
+};
+
+static const EpdKernPair opendyslexic_12_bolditalicKernPairs[] = {
+    { 1, 2 },
+    { 10, 2 },
+    { 21, -1 },
+    { 22, 1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 38, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 59, -4 },
+    { 65, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 78, -3 },
+    { 91, -1 },
+    { 92, -1 },
+    { 5, -6 },
+    { 6, -4 },
+    { 7, -3 },
+    { 22, -6 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -8 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -4 },
+    { 48, -4 },
+    { 49, -2 },
+    { 50, -4 },
+    { 51, -2 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -2 },
+    { 75, -5 },
+    { 76, -6 },
+    { 77, -2 },
+    { 93, -2 },
+    { 94, -4 },
+    { 103, -4 },
+    { 112, -2 },
+    { 113, -3 },
+    { 115, -2 },
+    { 116, -3 },
+    { 3, -6 },
+    { 4, -1 },
+    { 8, -4 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -7 },
+    { 22, -3 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -7 },
+    { 45, -6 },
+    { 46, -8 },
+    { 47, -4 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -5 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -7 },
+    { 72, -6 },
+    { 73, -6 },
+    { 74, -7 },
+    { 75, -4 },
+    { 78, -7 },
+    { 79, -3 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -7 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 110, -1 },
+    { 111, -3 },
+    { 1, 1 },
+    { 3, -1 },
+    { 18, -3 },
+    { 21, -4 },
+    { 26, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -6 },
+    { 42, -1 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -6 },
+    { 51, -1 },
+    { 55, -2 },
+    { 59, -4 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -4 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -1 },
+    { 78, -4 },
+    { 82, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 5, -4 },
+    { 6, -1 },
+    { 22, -4 },
+    { 31, -6 },
+    { 32, -1 },
+    { 35, -1 },
+    { 40, -1 },
+    { 45, -1 },
+    { 47, -2 },
+    { 48, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 70, -1 },
+    { 73, -2 },
+    { 75, -3 },
+    { 76, -4 },
+    { 94, -1 },
+    { 103, -2 },
+    { 2, 2 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, 2 },
+    { 15, -2 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 2 },
+    { 34, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 3 },
+    { 45, 1 },
+    { 46, 2 },
+    { 50, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 2, 2 },
+    { 6, 1 },
+    { 7, -1 },
+    { 17, 1 },
+    { 23, 1 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, 2 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 42, 1 },
+    { 45, 1 },
+    { 47, 1 },
+    { 53, 1 },
+    { 56, 1 },
+    { 69, 1 },
+    { 76, 1 },
+    { 93, 1 },
+    { 103, 2 },
+    { 3, -3 },
+    { 15, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 31, -9 },
+    { 32, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -3 },
+    { 41, -1 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 59, -4 },
+    { 62, -1 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -2 },
+    { 71, -1 },
+    { 73, -4 },
+    { 74, -1 },
+    { 75, -2 },
+    { 78, -3 },
+    { 79, -1 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -5 },
+    { 95, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 98, -1 },
+    { 1, 2 },
+    { 9, 1 },
+    { 10, 2 },
+    { 22, 1 },
+    { 41, -6 },
+    { 55, -1 },
+    { 58, 1 },
+    { 65, -1 },
+    { 69, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 74, -2 },
+    { 1, 2 },
+    { 9, 1 },
+    { 10, 2 },
+    { 22, 2 },
+    { 41, -6 },
+    { 55, -1 },
+    { 57, 1 },
+    { 60, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, -3 },
+    { 71, -3 },
+    { 72, -2 },
+    { 74, -4 },
+    { 75, 1 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 26, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, 1 },
+    { 78, -4 },
+    { 82, -4 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 103, 2 },
+    { 1, 1 },
+    { 3, -1 },
+    { 8, -2 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -3 },
+    { 16, 1 },
+    { 18, -2 },
+    { 21, -4 },
+    { 22, 2 },
+    { 24, -2 },
+    { 28, -2 },
+    { 31, -1 },
+    { 36, -1 },
+    { 38, -2 },
+    { 41, -4 },
+    { 42, -1 },
+    { 43, -5 },
+    { 44, -4 },
+    { 46, -6 },
+    { 51, -1 },
+    { 55, -2 },
+    { 59, -4 },
+    { 64, -1 },
+    { 65, -1 },
+    { 69, -4 },
+    { 70, -1 },
+    { 71, -4 },
+    { 72, -3 },
+    { 74, -4 },
+    { 78, -4 },
+    { 85, -2 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 103, 2 },
+    { 104, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 1, 1 },
+    { 3, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 21, -4 },
+    { 22, 2 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 46, -4 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 57, 1 },
+    { 59, -4 },
+    { 60, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 78, -4 },
+    { 79, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, 1 },
+    { 94, 1 },
+    { 98, -1 },
+    { 103, 2 },
+    { 104, -1 },
+    { 105, -1 },
+    { 111, -1 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 24, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 31, -3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -4 },
+    { 51, -1 },
+    { 59, -4 },
+    { 62, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -4 },
+    { 82, -3 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 103, 2 },
+    { 1, 1 },
+    { 3, -3 },
+    { 6, 1 },
+    { 21, -4 },
+    { 30, -1 },
+    { 31, -3 },
+    { 32, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -3 },
+    { 42, -1 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -4 },
+    { 51, -1 },
+    { 55, -2 },
+    { 59, -4 },
+    { 62, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -2 },
+    { 76, 1 },
+    { 78, -4 },
+    { 82, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 103, 2 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 24, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 31, -3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -3 },
+    { 51, -1 },
+    { 55, -2 },
+    { 59, -4 },
+    { 62, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -1 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -3 },
+    { 82, -3 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 103, 2 },
+    { 106, -1 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 24, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 51, -1 },
+    { 55, -2 },
+    { 59, -4 },
+    { 62, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -3 },
+    { 82, -4 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 103, 2 },
+    { 106, -1 },
+    { 3, -3 },
+    { 18, 1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 24, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -3 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -2 },
+    { 49, 1 },
+    { 50, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -3 },
+    { 77, 1 },
+    { 78, -2 },
+    { 79, -2 },
+    { 81, 1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 93, 1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -2 },
+    { 104, -1 },
+    { 105, -2 },
+    { 106, -1 },
+    { 111, -2 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -4 },
+    { 24, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 31, -3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -4 },
+    { 51, -1 },
+    { 55, -1 },
+    { 59, -4 },
+    { 62, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 78, -4 },
+    { 82, -3 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 103, 2 },
+    { 106, -1 },
+    { 3, -5 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -6 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -5 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -2 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -4 },
+    { 50, -7 },
+    { 51, -2 },
+    { 52, -7 },
+    { 53, -7 },
+    { 54, -7 },
+    { 55, -3 },
+    { 56, -7 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -6 },
+    { 65, -5 },
+    { 66, -7 },
+    { 67, -5 },
+    { 68, -7 },
+    { 69, -5 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -4 },
+    { 75, -6 },
+    { 78, -4 },
+    { 79, -7 },
+    { 80, -1 },
+    { 82, -8 },
+    { 83, -5 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -2 },
+    { 92, -2 },
+    { 94, -1 },
+    { 95, -2 },
+    { 96, -5 },
+    { 97, -7 },
+    { 98, -7 },
+    { 103, -1 },
+    { 104, -3 },
+    { 105, -6 },
+    { 106, -3 },
+    { 110, -2 },
+    { 111, -6 },
+    { 1, 2 },
+    { 3, -2 },
+    { 5, -4 },
+    { 8, -3 },
+    { 9, 1 },
+    { 10, 2 },
+    { 12, 2 },
+    { 13, 2 },
+    { 14, 2 },
+    { 15, -1 },
+    { 16, 2 },
+    { 18, -3 },
+    { 20, 1 },
+    { 21, -5 },
+    { 22, 1 },
+    { 23, -1 },
+    { 24, -4 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -4 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -6 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -4 },
+    { 37, -1 },
+    { 38, -4 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -8 },
+    { 42, -3 },
+    { 43, -8 },
+    { 44, -6 },
+    { 45, -1 },
+    { 46, -7 },
+    { 47, -1 },
+    { 48, 2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -5 },
+    { 70, -3 },
+    { 71, -6 },
+    { 72, -4 },
+    { 73, -1 },
+    { 74, -6 },
+    { 75, -1 },
+    { 78, -5 },
+    { 79, -3 },
+    { 82, -1 },
+    { 85, -4 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -4 },
+    { 90, -1 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, 2 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -3 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 112, -2 },
+    { 114, 1 },
+    { 115, -1 },
+    { 2, 2 },
+    { 3, -5 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -2 },
+    { 20, -2 },
+    { 21, -7 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -7 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -5 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -6 },
+    { 74, -5 },
+    { 75, -4 },
+    { 76, 2 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -6 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -3 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 110, -1 },
+    { 111, -3 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 7, 2 },
+    { 8, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -2 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -7 },
+    { 70, -4 },
+    { 71, -7 },
+    { 72, -6 },
+    { 73, -3 },
+    { 74, -7 },
+    { 75, -3 },
+    { 76, 1 },
+    { 77, 1 },
+    { 78, -4 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 103, 1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 110, -1 },
+    { 111, -4 },
+    { 112, 1 },
+    { 115, 1 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 6, 1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -7 },
+    { 46, -6 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -5 },
+    { 76, 1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -7 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -3 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -3 },
+    { 113, 2 },
+    { 116, 2 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -2 },
+    { 7, 1 },
+    { 8, -4 },
+    { 11, -2 },
+    { 15, -2 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -5 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -5 },
+    { 37, -3 },
+    { 38, -5 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 48, 1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -7 },
+    { 72, -6 },
+    { 73, -3 },
+    { 74, -7 },
+    { 75, -3 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -4 },
+    { 81, -1 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -5 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -5 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 111, -4 },
+    { 1, -2 },
+    { 2, 4 },
+    { 3, -7 },
+    { 4, -2 },
+    { 7, 2 },
+    { 8, -2 },
+    { 9, -9 },
+    { 10, -8 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -5 },
+    { 16, -1 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, -5 },
+    { 22, -6 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -12 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -5 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -6 },
+    { 63, -5 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -6 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 77, 1 },
+    { 78, -4 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -8 },
+    { 83, -6 },
+    { 84, -9 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -4 },
+    { 103, -1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 110, -2 },
+    { 111, -4 },
+    { 112, 1 },
+    { 114, -5 },
+    { 1, -1 },
+    { 2, 1 },
+    { 3, -5 },
+    { 5, -2 },
+    { 6, 2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -3 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -7 },
+    { 47, -4 },
+    { 48, 1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -5 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -6 },
+    { 74, -6 },
+    { 75, -5 },
+    { 76, 2 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -6 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 110, -1 },
+    { 111, -3 },
+    { 2, 3 },
+    { 3, -4 },
+    { 6, 1 },
+    { 7, 1 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, 1 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -3 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 111, -3 },
+    { 112, 1 },
+    { 113, 1 },
+    { 115, 1 },
+    { 116, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 48, 1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -4 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -4 },
+    { 103, 1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 111, -4 },
+    { 1, -1 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -2 },
+    { 6, 1 },
+    { 7, 3 },
+    { 8, -1 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -3 },
+    { 16, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -6 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 49, 2 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -5 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -5 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -5 },
+    { 74, -4 },
+    { 75, -5 },
+    { 76, 1 },
+    { 77, 2 },
+    { 78, -4 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -6 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 110, -2 },
+    { 111, -4 },
+    { 112, 2 },
+    { 113, 2 },
+    { 115, 2 },
+    { 116, 2 },
+    { 3, -5 },
+    { 4, -3 },
+    { 5, -3 },
+    { 6, 1 },
+    { 8, -7 },
+    { 11, -4 },
+    { 14, -1 },
+    { 15, -6 },
+    { 17, -4 },
+    { 18, -5 },
+    { 19, -3 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -8 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -8 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -8 },
+    { 37, -3 },
+    { 38, -8 },
+    { 39, -3 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -6 },
+    { 47, -3 },
+    { 48, 2 },
+    { 50, -6 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -4 },
+    { 56, -6 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -7 },
+    { 65, -4 },
+    { 66, -6 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -7 },
+    { 70, -6 },
+    { 71, -8 },
+    { 72, -6 },
+    { 73, -3 },
+    { 74, -10 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -6 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -8 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -8 },
+    { 90, -3 },
+    { 91, -6 },
+    { 92, -6 },
+    { 95, -6 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 103, -2 },
+    { 104, -7 },
+    { 105, -6 },
+    { 106, -6 },
+    { 111, -7 },
+    { 114, 1 },
+    { 2, -3 },
+    { 3, -4 },
+    { 5, -9 },
+    { 6, 1 },
+    { 8, -10 },
+    { 11, -1 },
+    { 15, -1 },
+    { 18, -5 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -9 },
+    { 47, -3 },
+    { 48, 1 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -7 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -7 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 111, -3 },
+    { 112, -5 },
+    { 113, -5 },
+    { 115, -5 },
+    { 116, -5 },
+    { 2, 4 },
+    { 3, -4 },
+    { 6, 1 },
+    { 7, 1 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, 1 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -3 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 111, -3 },
+    { 112, 1 },
+    { 113, 1 },
+    { 115, 1 },
+    { 116, 1 },
+    { 2, 4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 2 },
+    { 9, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -2 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, -3 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, 2 },
+    { 78, -4 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -4 },
+    { 112, 2 },
+    { 113, 1 },
+    { 115, 2 },
+    { 116, 1 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 6, 2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -7 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -5 },
+    { 76, 2 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -7 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -3 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -3 },
+    { 113, 2 },
+    { 116, 2 },
+    { 1, -1 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -5 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -8 },
+    { 22, -6 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -4 },
+    { 42, -3 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -7 },
+    { 46, -6 },
+    { 47, -7 },
+    { 49, 1 },
+    { 50, -5 },
+    { 51, -3 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -3 },
+    { 56, -5 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -5 },
+    { 79, -5 },
+    { 80, -2 },
+    { 81, -2 },
+    { 82, -7 },
+    { 83, -6 },
+    { 84, -9 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -4 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 103, -2 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -4 },
+    { 113, 1 },
+    { 114, -6 },
+    { 115, 1 },
+    { 1, -2 },
+    { 2, 3 },
+    { 3, -8 },
+    { 4, -3 },
+    { 8, -2 },
+    { 11, -2 },
+    { 12, -3 },
+    { 13, -3 },
+    { 14, -3 },
+    { 15, -4 },
+    { 16, -3 },
+    { 17, -2 },
+    { 18, -3 },
+    { 19, -3 },
+    { 20, -2 },
+    { 21, -10 },
+    { 22, -4 },
+    { 23, -5 },
+    { 24, -5 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -5 },
+    { 37, -6 },
+    { 38, -5 },
+    { 39, -6 },
+    { 40, -7 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -6 },
+    { 46, -8 },
+    { 47, -6 },
+    { 48, 2 },
+    { 49, 1 },
+    { 50, -5 },
+    { 51, -6 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -6 },
+    { 58, -5 },
+    { 59, -4 },
+    { 60, -6 },
+    { 61, -5 },
+    { 62, -6 },
+    { 63, -6 },
+    { 64, -5 },
+    { 65, -3 },
+    { 66, -5 },
+    { 67, -6 },
+    { 68, -7 },
+    { 69, -5 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 77, 1 },
+    { 78, -8 },
+    { 79, -5 },
+    { 80, -2 },
+    { 81, -4 },
+    { 82, -2 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -5 },
+    { 86, -6 },
+    { 87, -6 },
+    { 88, -6 },
+    { 89, -5 },
+    { 90, -2 },
+    { 91, -6 },
+    { 92, -6 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -5 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 103, -1 },
+    { 104, -5 },
+    { 105, -4 },
+    { 106, -5 },
+    { 110, -3 },
+    { 111, -5 },
+    { 113, 1 },
+    { 114, 2 },
+    { 116, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -2 },
+    { 5, -1 },
+    { 8, -2 },
+    { 11, -2 },
+    { 15, -3 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -6 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -6 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -5 },
+    { 37, -3 },
+    { 38, -6 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -7 },
+    { 47, -3 },
+    { 48, 1 },
+    { 50, -4 },
+    { 51, -5 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -6 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -5 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 103, 2 },
+    { 104, -5 },
+    { 105, -5 },
+    { 106, -5 },
+    { 111, -5 },
+    { 3, -6 },
+    { 5, -3 },
+    { 6, 2 },
+    { 8, -3 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -4 },
+    { 20, -2 },
+    { 21, -7 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -6 },
+    { 47, -3 },
+    { 48, 1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -5 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -6 },
+    { 74, -6 },
+    { 75, -4 },
+    { 76, 2 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -7 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 110, -1 },
+    { 111, -3 },
+    { 1, -2 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -2 },
+    { 7, 2 },
+    { 8, -2 },
+    { 9, -7 },
+    { 10, -6 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -8 },
+    { 16, -1 },
+    { 17, -3 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, -3 },
+    { 22, -8 },
+    { 23, -3 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -10 },
+    { 51, -3 },
+    { 52, -10 },
+    { 53, -10 },
+    { 54, -10 },
+    { 55, -5 },
+    { 56, -10 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -9 },
+    { 63, -9 },
+    { 64, -10 },
+    { 65, -10 },
+    { 66, -10 },
+    { 67, -9 },
+    { 68, -10 },
+    { 69, -7 },
+    { 70, -10 },
+    { 71, -10 },
+    { 72, -10 },
+    { 73, -9 },
+    { 74, -10 },
+    { 75, -9 },
+    { 77, 2 },
+    { 78, -4 },
+    { 79, -9 },
+    { 80, -2 },
+    { 82, -10 },
+    { 83, -8 },
+    { 84, -8 },
+    { 85, -5 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -5 },
+    { 90, -5 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, -6 },
+    { 97, -10 },
+    { 98, -10 },
+    { 103, -5 },
+    { 104, -4 },
+    { 105, -10 },
+    { 106, -4 },
+    { 110, -7 },
+    { 111, -10 },
+    { 112, 2 },
+    { 114, -3 },
+    { 115, 2 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 2 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -5 },
+    { 76, 1 },
+    { 77, 2 },
+    { 78, -4 },
+    { 79, -4 },
+    { 82, -6 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 103, 1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -4 },
+    { 112, 2 },
+    { 113, 1 },
+    { 115, 2 },
+    { 116, 1 },
+    { 1, -2 },
+    { 2, 3 },
+    { 3, -8 },
+    { 4, -3 },
+    { 7, 2 },
+    { 8, -2 },
+    { 11, -3 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -6 },
+    { 16, -2 },
+    { 17, -4 },
+    { 18, -1 },
+    { 19, -4 },
+    { 20, -3 },
+    { 21, -5 },
+    { 22, -8 },
+    { 23, -3 },
+    { 24, -6 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -11 },
+    { 32, -6 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -4 },
+    { 40, -7 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -7 },
+    { 51, -3 },
+    { 52, -7 },
+    { 53, -7 },
+    { 54, -7 },
+    { 55, -5 },
+    { 56, -7 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -7 },
+    { 63, -6 },
+    { 64, -7 },
+    { 65, -7 },
+    { 66, -7 },
+    { 67, -6 },
+    { 68, -8 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -7 },
+    { 74, -5 },
+    { 75, -8 },
+    { 77, 1 },
+    { 78, -4 },
+    { 79, -7 },
+    { 80, -3 },
+    { 82, -10 },
+    { 83, -8 },
+    { 84, -8 },
+    { 85, -6 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -6 },
+    { 90, -6 },
+    { 91, -3 },
+    { 92, -3 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -6 },
+    { 97, -7 },
+    { 98, -7 },
+    { 103, -3 },
+    { 104, -4 },
+    { 105, -7 },
+    { 106, -4 },
+    { 110, -3 },
+    { 111, -7 },
+    { 112, 1 },
+    { 114, -2 },
+    { 115, 1 },
+    { 1, -2 },
+    { 2, 4 },
+    { 3, -7 },
+    { 4, -2 },
+    { 7, 2 },
+    { 8, -2 },
+    { 11, -3 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -5 },
+    { 16, -2 },
+    { 17, -3 },
+    { 18, -1 },
+    { 19, -3 },
+    { 20, -2 },
+    { 22, -6 },
+    { 23, -3 },
+    { 24, -6 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -6 },
+    { 51, -3 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -4 },
+    { 56, -6 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -6 },
+    { 63, -6 },
+    { 64, -6 },
+    { 65, -6 },
+    { 66, -6 },
+    { 67, -6 },
+    { 68, -7 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -7 },
+    { 77, 2 },
+    { 78, -4 },
+    { 79, -6 },
+    { 80, -3 },
+    { 82, -8 },
+    { 83, -6 },
+    { 84, -6 },
+    { 85, -6 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -5 },
+    { 90, -5 },
+    { 91, -3 },
+    { 92, -3 },
+    { 93, -1 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 103, -2 },
+    { 104, -4 },
+    { 105, -6 },
+    { 106, -4 },
+    { 110, -2 },
+    { 111, -6 },
+    { 112, 2 },
+    { 114, -1 },
+    { 115, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, 1 },
+    { 8, -5 },
+    { 11, -3 },
+    { 14, -1 },
+    { 15, -4 },
+    { 17, -3 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -7 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -7 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -6 },
+    { 37, -3 },
+    { 38, -7 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 48, 2 },
+    { 50, -5 },
+    { 51, -4 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -4 },
+    { 56, -6 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -6 },
+    { 65, -4 },
+    { 66, -6 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -7 },
+    { 70, -6 },
+    { 71, -8 },
+    { 72, -6 },
+    { 73, -3 },
+    { 74, -8 },
+    { 75, -3 },
+    { 78, -5 },
+    { 79, -6 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -7 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -6 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -4 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -6 },
+    { 103, -1 },
+    { 104, -5 },
+    { 105, -6 },
+    { 106, -4 },
+    { 111, -6 },
+    { 114, 1 },
+    { 1, -2 },
+    { 2, 3 },
+    { 3, -8 },
+    { 4, -4 },
+    { 7, 2 },
+    { 8, -3 },
+    { 11, -4 },
+    { 12, -4 },
+    { 13, -2 },
+    { 14, -3 },
+    { 15, -8 },
+    { 16, -2 },
+    { 17, -4 },
+    { 18, -2 },
+    { 19, -4 },
+    { 20, -4 },
+    { 21, -5 },
+    { 22, -8 },
+    { 23, -3 },
+    { 24, -7 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -7 },
+    { 37, -4 },
+    { 38, -7 },
+    { 39, -4 },
+    { 40, -7 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 50, -9 },
+    { 51, -3 },
+    { 52, -8 },
+    { 53, -9 },
+    { 54, -9 },
+    { 55, -6 },
+    { 56, -8 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -8 },
+    { 63, -7 },
+    { 64, -8 },
+    { 65, -8 },
+    { 66, -8 },
+    { 67, -8 },
+    { 68, -9 },
+    { 69, -8 },
+    { 70, -6 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -8 },
+    { 74, -6 },
+    { 75, -8 },
+    { 76, -1 },
+    { 77, 1 },
+    { 78, -4 },
+    { 79, -8 },
+    { 80, -4 },
+    { 81, -1 },
+    { 82, -10 },
+    { 83, -8 },
+    { 84, -8 },
+    { 85, -7 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -7 },
+    { 90, -7 },
+    { 91, -3 },
+    { 92, -3 },
+    { 93, -2 },
+    { 94, -4 },
+    { 95, -3 },
+    { 96, -6 },
+    { 97, -9 },
+    { 98, -8 },
+    { 103, -5 },
+    { 104, -4 },
+    { 105, -8 },
+    { 106, -4 },
+    { 110, -4 },
+    { 111, -8 },
+    { 112, 1 },
+    { 114, -3 },
+    { 2, 4 },
+    { 3, -4 },
+    { 4, -2 },
+    { 7, 2 },
+    { 8, -2 },
+    { 11, -3 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -3 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -6 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, 2 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -5 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -5 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -7 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -6 },
+    { 75, -3 },
+    { 77, 2 },
+    { 78, -4 },
+    { 79, -5 },
+    { 80, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -6 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -5 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -5 },
+    { 104, -4 },
+    { 105, -5 },
+    { 106, -4 },
+    { 110, -1 },
+    { 111, -5 },
+    { 112, 2 },
+    { 115, 2 },
+    { 2, 3 },
+    { 15, -2 },
+    { 18, 1 },
+    { 22, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, 3 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 44, 2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 66, -1 },
+    { 67, -2 },
+    { 68, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 75, -2 },
+    { 112, 1 },
+    { 115, 1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 22, 2 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 4 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 40, 2 },
+    { 45, 2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 68, 1 },
+    { 103, 2 },
+    { 114, 1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -2 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -2 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -8 },
+    { 47, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -2 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 2 },
+    { 103, 1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 111, -4 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -5 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -6 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -2 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -9 },
+    { 47, -3 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -5 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -6 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 102, 1 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 2, 1 },
+    { 3, -4 },
+    { 4, -2 },
+    { 5, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 11, -2 },
+    { 15, -6 },
+    { 17, -2 },
+    { 18, -5 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -3 },
+    { 49, -2 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -4 },
+    { 56, -5 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -3 },
+    { 77, -2 },
+    { 78, -7 },
+    { 79, -5 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -5 },
+    { 102, 2 },
+    { 104, -5 },
+    { 105, -5 },
+    { 106, -4 },
+    { 111, -5 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 7, 1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 46, -3 },
+    { 47, -3 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -3 },
+    { 77, 1 },
+    { 78, -4 },
+    { 79, -4 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, 4 },
+    { 100, 1 },
+    { 101, 5 },
+    { 102, 4 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, 3 },
+    { 108, 6 },
+    { 109, 1 },
+    { 111, -3 },
+    { 112, 1 },
+    { 115, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 15, -1 },
+    { 18, -5 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -2 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -9 },
+    { 47, -3 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -3 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 102, 1 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 7, 1 },
+    { 9, -4 },
+    { 10, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -4 },
+    { 19, -1 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -5 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -4 },
+    { 79, -4 },
+    { 80, -2 },
+    { 82, -6 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, 4 },
+    { 100, 1 },
+    { 101, 4 },
+    { 102, 4 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, 3 },
+    { 108, 5 },
+    { 111, -3 },
+    { 113, 1 },
+    { 114, -1 },
+    { 116, 1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 9, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 18, -5 },
+    { 21, -7 },
+    { 22, -2 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -6 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -4 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -3 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -2 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 102, 4 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 109, 1 },
+    { 110, -1 },
+    { 111, -3 },
+    { 113, 1 },
+    { 116, 1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -2 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -4 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -8 },
+    { 47, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -2 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 2 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 107, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 111, -3 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -2 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -5 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -3 },
+    { 78, -5 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -2 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, 2 },
+    { 100, 1 },
+    { 101, 5 },
+    { 102, 4 },
+    { 103, 1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -3 },
+    { 107, 2 },
+    { 108, 5 },
+    { 109, 1 },
+    { 111, -4 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 19, -1 },
+    { 21, -4 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -4 },
+    { 46, -2 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -4 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, -3 },
+    { 75, -4 },
+    { 77, 1 },
+    { 78, -4 },
+    { 79, -3 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -2 },
+    { 91, -2 },
+    { 92, -2 },
+    { 94, -1 },
+    { 95, -2 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, 3 },
+    { 100, 1 },
+    { 101, 5 },
+    { 102, 4 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, 3 },
+    { 108, 6 },
+    { 109, 2 },
+    { 111, -3 },
+    { 112, 1 },
+    { 113, 1 },
+    { 115, 1 },
+    { 116, 1 },
+    { 1, 1 },
+    { 3, -5 },
+    { 4, -3 },
+    { 5, -3 },
+    { 8, -6 },
+    { 11, -4 },
+    { 13, 2 },
+    { 14, -1 },
+    { 15, -6 },
+    { 16, 2 },
+    { 17, -4 },
+    { 18, -5 },
+    { 19, -3 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -8 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -7 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -7 },
+    { 37, -3 },
+    { 38, -7 },
+    { 39, -3 },
+    { 40, -5 },
+    { 41, -10 },
+    { 42, -6 },
+    { 43, -10 },
+    { 44, -8 },
+    { 45, -3 },
+    { 46, -9 },
+    { 47, -3 },
+    { 48, 1 },
+    { 49, -1 },
+    { 50, -6 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -4 },
+    { 56, -6 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -6 },
+    { 65, -4 },
+    { 66, -6 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -7 },
+    { 70, -6 },
+    { 71, -7 },
+    { 72, -6 },
+    { 73, -3 },
+    { 74, -7 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -6 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -8 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -7 },
+    { 90, -2 },
+    { 91, -6 },
+    { 92, -6 },
+    { 95, -6 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, 2 },
+    { 100, 2 },
+    { 101, 2 },
+    { 102, 2 },
+    { 103, -1 },
+    { 104, -6 },
+    { 105, -6 },
+    { 106, -6 },
+    { 107, 2 },
+    { 108, 2 },
+    { 109, 2 },
+    { 111, -6 },
+    { 112, -1 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -3 },
+    { 8, -3 },
+    { 11, -2 },
+    { 15, -4 },
+    { 17, -2 },
+    { 18, -3 },
+    { 19, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -5 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -5 },
+    { 37, -3 },
+    { 38, -5 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -6 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -6 },
+    { 47, -3 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -3 },
+    { 74, -6 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -5 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -5 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, 2 },
+    { 100, 1 },
+    { 101, 2 },
+    { 102, 1 },
+    { 103, 1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, 1 },
+    { 108, 3 },
+    { 109, 1 },
+    { 111, -4 },
+    { 2, 2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 8, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 18, -4 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -8 },
+    { 47, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 111, -3 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 5, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -2 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -4 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -9 },
+    { 47, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 2 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -4 },
+    { 107, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 111, -3 },
+    { 2, 2 },
+    { 3, -5 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 18, -6 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -5 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -8 },
+    { 47, -3 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -5 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -6 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -3 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 102, 1 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 2, 2 },
+    { 3, -5 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -6 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -8 },
+    { 47, -3 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -5 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -6 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 102, 1 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 1, 1 },
+    { 3, -6 },
+    { 4, -3 },
+    { 5, -3 },
+    { 8, -2 },
+    { 9, 1 },
+    { 10, 1 },
+    { 11, -3 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, -4 },
+    { 16, 1 },
+    { 17, -3 },
+    { 18, -5 },
+    { 19, -2 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -6 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -6 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -6 },
+    { 37, -3 },
+    { 38, -6 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -10 },
+    { 42, -6 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -3 },
+    { 46, -9 },
+    { 47, -3 },
+    { 50, -5 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -6 },
+    { 65, -3 },
+    { 66, -5 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -6 },
+    { 81, -5 },
+    { 82, -2 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -6 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -6 },
+    { 90, -1 },
+    { 91, -6 },
+    { 92, -6 },
+    { 95, -5 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -6 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, -1 },
+    { 104, -6 },
+    { 105, -4 },
+    { 106, -5 },
+    { 107, 1 },
+    { 108, 1 },
+    { 109, 2 },
+    { 111, -6 },
+    { 114, 1 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -6 },
+    { 4, -1 },
+    { 9, -5 },
+    { 10, -4 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -3 },
+    { 15, -4 },
+    { 18, -8 },
+    { 19, -2 },
+    { 21, -8 },
+    { 22, -5 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -8 },
+    { 46, -6 },
+    { 47, -8 },
+    { 49, -1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -6 },
+    { 79, -3 },
+    { 80, -2 },
+    { 81, -3 },
+    { 82, -7 },
+    { 83, -5 },
+    { 84, -5 },
+    { 85, -3 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -3 },
+    { 102, 4 },
+    { 103, 1 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 113, 1 },
+    { 114, -2 },
+    { 116, 1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 5, -2 },
+    { 6, 1 },
+    { 8, -3 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -6 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -2 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -6 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -5 },
+    { 46, -8 },
+    { 47, -3 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -6 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -5 },
+    { 74, -5 },
+    { 75, -4 },
+    { 76, 1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -6 },
+    { 83, -2 },
+    { 84, -3 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 2 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 111, -3 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 15, -4 },
+    { 18, -5 },
+    { 19, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -7 },
+    { 42, -3 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -3 },
+    { 46, -7 },
+    { 47, -3 },
+    { 49, -1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -6 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 102, 3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 10, 1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 18, -4 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -3 },
+    { 46, -7 },
+    { 47, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 4 },
+    { 103, 2 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 111, -3 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 9, -5 },
+    { 10, -3 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -5 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -9 },
+    { 19, -1 },
+    { 22, -6 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -8 },
+    { 46, -6 },
+    { 47, -7 },
+    { 50, -5 },
+    { 51, -3 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -3 },
+    { 56, -5 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -7 },
+    { 79, -5 },
+    { 80, -2 },
+    { 81, -3 },
+    { 82, -7 },
+    { 83, -6 },
+    { 84, -6 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -5 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 102, 4 },
+    { 103, -1 },
+    { 104, -5 },
+    { 105, -5 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -5 },
+    { 114, -2 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 9, -3 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -4 },
+    { 15, -3 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -8 },
+    { 19, -1 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -6 },
+    { 47, -5 },
+    { 49, -1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -6 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -7 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 102, 4 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -4 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -2 },
+    { 5, -1 },
+    { 8, -2 },
+    { 11, -2 },
+    { 15, -5 },
+    { 17, -2 },
+    { 18, -4 },
+    { 19, -2 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -3 },
+    { 46, -7 },
+    { 47, -3 },
+    { 49, -2 },
+    { 50, -5 },
+    { 51, -4 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -4 },
+    { 56, -6 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -6 },
+    { 65, -4 },
+    { 66, -6 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 77, -2 },
+    { 78, -7 },
+    { 79, -6 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -5 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -6 },
+    { 102, 3 },
+    { 103, -1 },
+    { 104, -6 },
+    { 105, -6 },
+    { 106, -4 },
+    { 111, -6 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 8, -1 },
+    { 9, -4 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -4 },
+    { 15, -3 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -9 },
+    { 19, -1 },
+    { 22, -5 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -7 },
+    { 46, -6 },
+    { 47, -6 },
+    { 49, -1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -6 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -7 },
+    { 83, -5 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 102, 4 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -4 },
+    { 114, -1 },
+    { 1, 1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 13, 1 },
+    { 15, -5 },
+    { 16, 1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -3 },
+    { 46, -7 },
+    { 47, -3 },
+    { 49, -1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 4 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -3 },
+    { 107, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 111, -4 },
+    { 113, 1 },
+    { 2, 3 },
+    { 15, -2 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 3 },
+    { 34, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 1 },
+    { 44, 2 },
+    { 46, 1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 77, 1 },
+    { 112, 1 },
+    { 115, 1 },
+    { 5, -3 },
+    { 6, 1 },
+    { 11, 1 },
+    { 17, 1 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 42, 1 },
+    { 46, -1 },
+    { 47, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 56, 1 },
+    { 64, 1 },
+    { 66, 1 },
+    { 76, 1 },
+    { 93, 1 },
+    { 103, 2 },
+    { 1, -3 },
+    { 3, -7 },
+    { 4, -4 },
+    { 8, -4 },
+    { 11, -4 },
+    { 12, -4 },
+    { 13, -3 },
+    { 14, -4 },
+    { 15, -5 },
+    { 16, -3 },
+    { 17, -4 },
+    { 18, -3 },
+    { 19, -4 },
+    { 20, -4 },
+    { 21, -5 },
+    { 22, -4 },
+    { 23, -6 },
+    { 24, -6 },
+    { 25, -6 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -6 },
+    { 31, -7 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -6 },
+    { 39, -6 },
+    { 40, -6 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -6 },
+    { 47, -6 },
+    { 50, -6 },
+    { 51, -5 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -6 },
+    { 56, -6 },
+    { 57, -6 },
+    { 58, -6 },
+    { 59, -8 },
+    { 60, -6 },
+    { 61, -6 },
+    { 62, -6 },
+    { 63, -6 },
+    { 64, -6 },
+    { 65, -7 },
+    { 66, -6 },
+    { 67, -6 },
+    { 68, -6 },
+    { 69, -6 },
+    { 70, -6 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -6 },
+    { 74, -6 },
+    { 75, -6 },
+    { 78, -7 },
+    { 79, -6 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -6 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -6 },
+    { 86, -6 },
+    { 87, -6 },
+    { 88, -6 },
+    { 89, -6 },
+    { 90, -6 },
+    { 91, -6 },
+    { 92, -6 },
+    { 94, -4 },
+    { 95, -5 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 104, -6 },
+    { 105, -6 },
+    { 106, -6 },
+    { 110, -4 },
+    { 111, -6 },
+    { 3, -4 },
+    { 4, -2 },
+    { 8, -2 },
+    { 11, -2 },
+    { 15, -5 },
+    { 17, -2 },
+    { 18, -4 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -7 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -3 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -4 },
+    { 56, -5 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -5 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -5 },
+    { 104, -5 },
+    { 105, -5 },
+    { 106, -4 },
+    { 111, -5 },
+    { 1, 2 },
+    { 3, -2 },
+    { 15, -1 },
+    { 21, -4 },
+    { 24, -3 },
+    { 28, -2 },
+    { 36, -3 },
+    { 38, -2 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 46, -3 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 59, -3 },
+    { 64, -2 },
+    { 66, -2 },
+    { 68, -1 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -4 },
+    { 74, -4 },
+    { 78, -3 },
+    { 79, -2 },
+    { 80, 1 },
+    { 85, -3 },
+    { 89, -3 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, 1 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -2 },
+    { 104, -2 },
+    { 105, -2 },
+    { 106, -2 },
+    { 111, -2 },
+    { 3, -3 },
+    { 15, -1 },
+    { 18, 1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 24, -3 },
+    { 27, -1 },
+    { 28, -2 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -3 },
+    { 37, -1 },
+    { 38, -3 },
+    { 39, -1 },
+    { 40, -3 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -2 },
+    { 78, -1 },
+    { 79, -2 },
+    { 81, 2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -2 },
+    { 104, -1 },
+    { 105, -2 },
+    { 111, -2 },
+    { 1, -4 },
+    { 3, -8 },
+    { 4, -5 },
+    { 8, -4 },
+    { 11, -4 },
+    { 12, -5 },
+    { 13, -4 },
+    { 14, -6 },
+    { 15, -6 },
+    { 16, -4 },
+    { 17, -4 },
+    { 18, -10 },
+    { 19, -5 },
+    { 20, -4 },
+    { 21, -12 },
+    { 22, -7 },
+    { 23, -7 },
+    { 24, -7 },
+    { 25, -7 },
+    { 26, -7 },
+    { 27, -8 },
+    { 28, -7 },
+    { 29, -7 },
+    { 30, -8 },
+    { 31, -10 },
+    { 32, -8 },
+    { 33, -8 },
+    { 34, -7 },
+    { 35, -8 },
+    { 36, -7 },
+    { 37, -8 },
+    { 38, -7 },
+    { 39, -8 },
+    { 40, -8 },
+    { 41, -14 },
+    { 42, -7 },
+    { 43, -9 },
+    { 44, -8 },
+    { 45, -9 },
+    { 46, -10 },
+    { 47, -8 },
+    { 50, -7 },
+    { 51, -7 },
+    { 52, -7 },
+    { 53, -7 },
+    { 54, -7 },
+    { 55, -7 },
+    { 56, -7 },
+    { 57, -7 },
+    { 58, -7 },
+    { 59, -11 },
+    { 60, -7 },
+    { 61, -7 },
+    { 62, -8 },
+    { 63, -7 },
+    { 64, -7 },
+    { 65, -8 },
+    { 66, -7 },
+    { 67, -8 },
+    { 68, -8 },
+    { 69, -7 },
+    { 70, -7 },
+    { 71, -7 },
+    { 72, -7 },
+    { 73, -8 },
+    { 74, -6 },
+    { 75, -8 },
+    { 78, -10 },
+    { 79, -7 },
+    { 80, -4 },
+    { 81, -6 },
+    { 82, -3 },
+    { 83, -7 },
+    { 84, -7 },
+    { 85, -7 },
+    { 86, -8 },
+    { 87, -8 },
+    { 88, -8 },
+    { 89, -7 },
+    { 90, -7 },
+    { 91, -7 },
+    { 92, -7 },
+    { 94, -5 },
+    { 95, -7 },
+    { 96, -7 },
+    { 97, -7 },
+    { 98, -7 },
+    { 104, -7 },
+    { 105, -7 },
+    { 106, -7 },
+    { 110, -4 },
+    { 111, -7 },
+    { 3, -2 },
+    { 8, -3 },
+    { 15, -1 },
+    { 18, -3 },
+    { 21, -5 },
+    { 23, -1 },
+    { 24, -4 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -4 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -4 },
+    { 37, -1 },
+    { 38, -4 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -8 },
+    { 42, -3 },
+    { 43, -8 },
+    { 44, -6 },
+    { 45, -1 },
+    { 46, -7 },
+    { 47, -1 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -5 },
+    { 70, -3 },
+    { 71, -6 },
+    { 72, -4 },
+    { 73, -1 },
+    { 74, -6 },
+    { 75, -1 },
+    { 78, -5 },
+    { 79, -3 },
+    { 82, -1 },
+    { 85, -4 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -4 },
+    { 90, -1 },
+    { 91, -3 },
+    { 92, -3 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 3, -2 },
+    { 8, -2 },
+    { 21, -3 },
+    { 23, -1 },
+    { 24, -3 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -3 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -6 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -3 },
+    { 37, -1 },
+    { 38, -3 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -2 },
+    { 47, -1 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -1 },
+    { 74, -5 },
+    { 75, -1 },
+    { 78, -3 },
+    { 79, -2 },
+    { 82, -1 },
+    { 85, -3 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -3 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -2 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -2 },
+    { 98, -2 },
+    { 104, -2 },
+    { 105, -2 },
+    { 106, -2 },
+    { 111, -2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -2 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -7 },
+    { 70, -4 },
+    { 71, -7 },
+    { 72, -6 },
+    { 73, -3 },
+    { 74, -7 },
+    { 75, -3 },
+    { 78, -4 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 110, -1 },
+    { 111, -4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -4 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -4 },
+    { 103, 1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 111, -4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -4 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 87, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -4 },
+    { 103, 1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 111, -4 },
+    { 31, 2 },
+    { 59, -2 },
+    { 103, 1 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -4 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, 1 },
+    { 88, 2 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -4 },
+    { 103, 1 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 111, -4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -7 },
+    { 47, -4 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -7 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -3 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -3 },
+    { 3, -6 },
+    { 4, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -7 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -7 },
+    { 47, -4 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -7 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -3 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -3 },
+    { 1, 6 },
+    { 4, 5 },
+    { 8, 5 },
+    { 11, 5 },
+    { 12, 4 },
+    { 13, 5 },
+    { 14, 4 },
+    { 15, 4 },
+    { 16, 5 },
+    { 17, 5 },
+    { 18, 4 },
+    { 19, 5 },
+    { 20, 5 },
+    { 21, 3 },
+    { 22, 2 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 2 },
+    { 28, 2 },
+    { 29, 2 },
+    { 30, 2 },
+    { 32, 2 },
+    { 33, 2 },
+    { 34, 2 },
+    { 35, 2 },
+    { 36, 2 },
+    { 37, 2 },
+    { 38, 3 },
+    { 39, 2 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 2 },
+    { 46, 2 },
+    { 47, 2 },
+    { 50, 2 },
+    { 51, 2 },
+    { 52, 2 },
+    { 53, 2 },
+    { 54, 2 },
+    { 55, 3 },
+    { 56, 2 },
+    { 57, 2 },
+    { 58, 2 },
+    { 60, 2 },
+    { 61, 2 },
+    { 62, 2 },
+    { 63, 2 },
+    { 64, 3 },
+    { 65, 1 },
+    { 66, 2 },
+    { 67, 2 },
+    { 68, 1 },
+    { 69, 3 },
+    { 70, 2 },
+    { 71, 2 },
+    { 72, 2 },
+    { 74, 2 },
+    { 75, 1 },
+    { 78, 1 },
+    { 79, 2 },
+    { 80, 6 },
+    { 81, 4 },
+    { 83, 2 },
+    { 84, 1 },
+    { 85, 2 },
+    { 86, 2 },
+    { 87, 2 },
+    { 88, 2 },
+    { 89, 2 },
+    { 90, 2 },
+    { 91, 2 },
+    { 92, 2 },
+    { 94, 5 },
+    { 95, 3 },
+    { 96, 2 },
+    { 97, 2 },
+    { 98, 2 },
+    { 104, 3 },
+    { 105, 3 },
+    { 106, 2 },
+    { 110, 5 },
+    { 111, 3 },
+    { 3, -6 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -4 },
+    { 79, -4 },
+    { 82, -6 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -5 },
+    { 78, -4 },
+    { 79, -4 },
+    { 82, -6 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -3 },
+    { 110, -1 },
+    { 111, -4 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 18, -4 },
+    { 21, -4 },
+    { 22, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -9 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -4 },
+    { 41, -7 },
+    { 42, -1 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -6 },
+    { 46, -6 },
+    { 47, -3 },
+    { 49, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -4 },
+    { 74, -2 },
+    { 75, -3 },
+    { 77, -1 },
+    { 103, 2 },
+    { 114, -4 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -1 },
+    { 5, -2 },
+    { 21, -4 },
+    { 24, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -2 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -5 },
+    { 51, -1 },
+    { 55, -2 },
+    { 59, -4 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -1 },
+    { 78, -4 },
+    { 82, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 101, 3 },
+    { 102, 2 },
+    { 103, 2 },
+    { 106, -1 },
+    { 108, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -2 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 111, -4 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -8 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -8 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -2 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 104, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 111, -4 },
+    { 3, -4 },
+    { 8, -1 },
+    { 15, -1 },
+    { 18, -5 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -2 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -3 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -9 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 3, -4 },
+    { 4, -2 },
+    { 8, -2 },
+    { 11, -2 },
+    { 15, -6 },
+    { 17, -2 },
+    { 18, -5 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -10 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -3 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -4 },
+    { 56, -5 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -5 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -5 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -2 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -5 },
+    { 104, -5 },
+    { 105, -5 },
+    { 106, -4 },
+    { 111, -5 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 1 },
+    { 29, 2 },
+    { 30, 2 },
+    { 31, 2 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 1 },
+    { 46, 1 },
+    { 51, 2 },
+    { 57, 2 },
+    { 58, 2 },
+    { 60, 2 },
+    { 61, 2 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 93, 2 },
+    { 94, 2 },
+    { 103, 2 },
+    { 31, 2 },
+    { 51, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 94, 1 },
+    { 103, 2 },
+    { 23, 4 },
+    { 24, 1 },
+    { 25, 4 },
+    { 26, 4 },
+    { 27, 3 },
+    { 28, 2 },
+    { 29, 4 },
+    { 30, 4 },
+    { 31, 2 },
+    { 32, 3 },
+    { 33, 4 },
+    { 34, 4 },
+    { 35, 3 },
+    { 36, 2 },
+    { 37, 3 },
+    { 38, 1 },
+    { 39, 3 },
+    { 40, 2 },
+    { 41, 4 },
+    { 42, 4 },
+    { 43, 4 },
+    { 44, 4 },
+    { 45, 2 },
+    { 46, 3 },
+    { 47, 2 },
+    { 51, 5 },
+    { 55, 3 },
+    { 57, 4 },
+    { 58, 4 },
+    { 59, 1 },
+    { 60, 4 },
+    { 61, 4 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 2 },
+    { 73, 1 },
+    { 75, 1 },
+    { 93, 4 },
+    { 94, 4 },
+    { 103, 2 },
+    { 23, 3 },
+    { 24, 1 },
+    { 25, 3 },
+    { 26, 2 },
+    { 27, 2 },
+    { 28, 2 },
+    { 29, 2 },
+    { 30, 3 },
+    { 31, 2 },
+    { 32, 2 },
+    { 33, 2 },
+    { 34, 2 },
+    { 35, 2 },
+    { 36, 2 },
+    { 37, 2 },
+    { 38, 1 },
+    { 39, 2 },
+    { 40, 2 },
+    { 41, 3 },
+    { 42, 3 },
+    { 43, 3 },
+    { 44, 3 },
+    { 45, 2 },
+    { 46, 3 },
+    { 47, 2 },
+    { 51, 4 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, 4 },
+    { 56, 1 },
+    { 57, 3 },
+    { 58, 4 },
+    { 60, 3 },
+    { 61, 3 },
+    { 62, 2 },
+    { 63, 3 },
+    { 64, 1 },
+    { 65, 2 },
+    { 66, 1 },
+    { 67, 3 },
+    { 68, 1 },
+    { 69, 4 },
+    { 70, 4 },
+    { 71, 4 },
+    { 72, 4 },
+    { 73, 2 },
+    { 74, 4 },
+    { 75, 2 },
+    { 93, 3 },
+    { 94, 3 },
+    { 103, 2 },
+    { 2, 4 },
+    { 6, 1 },
+    { 11, 1 },
+    { 13, 1 },
+    { 16, 1 },
+    { 17, 1 },
+    { 20, 2 },
+    { 21, -3 },
+    { 22, -2 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 2 },
+    { 30, 1 },
+    { 31, -6 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 41, -2 },
+    { 42, 2 },
+    { 44, 1 },
+    { 45, -2 },
+    { 47, -4 },
+    { 51, 1 },
+    { 55, 2 },
+    { 58, 1 },
+    { 59, -2 },
+    { 61, 1 },
+    { 69, 1 },
+    { 70, 2 },
+    { 71, 2 },
+    { 72, 2 },
+    { 74, 2 },
+    { 93, 3 },
+    { 94, 2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 3 },
+    { 102, 5 },
+    { 107, 1 },
+    { 108, 3 },
+    { 109, 1 },
+    { 113, 2 },
+    { 114, -2 },
+    { 115, 1 },
+    { 116, 1 },
+    { 3, -5 },
+    { 8, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -5 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -5 },
+    { 75, -4 },
+    { 78, -5 },
+    { 79, -3 },
+    { 82, -6 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 3, -5 },
+    { 8, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -4 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -3 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -6 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -5 },
+    { 75, -4 },
+    { 78, -6 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -6 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -3 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -3 },
+    { 92, -3 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 3, -3 },
+    { 15, -1 },
+    { 18, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -3 },
+    { 78, -5 },
+    { 79, -3 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -3 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 104, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 111, -3 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 29, 2 },
+    { 30, 2 },
+    { 31, 2 },
+    { 33, 1 },
+    { 34, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 2 },
+    { 45, 2 },
+    { 46, 2 },
+    { 47, 1 },
+    { 51, 3 },
+    { 57, 1 },
+    { 58, 2 },
+    { 60, 2 },
+    { 61, 2 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 93, 2 },
+    { 94, 1 },
+    { 103, 2 },
+    { 23, 4 },
+    { 25, 4 },
+    { 26, 4 },
+    { 27, 3 },
+    { 29, 4 },
+    { 30, 4 },
+    { 31, 2 },
+    { 32, 2 },
+    { 33, 4 },
+    { 34, 4 },
+    { 35, 3 },
+    { 37, 3 },
+    { 39, 3 },
+    { 40, 1 },
+    { 41, 4 },
+    { 42, 4 },
+    { 43, 4 },
+    { 44, 4 },
+    { 45, 4 },
+    { 46, 4 },
+    { 47, 2 },
+    { 51, 4 },
+    { 55, 2 },
+    { 57, 3 },
+    { 58, 4 },
+    { 60, 3 },
+    { 61, 4 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 93, 4 },
+    { 94, 2 },
+    { 103, 2 },
+    { 31, 2 },
+    { 57, 1 },
+    { 58, 1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 94, 1 },
+    { 103, 2 },
+    { 1, 1 },
+    { 3, -1 },
+    { 18, -2 },
+    { 21, -4 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 41, -7 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 46, -4 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -4 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 78, -4 },
+    { 79, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 98, -1 },
+    { 104, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 111, -1 },
+    { 1, 5 },
+    { 3, 1 },
+    { 4, 3 },
+    { 8, 1 },
+    { 11, 3 },
+    { 12, 4 },
+    { 13, 4 },
+    { 14, 4 },
+    { 15, 2 },
+    { 16, 4 },
+    { 17, 3 },
+    { 18, 3 },
+    { 19, 4 },
+    { 20, 4 },
+    { 22, 4 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 2 },
+    { 29, 2 },
+    { 30, 2 },
+    { 31, 1 },
+    { 32, 2 },
+    { 33, 2 },
+    { 34, 2 },
+    { 35, 2 },
+    { 37, 2 },
+    { 39, 2 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 44, 1 },
+    { 45, 2 },
+    { 46, 1 },
+    { 47, 2 },
+    { 50, 1 },
+    { 51, 2 },
+    { 57, 2 },
+    { 58, 2 },
+    { 60, 2 },
+    { 61, 2 },
+    { 62, 2 },
+    { 63, 2 },
+    { 65, 1 },
+    { 67, 2 },
+    { 68, 2 },
+    { 73, 2 },
+    { 75, 2 },
+    { 80, 4 },
+    { 81, 4 },
+    { 82, 2 },
+    { 83, 4 },
+    { 84, 4 },
+    { 86, 2 },
+    { 87, 2 },
+    { 88, 2 },
+    { 90, 2 },
+    { 91, 1 },
+    { 92, 1 },
+    { 94, 4 },
+    { 95, 2 },
+    { 96, 1 },
+    { 97, 1 },
+    { 106, 1 },
+    { 110, 4 },
+    { 1, 4 },
+    { 4, 2 },
+    { 8, 2 },
+    { 11, 3 },
+    { 12, 2 },
+    { 13, 2 },
+    { 14, 3 },
+    { 15, 2 },
+    { 16, 2 },
+    { 17, 3 },
+    { 19, 2 },
+    { 20, 2 },
+    { 21, -2 },
+    { 22, 2 },
+    { 41, -4 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -4 },
+    { 59, -2 },
+    { 78, -1 },
+    { 80, 3 },
+    { 81, 1 },
+    { 83, 2 },
+    { 84, 1 },
+    { 94, 2 },
+    { 110, 2 },
+    { 2, 3 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, -2 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 42, 1 },
+    { 55, 1 },
+    { 69, 2 },
+    { 70, 1 },
+    { 93, 1 },
+    { 113, 1 },
+    { 116, 1 },
+    { 2, 3 },
+    { 22, -2 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, -2 },
+    { 34, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 1 },
+    { 44, 2 },
+    { 46, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 77, 1 },
+    { 93, 1 },
+    { 112, 1 },
+    { 115, 1 },
+    { 22, 1 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 29, 2 },
+    { 30, 1 },
+    { 31, 3 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 40, 2 },
+    { 41, -2 },
+    { 43, -1 },
+    { 45, 1 },
+    { 46, -2 },
+    { 47, 2 },
+    { 57, 1 },
+    { 58, 1 },
+    { 61, 1 },
+    { 68, 1 },
+    { 71, -1 },
+    { 93, 1 },
+    { 94, 1 },
+    { 103, 2 },
+    { 2, 3 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, -2 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 42, 1 },
+    { 55, 1 },
+    { 69, 2 },
+    { 70, 1 },
+    { 93, 1 },
+    { 103, 1 },
+    { 113, 1 },
+    { 116, 1 },
+    { 2, 3 },
+    { 22, -2 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, -2 },
+    { 34, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 1 },
+    { 44, 2 },
+    { 49, 1 },
+    { 51, 1 },
+    { 77, 1 },
+    { 93, 1 },
+    { 112, 1 },
+    { 115, 1 },
+};
+
 static const EpdFontData opendyslexic_12_bolditalic = {
     opendyslexic_12_bolditalicBitmaps,
     opendyslexic_12_bolditalicGlyphs,
@@ -5428,4 +13946,8 @@ static const EpdFontData opendyslexic_12_bolditalic = {
     33,
     -13,
     true,
+    opendyslexic_12_bolditalicKernLeftClasses,
+    opendyslexic_12_bolditalicKernRightClasses,
+    opendyslexic_12_bolditalicKernPairOffsets,
+    opendyslexic_12_bolditalicKernPairs,
 };
@@ -4700,6 +4700,3194 @@ static const EpdUnicodeInterval opendyslexic_12_italicIntervals[] = {
     { 0x2264, 0x2265, 0x2BF },
 };
 
+static const uint8_t opendyslexic_12_italicKernLeftClasses[705] = {
+    0, 1, 2, 0, 0, 0, 0, 2, 3, 4, 5, 0, 6, 7, 8, 0,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 20,
+    0, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 0, 48, 49, 0,
+    0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 57, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 0, 76, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 77, 78, 0, 0, 0, 0, 79, 79, 80, 79, 0,
+    0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 82, 83, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 85, 86, 87, 88,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0,
+    0, 0, 0, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 79, 91, 79, 92, 93, 94, 79, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 97, 98, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t opendyslexic_12_italicKernRightClasses[705] = {
+    0, 1, 2, 0, 0, 0, 0, 3, 4, 5, 6, 0, 7, 8, 9, 0,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 0, 49, 50, 0,
+    0, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 0, 78, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 79, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 82, 83, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 85, 86, 87, 88,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 90, 0, 91, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 94, 95, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t opendyslexic_12_italicKernPairOffsets[99] = {
+    0, 6, 7, 53, 61, 66, 76, 84, 93, 107, 130, 137, 147, 174, 190, 205,
+    222, 233, 246, 249, 282, 349, 394, 433, 478, 519, 585, 653, 686, 720, 753, 810,
+    854, 906, 966, 1009, 1055, 1101, 1149, 1210, 1285, 1323, 1380, 1436, 1497, 1565, 1622, 1650,
+    1652, 1659, 1702, 1757, 1811, 1849, 1894, 1938, 1973, 2015, 2053, 2061, 2114, 2161, 2177, 2220,
+    2261, 2335, 2384, 2428, 2473, 2513, 2562, 2610, 2666, 2715, 2755, 2791, 2803, 2833, 2863, 2865,
+    2869, 2888, 2920, 2935, 2939, 2940, 2950, 2969, 2999, 3003, 3005, 3012, 3025, 3029, 3030, 3033,
+    3045, 3067, 3079,
+};
+
+static const EpdKernPair opendyslexic_12_italicKernPairs[] = {
+    { 22, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 35, -1 },
+    { 41, -1 },
+    { 66, -1 },
+    { 2, 3 },
+    { 10, -3 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -4 },
+    { 15, -1 },
+    { 16, -3 },
+    { 18, -3 },
+    { 19, -2 },
+    { 22, -2 },
+    { 24, -3 },
+    { 27, -1 },
+    { 28, -2 },
+    { 31, -1 },
+    { 32, -2 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -3 },
+    { 37, -1 },
+    { 38, -3 },
+    { 39, -1 },
+    { 40, -2 },
+    { 45, -1 },
+    { 47, -2 },
+    { 51, -3 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -1 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 83, -2 },
+    { 88, -3 },
+    { 2, 2 },
+    { 5, -2 },
+    { 17, -2 },
+    { 24, 1 },
+    { 46, -2 },
+    { 60, -1 },
+    { 66, -1 },
+    { 74, -1 },
+    { 2, 2 },
+    { 8, -2 },
+    { 41, -2 },
+    { 60, -2 },
+    { 74, -2 },
+    { 1, 1 },
+    { 5, -1 },
+    { 9, 1 },
+    { 28, -1 },
+    { 41, -6 },
+    { 46, -2 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, -1 },
+    { 75, -1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 11, -1 },
+    { 40, -7 },
+    { 41, -3 },
+    { 46, -2 },
+    { 60, -1 },
+    { 74, -2 },
+    { 1, 1 },
+    { 9, 1 },
+    { 28, -1 },
+    { 41, -6 },
+    { 46, -1 },
+    { 70, -2 },
+    { 72, -3 },
+    { 73, -1 },
+    { 75, -4 },
+    { 2, 2 },
+    { 5, -3 },
+    { 13, -1 },
+    { 17, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 43, -1 },
+    { 45, -2 },
+    { 46, -2 },
+    { 60, -3 },
+    { 66, -1 },
+    { 74, -2 },
+    { 78, -2 },
+    { 95, -2 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -2 },
+    { 8, -1 },
+    { 14, -4 },
+    { 17, -3 },
+    { 31, -3 },
+    { 41, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 46, -4 },
+    { 49, -3 },
+    { 50, -2 },
+    { 56, -1 },
+    { 60, -3 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -3 },
+    { 77, -2 },
+    { 78, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 2, 2 },
+    { 5, -2 },
+    { 14, -3 },
+    { 31, -3 },
+    { 46, -1 },
+    { 60, -3 },
+    { 78, -1 },
+    { 5, -2 },
+    { 31, -4 },
+    { 45, -1 },
+    { 46, -1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 69, -1 },
+    { 74, -2 },
+    { 78, -1 },
+    { 95, -1 },
+    { 5, -3 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 17, -2 },
+    { 19, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 41, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 46, -3 },
+    { 49, -2 },
+    { 56, -1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 78, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 5, -2 },
+    { 19, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 45, -1 },
+    { 56, -1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 5, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 45, -1 },
+    { 56, -1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 14, -2 },
+    { 21, -1 },
+    { 22, -2 },
+    { 31, -4 },
+    { 40, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 60, -3 },
+    { 63, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 74, -2 },
+    { 76, -2 },
+    { 88, -1 },
+    { 95, -2 },
+    { 5, -3 },
+    { 17, -1 },
+    { 31, -4 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -2 },
+    { 60, -3 },
+    { 66, -1 },
+    { 74, -2 },
+    { 78, -2 },
+    { 2, 2 },
+    { 5, -3 },
+    { 17, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 43, -1 },
+    { 45, -1 },
+    { 46, -2 },
+    { 60, -3 },
+    { 66, -1 },
+    { 74, -2 },
+    { 78, -2 },
+    { 95, -1 },
+    { 2, 4 },
+    { 40, 1 },
+    { 41, -2 },
+    { 12, 1 },
+    { 14, -2 },
+    { 15, 1 },
+    { 17, 2 },
+    { 23, 3 },
+    { 25, 3 },
+    { 26, 2 },
+    { 27, 2 },
+    { 28, 2 },
+    { 29, 2 },
+    { 30, 2 },
+    { 32, 1 },
+    { 33, 2 },
+    { 34, 3 },
+    { 35, 2 },
+    { 36, 1 },
+    { 37, 2 },
+    { 38, 1 },
+    { 39, 2 },
+    { 40, 1 },
+    { 41, 3 },
+    { 42, 3 },
+    { 43, 4 },
+    { 44, 4 },
+    { 45, 2 },
+    { 46, 3 },
+    { 47, 1 },
+    { 52, 2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 82, 3 },
+    { 5, -2 },
+    { 7, -1 },
+    { 10, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 17, -4 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -7 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -7 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -7 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -11 },
+    { 42, -7 },
+    { 43, -11 },
+    { 44, -9 },
+    { 45, -4 },
+    { 46, -10 },
+    { 47, -4 },
+    { 49, -4 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -6 },
+    { 71, -4 },
+    { 72, -8 },
+    { 73, -6 },
+    { 74, -2 },
+    { 75, -8 },
+    { 76, -2 },
+    { 78, -4 },
+    { 79, -4 },
+    { 80, -7 },
+    { 81, -5 },
+    { 82, 1 },
+    { 88, -1 },
+    { 92, -7 },
+    { 93, -5 },
+    { 94, -4 },
+    { 5, -3 },
+    { 17, -1 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -2 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -7 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -7 },
+    { 46, -8 },
+    { 47, -5 },
+    { 49, -1 },
+    { 54, 1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -1 },
+    { 78, -2 },
+    { 79, -7 },
+    { 80, -4 },
+    { 81, -5 },
+    { 82, 1 },
+    { 92, -5 },
+    { 93, -1 },
+    { 94, -1 },
+    { 14, -1 },
+    { 19, -1 },
+    { 22, -5 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -5 },
+    { 47, -4 },
+    { 56, -2 },
+    { 60, -4 },
+    { 66, -1 },
+    { 70, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -4 },
+    { 79, -5 },
+    { 80, -5 },
+    { 81, -5 },
+    { 92, -5 },
+    { 5, -3 },
+    { 13, -1 },
+    { 17, -2 },
+    { 22, -7 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -2 },
+    { 39, -5 },
+    { 40, -8 },
+    { 41, -8 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -9 },
+    { 46, -9 },
+    { 47, -6 },
+    { 49, -1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 60, -3 },
+    { 65, 1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 70, 1 },
+    { 74, -2 },
+    { 78, -3 },
+    { 79, -8 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -4 },
+    { 95, -1 },
+    { 5, -1 },
+    { 14, -4 },
+    { 16, -1 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 56, -1 },
+    { 60, -3 },
+    { 70, -1 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -4 },
+    { 79, -4 },
+    { 80, -6 },
+    { 81, -5 },
+    { 82, 1 },
+    { 92, -6 },
+    { 94, -1 },
+    { 1, -2 },
+    { 7, -9 },
+    { 9, -8 },
+    { 11, -1 },
+    { 14, -3 },
+    { 18, -1 },
+    { 22, -10 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -4 },
+    { 39, -6 },
+    { 40, -8 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -4 },
+    { 47, -7 },
+    { 51, -5 },
+    { 52, -2 },
+    { 53, -4 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -4 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -1 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -6 },
+    { 75, -4 },
+    { 76, -6 },
+    { 79, -12 },
+    { 80, -6 },
+    { 81, -6 },
+    { 83, -1 },
+    { 88, -1 },
+    { 90, 1 },
+    { 92, -6 },
+    { 95, -7 },
+    { 1, -1 },
+    { 5, -3 },
+    { 7, -2 },
+    { 9, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 17, -2 },
+    { 22, -7 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -2 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -8 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -8 },
+    { 45, -7 },
+    { 46, -8 },
+    { 47, -6 },
+    { 49, -2 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -4 },
+    { 57, -2 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -5 },
+    { 71, -3 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -5 },
+    { 76, -4 },
+    { 78, -2 },
+    { 79, -7 },
+    { 80, -4 },
+    { 81, -5 },
+    { 82, 1 },
+    { 92, -5 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -2 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -6 },
+    { 47, -4 },
+    { 54, 1 },
+    { 60, -3 },
+    { 79, -4 },
+    { 80, -5 },
+    { 81, -5 },
+    { 82, 1 },
+    { 92, -5 },
+    { 2, 2 },
+    { 5, -1 },
+    { 14, -1 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -2 },
+    { 31, -7 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -1 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 60, -3 },
+    { 79, -3 },
+    { 80, -4 },
+    { 81, -3 },
+    { 92, -4 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -6 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -6 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -5 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -4 },
+    { 47, -6 },
+    { 60, -1 },
+    { 66, -1 },
+    { 79, -6 },
+    { 80, -5 },
+    { 81, -5 },
+    { 92, -5 },
+    { 95, -1 },
+    { 5, -2 },
+    { 10, -2 },
+    { 14, -6 },
+    { 16, -2 },
+    { 17, -2 },
+    { 18, -2 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -9 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -9 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -9 },
+    { 37, -4 },
+    { 38, -7 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -7 },
+    { 42, -7 },
+    { 43, -7 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -7 },
+    { 47, -4 },
+    { 49, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 60, -3 },
+    { 65, -2 },
+    { 67, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -4 },
+    { 78, -2 },
+    { 79, -4 },
+    { 80, -9 },
+    { 81, -5 },
+    { 82, 1 },
+    { 88, -2 },
+    { 92, -9 },
+    { 93, -2 },
+    { 94, -3 },
+    { 5, -2 },
+    { 14, -7 },
+    { 17, -4 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -5 },
+    { 43, -10 },
+    { 44, -8 },
+    { 45, -4 },
+    { 46, -10 },
+    { 47, -4 },
+    { 49, -4 },
+    { 56, -1 },
+    { 60, -3 },
+    { 70, -1 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -4 },
+    { 78, -4 },
+    { 79, -4 },
+    { 80, -5 },
+    { 81, -5 },
+    { 82, 1 },
+    { 92, -6 },
+    { 93, -8 },
+    { 94, -8 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -6 },
+    { 47, -4 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, 2 },
+    { 55, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, 2 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 79, -4 },
+    { 80, -5 },
+    { 81, -5 },
+    { 82, 2 },
+    { 83, 1 },
+    { 88, 1 },
+    { 92, -5 },
+    { 5, 1 },
+    { 7, -2 },
+    { 9, -1 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -6 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -5 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -4 },
+    { 47, -6 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -4 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -4 },
+    { 62, -3 },
+    { 64, -4 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, -4 },
+    { 79, -6 },
+    { 80, -5 },
+    { 81, -5 },
+    { 82, 1 },
+    { 92, -5 },
+    { 95, -1 },
+    { 5, -3 },
+    { 13, -1 },
+    { 17, -1 },
+    { 22, -7 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -2 },
+    { 39, -5 },
+    { 40, -7 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -8 },
+    { 46, -8 },
+    { 47, -6 },
+    { 49, -1 },
+    { 54, 1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 70, 1 },
+    { 74, -2 },
+    { 76, -1 },
+    { 78, -3 },
+    { 79, -8 },
+    { 80, -4 },
+    { 81, -4 },
+    { 82, 1 },
+    { 92, -4 },
+    { 95, -1 },
+    { 2, 3 },
+    { 5, -2 },
+    { 7, -7 },
+    { 8, -6 },
+    { 9, -6 },
+    { 14, -4 },
+    { 22, -10 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -6 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -6 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -8 },
+    { 46, -6 },
+    { 47, -8 },
+    { 50, -1 },
+    { 51, -1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 78, -2 },
+    { 79, -13 },
+    { 80, -6 },
+    { 81, -5 },
+    { 82, 1 },
+    { 88, -2 },
+    { 92, -5 },
+    { 95, -8 },
+    { 5, -2 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -1 },
+    { 17, -2 },
+    { 22, -5 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -4 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -1 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -5 },
+    { 46, -7 },
+    { 47, -5 },
+    { 52, -1 },
+    { 60, 2 },
+    { 63, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 76, -2 },
+    { 79, -5 },
+    { 80, -4 },
+    { 81, -3 },
+    { 92, -3 },
+    { 93, -2 },
+    { 2, 1 },
+    { 5, -2 },
+    { 10, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 17, -2 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -7 },
+    { 42, -6 },
+    { 43, -8 },
+    { 44, -8 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -4 },
+    { 49, -1 },
+    { 52, -1 },
+    { 56, -1 },
+    { 60, -3 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 78, -3 },
+    { 79, -4 },
+    { 80, -6 },
+    { 81, -5 },
+    { 82, 1 },
+    { 92, -6 },
+    { 93, -2 },
+    { 94, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 17, -1 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -3 },
+    { 39, -5 },
+    { 40, -7 },
+    { 41, -8 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -8 },
+    { 45, -8 },
+    { 46, -8 },
+    { 47, -5 },
+    { 49, -2 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -3 },
+    { 61, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 2 },
+    { 67, 2 },
+    { 70, -1 },
+    { 71, 1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 78, -2 },
+    { 79, -7 },
+    { 80, -5 },
+    { 81, -5 },
+    { 82, 2 },
+    { 83, 1 },
+    { 88, 1 },
+    { 92, -5 },
+    { 93, -2 },
+    { 94, -4 },
+    { 1, -2 },
+    { 2, 3 },
+    { 6, -2 },
+    { 7, -8 },
+    { 8, -3 },
+    { 9, -6 },
+    { 10, -1 },
+    { 11, -4 },
+    { 14, -6 },
+    { 16, -1 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, -3 },
+    { 22, -11 },
+    { 23, -4 },
+    { 24, -8 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -7 },
+    { 37, -6 },
+    { 38, -5 },
+    { 39, -6 },
+    { 40, -7 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -4 },
+    { 47, -7 },
+    { 50, -4 },
+    { 51, -9 },
+    { 52, -2 },
+    { 53, -9 },
+    { 54, -9 },
+    { 55, -9 },
+    { 56, -5 },
+    { 57, -9 },
+    { 58, -4 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -5 },
+    { 64, -9 },
+    { 65, -9 },
+    { 66, -10 },
+    { 67, -9 },
+    { 68, -9 },
+    { 69, -9 },
+    { 70, -8 },
+    { 71, -10 },
+    { 72, -10 },
+    { 73, -10 },
+    { 74, -9 },
+    { 75, -10 },
+    { 76, -9 },
+    { 79, -11 },
+    { 80, -8 },
+    { 81, -7 },
+    { 82, 1 },
+    { 87, -2 },
+    { 88, -5 },
+    { 90, 1 },
+    { 92, -7 },
+    { 95, -6 },
+    { 2, 3 },
+    { 14, -1 },
+    { 22, -7 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -6 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -5 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -7 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -4 },
+    { 47, -6 },
+    { 52, 1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 74, -1 },
+    { 79, -8 },
+    { 80, -5 },
+    { 81, -5 },
+    { 82, 1 },
+    { 92, -5 },
+    { 95, -1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -4 },
+    { 16, -1 },
+    { 18, -1 },
+    { 21, -1 },
+    { 22, -12 },
+    { 23, -4 },
+    { 24, -8 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -6 },
+    { 28, -7 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -7 },
+    { 37, -6 },
+    { 38, -5 },
+    { 39, -6 },
+    { 40, -8 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -4 },
+    { 47, -7 },
+    { 51, -3 },
+    { 52, 1 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 57, -2 },
+    { 60, -3 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -3 },
+    { 79, -12 },
+    { 80, -8 },
+    { 81, -7 },
+    { 82, 1 },
+    { 83, -1 },
+    { 88, -2 },
+    { 92, -7 },
+    { 95, -5 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -3 },
+    { 16, -1 },
+    { 18, -1 },
+    { 22, -10 },
+    { 23, -4 },
+    { 24, -7 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -4 },
+    { 39, -6 },
+    { 40, -8 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -4 },
+    { 47, -7 },
+    { 51, -2 },
+    { 52, 1 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 57, -2 },
+    { 60, -3 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 74, -2 },
+    { 76, -2 },
+    { 79, -10 },
+    { 80, -7 },
+    { 81, -6 },
+    { 82, 1 },
+    { 83, -1 },
+    { 88, -2 },
+    { 90, 1 },
+    { 92, -6 },
+    { 95, -4 },
+    { 10, -2 },
+    { 14, -4 },
+    { 16, -2 },
+    { 18, -1 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -8 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -8 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -8 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 51, -1 },
+    { 52, 1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, -2 },
+    { 67, -2 },
+    { 68, 1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 75, -2 },
+    { 76, 1 },
+    { 79, -4 },
+    { 80, -8 },
+    { 81, -5 },
+    { 82, 2 },
+    { 83, 1 },
+    { 88, -2 },
+    { 92, -8 },
+    { 94, -1 },
+    { 2, 2 },
+    { 4, -2 },
+    { 7, -4 },
+    { 8, -2 },
+    { 9, -3 },
+    { 10, -2 },
+    { 11, -1 },
+    { 14, -6 },
+    { 16, -2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 21, -3 },
+    { 22, -11 },
+    { 23, -4 },
+    { 24, -9 },
+    { 25, -4 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -8 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -8 },
+    { 37, -6 },
+    { 38, -6 },
+    { 39, -6 },
+    { 40, -9 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -4 },
+    { 47, -7 },
+    { 50, -2 },
+    { 51, -4 },
+    { 52, 1 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -4 },
+    { 60, -3 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 79, -11 },
+    { 80, -9 },
+    { 81, -8 },
+    { 83, -2 },
+    { 88, -4 },
+    { 92, -8 },
+    { 95, -6 },
+    { 14, -6 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -7 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -7 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -5 },
+    { 46, -5 },
+    { 47, -4 },
+    { 52, 1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -3 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -2 },
+    { 79, -4 },
+    { 80, -7 },
+    { 81, -5 },
+    { 82, 2 },
+    { 83, 1 },
+    { 88, -1 },
+    { 92, -7 },
+    { 14, -5 },
+    { 16, -1 },
+    { 22, -4 },
+    { 24, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 51, -4 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -1 },
+    { 57, -1 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -1 },
+    { 76, -4 },
+    { 88, -4 },
+    { 14, -1 },
+    { 52, -1 },
+    { 5, -2 },
+    { 11, -2 },
+    { 40, -2 },
+    { 41, -4 },
+    { 46, -2 },
+    { 60, -2 },
+    { 74, -3 },
+    { 2, 2 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -4 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -2 },
+    { 40, 1 },
+    { 41, -9 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -3 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -2 },
+    { 87, 1 },
+    { 93, -2 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 17, -4 },
+    { 22, -4 },
+    { 23, 1 },
+    { 24, 2 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, 1 },
+    { 31, -4 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, -3 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, -9 },
+    { 42, 1 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -2 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -4 },
+    { 76, -3 },
+    { 82, 1 },
+    { 93, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -2 },
+    { 8, -5 },
+    { 10, -1 },
+    { 14, -5 },
+    { 16, -1 },
+    { 17, -4 },
+    { 18, -1 },
+    { 22, -2 },
+    { 24, -1 },
+    { 27, -2 },
+    { 28, -4 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, 1 },
+    { 41, -9 },
+    { 42, -1 },
+    { 43, -2 },
+    { 44, -2 },
+    { 46, -3 },
+    { 50, -2 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -2 },
+    { 75, -4 },
+    { 76, -2 },
+    { 77, -2 },
+    { 88, -2 },
+    { 93, -2 },
+    { 94, -1 },
+    { 2, 2 },
+    { 14, -1 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 31, -4 },
+    { 35, -3 },
+    { 41, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 84, 1 },
+    { 86, 2 },
+    { 87, 2 },
+    { 89, 1 },
+    { 90, 2 },
+    { 2, 2 },
+    { 5, -2 },
+    { 7, -1 },
+    { 17, -4 },
+    { 22, -3 },
+    { 24, 1 },
+    { 25, 1 },
+    { 27, -3 },
+    { 28, -2 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 41, -9 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -4 },
+    { 76, -2 },
+    { 93, -2 },
+    { 2, 2 },
+    { 7, -3 },
+    { 9, -2 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -3 },
+    { 22, -6 },
+    { 27, -3 },
+    { 28, -2 },
+    { 31, -4 },
+    { 35, -3 },
+    { 41, -2 },
+    { 47, -2 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 84, 1 },
+    { 87, 2 },
+    { 88, -2 },
+    { 95, -3 },
+    { 2, 2 },
+    { 5, -1 },
+    { 17, -4 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -2 },
+    { 35, -3 },
+    { 41, -10 },
+    { 46, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -1 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 87, 2 },
+    { 2, 1 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -4 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -2 },
+    { 40, 1 },
+    { 41, -9 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -2 },
+    { 75, -4 },
+    { 76, -2 },
+    { 93, -2 },
+    { 2, 2 },
+    { 14, -1 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -2 },
+    { 40, 1 },
+    { 41, -3 },
+    { 45, 1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 87, 1 },
+    { 90, 2 },
+    { 2, 3 },
+    { 44, 1 },
+    { 70, -1 },
+    { 84, 2 },
+    { 86, 1 },
+    { 87, 2 },
+    { 89, 1 },
+    { 90, 2 },
+    { 5, -1 },
+    { 6, -4 },
+    { 8, -4 },
+    { 10, -2 },
+    { 14, -6 },
+    { 16, -3 },
+    { 17, -4 },
+    { 18, -2 },
+    { 22, -2 },
+    { 24, -2 },
+    { 27, -2 },
+    { 28, -6 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, -3 },
+    { 38, -3 },
+    { 41, -9 },
+    { 42, -2 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, 1 },
+    { 46, -5 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -3 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -5 },
+    { 66, -2 },
+    { 67, -5 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -5 },
+    { 71, -4 },
+    { 72, -5 },
+    { 73, -5 },
+    { 74, -2 },
+    { 75, -5 },
+    { 76, -2 },
+    { 77, -2 },
+    { 88, -2 },
+    { 93, -4 },
+    { 94, -3 },
+    { 6, -1 },
+    { 10, -1 },
+    { 14, -4 },
+    { 16, -1 },
+    { 17, -2 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -4 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 40, 1 },
+    { 41, -5 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -2 },
+    { 75, -4 },
+    { 76, -2 },
+    { 77, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 2, 2 },
+    { 5, -1 },
+    { 17, -4 },
+    { 31, -4 },
+    { 34, 1 },
+    { 40, 1 },
+    { 41, -5 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -4 },
+    { 60, -3 },
+    { 70, -1 },
+    { 72, -1 },
+    { 75, -2 },
+    { 93, -2 },
+    { 2, 1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 17, -5 },
+    { 22, -4 },
+    { 24, 1 },
+    { 27, -3 },
+    { 28, -2 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 41, -9 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -2 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -4 },
+    { 76, -3 },
+    { 93, -2 },
+    { 95, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 17, -5 },
+    { 22, -4 },
+    { 27, -3 },
+    { 28, -2 },
+    { 31, -4 },
+    { 35, -3 },
+    { 41, -9 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -2 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -4 },
+    { 76, -2 },
+    { 93, -2 },
+    { 95, -1 },
+    { 1, -2 },
+    { 9, -2 },
+    { 10, -2 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -3 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -7 },
+    { 18, -2 },
+    { 19, -1 },
+    { 21, -2 },
+    { 22, -6 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -6 },
+    { 28, -5 },
+    { 29, -2 },
+    { 30, -2 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -6 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -12 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -4 },
+    { 47, -3 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -5 },
+    { 59, -4 },
+    { 61, -5 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -2 },
+    { 67, -5 },
+    { 68, -5 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -3 },
+    { 76, -5 },
+    { 77, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 2, 2 },
+    { 5, -2 },
+    { 7, -4 },
+    { 8, -2 },
+    { 9, -3 },
+    { 11, -3 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -2 },
+    { 17, -6 },
+    { 22, -6 },
+    { 27, -3 },
+    { 28, -2 },
+    { 31, -4 },
+    { 35, -3 },
+    { 41, -9 },
+    { 43, -1 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -4 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 87, 2 },
+    { 88, -2 },
+    { 95, -4 },
+    { 2, 2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 14, -1 },
+    { 17, -4 },
+    { 22, -3 },
+    { 27, -2 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -2 },
+    { 41, -9 },
+    { 43, -2 },
+    { 44, -2 },
+    { 46, -3 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -2 },
+    { 76, -2 },
+    { 87, 1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 2, 2 },
+    { 5, -2 },
+    { 6, -2 },
+    { 8, -2 },
+    { 14, -4 },
+    { 17, -4 },
+    { 21, -1 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -4 },
+    { 35, -2 },
+    { 41, -6 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 87, 1 },
+    { 93, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 17, -4 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -2 },
+    { 40, 1 },
+    { 41, -9 },
+    { 43, -1 },
+    { 45, 1 },
+    { 46, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 87, 1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -5 },
+    { 9, -3 },
+    { 11, -3 },
+    { 12, -4 },
+    { 13, -4 },
+    { 14, -3 },
+    { 17, -8 },
+    { 22, -7 },
+    { 27, -3 },
+    { 28, -2 },
+    { 31, -4 },
+    { 35, -4 },
+    { 41, -10 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -4 },
+    { 51, -4 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -4 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 77, -1 },
+    { 87, 2 },
+    { 88, -2 },
+    { 95, -5 },
+    { 1, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -3 },
+    { 9, -1 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 17, -7 },
+    { 22, -6 },
+    { 27, -3 },
+    { 28, -2 },
+    { 31, -4 },
+    { 35, -4 },
+    { 41, -10 },
+    { 45, -2 },
+    { 46, -2 },
+    { 47, -2 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 87, 2 },
+    { 88, -1 },
+    { 95, -3 },
+    { 2, 1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, -2 },
+    { 10, -1 },
+    { 14, -5 },
+    { 16, -1 },
+    { 17, -4 },
+    { 18, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 24, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 31, -4 },
+    { 35, -2 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 41, -9 },
+    { 42, -1 },
+    { 43, -2 },
+    { 44, -2 },
+    { 46, -3 },
+    { 50, -2 },
+    { 51, -4 },
+    { 52, -2 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -4 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 88, -3 },
+    { 93, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -3 },
+    { 9, -1 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 17, -7 },
+    { 22, -6 },
+    { 27, -3 },
+    { 28, -2 },
+    { 31, -4 },
+    { 35, -4 },
+    { 41, -10 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -2 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -2 },
+    { 76, -4 },
+    { 77, -1 },
+    { 87, 2 },
+    { 88, -1 },
+    { 95, -4 },
+    { 5, -1 },
+    { 14, -4 },
+    { 17, -4 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -2 },
+    { 41, -9 },
+    { 43, -1 },
+    { 46, -2 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 87, 2 },
+    { 88, -1 },
+    { 10, -2 },
+    { 11, -1 },
+    { 14, -5 },
+    { 16, -2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 22, -4 },
+    { 24, -3 },
+    { 28, -2 },
+    { 32, -1 },
+    { 35, -1 },
+    { 36, -3 },
+    { 38, -3 },
+    { 40, -2 },
+    { 47, -4 },
+    { 51, -4 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -1 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -1 },
+    { 76, -4 },
+    { 83, -1 },
+    { 88, -4 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 17, -2 },
+    { 56, -1 },
+    { 60, -2 },
+    { 66, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 79, -4 },
+    { 80, -6 },
+    { 81, -5 },
+    { 92, -6 },
+    { 22, -5 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -5 },
+    { 47, -4 },
+    { 79, -5 },
+    { 80, -5 },
+    { 81, -5 },
+    { 92, -5 },
+    { 60, -3 },
+    { 90, 1 },
+    { 52, 2 },
+    { 60, -3 },
+    { 61, 1 },
+    { 90, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 2 },
+    { 31, -2 },
+    { 33, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 4 },
+    { 39, 1 },
+    { 42, 1 },
+    { 80, 1 },
+    { 81, 1 },
+    { 92, 1 },
+    { 5, -3 },
+    { 11, -3 },
+    { 12, -4 },
+    { 13, -2 },
+    { 14, -1 },
+    { 17, -6 },
+    { 22, -2 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 31, -4 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, -1 },
+    { 41, -5 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -3 },
+    { 49, -4 },
+    { 60, -3 },
+    { 66, -1 },
+    { 72, -1 },
+    { 74, -4 },
+    { 75, -1 },
+    { 76, -2 },
+    { 78, -4 },
+    { 93, -1 },
+    { 95, -8 },
+    { 5, -2 },
+    { 14, -1 },
+    { 17, -1 },
+    { 31, -4 },
+    { 34, 1 },
+    { 41, -1 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -2 },
+    { 60, -3 },
+    { 74, -2 },
+    { 90, 1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 60, -3 },
+    { 86, 1 },
+    { 87, 1 },
+    { 90, 1 },
+    { 60, -3 },
+    { 52, 2 },
+    { 58, 1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 83, 1 },
+    { 86, 4 },
+    { 87, 4 },
+    { 89, 3 },
+    { 90, 4 },
+    { 52, 2 },
+    { 56, 2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 70, 2 },
+    { 71, 2 },
+    { 72, 2 },
+    { 73, 2 },
+    { 75, 2 },
+    { 83, 1 },
+    { 84, 1 },
+    { 86, 4 },
+    { 87, 4 },
+    { 89, 3 },
+    { 90, 4 },
+    { 11, -3 },
+    { 12, -3 },
+    { 13, -3 },
+    { 14, -4 },
+    { 17, -3 },
+    { 22, -4 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 31, -4 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 41, -3 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -5 },
+    { 51, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 60, -3 },
+    { 65, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 87, 2 },
+    { 88, -4 },
+    { 95, -6 },
+    { 70, -1 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, -2 },
+    { 57, 1 },
+    { 66, 2 },
+    { 52, 1 },
+    { 60, -1 },
+    { 84, 2 },
+    { 86, 2 },
+    { 87, 2 },
+    { 89, 2 },
+    { 90, 3 },
+    { 52, 3 },
+    { 58, 1 },
+    { 59, 2 },
+    { 61, 2 },
+    { 62, 2 },
+    { 83, 1 },
+    { 84, 3 },
+    { 85, 1 },
+    { 86, 4 },
+    { 87, 1 },
+    { 89, 4 },
+    { 90, 5 },
+    { 91, 1 },
+    { 57, -3 },
+    { 60, -3 },
+    { 66, -3 },
+    { 75, -4 },
+    { 90, 1 },
+    { 30, 2 },
+    { 31, -2 },
+    { 38, 1 },
+    { 11, -1 },
+    { 14, -3 },
+    { 22, -4 },
+    { 31, -4 },
+    { 45, -2 },
+    { 47, -2 },
+    { 51, -2 },
+    { 60, -3 },
+    { 66, -1 },
+    { 74, -2 },
+    { 76, -2 },
+    { 88, -2 },
+    { 14, -5 },
+    { 22, -5 },
+    { 31, -4 },
+    { 38, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 51, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 57, -2 },
+    { 60, -3 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -2 },
+    { 74, -2 },
+    { 76, -2 },
+    { 88, -4 },
+    { 14, -7 },
+    { 17, -4 },
+    { 28, -1 },
+    { 41, -5 },
+    { 43, -4 },
+    { 44, -2 },
+    { 46, -5 },
+    { 60, -1 },
+    { 70, -1 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -3 },
+};
+
 static const EpdFontData opendyslexic_12_italic = {
     opendyslexic_12_italicBitmaps,
     opendyslexic_12_italicGlyphs,
@@ -4709,4 +7897,8 @@ static const EpdFontData opendyslexic_12_italic = {
     33,
     -13,
     true,
+    opendyslexic_12_italicKernLeftClasses,
+    opendyslexic_12_italicKernRightClasses,
+    opendyslexic_12_italicKernPairOffsets,
+    opendyslexic_12_italicKernPairs,
 };
@@ -4114,4 +4114,8 @@ static const EpdFontData opendyslexic_12_regular = {
     33,
     -13,
     true,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
 };
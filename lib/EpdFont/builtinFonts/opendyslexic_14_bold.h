@@ -5972,4 +5972,8 @@ static const EpdFontData opendyslexic_14_bold = {
     38,
     -16,
     true,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
 };
@@ -6994,6 +6994,9283 @@ static const EpdUnicodeInterval opendyslexic_14_bolditalicIntervals[] = {
     { 0x2264, 0x2265, 0x2BF },
 };
 
+static const uint8_t opendyslexic_14_bolditalicKernLeftClasses[705] = {
+    0, 1, 2, 0, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 0, 49, 0, 0,
+    0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 57, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 0, 76, 0, 0,
+    77, 78, 79, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0,
+    82, 0, 0, 82, 82, 83, 84, 0, 0, 0, 0, 85, 86, 87, 88, 0,
+    0, 0, 89, 0, 0, 90, 0, 91, 92, 0, 92, 93, 0, 94, 95, 0,
+    0, 0, 0, 96, 97, 98, 99, 0, 0, 0, 0, 100, 101, 102, 103, 104,
+    0, 0, 0, 0, 0, 105, 0, 106, 0, 0, 0, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 87, 108, 87, 109, 0, 110, 87, 111, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 112,
+    113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 114, 115, 116, 0, 117, 118, 116, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t opendyslexic_14_bolditalicKernRightClasses[705] = {
+    0, 1, 2, 0, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 0, 49, 0, 0,
+    0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 0, 77, 0, 0,
+    78, 79, 80, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0,
+    83, 0, 0, 83, 83, 84, 85, 0, 0, 0, 0, 86, 87, 0, 88, 0,
+    0, 0, 89, 0, 0, 89, 0, 90, 91, 0, 92, 93, 0, 94, 95, 0,
+    0, 0, 0, 96, 97, 98, 99, 0, 0, 0, 0, 100, 101, 102, 103, 104,
+    0, 0, 0, 0, 0, 105, 0, 106, 0, 0, 0, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 108, 0, 109, 0, 110, 0, 111, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89,
+    112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 113, 114, 115, 0, 116, 117, 115, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t opendyslexic_14_bolditalicKernPairOffsets[119] = {
+    0, 35, 101, 193, 251, 287, 318, 361, 420, 438, 460, 526, 599, 662, 729, 795,
+    862, 929, 1002, 1065, 1130, 1220, 1315, 1412, 1514, 1613, 1708, 1810, 1911, 2012, 2108, 2211,
+    2307, 2406, 2508, 2612, 2711, 2812, 2914, 3008, 3106, 3209, 3311, 3413, 3513, 3611, 3713, 3812,
+    3854, 3895, 3999, 4102, 4196, 4302, 4400, 4506, 4603, 4707, 4809, 4913, 5018, 5114, 5214, 5311,
+    5408, 5510, 5610, 5715, 5806, 5911, 6009, 6105, 6198, 6295, 6399, 6435, 6475, 6568, 6653, 6706,
+    6767, 6860, 6938, 7013, 7104, 7192, 7279, 7283, 7371, 7462, 7553, 7641, 7731, 7821, 7882, 7964,
+    8049, 8134, 8222, 8307, 8342, 8359, 8401, 8454, 8519, 8605, 8692, 8774, 8808, 8846, 8864, 8915,
+    8993, 9019, 9051, 9075, 9109, 9141, 9167,
+};
+
+static const EpdKernPair opendyslexic_14_bolditalicKernPairs[] = {
+    { 1, 2 },
+    { 3, -1 },
+    { 10, 2 },
+    { 13, 1 },
+    { 14, 1 },
+    { 16, 1 },
+    { 21, -1 },
+    { 22, 1 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 59, -4 },
+    { 65, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 78, -3 },
+    { 85, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 107, -1 },
+    { 111, 1 },
+    { 5, -7 },
+    { 6, -4 },
+    { 7, -4 },
+    { 22, -7 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -3 },
+    { 31, -10 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -4 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -5 },
+    { 48, -5 },
+    { 49, -3 },
+    { 50, -5 },
+    { 51, -3 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -4 },
+    { 56, -5 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -5 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -6 },
+    { 74, -3 },
+    { 75, -6 },
+    { 76, -7 },
+    { 77, -3 },
+    { 94, -3 },
+    { 95, -4 },
+    { 104, -4 },
+    { 113, -2 },
+    { 114, -3 },
+    { 116, -3 },
+    { 117, -4 },
+    { 3, -7 },
+    { 4, -1 },
+    { 8, -4 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -5 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -8 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -8 },
+    { 45, -7 },
+    { 46, -9 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -5 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -6 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -8 },
+    { 70, -4 },
+    { 71, -8 },
+    { 72, -6 },
+    { 73, -8 },
+    { 74, -8 },
+    { 75, -5 },
+    { 78, -8 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 1, 1 },
+    { 3, -1 },
+    { 18, -4 },
+    { 21, -5 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -8 },
+    { 42, -1 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -2 },
+    { 46, -7 },
+    { 47, -1 },
+    { 51, -1 },
+    { 55, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -4 },
+    { 70, -1 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -1 },
+    { 78, -4 },
+    { 80, 1 },
+    { 82, -3 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 107, -1 },
+    { 5, -4 },
+    { 6, -1 },
+    { 7, -1 },
+    { 22, -5 },
+    { 31, -7 },
+    { 32, -1 },
+    { 35, -1 },
+    { 40, -1 },
+    { 45, -1 },
+    { 47, -2 },
+    { 48, -2 },
+    { 50, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -3 },
+    { 75, -3 },
+    { 76, -4 },
+    { 95, -1 },
+    { 104, -2 },
+    { 117, -1 },
+    { 2, 3 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, 2 },
+    { 15, -2 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 3 },
+    { 33, 1 },
+    { 34, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 3 },
+    { 45, 1 },
+    { 46, 2 },
+    { 50, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 76, -1 },
+    { 77, 1 },
+    { 2, 3 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 11, 1 },
+    { 17, 1 },
+    { 19, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 3 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 1 },
+    { 42, 1 },
+    { 45, 1 },
+    { 47, 1 },
+    { 50, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 56, 1 },
+    { 61, 1 },
+    { 64, 1 },
+    { 66, 1 },
+    { 69, 1 },
+    { 76, 1 },
+    { 94, 1 },
+    { 104, 3 },
+    { 114, 1 },
+    { 117, 1 },
+    { 3, -4 },
+    { 11, 1 },
+    { 15, -1 },
+    { 17, 1 },
+    { 20, 1 },
+    { 21, -6 },
+    { 22, -3 },
+    { 27, -1 },
+    { 30, -1 },
+    { 31, -10 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -3 },
+    { 41, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -5 },
+    { 46, -3 },
+    { 47, -5 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -2 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -4 },
+    { 74, -1 },
+    { 75, -3 },
+    { 78, -3 },
+    { 79, -1 },
+    { 82, -5 },
+    { 83, -3 },
+    { 84, -6 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 98, -1 },
+    { 99, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 112, -1 },
+    { 1, 3 },
+    { 9, 1 },
+    { 10, 3 },
+    { 22, 1 },
+    { 27, 1 },
+    { 28, -1 },
+    { 35, 1 },
+    { 41, -7 },
+    { 55, -1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 60, 1 },
+    { 63, 1 },
+    { 65, -1 },
+    { 69, -3 },
+    { 71, -4 },
+    { 72, -2 },
+    { 74, -3 },
+    { 1, 3 },
+    { 9, 1 },
+    { 10, 2 },
+    { 22, 2 },
+    { 27, 1 },
+    { 35, 1 },
+    { 41, -7 },
+    { 51, -1 },
+    { 55, -1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 60, 1 },
+    { 63, 1 },
+    { 65, -1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, -3 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, 1 },
+    { 74, -4 },
+    { 75, 1 },
+    { 1, 1 },
+    { 3, -3 },
+    { 6, 1 },
+    { 11, 1 },
+    { 17, 1 },
+    { 20, 1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -1 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -3 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -3 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, 1 },
+    { 78, -4 },
+    { 80, 1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 104, 3 },
+    { 107, -1 },
+    { 1, 1 },
+    { 3, -1 },
+    { 8, -2 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -3 },
+    { 16, 1 },
+    { 18, -2 },
+    { 19, 1 },
+    { 21, -5 },
+    { 22, 2 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -2 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -5 },
+    { 42, -1 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -1 },
+    { 46, -6 },
+    { 47, -1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -2 },
+    { 56, -1 },
+    { 59, -5 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 69, -4 },
+    { 70, -1 },
+    { 71, -5 },
+    { 72, -3 },
+    { 74, -5 },
+    { 77, -1 },
+    { 78, -5 },
+    { 79, -1 },
+    { 82, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 99, -1 },
+    { 104, 3 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -1 },
+    { 112, -1 },
+    { 1, 1 },
+    { 3, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 21, -5 },
+    { 22, 2 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -4 },
+    { 44, -3 },
+    { 46, -5 },
+    { 48, 1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, 1 },
+    { 59, -5 },
+    { 60, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, 1 },
+    { 74, -1 },
+    { 75, 1 },
+    { 78, -4 },
+    { 79, -1 },
+    { 82, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 98, -1 },
+    { 99, -1 },
+    { 104, 2 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -1 },
+    { 112, -1 },
+    { 1, 1 },
+    { 3, -2 },
+    { 6, 1 },
+    { 11, 1 },
+    { 12, 1 },
+    { 17, 1 },
+    { 19, 1 },
+    { 21, -5 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -3 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -4 },
+    { 82, -4 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 104, 3 },
+    { 107, -1 },
+    { 1, 1 },
+    { 3, -3 },
+    { 6, 1 },
+    { 11, 1 },
+    { 17, 1 },
+    { 19, 1 },
+    { 21, -5 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -1 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -5 },
+    { 47, -1 },
+    { 51, -1 },
+    { 55, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -3 },
+    { 75, -2 },
+    { 76, 1 },
+    { 78, -4 },
+    { 80, 1 },
+    { 82, -3 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 104, 3 },
+    { 107, -1 },
+    { 1, 1 },
+    { 3, -2 },
+    { 6, 1 },
+    { 11, 1 },
+    { 12, 1 },
+    { 17, 1 },
+    { 19, 1 },
+    { 21, -5 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 46, -3 },
+    { 47, -1 },
+    { 51, -1 },
+    { 55, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -3 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -1 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -4 },
+    { 82, -4 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 104, 3 },
+    { 107, -1 },
+    { 1, 1 },
+    { 3, -3 },
+    { 6, 1 },
+    { 11, 1 },
+    { 12, 1 },
+    { 17, 1 },
+    { 19, 1 },
+    { 21, -5 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -1 },
+    { 51, -1 },
+    { 55, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -3 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -4 },
+    { 82, -4 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 104, 3 },
+    { 107, -1 },
+    { 3, -4 },
+    { 18, 1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 24, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -5 },
+    { 32, -3 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -3 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -3 },
+    { 49, 1 },
+    { 50, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -3 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -3 },
+    { 74, -1 },
+    { 75, -4 },
+    { 77, 1 },
+    { 78, -2 },
+    { 79, -2 },
+    { 81, 1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -2 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 94, 1 },
+    { 97, -2 },
+    { 98, -2 },
+    { 99, -2 },
+    { 104, 1 },
+    { 105, -1 },
+    { 106, -2 },
+    { 107, -1 },
+    { 112, -2 },
+    { 1, 1 },
+    { 3, -2 },
+    { 6, 1 },
+    { 12, 1 },
+    { 17, 1 },
+    { 19, 1 },
+    { 21, -5 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -3 },
+    { 42, -1 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -3 },
+    { 46, -5 },
+    { 51, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -3 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -5 },
+    { 82, -4 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 104, 3 },
+    { 107, -1 },
+    { 1, 1 },
+    { 3, -3 },
+    { 6, 1 },
+    { 11, 1 },
+    { 17, 1 },
+    { 20, 1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -1 },
+    { 51, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 67, -1 },
+    { 68, -3 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -3 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, 1 },
+    { 78, -4 },
+    { 80, 1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 104, 3 },
+    { 107, -1 },
+    { 1, -1 },
+    { 3, -6 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -6 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -6 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 50, -8 },
+    { 51, -2 },
+    { 52, -8 },
+    { 53, -8 },
+    { 54, -8 },
+    { 55, -4 },
+    { 56, -8 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -7 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -6 },
+    { 63, -5 },
+    { 64, -7 },
+    { 65, -6 },
+    { 66, -8 },
+    { 67, -6 },
+    { 68, -8 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -7 },
+    { 78, -4 },
+    { 79, -8 },
+    { 80, -1 },
+    { 82, -9 },
+    { 83, -6 },
+    { 84, -6 },
+    { 85, -5 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -3 },
+    { 92, -3 },
+    { 93, -3 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -6 },
+    { 98, -8 },
+    { 99, -8 },
+    { 104, -1 },
+    { 105, -4 },
+    { 106, -7 },
+    { 107, -3 },
+    { 111, -2 },
+    { 112, -7 },
+    { 1, 2 },
+    { 3, -2 },
+    { 5, -4 },
+    { 6, 1 },
+    { 8, -3 },
+    { 9, 1 },
+    { 10, 2 },
+    { 11, -1 },
+    { 12, 2 },
+    { 13, 2 },
+    { 14, 2 },
+    { 15, -1 },
+    { 16, 2 },
+    { 18, -3 },
+    { 20, 1 },
+    { 21, -6 },
+    { 22, 1 },
+    { 23, -1 },
+    { 24, -4 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -5 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -6 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -4 },
+    { 37, -1 },
+    { 38, -5 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -9 },
+    { 42, -4 },
+    { 43, -9 },
+    { 44, -6 },
+    { 45, -1 },
+    { 46, -8 },
+    { 47, -1 },
+    { 48, 2 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -4 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -8 },
+    { 72, -5 },
+    { 73, -1 },
+    { 74, -8 },
+    { 75, -1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 82, -1 },
+    { 85, -4 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -4 },
+    { 90, -1 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, 2 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 104, 2 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 113, -2 },
+    { 115, 1 },
+    { 116, -1 },
+    { 2, 2 },
+    { 3, -6 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -8 },
+    { 22, -3 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -7 },
+    { 45, -7 },
+    { 46, -8 },
+    { 47, -4 },
+    { 48, 1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -6 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -6 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -7 },
+    { 74, -6 },
+    { 75, -5 },
+    { 76, 2 },
+    { 78, -8 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -7 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -4 },
+    { 104, 2 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 2, 4 },
+    { 3, -5 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 2 },
+    { 8, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -2 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -6 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -8 },
+    { 70, -5 },
+    { 71, -8 },
+    { 72, -6 },
+    { 73, -4 },
+    { 74, -8 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -5 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -5 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 113, 1 },
+    { 116, 1 },
+    { 2, 4 },
+    { 3, -7 },
+    { 4, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -9 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -8 },
+    { 46, -8 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 76, 1 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -6 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 114, 2 },
+    { 117, 2 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -2 },
+    { 5, -1 },
+    { 7, 1 },
+    { 8, -5 },
+    { 11, -2 },
+    { 12, -1 },
+    { 15, -3 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 48, 1 },
+    { 50, -5 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -5 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -8 },
+    { 70, -5 },
+    { 71, -8 },
+    { 72, -8 },
+    { 73, -4 },
+    { 74, -8 },
+    { 75, -4 },
+    { 77, 1 },
+    { 78, -6 },
+    { 79, -5 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -6 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -6 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -5 },
+    { 105, -5 },
+    { 106, -5 },
+    { 107, -5 },
+    { 112, -5 },
+    { 113, 1 },
+    { 1, -2 },
+    { 2, 4 },
+    { 3, -8 },
+    { 4, -3 },
+    { 7, 2 },
+    { 8, -2 },
+    { 9, -10 },
+    { 10, -9 },
+    { 11, -2 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -6 },
+    { 16, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -3 },
+    { 20, -2 },
+    { 21, -6 },
+    { 22, -7 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -14 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -5 },
+    { 39, -5 },
+    { 40, -7 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 49, 1 },
+    { 50, -6 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -5 },
+    { 56, -5 },
+    { 57, -5 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -4 },
+    { 62, -6 },
+    { 63, -6 },
+    { 64, -5 },
+    { 65, -7 },
+    { 66, -5 },
+    { 67, -6 },
+    { 68, -7 },
+    { 69, -5 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -7 },
+    { 74, -5 },
+    { 75, -8 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -5 },
+    { 80, -1 },
+    { 82, -10 },
+    { 83, -7 },
+    { 84, -10 },
+    { 85, -5 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -5 },
+    { 90, -5 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, -5 },
+    { 104, -1 },
+    { 105, -5 },
+    { 106, -5 },
+    { 107, -4 },
+    { 111, -2 },
+    { 112, -5 },
+    { 113, 1 },
+    { 115, -6 },
+    { 1, -1 },
+    { 2, 1 },
+    { 3, -6 },
+    { 4, -1 },
+    { 5, -2 },
+    { 6, 2 },
+    { 8, -2 },
+    { 9, -3 },
+    { 10, -1 },
+    { 11, -1 },
+    { 12, -3 },
+    { 13, -3 },
+    { 14, -3 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -4 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -9 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -7 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -7 },
+    { 46, -8 },
+    { 47, -5 },
+    { 48, 1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -6 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -7 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -7 },
+    { 74, -6 },
+    { 75, -6 },
+    { 76, 2 },
+    { 78, -8 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -4 },
+    { 104, 2 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 2, 4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, 1 },
+    { 78, -6 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 113, 1 },
+    { 114, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 48, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -4 },
+    { 76, 1 },
+    { 78, -6 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 117, 1 },
+    { 1, -1 },
+    { 2, 5 },
+    { 3, -6 },
+    { 4, -2 },
+    { 6, 1 },
+    { 7, 3 },
+    { 8, -1 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -3 },
+    { 16, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -10 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -6 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -5 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 49, 2 },
+    { 50, -5 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -4 },
+    { 56, -5 },
+    { 57, -5 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -5 },
+    { 62, -6 },
+    { 63, -6 },
+    { 64, -5 },
+    { 65, -6 },
+    { 66, -5 },
+    { 67, -6 },
+    { 68, -6 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 76, 1 },
+    { 77, 3 },
+    { 78, -5 },
+    { 79, -5 },
+    { 80, -1 },
+    { 82, -6 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -5 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -5 },
+    { 90, -5 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -2 },
+    { 96, -3 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -5 },
+    { 105, -5 },
+    { 106, -5 },
+    { 107, -4 },
+    { 111, -2 },
+    { 112, -5 },
+    { 113, 3 },
+    { 114, 2 },
+    { 116, 3 },
+    { 117, 2 },
+    { 3, -6 },
+    { 4, -4 },
+    { 5, -3 },
+    { 6, 1 },
+    { 8, -8 },
+    { 11, -4 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -8 },
+    { 17, -4 },
+    { 18, -6 },
+    { 19, -4 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -9 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -10 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -9 },
+    { 37, -4 },
+    { 38, -10 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -7 },
+    { 42, -7 },
+    { 43, -7 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -7 },
+    { 47, -4 },
+    { 48, 2 },
+    { 50, -6 },
+    { 51, -6 },
+    { 52, -8 },
+    { 53, -8 },
+    { 54, -8 },
+    { 55, -5 },
+    { 56, -7 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -8 },
+    { 65, -5 },
+    { 66, -7 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -8 },
+    { 70, -7 },
+    { 71, -10 },
+    { 72, -8 },
+    { 73, -4 },
+    { 74, -11 },
+    { 75, -4 },
+    { 78, -8 },
+    { 79, -8 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -9 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -9 },
+    { 90, -4 },
+    { 91, -7 },
+    { 92, -7 },
+    { 93, -7 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, -8 },
+    { 104, -2 },
+    { 105, -8 },
+    { 106, -7 },
+    { 107, -7 },
+    { 112, -8 },
+    { 115, 1 },
+    { 117, -1 },
+    { 2, -4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -11 },
+    { 6, 1 },
+    { 8, -11 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -6 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -10 },
+    { 44, -8 },
+    { 45, -4 },
+    { 46, -11 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, -1 },
+    { 50, -4 },
+    { 51, -5 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -7 },
+    { 70, -4 },
+    { 71, -8 },
+    { 72, -6 },
+    { 73, -4 },
+    { 74, -8 },
+    { 75, -4 },
+    { 77, -1 },
+    { 78, -8 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 113, -6 },
+    { 114, -6 },
+    { 116, -6 },
+    { 117, -6 },
+    { 2, 4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, 1 },
+    { 78, -6 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 113, 1 },
+    { 114, 1 },
+    { 115, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 2, 4 },
+    { 3, -5 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 2 },
+    { 9, -2 },
+    { 10, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -9 },
+    { 22, -3 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -6 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -5 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -5 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -5 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -5 },
+    { 74, -4 },
+    { 75, -5 },
+    { 76, 1 },
+    { 77, 2 },
+    { 78, -5 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -5 },
+    { 83, -3 },
+    { 84, -3 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -2 },
+    { 96, -3 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 113, 2 },
+    { 114, 1 },
+    { 116, 2 },
+    { 117, 1 },
+    { 2, 5 },
+    { 3, -7 },
+    { 4, -1 },
+    { 6, 2 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -9 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -8 },
+    { 46, -8 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 76, 2 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 114, 2 },
+    { 117, 2 },
+    { 1, -1 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -6 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -10 },
+    { 22, -7 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -14 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -8 },
+    { 46, -6 },
+    { 47, -8 },
+    { 49, 1 },
+    { 50, -6 },
+    { 51, -4 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -3 },
+    { 56, -6 },
+    { 57, -5 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -5 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -6 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 77, 1 },
+    { 78, -6 },
+    { 79, -6 },
+    { 80, -2 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -7 },
+    { 84, -11 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, -6 },
+    { 104, -2 },
+    { 105, -5 },
+    { 106, -5 },
+    { 107, -3 },
+    { 111, -1 },
+    { 112, -5 },
+    { 113, 1 },
+    { 114, 1 },
+    { 115, -7 },
+    { 116, 1 },
+    { 117, 1 },
+    { 1, -2 },
+    { 2, 3 },
+    { 3, -9 },
+    { 4, -4 },
+    { 8, -3 },
+    { 11, -3 },
+    { 12, -4 },
+    { 13, -3 },
+    { 14, -4 },
+    { 15, -4 },
+    { 16, -3 },
+    { 17, -3 },
+    { 18, -4 },
+    { 19, -4 },
+    { 20, -3 },
+    { 21, -11 },
+    { 22, -5 },
+    { 23, -6 },
+    { 24, -6 },
+    { 25, -6 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -6 },
+    { 31, -4 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -7 },
+    { 36, -6 },
+    { 37, -7 },
+    { 38, -6 },
+    { 39, -7 },
+    { 40, -8 },
+    { 41, -7 },
+    { 42, -6 },
+    { 43, -9 },
+    { 44, -8 },
+    { 45, -7 },
+    { 46, -10 },
+    { 47, -7 },
+    { 48, 3 },
+    { 49, 1 },
+    { 50, -6 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -6 },
+    { 56, -4 },
+    { 57, -6 },
+    { 58, -6 },
+    { 59, -4 },
+    { 60, -6 },
+    { 61, -6 },
+    { 62, -7 },
+    { 63, -6 },
+    { 64, -6 },
+    { 65, -4 },
+    { 66, -6 },
+    { 67, -7 },
+    { 68, -8 },
+    { 69, -6 },
+    { 70, -6 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -7 },
+    { 74, -5 },
+    { 75, -7 },
+    { 77, 1 },
+    { 78, -9 },
+    { 79, -6 },
+    { 80, -2 },
+    { 81, -5 },
+    { 82, -3 },
+    { 83, -5 },
+    { 84, -5 },
+    { 85, -6 },
+    { 86, -6 },
+    { 87, -6 },
+    { 88, -6 },
+    { 89, -6 },
+    { 90, -2 },
+    { 91, -6 },
+    { 92, -6 },
+    { 93, -6 },
+    { 94, -3 },
+    { 95, -3 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, -6 },
+    { 104, -1 },
+    { 105, -6 },
+    { 106, -5 },
+    { 107, -6 },
+    { 111, -3 },
+    { 112, -6 },
+    { 114, 1 },
+    { 115, 3 },
+    { 117, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -2 },
+    { 5, -1 },
+    { 8, -3 },
+    { 11, -3 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -3 },
+    { 17, -2 },
+    { 18, -3 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -8 },
+    { 44, -8 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -4 },
+    { 48, 1 },
+    { 50, -5 },
+    { 51, -6 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -5 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -6 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -7 },
+    { 70, -6 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -4 },
+    { 74, -6 },
+    { 75, -4 },
+    { 78, -8 },
+    { 79, -5 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -6 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -6 },
+    { 90, -4 },
+    { 91, -6 },
+    { 92, -6 },
+    { 93, -6 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -5 },
+    { 104, 2 },
+    { 105, -6 },
+    { 106, -6 },
+    { 107, -6 },
+    { 112, -6 },
+    { 3, -6 },
+    { 4, -1 },
+    { 5, -4 },
+    { 6, 2 },
+    { 8, -3 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -5 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -7 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -7 },
+    { 45, -7 },
+    { 46, -7 },
+    { 47, -4 },
+    { 48, 1 },
+    { 50, -3 },
+    { 51, -5 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -6 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -6 },
+    { 69, -7 },
+    { 70, -4 },
+    { 71, -7 },
+    { 72, -6 },
+    { 73, -7 },
+    { 74, -8 },
+    { 75, -5 },
+    { 76, 2 },
+    { 78, -8 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -4 },
+    { 104, 2 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 1, -2 },
+    { 2, 4 },
+    { 3, -7 },
+    { 4, -2 },
+    { 7, 2 },
+    { 8, -2 },
+    { 9, -8 },
+    { 10, -7 },
+    { 11, -3 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -9 },
+    { 16, -1 },
+    { 17, -3 },
+    { 18, -1 },
+    { 19, -3 },
+    { 20, -2 },
+    { 21, -4 },
+    { 22, -9 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -6 },
+    { 37, -5 },
+    { 38, -5 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 49, 1 },
+    { 50, -11 },
+    { 51, -4 },
+    { 52, -11 },
+    { 53, -11 },
+    { 54, -11 },
+    { 55, -6 },
+    { 56, -11 },
+    { 57, -5 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -4 },
+    { 62, -11 },
+    { 63, -11 },
+    { 64, -11 },
+    { 65, -12 },
+    { 66, -11 },
+    { 67, -11 },
+    { 68, -11 },
+    { 69, -8 },
+    { 70, -11 },
+    { 71, -11 },
+    { 72, -11 },
+    { 73, -11 },
+    { 74, -11 },
+    { 75, -11 },
+    { 77, 2 },
+    { 78, -5 },
+    { 79, -10 },
+    { 80, -2 },
+    { 82, -11 },
+    { 83, -9 },
+    { 84, -9 },
+    { 85, -6 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -6 },
+    { 90, -6 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -2 },
+    { 96, -3 },
+    { 97, -7 },
+    { 98, -11 },
+    { 99, -11 },
+    { 104, -6 },
+    { 105, -5 },
+    { 106, -11 },
+    { 107, -4 },
+    { 111, -8 },
+    { 112, -11 },
+    { 113, 2 },
+    { 115, -4 },
+    { 116, 2 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 2 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -5 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -5 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 76, 1 },
+    { 77, 2 },
+    { 78, -5 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -2 },
+    { 96, -3 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 113, 2 },
+    { 114, 1 },
+    { 116, 2 },
+    { 117, 1 },
+    { 1, -2 },
+    { 2, 4 },
+    { 3, -9 },
+    { 4, -4 },
+    { 7, 2 },
+    { 8, -3 },
+    { 11, -4 },
+    { 12, -4 },
+    { 13, -2 },
+    { 14, -3 },
+    { 15, -7 },
+    { 16, -2 },
+    { 17, -4 },
+    { 18, -1 },
+    { 19, -4 },
+    { 20, -3 },
+    { 21, -6 },
+    { 22, -9 },
+    { 23, -4 },
+    { 24, -7 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -13 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -6 },
+    { 36, -7 },
+    { 37, -5 },
+    { 38, -7 },
+    { 39, -5 },
+    { 40, -8 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 49, 1 },
+    { 50, -8 },
+    { 51, -4 },
+    { 52, -8 },
+    { 53, -8 },
+    { 54, -8 },
+    { 55, -6 },
+    { 56, -8 },
+    { 57, -5 },
+    { 58, -5 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -5 },
+    { 62, -8 },
+    { 63, -7 },
+    { 64, -8 },
+    { 65, -8 },
+    { 66, -8 },
+    { 67, -8 },
+    { 68, -9 },
+    { 69, -7 },
+    { 70, -6 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -8 },
+    { 74, -6 },
+    { 75, -9 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -8 },
+    { 80, -4 },
+    { 81, -1 },
+    { 82, -11 },
+    { 83, -9 },
+    { 84, -9 },
+    { 85, -7 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -7 },
+    { 90, -7 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -2 },
+    { 95, -4 },
+    { 96, -3 },
+    { 97, -7 },
+    { 98, -8 },
+    { 99, -8 },
+    { 104, -4 },
+    { 105, -5 },
+    { 106, -8 },
+    { 107, -4 },
+    { 111, -4 },
+    { 112, -8 },
+    { 113, 1 },
+    { 115, -3 },
+    { 116, 1 },
+    { 1, -2 },
+    { 2, 4 },
+    { 3, -8 },
+    { 4, -3 },
+    { 7, 3 },
+    { 8, -2 },
+    { 11, -3 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -3 },
+    { 15, -6 },
+    { 16, -2 },
+    { 17, -4 },
+    { 18, -1 },
+    { 19, -4 },
+    { 20, -3 },
+    { 22, -7 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -6 },
+    { 36, -6 },
+    { 37, -5 },
+    { 38, -6 },
+    { 39, -5 },
+    { 40, -7 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 49, 1 },
+    { 50, -7 },
+    { 51, -4 },
+    { 52, -7 },
+    { 53, -7 },
+    { 54, -7 },
+    { 55, -5 },
+    { 56, -7 },
+    { 57, -5 },
+    { 58, -5 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -5 },
+    { 62, -7 },
+    { 63, -6 },
+    { 64, -7 },
+    { 65, -7 },
+    { 66, -7 },
+    { 67, -7 },
+    { 68, -8 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -8 },
+    { 74, -5 },
+    { 75, -8 },
+    { 77, 2 },
+    { 78, -5 },
+    { 79, -7 },
+    { 80, -3 },
+    { 82, -10 },
+    { 83, -7 },
+    { 84, -7 },
+    { 85, -6 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -6 },
+    { 90, -6 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 97, -7 },
+    { 98, -7 },
+    { 99, -7 },
+    { 104, -2 },
+    { 105, -5 },
+    { 106, -7 },
+    { 107, -4 },
+    { 111, -3 },
+    { 112, -7 },
+    { 113, 2 },
+    { 115, -1 },
+    { 116, 1 },
+    { 2, 2 },
+    { 3, -5 },
+    { 4, -3 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, 1 },
+    { 8, -6 },
+    { 11, -4 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -5 },
+    { 17, -4 },
+    { 18, -3 },
+    { 19, -3 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -8 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -8 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -8 },
+    { 37, -4 },
+    { 38, -8 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 48, 2 },
+    { 50, -6 },
+    { 51, -4 },
+    { 52, -7 },
+    { 53, -7 },
+    { 54, -7 },
+    { 55, -5 },
+    { 56, -6 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -7 },
+    { 65, -5 },
+    { 66, -6 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -8 },
+    { 70, -6 },
+    { 71, -9 },
+    { 72, -8 },
+    { 73, -4 },
+    { 74, -9 },
+    { 75, -4 },
+    { 77, 1 },
+    { 78, -6 },
+    { 79, -7 },
+    { 80, -1 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -8 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -8 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, -7 },
+    { 104, -1 },
+    { 105, -6 },
+    { 106, -7 },
+    { 107, -5 },
+    { 112, -7 },
+    { 115, 1 },
+    { 1, -2 },
+    { 2, 3 },
+    { 3, -10 },
+    { 4, -4 },
+    { 7, 2 },
+    { 8, -4 },
+    { 11, -5 },
+    { 12, -4 },
+    { 13, -3 },
+    { 14, -4 },
+    { 15, -9 },
+    { 16, -3 },
+    { 17, -5 },
+    { 18, -2 },
+    { 19, -5 },
+    { 20, -4 },
+    { 21, -6 },
+    { 22, -9 },
+    { 23, -4 },
+    { 24, -8 },
+    { 25, -4 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -7 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -6 },
+    { 36, -8 },
+    { 37, -5 },
+    { 38, -8 },
+    { 39, -5 },
+    { 40, -8 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 50, -10 },
+    { 51, -4 },
+    { 52, -10 },
+    { 53, -10 },
+    { 54, -10 },
+    { 55, -7 },
+    { 56, -10 },
+    { 57, -5 },
+    { 58, -5 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -5 },
+    { 62, -9 },
+    { 63, -8 },
+    { 64, -10 },
+    { 65, -9 },
+    { 66, -10 },
+    { 67, -9 },
+    { 68, -11 },
+    { 69, -9 },
+    { 70, -7 },
+    { 71, -7 },
+    { 72, -7 },
+    { 73, -9 },
+    { 74, -7 },
+    { 75, -10 },
+    { 76, -1 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -10 },
+    { 80, -4 },
+    { 81, -1 },
+    { 82, -12 },
+    { 83, -9 },
+    { 84, -9 },
+    { 85, -8 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -8 },
+    { 90, -8 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -2 },
+    { 95, -4 },
+    { 96, -3 },
+    { 97, -7 },
+    { 98, -10 },
+    { 99, -10 },
+    { 104, -6 },
+    { 105, -5 },
+    { 106, -10 },
+    { 107, -4 },
+    { 111, -5 },
+    { 112, -10 },
+    { 113, 1 },
+    { 115, -4 },
+    { 116, 1 },
+    { 2, 4 },
+    { 3, -5 },
+    { 4, -2 },
+    { 7, 2 },
+    { 8, -2 },
+    { 11, -3 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -3 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, 2 },
+    { 50, -5 },
+    { 51, -4 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -6 },
+    { 56, -6 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -6 },
+    { 65, -5 },
+    { 66, -6 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -8 },
+    { 70, -6 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -4 },
+    { 74, -6 },
+    { 75, -4 },
+    { 77, 2 },
+    { 78, -5 },
+    { 79, -6 },
+    { 80, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -6 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -6 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -6 },
+    { 105, -5 },
+    { 106, -6 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -6 },
+    { 113, 2 },
+    { 116, 2 },
+    { 2, 4 },
+    { 15, -3 },
+    { 18, 1 },
+    { 22, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 4 },
+    { 33, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 44, 2 },
+    { 49, 1 },
+    { 50, -2 },
+    { 51, 1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 66, -1 },
+    { 67, -2 },
+    { 68, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 75, -2 },
+    { 77, 1 },
+    { 94, 1 },
+    { 113, 1 },
+    { 116, 1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 16, 1 },
+    { 22, 2 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 5 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 2 },
+    { 45, 2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 104, 2 },
+    { 115, 1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -2 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -5 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -9 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, -2 },
+    { 50, -4 },
+    { 51, -5 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -8 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 3 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 112, -4 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -6 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, 1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -7 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -6 },
+    { 46, -10 },
+    { 47, -4 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -6 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -6 },
+    { 74, -6 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -7 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 1 },
+    { 104, 2 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, -4 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 111, -1 },
+    { 112, -3 },
+    { 1, 1 },
+    { 2, 1 },
+    { 3, -4 },
+    { 4, -2 },
+    { 5, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -2 },
+    { 15, -6 },
+    { 17, -2 },
+    { 18, -6 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -9 },
+    { 47, -4 },
+    { 49, -3 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -5 },
+    { 56, -6 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -6 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -4 },
+    { 77, -2 },
+    { 78, -8 },
+    { 79, -6 },
+    { 81, -2 },
+    { 82, -5 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, -5 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -5 },
+    { 90, -4 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -6 },
+    { 103, 3 },
+    { 104, 1 },
+    { 105, -6 },
+    { 106, -6 },
+    { 107, -5 },
+    { 112, -6 },
+    { 2, 4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 7, 1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -4 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 100, 5 },
+    { 101, 1 },
+    { 102, 6 },
+    { 103, 5 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 108, 4 },
+    { 109, 6 },
+    { 110, 1 },
+    { 111, -1 },
+    { 112, -4 },
+    { 113, 1 },
+    { 114, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -6 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -2 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -10 },
+    { 47, -4 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -4 },
+    { 74, -6 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -5 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 103, 1 },
+    { 104, 2 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -3 },
+    { 1, -1 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 7, 1 },
+    { 9, -4 },
+    { 10, -3 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -4 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -9 },
+    { 22, -5 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -6 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -6 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -4 },
+    { 80, -2 },
+    { 82, -7 },
+    { 83, -5 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 100, 4 },
+    { 101, 1 },
+    { 102, 5 },
+    { 103, 5 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -3 },
+    { 108, 4 },
+    { 109, 6 },
+    { 110, 1 },
+    { 111, -1 },
+    { 112, -4 },
+    { 113, 1 },
+    { 114, 1 },
+    { 115, -1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 2, 4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 6, 1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -6 },
+    { 19, -1 },
+    { 21, -8 },
+    { 22, -2 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -7 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -5 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, -3 },
+    { 75, -4 },
+    { 76, 1 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -2 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 103, 5 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -3 },
+    { 110, 1 },
+    { 111, -1 },
+    { 112, -4 },
+    { 114, 1 },
+    { 117, 1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -2 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -5 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -10 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, -2 },
+    { 50, -4 },
+    { 51, -5 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -6 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -8 },
+    { 79, -4 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 2 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 112, -4 },
+    { 1, 1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -2 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -3 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -3 },
+    { 46, -6 },
+    { 47, -3 },
+    { 48, 1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -4 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 100, 3 },
+    { 101, 1 },
+    { 102, 6 },
+    { 103, 4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 108, 3 },
+    { 109, 6 },
+    { 110, 1 },
+    { 112, -4 },
+    { 2, 4 },
+    { 3, -5 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, -4 },
+    { 49, 1 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -5 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 74, -3 },
+    { 75, -4 },
+    { 77, 1 },
+    { 78, -5 },
+    { 79, -4 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -2 },
+    { 91, -3 },
+    { 92, -3 },
+    { 93, -3 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 100, 3 },
+    { 101, 1 },
+    { 102, 6 },
+    { 103, 5 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -3 },
+    { 108, 4 },
+    { 109, 6 },
+    { 110, 2 },
+    { 111, -1 },
+    { 112, -4 },
+    { 113, 1 },
+    { 114, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 1, 1 },
+    { 3, -6 },
+    { 4, -4 },
+    { 5, -4 },
+    { 6, 1 },
+    { 8, -7 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -4 },
+    { 13, 2 },
+    { 14, -1 },
+    { 15, -8 },
+    { 16, 2 },
+    { 17, -4 },
+    { 18, -6 },
+    { 19, -3 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -9 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -8 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -8 },
+    { 37, -4 },
+    { 38, -8 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -11 },
+    { 42, -7 },
+    { 43, -11 },
+    { 44, -9 },
+    { 45, -4 },
+    { 46, -11 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, -1 },
+    { 50, -6 },
+    { 51, -7 },
+    { 52, -7 },
+    { 53, -7 },
+    { 54, -7 },
+    { 55, -5 },
+    { 56, -7 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -8 },
+    { 65, -4 },
+    { 66, -7 },
+    { 67, -3 },
+    { 68, -5 },
+    { 69, -8 },
+    { 70, -7 },
+    { 71, -8 },
+    { 72, -8 },
+    { 73, -3 },
+    { 74, -8 },
+    { 75, -3 },
+    { 78, -8 },
+    { 79, -7 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -9 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -8 },
+    { 90, -3 },
+    { 91, -7 },
+    { 92, -7 },
+    { 93, -7 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, -7 },
+    { 100, 2 },
+    { 101, 2 },
+    { 102, 2 },
+    { 103, 2 },
+    { 104, -1 },
+    { 105, -8 },
+    { 106, -6 },
+    { 107, -7 },
+    { 108, 2 },
+    { 109, 2 },
+    { 110, 2 },
+    { 112, -8 },
+    { 113, -1 },
+    { 115, 1 },
+    { 116, -1 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -4 },
+    { 8, -4 },
+    { 9, -1 },
+    { 11, -2 },
+    { 15, -5 },
+    { 17, -2 },
+    { 18, -4 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -6 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -6 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -6 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -6 },
+    { 47, -4 },
+    { 48, 1 },
+    { 50, -4 },
+    { 51, -5 },
+    { 52, -4 },
+    { 53, -5 },
+    { 54, -4 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -7 },
+    { 70, -5 },
+    { 71, -7 },
+    { 72, -7 },
+    { 73, -3 },
+    { 74, -7 },
+    { 75, -3 },
+    { 78, -8 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -6 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -6 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 100, 2 },
+    { 101, 1 },
+    { 102, 3 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, -5 },
+    { 106, -5 },
+    { 107, -5 },
+    { 108, 1 },
+    { 109, 3 },
+    { 110, 1 },
+    { 112, -5 },
+    { 2, 2 },
+    { 3, -4 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -5 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -10 },
+    { 47, -4 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -6 },
+    { 75, -3 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -8 },
+    { 79, -4 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -4 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 1 },
+    { 104, 2 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 112, -4 },
+    { 2, 2 },
+    { 3, -6 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -7 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -6 },
+    { 45, -7 },
+    { 46, -10 },
+    { 47, -4 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -6 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -7 },
+    { 74, -6 },
+    { 75, -5 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 103, 1 },
+    { 104, 2 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -3 },
+    { 2, 2 },
+    { 3, -6 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -7 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -3 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -6 },
+    { 46, -10 },
+    { 47, -4 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -6 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -6 },
+    { 74, -6 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -1 },
+    { 82, -7 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 103, 1 },
+    { 104, 2 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -3 },
+    { 1, 1 },
+    { 3, -7 },
+    { 4, -3 },
+    { 5, -3 },
+    { 8, -3 },
+    { 9, 1 },
+    { 10, 1 },
+    { 11, -4 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, -5 },
+    { 16, 1 },
+    { 17, -4 },
+    { 18, -6 },
+    { 19, -3 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -7 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -7 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -7 },
+    { 37, -4 },
+    { 38, -7 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -11 },
+    { 42, -7 },
+    { 43, -9 },
+    { 44, -8 },
+    { 45, -4 },
+    { 46, -10 },
+    { 47, -4 },
+    { 48, 1 },
+    { 50, -6 },
+    { 51, -6 },
+    { 52, -7 },
+    { 53, -7 },
+    { 54, -7 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -4 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -7 },
+    { 65, -4 },
+    { 66, -6 },
+    { 67, -3 },
+    { 68, -5 },
+    { 69, -7 },
+    { 70, -6 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -3 },
+    { 78, -8 },
+    { 79, -7 },
+    { 81, -6 },
+    { 82, -3 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -7 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -7 },
+    { 90, -1 },
+    { 91, -7 },
+    { 92, -7 },
+    { 93, -7 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, -7 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 1 },
+    { 104, -1 },
+    { 105, -7 },
+    { 106, -5 },
+    { 107, -6 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 3 },
+    { 112, -7 },
+    { 115, 1 },
+    { 1, -1 },
+    { 2, 4 },
+    { 3, -7 },
+    { 4, -1 },
+    { 6, 1 },
+    { 9, -6 },
+    { 10, -4 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -4 },
+    { 15, -4 },
+    { 16, -1 },
+    { 18, -9 },
+    { 19, -2 },
+    { 21, -9 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -9 },
+    { 46, -8 },
+    { 47, -9 },
+    { 49, -1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -5 },
+    { 69, -3 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -4 },
+    { 80, -3 },
+    { 81, -4 },
+    { 82, -8 },
+    { 83, -6 },
+    { 84, -6 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 103, 4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 114, 1 },
+    { 115, -2 },
+    { 117, 1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -5 },
+    { 5, -2 },
+    { 6, 1 },
+    { 8, -4 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -7 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -6 },
+    { 46, -10 },
+    { 47, -3 },
+    { 48, 1 },
+    { 49, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -7 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -6 },
+    { 74, -6 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -8 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -6 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -4 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 3 },
+    { 104, 2 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 111, -1 },
+    { 112, -4 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 15, -5 },
+    { 18, -6 },
+    { 19, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -8 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -4 },
+    { 49, -1 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -4 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 103, 4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -3 },
+    { 109, 1 },
+    { 112, -4 },
+    { 117, 1 },
+    { 1, 1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -5 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -4 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, 1 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -4 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 4 },
+    { 104, 2 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 112, -4 },
+    { 114, 1 },
+    { 117, 1 },
+    { 1, -1 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 9, -6 },
+    { 10, -4 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -6 },
+    { 15, -5 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -10 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -7 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -9 },
+    { 46, -7 },
+    { 47, -8 },
+    { 49, -1 },
+    { 50, -6 },
+    { 51, -4 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -3 },
+    { 56, -6 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -9 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -6 },
+    { 65, -5 },
+    { 66, -6 },
+    { 67, -5 },
+    { 68, -7 },
+    { 69, -5 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -6 },
+    { 78, -8 },
+    { 79, -6 },
+    { 80, -2 },
+    { 81, -3 },
+    { 82, -8 },
+    { 83, -7 },
+    { 84, -7 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, -6 },
+    { 103, 5 },
+    { 104, -1 },
+    { 105, -6 },
+    { 106, -6 },
+    { 107, -3 },
+    { 111, -1 },
+    { 112, -6 },
+    { 115, -3 },
+    { 1, -1 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 9, -4 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -4 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -10 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -5 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -8 },
+    { 46, -7 },
+    { 47, -6 },
+    { 49, -1 },
+    { 50, -5 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -3 },
+    { 56, -5 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -6 },
+    { 78, -8 },
+    { 79, -5 },
+    { 80, -1 },
+    { 81, -3 },
+    { 82, -8 },
+    { 83, -5 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -5 },
+    { 103, 5 },
+    { 105, -5 },
+    { 106, -5 },
+    { 107, -3 },
+    { 111, -1 },
+    { 112, -5 },
+    { 2, 2 },
+    { 3, -5 },
+    { 4, -2 },
+    { 5, -1 },
+    { 8, -2 },
+    { 9, -1 },
+    { 11, -2 },
+    { 14, -1 },
+    { 15, -6 },
+    { 17, -2 },
+    { 18, -5 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -5 },
+    { 41, -11 },
+    { 42, -5 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -4 },
+    { 49, -2 },
+    { 50, -6 },
+    { 51, -5 },
+    { 52, -7 },
+    { 53, -7 },
+    { 54, -7 },
+    { 55, -4 },
+    { 56, -6 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -7 },
+    { 65, -4 },
+    { 66, -6 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 77, -2 },
+    { 78, -8 },
+    { 79, -7 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -5 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -5 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 96, -6 },
+    { 97, -6 },
+    { 98, -6 },
+    { 99, -7 },
+    { 103, 3 },
+    { 104, -1 },
+    { 105, -7 },
+    { 106, -6 },
+    { 107, -4 },
+    { 112, -7 },
+    { 1, -1 },
+    { 2, 4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 8, -1 },
+    { 9, -4 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -5 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -10 },
+    { 19, -1 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -9 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -8 },
+    { 46, -7 },
+    { 47, -7 },
+    { 49, -1 },
+    { 50, -5 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -3 },
+    { 56, -5 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -5 },
+    { 74, -3 },
+    { 75, -6 },
+    { 78, -8 },
+    { 79, -5 },
+    { 80, -1 },
+    { 81, -4 },
+    { 82, -8 },
+    { 83, -6 },
+    { 84, -6 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -5 },
+    { 103, 5 },
+    { 104, -1 },
+    { 105, -5 },
+    { 106, -5 },
+    { 107, -3 },
+    { 111, -1 },
+    { 112, -5 },
+    { 115, -1 },
+    { 1, 1 },
+    { 2, 4 },
+    { 3, -5 },
+    { 4, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, -6 },
+    { 16, 1 },
+    { 17, -1 },
+    { 18, -5 },
+    { 19, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -8 },
+    { 47, -4 },
+    { 48, 1 },
+    { 49, -1 },
+    { 50, -5 },
+    { 51, -4 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -3 },
+    { 56, -5 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -5 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 77, -1 },
+    { 78, -7 },
+    { 79, -5 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -5 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 4 },
+    { 104, -1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 112, -4 },
+    { 114, 1 },
+    { 117, 1 },
+    { 2, 3 },
+    { 7, 1 },
+    { 15, -2 },
+    { 18, 1 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 4 },
+    { 34, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 1 },
+    { 44, 3 },
+    { 46, 1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 77, 1 },
+    { 94, 1 },
+    { 113, 1 },
+    { 116, 1 },
+    { 5, -4 },
+    { 6, 1 },
+    { 7, -1 },
+    { 11, 1 },
+    { 16, 1 },
+    { 17, 1 },
+    { 19, 1 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 42, 1 },
+    { 46, -1 },
+    { 47, 1 },
+    { 50, 1 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 56, 1 },
+    { 58, 1 },
+    { 61, 1 },
+    { 64, 1 },
+    { 66, 1 },
+    { 76, 1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 104, 3 },
+    { 1, -3 },
+    { 3, -8 },
+    { 4, -4 },
+    { 8, -4 },
+    { 11, -4 },
+    { 12, -4 },
+    { 13, -4 },
+    { 14, -4 },
+    { 15, -6 },
+    { 16, -4 },
+    { 17, -4 },
+    { 18, -3 },
+    { 19, -4 },
+    { 20, -5 },
+    { 21, -6 },
+    { 22, -5 },
+    { 23, -6 },
+    { 24, -8 },
+    { 25, -6 },
+    { 26, -7 },
+    { 27, -7 },
+    { 28, -8 },
+    { 29, -7 },
+    { 30, -6 },
+    { 31, -8 },
+    { 32, -7 },
+    { 33, -7 },
+    { 34, -7 },
+    { 35, -7 },
+    { 36, -8 },
+    { 37, -7 },
+    { 38, -8 },
+    { 39, -7 },
+    { 40, -8 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -7 },
+    { 46, -6 },
+    { 47, -7 },
+    { 50, -7 },
+    { 51, -6 },
+    { 52, -7 },
+    { 53, -7 },
+    { 54, -7 },
+    { 55, -8 },
+    { 56, -7 },
+    { 57, -7 },
+    { 58, -7 },
+    { 59, -9 },
+    { 60, -7 },
+    { 61, -7 },
+    { 62, -7 },
+    { 63, -7 },
+    { 64, -7 },
+    { 65, -8 },
+    { 66, -7 },
+    { 67, -7 },
+    { 68, -7 },
+    { 69, -8 },
+    { 70, -8 },
+    { 71, -8 },
+    { 72, -8 },
+    { 73, -7 },
+    { 74, -8 },
+    { 75, -7 },
+    { 78, -8 },
+    { 79, -7 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -7 },
+    { 83, -5 },
+    { 84, -5 },
+    { 85, -8 },
+    { 86, -6 },
+    { 87, -6 },
+    { 88, -6 },
+    { 89, -8 },
+    { 90, -6 },
+    { 91, -6 },
+    { 92, -6 },
+    { 93, -6 },
+    { 95, -4 },
+    { 96, -6 },
+    { 97, -7 },
+    { 98, -7 },
+    { 99, -7 },
+    { 105, -7 },
+    { 106, -7 },
+    { 107, -7 },
+    { 111, -4 },
+    { 112, -7 },
+    { 3, -4 },
+    { 4, -2 },
+    { 8, -2 },
+    { 11, -2 },
+    { 15, -6 },
+    { 17, -2 },
+    { 18, -5 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -8 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -9 },
+    { 47, -4 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -5 },
+    { 56, -6 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -6 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -4 },
+    { 78, -8 },
+    { 79, -6 },
+    { 81, -2 },
+    { 82, -5 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, -5 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -5 },
+    { 90, -4 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -6 },
+    { 105, -6 },
+    { 106, -6 },
+    { 107, -5 },
+    { 112, -6 },
+    { 1, 2 },
+    { 3, -2 },
+    { 12, 1 },
+    { 13, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 21, -5 },
+    { 24, -3 },
+    { 28, -3 },
+    { 31, -1 },
+    { 36, -3 },
+    { 38, -3 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -3 },
+    { 46, -4 },
+    { 50, -3 },
+    { 51, -1 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -3 },
+    { 59, -4 },
+    { 64, -3 },
+    { 65, -1 },
+    { 66, -3 },
+    { 68, -1 },
+    { 69, -5 },
+    { 70, -3 },
+    { 71, -5 },
+    { 72, -4 },
+    { 74, -5 },
+    { 78, -4 },
+    { 79, -3 },
+    { 80, 1 },
+    { 85, -3 },
+    { 89, -3 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 95, 1 },
+    { 96, -2 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 105, -3 },
+    { 106, -2 },
+    { 107, -3 },
+    { 111, 1 },
+    { 112, -3 },
+    { 3, -4 },
+    { 15, -1 },
+    { 18, 1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 24, -3 },
+    { 27, -1 },
+    { 28, -3 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -3 },
+    { 37, -1 },
+    { 38, -3 },
+    { 39, -1 },
+    { 40, -3 },
+    { 43, -1 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -3 },
+    { 50, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -1 },
+    { 59, -4 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -1 },
+    { 79, -3 },
+    { 81, 2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -3 },
+    { 89, -3 },
+    { 90, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 105, -1 },
+    { 106, -3 },
+    { 112, -3 },
+    { 1, -5 },
+    { 3, -10 },
+    { 4, -6 },
+    { 8, -4 },
+    { 11, -5 },
+    { 12, -6 },
+    { 13, -5 },
+    { 14, -6 },
+    { 15, -7 },
+    { 16, -5 },
+    { 17, -5 },
+    { 18, -12 },
+    { 19, -6 },
+    { 20, -5 },
+    { 21, -14 },
+    { 22, -8 },
+    { 23, -8 },
+    { 24, -8 },
+    { 25, -8 },
+    { 26, -8 },
+    { 27, -9 },
+    { 28, -8 },
+    { 29, -8 },
+    { 30, -9 },
+    { 31, -11 },
+    { 32, -9 },
+    { 33, -9 },
+    { 34, -8 },
+    { 35, -9 },
+    { 36, -8 },
+    { 37, -9 },
+    { 38, -8 },
+    { 39, -9 },
+    { 40, -10 },
+    { 41, -16 },
+    { 42, -8 },
+    { 43, -10 },
+    { 44, -10 },
+    { 45, -11 },
+    { 46, -12 },
+    { 47, -9 },
+    { 50, -8 },
+    { 51, -8 },
+    { 52, -8 },
+    { 53, -8 },
+    { 54, -8 },
+    { 55, -8 },
+    { 56, -8 },
+    { 57, -8 },
+    { 58, -8 },
+    { 59, -13 },
+    { 60, -8 },
+    { 61, -8 },
+    { 62, -9 },
+    { 63, -8 },
+    { 64, -8 },
+    { 65, -10 },
+    { 66, -8 },
+    { 67, -9 },
+    { 68, -10 },
+    { 69, -8 },
+    { 70, -8 },
+    { 71, -8 },
+    { 72, -8 },
+    { 73, -10 },
+    { 74, -7 },
+    { 75, -10 },
+    { 78, -12 },
+    { 79, -8 },
+    { 80, -5 },
+    { 81, -7 },
+    { 82, -4 },
+    { 83, -8 },
+    { 84, -8 },
+    { 85, -8 },
+    { 86, -9 },
+    { 87, -9 },
+    { 88, -9 },
+    { 89, -8 },
+    { 90, -8 },
+    { 91, -8 },
+    { 92, -8 },
+    { 93, -8 },
+    { 95, -6 },
+    { 96, -8 },
+    { 97, -8 },
+    { 98, -8 },
+    { 99, -8 },
+    { 105, -8 },
+    { 106, -8 },
+    { 107, -8 },
+    { 111, -5 },
+    { 112, -8 },
+    { 1, 1 },
+    { 3, -2 },
+    { 8, -3 },
+    { 11, -1 },
+    { 15, -1 },
+    { 18, -3 },
+    { 21, -6 },
+    { 23, -1 },
+    { 24, -4 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -5 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -4 },
+    { 37, -1 },
+    { 38, -5 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -9 },
+    { 42, -4 },
+    { 43, -9 },
+    { 44, -6 },
+    { 45, -1 },
+    { 46, -8 },
+    { 47, -1 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -4 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -8 },
+    { 72, -5 },
+    { 73, -1 },
+    { 74, -8 },
+    { 75, -1 },
+    { 78, -6 },
+    { 79, -3 },
+    { 82, -1 },
+    { 85, -4 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -4 },
+    { 90, -1 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 1, 1 },
+    { 3, -2 },
+    { 8, -2 },
+    { 21, -4 },
+    { 23, -1 },
+    { 24, -3 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -4 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -7 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -3 },
+    { 37, -1 },
+    { 38, -4 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -2 },
+    { 47, -1 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -5 },
+    { 70, -3 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -1 },
+    { 74, -6 },
+    { 75, -1 },
+    { 78, -4 },
+    { 79, -2 },
+    { 82, -1 },
+    { 85, -3 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -3 },
+    { 90, -1 },
+    { 91, -2 },
+    { 92, -2 },
+    { 93, -2 },
+    { 96, -1 },
+    { 97, -2 },
+    { 98, -2 },
+    { 99, -2 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, -2 },
+    { 112, -3 },
+    { 3, -5 },
+    { 4, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -2 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -6 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -8 },
+    { 70, -5 },
+    { 71, -8 },
+    { 72, -6 },
+    { 73, -4 },
+    { 74, -8 },
+    { 75, -4 },
+    { 78, -5 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -5 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -5 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -4 },
+    { 78, -6 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -7 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -4 },
+    { 78, -6 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 87, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 31, 2 },
+    { 45, 1 },
+    { 59, -2 },
+    { 104, 1 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -4 },
+    { 78, -6 },
+    { 79, -4 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, 1 },
+    { 88, 2 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -5 },
+    { 93, -3 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 104, 1 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 3, -7 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -9 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -8 },
+    { 46, -8 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 3, -7 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -8 },
+    { 46, -8 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 1, 7 },
+    { 4, 6 },
+    { 8, 6 },
+    { 11, 6 },
+    { 12, 5 },
+    { 13, 6 },
+    { 14, 5 },
+    { 15, 5 },
+    { 16, 6 },
+    { 17, 6 },
+    { 18, 5 },
+    { 19, 6 },
+    { 20, 6 },
+    { 21, 3 },
+    { 22, 2 },
+    { 23, 3 },
+    { 24, 3 },
+    { 25, 3 },
+    { 26, 3 },
+    { 27, 2 },
+    { 28, 3 },
+    { 29, 3 },
+    { 30, 2 },
+    { 32, 2 },
+    { 33, 2 },
+    { 34, 3 },
+    { 35, 2 },
+    { 36, 3 },
+    { 37, 2 },
+    { 38, 4 },
+    { 39, 2 },
+    { 41, 2 },
+    { 42, 3 },
+    { 43, 2 },
+    { 44, 2 },
+    { 45, 1 },
+    { 46, 2 },
+    { 47, 2 },
+    { 50, 3 },
+    { 51, 2 },
+    { 52, 3 },
+    { 53, 3 },
+    { 54, 3 },
+    { 55, 3 },
+    { 56, 3 },
+    { 57, 2 },
+    { 58, 3 },
+    { 60, 2 },
+    { 61, 3 },
+    { 62, 2 },
+    { 63, 2 },
+    { 64, 3 },
+    { 65, 1 },
+    { 66, 3 },
+    { 67, 2 },
+    { 68, 1 },
+    { 69, 3 },
+    { 70, 3 },
+    { 71, 3 },
+    { 72, 3 },
+    { 73, 1 },
+    { 74, 3 },
+    { 75, 1 },
+    { 78, 1 },
+    { 79, 3 },
+    { 80, 6 },
+    { 81, 4 },
+    { 83, 2 },
+    { 84, 1 },
+    { 85, 3 },
+    { 86, 2 },
+    { 87, 2 },
+    { 88, 2 },
+    { 89, 3 },
+    { 90, 3 },
+    { 91, 3 },
+    { 92, 3 },
+    { 93, 3 },
+    { 95, 6 },
+    { 96, 4 },
+    { 97, 3 },
+    { 98, 3 },
+    { 99, 3 },
+    { 105, 3 },
+    { 106, 3 },
+    { 107, 3 },
+    { 111, 6 },
+    { 112, 3 },
+    { 3, -6 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -5 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -5 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 78, -5 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -2 },
+    { 96, -3 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 3, -6 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -5 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -5 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -5 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -5 },
+    { 61, -4 },
+    { 62, -5 },
+    { 63, -5 },
+    { 64, -4 },
+    { 65, -6 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -6 },
+    { 74, -4 },
+    { 75, -6 },
+    { 78, -5 },
+    { 79, -4 },
+    { 80, -1 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -5 },
+    { 85, -4 },
+    { 86, -3 },
+    { 87, -4 },
+    { 88, -3 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -2 },
+    { 96, -3 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -4 },
+    { 2, 3 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 11, 1 },
+    { 17, 1 },
+    { 18, -4 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -10 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -5 },
+    { 41, -8 },
+    { 42, -1 },
+    { 43, -5 },
+    { 44, -3 },
+    { 45, -7 },
+    { 46, -6 },
+    { 47, -4 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -5 },
+    { 74, -2 },
+    { 75, -4 },
+    { 76, 1 },
+    { 77, -1 },
+    { 104, 2 },
+    { 115, -4 },
+    { 117, 1 },
+    { 1, 1 },
+    { 2, 2 },
+    { 3, -1 },
+    { 5, -2 },
+    { 12, 1 },
+    { 19, 1 },
+    { 21, -5 },
+    { 22, 1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -3 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -1 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -2 },
+    { 46, -6 },
+    { 47, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -5 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -5 },
+    { 79, -1 },
+    { 82, -3 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 99, -1 },
+    { 102, 4 },
+    { 103, 3 },
+    { 104, 3 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -1 },
+    { 108, 1 },
+    { 109, 3 },
+    { 112, -1 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -5 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -3 },
+    { 78, -7 },
+    { 79, -4 },
+    { 81, -1 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -5 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -9 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -9 },
+    { 47, -4 },
+    { 50, -4 },
+    { 51, -5 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -3 },
+    { 78, -8 },
+    { 79, -4 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 96, -4 },
+    { 97, -4 },
+    { 98, -4 },
+    { 99, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 3, -4 },
+    { 4, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -6 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -2 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -4 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -10 },
+    { 47, -4 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -4 },
+    { 74, -6 },
+    { 75, -4 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -5 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -3 },
+    { 3, -4 },
+    { 4, -2 },
+    { 8, -2 },
+    { 11, -2 },
+    { 15, -6 },
+    { 17, -2 },
+    { 18, -6 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -5 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -5 },
+    { 37, -4 },
+    { 38, -5 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -11 },
+    { 42, -5 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -4 },
+    { 46, -9 },
+    { 47, -4 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -5 },
+    { 56, -6 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -6 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -6 },
+    { 65, -5 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -4 },
+    { 78, -8 },
+    { 79, -6 },
+    { 81, -2 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -2 },
+    { 85, -5 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -5 },
+    { 90, -3 },
+    { 91, -5 },
+    { 92, -5 },
+    { 93, -5 },
+    { 96, -5 },
+    { 97, -5 },
+    { 98, -5 },
+    { 99, -6 },
+    { 105, -6 },
+    { 106, -6 },
+    { 107, -5 },
+    { 112, -6 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 1 },
+    { 29, 2 },
+    { 30, 2 },
+    { 31, 3 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 1 },
+    { 45, 1 },
+    { 46, 1 },
+    { 51, 3 },
+    { 55, 1 },
+    { 57, 2 },
+    { 58, 3 },
+    { 60, 2 },
+    { 61, 2 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 94, 2 },
+    { 95, 2 },
+    { 104, 2 },
+    { 31, 3 },
+    { 45, 1 },
+    { 51, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, -1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 95, 1 },
+    { 104, 2 },
+    { 23, 5 },
+    { 24, 1 },
+    { 25, 5 },
+    { 26, 4 },
+    { 27, 4 },
+    { 28, 2 },
+    { 29, 4 },
+    { 30, 4 },
+    { 31, 3 },
+    { 32, 3 },
+    { 33, 4 },
+    { 34, 4 },
+    { 35, 3 },
+    { 36, 2 },
+    { 37, 4 },
+    { 38, 1 },
+    { 39, 4 },
+    { 40, 2 },
+    { 41, 5 },
+    { 42, 5 },
+    { 43, 4 },
+    { 44, 4 },
+    { 45, 3 },
+    { 46, 4 },
+    { 47, 2 },
+    { 51, 6 },
+    { 55, 3 },
+    { 57, 4 },
+    { 58, 5 },
+    { 59, 1 },
+    { 60, 4 },
+    { 61, 5 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 2 },
+    { 73, 1 },
+    { 75, 1 },
+    { 94, 5 },
+    { 95, 4 },
+    { 104, 2 },
+    { 23, 4 },
+    { 24, 1 },
+    { 25, 4 },
+    { 26, 3 },
+    { 27, 2 },
+    { 28, 2 },
+    { 29, 3 },
+    { 30, 3 },
+    { 31, 3 },
+    { 32, 2 },
+    { 33, 3 },
+    { 34, 3 },
+    { 35, 2 },
+    { 36, 2 },
+    { 37, 3 },
+    { 38, 1 },
+    { 39, 2 },
+    { 40, 2 },
+    { 41, 4 },
+    { 42, 4 },
+    { 43, 4 },
+    { 44, 3 },
+    { 45, 3 },
+    { 46, 4 },
+    { 47, 2 },
+    { 50, 1 },
+    { 51, 4 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, 4 },
+    { 56, 1 },
+    { 57, 3 },
+    { 58, 4 },
+    { 60, 4 },
+    { 61, 4 },
+    { 62, 3 },
+    { 63, 3 },
+    { 64, 1 },
+    { 65, 3 },
+    { 66, 1 },
+    { 67, 3 },
+    { 68, 1 },
+    { 69, 4 },
+    { 70, 4 },
+    { 71, 5 },
+    { 72, 5 },
+    { 73, 3 },
+    { 74, 5 },
+    { 75, 2 },
+    { 94, 4 },
+    { 95, 4 },
+    { 104, 2 },
+    { 2, 4 },
+    { 6, 1 },
+    { 11, 1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 16, 1 },
+    { 17, 1 },
+    { 19, 1 },
+    { 20, 2 },
+    { 21, -4 },
+    { 22, -2 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 3 },
+    { 26, 2 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 2 },
+    { 30, 1 },
+    { 31, -8 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 41, -3 },
+    { 42, 2 },
+    { 43, 1 },
+    { 44, 1 },
+    { 45, -2 },
+    { 47, -4 },
+    { 50, -1 },
+    { 51, 1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, 2 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, -2 },
+    { 60, 1 },
+    { 61, 1 },
+    { 63, 1 },
+    { 68, -1 },
+    { 69, 1 },
+    { 70, 2 },
+    { 71, 2 },
+    { 72, 2 },
+    { 74, 2 },
+    { 94, 3 },
+    { 95, 2 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 4 },
+    { 103, 6 },
+    { 108, 1 },
+    { 109, 4 },
+    { 110, 1 },
+    { 113, 1 },
+    { 114, 2 },
+    { 115, -2 },
+    { 116, 1 },
+    { 117, 1 },
+    { 3, -6 },
+    { 8, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -4 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -6 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -7 },
+    { 74, -6 },
+    { 75, -5 },
+    { 78, -6 },
+    { 79, -3 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -3 },
+    { 3, -6 },
+    { 8, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -3 },
+    { 20, -1 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -6 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -7 },
+    { 46, -6 },
+    { 47, -4 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -8 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -6 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -6 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -5 },
+    { 73, -7 },
+    { 74, -6 },
+    { 75, -5 },
+    { 78, -7 },
+    { 79, -3 },
+    { 81, -2 },
+    { 82, -8 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 95, -1 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -3 },
+    { 105, -3 },
+    { 106, -3 },
+    { 107, -4 },
+    { 111, -1 },
+    { 112, -3 },
+    { 3, -4 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 47, -4 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -8 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 78, -6 },
+    { 79, -4 },
+    { 82, -4 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -3 },
+    { 91, -4 },
+    { 92, -4 },
+    { 93, -4 },
+    { 96, -3 },
+    { 97, -3 },
+    { 98, -3 },
+    { 99, -4 },
+    { 105, -4 },
+    { 106, -4 },
+    { 107, -4 },
+    { 112, -4 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 29, 2 },
+    { 30, 2 },
+    { 31, 3 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 3 },
+    { 44, 2 },
+    { 45, 2 },
+    { 46, 3 },
+    { 47, 1 },
+    { 51, 4 },
+    { 57, 1 },
+    { 58, 3 },
+    { 60, 2 },
+    { 61, 2 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 94, 2 },
+    { 95, 1 },
+    { 104, 2 },
+    { 23, 5 },
+    { 25, 5 },
+    { 26, 4 },
+    { 27, 4 },
+    { 29, 4 },
+    { 30, 5 },
+    { 31, 3 },
+    { 32, 3 },
+    { 33, 4 },
+    { 34, 4 },
+    { 35, 3 },
+    { 37, 4 },
+    { 39, 4 },
+    { 40, 1 },
+    { 41, 5 },
+    { 42, 5 },
+    { 43, 5 },
+    { 44, 4 },
+    { 45, 4 },
+    { 46, 5 },
+    { 47, 3 },
+    { 51, 5 },
+    { 55, 2 },
+    { 57, 4 },
+    { 58, 5 },
+    { 59, 1 },
+    { 60, 4 },
+    { 61, 4 },
+    { 62, 1 },
+    { 63, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 94, 5 },
+    { 95, 3 },
+    { 104, 2 },
+    { 31, 3 },
+    { 45, 1 },
+    { 51, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 73, 1 },
+    { 75, 1 },
+    { 95, 1 },
+    { 104, 2 },
+    { 1, 1 },
+    { 3, -1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 16, 1 },
+    { 18, -2 },
+    { 21, -5 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 41, -8 },
+    { 42, -1 },
+    { 43, -4 },
+    { 44, -3 },
+    { 46, -5 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -4 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 78, -5 },
+    { 79, -1 },
+    { 82, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 96, -1 },
+    { 97, -1 },
+    { 98, -1 },
+    { 99, -1 },
+    { 105, -1 },
+    { 106, -1 },
+    { 107, -1 },
+    { 111, 1 },
+    { 112, -1 },
+    { 1, 6 },
+    { 3, 1 },
+    { 4, 4 },
+    { 8, 1 },
+    { 11, 3 },
+    { 12, 5 },
+    { 13, 5 },
+    { 14, 5 },
+    { 15, 3 },
+    { 16, 5 },
+    { 17, 4 },
+    { 18, 4 },
+    { 19, 4 },
+    { 20, 5 },
+    { 22, 4 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 2 },
+    { 29, 2 },
+    { 30, 2 },
+    { 31, 1 },
+    { 32, 2 },
+    { 33, 2 },
+    { 34, 2 },
+    { 35, 2 },
+    { 37, 2 },
+    { 39, 2 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 44, 1 },
+    { 45, 2 },
+    { 46, 1 },
+    { 47, 2 },
+    { 50, 1 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 56, 1 },
+    { 57, 2 },
+    { 58, 2 },
+    { 60, 2 },
+    { 61, 2 },
+    { 62, 2 },
+    { 63, 2 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 67, 2 },
+    { 68, 2 },
+    { 73, 2 },
+    { 75, 2 },
+    { 79, 1 },
+    { 80, 5 },
+    { 81, 5 },
+    { 82, 2 },
+    { 83, 4 },
+    { 84, 4 },
+    { 86, 2 },
+    { 87, 2 },
+    { 88, 2 },
+    { 90, 2 },
+    { 91, 1 },
+    { 92, 1 },
+    { 93, 1 },
+    { 95, 5 },
+    { 96, 2 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 105, 1 },
+    { 106, 1 },
+    { 107, 1 },
+    { 111, 5 },
+    { 112, 1 },
+    { 1, 4 },
+    { 4, 3 },
+    { 8, 2 },
+    { 11, 3 },
+    { 12, 3 },
+    { 13, 3 },
+    { 14, 3 },
+    { 15, 2 },
+    { 16, 3 },
+    { 17, 3 },
+    { 19, 3 },
+    { 20, 2 },
+    { 21, -2 },
+    { 22, 2 },
+    { 41, -5 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -4 },
+    { 59, -2 },
+    { 78, -1 },
+    { 80, 4 },
+    { 81, 1 },
+    { 83, 2 },
+    { 84, 1 },
+    { 95, 3 },
+    { 111, 3 },
+    { 2, 4 },
+    { 6, 1 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, -2 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 42, 1 },
+    { 44, 1 },
+    { 51, 1 },
+    { 55, 1 },
+    { 58, 1 },
+    { 59, -1 },
+    { 61, 1 },
+    { 69, 2 },
+    { 70, 1 },
+    { 74, 1 },
+    { 94, 1 },
+    { 114, 1 },
+    { 117, 1 },
+    { 2, 4 },
+    { 22, -2 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, -3 },
+    { 33, 1 },
+    { 34, 1 },
+    { 37, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 1 },
+    { 44, 2 },
+    { 46, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 77, 1 },
+    { 94, 1 },
+    { 113, 1 },
+    { 116, 1 },
+    { 22, 1 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 2 },
+    { 30, 1 },
+    { 31, 3 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 40, 2 },
+    { 41, -2 },
+    { 42, 1 },
+    { 43, -1 },
+    { 45, 1 },
+    { 46, -2 },
+    { 47, 2 },
+    { 57, 1 },
+    { 58, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 68, 1 },
+    { 71, -1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 104, 3 },
+    { 2, 4 },
+    { 6, 1 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 3 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, -2 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 42, 1 },
+    { 44, 1 },
+    { 51, 1 },
+    { 55, 1 },
+    { 58, 1 },
+    { 59, -1 },
+    { 61, 1 },
+    { 69, 2 },
+    { 70, 1 },
+    { 94, 1 },
+    { 104, 1 },
+    { 114, 1 },
+    { 117, 1 },
+    { 2, 4 },
+    { 22, -2 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, -3 },
+    { 33, 1 },
+    { 34, 1 },
+    { 37, 1 },
+    { 39, 1 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 1 },
+    { 44, 2 },
+    { 46, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 58, 1 },
+    { 77, 1 },
+    { 94, 1 },
+    { 113, 1 },
+    { 116, 1 },
+};
+
 static const EpdFontData opendyslexic_14_bolditalic = {
     opendyslexic_14_bolditalicBitmaps,
     opendyslexic_14_bolditalicGlyphs,
@@ -7003,4 +16280,8 @@ static const EpdFontData opendyslexic_14_bolditalic = {
     38,
     -16,
     true,
+    opendyslexic_14_bolditalicKernLeftClasses,
+    opendyslexic_14_bolditalicKernRightClasses,
+    opendyslexic_14_bolditalicKernPairOffsets,
+    opendyslexic_14_bolditalicKernPairs,
 };
@@ -6051,6 +6051,3518 @@ static const EpdUnicodeInterval opendyslexic_14_italicIntervals[] = {
     { 0x2264, 0x2265, 0x2BF },
 };
 
+static const uint8_t opendyslexic_14_italicKernLeftClasses[705] = {
+    0, 1, 2, 0, 0, 0, 0, 2, 3, 4, 5, 0, 6, 7, 8, 0,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 20,
+    0, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 0, 48, 49, 0,
+    0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 0, 77, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 78, 79, 0, 0, 0, 0, 80, 80, 81, 80, 0,
+    0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 83, 84, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 86, 87, 88, 89,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0,
+    0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 80, 92, 80, 93, 94, 95, 80, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 98, 99, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t opendyslexic_14_italicKernRightClasses[705] = {
+    0, 1, 2, 0, 0, 0, 0, 3, 4, 5, 6, 0, 7, 8, 9, 0,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 0, 49, 50, 0,
+    0, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 0, 78, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 79, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 82, 83, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 85, 86, 87, 88,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 91, 0, 92, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 95, 96, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t opendyslexic_14_italicKernPairOffsets[100] = {
+    0, 6, 7, 58, 68, 73, 85, 93, 105, 123, 146, 156, 170, 201, 221, 237,
+    262, 280, 295, 299, 335, 402, 453, 493, 547, 590, 659, 731, 768, 802, 839, 897,
+    943, 997, 1058, 1103, 1153, 1203, 1258, 1324, 1401, 1443, 1509, 1567, 1630, 1701, 1763, 1796,
+    1799, 1806, 1854, 1911, 1969, 2011, 2059, 2107, 2149, 2191, 2231, 2252, 2306, 2356, 2374, 2417,
+    2464, 2508, 2582, 2637, 2683, 2730, 2772, 2822, 2871, 2930, 2980, 3022, 3059, 3071, 3101, 3131,
+    3133, 3138, 3159, 3194, 3218, 3222, 3223, 3233, 3253, 3292, 3297, 3299, 3306, 3319, 3323, 3324,
+    3342, 3364, 3390, 3403,
+};
+
+static const EpdKernPair opendyslexic_14_italicKernPairs[] = {
+    { 22, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 35, -1 },
+    { 41, -1 },
+    { 66, -1 },
+    { 2, 4 },
+    { 10, -3 },
+    { 11, -3 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -5 },
+    { 15, -1 },
+    { 16, -4 },
+    { 18, -3 },
+    { 19, -3 },
+    { 22, -3 },
+    { 24, -4 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -3 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -2 },
+    { 33, -1 },
+    { 35, -1 },
+    { 36, -4 },
+    { 37, -1 },
+    { 38, -4 },
+    { 39, -1 },
+    { 40, -3 },
+    { 44, 1 },
+    { 45, -1 },
+    { 47, -3 },
+    { 51, -4 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -1 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -2 },
+    { 76, -3 },
+    { 83, -3 },
+    { 88, -4 },
+    { 2, 2 },
+    { 5, -3 },
+    { 17, -2 },
+    { 24, 1 },
+    { 34, 1 },
+    { 38, 1 },
+    { 46, -2 },
+    { 60, -1 },
+    { 66, -1 },
+    { 74, -1 },
+    { 2, 2 },
+    { 8, -2 },
+    { 41, -2 },
+    { 60, -2 },
+    { 74, -2 },
+    { 1, 1 },
+    { 5, -1 },
+    { 9, 1 },
+    { 22, -1 },
+    { 28, -1 },
+    { 41, -7 },
+    { 46, -2 },
+    { 56, -1 },
+    { 70, -1 },
+    { 72, -4 },
+    { 73, -1 },
+    { 75, -1 },
+    { 5, -2 },
+    { 6, -3 },
+    { 11, -1 },
+    { 40, -8 },
+    { 41, -4 },
+    { 46, -3 },
+    { 60, -1 },
+    { 74, -3 },
+    { 1, 1 },
+    { 9, 1 },
+    { 28, -1 },
+    { 40, 1 },
+    { 41, -7 },
+    { 46, -1 },
+    { 56, -1 },
+    { 60, -1 },
+    { 70, -2 },
+    { 72, -4 },
+    { 73, -1 },
+    { 75, -4 },
+    { 2, 3 },
+    { 5, -3 },
+    { 13, -1 },
+    { 17, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 40, -1 },
+    { 41, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -2 },
+    { 46, -2 },
+    { 60, -4 },
+    { 66, -1 },
+    { 74, -2 },
+    { 76, -1 },
+    { 78, -2 },
+    { 96, -2 },
+    { 3, -1 },
+    { 5, -3 },
+    { 6, -2 },
+    { 8, -1 },
+    { 14, -5 },
+    { 17, -4 },
+    { 31, -4 },
+    { 41, -4 },
+    { 43, -4 },
+    { 44, -3 },
+    { 46, -4 },
+    { 49, -4 },
+    { 50, -2 },
+    { 56, -1 },
+    { 60, -3 },
+    { 70, -1 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -4 },
+    { 77, -2 },
+    { 78, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 2, 2 },
+    { 5, -3 },
+    { 14, -3 },
+    { 31, -4 },
+    { 43, -1 },
+    { 44, -1 },
+    { 46, -1 },
+    { 60, -3 },
+    { 77, -1 },
+    { 78, -1 },
+    { 5, -3 },
+    { 14, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 60, -4 },
+    { 66, -1 },
+    { 69, -1 },
+    { 74, -2 },
+    { 78, -1 },
+    { 96, -1 },
+    { 5, -4 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 17, -3 },
+    { 19, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 40, -1 },
+    { 41, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -3 },
+    { 47, -1 },
+    { 49, -3 },
+    { 56, -1 },
+    { 60, -4 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 78, -3 },
+    { 94, -3 },
+    { 95, -2 },
+    { 96, -2 },
+    { 5, -2 },
+    { 14, -1 },
+    { 19, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 56, -1 },
+    { 60, -4 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -3 },
+    { 78, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 5, -1 },
+    { 19, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 45, -1 },
+    { 56, -1 },
+    { 60, -4 },
+    { 66, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -2 },
+    { 95, -1 },
+    { 96, -1 },
+    { 11, -1 },
+    { 14, -2 },
+    { 18, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 31, -5 },
+    { 32, -1 },
+    { 35, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 57, -1 },
+    { 60, -4 },
+    { 63, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 74, -2 },
+    { 76, -2 },
+    { 77, -1 },
+    { 88, -1 },
+    { 96, -3 },
+    { 5, -3 },
+    { 14, -1 },
+    { 17, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 41, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -2 },
+    { 60, -4 },
+    { 66, -1 },
+    { 69, -1 },
+    { 74, -2 },
+    { 78, -2 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 2, 3 },
+    { 5, -3 },
+    { 13, -1 },
+    { 17, -1 },
+    { 22, -1 },
+    { 31, -4 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -2 },
+    { 60, -4 },
+    { 66, -1 },
+    { 74, -2 },
+    { 78, -2 },
+    { 96, -1 },
+    { 2, 4 },
+    { 40, 1 },
+    { 41, -3 },
+    { 60, -1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, -2 },
+    { 15, 1 },
+    { 17, 2 },
+    { 23, 4 },
+    { 24, 1 },
+    { 25, 4 },
+    { 26, 3 },
+    { 27, 2 },
+    { 28, 2 },
+    { 29, 3 },
+    { 30, 2 },
+    { 32, 1 },
+    { 33, 2 },
+    { 34, 3 },
+    { 35, 2 },
+    { 36, 1 },
+    { 37, 2 },
+    { 38, 1 },
+    { 39, 2 },
+    { 40, 1 },
+    { 41, 4 },
+    { 42, 4 },
+    { 43, 4 },
+    { 44, 4 },
+    { 45, 3 },
+    { 46, 4 },
+    { 47, 1 },
+    { 52, 3 },
+    { 58, 1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 69, -1 },
+    { 82, 3 },
+    { 5, -3 },
+    { 7, -1 },
+    { 10, -1 },
+    { 14, -3 },
+    { 16, -1 },
+    { 17, -4 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -8 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -8 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -8 },
+    { 37, -5 },
+    { 38, -6 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -13 },
+    { 42, -8 },
+    { 43, -13 },
+    { 44, -10 },
+    { 45, -5 },
+    { 46, -11 },
+    { 47, -5 },
+    { 49, -5 },
+    { 51, -5 },
+    { 52, -6 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -5 },
+    { 57, -5 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -3 },
+    { 64, -3 },
+    { 65, -5 },
+    { 66, -4 },
+    { 67, -5 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -6 },
+    { 71, -5 },
+    { 72, -9 },
+    { 73, -7 },
+    { 74, -3 },
+    { 75, -9 },
+    { 76, -3 },
+    { 78, -4 },
+    { 79, -5 },
+    { 80, -8 },
+    { 81, -6 },
+    { 82, 1 },
+    { 88, -1 },
+    { 93, -8 },
+    { 94, -6 },
+    { 95, -4 },
+    { 5, -4 },
+    { 14, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 22, -7 },
+    { 23, -5 },
+    { 24, -5 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -11 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -7 },
+    { 41, -8 },
+    { 42, -6 },
+    { 43, -9 },
+    { 44, -8 },
+    { 45, -8 },
+    { 46, -10 },
+    { 47, -6 },
+    { 49, -1 },
+    { 54, 1 },
+    { 56, -1 },
+    { 60, -4 },
+    { 66, -1 },
+    { 67, 1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -1 },
+    { 78, -3 },
+    { 79, -8 },
+    { 80, -5 },
+    { 81, -6 },
+    { 82, 1 },
+    { 93, -6 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 14, -1 },
+    { 19, -1 },
+    { 22, -6 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -6 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -6 },
+    { 37, -5 },
+    { 38, -3 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -6 },
+    { 47, -5 },
+    { 56, -2 },
+    { 60, -4 },
+    { 66, -1 },
+    { 70, -2 },
+    { 72, -5 },
+    { 73, -2 },
+    { 75, -5 },
+    { 79, -6 },
+    { 80, -6 },
+    { 81, -6 },
+    { 93, -6 },
+    { 96, -1 },
+    { 4, 1 },
+    { 5, -4 },
+    { 13, -1 },
+    { 17, -3 },
+    { 22, -8 },
+    { 23, -5 },
+    { 24, -5 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -5 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -5 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -9 },
+    { 41, -9 },
+    { 42, -6 },
+    { 43, -9 },
+    { 44, -8 },
+    { 45, -10 },
+    { 46, -10 },
+    { 47, -7 },
+    { 49, -1 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 57, 1 },
+    { 60, -4 },
+    { 61, 1 },
+    { 62, 1 },
+    { 65, 1 },
+    { 66, -1 },
+    { 67, 1 },
+    { 70, 1 },
+    { 74, -3 },
+    { 76, -1 },
+    { 78, -4 },
+    { 79, -10 },
+    { 80, -5 },
+    { 81, -5 },
+    { 82, 1 },
+    { 88, 1 },
+    { 93, -5 },
+    { 94, -1 },
+    { 96, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 14, -5 },
+    { 16, -1 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -7 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -7 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -8 },
+    { 37, -5 },
+    { 38, -5 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -5 },
+    { 46, -6 },
+    { 47, -5 },
+    { 56, -1 },
+    { 60, -3 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -4 },
+    { 73, -3 },
+    { 75, -4 },
+    { 79, -5 },
+    { 80, -7 },
+    { 81, -6 },
+    { 82, 1 },
+    { 93, -8 },
+    { 95, -1 },
+    { 1, -2 },
+    { 7, -10 },
+    { 9, -9 },
+    { 11, -1 },
+    { 14, -4 },
+    { 18, -1 },
+    { 21, -1 },
+    { 22, -12 },
+    { 23, -5 },
+    { 24, -7 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -7 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -7 },
+    { 36, -7 },
+    { 37, -6 },
+    { 38, -4 },
+    { 39, -7 },
+    { 40, -9 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -5 },
+    { 47, -8 },
+    { 51, -6 },
+    { 52, -3 },
+    { 53, -5 },
+    { 54, -6 },
+    { 55, -6 },
+    { 56, -4 },
+    { 57, -5 },
+    { 58, -4 },
+    { 59, -5 },
+    { 60, -3 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -1 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -6 },
+    { 67, -5 },
+    { 68, -6 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -6 },
+    { 75, -4 },
+    { 76, -7 },
+    { 79, -15 },
+    { 80, -7 },
+    { 81, -7 },
+    { 82, 1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 91, 1 },
+    { 93, -7 },
+    { 96, -8 },
+    { 1, -1 },
+    { 5, -3 },
+    { 7, -3 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 17, -2 },
+    { 19, -1 },
+    { 22, -8 },
+    { 23, -5 },
+    { 24, -5 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -11 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -7 },
+    { 41, -9 },
+    { 42, -6 },
+    { 43, -9 },
+    { 44, -9 },
+    { 45, -8 },
+    { 46, -9 },
+    { 47, -7 },
+    { 49, -2 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -5 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -3 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -5 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -5 },
+    { 70, -6 },
+    { 71, -3 },
+    { 72, -5 },
+    { 73, -4 },
+    { 74, -6 },
+    { 75, -6 },
+    { 76, -5 },
+    { 78, -2 },
+    { 79, -8 },
+    { 80, -5 },
+    { 81, -6 },
+    { 82, 1 },
+    { 93, -6 },
+    { 94, -2 },
+    { 95, -3 },
+    { 96, -2 },
+    { 5, -1 },
+    { 14, -1 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -6 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -6 },
+    { 37, -5 },
+    { 38, -3 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -5 },
+    { 46, -6 },
+    { 47, -5 },
+    { 54, 1 },
+    { 60, -3 },
+    { 61, 1 },
+    { 70, 1 },
+    { 79, -5 },
+    { 80, -6 },
+    { 81, -6 },
+    { 82, 1 },
+    { 93, -6 },
+    { 2, 2 },
+    { 5, -1 },
+    { 14, -1 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -3 },
+    { 30, -2 },
+    { 31, -8 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -1 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 46, -4 },
+    { 47, -3 },
+    { 60, -3 },
+    { 79, -3 },
+    { 80, -4 },
+    { 81, -4 },
+    { 93, -4 },
+    { 14, -1 },
+    { 22, -7 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -7 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -7 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -6 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -5 },
+    { 47, -6 },
+    { 52, 1 },
+    { 60, -1 },
+    { 66, -1 },
+    { 74, -1 },
+    { 79, -7 },
+    { 80, -6 },
+    { 81, -6 },
+    { 82, 1 },
+    { 93, -6 },
+    { 96, -1 },
+    { 5, -3 },
+    { 10, -3 },
+    { 14, -6 },
+    { 16, -3 },
+    { 17, -2 },
+    { 18, -2 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -10 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -10 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -10 },
+    { 37, -5 },
+    { 38, -8 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -8 },
+    { 42, -8 },
+    { 43, -8 },
+    { 44, -8 },
+    { 45, -5 },
+    { 46, -8 },
+    { 47, -5 },
+    { 49, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -1 },
+    { 57, -3 },
+    { 60, -3 },
+    { 61, 1 },
+    { 65, -3 },
+    { 67, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -5 },
+    { 73, -3 },
+    { 75, -5 },
+    { 78, -2 },
+    { 79, -5 },
+    { 80, -10 },
+    { 81, -6 },
+    { 82, 1 },
+    { 88, -2 },
+    { 93, -10 },
+    { 94, -2 },
+    { 95, -4 },
+    { 5, -3 },
+    { 14, -8 },
+    { 17, -4 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -6 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -6 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -13 },
+    { 42, -6 },
+    { 43, -11 },
+    { 44, -9 },
+    { 45, -5 },
+    { 46, -11 },
+    { 47, -5 },
+    { 49, -5 },
+    { 52, -1 },
+    { 54, 1 },
+    { 56, -1 },
+    { 60, -3 },
+    { 70, -1 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -5 },
+    { 78, -4 },
+    { 79, -5 },
+    { 80, -6 },
+    { 81, -6 },
+    { 82, 1 },
+    { 93, -6 },
+    { 94, -9 },
+    { 95, -10 },
+    { 4, 1 },
+    { 5, -1 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -6 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -6 },
+    { 37, -5 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -7 },
+    { 42, -6 },
+    { 43, -7 },
+    { 44, -7 },
+    { 45, -5 },
+    { 46, -7 },
+    { 47, -5 },
+    { 51, 1 },
+    { 53, 1 },
+    { 54, 2 },
+    { 55, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -3 },
+    { 61, 2 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 79, -5 },
+    { 80, -6 },
+    { 81, -6 },
+    { 82, 2 },
+    { 83, 1 },
+    { 88, 1 },
+    { 93, -6 },
+    { 1, -1 },
+    { 5, 1 },
+    { 7, -2 },
+    { 9, -1 },
+    { 22, -7 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -7 },
+    { 35, -7 },
+    { 36, -6 },
+    { 37, -7 },
+    { 38, -3 },
+    { 39, -7 },
+    { 40, -6 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -5 },
+    { 47, -6 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -4 },
+    { 58, -4 },
+    { 59, -4 },
+    { 60, -3 },
+    { 61, -4 },
+    { 62, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, -4 },
+    { 79, -7 },
+    { 80, -6 },
+    { 81, -6 },
+    { 82, 1 },
+    { 93, -6 },
+    { 96, -1 },
+    { 5, -3 },
+    { 13, -1 },
+    { 17, -1 },
+    { 22, -8 },
+    { 23, -5 },
+    { 24, -5 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -5 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -5 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -8 },
+    { 41, -7 },
+    { 42, -6 },
+    { 43, -8 },
+    { 44, -7 },
+    { 45, -10 },
+    { 46, -9 },
+    { 47, -7 },
+    { 49, -1 },
+    { 54, 1 },
+    { 60, -4 },
+    { 66, -1 },
+    { 67, 1 },
+    { 70, 1 },
+    { 74, -2 },
+    { 76, -1 },
+    { 78, -3 },
+    { 79, -9 },
+    { 80, -5 },
+    { 81, -5 },
+    { 82, 1 },
+    { 93, -5 },
+    { 94, -1 },
+    { 96, -1 },
+    { 2, 4 },
+    { 5, -2 },
+    { 7, -8 },
+    { 8, -7 },
+    { 9, -7 },
+    { 14, -4 },
+    { 22, -12 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -7 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -8 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -9 },
+    { 46, -8 },
+    { 47, -10 },
+    { 50, -1 },
+    { 51, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 60, -4 },
+    { 63, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 78, -3 },
+    { 79, -15 },
+    { 80, -6 },
+    { 81, -6 },
+    { 82, 1 },
+    { 88, -2 },
+    { 93, -6 },
+    { 96, -10 },
+    { 5, -2 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -1 },
+    { 17, -3 },
+    { 22, -6 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -3 },
+    { 31, -3 },
+    { 32, -5 },
+    { 33, -4 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -1 },
+    { 39, -5 },
+    { 40, -7 },
+    { 41, -6 },
+    { 42, -4 },
+    { 43, -7 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -8 },
+    { 47, -6 },
+    { 52, -1 },
+    { 58, -1 },
+    { 60, 2 },
+    { 61, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -3 },
+    { 76, -2 },
+    { 79, -6 },
+    { 80, -4 },
+    { 81, -4 },
+    { 83, -1 },
+    { 93, -4 },
+    { 94, -2 },
+    { 2, 1 },
+    { 5, -3 },
+    { 10, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 17, -2 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -7 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -8 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -8 },
+    { 37, -5 },
+    { 38, -5 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -8 },
+    { 42, -7 },
+    { 43, -9 },
+    { 44, -9 },
+    { 45, -5 },
+    { 46, -10 },
+    { 47, -5 },
+    { 49, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 60, -3 },
+    { 65, -1 },
+    { 67, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 78, -3 },
+    { 79, -5 },
+    { 80, -7 },
+    { 81, -6 },
+    { 82, 1 },
+    { 93, -8 },
+    { 94, -2 },
+    { 95, -1 },
+    { 4, 1 },
+    { 5, -3 },
+    { 8, 1 },
+    { 17, -1 },
+    { 20, 1 },
+    { 22, -8 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -11 },
+    { 32, -6 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -6 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -8 },
+    { 41, -9 },
+    { 42, -6 },
+    { 43, -9 },
+    { 44, -9 },
+    { 45, -9 },
+    { 46, -9 },
+    { 47, -6 },
+    { 49, -3 },
+    { 51, 2 },
+    { 52, 1 },
+    { 53, 1 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, -1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -3 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, 2 },
+    { 66, -1 },
+    { 67, 2 },
+    { 70, -1 },
+    { 71, 1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -3 },
+    { 78, -2 },
+    { 79, -8 },
+    { 80, -6 },
+    { 81, -6 },
+    { 82, 2 },
+    { 83, 1 },
+    { 88, 1 },
+    { 93, -6 },
+    { 94, -2 },
+    { 95, -4 },
+    { 96, -1 },
+    { 1, -2 },
+    { 2, 4 },
+    { 4, -1 },
+    { 6, -3 },
+    { 7, -9 },
+    { 8, -4 },
+    { 9, -8 },
+    { 10, -1 },
+    { 11, -4 },
+    { 14, -8 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, -4 },
+    { 22, -13 },
+    { 23, -5 },
+    { 24, -10 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -7 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -7 },
+    { 36, -8 },
+    { 37, -6 },
+    { 38, -6 },
+    { 39, -6 },
+    { 40, -8 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -5 },
+    { 47, -8 },
+    { 50, -4 },
+    { 51, -11 },
+    { 52, -3 },
+    { 53, -11 },
+    { 54, -11 },
+    { 55, -11 },
+    { 56, -6 },
+    { 57, -11 },
+    { 58, -4 },
+    { 59, -4 },
+    { 60, -3 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -6 },
+    { 64, -10 },
+    { 65, -11 },
+    { 66, -12 },
+    { 67, -11 },
+    { 68, -10 },
+    { 69, -10 },
+    { 70, -10 },
+    { 71, -11 },
+    { 72, -11 },
+    { 73, -11 },
+    { 74, -10 },
+    { 75, -11 },
+    { 76, -10 },
+    { 79, -13 },
+    { 80, -10 },
+    { 81, -8 },
+    { 82, 1 },
+    { 87, -2 },
+    { 88, -6 },
+    { 91, 1 },
+    { 93, -8 },
+    { 96, -7 },
+    { 2, 4 },
+    { 14, -1 },
+    { 22, -8 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -6 },
+    { 28, -6 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -6 },
+    { 35, -7 },
+    { 36, -6 },
+    { 37, -6 },
+    { 38, -3 },
+    { 39, -6 },
+    { 40, -8 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -5 },
+    { 47, -6 },
+    { 52, 1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, 1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -9 },
+    { 80, -6 },
+    { 81, -6 },
+    { 82, 1 },
+    { 93, -6 },
+    { 96, -1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -4 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 22, -13 },
+    { 23, -5 },
+    { 24, -9 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -7 },
+    { 28, -8 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -7 },
+    { 35, -8 },
+    { 36, -8 },
+    { 37, -7 },
+    { 38, -6 },
+    { 39, -7 },
+    { 40, -9 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -5 },
+    { 47, -8 },
+    { 51, -4 },
+    { 52, 1 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 60, -3 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -3 },
+    { 79, -13 },
+    { 80, -9 },
+    { 81, -8 },
+    { 82, 1 },
+    { 83, -1 },
+    { 88, -3 },
+    { 91, 1 },
+    { 93, -8 },
+    { 95, -1 },
+    { 96, -6 },
+    { 5, 1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -4 },
+    { 16, -1 },
+    { 18, -1 },
+    { 22, -11 },
+    { 23, -5 },
+    { 24, -8 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -7 },
+    { 28, -7 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -7 },
+    { 35, -7 },
+    { 36, -8 },
+    { 37, -7 },
+    { 38, -5 },
+    { 39, -7 },
+    { 40, -9 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -5 },
+    { 47, -8 },
+    { 51, -3 },
+    { 52, 1 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 57, -2 },
+    { 60, -4 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 74, -3 },
+    { 76, -3 },
+    { 79, -11 },
+    { 80, -8 },
+    { 81, -8 },
+    { 82, 1 },
+    { 83, -1 },
+    { 88, -2 },
+    { 91, 1 },
+    { 93, -8 },
+    { 95, -1 },
+    { 96, -5 },
+    { 5, -1 },
+    { 10, -2 },
+    { 14, -4 },
+    { 16, -2 },
+    { 18, -1 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -9 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -10 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -10 },
+    { 37, -5 },
+    { 38, -7 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -5 },
+    { 46, -6 },
+    { 47, -5 },
+    { 51, -1 },
+    { 52, 1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -3 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, -2 },
+    { 67, -2 },
+    { 68, 1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, 1 },
+    { 75, -3 },
+    { 76, 1 },
+    { 79, -5 },
+    { 80, -9 },
+    { 81, -6 },
+    { 82, 2 },
+    { 83, 1 },
+    { 88, -2 },
+    { 93, -10 },
+    { 95, -1 },
+    { 2, 2 },
+    { 4, -2 },
+    { 7, -4 },
+    { 8, -3 },
+    { 9, -3 },
+    { 10, -2 },
+    { 11, -1 },
+    { 13, -1 },
+    { 14, -7 },
+    { 16, -3 },
+    { 18, -2 },
+    { 19, -1 },
+    { 21, -4 },
+    { 22, -13 },
+    { 23, -5 },
+    { 24, -10 },
+    { 25, -5 },
+    { 26, -6 },
+    { 27, -7 },
+    { 28, -9 },
+    { 29, -6 },
+    { 30, -4 },
+    { 31, -12 },
+    { 32, -7 },
+    { 33, -6 },
+    { 34, -7 },
+    { 35, -8 },
+    { 36, -9 },
+    { 37, -7 },
+    { 38, -7 },
+    { 39, -7 },
+    { 40, -10 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -5 },
+    { 47, -8 },
+    { 50, -3 },
+    { 51, -5 },
+    { 52, 1 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -4 },
+    { 58, -1 },
+    { 60, -4 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 79, -13 },
+    { 80, -10 },
+    { 81, -9 },
+    { 83, -2 },
+    { 88, -5 },
+    { 93, -9 },
+    { 95, -1 },
+    { 96, -7 },
+    { 14, -7 },
+    { 16, -1 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -8 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -7 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -8 },
+    { 37, -5 },
+    { 38, -6 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -6 },
+    { 46, -6 },
+    { 47, -5 },
+    { 51, -1 },
+    { 52, 1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -3 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 64, 1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, 1 },
+    { 78, -2 },
+    { 79, -5 },
+    { 80, -8 },
+    { 81, -6 },
+    { 82, 2 },
+    { 83, 1 },
+    { 88, -1 },
+    { 93, -8 },
+    { 96, -1 },
+    { 10, -1 },
+    { 14, -6 },
+    { 16, -1 },
+    { 22, -5 },
+    { 24, -1 },
+    { 28, -1 },
+    { 32, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 45, -1 },
+    { 47, -1 },
+    { 51, -5 },
+    { 53, -5 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -1 },
+    { 57, -1 },
+    { 63, -5 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -1 },
+    { 67, -4 },
+    { 68, -5 },
+    { 69, -5 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -6 },
+    { 75, -1 },
+    { 76, -5 },
+    { 88, -5 },
+    { 14, -1 },
+    { 17, -1 },
+    { 52, -1 },
+    { 5, -2 },
+    { 11, -2 },
+    { 40, -2 },
+    { 41, -4 },
+    { 46, -3 },
+    { 60, -2 },
+    { 74, -3 },
+    { 2, 2 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -4 },
+    { 22, -3 },
+    { 25, 1 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, 1 },
+    { 31, -4 },
+    { 32, 1 },
+    { 34, 1 },
+    { 35, -3 },
+    { 40, 1 },
+    { 41, -10 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -4 },
+    { 47, 1 },
+    { 51, -2 },
+    { 52, -4 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -2 },
+    { 75, -4 },
+    { 76, -2 },
+    { 87, 1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 17, -5 },
+    { 22, -5 },
+    { 23, 1 },
+    { 24, 2 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, 1 },
+    { 31, -4 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, -4 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, -11 },
+    { 42, 1 },
+    { 43, -3 },
+    { 44, -1 },
+    { 45, -2 },
+    { 46, -4 },
+    { 47, 1 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -6 },
+    { 75, -5 },
+    { 76, -4 },
+    { 82, 1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 96, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -2 },
+    { 8, -6 },
+    { 10, -1 },
+    { 14, -6 },
+    { 16, -1 },
+    { 17, -4 },
+    { 18, -1 },
+    { 22, -3 },
+    { 24, -1 },
+    { 25, 1 },
+    { 27, -3 },
+    { 28, -5 },
+    { 29, 1 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, 1 },
+    { 41, -10 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -4 },
+    { 47, 1 },
+    { 50, -2 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -4 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -5 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -2 },
+    { 75, -4 },
+    { 76, -2 },
+    { 77, -2 },
+    { 88, -2 },
+    { 94, -2 },
+    { 95, -1 },
+    { 2, 3 },
+    { 14, -1 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 40, 1 },
+    { 41, -3 },
+    { 44, 1 },
+    { 45, 1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 84, 1 },
+    { 86, 2 },
+    { 87, 2 },
+    { 90, 1 },
+    { 91, 3 },
+    { 2, 2 },
+    { 5, -2 },
+    { 7, -1 },
+    { 17, -5 },
+    { 22, -4 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, 1 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -4 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 41, -11 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -3 },
+    { 75, -4 },
+    { 76, -3 },
+    { 82, 1 },
+    { 94, -2 },
+    { 1, -1 },
+    { 2, 3 },
+    { 7, -4 },
+    { 8, -1 },
+    { 9, -2 },
+    { 11, -3 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -4 },
+    { 22, -6 },
+    { 24, 1 },
+    { 27, -4 },
+    { 28, -3 },
+    { 31, -5 },
+    { 35, -4 },
+    { 38, 1 },
+    { 41, -3 },
+    { 47, -3 },
+    { 51, -4 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 84, 1 },
+    { 87, 2 },
+    { 88, -3 },
+    { 96, -4 },
+    { 2, 3 },
+    { 5, -1 },
+    { 7, -1 },
+    { 14, -1 },
+    { 17, -5 },
+    { 22, -4 },
+    { 24, 1 },
+    { 27, -4 },
+    { 28, -3 },
+    { 35, -4 },
+    { 38, 1 },
+    { 40, 1 },
+    { 41, -11 },
+    { 43, -1 },
+    { 46, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -1 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 87, 2 },
+    { 96, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -4 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 40, 1 },
+    { 41, -10 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -2 },
+    { 75, -5 },
+    { 76, -2 },
+    { 94, -2 },
+    { 2, 2 },
+    { 14, -1 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 40, 1 },
+    { 41, -4 },
+    { 45, 1 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 84, 1 },
+    { 86, 1 },
+    { 87, 1 },
+    { 91, 2 },
+    { 2, 4 },
+    { 14, -1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 44, 1 },
+    { 60, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 74, -1 },
+    { 84, 2 },
+    { 86, 1 },
+    { 87, 2 },
+    { 90, 1 },
+    { 91, 3 },
+    { 3, -1 },
+    { 5, -1 },
+    { 6, -4 },
+    { 8, -4 },
+    { 10, -3 },
+    { 14, -7 },
+    { 16, -3 },
+    { 17, -4 },
+    { 18, -2 },
+    { 22, -3 },
+    { 24, -3 },
+    { 27, -3 },
+    { 28, -7 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 36, -4 },
+    { 38, -3 },
+    { 41, -10 },
+    { 42, -2 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, 1 },
+    { 46, -6 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -6 },
+    { 56, -4 },
+    { 57, -6 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -6 },
+    { 66, -3 },
+    { 67, -6 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -6 },
+    { 71, -5 },
+    { 72, -6 },
+    { 73, -6 },
+    { 74, -2 },
+    { 75, -6 },
+    { 76, -2 },
+    { 77, -2 },
+    { 88, -2 },
+    { 94, -5 },
+    { 95, -4 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 14, -4 },
+    { 16, -1 },
+    { 17, -2 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -5 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, 1 },
+    { 41, -6 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -2 },
+    { 50, -1 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -4 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -5 },
+    { 71, -3 },
+    { 72, -5 },
+    { 73, -5 },
+    { 74, -2 },
+    { 75, -5 },
+    { 76, -2 },
+    { 77, -2 },
+    { 94, -2 },
+    { 95, -3 },
+    { 2, 2 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -4 },
+    { 31, -4 },
+    { 34, 1 },
+    { 40, 1 },
+    { 41, -6 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -4 },
+    { 60, -3 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 75, -2 },
+    { 94, -2 },
+    { 2, 1 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -4 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 40, 1 },
+    { 41, -10 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, 1 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -4 },
+    { 71, -3 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -2 },
+    { 75, -5 },
+    { 76, -2 },
+    { 94, -2 },
+    { 95, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 17, -6 },
+    { 22, -5 },
+    { 24, 1 },
+    { 25, 1 },
+    { 27, -3 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 36, 1 },
+    { 38, 1 },
+    { 41, -10 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -2 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -4 },
+    { 76, -3 },
+    { 94, -2 },
+    { 95, -1 },
+    { 96, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 13, -1 },
+    { 17, -6 },
+    { 22, -5 },
+    { 24, 1 },
+    { 27, -3 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 41, -11 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -2 },
+    { 46, -4 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, -5 },
+    { 75, -4 },
+    { 76, -3 },
+    { 94, -2 },
+    { 96, -1 },
+    { 1, -3 },
+    { 9, -3 },
+    { 10, -2 },
+    { 11, -3 },
+    { 12, -3 },
+    { 13, -3 },
+    { 14, -4 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -8 },
+    { 18, -2 },
+    { 19, -1 },
+    { 21, -3 },
+    { 22, -7 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -7 },
+    { 28, -6 },
+    { 29, -2 },
+    { 30, -2 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -7 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -14 },
+    { 42, -2 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -3 },
+    { 46, -5 },
+    { 47, -3 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -6 },
+    { 55, -6 },
+    { 56, -5 },
+    { 57, -4 },
+    { 58, -6 },
+    { 59, -5 },
+    { 61, -6 },
+    { 62, -5 },
+    { 63, -3 },
+    { 64, -6 },
+    { 65, -6 },
+    { 66, -3 },
+    { 67, -6 },
+    { 68, -6 },
+    { 69, -6 },
+    { 70, -5 },
+    { 71, -5 },
+    { 72, -5 },
+    { 73, -5 },
+    { 74, -6 },
+    { 75, -3 },
+    { 76, -6 },
+    { 77, -2 },
+    { 82, -2 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 88, -3 },
+    { 90, -2 },
+    { 91, -2 },
+    { 94, -3 },
+    { 95, -2 },
+    { 1, -1 },
+    { 2, 3 },
+    { 5, -2 },
+    { 7, -5 },
+    { 8, -2 },
+    { 9, -4 },
+    { 11, -3 },
+    { 12, -4 },
+    { 13, -3 },
+    { 14, -3 },
+    { 17, -8 },
+    { 22, -8 },
+    { 24, 1 },
+    { 27, -4 },
+    { 28, -3 },
+    { 31, -5 },
+    { 34, 1 },
+    { 35, -4 },
+    { 38, 1 },
+    { 40, -1 },
+    { 41, -11 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -4 },
+    { 46, -2 },
+    { 47, -4 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 87, 2 },
+    { 88, -3 },
+    { 96, -5 },
+    { 2, 2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 14, -1 },
+    { 17, -5 },
+    { 21, -1 },
+    { 22, -4 },
+    { 27, -3 },
+    { 28, -4 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 41, -10 },
+    { 43, -2 },
+    { 44, -2 },
+    { 46, -4 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -4 },
+    { 75, -3 },
+    { 76, -2 },
+    { 77, -1 },
+    { 87, 1 },
+    { 94, -2 },
+    { 95, -2 },
+    { 2, 2 },
+    { 5, -2 },
+    { 6, -2 },
+    { 8, -2 },
+    { 14, -5 },
+    { 17, -4 },
+    { 21, -1 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 31, -5 },
+    { 35, -3 },
+    { 41, -7 },
+    { 43, -2 },
+    { 44, -1 },
+    { 46, -3 },
+    { 50, -1 },
+    { 51, -3 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 87, 1 },
+    { 88, -1 },
+    { 94, -1 },
+    { 96, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 14, -1 },
+    { 17, -4 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 40, 1 },
+    { 41, -10 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, 1 },
+    { 46, -2 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 87, 1 },
+    { 1, -1 },
+    { 2, 3 },
+    { 5, -1 },
+    { 7, -6 },
+    { 9, -4 },
+    { 11, -4 },
+    { 12, -5 },
+    { 13, -4 },
+    { 14, -4 },
+    { 17, -9 },
+    { 22, -8 },
+    { 27, -4 },
+    { 28, -3 },
+    { 31, -5 },
+    { 35, -4 },
+    { 41, -11 },
+    { 43, -1 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -4 },
+    { 51, -4 },
+    { 52, -2 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -4 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -3 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 77, -1 },
+    { 87, 2 },
+    { 88, -2 },
+    { 96, -6 },
+    { 1, -1 },
+    { 2, 3 },
+    { 5, -1 },
+    { 7, -4 },
+    { 9, -1 },
+    { 11, -2 },
+    { 12, -3 },
+    { 13, -3 },
+    { 14, -2 },
+    { 17, -8 },
+    { 22, -7 },
+    { 27, -4 },
+    { 28, -3 },
+    { 31, -5 },
+    { 35, -4 },
+    { 41, -11 },
+    { 43, -1 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, -2 },
+    { 51, -4 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 87, 2 },
+    { 88, -1 },
+    { 96, -4 },
+    { 2, 1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, -3 },
+    { 10, -1 },
+    { 14, -6 },
+    { 16, -1 },
+    { 17, -5 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 22, -3 },
+    { 24, -2 },
+    { 27, -3 },
+    { 28, -4 },
+    { 31, -5 },
+    { 35, -3 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 41, -10 },
+    { 42, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -4 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -3 },
+    { 53, -5 },
+    { 54, -5 },
+    { 55, -5 },
+    { 56, -3 },
+    { 57, -5 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -5 },
+    { 66, -3 },
+    { 67, -5 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -3 },
+    { 88, -4 },
+    { 89, -1 },
+    { 94, -2 },
+    { 95, -1 },
+    { 96, -1 },
+    { 1, -1 },
+    { 2, 3 },
+    { 5, -1 },
+    { 7, -3 },
+    { 9, -1 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -3 },
+    { 14, -2 },
+    { 17, -8 },
+    { 22, -6 },
+    { 27, -4 },
+    { 28, -3 },
+    { 31, -4 },
+    { 35, -4 },
+    { 41, -11 },
+    { 43, -1 },
+    { 45, -3 },
+    { 46, -1 },
+    { 47, -2 },
+    { 51, -4 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -4 },
+    { 75, -2 },
+    { 76, -4 },
+    { 77, -1 },
+    { 87, 2 },
+    { 88, -1 },
+    { 96, -4 },
+    { 5, -1 },
+    { 14, -4 },
+    { 17, -5 },
+    { 22, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 31, -4 },
+    { 34, 1 },
+    { 35, -3 },
+    { 38, 1 },
+    { 41, -10 },
+    { 43, -1 },
+    { 45, 1 },
+    { 46, -2 },
+    { 51, -4 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -3 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -4 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 87, 2 },
+    { 88, -1 },
+    { 10, -2 },
+    { 11, -1 },
+    { 14, -6 },
+    { 16, -3 },
+    { 18, -2 },
+    { 19, -1 },
+    { 22, -4 },
+    { 24, -4 },
+    { 28, -3 },
+    { 32, -1 },
+    { 35, -1 },
+    { 36, -4 },
+    { 38, -4 },
+    { 40, -3 },
+    { 47, -4 },
+    { 51, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -1 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -1 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 74, -5 },
+    { 75, -1 },
+    { 76, -4 },
+    { 83, -1 },
+    { 88, -4 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 17, -3 },
+    { 56, -1 },
+    { 60, -3 },
+    { 66, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -2 },
+    { 22, -5 },
+    { 23, -5 },
+    { 24, -7 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -7 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -10 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -8 },
+    { 37, -5 },
+    { 38, -5 },
+    { 39, -5 },
+    { 40, -6 },
+    { 41, -6 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -5 },
+    { 46, -6 },
+    { 47, -5 },
+    { 79, -5 },
+    { 80, -7 },
+    { 81, -6 },
+    { 93, -8 },
+    { 22, -6 },
+    { 23, -5 },
+    { 24, -6 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -6 },
+    { 29, -5 },
+    { 30, -4 },
+    { 31, -8 },
+    { 32, -6 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -6 },
+    { 37, -5 },
+    { 38, -3 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -6 },
+    { 46, -6 },
+    { 47, -5 },
+    { 79, -6 },
+    { 80, -6 },
+    { 81, -6 },
+    { 93, -6 },
+    { 60, -3 },
+    { 91, 1 },
+    { 52, 2 },
+    { 60, -3 },
+    { 61, 1 },
+    { 62, 1 },
+    { 91, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 2 },
+    { 31, -2 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 4 },
+    { 39, 1 },
+    { 42, 1 },
+    { 80, 1 },
+    { 81, 1 },
+    { 93, 1 },
+    { 5, -4 },
+    { 11, -3 },
+    { 12, -4 },
+    { 13, -2 },
+    { 14, -1 },
+    { 17, -7 },
+    { 22, -3 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, -4 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 40, -1 },
+    { 41, -6 },
+    { 42, 1 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -5 },
+    { 46, -4 },
+    { 47, -4 },
+    { 49, -4 },
+    { 60, -4 },
+    { 66, -1 },
+    { 72, -1 },
+    { 74, -4 },
+    { 75, -1 },
+    { 76, -3 },
+    { 78, -4 },
+    { 82, 1 },
+    { 94, -1 },
+    { 96, -9 },
+    { 5, -2 },
+    { 14, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -1 },
+    { 31, -4 },
+    { 34, 1 },
+    { 41, -1 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -3 },
+    { 56, -1 },
+    { 60, -4 },
+    { 66, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -2 },
+    { 75, -1 },
+    { 86, 1 },
+    { 91, 1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 60, -3 },
+    { 86, 1 },
+    { 87, 1 },
+    { 91, 1 },
+    { 60, -3 },
+    { 52, 2 },
+    { 58, 1 },
+    { 60, -1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 83, 1 },
+    { 86, 5 },
+    { 87, 4 },
+    { 90, 4 },
+    { 91, 4 },
+    { 52, 2 },
+    { 56, 2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 68, 1 },
+    { 70, 2 },
+    { 71, 2 },
+    { 72, 2 },
+    { 73, 2 },
+    { 75, 2 },
+    { 83, 1 },
+    { 84, 1 },
+    { 86, 5 },
+    { 87, 4 },
+    { 90, 4 },
+    { 91, 5 },
+    { 11, -3 },
+    { 12, -4 },
+    { 13, -4 },
+    { 14, -4 },
+    { 17, -3 },
+    { 22, -4 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, -5 },
+    { 34, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 41, -3 },
+    { 42, 1 },
+    { 45, -3 },
+    { 46, -1 },
+    { 47, -6 },
+    { 51, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 60, -4 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 70, 1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 77, -2 },
+    { 82, 1 },
+    { 87, 2 },
+    { 88, -4 },
+    { 96, -7 },
+    { 70, -1 },
+    { 72, -1 },
+    { 74, -3 },
+    { 75, -1 },
+    { 76, -2 },
+    { 57, 1 },
+    { 66, 2 },
+    { 52, 1 },
+    { 60, -1 },
+    { 84, 2 },
+    { 86, 3 },
+    { 87, 3 },
+    { 90, 2 },
+    { 91, 4 },
+    { 52, 3 },
+    { 58, 1 },
+    { 59, 2 },
+    { 61, 2 },
+    { 62, 2 },
+    { 83, 1 },
+    { 84, 3 },
+    { 85, 1 },
+    { 86, 4 },
+    { 87, 1 },
+    { 90, 4 },
+    { 91, 6 },
+    { 92, 1 },
+    { 57, -4 },
+    { 60, -3 },
+    { 66, -3 },
+    { 75, -4 },
+    { 91, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 29, 1 },
+    { 30, 2 },
+    { 31, -2 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 45, 1 },
+    { 47, 1 },
+    { 79, 1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 14, -4 },
+    { 18, -1 },
+    { 22, -4 },
+    { 31, -5 },
+    { 40, -1 },
+    { 43, -1 },
+    { 45, -2 },
+    { 46, -1 },
+    { 47, -2 },
+    { 51, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 60, -4 },
+    { 65, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 74, -2 },
+    { 76, -2 },
+    { 88, -3 },
+    { 14, -6 },
+    { 16, -1 },
+    { 18, -1 },
+    { 22, -6 },
+    { 24, -1 },
+    { 31, -5 },
+    { 36, -1 },
+    { 38, -1 },
+    { 40, -1 },
+    { 47, -1 },
+    { 51, -4 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 57, -2 },
+    { 60, -3 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -2 },
+    { 74, -2 },
+    { 76, -2 },
+    { 88, -4 },
+    { 14, -8 },
+    { 17, -5 },
+    { 28, -1 },
+    { 41, -6 },
+    { 43, -4 },
+    { 44, -3 },
+    { 46, -6 },
+    { 56, -1 },
+    { 60, -1 },
+    { 70, -1 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -4 },
+};
+
 static const EpdFontData opendyslexic_14_italic = {
     opendyslexic_14_italicBitmaps,
     opendyslexic_14_italicGlyphs,
@@ -6060,4 +9572,8 @@ static const EpdFontData opendyslexic_14_italic = {
     38,
     -16,
     true,
+    opendyslexic_14_italicKernLeftClasses,
+    opendyslexic_14_italicKernRightClasses,
+    opendyslexic_14_italicKernPairOffsets,
+    opendyslexic_14_italicKernPairs,
 };
@@ -5177,4 +5177,8 @@ static const EpdFontData opendyslexic_14_regular = {
     38,
     -16,
     true,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
 };
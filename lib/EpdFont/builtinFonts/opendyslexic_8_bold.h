@@ -2545,4 +2545,8 @@ static const EpdFontData opendyslexic_8_bold = {
     22,
     -9,
     true,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
 };
@@ -2864,6 +2864,7346 @@ static const EpdUnicodeInterval opendyslexic_8_bolditalicIntervals[] = {
     { 0x2264, 0x2265, 0x2BF },
 };
 
+static const uint8_t opendyslexic_8_bolditalicKernLeftClasses[705] = {
+    0, 1, 2, 0, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 0, 49, 0, 0,
+    0, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 0, 77, 0, 0,
+    78, 79, 80, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0,
+    83, 0, 0, 83, 83, 84, 85, 0, 0, 0, 0, 86, 87, 88, 89, 0,
+    0, 0, 90, 0, 0, 90, 0, 91, 92, 0, 92, 92, 0, 93, 94, 0,
+    0, 0, 0, 95, 96, 97, 98, 0, 0, 0, 0, 99, 100, 101, 102, 103,
+    0, 0, 0, 0, 0, 104, 0, 105, 0, 0, 0, 106, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 88, 107, 88, 108, 0, 109, 88, 110, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111,
+    112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 113, 114, 115, 0, 116, 117, 115, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t opendyslexic_8_bolditalicKernRightClasses[705] = {
+    0, 1, 2, 0, 3, 0, 4, 5, 6, 7, 8, 0, 9, 0, 10, 0,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    33, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 0, 48, 0, 0,
+    0, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 51, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 0, 75, 0, 0,
+    76, 77, 78, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0,
+    81, 0, 0, 81, 81, 82, 83, 0, 0, 0, 0, 84, 85, 0, 86, 0,
+    0, 0, 87, 0, 0, 87, 0, 88, 89, 0, 90, 89, 0, 91, 92, 0,
+    0, 0, 0, 93, 94, 95, 77, 0, 0, 0, 0, 96, 97, 98, 99, 100,
+    0, 0, 0, 0, 0, 101, 0, 102, 0, 0, 0, 103, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 105, 0, 106, 0, 107, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87,
+    108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 109, 110, 111, 0, 112, 113, 111, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t opendyslexic_8_bolditalicKernPairOffsets[118] = {
+    0, 18, 82, 166, 189, 216, 234, 252, 285, 294, 304, 333, 363, 386, 411, 436,
+    465, 494, 543, 573, 602, 684, 760, 844, 927, 1012, 1094, 1190, 1280, 1362, 1441, 1537,
+    1623, 1709, 1793, 1885, 1971, 2058, 2154, 2238, 2323, 2419, 2510, 2605, 2700, 2786, 2880, 2965,
+    2987, 3007, 3088, 3174, 3259, 3344, 3426, 3513, 3592, 3671, 3752, 3834, 3924, 4006, 4085, 4164,
+    4247, 4331, 4411, 4499, 4582, 4663, 4740, 4828, 4913, 4996, 5081, 5160, 5183, 5202, 5291, 5371,
+    5413, 5460, 5549, 5611, 5671, 5750, 5827, 5903, 5906, 5983, 6062, 6143, 6226, 6258, 6295, 6370,
+    6445, 6522, 6602, 6626, 6630, 6665, 6713, 6763, 6838, 6915, 6985, 7008, 7038, 7041, 7063, 7122,
+    7147, 7166, 7178, 7196, 7217, 7230,
+};
+
+static const EpdKernPair opendyslexic_8_bolditalicKernPairs[] = {
+    { 1, 1 },
+    { 10, 1 },
+    { 21, -1 },
+    { 22, 1 },
+    { 31, -1 },
+    { 40, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 45, -1 },
+    { 50, -1 },
+    { 54, -1 },
+    { 58, -2 },
+    { 64, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 76, -2 },
+    { 5, -4 },
+    { 6, -2 },
+    { 7, -2 },
+    { 22, -4 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -2 },
+    { 31, -6 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -3 },
+    { 47, -3 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -4 },
+    { 74, -4 },
+    { 75, -2 },
+    { 91, -2 },
+    { 92, -2 },
+    { 100, -2 },
+    { 109, -1 },
+    { 110, -2 },
+    { 112, -2 },
+    { 113, -2 },
+    { 3, -4 },
+    { 8, -2 },
+    { 11, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -3 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -5 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -5 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -4 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -5 },
+    { 73, -3 },
+    { 76, -5 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 107, -1 },
+    { 108, -2 },
+    { 1, 1 },
+    { 3, -1 },
+    { 18, -2 },
+    { 21, -3 },
+    { 31, -2 },
+    { 39, -1 },
+    { 40, -4 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -4 },
+    { 50, -1 },
+    { 54, -1 },
+    { 58, -3 },
+    { 64, -1 },
+    { 66, -1 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -2 },
+    { 76, -2 },
+    { 80, -2 },
+    { 5, -2 },
+    { 6, -1 },
+    { 22, -3 },
+    { 31, -4 },
+    { 32, -1 },
+    { 39, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -2 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 71, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 92, -1 },
+    { 100, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, 1 },
+    { 15, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 2 },
+    { 34, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 2 },
+    { 44, 1 },
+    { 45, 1 },
+    { 50, 1 },
+    { 2, 2 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, 2 },
+    { 34, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, 1 },
+    { 44, 1 },
+    { 46, 1 },
+    { 67, 1 },
+    { 100, 2 },
+    { 3, -2 },
+    { 15, -1 },
+    { 21, -3 },
+    { 22, -2 },
+    { 31, -6 },
+    { 32, -1 },
+    { 35, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 42, -2 },
+    { 43, -1 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 49, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 58, -3 },
+    { 61, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 69, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -2 },
+    { 76, -2 },
+    { 80, -3 },
+    { 81, -2 },
+    { 82, -4 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 1, 2 },
+    { 9, 1 },
+    { 10, 2 },
+    { 22, 1 },
+    { 40, -4 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 72, -2 },
+    { 1, 2 },
+    { 9, 1 },
+    { 10, 1 },
+    { 22, 1 },
+    { 40, -4 },
+    { 54, -1 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 72, -2 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -3 },
+    { 30, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 40, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -3 },
+    { 50, -1 },
+    { 58, -3 },
+    { 61, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 71, -2 },
+    { 73, -1 },
+    { 76, -2 },
+    { 80, -2 },
+    { 82, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 100, 2 },
+    { 1, 1 },
+    { 8, -1 },
+    { 15, -2 },
+    { 18, -1 },
+    { 21, -3 },
+    { 22, 1 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 40, -3 },
+    { 41, -1 },
+    { 42, -4 },
+    { 43, -3 },
+    { 45, -4 },
+    { 50, -1 },
+    { 54, -1 },
+    { 58, -3 },
+    { 64, -1 },
+    { 67, -2 },
+    { 69, -3 },
+    { 70, -2 },
+    { 72, -3 },
+    { 76, -3 },
+    { 83, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 100, 2 },
+    { 1, 1 },
+    { 15, -1 },
+    { 21, -3 },
+    { 22, 1 },
+    { 24, -1 },
+    { 31, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 45, -3 },
+    { 50, -1 },
+    { 58, -3 },
+    { 63, -1 },
+    { 64, -1 },
+    { 76, -2 },
+    { 83, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 100, 1 },
+    { 101, -1 },
+    { 102, -1 },
+    { 108, -1 },
+    { 1, 1 },
+    { 3, -1 },
+    { 21, -3 },
+    { 31, -2 },
+    { 32, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 50, -1 },
+    { 58, -3 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 71, -2 },
+    { 73, -1 },
+    { 76, -2 },
+    { 80, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 100, 2 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -3 },
+    { 31, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -3 },
+    { 50, -1 },
+    { 54, -1 },
+    { 58, -3 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 76, -2 },
+    { 80, -2 },
+    { 100, 2 },
+    { 1, 1 },
+    { 3, -1 },
+    { 21, -3 },
+    { 31, -2 },
+    { 32, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 50, -1 },
+    { 54, -1 },
+    { 58, -3 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -1 },
+    { 76, -2 },
+    { 80, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 100, 2 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -3 },
+    { 31, -2 },
+    { 32, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -2 },
+    { 43, -1 },
+    { 44, -2 },
+    { 45, -2 },
+    { 50, -1 },
+    { 54, -1 },
+    { 58, -3 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -1 },
+    { 76, -2 },
+    { 80, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 100, 2 },
+    { 3, -2 },
+    { 21, -4 },
+    { 22, -1 },
+    { 24, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 42, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -2 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -3 },
+    { 59, -1 },
+    { 61, -2 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 71, -2 },
+    { 73, -2 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 101, -1 },
+    { 102, -1 },
+    { 108, -1 },
+    { 1, 1 },
+    { 3, -1 },
+    { 21, -3 },
+    { 28, -1 },
+    { 31, -2 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -3 },
+    { 50, -1 },
+    { 54, -1 },
+    { 58, -3 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 76, -3 },
+    { 80, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 100, 2 },
+    { 1, 1 },
+    { 3, -2 },
+    { 21, -3 },
+    { 30, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -3 },
+    { 50, -1 },
+    { 58, -3 },
+    { 61, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 71, -2 },
+    { 73, -1 },
+    { 76, -2 },
+    { 80, -2 },
+    { 82, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 100, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -4 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -2 },
+    { 22, -4 },
+    { 23, -1 },
+    { 24, -3 },
+    { 25, -1 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -5 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 49, -4 },
+    { 50, -1 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -2 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -3 },
+    { 66, -5 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -4 },
+    { 76, -2 },
+    { 77, -4 },
+    { 78, -1 },
+    { 80, -5 },
+    { 81, -4 },
+    { 82, -4 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, -3 },
+    { 95, -4 },
+    { 100, -1 },
+    { 101, -2 },
+    { 102, -4 },
+    { 103, -2 },
+    { 107, -1 },
+    { 108, -4 },
+    { 1, 1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 8, -2 },
+    { 10, 1 },
+    { 12, 1 },
+    { 13, 1 },
+    { 14, 1 },
+    { 15, -1 },
+    { 16, 1 },
+    { 18, -2 },
+    { 20, 1 },
+    { 21, -3 },
+    { 22, 1 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -3 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -5 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -1 },
+    { 45, -5 },
+    { 46, -1 },
+    { 47, 1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 58, -3 },
+    { 63, -2 },
+    { 64, -1 },
+    { 66, -1 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 72, -4 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -1 },
+    { 83, -2 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, 1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 109, -1 },
+    { 112, -1 },
+    { 2, 1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -3 },
+    { 74, 1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -5 },
+    { 73, -2 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 109, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 6, 1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -5 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 74, 1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 110, 1 },
+    { 113, 1 },
+    { 2, 2 },
+    { 3, -2 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -3 },
+    { 11, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 47, 1 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 76, -3 },
+    { 77, -3 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 108, -3 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -2 },
+    { 7, 1 },
+    { 8, -1 },
+    { 9, -6 },
+    { 10, -5 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -3 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -8 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 48, 1 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -3 },
+    { 60, -2 },
+    { 61, -4 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -3 },
+    { 78, -1 },
+    { 80, -6 },
+    { 81, -4 },
+    { 82, -6 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -2 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 100, -1 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -2 },
+    { 107, -1 },
+    { 108, -3 },
+    { 109, 1 },
+    { 111, -3 },
+    { 1, -1 },
+    { 2, 1 },
+    { 3, -4 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, -1 },
+    { 9, -2 },
+    { 10, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -3 },
+    { 47, 1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, 1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 2 },
+    { 3, -2 },
+    { 6, 1 },
+    { 7, 1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, 1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, 1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 110, 1 },
+    { 113, 1 },
+    { 2, 2 },
+    { 3, -2 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 1, -1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 4, -1 },
+    { 6, 1 },
+    { 7, 2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -6 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 48, 1 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -4 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -4 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -4 },
+    { 72, -2 },
+    { 73, -4 },
+    { 74, 1 },
+    { 75, 2 },
+    { 76, -3 },
+    { 77, -3 },
+    { 78, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -2 },
+    { 107, -1 },
+    { 108, -3 },
+    { 109, 2 },
+    { 110, 1 },
+    { 112, 2 },
+    { 113, 1 },
+    { 3, -3 },
+    { 4, -2 },
+    { 5, -2 },
+    { 6, 1 },
+    { 8, -4 },
+    { 11, -2 },
+    { 14, -1 },
+    { 15, -4 },
+    { 17, -2 },
+    { 18, -3 },
+    { 19, -2 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -6 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -5 },
+    { 37, -6 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -4 },
+    { 46, -2 },
+    { 47, 1 },
+    { 49, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -5 },
+    { 68, -4 },
+    { 69, -6 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -6 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -4 },
+    { 79, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -5 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -5 },
+    { 88, -2 },
+    { 89, -4 },
+    { 90, -4 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 100, -1 },
+    { 101, -4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 108, -4 },
+    { 111, 1 },
+    { 2, -2 },
+    { 3, -2 },
+    { 5, -6 },
+    { 6, 1 },
+    { 8, -6 },
+    { 15, -1 },
+    { 18, -3 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -6 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -6 },
+    { 46, -2 },
+    { 47, 1 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -5 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 109, -4 },
+    { 110, -4 },
+    { 112, -4 },
+    { 113, -4 },
+    { 2, 2 },
+    { 3, -2 },
+    { 6, 1 },
+    { 7, 1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 47, 1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, 1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 109, 1 },
+    { 110, 1 },
+    { 112, 1 },
+    { 113, 1 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 7, 1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 48, 1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -3 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -3 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 107, -1 },
+    { 108, -2 },
+    { 109, 1 },
+    { 110, 1 },
+    { 112, 1 },
+    { 113, 1 },
+    { 2, 3 },
+    { 3, -4 },
+    { 6, 1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -5 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -2 },
+    { 48, 1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 74, 1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 110, 1 },
+    { 113, 1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -6 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -8 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 48, 1 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -4 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -4 },
+    { 82, -6 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 100, -1 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -2 },
+    { 108, -3 },
+    { 111, -4 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -5 },
+    { 4, -2 },
+    { 8, -2 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, -6 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -2 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -4 },
+    { 47, 2 },
+    { 48, 1 },
+    { 49, -4 },
+    { 50, -4 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -2 },
+    { 59, -4 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 75, 1 },
+    { 76, -5 },
+    { 77, -3 },
+    { 78, -1 },
+    { 79, -3 },
+    { 80, -2 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -3 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -3 },
+    { 88, -1 },
+    { 89, -4 },
+    { 90, -4 },
+    { 91, -2 },
+    { 92, -2 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 100, -1 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 107, -2 },
+    { 108, -3 },
+    { 111, 2 },
+    { 2, 1 },
+    { 3, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -2 },
+    { 11, -2 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -5 },
+    { 46, -2 },
+    { 47, 1 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 100, 1 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 108, -3 },
+    { 3, -4 },
+    { 5, -2 },
+    { 6, 1 },
+    { 8, -2 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -3 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -5 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -4 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -2 },
+    { 47, 1 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -3 },
+    { 74, 1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 9, -5 },
+    { 10, -4 },
+    { 11, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -5 },
+    { 16, -1 },
+    { 17, -2 },
+    { 19, -2 },
+    { 20, -1 },
+    { 21, -2 },
+    { 22, -5 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -7 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 48, 1 },
+    { 49, -6 },
+    { 50, -2 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -3 },
+    { 55, -6 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -3 },
+    { 60, -2 },
+    { 61, -6 },
+    { 62, -6 },
+    { 63, -6 },
+    { 64, -7 },
+    { 65, -6 },
+    { 66, -6 },
+    { 67, -4 },
+    { 68, -6 },
+    { 69, -6 },
+    { 70, -6 },
+    { 71, -6 },
+    { 72, -6 },
+    { 73, -6 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -6 },
+    { 78, -1 },
+    { 80, -6 },
+    { 81, -5 },
+    { 82, -5 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -3 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -4 },
+    { 95, -6 },
+    { 100, -4 },
+    { 101, -3 },
+    { 102, -6 },
+    { 103, -2 },
+    { 107, -4 },
+    { 108, -6 },
+    { 109, 1 },
+    { 111, -2 },
+    { 112, 1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 7, 1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -3 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 48, 1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -3 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 107, -1 },
+    { 108, -2 },
+    { 109, 1 },
+    { 110, 1 },
+    { 112, 1 },
+    { 113, 1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -5 },
+    { 4, -2 },
+    { 7, 1 },
+    { 8, -2 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -4 },
+    { 16, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, -3 },
+    { 22, -5 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 49, -5 },
+    { 50, -2 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -3 },
+    { 55, -5 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -5 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -5 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -5 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -5 },
+    { 78, -2 },
+    { 80, -6 },
+    { 81, -5 },
+    { 82, -5 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, -2 },
+    { 94, -4 },
+    { 95, -5 },
+    { 100, -2 },
+    { 101, -3 },
+    { 102, -4 },
+    { 103, -2 },
+    { 107, -2 },
+    { 108, -4 },
+    { 109, 1 },
+    { 111, -2 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -5 },
+    { 4, -2 },
+    { 7, 2 },
+    { 8, -1 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 14, -2 },
+    { 15, -3 },
+    { 16, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -2 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -6 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 48, 1 },
+    { 49, -4 },
+    { 50, -2 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -5 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -5 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -4 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -4 },
+    { 78, -2 },
+    { 80, -6 },
+    { 81, -4 },
+    { 82, -4 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, -2 },
+    { 94, -4 },
+    { 95, -4 },
+    { 100, -1 },
+    { 101, -3 },
+    { 102, -4 },
+    { 103, -2 },
+    { 107, -2 },
+    { 108, -4 },
+    { 109, 1 },
+    { 112, 1 },
+    { 2, 1 },
+    { 3, -3 },
+    { 4, -2 },
+    { 5, -1 },
+    { 7, 1 },
+    { 8, -3 },
+    { 11, -2 },
+    { 15, -3 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -5 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -4 },
+    { 37, -5 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 47, 1 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -5 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -4 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -5 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 100, -1 },
+    { 101, -3 },
+    { 102, -4 },
+    { 103, -3 },
+    { 108, -4 },
+    { 111, 1 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -6 },
+    { 4, -2 },
+    { 7, 1 },
+    { 8, -2 },
+    { 11, -3 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -5 },
+    { 16, -2 },
+    { 17, -3 },
+    { 18, -1 },
+    { 19, -3 },
+    { 20, -2 },
+    { 21, -3 },
+    { 22, -5 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -2 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -7 },
+    { 32, -4 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -3 },
+    { 39, -5 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 49, -6 },
+    { 50, -2 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -6 },
+    { 54, -4 },
+    { 55, -6 },
+    { 56, -3 },
+    { 57, -3 },
+    { 58, -5 },
+    { 59, -3 },
+    { 60, -3 },
+    { 61, -5 },
+    { 62, -5 },
+    { 63, -6 },
+    { 64, -5 },
+    { 65, -5 },
+    { 66, -6 },
+    { 67, -5 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -5 },
+    { 72, -4 },
+    { 73, -6 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -6 },
+    { 78, -2 },
+    { 80, -7 },
+    { 81, -5 },
+    { 82, -5 },
+    { 83, -5 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -2 },
+    { 90, -2 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, -2 },
+    { 94, -4 },
+    { 95, -6 },
+    { 100, -3 },
+    { 101, -3 },
+    { 102, -6 },
+    { 103, -2 },
+    { 107, -3 },
+    { 108, -6 },
+    { 111, -2 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 11, -2 },
+    { 15, -2 },
+    { 17, -2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -3 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 48, 1 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -3 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -3 },
+    { 95, -3 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -2 },
+    { 108, -3 },
+    { 109, 1 },
+    { 112, 1 },
+    { 2, 2 },
+    { 15, -2 },
+    { 23, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, 2 },
+    { 34, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 43, 1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, 3 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 44, 1 },
+    { 46, 1 },
+    { 100, 1 },
+    { 111, 1 },
+    { 2, 1 },
+    { 3, -2 },
+    { 5, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -3 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -3 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -5 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 8, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -4 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -2 },
+    { 74, 1 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 1 },
+    { 3, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -4 },
+    { 17, -1 },
+    { 18, -3 },
+    { 19, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -3 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -5 },
+    { 46, -2 },
+    { 48, -2 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 99, 2 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 108, -3 },
+    { 2, 2 },
+    { 3, -2 },
+    { 4, -1 },
+    { 7, 1 },
+    { 9, -1 },
+    { 15, -1 },
+    { 21, -3 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 75, 1 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, 3 },
+    { 97, 1 },
+    { 98, 4 },
+    { 99, 3 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, 2 },
+    { 105, 4 },
+    { 108, -2 },
+    { 109, 1 },
+    { 2, 1 },
+    { 3, -2 },
+    { 5, -1 },
+    { 8, -1 },
+    { 15, -1 },
+    { 18, -4 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -6 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 2 },
+    { 3, -4 },
+    { 9, -2 },
+    { 10, -2 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 19, -1 },
+    { 21, -5 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 76, -3 },
+    { 77, -2 },
+    { 78, -1 },
+    { 80, -4 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, 2 },
+    { 98, 3 },
+    { 99, 3 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, 2 },
+    { 105, 4 },
+    { 108, -2 },
+    { 110, 1 },
+    { 113, 1 },
+    { 2, 2 },
+    { 3, -2 },
+    { 15, -1 },
+    { 18, -4 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -4 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -1 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 3 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 106, 1 },
+    { 108, -2 },
+    { 2, 1 },
+    { 3, -2 },
+    { 5, -1 },
+    { 8, -1 },
+    { 15, -1 },
+    { 18, -3 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -6 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 2 },
+    { 3, -2 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, 2 },
+    { 98, 3 },
+    { 99, 2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, 2 },
+    { 105, 3 },
+    { 108, -2 },
+    { 2, 2 },
+    { 3, -3 },
+    { 15, -1 },
+    { 21, -3 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -1 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, 2 },
+    { 97, 1 },
+    { 98, 4 },
+    { 99, 3 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 104, 2 },
+    { 105, 4 },
+    { 106, 1 },
+    { 108, -2 },
+    { 3, -3 },
+    { 4, -2 },
+    { 5, -2 },
+    { 8, -4 },
+    { 11, -2 },
+    { 13, 1 },
+    { 14, -1 },
+    { 15, -4 },
+    { 16, 1 },
+    { 17, -2 },
+    { 18, -3 },
+    { 19, -2 },
+    { 23, -2 },
+    { 24, -5 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -5 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -6 },
+    { 43, -5 },
+    { 44, -2 },
+    { 45, -6 },
+    { 46, -2 },
+    { 47, 1 },
+    { 48, -1 },
+    { 49, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -5 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -5 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -4 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -5 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -5 },
+    { 88, -2 },
+    { 89, -4 },
+    { 90, -4 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 96, 1 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, -1 },
+    { 101, -4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 104, 1 },
+    { 105, 1 },
+    { 106, 1 },
+    { 108, -4 },
+    { 3, -2 },
+    { 4, -1 },
+    { 5, -2 },
+    { 8, -2 },
+    { 11, -1 },
+    { 15, -3 },
+    { 17, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -4 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 96, 1 },
+    { 98, 2 },
+    { 99, 1 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 105, 2 },
+    { 108, -3 },
+    { 2, 1 },
+    { 3, -2 },
+    { 5, -1 },
+    { 8, -1 },
+    { 15, -1 },
+    { 18, -3 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -6 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 1 },
+    { 3, -2 },
+    { 5, -1 },
+    { 8, -1 },
+    { 15, -1 },
+    { 18, -3 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -6 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 1 },
+    { 3, -4 },
+    { 5, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -4 },
+    { 21, -4 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -3 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 8, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -4 },
+    { 21, -4 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -6 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -4 },
+    { 4, -2 },
+    { 5, -2 },
+    { 8, -2 },
+    { 11, -2 },
+    { 15, -3 },
+    { 17, -2 },
+    { 18, -3 },
+    { 19, -2 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -4 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -4 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -2 },
+    { 45, -6 },
+    { 46, -2 },
+    { 49, -3 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -4 },
+    { 79, -3 },
+    { 80, -2 },
+    { 83, -4 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -4 },
+    { 88, -1 },
+    { 89, -4 },
+    { 90, -4 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 99, 1 },
+    { 101, -4 },
+    { 102, -3 },
+    { 103, -4 },
+    { 106, 2 },
+    { 108, -4 },
+    { 2, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 9, -3 },
+    { 10, -2 },
+    { 12, -1 },
+    { 14, -2 },
+    { 15, -2 },
+    { 18, -5 },
+    { 19, -1 },
+    { 21, -5 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -6 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 76, -4 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -2 },
+    { 80, -5 },
+    { 81, -3 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 111, -1 },
+    { 113, 1 },
+    { 2, 1 },
+    { 3, -3 },
+    { 5, -1 },
+    { 8, -2 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -4 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -6 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -4 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 2 },
+    { 3, -2 },
+    { 4, -1 },
+    { 15, -3 },
+    { 18, -3 },
+    { 19, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -5 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -5 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 2 },
+    { 3, -2 },
+    { 15, -1 },
+    { 18, -3 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -4 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 99, 2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 9, -4 },
+    { 10, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -3 },
+    { 15, -3 },
+    { 17, -1 },
+    { 18, -6 },
+    { 19, -1 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -6 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -5 },
+    { 49, -4 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -5 },
+    { 81, -4 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 99, 3 },
+    { 100, -1 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -2 },
+    { 108, -3 },
+    { 111, -2 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 9, -2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -2 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -6 },
+    { 19, -1 },
+    { 22, -3 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -5 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -4 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 99, 3 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -2 },
+    { 108, -3 },
+    { 2, 1 },
+    { 3, -3 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -3 },
+    { 17, -1 },
+    { 18, -3 },
+    { 19, -1 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -3 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -5 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -2 },
+    { 55, -4 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -4 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 75, -1 },
+    { 76, -5 },
+    { 77, -4 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 99, 2 },
+    { 100, -1 },
+    { 101, -4 },
+    { 102, -4 },
+    { 103, -2 },
+    { 108, -4 },
+    { 1, -1 },
+    { 2, 2 },
+    { 3, -4 },
+    { 9, -2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 14, -3 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -6 },
+    { 19, -1 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -5 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -4 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -5 },
+    { 81, -4 },
+    { 82, -4 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 99, 3 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -2 },
+    { 108, -3 },
+    { 2, 2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 13, 1 },
+    { 15, -3 },
+    { 16, 1 },
+    { 18, -3 },
+    { 19, -1 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -4 },
+    { 46, -2 },
+    { 48, -1 },
+    { 49, -3 },
+    { 50, -2 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 99, 2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 2, 2 },
+    { 15, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 29, 1 },
+    { 31, 2 },
+    { 34, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 2 },
+    { 45, 1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 65, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 75, 1 },
+    { 5, -2 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 41, 1 },
+    { 52, 1 },
+    { 100, 2 },
+    { 1, -2 },
+    { 3, -4 },
+    { 4, -2 },
+    { 8, -2 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -3 },
+    { 16, -2 },
+    { 17, -2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 20, -3 },
+    { 21, -4 },
+    { 22, -3 },
+    { 23, -4 },
+    { 24, -4 },
+    { 25, -4 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -4 },
+    { 30, -4 },
+    { 31, -5 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -4 },
+    { 49, -4 },
+    { 50, -4 },
+    { 51, -4 },
+    { 52, -4 },
+    { 53, -4 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -4 },
+    { 57, -4 },
+    { 58, -5 },
+    { 59, -4 },
+    { 60, -4 },
+    { 61, -4 },
+    { 62, -4 },
+    { 63, -4 },
+    { 64, -5 },
+    { 65, -4 },
+    { 66, -4 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -4 },
+    { 72, -4 },
+    { 73, -4 },
+    { 76, -5 },
+    { 77, -4 },
+    { 78, -2 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -3 },
+    { 82, -3 },
+    { 83, -4 },
+    { 84, -4 },
+    { 85, -4 },
+    { 86, -4 },
+    { 87, -4 },
+    { 88, -4 },
+    { 89, -4 },
+    { 90, -4 },
+    { 92, -2 },
+    { 93, -4 },
+    { 94, -4 },
+    { 95, -4 },
+    { 101, -4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 107, -2 },
+    { 108, -4 },
+    { 3, -2 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -3 },
+    { 17, -1 },
+    { 18, -3 },
+    { 19, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -4 },
+    { 41, -3 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -5 },
+    { 46, -2 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 108, -3 },
+    { 1, 1 },
+    { 3, -1 },
+    { 15, -1 },
+    { 21, -3 },
+    { 24, -2 },
+    { 28, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 45, -2 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -2 },
+    { 58, -2 },
+    { 63, -2 },
+    { 66, -1 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -2 },
+    { 72, -3 },
+    { 76, -2 },
+    { 77, -2 },
+    { 83, -2 },
+    { 87, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 93, -1 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -1 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -2 },
+    { 21, -4 },
+    { 22, -1 },
+    { 24, -2 },
+    { 28, -2 },
+    { 31, -2 },
+    { 32, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -1 },
+    { 39, -2 },
+    { 44, -1 },
+    { 46, -2 },
+    { 49, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 58, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -1 },
+    { 77, -2 },
+    { 79, 1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 102, -2 },
+    { 108, -2 },
+    { 1, -3 },
+    { 3, -6 },
+    { 4, -3 },
+    { 8, -2 },
+    { 11, -3 },
+    { 12, -3 },
+    { 13, -3 },
+    { 14, -4 },
+    { 15, -4 },
+    { 16, -3 },
+    { 17, -3 },
+    { 18, -7 },
+    { 19, -3 },
+    { 20, -3 },
+    { 21, -8 },
+    { 22, -4 },
+    { 23, -5 },
+    { 24, -5 },
+    { 25, -5 },
+    { 26, -5 },
+    { 27, -5 },
+    { 28, -5 },
+    { 29, -5 },
+    { 30, -5 },
+    { 31, -6 },
+    { 32, -5 },
+    { 33, -5 },
+    { 34, -5 },
+    { 35, -5 },
+    { 36, -5 },
+    { 37, -5 },
+    { 38, -5 },
+    { 39, -6 },
+    { 40, -9 },
+    { 41, -5 },
+    { 42, -6 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -7 },
+    { 46, -5 },
+    { 49, -5 },
+    { 50, -5 },
+    { 51, -5 },
+    { 52, -5 },
+    { 53, -5 },
+    { 54, -4 },
+    { 55, -4 },
+    { 56, -5 },
+    { 57, -5 },
+    { 58, -7 },
+    { 59, -5 },
+    { 60, -5 },
+    { 61, -5 },
+    { 62, -5 },
+    { 63, -4 },
+    { 64, -6 },
+    { 65, -5 },
+    { 66, -6 },
+    { 67, -4 },
+    { 68, -4 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -6 },
+    { 72, -4 },
+    { 73, -6 },
+    { 76, -7 },
+    { 77, -5 },
+    { 78, -3 },
+    { 79, -4 },
+    { 80, -2 },
+    { 81, -4 },
+    { 82, -5 },
+    { 83, -5 },
+    { 84, -5 },
+    { 85, -5 },
+    { 86, -5 },
+    { 87, -5 },
+    { 88, -5 },
+    { 89, -5 },
+    { 90, -5 },
+    { 92, -3 },
+    { 93, -5 },
+    { 94, -5 },
+    { 95, -5 },
+    { 101, -4 },
+    { 102, -4 },
+    { 103, -4 },
+    { 107, -3 },
+    { 108, -4 },
+    { 3, -1 },
+    { 8, -2 },
+    { 15, -1 },
+    { 18, -2 },
+    { 21, -3 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -3 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -5 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -1 },
+    { 45, -5 },
+    { 46, -1 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 58, -3 },
+    { 63, -2 },
+    { 64, -1 },
+    { 66, -1 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 72, -4 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -1 },
+    { 83, -2 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -1 },
+    { 8, -1 },
+    { 21, -2 },
+    { 23, -1 },
+    { 24, -2 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -2 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -4 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -1 },
+    { 39, -1 },
+    { 40, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, -1 },
+    { 58, -3 },
+    { 63, -2 },
+    { 64, -1 },
+    { 66, -1 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 72, -3 },
+    { 76, -2 },
+    { 77, -1 },
+    { 80, -1 },
+    { 83, -2 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 93, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -1 },
+    { 108, -2 },
+    { 3, -3 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -4 },
+    { 68, -3 },
+    { 69, -4 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -5 },
+    { 73, -2 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -2 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 21, -2 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -2 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 85, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 31, 1 },
+    { 58, -1 },
+    { 100, 1 },
+    { 3, -2 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 21, -2 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, 1 },
+    { 86, 1 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 100, 1 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -4 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 21, -5 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -5 },
+    { 32, -3 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -5 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 1, 4 },
+    { 4, 3 },
+    { 8, 4 },
+    { 11, 4 },
+    { 12, 3 },
+    { 13, 3 },
+    { 14, 3 },
+    { 15, 3 },
+    { 16, 3 },
+    { 17, 4 },
+    { 18, 3 },
+    { 19, 3 },
+    { 20, 4 },
+    { 21, 2 },
+    { 22, 1 },
+    { 23, 2 },
+    { 24, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 2 },
+    { 30, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 2 },
+    { 37, 2 },
+    { 38, 1 },
+    { 40, 1 },
+    { 41, 2 },
+    { 42, 1 },
+    { 43, 1 },
+    { 45, 1 },
+    { 46, 1 },
+    { 49, 2 },
+    { 50, 1 },
+    { 51, 2 },
+    { 52, 2 },
+    { 53, 2 },
+    { 54, 2 },
+    { 55, 2 },
+    { 56, 1 },
+    { 57, 2 },
+    { 59, 1 },
+    { 60, 2 },
+    { 61, 1 },
+    { 62, 1 },
+    { 63, 2 },
+    { 64, 1 },
+    { 65, 1 },
+    { 67, 2 },
+    { 68, 2 },
+    { 69, 2 },
+    { 70, 2 },
+    { 72, 2 },
+    { 73, 1 },
+    { 76, 1 },
+    { 77, 2 },
+    { 78, 4 },
+    { 79, 2 },
+    { 81, 1 },
+    { 82, 1 },
+    { 83, 2 },
+    { 84, 1 },
+    { 85, 1 },
+    { 86, 1 },
+    { 87, 2 },
+    { 88, 2 },
+    { 89, 2 },
+    { 90, 2 },
+    { 92, 3 },
+    { 93, 2 },
+    { 94, 2 },
+    { 95, 2 },
+    { 101, 2 },
+    { 102, 2 },
+    { 103, 2 },
+    { 107, 3 },
+    { 108, 2 },
+    { 3, -4 },
+    { 4, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 21, -3 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -3 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -3 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -3 },
+    { 60, -2 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -3 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -3 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -1 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 107, -1 },
+    { 108, -2 },
+    { 2, 2 },
+    { 18, -2 },
+    { 21, -3 },
+    { 22, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 31, -6 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 39, -3 },
+    { 40, -5 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -2 },
+    { 48, -1 },
+    { 50, -1 },
+    { 58, -3 },
+    { 61, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -3 },
+    { 72, -1 },
+    { 73, -2 },
+    { 100, 1 },
+    { 111, -2 },
+    { 1, 1 },
+    { 2, 1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 21, -3 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -2 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 40, -2 },
+    { 41, -1 },
+    { 42, -3 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -3 },
+    { 50, -1 },
+    { 54, -1 },
+    { 58, -3 },
+    { 64, -1 },
+    { 67, -2 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 76, -3 },
+    { 80, -2 },
+    { 83, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 98, 2 },
+    { 99, 2 },
+    { 100, 2 },
+    { 105, 2 },
+    { 3, -2 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 21, -3 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -3 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -2 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -3 },
+    { 21, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -5 },
+    { 41, -3 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -5 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -5 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -2 },
+    { 8, -1 },
+    { 15, -1 },
+    { 18, -4 },
+    { 20, -1 },
+    { 21, -5 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -2 },
+    { 42, -5 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -6 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -4 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -3 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -2 },
+    { 4, -1 },
+    { 8, -1 },
+    { 11, -1 },
+    { 15, -4 },
+    { 17, -1 },
+    { 18, -3 },
+    { 19, -1 },
+    { 21, -4 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -3 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -6 },
+    { 41, -3 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -2 },
+    { 45, -5 },
+    { 46, -2 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -3 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -3 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -3 },
+    { 73, -2 },
+    { 76, -4 },
+    { 77, -3 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -3 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -3 },
+    { 88, -2 },
+    { 89, -3 },
+    { 90, -3 },
+    { 93, -3 },
+    { 94, -3 },
+    { 95, -3 },
+    { 101, -3 },
+    { 102, -3 },
+    { 103, -3 },
+    { 108, -3 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 2 },
+    { 33, 1 },
+    { 34, 1 },
+    { 38, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 45, 1 },
+    { 50, 2 },
+    { 56, 1 },
+    { 57, 2 },
+    { 59, 1 },
+    { 60, 1 },
+    { 67, 1 },
+    { 91, 1 },
+    { 92, 1 },
+    { 100, 1 },
+    { 31, 2 },
+    { 58, -1 },
+    { 67, 1 },
+    { 100, 1 },
+    { 23, 3 },
+    { 24, 1 },
+    { 25, 3 },
+    { 26, 2 },
+    { 27, 2 },
+    { 28, 1 },
+    { 29, 2 },
+    { 30, 2 },
+    { 31, 2 },
+    { 32, 2 },
+    { 33, 2 },
+    { 34, 2 },
+    { 35, 2 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 3 },
+    { 41, 3 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 2 },
+    { 45, 2 },
+    { 46, 1 },
+    { 50, 3 },
+    { 54, 2 },
+    { 56, 2 },
+    { 57, 3 },
+    { 58, 1 },
+    { 59, 2 },
+    { 60, 3 },
+    { 67, 1 },
+    { 91, 3 },
+    { 92, 2 },
+    { 100, 1 },
+    { 23, 2 },
+    { 24, 1 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 2 },
+    { 30, 2 },
+    { 31, 2 },
+    { 32, 1 },
+    { 33, 2 },
+    { 34, 2 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 2 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 2 },
+    { 45, 2 },
+    { 46, 1 },
+    { 50, 2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 54, 2 },
+    { 55, 1 },
+    { 56, 2 },
+    { 57, 2 },
+    { 59, 2 },
+    { 60, 2 },
+    { 61, 2 },
+    { 62, 2 },
+    { 64, 2 },
+    { 65, 2 },
+    { 66, 1 },
+    { 67, 2 },
+    { 68, 2 },
+    { 69, 3 },
+    { 70, 3 },
+    { 71, 2 },
+    { 72, 3 },
+    { 73, 1 },
+    { 91, 2 },
+    { 92, 2 },
+    { 100, 1 },
+    { 2, 2 },
+    { 11, 1 },
+    { 13, 1 },
+    { 16, 1 },
+    { 17, 1 },
+    { 20, 1 },
+    { 21, -2 },
+    { 22, -1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 2 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, -4 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 40, -2 },
+    { 41, 1 },
+    { 43, 1 },
+    { 44, -1 },
+    { 46, -2 },
+    { 50, 1 },
+    { 54, 1 },
+    { 57, 1 },
+    { 58, -1 },
+    { 60, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 91, 2 },
+    { 92, 1 },
+    { 96, 1 },
+    { 97, 1 },
+    { 98, 2 },
+    { 99, 3 },
+    { 104, 1 },
+    { 105, 2 },
+    { 106, 1 },
+    { 110, 1 },
+    { 111, -1 },
+    { 113, 1 },
+    { 3, -4 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 21, -2 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -3 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -4 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 18, -2 },
+    { 21, -4 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -4 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -2 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -4 },
+    { 45, -4 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -5 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -3 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -3 },
+    { 70, -3 },
+    { 71, -4 },
+    { 72, -3 },
+    { 73, -3 },
+    { 76, -4 },
+    { 77, -2 },
+    { 79, -1 },
+    { 80, -4 },
+    { 81, -2 },
+    { 82, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 3, -2 },
+    { 15, -1 },
+    { 21, -3 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -4 },
+    { 59, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 73, -2 },
+    { 76, -3 },
+    { 77, -2 },
+    { 80, -2 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -2 },
+    { 86, -2 },
+    { 87, -2 },
+    { 88, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 93, -2 },
+    { 94, -2 },
+    { 95, -2 },
+    { 101, -2 },
+    { 102, -2 },
+    { 103, -2 },
+    { 108, -2 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 2 },
+    { 33, 1 },
+    { 34, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 2 },
+    { 43, 1 },
+    { 44, 1 },
+    { 45, 2 },
+    { 50, 2 },
+    { 56, 1 },
+    { 57, 2 },
+    { 59, 1 },
+    { 60, 1 },
+    { 67, 1 },
+    { 91, 1 },
+    { 100, 1 },
+    { 23, 3 },
+    { 25, 3 },
+    { 26, 2 },
+    { 27, 2 },
+    { 29, 2 },
+    { 30, 3 },
+    { 31, 2 },
+    { 32, 2 },
+    { 33, 2 },
+    { 34, 2 },
+    { 35, 2 },
+    { 38, 2 },
+    { 39, 1 },
+    { 40, 3 },
+    { 41, 3 },
+    { 42, 3 },
+    { 43, 2 },
+    { 44, 2 },
+    { 45, 3 },
+    { 46, 2 },
+    { 50, 3 },
+    { 54, 1 },
+    { 56, 2 },
+    { 57, 3 },
+    { 59, 2 },
+    { 60, 2 },
+    { 67, 1 },
+    { 91, 3 },
+    { 92, 2 },
+    { 100, 1 },
+    { 31, 2 },
+    { 67, 1 },
+    { 100, 1 },
+    { 1, 1 },
+    { 18, -1 },
+    { 21, -3 },
+    { 24, -1 },
+    { 28, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 40, -4 },
+    { 41, -1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 45, -3 },
+    { 50, -1 },
+    { 58, -2 },
+    { 64, -1 },
+    { 69, -1 },
+    { 76, -3 },
+    { 83, -1 },
+    { 87, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 1, 4 },
+    { 3, 1 },
+    { 4, 2 },
+    { 11, 2 },
+    { 12, 3 },
+    { 13, 3 },
+    { 14, 3 },
+    { 15, 2 },
+    { 16, 3 },
+    { 17, 2 },
+    { 18, 2 },
+    { 19, 2 },
+    { 20, 3 },
+    { 22, 2 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 29, 1 },
+    { 30, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 44, 1 },
+    { 45, 1 },
+    { 46, 1 },
+    { 50, 1 },
+    { 56, 1 },
+    { 57, 1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 71, 1 },
+    { 73, 1 },
+    { 78, 3 },
+    { 79, 3 },
+    { 80, 1 },
+    { 81, 2 },
+    { 82, 2 },
+    { 84, 1 },
+    { 85, 1 },
+    { 86, 1 },
+    { 88, 1 },
+    { 89, 1 },
+    { 90, 1 },
+    { 92, 3 },
+    { 93, 1 },
+    { 107, 3 },
+    { 1, 2 },
+    { 4, 2 },
+    { 8, 1 },
+    { 11, 2 },
+    { 12, 2 },
+    { 13, 2 },
+    { 14, 2 },
+    { 15, 1 },
+    { 16, 2 },
+    { 17, 2 },
+    { 19, 2 },
+    { 20, 1 },
+    { 21, -1 },
+    { 22, 1 },
+    { 40, -3 },
+    { 42, -1 },
+    { 45, -2 },
+    { 58, -1 },
+    { 76, -1 },
+    { 78, 2 },
+    { 79, 1 },
+    { 81, 1 },
+    { 82, 1 },
+    { 92, 2 },
+    { 107, 2 },
+    { 2, 2 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, -1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 41, 1 },
+    { 54, 1 },
+    { 67, 1 },
+    { 91, 1 },
+    { 110, 1 },
+    { 113, 1 },
+    { 2, 2 },
+    { 22, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 29, 1 },
+    { 31, -2 },
+    { 34, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 109, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 29, 1 },
+    { 31, 2 },
+    { 32, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 44, 1 },
+    { 45, -1 },
+    { 46, 1 },
+    { 100, 2 },
+    { 2, 2 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, 1 },
+    { 28, 2 },
+    { 29, 1 },
+    { 31, -1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 41, 1 },
+    { 54, 1 },
+    { 67, 1 },
+    { 91, 1 },
+    { 100, 1 },
+    { 110, 1 },
+    { 113, 1 },
+    { 2, 2 },
+    { 22, -1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, -2 },
+    { 34, 1 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 112, 1 },
+};
+
 static const EpdFontData opendyslexic_8_bolditalic = {
     opendyslexic_8_bolditalicBitmaps,
     opendyslexic_8_bolditalicGlyphs,
@@ -2873,4 +10213,8 @@ static const EpdFontData opendyslexic_8_bolditalic = {
     22,
     -9,
     true,
+    opendyslexic_8_bolditalicKernLeftClasses,
+    opendyslexic_8_bolditalicKernRightClasses,
+    opendyslexic_8_bolditalicKernPairOffsets,
+    opendyslexic_8_bolditalicKernPairs,
 };
@@ -2633,6 +2633,2821 @@ static const EpdUnicodeInterval opendyslexic_8_italicIntervals[] = {
     { 0x2264, 0x2265, 0x2BF },
 };
 
+static const uint8_t opendyslexic_8_italicKernLeftClasses[705] = {
+    0, 1, 2, 0, 0, 0, 0, 2, 3, 4, 5, 0, 6, 7, 8, 0,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 9, 18, 0, 0, 0, 0, 19,
+    0, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 0, 47, 48, 0,
+    0, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 56, 62,
+    63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 0, 75, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 76, 77, 0, 0, 0, 0, 78, 78, 79, 78, 0,
+    0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 0, 0, 0, 81, 82, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 78, 84, 85, 86,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 0, 0,
+    0, 0, 0, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 78, 89, 78, 90, 91, 0, 78, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 94, 95, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint8_t opendyslexic_8_italicKernRightClasses[705] = {
+    0, 1, 2, 0, 0, 0, 0, 3, 4, 5, 6, 0, 7, 8, 9, 0,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 21,
+    0, 22, 23, 24, 25, 26, 27, 28, 23, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 36, 38, 39, 40, 41, 42, 43, 44, 45, 0, 0, 46, 47, 0,
+    0, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+    63, 62, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 0, 74, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 75, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 78, 79, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 81, 82, 83, 84,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 86, 0, 87, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 90, 91, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0,
+};
+
+static const uint16_t opendyslexic_8_italicKernPairOffsets[96] = {
+    0, 2, 3, 45, 50, 55, 63, 70, 77, 87, 109, 116, 123, 146, 155, 163,
+    174, 182, 184, 212, 274, 310, 345, 382, 416, 478, 541, 571, 602, 631, 683, 723,
+    769, 824, 862, 903, 944, 982, 1032, 1103, 1135, 1185, 1234, 1281, 1345, 1384, 1408, 1409,
+    1416, 1455, 1502, 1550, 1585, 1624, 1667, 1700, 1739, 1774, 1780, 1831, 1872, 1887, 1927, 1967,
+    2038, 2085, 2125, 2167, 2205, 2251, 2295, 2348, 2393, 2430, 2463, 2474, 2502, 2530, 2531, 2533,
+    2546, 2573, 2584, 2588, 2596, 2612, 2639, 2641, 2643, 2649, 2662, 2666, 2668, 2679, 2696, 2707,
+};
+
+static const EpdKernPair opendyslexic_8_italicKernPairs[] = {
+    { 28, -1 },
+    { 39, -1 },
+    { 2, 2 },
+    { 10, -2 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -3 },
+    { 15, -1 },
+    { 16, -2 },
+    { 18, -2 },
+    { 19, -2 },
+    { 22, -2 },
+    { 24, -2 },
+    { 27, -1 },
+    { 28, -2 },
+    { 31, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 35, -2 },
+    { 36, -1 },
+    { 37, -2 },
+    { 38, -2 },
+    { 43, -1 },
+    { 45, -2 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 79, -2 },
+    { 84, -2 },
+    { 2, 1 },
+    { 5, -2 },
+    { 17, -1 },
+    { 44, -1 },
+    { 57, -1 },
+    { 2, 1 },
+    { 8, -1 },
+    { 39, -1 },
+    { 57, -1 },
+    { 70, -1 },
+    { 1, 1 },
+    { 28, -1 },
+    { 39, -4 },
+    { 44, -1 },
+    { 66, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 71, -1 },
+    { 5, -1 },
+    { 6, -2 },
+    { 38, -4 },
+    { 39, -2 },
+    { 44, -2 },
+    { 57, -1 },
+    { 70, -2 },
+    { 1, 1 },
+    { 39, -4 },
+    { 44, -1 },
+    { 66, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 71, -2 },
+    { 2, 2 },
+    { 5, -2 },
+    { 22, -1 },
+    { 30, -2 },
+    { 43, -1 },
+    { 44, -1 },
+    { 57, -2 },
+    { 70, -1 },
+    { 74, -1 },
+    { 91, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 8, -1 },
+    { 14, -3 },
+    { 17, -2 },
+    { 30, -2 },
+    { 39, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 44, -2 },
+    { 46, -2 },
+    { 47, -1 },
+    { 57, -2 },
+    { 66, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 71, -2 },
+    { 73, -1 },
+    { 74, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 2, 1 },
+    { 5, -2 },
+    { 14, -2 },
+    { 30, -2 },
+    { 44, -1 },
+    { 57, -2 },
+    { 74, -1 },
+    { 5, -2 },
+    { 30, -2 },
+    { 43, -1 },
+    { 44, -1 },
+    { 57, -2 },
+    { 70, -1 },
+    { 74, -1 },
+    { 5, -2 },
+    { 11, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 17, -2 },
+    { 22, -1 },
+    { 30, -2 },
+    { 39, -2 },
+    { 41, -2 },
+    { 42, -1 },
+    { 44, -2 },
+    { 46, -2 },
+    { 57, -2 },
+    { 65, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -2 },
+    { 89, -2 },
+    { 90, -1 },
+    { 91, -1 },
+    { 5, -1 },
+    { 30, -2 },
+    { 43, -1 },
+    { 57, -2 },
+    { 66, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 90, -1 },
+    { 5, -1 },
+    { 30, -2 },
+    { 57, -2 },
+    { 66, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 90, -1 },
+    { 14, -1 },
+    { 22, -1 },
+    { 30, -3 },
+    { 45, -1 },
+    { 57, -2 },
+    { 60, -1 },
+    { 63, -1 },
+    { 65, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 91, -2 },
+    { 5, -2 },
+    { 30, -2 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 57, -2 },
+    { 70, -1 },
+    { 74, -1 },
+    { 2, 2 },
+    { 39, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 17, 1 },
+    { 23, 2 },
+    { 25, 2 },
+    { 26, 2 },
+    { 27, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 31, 1 },
+    { 32, 1 },
+    { 33, 2 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 39, 2 },
+    { 40, 2 },
+    { 41, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 2 },
+    { 49, 2 },
+    { 56, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 78, 2 },
+    { 5, -2 },
+    { 10, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 17, -2 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -5 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -5 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -7 },
+    { 40, -4 },
+    { 41, -8 },
+    { 42, -6 },
+    { 43, -3 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -3 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 61, -2 },
+    { 62, -3 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -4 },
+    { 67, -3 },
+    { 68, -5 },
+    { 69, -4 },
+    { 70, -2 },
+    { 71, -5 },
+    { 72, -2 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -5 },
+    { 77, -3 },
+    { 78, 1 },
+    { 88, -5 },
+    { 89, -3 },
+    { 90, -2 },
+    { 5, -2 },
+    { 17, -1 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -1 },
+    { 57, -2 },
+    { 70, -1 },
+    { 74, -2 },
+    { 75, -4 },
+    { 76, -3 },
+    { 77, -3 },
+    { 88, -3 },
+    { 89, -1 },
+    { 90, -1 },
+    { 14, -1 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 53, -1 },
+    { 57, -2 },
+    { 66, -1 },
+    { 68, -3 },
+    { 69, -1 },
+    { 71, -3 },
+    { 75, -3 },
+    { 76, -3 },
+    { 77, -4 },
+    { 88, -4 },
+    { 5, -2 },
+    { 17, -2 },
+    { 22, -5 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -4 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -5 },
+    { 39, -5 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -6 },
+    { 44, -6 },
+    { 45, -4 },
+    { 46, -1 },
+    { 51, 1 },
+    { 57, -2 },
+    { 70, -2 },
+    { 74, -2 },
+    { 75, -6 },
+    { 76, -3 },
+    { 77, -3 },
+    { 78, 1 },
+    { 88, -3 },
+    { 91, -1 },
+    { 14, -3 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 57, -2 },
+    { 66, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 71, -2 },
+    { 75, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 88, -4 },
+    { 1, -1 },
+    { 7, -6 },
+    { 9, -5 },
+    { 11, -1 },
+    { 14, -2 },
+    { 18, -1 },
+    { 22, -7 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -5 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 48, -3 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -2 },
+    { 56, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -1 },
+    { 61, -3 },
+    { 62, -3 },
+    { 63, -4 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 75, -8 },
+    { 76, -4 },
+    { 77, -4 },
+    { 84, -1 },
+    { 86, 1 },
+    { 88, -4 },
+    { 91, -5 },
+    { 1, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 17, -1 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -1 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -3 },
+    { 66, -4 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -3 },
+    { 74, -1 },
+    { 75, -5 },
+    { 76, -3 },
+    { 77, -3 },
+    { 78, 1 },
+    { 88, -3 },
+    { 89, -1 },
+    { 90, -2 },
+    { 91, -1 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -4 },
+    { 45, -3 },
+    { 57, -2 },
+    { 75, -3 },
+    { 76, -3 },
+    { 77, -3 },
+    { 78, 1 },
+    { 88, -3 },
+    { 2, 1 },
+    { 5, -1 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -1 },
+    { 30, -5 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -2 },
+    { 45, -2 },
+    { 57, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 88, -2 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -4 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 57, -1 },
+    { 75, -4 },
+    { 76, -4 },
+    { 77, -3 },
+    { 88, -3 },
+    { 5, -2 },
+    { 10, -2 },
+    { 14, -4 },
+    { 16, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -6 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -6 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -6 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -5 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -3 },
+    { 44, -5 },
+    { 45, -3 },
+    { 46, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 54, -2 },
+    { 57, -2 },
+    { 62, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -3 },
+    { 69, -2 },
+    { 71, -3 },
+    { 74, -1 },
+    { 75, -3 },
+    { 76, -6 },
+    { 77, -3 },
+    { 84, -1 },
+    { 88, -6 },
+    { 89, -1 },
+    { 90, -2 },
+    { 5, -2 },
+    { 14, -5 },
+    { 17, -2 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -7 },
+    { 40, -4 },
+    { 41, -6 },
+    { 42, -5 },
+    { 43, -3 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -3 },
+    { 57, -2 },
+    { 66, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 71, -3 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 88, -4 },
+    { 89, -5 },
+    { 90, -6 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -4 },
+    { 45, -3 },
+    { 48, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 55, 1 },
+    { 56, 1 },
+    { 57, -2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 64, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 75, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, 1 },
+    { 79, 1 },
+    { 88, -4 },
+    { 7, -1 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -3 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 75, -4 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, 1 },
+    { 88, -3 },
+    { 91, -1 },
+    { 5, -2 },
+    { 13, -1 },
+    { 17, -1 },
+    { 22, -5 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -4 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -4 },
+    { 43, -6 },
+    { 44, -5 },
+    { 45, -4 },
+    { 46, -1 },
+    { 57, -2 },
+    { 66, 1 },
+    { 70, -1 },
+    { 74, -2 },
+    { 75, -5 },
+    { 76, -3 },
+    { 77, -3 },
+    { 78, 1 },
+    { 88, -3 },
+    { 91, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -4 },
+    { 8, -4 },
+    { 9, -4 },
+    { 14, -2 },
+    { 22, -7 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -5 },
+    { 44, -4 },
+    { 45, -6 },
+    { 48, -1 },
+    { 57, -2 },
+    { 70, -1 },
+    { 72, -1 },
+    { 74, -2 },
+    { 75, -9 },
+    { 76, -4 },
+    { 77, -3 },
+    { 84, -1 },
+    { 88, -3 },
+    { 91, -6 },
+    { 5, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 17, -2 },
+    { 22, -4 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -2 },
+    { 26, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 29, -2 },
+    { 30, -2 },
+    { 31, -3 },
+    { 32, -2 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -2 },
+    { 36, -3 },
+    { 37, -1 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -2 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -4 },
+    { 44, -4 },
+    { 45, -3 },
+    { 57, 1 },
+    { 60, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 70, -2 },
+    { 72, -1 },
+    { 75, -4 },
+    { 76, -2 },
+    { 77, -2 },
+    { 88, -2 },
+    { 89, -1 },
+    { 2, 1 },
+    { 5, -2 },
+    { 14, -1 },
+    { 17, -1 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -5 },
+    { 40, -4 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -3 },
+    { 44, -6 },
+    { 45, -3 },
+    { 46, -1 },
+    { 49, -1 },
+    { 57, -2 },
+    { 74, -2 },
+    { 75, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 88, -4 },
+    { 89, -1 },
+    { 90, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 17, -1 },
+    { 22, -4 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -3 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -4 },
+    { 39, -5 },
+    { 40, -3 },
+    { 41, -5 },
+    { 42, -5 },
+    { 43, -5 },
+    { 44, -5 },
+    { 45, -3 },
+    { 46, -2 },
+    { 48, 1 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 54, 1 },
+    { 57, -2 },
+    { 58, 1 },
+    { 59, 1 },
+    { 62, 1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 74, -1 },
+    { 75, -5 },
+    { 76, -3 },
+    { 77, -3 },
+    { 78, 1 },
+    { 84, 1 },
+    { 88, -3 },
+    { 89, -1 },
+    { 90, -2 },
+    { 1, -1 },
+    { 2, 2 },
+    { 6, -2 },
+    { 7, -5 },
+    { 8, -2 },
+    { 9, -4 },
+    { 10, -1 },
+    { 11, -2 },
+    { 14, -4 },
+    { 16, -1 },
+    { 20, -2 },
+    { 21, -2 },
+    { 22, -8 },
+    { 23, -3 },
+    { 24, -6 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -5 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 47, -2 },
+    { 48, -6 },
+    { 49, -2 },
+    { 50, -6 },
+    { 51, -6 },
+    { 52, -6 },
+    { 53, -3 },
+    { 54, -6 },
+    { 55, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -2 },
+    { 60, -3 },
+    { 61, -6 },
+    { 62, -6 },
+    { 63, -7 },
+    { 64, -6 },
+    { 65, -6 },
+    { 66, -6 },
+    { 67, -6 },
+    { 68, -6 },
+    { 69, -6 },
+    { 70, -6 },
+    { 71, -6 },
+    { 72, -6 },
+    { 75, -8 },
+    { 76, -6 },
+    { 77, -4 },
+    { 78, 1 },
+    { 83, -1 },
+    { 84, -4 },
+    { 86, 1 },
+    { 88, -4 },
+    { 91, -4 },
+    { 2, 2 },
+    { 22, -5 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -3 },
+    { 36, -4 },
+    { 37, -2 },
+    { 38, -4 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 57, -2 },
+    { 70, -1 },
+    { 75, -5 },
+    { 76, -3 },
+    { 77, -3 },
+    { 88, -3 },
+    { 91, -1 },
+    { 10, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 18, -1 },
+    { 21, -1 },
+    { 22, -8 },
+    { 23, -3 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -5 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 48, -2 },
+    { 49, 1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 54, -1 },
+    { 57, -2 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 70, -2 },
+    { 72, -2 },
+    { 75, -8 },
+    { 76, -5 },
+    { 77, -5 },
+    { 84, -2 },
+    { 88, -5 },
+    { 91, -4 },
+    { 14, -2 },
+    { 16, -1 },
+    { 18, -1 },
+    { 22, -6 },
+    { 23, -3 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -4 },
+    { 36, -4 },
+    { 37, -3 },
+    { 38, -5 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 48, -2 },
+    { 49, 1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 57, -2 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 70, -2 },
+    { 72, -2 },
+    { 75, -6 },
+    { 76, -5 },
+    { 77, -4 },
+    { 78, 1 },
+    { 84, -1 },
+    { 88, -4 },
+    { 91, -3 },
+    { 10, -1 },
+    { 14, -2 },
+    { 16, -1 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -5 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -6 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -6 },
+    { 36, -3 },
+    { 37, -4 },
+    { 38, -4 },
+    { 39, -4 },
+    { 40, -4 },
+    { 41, -4 },
+    { 42, -4 },
+    { 43, -3 },
+    { 44, -4 },
+    { 45, -3 },
+    { 48, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 57, -2 },
+    { 58, 1 },
+    { 62, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 71, -2 },
+    { 75, -3 },
+    { 76, -5 },
+    { 77, -3 },
+    { 78, 1 },
+    { 84, -1 },
+    { 88, -6 },
+    { 90, -1 },
+    { 2, 1 },
+    { 4, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -4 },
+    { 16, -2 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -2 },
+    { 22, -8 },
+    { 23, -3 },
+    { 24, -6 },
+    { 25, -3 },
+    { 26, -4 },
+    { 27, -4 },
+    { 28, -5 },
+    { 29, -2 },
+    { 30, -7 },
+    { 31, -4 },
+    { 32, -4 },
+    { 33, -4 },
+    { 34, -4 },
+    { 35, -5 },
+    { 36, -4 },
+    { 37, -4 },
+    { 38, -6 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -4 },
+    { 44, -3 },
+    { 45, -4 },
+    { 47, -2 },
+    { 48, -3 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 57, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 75, -8 },
+    { 76, -6 },
+    { 77, -5 },
+    { 79, -1 },
+    { 84, -3 },
+    { 88, -5 },
+    { 91, -4 },
+    { 14, -4 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 51, -1 },
+    { 54, -1 },
+    { 57, -2 },
+    { 58, 1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 75, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 78, 1 },
+    { 88, -4 },
+    { 14, -4 },
+    { 22, -3 },
+    { 24, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 45, -1 },
+    { 48, -3 },
+    { 50, -3 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 60, -3 },
+    { 61, -3 },
+    { 62, -2 },
+    { 64, -3 },
+    { 65, -3 },
+    { 66, -1 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 72, -3 },
+    { 84, -3 },
+    { 14, -1 },
+    { 5, -1 },
+    { 11, -1 },
+    { 38, -1 },
+    { 39, -2 },
+    { 44, -2 },
+    { 57, -1 },
+    { 70, -2 },
+    { 2, 1 },
+    { 17, -2 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 38, 1 },
+    { 39, -6 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, 1 },
+    { 44, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 89, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 17, -3 },
+    { 22, -3 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, -6 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -2 },
+    { 78, 1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -4 },
+    { 14, -4 },
+    { 16, -1 },
+    { 17, -2 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 30, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -6 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -1 },
+    { 44, -2 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -3 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 84, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 2, 2 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 34, -2 },
+    { 39, -2 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 80, 1 },
+    { 82, 1 },
+    { 83, 1 },
+    { 86, 2 },
+    { 2, 1 },
+    { 5, -1 },
+    { 17, -3 },
+    { 22, -2 },
+    { 24, 1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 39, -6 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -2 },
+    { 89, -1 },
+    { 2, 2 },
+    { 7, -2 },
+    { 9, -1 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -2 },
+    { 22, -4 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -3 },
+    { 34, -2 },
+    { 39, -2 },
+    { 45, -2 },
+    { 48, -2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 80, 1 },
+    { 83, 1 },
+    { 84, -2 },
+    { 91, -2 },
+    { 2, 2 },
+    { 5, -1 },
+    { 17, -3 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 34, -2 },
+    { 39, -6 },
+    { 44, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 83, 1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 17, -2 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 38, 1 },
+    { 39, -6 },
+    { 41, -2 },
+    { 42, -1 },
+    { 44, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -3 },
+    { 72, -1 },
+    { 89, -1 },
+    { 2, 1 },
+    { 14, -1 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 39, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 83, 1 },
+    { 86, 1 },
+    { 2, 2 },
+    { 80, 1 },
+    { 82, 1 },
+    { 83, 1 },
+    { 85, 1 },
+    { 86, 2 },
+    { 5, -1 },
+    { 6, -2 },
+    { 8, -2 },
+    { 10, -2 },
+    { 14, -4 },
+    { 16, -2 },
+    { 17, -2 },
+    { 18, -1 },
+    { 22, -2 },
+    { 24, -2 },
+    { 27, -2 },
+    { 28, -4 },
+    { 30, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 35, -2 },
+    { 37, -2 },
+    { 39, -6 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -2 },
+    { 44, -3 },
+    { 47, -3 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -3 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -4 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -4 },
+    { 72, -1 },
+    { 73, -1 },
+    { 84, -1 },
+    { 89, -3 },
+    { 90, -2 },
+    { 14, -2 },
+    { 17, -1 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -3 },
+    { 30, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 35, -1 },
+    { 39, -3 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -1 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -2 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -1 },
+    { 71, -3 },
+    { 72, -1 },
+    { 73, -1 },
+    { 89, -1 },
+    { 90, -2 },
+    { 2, 1 },
+    { 5, -1 },
+    { 17, -2 },
+    { 30, -2 },
+    { 33, 1 },
+    { 38, 1 },
+    { 39, -3 },
+    { 41, -2 },
+    { 42, -1 },
+    { 44, -2 },
+    { 57, -2 },
+    { 66, -1 },
+    { 68, -1 },
+    { 71, -1 },
+    { 89, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 17, -3 },
+    { 22, -3 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 34, -2 },
+    { 39, -6 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -2 },
+    { 89, -1 },
+    { 91, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 17, -4 },
+    { 22, -3 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 34, -2 },
+    { 39, -6 },
+    { 41, -1 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -2 },
+    { 72, -2 },
+    { 89, -1 },
+    { 91, -1 },
+    { 1, -2 },
+    { 9, -2 },
+    { 10, -1 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -5 },
+    { 18, -1 },
+    { 19, -1 },
+    { 21, -2 },
+    { 22, -4 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -2 },
+    { 27, -4 },
+    { 28, -4 },
+    { 29, -1 },
+    { 31, -2 },
+    { 32, -2 },
+    { 33, -1 },
+    { 34, -4 },
+    { 35, -1 },
+    { 36, -2 },
+    { 37, -1 },
+    { 38, -2 },
+    { 39, -8 },
+    { 40, -1 },
+    { 41, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 48, -3 },
+    { 49, -3 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -3 },
+    { 54, -2 },
+    { 55, -3 },
+    { 56, -3 },
+    { 58, -3 },
+    { 59, -3 },
+    { 60, -2 },
+    { 61, -4 },
+    { 62, -3 },
+    { 63, -2 },
+    { 64, -4 },
+    { 65, -4 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -3 },
+    { 69, -3 },
+    { 70, -4 },
+    { 71, -2 },
+    { 72, -4 },
+    { 73, -1 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, -1 },
+    { 89, -2 },
+    { 90, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -3 },
+    { 8, -1 },
+    { 9, -2 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 17, -4 },
+    { 22, -4 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -3 },
+    { 34, -2 },
+    { 39, -6 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -2 },
+    { 48, -2 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 83, 1 },
+    { 84, -2 },
+    { 91, -3 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 17, -3 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 34, -2 },
+    { 39, -6 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 47, -2 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 14, -3 },
+    { 17, -2 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -3 },
+    { 34, -2 },
+    { 39, -4 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 47, -1 },
+    { 48, -2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 89, -1 },
+    { 2, 1 },
+    { 5, -1 },
+    { 17, -2 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 33, 1 },
+    { 34, -2 },
+    { 38, 1 },
+    { 39, -6 },
+    { 41, -1 },
+    { 44, -1 },
+    { 48, -1 },
+    { 49, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 83, 1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -3 },
+    { 9, -2 },
+    { 11, -2 },
+    { 12, -3 },
+    { 13, -2 },
+    { 14, -2 },
+    { 17, -5 },
+    { 22, -5 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -3 },
+    { 34, -2 },
+    { 39, -6 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -2 },
+    { 48, -2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -1 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 73, -1 },
+    { 83, 1 },
+    { 84, -1 },
+    { 91, -3 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -2 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -1 },
+    { 17, -5 },
+    { 22, -4 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -3 },
+    { 34, -2 },
+    { 39, -6 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 48, -2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -1 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 83, 1 },
+    { 91, -2 },
+    { 2, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -2 },
+    { 10, -1 },
+    { 14, -3 },
+    { 16, -1 },
+    { 17, -3 },
+    { 18, -1 },
+    { 21, -1 },
+    { 22, -2 },
+    { 24, -1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -3 },
+    { 34, -2 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -6 },
+    { 41, -2 },
+    { 42, -1 },
+    { 44, -2 },
+    { 47, -2 },
+    { 48, -2 },
+    { 49, -2 },
+    { 50, -3 },
+    { 51, -3 },
+    { 52, -3 },
+    { 53, -2 },
+    { 54, -3 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -3 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 84, -2 },
+    { 89, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 2, 2 },
+    { 5, -1 },
+    { 7, -2 },
+    { 9, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -1 },
+    { 17, -5 },
+    { 22, -4 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 34, -2 },
+    { 39, -6 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -1 },
+    { 48, -2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, -1 },
+    { 61, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 83, 1 },
+    { 84, -1 },
+    { 91, -2 },
+    { 5, -1 },
+    { 14, -2 },
+    { 17, -3 },
+    { 22, -2 },
+    { 27, -2 },
+    { 28, -2 },
+    { 30, -2 },
+    { 34, -2 },
+    { 39, -6 },
+    { 44, -1 },
+    { 48, -2 },
+    { 49, -1 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -1 },
+    { 65, -2 },
+    { 66, -1 },
+    { 67, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 83, 1 },
+    { 84, -1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 14, -4 },
+    { 16, -2 },
+    { 18, -1 },
+    { 19, -1 },
+    { 22, -2 },
+    { 24, -2 },
+    { 28, -2 },
+    { 35, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 45, -2 },
+    { 48, -2 },
+    { 50, -2 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, -1 },
+    { 54, -1 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -1 },
+    { 72, -2 },
+    { 79, -1 },
+    { 84, -2 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 17, -2 },
+    { 57, -2 },
+    { 63, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -4 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -4 },
+    { 29, -2 },
+    { 30, -6 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -3 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 75, -3 },
+    { 76, -4 },
+    { 77, -3 },
+    { 88, -4 },
+    { 22, -3 },
+    { 23, -3 },
+    { 24, -3 },
+    { 25, -3 },
+    { 26, -3 },
+    { 27, -3 },
+    { 28, -3 },
+    { 29, -2 },
+    { 30, -5 },
+    { 31, -3 },
+    { 32, -3 },
+    { 33, -3 },
+    { 34, -3 },
+    { 35, -4 },
+    { 36, -3 },
+    { 37, -2 },
+    { 38, -3 },
+    { 39, -3 },
+    { 40, -3 },
+    { 41, -3 },
+    { 42, -3 },
+    { 43, -3 },
+    { 44, -3 },
+    { 45, -3 },
+    { 75, -3 },
+    { 76, -3 },
+    { 77, -4 },
+    { 88, -4 },
+    { 57, -2 },
+    { 49, 1 },
+    { 57, -2 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 28, 1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 35, 1 },
+    { 37, 2 },
+    { 40, 1 },
+    { 76, 1 },
+    { 77, 1 },
+    { 88, 1 },
+    { 5, -2 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -1 },
+    { 17, -4 },
+    { 22, -2 },
+    { 24, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 30, -2 },
+    { 33, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 39, -4 },
+    { 41, -1 },
+    { 43, -3 },
+    { 44, -2 },
+    { 45, -2 },
+    { 46, -2 },
+    { 57, -2 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -2 },
+    { 74, -2 },
+    { 89, -1 },
+    { 91, -5 },
+    { 5, -1 },
+    { 17, -1 },
+    { 30, -2 },
+    { 39, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 44, -2 },
+    { 57, -2 },
+    { 70, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 57, -2 },
+    { 82, 1 },
+    { 83, 1 },
+    { 86, 1 },
+    { 49, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 79, 1 },
+    { 82, 3 },
+    { 83, 2 },
+    { 85, 2 },
+    { 86, 2 },
+    { 49, 1 },
+    { 53, 1 },
+    { 56, 1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 69, 1 },
+    { 71, 1 },
+    { 79, 1 },
+    { 82, 3 },
+    { 83, 2 },
+    { 85, 2 },
+    { 86, 3 },
+    { 11, -2 },
+    { 12, -2 },
+    { 13, -2 },
+    { 14, -2 },
+    { 17, -2 },
+    { 22, -2 },
+    { 24, 1 },
+    { 25, 1 },
+    { 28, 1 },
+    { 30, -3 },
+    { 33, 1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 39, -2 },
+    { 43, -2 },
+    { 44, -1 },
+    { 45, -3 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 57, -2 },
+    { 70, -1 },
+    { 72, -1 },
+    { 73, -1 },
+    { 83, 1 },
+    { 84, -2 },
+    { 91, -4 },
+    { 70, -2 },
+    { 72, -1 },
+    { 54, 1 },
+    { 63, 1 },
+    { 49, 1 },
+    { 80, 1 },
+    { 82, 2 },
+    { 83, 2 },
+    { 85, 1 },
+    { 86, 2 },
+    { 49, 2 },
+    { 55, 1 },
+    { 56, 1 },
+    { 58, 1 },
+    { 59, 1 },
+    { 79, 1 },
+    { 80, 2 },
+    { 81, 1 },
+    { 82, 2 },
+    { 83, 1 },
+    { 85, 2 },
+    { 86, 4 },
+    { 87, 1 },
+    { 54, -2 },
+    { 57, -2 },
+    { 63, -2 },
+    { 71, -2 },
+    { 29, 1 },
+    { 30, -1 },
+    { 11, -1 },
+    { 14, -2 },
+    { 22, -2 },
+    { 30, -3 },
+    { 43, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 57, -2 },
+    { 70, -1 },
+    { 72, -1 },
+    { 84, -2 },
+    { 14, -3 },
+    { 22, -3 },
+    { 30, -3 },
+    { 48, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 54, -1 },
+    { 57, -2 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 70, -1 },
+    { 72, -1 },
+    { 84, -2 },
+    { 14, -5 },
+    { 17, -3 },
+    { 28, -1 },
+    { 39, -3 },
+    { 41, -2 },
+    { 42, -2 },
+    { 44, -3 },
+    { 66, -1 },
+    { 68, -2 },
+    { 69, -1 },
+    { 71, -2 },
+};
+
 static const EpdFontData opendyslexic_8_italic = {
     opendyslexic_8_italicBitmaps,
     opendyslexic_8_italicGlyphs,
@@ -2642,4 +5457,8 @@ static const EpdFontData opendyslexic_8_italic = {
     22,
     -9,
     true,
+    opendyslexic_8_italicKernLeftClasses,
+    opendyslexic_8_italicKernRightClasses,
+    opendyslexic_8_italicKernPairOffsets,
+    opendyslexic_8_italicKernPairs,
 };
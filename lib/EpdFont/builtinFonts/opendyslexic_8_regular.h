@@ -2328,4 +2328,8 @@ static const EpdFontData opendyslexic_8_regular = {
     22,
     -9,
     true,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
 };
@@ -872,7 +872,7 @@ static const EpdGlyph ubuntu_10_boldGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 4, 15, 6, 1, 15, 8, 0 }, // !
@@ -1483,6 +1483,1360 @@ static const EpdUnicodeInterval ubuntu_10_boldIntervals[] = {
     { 0x2264, 0x2265, 0x23C },
 };
 
+static const uint8_t ubuntu_10_boldKernLeftClasses[574] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 4, 5,
+    0, 6, 7, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    9, 0, 0, 0, 0, 10, 11, 12, 13, 14, 15, 16, 17, 0, 0, 18,
+    19, 20, 0, 0, 14, 21, 14, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 0, 0, 0, 34, 35, 36, 34, 0, 37, 38, 39, 39, 40,
+    41, 42, 39, 39, 35, 35, 38, 43, 44, 45, 46, 47, 47, 48, 47, 49,
+    50, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52,
+    0, 0, 0, 53, 11, 11, 11, 11, 11, 11, 15, 13, 15, 15, 15, 15,
+    0, 0, 0, 0, 14, 0, 14, 14, 14, 14, 14, 0, 14, 25, 25, 25,
+    25, 29, 54, 55, 34, 34, 34, 34, 34, 34, 0, 36, 0, 0, 0, 0,
+    39, 39, 39, 39, 56, 39, 35, 35, 35, 35, 35, 0, 35, 46, 46, 46,
+    46, 47, 57, 47, 11, 34, 11, 34, 11, 34, 13, 36, 13, 36, 13, 36,
+    13, 36, 14, 58, 14, 34, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0,
+    17, 38, 17, 38, 17, 38, 17, 38, 0, 39, 0, 39, 0, 39, 0, 39,
+    0, 39, 0, 39, 0, 39, 18, 40, 18, 40, 19, 41, 41, 20, 42, 20,
+    42, 20, 58, 20, 42, 20, 42, 0, 39, 0, 39, 0, 39, 39, 0, 59,
+    14, 35, 14, 35, 14, 35, 15, 0, 22, 43, 22, 43, 22, 43, 23, 44,
+    23, 44, 23, 44, 23, 44, 24, 45, 24, 45, 24, 45, 25, 46, 25, 46,
+    25, 46, 25, 46, 25, 46, 25, 46, 27, 47, 29, 47, 29, 30, 49, 30,
+    49, 30, 49, 37, 0, 60, 60, 61, 62, 63, 64, 0, 0, 65, 66, 66,
+    67, 68, 0, 69, 0, 70, 61, 65, 62, 71, 60, 72, 65, 0, 0, 68,
+    0, 0, 0, 73, 0, 74, 63, 75, 69, 76, 77, 71, 0, 0, 71, 66,
+    0, 66, 78, 73, 0, 79, 0, 45, 80, 81, 82, 83, 0, 0, 0, 83,
+    0, 45, 0, 84, 0, 85, 86, 87, 88, 89, 90, 81, 0, 0, 81, 91,
+    0, 91, 84, 84, 45, 82, 82, 92, 80, 45, 93, 0, 0, 94, 91, 91,
+    95, 83, 0, 88, 0, 61, 96, 73, 84, 97, 98, 71, 81, 66, 91, 0,
+    85, 62, 80, 62, 80, 61, 94, 72, 83, 65, 0, 68, 83, 68, 83, 68,
+    83, 68, 83, 71, 81, 75, 80, 66, 99, 100, 101, 63, 86, 75, 87, 102,
+    103, 102, 103, 77, 90, 71, 81, 71, 81, 0, 0, 104, 105, 106, 0, 106,
+    0, 0, 72, 83, 107, 94, 0, 81, 65, 94, 71, 81, 0, 0, 71, 81,
+    0, 70, 79, 70, 79, 60, 45, 60, 82, 108, 0, 108, 0, 72, 83, 65,
+    0, 109, 94, 0, 0, 0, 0, 73, 84, 73, 84, 73, 84, 78, 0, 69,
+    88, 69, 88, 69, 88, 0, 0, 62, 80, 0, 0, 7, 7, 0, 110, 111,
+    112, 110, 111, 112, 0, 0, 0, 6, 0, 9, 52, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t ubuntu_10_boldKernRightClasses[574] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 4, 5,
+    0, 6, 7, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    9, 0, 0, 0, 10, 11, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15,
+    13, 13, 16, 13, 14, 13, 14, 13, 17, 18, 19, 20, 21, 22, 23, 17,
+    0, 24, 25, 0, 0, 0, 26, 17, 27, 27, 27, 17, 27, 28, 17, 29,
+    28, 28, 30, 30, 27, 30, 27, 30, 31, 17, 32, 33, 34, 35, 36, 37,
+    38, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 41, 14, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 0, 14, 19, 19, 19,
+    19, 23, 0, 17, 26, 26, 26, 26, 42, 26, 26, 27, 27, 27, 27, 27,
+    43, 17, 44, 45, 46, 30, 27, 27, 27, 27, 27, 0, 27, 32, 32, 32,
+    32, 36, 0, 36, 12, 26, 12, 26, 12, 26, 14, 27, 14, 27, 14, 27,
+    14, 27, 13, 27, 0, 27, 13, 27, 13, 27, 13, 27, 13, 27, 13, 27,
+    14, 27, 14, 27, 14, 27, 14, 27, 13, 28, 13, 28, 13, 47, 13, 48,
+    13, 49, 13, 17, 13, 17, 13, 17, 15, 29, 13, 28, 0, 13, 28, 13,
+    28, 13, 28, 13, 28, 13, 28, 13, 30, 13, 30, 13, 30, 30, 17, 50,
+    14, 27, 14, 27, 14, 27, 14, 27, 13, 30, 13, 30, 13, 30, 17, 31,
+    17, 31, 17, 31, 17, 31, 18, 17, 18, 17, 18, 17, 19, 32, 19, 32,
+    19, 32, 19, 32, 19, 32, 19, 32, 21, 34, 23, 36, 23, 17, 37, 17,
+    37, 17, 37, 17, 0, 0, 0, 51, 0, 52, 0, 0, 0, 53, 54, 0,
+    51, 0, 0, 55, 0, 56, 0, 0, 0, 57, 0, 58, 59, 0, 0, 0,
+    54, 0, 0, 60, 0, 0, 52, 51, 55, 61, 62, 0, 63, 0, 0, 0,
+    0, 0, 64, 0, 65, 66, 67, 68, 69, 70, 71, 72, 73, 69, 69, 69,
+    74, 75, 69, 76, 69, 69, 71, 77, 78, 79, 80, 69, 81, 69, 69, 82,
+    69, 69, 83, 69, 84, 71, 71, 85, 69, 86, 87, 0, 88, 89, 74, 69,
+    85, 69, 69, 78, 69, 51, 90, 60, 76, 0, 78, 0, 69, 0, 91, 0,
+    69, 0, 69, 0, 69, 0, 69, 58, 72, 59, 73, 0, 69, 0, 69, 0,
+    69, 0, 69, 0, 69, 0, 69, 0, 69, 92, 93, 52, 71, 51, 77, 94,
+    95, 94, 95, 62, 80, 51, 77, 63, 81, 63, 81, 0, 0, 96, 97, 96,
+    97, 0, 58, 72, 0, 69, 54, 74, 0, 69, 0, 69, 63, 81, 0, 75,
+    0, 56, 66, 56, 66, 98, 99, 0, 71, 0, 100, 0, 100, 58, 72, 59,
+    73, 101, 102, 0, 69, 0, 69, 60, 76, 60, 76, 60, 76, 64, 73, 55,
+    78, 55, 78, 55, 78, 63, 81, 0, 69, 0, 69, 7, 7, 0, 103, 104,
+    105, 103, 104, 105, 0, 0, 0, 6, 0, 40, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t ubuntu_10_boldKernPairOffsets[113] = {
+    0, 15, 23, 48, 51, 64, 100, 115, 150, 153, 163, 184, 188, 196, 203, 204,
+    216, 217, 219, 239, 260, 268, 276, 278, 316, 319, 351, 373, 395, 431, 441, 493,
+    507, 509, 513, 522, 528, 546, 551, 556, 561, 566, 571, 579, 582, 583, 587, 592,
+    596, 599, 608, 611, 628, 657, 666, 675, 677, 680, 701, 702, 703, 705, 744, 752,
+    757, 758, 769, 777, 799, 831, 851, 859, 882, 890, 901, 930, 949, 968, 974, 977,
+    986, 989, 991, 996, 1005, 1010, 1013, 1018, 1021, 1028, 1032, 1040, 1044, 1046, 1047, 1052,
+    1064, 1096, 1108, 1117, 1123, 1129, 1164, 1168, 1177, 1181, 1183, 1189, 1194, 1195, 1219, 1253,
+    1262,
+};
+
+static const EpdKernPair ubuntu_10_boldKernPairs[] = {
+    { 12, -1 },
+    { 15, -2 },
+    { 41, -2 },
+    { 53, -2 },
+    { 54, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 86, -1 },
+    { 93, -1 },
+    { 98, -2 },
+    { 12, 1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 23, -2 },
+    { 33, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 3, -1 },
+    { 4, 2 },
+    { 11, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, 2 },
+    { 32, -1 },
+    { 36, 1 },
+    { 42, -1 },
+    { 46, -1 },
+    { 51, 1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 66, -1 },
+    { 76, -1 },
+    { 78, 1 },
+    { 79, -1 },
+    { 89, 2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 20, -1 },
+    { 23, -1 },
+    { 94, -1 },
+    { 12, -2 },
+    { 15, -2 },
+    { 27, -1 },
+    { 41, -3 },
+    { 46, -1 },
+    { 53, -2 },
+    { 54, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 70, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 98, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, 1 },
+    { 23, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 41, 1 },
+    { 42, -1 },
+    { 51, -2 },
+    { 53, 1 },
+    { 56, 1 },
+    { 57, 1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 63, -2 },
+    { 70, 1 },
+    { 74, 1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 81, -1 },
+    { 94, -1 },
+    { 95, -1 },
+    { 96, -2 },
+    { 97, -1 },
+    { 98, 1 },
+    { 102, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 41, -1 },
+    { 51, -1 },
+    { 58, -1 },
+    { 62, -1 },
+    { 67, 1 },
+    { 71, 1 },
+    { 79, 1 },
+    { 86, 1 },
+    { 93, 1 },
+    { 94, -1 },
+    { 97, 1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 41, -2 },
+    { 42, -1 },
+    { 46, -1 },
+    { 51, 1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 62, 1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 98, -1 },
+    { 18, -1 },
+    { 23, -1 },
+    { 51, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 41, -1 },
+    { 51, -1 },
+    { 58, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 94, -1 },
+    { 1, -1 },
+    { 5, -2 },
+    { 6, 1 },
+    { 10, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, 1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, 1 },
+    { 36, -1 },
+    { 103, -2 },
+    { 104, -1 },
+    { 105, 1 },
+    { 8, -1 },
+    { 20, -1 },
+    { 23, -1 },
+    { 41, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 22, 1 },
+    { 25, 1 },
+    { 41, 1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 41, -1 },
+    { 105, 1 },
+    { 6, -1 },
+    { 8, -2 },
+    { 12, -1 },
+    { 15, -2 },
+    { 20, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 41, -2 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 5, -1 },
+    { 8, -1 },
+    { 41, -1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 22, 1 },
+    { 25, 1 },
+    { 27, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, 1 },
+    { 36, -1 },
+    { 40, -1 },
+    { 41, 1 },
+    { 45, 1 },
+    { 46, -1 },
+    { 47, 1 },
+    { 48, 1 },
+    { 105, 1 },
+    { 1, -2 },
+    { 5, -2 },
+    { 6, 1 },
+    { 10, -1 },
+    { 12, 1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, 1 },
+    { 23, -2 },
+    { 24, -2 },
+    { 25, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, 1 },
+    { 36, -1 },
+    { 41, 1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 105, 1 },
+    { 6, -2 },
+    { 8, -2 },
+    { 12, -1 },
+    { 15, -2 },
+    { 41, -3 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, -2 },
+    { 12, 1 },
+    { 15, 1 },
+    { 23, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 42, -1 },
+    { 46, -1 },
+    { 105, 1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 15, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, -2 },
+    { 27, -2 },
+    { 30, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -1 },
+    { 40, -2 },
+    { 41, -2 },
+    { 42, -2 },
+    { 44, 1 },
+    { 45, 1 },
+    { 46, -2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, -1 },
+    { 103, 1 },
+    { 105, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 41, -1 },
+    { 2, -1 },
+    { 3, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 10, 1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 31, -1 },
+    { 40, -1 },
+    { 41, -3 },
+    { 42, -1 },
+    { 45, 1 },
+    { 46, -1 },
+    { 47, 1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 46, -1 },
+    { 47, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 40, -1 },
+    { 41, 1 },
+    { 42, -1 },
+    { 45, 1 },
+    { 47, 1 },
+    { 105, 1 },
+    { 2, -1 },
+    { 3, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, -2 },
+    { 27, -2 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 40, -2 },
+    { 41, -3 },
+    { 42, -3 },
+    { 45, 1 },
+    { 46, -2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 50, -1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 6, 1 },
+    { 12, 1 },
+    { 15, 1 },
+    { 22, 1 },
+    { 40, -1 },
+    { 41, 1 },
+    { 45, 1 },
+    { 47, 1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, 2 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, 1 },
+    { 37, -1 },
+    { 41, -1 },
+    { 42, -1 },
+    { 46, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 71, -1 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, 1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 89, 2 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -1 },
+    { 23, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, 3 },
+    { 33, -1 },
+    { 36, 1 },
+    { 42, -1 },
+    { 29, 1 },
+    { 89, 1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 42, -1 },
+    { 46, -1 },
+    { 104, 1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 24, 2 },
+    { 25, 1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 39, 1 },
+    { 43, 1 },
+    { 45, 1 },
+    { 47, 1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 5, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 29, 1 },
+    { 103, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 103, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 29, 1 },
+    { 103, -1 },
+    { 7, -1 },
+    { 25, -1 },
+    { 27, -1 },
+    { 40, -1 },
+    { 46, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 105, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 36, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 25, -1 },
+    { 5, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 103, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 25, -1 },
+    { 104, 1 },
+    { 105, -1 },
+    { 25, -1 },
+    { 35, 1 },
+    { 40, -1 },
+    { 104, 1 },
+    { 25, -1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 39, 2 },
+    { 61, -1 },
+    { 78, 1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 89, 1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 23, -1 },
+    { 15, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -2 },
+    { 35, -1 },
+    { 41, -1 },
+    { 51, -2 },
+    { 53, -1 },
+    { 55, -1 },
+    { 58, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 72, -1 },
+    { 80, -1 },
+    { 94, -1 },
+    { 101, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 22, -1 },
+    { 23, -2 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, 1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 41, -2 },
+    { 42, -1 },
+    { 43, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 25, -1 },
+    { 41, -1 },
+    { 1, -1 },
+    { 5, -2 },
+    { 10, -1 },
+    { 24, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 1, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 1, 1 },
+    { 4, 1 },
+    { 6, -1 },
+    { 10, 1 },
+    { 24, 2 },
+    { 25, 1 },
+    { 27, -1 },
+    { 28, 1 },
+    { 31, -1 },
+    { 33, 1 },
+    { 34, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 39, 1 },
+    { 43, 1 },
+    { 44, 2 },
+    { 45, 3 },
+    { 47, 2 },
+    { 48, 2 },
+    { 49, 2 },
+    { 104, 1 },
+    { 1, -1 },
+    { 98, 1 },
+    { 5, -1 },
+    { 102, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 25, 1 },
+    { 38, -1 },
+    { 40, -2 },
+    { 51, 1 },
+    { 53, -2 },
+    { 54, -2 },
+    { 56, -2 },
+    { 57, -2 },
+    { 62, 1 },
+    { 66, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 81, -1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 88, 1 },
+    { 93, -1 },
+    { 97, -2 },
+    { 98, -2 },
+    { 99, -2 },
+    { 100, -1 },
+    { 102, -1 },
+    { 103, 1 },
+    { 25, 1 },
+    { 53, 1 },
+    { 56, 1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 98, 1 },
+    { 104, 1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 77, -1 },
+    { 82, -1 },
+    { 102, -1 },
+    { 8, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 39, -1 },
+    { 51, -1 },
+    { 65, -1 },
+    { 94, -2 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 25, -1 },
+    { 51, -1 },
+    { 94, -1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 25, 1 },
+    { 40, -1 },
+    { 52, -1 },
+    { 56, 1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, 1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 98, 1 },
+    { 102, -1 },
+    { 3, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 10, 1 },
+    { 11, -1 },
+    { 25, 1 },
+    { 40, -1 },
+    { 51, 1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 60, -1 },
+    { 62, 1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, 1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 98, -2 },
+    { 103, 1 },
+    { 104, 1 },
+    { 1, -1 },
+    { 5, -2 },
+    { 6, 1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 51, -2 },
+    { 53, 1 },
+    { 56, 1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 63, -1 },
+    { 77, -1 },
+    { 80, 1 },
+    { 94, -1 },
+    { 96, -1 },
+    { 98, 1 },
+    { 102, -1 },
+    { 103, -2 },
+    { 104, -1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, 1 },
+    { 51, -1 },
+    { 61, -1 },
+    { 63, -1 },
+    { 89, 1 },
+    { 98, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 25, 1 },
+    { 40, -1 },
+    { 52, -1 },
+    { 56, 1 },
+    { 58, 1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 72, 1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 80, 1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 92, -1 },
+    { 94, 1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 98, 1 },
+    { 102, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 94, -1 },
+    { 6, -2 },
+    { 8, -2 },
+    { 53, -2 },
+    { 54, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 70, -1 },
+    { 74, -1 },
+    { 98, -1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 25, 1 },
+    { 40, -2 },
+    { 51, 1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 62, 1 },
+    { 66, -2 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 76, -2 },
+    { 79, -1 },
+    { 80, -2 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 88, 1 },
+    { 93, -1 },
+    { 98, -1 },
+    { 103, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 39, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 64, -1 },
+    { 74, -1 },
+    { 94, -1 },
+    { 98, -1 },
+    { 101, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 25, 1 },
+    { 40, -1 },
+    { 51, 1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 56, 1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, 1 },
+    { 76, -1 },
+    { 81, -1 },
+    { 92, -1 },
+    { 97, -1 },
+    { 98, 1 },
+    { 102, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 62, -1 },
+    { 94, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 70, -1 },
+    { 74, -1 },
+    { 78, 1 },
+    { 90, 1 },
+    { 91, 1 },
+    { 95, 1 },
+    { 97, 1 },
+    { 6, 1 },
+    { 8, 1 },
+    { 89, 1 },
+    { 5, -1 },
+    { 25, -1 },
+    { 7, -1 },
+    { 25, -1 },
+    { 40, -1 },
+    { 72, 1 },
+    { 76, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 7, 1 },
+    { 25, -1 },
+    { 39, -1 },
+    { 25, -1 },
+    { 76, -1 },
+    { 104, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 25, -1 },
+    { 70, -1 },
+    { 74, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 70, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 39, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 25, -1 },
+    { 40, -1 },
+    { 80, 1 },
+    { 104, 1 },
+    { 1, -2 },
+    { 5, -1 },
+    { 25, -1 },
+    { 77, -1 },
+    { 82, -1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 1, -1 },
+    { 89, 1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 89, 1 },
+    { 1, -1 },
+    { 25, -1 },
+    { 39, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 39, -1 },
+    { 77, -1 },
+    { 90, -1 },
+    { 95, -1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 25, 1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 51, 1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 62, 1 },
+    { 63, 1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 84, -1 },
+    { 85, 1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 98, -2 },
+    { 103, 1 },
+    { 104, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 72, 1 },
+    { 77, 1 },
+    { 78, 1 },
+    { 80, 1 },
+    { 82, 1 },
+    { 90, 1 },
+    { 91, 1 },
+    { 95, 1 },
+    { 97, 1 },
+    { 104, 1 },
+    { 1, -2 },
+    { 5, -2 },
+    { 77, -1 },
+    { 82, -1 },
+    { 89, 1 },
+    { 90, -1 },
+    { 95, -1 },
+    { 103, -2 },
+    { 104, -2 },
+    { 1, -1 },
+    { 7, 1 },
+    { 51, -1 },
+    { 89, 1 },
+    { 94, -1 },
+    { 103, -1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 89, 1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 3, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 8, -2 },
+    { 11, -1 },
+    { 25, 1 },
+    { 39, 1 },
+    { 40, -1 },
+    { 52, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, 1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 92, -1 },
+    { 93, -1 },
+    { 94, 1 },
+    { 98, -1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 90, 1 },
+    { 95, 1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 39, -1 },
+    { 51, -1 },
+    { 94, -1 },
+    { 103, -1 },
+    { 104, -1 },
+    { 1, -1 },
+    { 25, -1 },
+    { 39, -1 },
+    { 103, -1 },
+    { 25, -1 },
+    { 94, -1 },
+    { 5, -1 },
+    { 77, -1 },
+    { 82, -1 },
+    { 90, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 8, -1 },
+    { 25, -1 },
+    { 58, -1 },
+    { 62, -1 },
+    { 94, -1 },
+    { 102, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -2 },
+    { 20, 1 },
+    { 21, 1 },
+    { 23, 1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 41, -4 },
+    { 42, -1 },
+    { 46, -1 },
+    { 53, -2 },
+    { 54, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 60, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 76, -1 },
+    { 79, -1 },
+    { 93, -1 },
+    { 98, -2 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -2 },
+    { 20, 1 },
+    { 21, 1 },
+    { 26, -1 },
+    { 27, -2 },
+    { 30, -1 },
+    { 31, -2 },
+    { 32, -1 },
+    { 37, -1 },
+    { 41, -3 },
+    { 42, -1 },
+    { 46, -2 },
+    { 53, -2 },
+    { 54, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 79, -1 },
+    { 84, -1 },
+    { 86, -1 },
+    { 87, -2 },
+    { 93, -1 },
+    { 98, -2 },
+    { 99, -1 },
+    { 100, -1 },
+    { 14, -1 },
+    { 18, -2 },
+    { 20, -3 },
+    { 21, -2 },
+    { 23, -2 },
+    { 29, 1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 36, -1 },
+};
+
 static const EpdFontData ubuntu_10_bold = {
     ubuntu_10_boldBitmaps,
     ubuntu_10_boldGlyphs,
@@ -1492,4 +2846,8 @@ static const EpdFontData ubuntu_10_bold = {
     20,
     -4,
     false,
+    ubuntu_10_boldKernLeftClasses,
+    ubuntu_10_boldKernRightClasses,
+    ubuntu_10_boldKernPairOffsets,
+    ubuntu_10_boldKernPairs,
 };
@@ -787,7 +787,7 @@ static const EpdGlyph ubuntu_10_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, // 	
-    { 0, 0, 5, 0, 0, 0, 0 }, // 
+    { 0, 0, 5, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 5, 0, 0, 0, 0 }, //  
     { 4, 15, 6, 1, 15, 8, 0 }, // !
@@ -1398,6 +1398,1042 @@ static const EpdUnicodeInterval ubuntu_10_regularIntervals[] = {
     { 0x2264, 0x2265, 0x23C },
 };
 
+static const uint8_t ubuntu_10_regularKernLeftClasses[574] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 3, 4,
+    0, 5, 6, 5, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    8, 0, 0, 0, 0, 9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 17,
+    18, 19, 0, 0, 20, 21, 22, 23, 0, 24, 17, 25, 26, 27, 28, 29,
+    30, 0, 0, 0, 0, 0, 31, 32, 33, 0, 0, 34, 0, 35, 0, 0,
+    36, 0, 37, 37, 37, 37, 38, 39, 0, 33, 0, 40, 40, 41, 0, 42,
+    43, 0, 44, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    0, 0, 0, 47, 10, 10, 10, 10, 10, 10, 14, 12, 14, 14, 14, 14,
+    0, 0, 0, 0, 13, 0, 20, 20, 20, 20, 20, 0, 20, 17, 17, 17,
+    17, 28, 48, 49, 31, 31, 31, 31, 31, 31, 0, 33, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 0, 37, 0, 0, 0,
+    0, 0, 32, 0, 10, 31, 10, 31, 10, 31, 12, 33, 12, 33, 12, 33,
+    12, 33, 13, 50, 13, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 0, 35, 0, 35, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 17, 0, 17, 0, 18, 36, 36, 19, 0, 19,
+    0, 19, 50, 19, 0, 19, 0, 0, 37, 0, 37, 0, 37, 37, 0, 51,
+    20, 37, 20, 37, 20, 37, 14, 0, 23, 39, 23, 39, 23, 39, 0, 0,
+    0, 0, 0, 0, 0, 0, 24, 33, 24, 33, 24, 33, 17, 0, 17, 0,
+    17, 0, 17, 0, 17, 0, 17, 0, 26, 40, 28, 0, 28, 29, 42, 29,
+    42, 29, 42, 34, 0, 52, 52, 53, 54, 55, 56, 0, 0, 0, 0, 0,
+    57, 58, 0, 59, 0, 60, 53, 61, 54, 62, 52, 0, 63, 0, 0, 58,
+    0, 64, 0, 65, 0, 66, 55, 67, 59, 68, 69, 62, 0, 0, 62, 0,
+    0, 0, 70, 65, 0, 31, 0, 71, 72, 73, 74, 75, 71, 0, 0, 75,
+    0, 0, 0, 37, 0, 37, 33, 76, 77, 78, 41, 79, 0, 0, 79, 80,
+    0, 80, 37, 37, 0, 74, 74, 81, 72, 41, 82, 0, 0, 0, 80, 80,
+    83, 75, 0, 77, 0, 53, 80, 65, 37, 84, 85, 62, 79, 0, 80, 0,
+    37, 54, 72, 54, 72, 53, 86, 0, 75, 63, 71, 58, 75, 58, 75, 58,
+    75, 58, 75, 62, 79, 67, 72, 0, 87, 88, 89, 55, 33, 67, 76, 90,
+    91, 90, 91, 69, 41, 62, 79, 62, 79, 0, 0, 92, 83, 63, 93, 63,
+    93, 0, 0, 75, 0, 0, 0, 79, 0, 94, 62, 79, 0, 0, 62, 79,
+    0, 60, 31, 60, 31, 0, 93, 52, 74, 95, 37, 95, 37, 0, 75, 63,
+    71, 96, 0, 0, 0, 0, 0, 65, 37, 65, 37, 65, 37, 70, 71, 59,
+    77, 59, 77, 59, 77, 0, 0, 54, 72, 0, 0, 6, 6, 0, 97, 0,
+    98, 97, 0, 98, 0, 0, 0, 5, 0, 8, 46, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t ubuntu_10_regularKernRightClasses[574] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 3, 4,
+    0, 5, 6, 5, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    8, 0, 0, 0, 9, 10, 11, 0, 12, 0, 0, 0, 12, 0, 0, 13,
+    0, 0, 0, 0, 12, 0, 12, 0, 14, 15, 14, 16, 17, 18, 19, 20,
+    0, 21, 22, 0, 0, 0, 23, 0, 24, 24, 25, 0, 26, 0, 0, 27,
+    0, 0, 28, 28, 24, 28, 24, 28, 29, 0, 30, 31, 32, 33, 34, 30,
+    35, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 38, 12, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12, 0, 12, 14, 14, 14,
+    14, 19, 0, 0, 23, 23, 23, 23, 23, 23, 23, 24, 25, 25, 25, 25,
+    39, 0, 21, 40, 41, 28, 24, 24, 24, 24, 24, 0, 24, 30, 30, 30,
+    30, 34, 0, 34, 11, 23, 11, 23, 11, 23, 12, 24, 12, 24, 12, 24,
+    12, 24, 0, 24, 0, 24, 0, 25, 0, 25, 0, 25, 0, 25, 0, 25,
+    12, 26, 12, 26, 12, 26, 12, 26, 0, 0, 0, 0, 0, 40, 0, 42,
+    0, 43, 0, 0, 0, 0, 0, 0, 13, 27, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 28, 0, 28, 28, 0, 44,
+    12, 24, 12, 24, 12, 24, 12, 24, 0, 28, 0, 28, 0, 28, 14, 29,
+    14, 29, 14, 29, 14, 29, 15, 0, 15, 0, 15, 0, 14, 30, 14, 30,
+    14, 30, 14, 30, 14, 30, 14, 30, 17, 32, 19, 34, 19, 20, 30, 20,
+    30, 20, 30, 0, 0, 0, 0, 45, 0, 46, 47, 0, 0, 48, 49, 0,
+    45, 0, 0, 50, 0, 51, 0, 0, 0, 52, 0, 53, 54, 0, 0, 0,
+    49, 0, 0, 46, 0, 0, 46, 45, 50, 55, 56, 0, 57, 0, 0, 45,
+    0, 0, 58, 0, 59, 60, 61, 62, 62, 63, 64, 65, 62, 62, 62, 62,
+    66, 67, 62, 64, 62, 68, 64, 69, 70, 71, 72, 62, 73, 62, 62, 74,
+    62, 62, 75, 62, 76, 64, 64, 77, 62, 76, 62, 0, 78, 79, 66, 62,
+    77, 62, 62, 70, 62, 45, 80, 46, 64, 50, 70, 0, 62, 0, 81, 0,
+    68, 0, 62, 0, 62, 0, 62, 53, 65, 54, 62, 0, 62, 0, 62, 0,
+    62, 0, 62, 0, 62, 0, 62, 0, 62, 82, 76, 46, 64, 45, 69, 83,
+    84, 83, 84, 56, 72, 45, 69, 57, 73, 57, 73, 0, 0, 85, 86, 85,
+    86, 0, 53, 65, 0, 62, 49, 66, 0, 62, 0, 62, 57, 73, 0, 67,
+    0, 51, 60, 51, 60, 0, 67, 0, 64, 87, 62, 87, 62, 53, 65, 54,
+    88, 89, 90, 0, 62, 0, 62, 46, 64, 46, 64, 46, 64, 58, 62, 50,
+    70, 50, 70, 50, 70, 57, 73, 0, 62, 0, 62, 6, 6, 0, 91, 92,
+    93, 91, 92, 93, 0, 0, 0, 5, 0, 37, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t ubuntu_10_regularKernPairOffsets[99] = {
+    0, 12, 18, 26, 36, 52, 62, 78, 82, 99, 114, 117, 120, 132, 137, 149,
+    150, 153, 165, 182, 193, 201, 207, 210, 236, 258, 268, 279, 306, 311, 338, 341,
+    347, 350, 361, 366, 373, 378, 379, 384, 389, 391, 394, 400, 407, 410, 429, 440,
+    456, 464, 473, 476, 481, 489, 527, 536, 538, 549, 573, 594, 615, 618, 629, 632,
+    633, 649, 660, 696, 714, 729, 743, 745, 752, 755, 759, 764, 771, 777, 784, 788,
+    794, 797, 799, 804, 834, 847, 848, 853, 862, 867, 894, 901, 907, 912, 914, 923,
+    929, 933, 945,
+};
+
+static const EpdKernPair ubuntu_10_regularKernPairs[] = {
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -3 },
+    { 38, -3 },
+    { 46, -1 },
+    { 48, -2 },
+    { 49, -2 },
+    { 51, -2 },
+    { 52, -1 },
+    { 55, -1 },
+    { 82, -1 },
+    { 87, -1 },
+    { 3, 2 },
+    { 12, -1 },
+    { 46, -1 },
+    { 52, 1 },
+    { 55, -1 },
+    { 82, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 45, -1 },
+    { 50, -1 },
+    { 56, -1 },
+    { 83, -1 },
+    { 11, -1 },
+    { 13, -3 },
+    { 18, -1 },
+    { 38, -2 },
+    { 48, -2 },
+    { 49, -2 },
+    { 51, -1 },
+    { 52, -2 },
+    { 53, -1 },
+    { 56, -1 },
+    { 11, 1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 15, -1 },
+    { 16, -2 },
+    { 17, -1 },
+    { 19, -2 },
+    { 45, -1 },
+    { 46, -1 },
+    { 51, 1 },
+    { 55, -1 },
+    { 57, -2 },
+    { 82, -1 },
+    { 83, -2 },
+    { 85, -2 },
+    { 87, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 45, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 53, -1 },
+    { 56, -1 },
+    { 83, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 15, 1 },
+    { 16, 1 },
+    { 19, 1 },
+    { 38, -2 },
+    { 45, 1 },
+    { 46, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 55, -1 },
+    { 83, 1 },
+    { 15, -2 },
+    { 19, -1 },
+    { 45, -2 },
+    { 83, -1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 38, -1 },
+    { 45, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 83, -1 },
+    { 89, -1 },
+    { 1, -2 },
+    { 4, -1 },
+    { 5, 1 },
+    { 11, 1 },
+    { 13, 1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, 1 },
+    { 19, -2 },
+    { 22, -1 },
+    { 33, 1 },
+    { 38, 1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, 1 },
+    { 3, -1 },
+    { 19, -1 },
+    { 22, -1 },
+    { 6, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 19, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 93, -1 },
+    { 12, -1 },
+    { 22, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 11, -1 },
+    { 13, -2 },
+    { 22, -1 },
+    { 23, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 33, -1 },
+    { 38, -2 },
+    { 44, -1 },
+    { 93, -2 },
+    { 4, -1 },
+    { 7, -1 },
+    { 22, -1 },
+    { 38, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, 1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 18, 1 },
+    { 22, -1 },
+    { 32, -1 },
+    { 33, 1 },
+    { 37, -1 },
+    { 38, 1 },
+    { 41, -1 },
+    { 1, -3 },
+    { 4, -3 },
+    { 6, -1 },
+    { 11, 1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 15, -2 },
+    { 16, -2 },
+    { 17, -1 },
+    { 19, -2 },
+    { 22, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 37, -1 },
+    { 38, 1 },
+    { 91, -2 },
+    { 92, -2 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 19, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 93, -1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 11, -1 },
+    { 13, -2 },
+    { 22, -1 },
+    { 25, -1 },
+    { 38, -2 },
+    { 93, -2 },
+    { 5, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 19, -1 },
+    { 38, -1 },
+    { 11, 1 },
+    { 22, -1 },
+    { 38, 1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 10, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 16, 1 },
+    { 19, 1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 32, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 44, -2 },
+    { 93, -1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 10, -1 },
+    { 11, -1 },
+    { 13, -2 },
+    { 15, 1 },
+    { 16, 1 },
+    { 19, 1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 37, -1 },
+    { 38, -2 },
+    { 40, 1 },
+    { 41, -1 },
+    { 42, 1 },
+    { 44, -1 },
+    { 93, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 13, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 26, -1 },
+    { 38, -1 },
+    { 41, -1 },
+    { 92, 1 },
+    { 93, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 22, -1 },
+    { 32, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 38, 1 },
+    { 41, -1 },
+    { 2, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, 1 },
+    { 10, -1 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -2 },
+    { 15, 1 },
+    { 16, 1 },
+    { 19, 1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 30, -1 },
+    { 37, -2 },
+    { 38, -2 },
+    { 40, 1 },
+    { 41, -2 },
+    { 42, 1 },
+    { 44, -1 },
+    { 93, -2 },
+    { 6, -1 },
+    { 12, -1 },
+    { 22, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, 2 },
+    { 38, -1 },
+    { 45, -1 },
+    { 46, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, 1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 1, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 6, -1 },
+    { 22, -1 },
+    { 37, -1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 22, 1 },
+    { 36, 1 },
+    { 39, 1 },
+    { 40, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 93, -1 },
+    { 1, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 6, -1 },
+    { 22, -1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 37, -1 },
+    { 41, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 92, -1 },
+    { 27, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 93, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 93, -1 },
+    { 22, -1 },
+    { 37, -1 },
+    { 22, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 12, -1 },
+    { 36, 2 },
+    { 46, -1 },
+    { 52, 1 },
+    { 55, -1 },
+    { 82, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 45, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 19, -1 },
+    { 13, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -1 },
+    { 38, -1 },
+    { 45, -2 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 83, -2 },
+    { 89, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 38, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 91, -1 },
+    { 93, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 34, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 3, 1 },
+    { 9, 1 },
+    { 21, 2 },
+    { 22, 1 },
+    { 36, 1 },
+    { 39, 1 },
+    { 40, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 1, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 22, -1 },
+    { 46, -1 },
+    { 55, -1 },
+    { 70, -1 },
+    { 84, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 80, -1 },
+    { 90, -1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 10, -1 },
+    { 22, -1 },
+    { 37, -2 },
+    { 46, -1 },
+    { 48, -2 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 55, -1 },
+    { 60, -2 },
+    { 62, -2 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -2 },
+    { 68, -2 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, 1 },
+    { 78, 1 },
+    { 81, -2 },
+    { 84, -1 },
+    { 86, -2 },
+    { 88, -3 },
+    { 90, -1 },
+    { 93, -1 },
+    { 6, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 69, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 90, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 1, -2 },
+    { 4, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 45, -1 },
+    { 57, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 80, -1 },
+    { 90, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 22, -1 },
+    { 37, -1 },
+    { 46, -1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 55, -1 },
+    { 56, 1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 66, 1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, 1 },
+    { 73, -1 },
+    { 82, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 90, -1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 10, -1 },
+    { 22, -1 },
+    { 37, -1 },
+    { 45, 1 },
+    { 48, -2 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 60, -1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 66, -1 },
+    { 67, -1 },
+    { 71, -1 },
+    { 76, -1 },
+    { 77, 1 },
+    { 78, 1 },
+    { 93, -2 },
+    { 1, -2 },
+    { 4, -1 },
+    { 5, 1 },
+    { 22, -1 },
+    { 45, -1 },
+    { 48, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 56, 1 },
+    { 57, -1 },
+    { 63, 1 },
+    { 65, 1 },
+    { 69, -1 },
+    { 72, 1 },
+    { 73, -1 },
+    { 83, -2 },
+    { 85, -1 },
+    { 90, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, 1 },
+    { 3, -1 },
+    { 22, -1 },
+    { 83, -1 },
+    { 3, 1 },
+    { 7, 1 },
+    { 22, 1 },
+    { 36, 1 },
+    { 48, 1 },
+    { 51, 1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 70, 1 },
+    { 79, 1 },
+    { 90, 1 },
+    { 3, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 22, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 45, -1 },
+    { 50, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 83, -1 },
+    { 89, -1 },
+    { 93, -1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 22, -1 },
+    { 48, -2 },
+    { 49, -2 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 93, -2 },
+    { 2, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 10, -1 },
+    { 22, -1 },
+    { 37, -2 },
+    { 46, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 55, -1 },
+    { 60, -1 },
+    { 62, -2 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -1 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 71, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, 1 },
+    { 78, 1 },
+    { 81, -1 },
+    { 83, 1 },
+    { 86, -1 },
+    { 88, -3 },
+    { 90, -1 },
+    { 93, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 45, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 58, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 89, -1 },
+    { 93, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 10, -1 },
+    { 22, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 51, 1 },
+    { 61, -1 },
+    { 69, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 80, -1 },
+    { 86, -1 },
+    { 90, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 45, -1 },
+    { 50, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 58, -1 },
+    { 66, -1 },
+    { 89, -1 },
+    { 93, -1 },
+    { 1, -1 },
+    { 22, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 1, -1 },
+    { 7, 1 },
+    { 90, 1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 6, -1 },
+    { 22, -1 },
+    { 37, -1 },
+    { 64, -1 },
+    { 71, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 93, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 65, -1 },
+    { 92, -1 },
+    { 1, -1 },
+    { 7, 1 },
+    { 79, 2 },
+    { 90, 1 },
+    { 1, -2 },
+    { 3, -1 },
+    { 4, -1 },
+    { 22, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 9, -1 },
+    { 3, -1 },
+    { 22, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, 1 },
+    { 10, -1 },
+    { 37, -2 },
+    { 45, 1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 55, -1 },
+    { 56, 1 },
+    { 58, 1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -2 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 71, -2 },
+    { 73, -1 },
+    { 75, -1 },
+    { 76, -2 },
+    { 77, 1 },
+    { 81, -1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 9, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 72, 1 },
+    { 74, 1 },
+    { 81, 1 },
+    { 84, 1 },
+    { 86, 1 },
+    { 90, 1 },
+    { 1, -1 },
+    { 1, -2 },
+    { 4, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 84, -1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 45, -1 },
+    { 50, -1 },
+    { 53, -1 },
+    { 56, -1 },
+    { 65, -1 },
+    { 79, 1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 9, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 2, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, 1 },
+    { 10, -1 },
+    { 22, -1 },
+    { 37, -2 },
+    { 45, 1 },
+    { 46, -1 },
+    { 51, -2 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -2 },
+    { 64, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -1 },
+    { 71, -1 },
+    { 76, -1 },
+    { 77, 1 },
+    { 83, 1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 93, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 93, -1 },
+    { 1, -2 },
+    { 4, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 45, -2 },
+    { 1, -1 },
+    { 3, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 1, -1 },
+    { 9, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 36, -1 },
+    { 45, -1 },
+    { 83, -1 },
+    { 93, -1 },
+    { 22, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 80, -1 },
+    { 85, -1 },
+    { 90, -1 },
+    { 11, -2 },
+    { 13, -2 },
+    { 38, -3 },
+    { 51, -2 },
+    { 11, 1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 15, -1 },
+    { 16, -2 },
+    { 17, -1 },
+    { 19, -2 },
+    { 45, -1 },
+    { 46, -1 },
+    { 51, 1 },
+    { 55, -1 },
+    { 83, -2 },
+};
+
 static const EpdFontData ubuntu_10_regular = {
     ubuntu_10_regularBitmaps,
     ubuntu_10_regularGlyphs,
@@ -1407,4 +2443,8 @@ static const EpdFontData ubuntu_10_regular = {
     20,
     -4,
     false,
+    ubuntu_10_regularKernLeftClasses,
+    ubuntu_10_regularKernRightClasses,
+    ubuntu_10_regularKernPairOffsets,
+    ubuntu_10_regularKernPairs,
 };
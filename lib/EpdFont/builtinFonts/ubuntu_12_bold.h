@@ -1179,7 +1179,7 @@ static const EpdGlyph ubuntu_12_boldGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 5, 17, 7, 1, 17, 11, 0 }, // !
@@ -1790,6 +1790,1716 @@ static const EpdUnicodeInterval ubuntu_12_boldIntervals[] = {
     { 0x2264, 0x2265, 0x23C },
 };
 
+static const uint8_t ubuntu_12_boldKernLeftClasses[574] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 4, 5,
+    0, 6, 7, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    9, 0, 0, 0, 0, 10, 11, 12, 13, 14, 15, 16, 17, 0, 0, 18,
+    19, 20, 0, 0, 14, 21, 14, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 0, 0, 0, 34, 35, 36, 37, 0, 38, 39, 40, 41, 42,
+    43, 44, 40, 40, 45, 35, 46, 47, 48, 49, 41, 50, 51, 52, 50, 53,
+    54, 0, 55, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58,
+    0, 0, 0, 59, 11, 11, 11, 11, 11, 11, 15, 13, 15, 15, 15, 15,
+    0, 0, 0, 0, 14, 0, 14, 14, 14, 14, 14, 0, 14, 25, 25, 25,
+    25, 29, 60, 61, 34, 34, 34, 34, 34, 34, 0, 36, 0, 0, 0, 0,
+    41, 41, 41, 41, 62, 40, 45, 45, 45, 45, 45, 0, 45, 41, 41, 41,
+    41, 50, 63, 50, 11, 34, 11, 34, 11, 34, 13, 36, 13, 36, 13, 36,
+    13, 36, 14, 64, 14, 37, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0,
+    17, 39, 17, 39, 17, 39, 17, 39, 0, 40, 0, 40, 0, 41, 0, 41,
+    0, 41, 0, 41, 0, 41, 18, 42, 18, 42, 19, 43, 43, 20, 44, 20,
+    44, 20, 64, 20, 44, 20, 44, 0, 40, 0, 40, 0, 40, 40, 0, 65,
+    14, 45, 14, 45, 14, 45, 15, 0, 22, 47, 22, 47, 22, 47, 23, 48,
+    23, 48, 23, 48, 23, 48, 24, 49, 24, 49, 24, 49, 25, 41, 25, 41,
+    25, 41, 25, 41, 25, 41, 25, 41, 27, 51, 29, 50, 29, 30, 53, 30,
+    53, 30, 53, 38, 0, 66, 66, 67, 68, 69, 70, 0, 0, 71, 72, 72,
+    73, 74, 0, 75, 0, 76, 67, 77, 68, 78, 66, 79, 77, 0, 0, 74,
+    0, 0, 0, 80, 0, 81, 69, 82, 75, 83, 84, 78, 0, 0, 78, 72,
+    0, 72, 80, 80, 0, 85, 86, 87, 88, 89, 90, 91, 87, 0, 0, 92,
+    87, 93, 87, 94, 87, 95, 96, 97, 98, 99, 100, 89, 87, 87, 89, 101,
+    87, 101, 102, 94, 87, 90, 90, 103, 88, 87, 104, 0, 0, 105, 101, 101,
+    106, 92, 0, 98, 0, 67, 107, 80, 94, 108, 109, 78, 89, 72, 101, 0,
+    95, 68, 88, 68, 88, 67, 105, 79, 91, 77, 87, 74, 92, 74, 92, 74,
+    92, 74, 92, 78, 89, 82, 88, 72, 110, 111, 112, 69, 96, 82, 97, 113,
+    114, 113, 114, 84, 100, 78, 89, 78, 89, 0, 0, 115, 116, 117, 0, 117,
+    0, 0, 79, 91, 118, 105, 0, 89, 71, 105, 78, 89, 0, 87, 78, 89,
+    0, 76, 85, 76, 85, 119, 120, 66, 90, 121, 0, 121, 0, 79, 91, 77,
+    87, 122, 105, 0, 0, 0, 0, 80, 94, 80, 94, 80, 94, 80, 87, 75,
+    98, 75, 98, 75, 98, 0, 0, 68, 88, 0, 87, 7, 7, 0, 123, 124,
+    125, 123, 124, 125, 0, 0, 0, 6, 0, 57, 58, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t ubuntu_12_boldKernRightClasses[574] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 3, 4, 5,
+    0, 6, 7, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    9, 0, 0, 0, 10, 11, 12, 13, 14, 13, 13, 13, 14, 13, 13, 15,
+    13, 13, 16, 13, 14, 13, 14, 13, 17, 18, 19, 20, 21, 22, 23, 24,
+    0, 25, 26, 0, 0, 0, 27, 17, 28, 28, 28, 29, 28, 30, 17, 31,
+    30, 30, 32, 32, 28, 32, 28, 32, 33, 17, 34, 35, 36, 37, 38, 39,
+    40, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 44, 14, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 0, 14, 19, 19, 19,
+    19, 23, 0, 17, 27, 27, 27, 27, 45, 27, 27, 28, 28, 28, 28, 28,
+    46, 17, 47, 48, 49, 32, 28, 28, 28, 28, 28, 0, 28, 34, 34, 34,
+    34, 38, 0, 38, 12, 27, 12, 27, 12, 27, 14, 28, 14, 28, 14, 28,
+    14, 28, 13, 28, 0, 28, 13, 28, 13, 28, 13, 28, 13, 28, 13, 28,
+    14, 28, 14, 28, 14, 28, 14, 28, 13, 30, 13, 30, 13, 50, 13, 51,
+    13, 52, 13, 17, 13, 17, 13, 17, 15, 31, 13, 30, 0, 13, 30, 13,
+    30, 13, 30, 13, 30, 13, 30, 13, 32, 13, 32, 13, 32, 32, 53, 54,
+    14, 28, 14, 28, 14, 28, 14, 28, 13, 32, 13, 32, 13, 32, 17, 33,
+    17, 33, 17, 33, 17, 33, 18, 17, 18, 17, 18, 17, 19, 34, 19, 34,
+    19, 34, 19, 34, 19, 34, 19, 34, 21, 36, 23, 38, 23, 24, 39, 24,
+    39, 24, 39, 29, 0, 0, 0, 55, 0, 56, 0, 0, 0, 57, 58, 0,
+    55, 0, 0, 59, 0, 60, 0, 0, 0, 61, 0, 62, 63, 0, 0, 0,
+    58, 0, 0, 64, 0, 0, 56, 55, 59, 65, 66, 0, 67, 0, 0, 0,
+    0, 0, 68, 0, 69, 70, 71, 72, 72, 73, 74, 75, 76, 72, 72, 72,
+    77, 78, 72, 79, 72, 80, 74, 81, 82, 83, 84, 72, 85, 72, 80, 86,
+    72, 72, 87, 88, 89, 74, 74, 90, 72, 91, 92, 0, 93, 94, 77, 72,
+    90, 72, 72, 82, 80, 55, 95, 64, 79, 0, 82, 0, 72, 0, 96, 0,
+    80, 0, 72, 0, 72, 0, 72, 62, 75, 63, 76, 0, 72, 0, 72, 0,
+    72, 0, 72, 0, 72, 0, 72, 0, 72, 97, 74, 56, 74, 55, 81, 98,
+    99, 98, 99, 66, 84, 55, 81, 67, 85, 67, 85, 0, 0, 100, 101, 100,
+    101, 0, 62, 75, 0, 72, 58, 77, 0, 72, 0, 72, 67, 85, 0, 78,
+    0, 60, 70, 60, 70, 102, 103, 0, 74, 104, 105, 104, 105, 62, 75, 63,
+    76, 106, 107, 0, 72, 0, 72, 64, 79, 64, 79, 64, 79, 68, 76, 59,
+    82, 59, 82, 59, 82, 67, 85, 0, 72, 0, 72, 7, 7, 0, 108, 109,
+    110, 108, 109, 110, 0, 0, 0, 6, 0, 42, 43, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t ubuntu_12_boldKernPairOffsets[126] = {
+    0, 14, 22, 53, 62, 77, 115, 136, 175, 181, 192, 215, 221, 234, 243, 246,
+    264, 266, 268, 293, 316, 326, 337, 339, 379, 383, 417, 440, 470, 507, 521, 579,
+    593, 595, 602, 611, 618, 624, 643, 649, 655, 660, 665, 674, 683, 693, 701, 709,
+    712, 714, 721, 727, 739, 744, 758, 760, 763, 766, 788, 822, 834, 846, 849, 854,
+    876, 878, 882, 886, 928, 940, 948, 949, 962, 973, 1001, 1039, 1066, 1069, 1081, 1110,
+    1123, 1135, 1166, 1186, 1213, 1220, 1221, 1222, 1233, 1240, 1245, 1253, 1265, 1267, 1277, 1284,
+    1287, 1292, 1301, 1311, 1318, 1331, 1340, 1346, 1348, 1349, 1356, 1370, 1404, 1420, 1431, 1441,
+    1449, 1491, 1501, 1510, 1516, 1519, 1526, 1528, 1531, 1541, 1542, 1567, 1603, 1618,
+};
+
+static const EpdKernPair ubuntu_12_boldKernPairs[] = {
+    { 12, -1 },
+    { 15, -2 },
+    { 44, -3 },
+    { 57, -2 },
+    { 58, -2 },
+    { 60, -1 },
+    { 61, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 91, -1 },
+    { 102, -2 },
+    { 12, 1 },
+    { 18, -2 },
+    { 20, -2 },
+    { 21, -1 },
+    { 23, -2 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 3, -1 },
+    { 4, 2 },
+    { 11, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 31, 2 },
+    { 32, -1 },
+    { 34, -1 },
+    { 38, 1 },
+    { 45, -1 },
+    { 49, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 61, 1 },
+    { 62, 1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 70, -1 },
+    { 73, 1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 82, 1 },
+    { 83, -1 },
+    { 94, 2 },
+    { 97, -1 },
+    { 98, 1 },
+    { 3, -1 },
+    { 7, 1 },
+    { 20, -1 },
+    { 23, -1 },
+    { 53, -1 },
+    { 59, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 98, -1 },
+    { 12, -2 },
+    { 15, -3 },
+    { 22, -1 },
+    { 28, -1 },
+    { 44, -3 },
+    { 49, -1 },
+    { 57, -3 },
+    { 58, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 66, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 102, -2 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, 1 },
+    { 23, -2 },
+    { 24, 1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 44, 1 },
+    { 45, -1 },
+    { 55, -2 },
+    { 57, 1 },
+    { 58, 1 },
+    { 60, 1 },
+    { 61, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 67, -2 },
+    { 73, 1 },
+    { 77, 1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 85, -1 },
+    { 98, -2 },
+    { 99, -1 },
+    { 100, -2 },
+    { 101, -1 },
+    { 102, 1 },
+    { 107, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -2 },
+    { 29, 1 },
+    { 44, -1 },
+    { 55, -1 },
+    { 56, 1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 66, -1 },
+    { 71, 1 },
+    { 74, 1 },
+    { 75, -1 },
+    { 83, 1 },
+    { 91, 1 },
+    { 97, 1 },
+    { 98, -1 },
+    { 101, 1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 44, -3 },
+    { 45, -1 },
+    { 49, -1 },
+    { 55, 1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, 1 },
+    { 64, -1 },
+    { 66, 1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 89, -1 },
+    { 90, 1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 98, 1 },
+    { 102, -1 },
+    { 103, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 23, -1 },
+    { 55, -2 },
+    { 57, 1 },
+    { 98, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 44, -1 },
+    { 55, -1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 98, -1 },
+    { 1, -1 },
+    { 5, -2 },
+    { 6, 1 },
+    { 8, 1 },
+    { 10, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, 1 },
+    { 23, -2 },
+    { 24, 1 },
+    { 25, -2 },
+    { 26, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 108, -2 },
+    { 109, -2 },
+    { 110, 1 },
+    { 8, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 26, -1 },
+    { 44, -1 },
+    { 6, 1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 26, 1 },
+    { 37, 1 },
+    { 42, -1 },
+    { 44, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 44, -2 },
+    { 15, 1 },
+    { 37, 1 },
+    { 110, 1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 8, -2 },
+    { 10, 1 },
+    { 12, -1 },
+    { 15, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, -1 },
+    { 44, -3 },
+    { 45, -1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, -2 },
+    { 5, -1 },
+    { 110, 1 },
+    { 8, -1 },
+    { 44, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 18, 1 },
+    { 22, 1 },
+    { 24, 1 },
+    { 26, 1 },
+    { 28, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 39, 1 },
+    { 42, -1 },
+    { 44, 1 },
+    { 48, 1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 51, 1 },
+    { 110, 1 },
+    { 1, -2 },
+    { 5, -3 },
+    { 6, 1 },
+    { 9, 1 },
+    { 10, -1 },
+    { 12, 1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, 1 },
+    { 23, -2 },
+    { 25, -2 },
+    { 26, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 43, 1 },
+    { 44, 1 },
+    { 108, -2 },
+    { 109, -1 },
+    { 110, 1 },
+    { 6, -3 },
+    { 8, -2 },
+    { 12, -2 },
+    { 15, -2 },
+    { 22, -1 },
+    { 44, -3 },
+    { 49, -1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, -2 },
+    { 6, 1 },
+    { 12, 1 },
+    { 15, 1 },
+    { 23, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 49, -1 },
+    { 110, 1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, 1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 32, -2 },
+    { 33, -2 },
+    { 34, -2 },
+    { 35, -2 },
+    { 36, -2 },
+    { 37, -2 },
+    { 38, -2 },
+    { 39, -2 },
+    { 42, -2 },
+    { 43, -2 },
+    { 44, -3 },
+    { 45, -2 },
+    { 47, 1 },
+    { 48, 1 },
+    { 49, -2 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 54, -1 },
+    { 108, 1 },
+    { 110, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 44, -1 },
+    { 109, 1 },
+    { 2, -1 },
+    { 3, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 10, 1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 42, -1 },
+    { 44, -4 },
+    { 45, -1 },
+    { 48, 1 },
+    { 49, -2 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, -2 },
+    { 4, 1 },
+    { 6, -1 },
+    { 8, -2 },
+    { 10, 1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 48, 1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 42, -1 },
+    { 44, 1 },
+    { 45, -1 },
+    { 48, 1 },
+    { 49, -1 },
+    { 50, 1 },
+    { 110, 1 },
+    { 2, -1 },
+    { 3, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, -1 },
+    { 10, 1 },
+    { 11, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -2 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 32, -1 },
+    { 33, -2 },
+    { 34, -1 },
+    { 39, -1 },
+    { 42, -2 },
+    { 43, -1 },
+    { 44, -4 },
+    { 45, -3 },
+    { 48, 1 },
+    { 49, -2 },
+    { 50, 1 },
+    { 51, 1 },
+    { 54, -1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, -2 },
+    { 6, 1 },
+    { 12, 1 },
+    { 15, 1 },
+    { 20, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 26, 1 },
+    { 37, 1 },
+    { 42, -1 },
+    { 44, 1 },
+    { 48, 1 },
+    { 50, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 1 },
+    { 23, 1 },
+    { 26, 2 },
+    { 27, -1 },
+    { 28, -1 },
+    { 31, 2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 38, 1 },
+    { 39, -1 },
+    { 44, -1 },
+    { 45, -1 },
+    { 49, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 62, 1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 82, 1 },
+    { 83, -1 },
+    { 84, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 94, 2 },
+    { 97, -1 },
+    { 98, 1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 103, -1 },
+    { 105, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 18, -2 },
+    { 19, -1 },
+    { 20, -3 },
+    { 21, -2 },
+    { 23, -3 },
+    { 27, -1 },
+    { 28, -1 },
+    { 31, 4 },
+    { 35, -1 },
+    { 38, 2 },
+    { 45, -1 },
+    { 31, 1 },
+    { 94, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 45, -1 },
+    { 49, -1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 10, -1 },
+    { 25, -2 },
+    { 26, -1 },
+    { 4, 1 },
+    { 5, 1 },
+    { 6, -2 },
+    { 8, -2 },
+    { 10, 1 },
+    { 25, 2 },
+    { 26, 1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 41, 1 },
+    { 46, 1 },
+    { 48, 2 },
+    { 50, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 31, 1 },
+    { 108, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 25, -2 },
+    { 26, -1 },
+    { 108, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 25, -2 },
+    { 26, -1 },
+    { 108, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 25, -2 },
+    { 31, 1 },
+    { 108, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 11, -1 },
+    { 26, -1 },
+    { 28, -1 },
+    { 42, -1 },
+    { 49, -1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 25, -2 },
+    { 26, -1 },
+    { 37, 1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 110, 1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 8, 1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 31, 1 },
+    { 108, -1 },
+    { 6, -2 },
+    { 8, -1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 38, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, -1 },
+    { 10, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 26, -1 },
+    { 110, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 26, -1 },
+    { 37, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 26, -1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, -1 },
+    { 8, 1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 35, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 42, -1 },
+    { 45, -1 },
+    { 49, -1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 6, 1 },
+    { 26, -1 },
+    { 37, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 41, 2 },
+    { 56, -1 },
+    { 62, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 69, -1 },
+    { 74, -1 },
+    { 79, -1 },
+    { 82, 1 },
+    { 83, -1 },
+    { 85, -1 },
+    { 94, 2 },
+    { 97, -1 },
+    { 98, 1 },
+    { 59, -1 },
+    { 106, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 23, -1 },
+    { 18, -2 },
+    { 23, -1 },
+    { 55, -2 },
+    { 15, -1 },
+    { 18, -2 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -2 },
+    { 24, -1 },
+    { 37, -1 },
+    { 44, -1 },
+    { 55, -2 },
+    { 57, -1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 75, -1 },
+    { 84, -1 },
+    { 98, -2 },
+    { 102, -1 },
+    { 106, -1 },
+    { 107, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -3 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -1 },
+    { 22, -2 },
+    { 23, -2 },
+    { 24, -1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, 2 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 44, -2 },
+    { 45, -1 },
+    { 46, -1 },
+    { 47, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -2 },
+    { 10, -1 },
+    { 12, -1 },
+    { 15, -1 },
+    { 20, -1 },
+    { 22, -1 },
+    { 23, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 44, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 5, -2 },
+    { 10, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 38, -1 },
+    { 41, -1 },
+    { 108, -2 },
+    { 109, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 26, 1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 1, 1 },
+    { 4, 2 },
+    { 6, -1 },
+    { 10, 1 },
+    { 25, 2 },
+    { 26, 2 },
+    { 28, -1 },
+    { 30, 1 },
+    { 33, -1 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 1 },
+    { 39, 1 },
+    { 41, 2 },
+    { 46, 2 },
+    { 47, 2 },
+    { 48, 3 },
+    { 50, 3 },
+    { 51, 3 },
+    { 52, 3 },
+    { 109, 1 },
+    { 1, -1 },
+    { 108, -1 },
+    { 57, 1 },
+    { 84, 1 },
+    { 102, 1 },
+    { 107, -1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 69, -1 },
+    { 107, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, 1 },
+    { 11, -1 },
+    { 26, 1 },
+    { 40, -1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 55, 1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 70, -2 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -2 },
+    { 77, -2 },
+    { 78, -2 },
+    { 79, -2 },
+    { 80, -1 },
+    { 83, -2 },
+    { 84, -2 },
+    { 85, -1 },
+    { 87, -2 },
+    { 88, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, 1 },
+    { 101, -2 },
+    { 102, -3 },
+    { 103, -2 },
+    { 105, -2 },
+    { 107, -1 },
+    { 108, 1 },
+    { 6, 1 },
+    { 26, 1 },
+    { 42, -1 },
+    { 55, 1 },
+    { 57, 1 },
+    { 60, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 84, 1 },
+    { 102, 1 },
+    { 109, 1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 69, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 99, -1 },
+    { 107, -1 },
+    { 8, -1 },
+    { 1, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 55, -2 },
+    { 69, -1 },
+    { 98, -2 },
+    { 107, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 55, -1 },
+    { 98, -1 },
+    { 102, 1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 26, 1 },
+    { 42, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 75, 1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, 1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 97, -1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 101, -1 },
+    { 102, 1 },
+    { 107, -1 },
+    { 3, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 10, 1 },
+    { 11, -1 },
+    { 26, 1 },
+    { 41, 1 },
+    { 42, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 62, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 93, 1 },
+    { 97, -1 },
+    { 98, 1 },
+    { 102, -2 },
+    { 103, -1 },
+    { 105, -1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 1, -1 },
+    { 5, -2 },
+    { 6, 1 },
+    { 8, 1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 55, -2 },
+    { 57, 1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 67, -1 },
+    { 75, 1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 84, 1 },
+    { 85, -1 },
+    { 97, -1 },
+    { 98, -2 },
+    { 99, -1 },
+    { 100, -1 },
+    { 102, 1 },
+    { 107, -1 },
+    { 108, -2 },
+    { 109, -2 },
+    { 8, -1 },
+    { 26, -1 },
+    { 66, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, 1 },
+    { 55, -1 },
+    { 65, -1 },
+    { 67, -1 },
+    { 82, 1 },
+    { 85, -1 },
+    { 94, 2 },
+    { 100, -1 },
+    { 102, 1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 26, 1 },
+    { 41, 1 },
+    { 42, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 75, 1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 83, -1 },
+    { 84, 1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 97, -1 },
+    { 98, 1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 102, 1 },
+    { 107, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 41, -1 },
+    { 55, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 98, -1 },
+    { 102, -1 },
+    { 106, -1 },
+    { 6, -3 },
+    { 8, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 60, -2 },
+    { 61, -1 },
+    { 66, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 102, -2 },
+    { 108, 1 },
+    { 109, 1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -2 },
+    { 10, 1 },
+    { 11, -1 },
+    { 26, 1 },
+    { 42, -2 },
+    { 43, -2 },
+    { 55, 1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 64, -1 },
+    { 66, 1 },
+    { 70, -2 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 79, -2 },
+    { 83, -1 },
+    { 84, -2 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -2 },
+    { 93, 1 },
+    { 98, 1 },
+    { 102, -1 },
+    { 108, 1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 57, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 63, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 98, -1 },
+    { 102, -1 },
+    { 106, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 26, 1 },
+    { 42, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, 1 },
+    { 60, 1 },
+    { 62, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 75, 1 },
+    { 79, -1 },
+    { 81, -1 },
+    { 83, -1 },
+    { 84, 1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 97, -1 },
+    { 98, 1 },
+    { 101, -1 },
+    { 102, 1 },
+    { 107, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 7, 1 },
+    { 26, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 82, 1 },
+    { 84, 1 },
+    { 95, 1 },
+    { 96, 1 },
+    { 99, 1 },
+    { 101, 1 },
+    { 109, 1 },
+    { 1, -1 },
+    { 4, 1 },
+    { 5, -1 },
+    { 6, 1 },
+    { 8, 1 },
+    { 82, 1 },
+    { 94, 1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 11, -1 },
+    { 26, -1 },
+    { 42, -1 },
+    { 75, 1 },
+    { 79, -1 },
+    { 109, 1 },
+    { 7, -1 },
+    { 8, 1 },
+    { 11, -1 },
+    { 26, -1 },
+    { 42, -1 },
+    { 75, 1 },
+    { 79, -1 },
+    { 82, 1 },
+    { 83, -1 },
+    { 95, 1 },
+    { 99, 1 },
+    { 109, 1 },
+    { 26, -1 },
+    { 107, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 7, 1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 26, -1 },
+    { 79, -1 },
+    { 109, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 26, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 26, -1 },
+    { 73, -1 },
+    { 82, 1 },
+    { 84, 1 },
+    { 95, 1 },
+    { 99, 1 },
+    { 109, 1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 75, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 8, 1 },
+    { 26, -1 },
+    { 42, -1 },
+    { 75, 1 },
+    { 79, -1 },
+    { 84, 1 },
+    { 109, 1 },
+    { 1, -2 },
+    { 4, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 107, -1 },
+    { 108, -2 },
+    { 109, -2 },
+    { 1, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 94, 1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 94, 1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 81, -1 },
+    { 82, -1 },
+    { 86, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 107, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 1, 1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 10, 1 },
+    { 11, -1 },
+    { 26, 1 },
+    { 41, 1 },
+    { 42, -1 },
+    { 55, 1 },
+    { 57, -2 },
+    { 58, -1 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, 1 },
+    { 66, 1 },
+    { 67, 1 },
+    { 68, 1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 78, -1 },
+    { 79, -1 },
+    { 83, -2 },
+    { 89, -1 },
+    { 90, 1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 98, 1 },
+    { 102, -2 },
+    { 108, 1 },
+    { 109, 1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 43, 1 },
+    { 73, -1 },
+    { 75, 1 },
+    { 77, -1 },
+    { 81, 1 },
+    { 82, 1 },
+    { 84, 1 },
+    { 86, 1 },
+    { 95, 1 },
+    { 96, 1 },
+    { 99, 1 },
+    { 101, 1 },
+    { 108, 1 },
+    { 109, 1 },
+    { 1, -2 },
+    { 5, -2 },
+    { 81, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 94, 1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 101, -1 },
+    { 108, -2 },
+    { 109, -2 },
+    { 1, -1 },
+    { 7, 1 },
+    { 10, -1 },
+    { 55, -1 },
+    { 62, -1 },
+    { 66, -1 },
+    { 94, 1 },
+    { 98, -1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 7, 1 },
+    { 10, -1 },
+    { 81, -1 },
+    { 94, 1 },
+    { 108, -1 },
+    { 109, -1 },
+    { 3, -1 },
+    { 4, 1 },
+    { 6, -2 },
+    { 7, -1 },
+    { 8, -2 },
+    { 9, -1 },
+    { 11, -1 },
+    { 26, 1 },
+    { 41, 1 },
+    { 42, -2 },
+    { 55, 1 },
+    { 56, -1 },
+    { 57, -2 },
+    { 58, -2 },
+    { 59, 1 },
+    { 60, -2 },
+    { 61, -1 },
+    { 62, 1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, 1 },
+    { 69, -1 },
+    { 70, -1 },
+    { 71, -1 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -1 },
+    { 80, -1 },
+    { 83, -2 },
+    { 88, -1 },
+    { 89, -1 },
+    { 90, 1 },
+    { 91, -1 },
+    { 92, -1 },
+    { 97, -1 },
+    { 98, 1 },
+    { 102, -2 },
+    { 103, -1 },
+    { 105, -1 },
+    { 6, -1 },
+    { 8, -1 },
+    { 26, -1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 82, 1 },
+    { 95, 1 },
+    { 96, 1 },
+    { 99, 1 },
+    { 109, 1 },
+    { 1, -2 },
+    { 5, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 55, -2 },
+    { 98, -2 },
+    { 108, -2 },
+    { 109, -1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 10, -1 },
+    { 26, -1 },
+    { 41, -1 },
+    { 108, -1 },
+    { 4, -1 },
+    { 26, -1 },
+    { 98, -1 },
+    { 5, -1 },
+    { 65, -1 },
+    { 81, -1 },
+    { 86, -1 },
+    { 95, -1 },
+    { 99, -1 },
+    { 100, -1 },
+    { 6, 1 },
+    { 102, 1 },
+    { 1, -1 },
+    { 7, 1 },
+    { 26, -1 },
+    { 4, -1 },
+    { 7, 1 },
+    { 8, -1 },
+    { 26, -1 },
+    { 59, -1 },
+    { 62, -1 },
+    { 66, -1 },
+    { 68, -1 },
+    { 98, -1 },
+    { 106, -1 },
+    { 107, -1 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -2 },
+    { 20, 1 },
+    { 21, 1 },
+    { 23, 1 },
+    { 24, 1 },
+    { 27, -1 },
+    { 28, -1 },
+    { 44, -5 },
+    { 45, -1 },
+    { 49, -2 },
+    { 57, -2 },
+    { 58, -2 },
+    { 60, -2 },
+    { 61, -1 },
+    { 64, -1 },
+    { 70, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 91, -1 },
+    { 102, -3 },
+    { 12, -2 },
+    { 14, -1 },
+    { 15, -3 },
+    { 20, 1 },
+    { 21, 1 },
+    { 23, 1 },
+    { 27, -2 },
+    { 28, -2 },
+    { 32, -1 },
+    { 33, -2 },
+    { 34, -1 },
+    { 39, -1 },
+    { 44, -3 },
+    { 45, -2 },
+    { 49, -2 },
+    { 57, -3 },
+    { 58, -2 },
+    { 60, -2 },
+    { 61, -2 },
+    { 64, -1 },
+    { 65, -1 },
+    { 70, -2 },
+    { 72, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 77, -2 },
+    { 78, -1 },
+    { 79, -2 },
+    { 80, -1 },
+    { 83, -2 },
+    { 89, -1 },
+    { 91, -1 },
+    { 92, -2 },
+    { 102, -3 },
+    { 103, -1 },
+    { 105, -1 },
+    { 12, 1 },
+    { 14, -1 },
+    { 15, 1 },
+    { 18, -2 },
+    { 20, -3 },
+    { 21, -2 },
+    { 22, 1 },
+    { 23, -3 },
+    { 31, 1 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, 1 },
+    { 38, -1 },
+    { 39, 1 },
+    { 44, 1 },
+};
+
 static const EpdFontData ubuntu_12_bold = {
     ubuntu_12_boldBitmaps,
     ubuntu_12_boldGlyphs,
@@ -1799,4 +3509,8 @@ static const EpdFontData ubuntu_12_bold = {
     24,
     -5,
     false,
+    ubuntu_12_boldKernLeftClasses,
+    ubuntu_12_boldKernRightClasses,
+    ubuntu_12_boldKernPairOffsets,
+    ubuntu_12_boldKernPairs,
 };
@@ -1072,7 +1072,7 @@ static const EpdGlyph ubuntu_12_regularGlyphs[] = {
     { 0, 0, 0, 0, 0, 0, 0 }, //  
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, // 	
-    { 0, 0, 6, 0, 0, 0, 0 }, // 
+    { 0, 0, 6, 0, 0, 0, 0 }, // 
     { 0, 0, 0, 0, 0, 0, 0 }, // 
     { 0, 0, 6, 0, 0, 0, 0 }, //  
     { 5, 17, 7, 1, 17, 11, 0 }, // !
@@ -1683,6 +1683,1302 @@ static const EpdUnicodeInterval ubuntu_12_regularIntervals[] = {
     { 0x2264, 0x2265, 0x23C },
 };
 
+static const uint8_t ubuntu_12_regularKernLeftClasses[574] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 3, 4,
+    0, 5, 6, 5, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    8, 0, 0, 0, 0, 9, 10, 11, 12, 13, 14, 15, 16, 0, 0, 17,
+    18, 19, 0, 0, 13, 20, 21, 22, 0, 23, 24, 25, 26, 27, 28, 29,
+    30, 0, 31, 0, 0, 0, 32, 33, 34, 0, 0, 35, 0, 36, 0, 0,
+    37, 0, 36, 36, 33, 33, 38, 39, 0, 34, 0, 40, 40, 41, 0, 42,
+    43, 0, 44, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+    0, 0, 0, 48, 10, 10, 10, 10, 10, 10, 14, 12, 14, 14, 14, 14,
+    0, 0, 0, 0, 13, 0, 13, 13, 13, 13, 13, 0, 13, 24, 24, 24,
+    24, 28, 49, 50, 32, 32, 32, 32, 32, 32, 0, 34, 0, 0, 0, 0,
+    0, 0, 0, 0, 51, 36, 33, 33, 33, 33, 33, 0, 33, 0, 0, 0,
+    0, 0, 33, 0, 10, 32, 10, 32, 10, 32, 12, 34, 12, 34, 12, 34,
+    12, 34, 13, 52, 13, 0, 14, 0, 14, 0, 14, 0, 14, 0, 14, 0,
+    16, 0, 16, 0, 16, 0, 16, 0, 0, 36, 0, 36, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 17, 0, 17, 0, 18, 37, 37, 19, 0, 19,
+    0, 19, 52, 19, 0, 19, 0, 0, 36, 0, 36, 0, 36, 36, 0, 53,
+    13, 33, 13, 33, 13, 33, 14, 0, 22, 39, 22, 39, 22, 39, 0, 0,
+    0, 0, 0, 0, 0, 0, 23, 34, 23, 34, 23, 34, 24, 0, 24, 0,
+    24, 0, 24, 0, 24, 0, 24, 0, 26, 40, 28, 0, 28, 29, 42, 29,
+    42, 29, 42, 35, 0, 54, 54, 55, 56, 57, 58, 0, 0, 0, 0, 0,
+    59, 60, 0, 61, 0, 62, 55, 63, 56, 64, 54, 0, 65, 0, 0, 60,
+    0, 66, 0, 67, 0, 68, 57, 69, 61, 70, 71, 64, 0, 0, 64, 0,
+    0, 0, 72, 67, 0, 32, 73, 74, 75, 76, 32, 77, 78, 0, 0, 77,
+    0, 0, 0, 79, 0, 79, 80, 81, 82, 83, 84, 85, 0, 0, 85, 86,
+    0, 86, 79, 79, 0, 32, 32, 87, 75, 88, 89, 0, 0, 0, 86, 86,
+    90, 77, 0, 82, 0, 55, 86, 67, 79, 91, 92, 64, 85, 0, 86, 0,
+    79, 56, 75, 56, 75, 55, 93, 0, 77, 65, 78, 60, 77, 60, 77, 60,
+    77, 60, 77, 64, 85, 69, 75, 0, 94, 95, 96, 57, 80, 69, 81, 97,
+    82, 97, 82, 71, 84, 64, 85, 64, 85, 0, 0, 98, 90, 65, 78, 65,
+    78, 0, 0, 77, 0, 0, 0, 85, 0, 99, 64, 85, 0, 0, 64, 85,
+    0, 62, 32, 62, 32, 0, 78, 54, 32, 100, 79, 100, 79, 0, 77, 65,
+    78, 101, 102, 0, 0, 0, 0, 67, 79, 67, 79, 67, 79, 72, 78, 61,
+    82, 61, 82, 61, 82, 0, 0, 56, 75, 0, 0, 6, 6, 0, 103, 0,
+    104, 103, 0, 104, 0, 0, 0, 5, 0, 46, 47, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t ubuntu_12_regularKernRightClasses[574] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 3, 4,
+    0, 5, 6, 5, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    8, 0, 0, 0, 9, 10, 11, 0, 12, 0, 0, 0, 12, 0, 0, 13,
+    0, 0, 0, 0, 12, 0, 12, 0, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 0, 0, 0, 25, 0, 26, 26, 26, 0, 27, 0, 0, 28,
+    0, 0, 25, 25, 26, 25, 29, 25, 30, 0, 31, 32, 33, 34, 35, 36,
+    37, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40,
+    0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 41, 12, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12, 0, 12, 16, 16, 16,
+    16, 20, 0, 0, 25, 25, 25, 25, 25, 25, 25, 26, 26, 26, 26, 26,
+    42, 0, 43, 44, 45, 25, 26, 26, 26, 26, 26, 0, 26, 31, 31, 31,
+    31, 35, 0, 35, 11, 25, 11, 25, 11, 25, 12, 26, 12, 26, 12, 26,
+    12, 26, 0, 26, 0, 26, 0, 26, 0, 26, 0, 26, 0, 26, 0, 26,
+    12, 27, 12, 27, 12, 27, 12, 27, 0, 0, 0, 0, 0, 46, 0, 46,
+    0, 42, 0, 0, 0, 0, 0, 0, 13, 28, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 25, 0, 25, 25, 0, 47,
+    12, 26, 12, 26, 12, 26, 12, 26, 0, 25, 0, 25, 0, 25, 14, 30,
+    14, 30, 14, 30, 14, 30, 15, 0, 15, 0, 15, 0, 16, 31, 16, 31,
+    16, 31, 16, 31, 16, 31, 16, 31, 18, 33, 20, 35, 20, 21, 36, 21,
+    36, 21, 36, 0, 0, 0, 0, 48, 0, 49, 50, 0, 0, 51, 52, 0,
+    48, 0, 0, 53, 0, 54, 0, 0, 0, 55, 0, 56, 57, 0, 0, 0,
+    52, 0, 0, 49, 0, 0, 49, 48, 53, 58, 59, 0, 60, 0, 0, 48,
+    0, 0, 61, 0, 62, 63, 64, 65, 65, 66, 67, 68, 69, 65, 65, 65,
+    70, 71, 65, 67, 65, 72, 67, 73, 74, 75, 76, 65, 77, 65, 65, 73,
+    65, 65, 65, 65, 71, 67, 67, 78, 65, 79, 80, 0, 81, 82, 70, 65,
+    78, 65, 65, 74, 65, 48, 83, 49, 67, 53, 74, 0, 65, 0, 84, 0,
+    72, 0, 65, 0, 65, 0, 65, 56, 68, 57, 69, 0, 65, 0, 65, 0,
+    65, 0, 65, 0, 65, 0, 65, 0, 65, 85, 79, 49, 67, 48, 73, 86,
+    87, 86, 87, 59, 76, 48, 73, 60, 77, 60, 77, 0, 0, 88, 89, 88,
+    89, 0, 56, 68, 0, 65, 52, 70, 0, 65, 0, 65, 60, 77, 0, 71,
+    0, 54, 63, 54, 63, 0, 90, 0, 67, 91, 90, 91, 90, 56, 68, 57,
+    92, 93, 94, 0, 65, 0, 65, 49, 67, 49, 67, 49, 67, 61, 92, 53,
+    74, 53, 74, 53, 74, 60, 77, 0, 65, 0, 65, 6, 6, 0, 95, 96,
+    97, 95, 96, 97, 0, 0, 0, 5, 0, 39, 40, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t ubuntu_12_regularKernPairOffsets[105] = {
+    0, 12, 19, 29, 39, 56, 69, 87, 93, 113, 129, 135, 143, 156, 166, 180,
+    181, 184, 202, 222, 233, 241, 246, 280, 285, 311, 325, 337, 368, 378, 407, 408,
+    414, 422, 426, 437, 445, 452, 453, 462, 467, 474, 479, 487, 503, 507, 511, 533,
+    545, 562, 572, 573, 582, 586, 595, 603, 647, 659, 661, 674, 701, 728, 755, 761,
+    779, 782, 784, 805, 818, 862, 882, 900, 919, 922, 926, 938, 946, 955, 960, 969,
+    974, 986, 994, 1007, 1014, 1023, 1028, 1031, 1034, 1038, 1044, 1084, 1097, 1098, 1102, 1116,
+    1120, 1153, 1160, 1162, 1175, 1182, 1184, 1191, 1205,
+};
+
+static const EpdKernPair ubuntu_12_regularKernPairs[] = {
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -3 },
+    { 41, -3 },
+    { 49, -1 },
+    { 51, -3 },
+    { 52, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 58, -1 },
+    { 85, -1 },
+    { 91, -1 },
+    { 3, 2 },
+    { 12, -1 },
+    { 49, -1 },
+    { 55, 1 },
+    { 58, -1 },
+    { 85, -1 },
+    { 91, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 48, -1 },
+    { 53, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 86, -1 },
+    { 11, -2 },
+    { 13, -3 },
+    { 19, -1 },
+    { 41, -2 },
+    { 51, -3 },
+    { 52, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 56, -1 },
+    { 59, -1 },
+    { 11, 1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 15, -2 },
+    { 16, -1 },
+    { 17, -2 },
+    { 18, -1 },
+    { 20, -2 },
+    { 48, -2 },
+    { 49, -1 },
+    { 54, 1 },
+    { 58, -1 },
+    { 60, -3 },
+    { 85, -1 },
+    { 86, -2 },
+    { 88, -3 },
+    { 91, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 59, -1 },
+    { 86, -1 },
+    { 93, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 15, 1 },
+    { 17, 1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 41, -2 },
+    { 48, 1 },
+    { 49, -1 },
+    { 51, -2 },
+    { 52, -1 },
+    { 53, 1 },
+    { 54, -1 },
+    { 55, -1 },
+    { 58, -1 },
+    { 85, -1 },
+    { 86, 1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 20, -1 },
+    { 48, -2 },
+    { 86, -1 },
+    { 91, -1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 41, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 86, -1 },
+    { 93, -1 },
+    { 1, -2 },
+    { 4, -2 },
+    { 5, 1 },
+    { 11, 1 },
+    { 13, 1 },
+    { 15, -2 },
+    { 17, -2 },
+    { 19, 1 },
+    { 20, -2 },
+    { 24, -1 },
+    { 32, -1 },
+    { 34, 1 },
+    { 41, 1 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, 1 },
+    { 3, -1 },
+    { 7, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 2, -1 },
+    { 5, 1 },
+    { 6, -1 },
+    { 11, 1 },
+    { 13, 1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, 1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 41, -1 },
+    { 97, -1 },
+    { 2, -1 },
+    { 12, -1 },
+    { 16, -1 },
+    { 24, -1 },
+    { 27, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 11, -1 },
+    { 13, -2 },
+    { 24, -1 },
+    { 25, -1 },
+    { 31, -1 },
+    { 34, -1 },
+    { 36, -1 },
+    { 40, -1 },
+    { 41, -2 },
+    { 47, -1 },
+    { 97, -3 },
+    { 4, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 41, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 11, 1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 19, 1 },
+    { 20, 1 },
+    { 21, 1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 33, -1 },
+    { 34, 1 },
+    { 39, -2 },
+    { 41, 1 },
+    { 44, 1 },
+    { 45, -1 },
+    { 1, -3 },
+    { 4, -3 },
+    { 5, 1 },
+    { 6, -2 },
+    { 11, 1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 15, -3 },
+    { 17, -2 },
+    { 18, -1 },
+    { 20, -3 },
+    { 24, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 34, 1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, 1 },
+    { 95, -3 },
+    { 96, -3 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 11, -1 },
+    { 13, -2 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 38, -1 },
+    { 41, -2 },
+    { 97, -3 },
+    { 1, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 41, -1 },
+    { 11, 1 },
+    { 13, 1 },
+    { 24, -1 },
+    { 34, 1 },
+    { 41, 1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, 1 },
+    { 10, -1 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -2 },
+    { 15, 1 },
+    { 17, 1 },
+    { 20, 1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 30, -1 },
+    { 31, -1 },
+    { 32, -1 },
+    { 33, -2 },
+    { 35, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -2 },
+    { 40, -2 },
+    { 41, -2 },
+    { 43, 1 },
+    { 44, 1 },
+    { 45, -2 },
+    { 46, 1 },
+    { 47, -2 },
+    { 97, -2 },
+    { 7, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 41, -1 },
+    { 97, -1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, 1 },
+    { 10, -1 },
+    { 11, -2 },
+    { 13, -2 },
+    { 15, 1 },
+    { 17, 1 },
+    { 18, 1 },
+    { 20, 1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 31, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, -2 },
+    { 44, 1 },
+    { 45, -1 },
+    { 46, 1 },
+    { 47, -1 },
+    { 96, 1 },
+    { 97, -2 },
+    { 5, -1 },
+    { 7, -1 },
+    { 13, -2 },
+    { 17, 1 },
+    { 20, 1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 41, -1 },
+    { 45, -1 },
+    { 96, 1 },
+    { 97, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 10, -1 },
+    { 11, 1 },
+    { 12, -1 },
+    { 24, -1 },
+    { 33, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 41, 1 },
+    { 45, -1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, 1 },
+    { 10, -1 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -3 },
+    { 15, 1 },
+    { 17, 1 },
+    { 18, 1 },
+    { 19, 1 },
+    { 20, 1 },
+    { 24, -1 },
+    { 25, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 31, -1 },
+    { 36, -1 },
+    { 37, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 41, -2 },
+    { 44, 1 },
+    { 45, -2 },
+    { 46, 1 },
+    { 47, -1 },
+    { 97, -2 },
+    { 2, -1 },
+    { 6, -2 },
+    { 12, -1 },
+    { 24, -1 },
+    { 27, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -1 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 24, 2 },
+    { 41, -1 },
+    { 48, -1 },
+    { 49, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 55, 1 },
+    { 56, -1 },
+    { 58, -1 },
+    { 59, -1 },
+    { 60, -1 },
+    { 62, -1 },
+    { 85, -1 },
+    { 86, -1 },
+    { 88, -1 },
+    { 93, -1 },
+    { 85, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 96, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 6, -1 },
+    { 24, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 3, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 9, 1 },
+    { 24, 1 },
+    { 38, 1 },
+    { 42, 1 },
+    { 44, 1 },
+    { 46, 1 },
+    { 97, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 6, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 39, -1 },
+    { 45, -1 },
+    { 28, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 32, 1 },
+    { 35, 1 },
+    { 39, -1 },
+    { 97, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 97, -1 },
+    { 24, -1 },
+    { 26, -1 },
+    { 27, -1 },
+    { 29, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 45, -1 },
+    { 24, -1 },
+    { 27, -1 },
+    { 37, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 12, -1 },
+    { 14, -1 },
+    { 16, -1 },
+    { 38, 2 },
+    { 49, -1 },
+    { 55, 1 },
+    { 58, -1 },
+    { 85, -1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 48, -1 },
+    { 53, -1 },
+    { 54, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 86, -1 },
+    { 93, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 20, -1 },
+    { 15, -2 },
+    { 20, -1 },
+    { 48, -2 },
+    { 86, -1 },
+    { 13, -1 },
+    { 14, -1 },
+    { 15, -2 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -1 },
+    { 20, -2 },
+    { 21, -1 },
+    { 41, -1 },
+    { 48, -2 },
+    { 50, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 62, -1 },
+    { 86, -2 },
+    { 93, -1 },
+    { 11, -1 },
+    { 12, -1 },
+    { 13, -2 },
+    { 14, -1 },
+    { 15, -3 },
+    { 16, -1 },
+    { 17, -1 },
+    { 18, -1 },
+    { 19, -2 },
+    { 20, -2 },
+    { 21, -2 },
+    { 41, -2 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 9, -1 },
+    { 11, -1 },
+    { 13, -1 },
+    { 15, -1 },
+    { 17, -1 },
+    { 19, -1 },
+    { 20, -1 },
+    { 21, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 41, -1 },
+    { 95, -1 },
+    { 97, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 24, -1 },
+    { 32, -1 },
+    { 33, -1 },
+    { 35, -1 },
+    { 38, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 7, -1 },
+    { 3, 2 },
+    { 9, 1 },
+    { 23, 2 },
+    { 24, 2 },
+    { 38, 2 },
+    { 42, 2 },
+    { 43, 2 },
+    { 44, 3 },
+    { 46, 3 },
+    { 1, -1 },
+    { 9, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 2, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 39, -1 },
+    { 49, -1 },
+    { 58, -1 },
+    { 74, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 60, -1 },
+    { 73, -1 },
+    { 83, -1 },
+    { 94, -1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, 1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 37, -1 },
+    { 39, -2 },
+    { 40, -2 },
+    { 48, 1 },
+    { 49, -1 },
+    { 51, -3 },
+    { 52, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 58, -1 },
+    { 63, -2 },
+    { 65, -2 },
+    { 66, -3 },
+    { 67, -3 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -3 },
+    { 71, -3 },
+    { 72, -2 },
+    { 73, -2 },
+    { 74, -2 },
+    { 75, -2 },
+    { 76, -2 },
+    { 77, -2 },
+    { 78, 1 },
+    { 79, -3 },
+    { 80, -3 },
+    { 81, 1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 87, -2 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -3 },
+    { 94, -2 },
+    { 97, -2 },
+    { 2, -1 },
+    { 5, 1 },
+    { 6, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 51, 1 },
+    { 54, 1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 94, -1 },
+    { 73, -1 },
+    { 83, -1 },
+    { 1, -2 },
+    { 3, -1 },
+    { 4, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 48, -1 },
+    { 60, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 94, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 24, -1 },
+    { 39, -2 },
+    { 49, -1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, 1 },
+    { 58, -1 },
+    { 59, 1 },
+    { 64, -1 },
+    { 66, 1 },
+    { 68, 1 },
+    { 70, 1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 75, -1 },
+    { 76, 1 },
+    { 77, -2 },
+    { 83, -1 },
+    { 85, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 89, -1 },
+    { 94, -1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 9, 1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 48, 1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 53, 1 },
+    { 54, -2 },
+    { 55, -2 },
+    { 63, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 75, -1 },
+    { 78, 1 },
+    { 79, -1 },
+    { 81, 1 },
+    { 85, -1 },
+    { 90, -1 },
+    { 96, 1 },
+    { 97, -2 },
+    { 1, -2 },
+    { 4, -2 },
+    { 5, 1 },
+    { 24, -1 },
+    { 48, -2 },
+    { 51, 1 },
+    { 52, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 56, 1 },
+    { 59, 1 },
+    { 60, -1 },
+    { 66, 1 },
+    { 68, 1 },
+    { 70, 1 },
+    { 73, -1 },
+    { 76, 1 },
+    { 77, -1 },
+    { 83, -1 },
+    { 85, -1 },
+    { 86, -2 },
+    { 87, -1 },
+    { 88, -1 },
+    { 94, -1 },
+    { 95, -2 },
+    { 96, -2 },
+    { 97, 1 },
+    { 3, -1 },
+    { 7, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 59, -1 },
+    { 86, -1 },
+    { 3, 1 },
+    { 7, 1 },
+    { 24, 1 },
+    { 38, 1 },
+    { 51, 1 },
+    { 52, 1 },
+    { 54, 1 },
+    { 55, 1 },
+    { 58, -1 },
+    { 60, -1 },
+    { 66, 1 },
+    { 68, 1 },
+    { 70, 1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 82, 2 },
+    { 85, -1 },
+    { 94, 1 },
+    { 3, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 86, -1 },
+    { 93, -1 },
+    { 97, -1 },
+    { 3, -1 },
+    { 5, -2 },
+    { 7, -2 },
+    { 24, -1 },
+    { 38, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 54, -1 },
+    { 55, -2 },
+    { 56, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 97, -3 },
+    { 2, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -2 },
+    { 9, 1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 37, -1 },
+    { 39, -2 },
+    { 40, -2 },
+    { 48, 1 },
+    { 49, -1 },
+    { 51, -2 },
+    { 52, -2 },
+    { 54, -2 },
+    { 55, -2 },
+    { 58, -1 },
+    { 63, -1 },
+    { 65, -2 },
+    { 66, -2 },
+    { 67, -1 },
+    { 68, -2 },
+    { 69, -2 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -1 },
+    { 73, -2 },
+    { 74, -1 },
+    { 75, -1 },
+    { 77, -2 },
+    { 78, 1 },
+    { 79, -2 },
+    { 80, -2 },
+    { 81, 1 },
+    { 84, -2 },
+    { 85, -1 },
+    { 86, 1 },
+    { 87, -1 },
+    { 89, -2 },
+    { 90, -2 },
+    { 92, -3 },
+    { 94, -2 },
+    { 97, -2 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 55, -1 },
+    { 56, -2 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 93, -1 },
+    { 97, -1 },
+    { 2, -1 },
+    { 4, -1 },
+    { 6, -1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 49, -1 },
+    { 54, 1 },
+    { 58, -1 },
+    { 64, -1 },
+    { 68, 1 },
+    { 73, -1 },
+    { 77, -1 },
+    { 79, -1 },
+    { 83, -1 },
+    { 89, -1 },
+    { 94, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 48, -1 },
+    { 51, -1 },
+    { 52, -1 },
+    { 53, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 93, -1 },
+    { 97, -1 },
+    { 1, -1 },
+    { 7, -1 },
+    { 68, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 73, 1 },
+    { 74, 1 },
+    { 84, 1 },
+    { 87, 1 },
+    { 89, 1 },
+    { 1, -1 },
+    { 3, 1 },
+    { 7, 1 },
+    { 24, 1 },
+    { 38, 1 },
+    { 70, 1 },
+    { 74, 1 },
+    { 94, 1 },
+    { 6, -1 },
+    { 24, -1 },
+    { 39, -1 },
+    { 66, 1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 70, 1 },
+    { 75, -1 },
+    { 79, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 68, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 6, -1 },
+    { 24, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 68, 1 },
+    { 5, -1 },
+    { 6, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 73, 1 },
+    { 74, 1 },
+    { 84, 1 },
+    { 87, 1 },
+    { 89, 1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 73, 1 },
+    { 97, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 8, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 92, -1 },
+    { 95, -1 },
+    { 96, -1 },
+    { 24, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 66, 1 },
+    { 67, -1 },
+    { 68, 1 },
+    { 75, -1 },
+    { 1, -1 },
+    { 3, 1 },
+    { 7, 1 },
+    { 24, 1 },
+    { 38, 1 },
+    { 70, 1 },
+    { 74, 1 },
+    { 82, 2 },
+    { 94, 1 },
+    { 1, -2 },
+    { 3, -1 },
+    { 4, -1 },
+    { 24, -1 },
+    { 73, -1 },
+    { 1, -1 },
+    { 4, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 4, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 3, 1 },
+    { 6, -2 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, 1 },
+    { 10, -1 },
+    { 24, 1 },
+    { 38, 1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 48, 1 },
+    { 52, -1 },
+    { 53, 1 },
+    { 54, -2 },
+    { 55, -1 },
+    { 56, 1 },
+    { 58, -1 },
+    { 59, 1 },
+    { 61, 1 },
+    { 63, -1 },
+    { 65, -1 },
+    { 66, -3 },
+    { 67, -2 },
+    { 68, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -2 },
+    { 72, -1 },
+    { 75, -2 },
+    { 76, -1 },
+    { 77, -1 },
+    { 78, 1 },
+    { 79, -2 },
+    { 80, -2 },
+    { 84, -1 },
+    { 85, -1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 92, -1 },
+    { 94, -1 },
+    { 4, 1 },
+    { 5, -2 },
+    { 7, -1 },
+    { 9, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 73, 1 },
+    { 74, 1 },
+    { 76, 1 },
+    { 84, 1 },
+    { 87, 1 },
+    { 89, 1 },
+    { 94, 1 },
+    { 1, -1 },
+    { 1, -2 },
+    { 4, -2 },
+    { 73, -1 },
+    { 87, -1 },
+    { 1, -1 },
+    { 5, -1 },
+    { 9, -1 },
+    { 22, -1 },
+    { 48, -2 },
+    { 53, -1 },
+    { 56, -1 },
+    { 57, -1 },
+    { 59, -1 },
+    { 61, -1 },
+    { 68, -1 },
+    { 69, -1 },
+    { 82, 1 },
+    { 92, -1 },
+    { 1, -2 },
+    { 4, -1 },
+    { 9, -1 },
+    { 73, -1 },
+    { 2, -1 },
+    { 5, -2 },
+    { 6, -1 },
+    { 7, -2 },
+    { 8, -1 },
+    { 9, 1 },
+    { 10, -1 },
+    { 24, -1 },
+    { 37, -1 },
+    { 39, -2 },
+    { 40, -1 },
+    { 48, 1 },
+    { 49, -1 },
+    { 54, -2 },
+    { 59, 1 },
+    { 63, -1 },
+    { 64, -1 },
+    { 65, -1 },
+    { 66, -2 },
+    { 67, -1 },
+    { 69, -1 },
+    { 70, -2 },
+    { 71, -1 },
+    { 72, -1 },
+    { 75, -2 },
+    { 78, 1 },
+    { 79, -2 },
+    { 80, -1 },
+    { 86, 1 },
+    { 89, -1 },
+    { 90, -1 },
+    { 92, -1 },
+    { 97, -2 },
+    { 1, -2 },
+    { 4, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 48, -2 },
+    { 60, -1 },
+    { 1, -1 },
+    { 9, -1 },
+    { 1, -1 },
+    { 3, -1 },
+    { 5, -1 },
+    { 7, -1 },
+    { 9, -1 },
+    { 24, -1 },
+    { 38, -1 },
+    { 48, -1 },
+    { 59, -1 },
+    { 66, -1 },
+    { 70, -1 },
+    { 86, -1 },
+    { 97, -1 },
+    { 24, -1 },
+    { 73, -1 },
+    { 74, -1 },
+    { 83, -1 },
+    { 87, -1 },
+    { 88, -1 },
+    { 94, -1 },
+    { 37, -1 },
+    { 39, -1 },
+    { 11, -2 },
+    { 12, -1 },
+    { 13, -3 },
+    { 41, -3 },
+    { 49, -1 },
+    { 54, -2 },
+    { 58, -1 },
+    { 11, 1 },
+    { 12, -1 },
+    { 13, 1 },
+    { 15, -2 },
+    { 17, -2 },
+    { 18, -1 },
+    { 20, -2 },
+    { 21, 1 },
+    { 41, 1 },
+    { 48, -2 },
+    { 49, -1 },
+    { 54, 1 },
+    { 58, -1 },
+    { 86, -2 },
+};
+
 static const EpdFontData ubuntu_12_regular = {
     ubuntu_12_regularBitmaps,
     ubuntu_12_regularGlyphs,
@@ -1692,4 +2988,8 @@ static const EpdFontData ubuntu_12_regular = {
     24,
     -5,
     false,
+    ubuntu_12_regularKernLeftClasses,
+    ubuntu_12_regularKernRightClasses,
+    ubuntu_12_regularKernPairOffsets,
+    ubuntu_12_regularKernPairs,
 };
@@ -6,6 +6,7 @@ import re
 import math
 import argparse
 from collections import namedtuple
+from kerning import extract_kerning, print_kerning
 
 # Originally from https://github.com/vroland/epdiy
 
@@ -111,6 +112,12 @@ def norm_floor(val):
 def norm_ceil(val):
     return int(math.ceil(val / (1 << 6)))
 
+def glyph_comment(code_point):
+    # A raw backslash would continue the comment onto the next line, a raw carriage return would end it
+    if code_point == 92:
+        return '<backslash>'
+    return '' if code_point == 13 else chr(code_point)
+
 def chunks(l, n):
     for i in range(0, len(l), n):
         yield l[i:i + n]
@@ -255,6 +262,10 @@ for i_start, i_end in intervals:
         total_size += len(packed)
         all_glyphs.append((glyph, packed))
 
+# kerning comes from the primary font only, scaled to the ppem set_char_size uses at 150 dpi
+kern_code_points = [g.code_point for g, _ in all_glyphs]
+kerning = extract_kerning(args.fontstack[0], kern_code_points, size * 150 / 72)
+
 # pipe seems to be a good heuristic for the "real" descender
 face = load_glyph(ord('|'))
 
@@ -275,7 +286,7 @@ print ("};\n");
 
 print(f"static const EpdGlyph {font_name}Glyphs[] = {{")
 for i, g in enumerate(glyph_props):
-    print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {chr(g.code_point) if g.code_point != 92 else '<backslash>'}")
+    print ("    { " + ", ".join([f"{a}" for a in list(g[:-1])]),"},", f"// {glyph_comment(g.code_point)}")
 print ("};\n");
 
 print(f"static const EpdUnicodeInterval {font_name}Intervals[] = {{")
@@ -285,6 +296,8 @@ for i_start, i_end in intervals:
     offset += i_end - i_start + 1
 print ("};\n");
 
+print_kerning(font_name, kern_code_points, kerning)
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -294,4 +307,11 @@ print(f"    {norm_ceil(face.size.height)},")
 print(f"    {norm_ceil(face.size.ascender)},")
 print(f"    {norm_floor(face.size.descender)},")
 print(f"    {'true' if is2Bit else 'false'},")
+if kerning[2]:
+    print(f"    {font_name}KernLeftClasses,")
+    print(f"    {font_name}KernRightClasses,")
+    print(f"    {font_name}KernPairOffsets,")
+    print(f"    {font_name}KernPairs,")
+else:
+    print("    nullptr,\n    nullptr,\n    nullptr,\n    nullptr,")
 print("};")
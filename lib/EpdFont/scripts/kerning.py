@@ -0,0 +1,141 @@
+from fontTools.ttLib import TTFont
+
+# Extracts pair kerning from a font's GPOS 'kern' feature (or legacy 'kern' table) and compresses it into the class
+# tables read by EpdFont::getKerning.
+
+# Word spacing is set by the layout, so a pair against a space would only nudge the gap between words
+WHITESPACE_CODE_POINTS = {0x09, 0x20, 0xA0, 0x1680, 0x202F, 0x205F, 0x3000} | set(range(0x2000, 0x200B))
+# The two class arrays cost a byte per glyph each whatever the pair count, below this they are not worth the flash
+MIN_KERN_PAIRS = 16
+
+
+def _pair_pos_values(subtable, glyph_names):
+    """Yields (left, right, x_advance) for every pair in a PairPos subtable restricted to glyph_names."""
+    covered = [g for g in subtable.Coverage.glyphs if g in glyph_names]
+    if subtable.Format == 1:
+        for index, left in enumerate(subtable.Coverage.glyphs):
+            if left not in glyph_names:
+                continue
+            for record in subtable.PairSet[index].PairValueRecord:
+                if record.SecondGlyph in glyph_names and record.Value1 is not None:
+                    yield left, record.SecondGlyph, getattr(record.Value1, "XAdvance", 0) or 0
+    elif subtable.Format == 2:
+        class_def1 = subtable.ClassDef1.classDefs
+        class_def2 = subtable.ClassDef2.classDefs
+        for left in covered:
+            class1 = subtable.Class1Record[class_def1.get(left, 0)]
+            for right in glyph_names:
+                value = class1.Class2Record[class_def2.get(right, 0)].Value1
+                if value is not None:
+                    yield left, right, getattr(value, "XAdvance", 0) or 0
+
+
+def _font_unit_pairs(font, glyph_names):
+    pairs = {}
+    if "GPOS" in font and font["GPOS"].table.FeatureList is not None:
+        gpos = font["GPOS"].table
+        lookup_indices = sorted({index for record in gpos.FeatureList.FeatureRecord if record.FeatureTag == "kern"
+                                 for index in record.Feature.LookupListIndex})
+        for lookup_index in lookup_indices:
+            lookup = gpos.LookupList.Lookup[lookup_index]
+            # The first subtable covering a pair wins within a lookup, separate lookups accumulate
+            seen = set()
+            for subtable in lookup.SubTable:
+                if lookup.LookupType == 9:
+                    subtable = subtable.ExtSubTable
+                if subtable.LookupType != 2:
+                    continue
+                for left, right, value in _pair_pos_values(subtable, glyph_names):
+                    if (left, right) in seen:
+                        continue
+                    seen.add((left, right))
+                    pairs[(left, right)] = pairs.get((left, right), 0) + value
+    elif "kern" in font:
+        for table in font["kern"].kernTables:
+            for (left, right), value in table.kernTable.items():
+                if left in glyph_names and right in glyph_names:
+                    pairs[(left, right)] = pairs.get((left, right), 0) + value
+    return pairs
+
+
+def extract_kerning(font_path, code_points, ppem):
+    """Returns (left_classes, right_classes, pairs) for the given code points at ppem pixels per em.
+
+    Code points on each side that kern identically against everything share a class, classes start at 1 and a code
+    point without a class never kerns. pairs holds (left_class, right_class, adjust_x) sorted by class pair, and is
+    empty when the font has too few pairs to be worth tables.
+    """
+    font = TTFont(font_path, lazy=True)
+    cmap = font.getBestCmap()
+    scale = ppem / font["head"].unitsPerEm
+
+    glyph_code_points = {}
+    for code_point in code_points:
+        if code_point in cmap:
+            glyph_code_points.setdefault(cmap[code_point], []).append(code_point)
+
+    rows = {}
+    for (left, right), value in _font_unit_pairs(font, set(glyph_code_points)).items():
+        adjust_x = int(round(value * scale))
+        if adjust_x == 0:
+            continue
+        adjust_x = max(-128, min(127, adjust_x))
+        for left_cp in glyph_code_points[left]:
+            for right_cp in glyph_code_points[right]:
+                if left_cp in WHITESPACE_CODE_POINTS or right_cp in WHITESPACE_CODE_POINTS:
+                    continue
+                rows.setdefault(left_cp, {})[right_cp] = adjust_x
+
+    columns = {}
+    for left_cp, row in rows.items():
+        for right_cp, adjust_x in row.items():
+            columns.setdefault(right_cp, {})[left_cp] = adjust_x
+
+    def assign_classes(vectors):
+        classes = {}
+        ids = {}
+        for code_point in sorted(vectors):
+            key = tuple(sorted(vectors[code_point].items()))
+            classes[code_point] = ids.setdefault(key, len(ids) + 1)
+        return classes
+
+    right_classes = assign_classes(columns)
+    # Left classes compare rows by right class so code points differing only within a right class still merge
+    left_classes = assign_classes({cp: {right_classes[r]: v for r, v in row.items()} for cp, row in rows.items()})
+    if max(len(set(left_classes.values())), len(set(right_classes.values())), 0) > 255:
+        raise ValueError(f"{font_path}: more than 255 kerning classes")
+
+    pairs = sorted({(left_classes[l], right_classes[r], v) for l, row in rows.items() for r, v in row.items()})
+    if len(pairs) < MIN_KERN_PAIRS:
+        return {}, {}, []
+    return left_classes, right_classes, pairs
+
+
+def print_kerning(font_name, code_points, kerning):
+    """Prints the class tables, indexed like the glyph array, and the pair tables for kerning."""
+    left_classes, right_classes, pairs = kerning
+    if not pairs:
+        return
+
+    for side, classes in (("Left", left_classes), ("Right", right_classes)):
+        print(f"static const uint8_t {font_name}Kern{side}Classes[{len(code_points)}] = {{")
+        for chunk in range(0, len(code_points), 16):
+            print("    " + " ".join(f"{classes.get(cp, 0)}," for cp in code_points[chunk:chunk + 16]))
+        print("};\n")
+
+    # Pairs are grouped by left class, so only the first pair of each group (and the end) needs storing
+    left_class_count = max(left_classes.values())
+    offsets = [0] * (left_class_count + 1)
+    for left_class, _, _ in pairs:
+        offsets[left_class] += 1
+    for left_class in range(1, left_class_count + 1):
+        offsets[left_class] += offsets[left_class - 1]
+    print(f"static const uint16_t {font_name}KernPairOffsets[{len(offsets)}] = {{")
+    for chunk in range(0, len(offsets), 16):
+        print("    " + " ".join(f"{offset}," for offset in offsets[chunk:chunk + 16]))
+    print("};\n")
+
+    print(f"static const EpdKernPair {font_name}KernPairs[] = {{")
+    for _, right_class, adjust_x in pairs:
+        print(f"    {{ {right_class}, {adjust_x} }},")
+    print("};\n")
@@ -3,6 +3,7 @@
 #include <FsHelpers.h>
 #include <HardwareSerial.h>
 #include <JpegToBmpConverter.h>
+#include <PngToBmpConverter.h>
 #include <SDCardManager.h>
 #include <ZipFile.h>
 
@@ -11,6 +12,12 @@
 #include "Epub/parsers/TocNavParser.h"
 #include "Epub/parsers/TocNcxParser.h"
 
+namespace {
+constexpr char zipIndexFile[] = "/zip_index.bin";
+// Central directory records between fences when the on-disk zip index is unavailable
+constexpr uint16_t zipFenceSpacing = 16;
+}  // namespace
+
 bool Epub::findContentOpfFile(std::string* contentOpfFile) const {
   const auto containerPath = "META-INF/container.xml";
   size_t containerSize;
@@ -203,6 +210,28 @@ bool Epub::parseTocNavFile() const {
   return true;
 }
 
+ZipFile& Epub::getZip() const {
+  // Lookups still work without the index, they fall back to an in-RAM fence index or scanning the central directory
+  if (!zipIndexLoaded) {
+    // The index is written into the cache directory, which does not exist yet on the first open of a book
+    setupCacheDir();
+    zipIndexLoaded = zip.loadFileStatIndex(cachePath + zipIndexFile) || zip.loadFenceIndex(zipFenceSpacing);
+    if (!zipIndexLoaded) {
+      Serial.printf("[%lu] [EBP] Could not load zip index, falling back to central directory scan\n", millis());
+    }
+  }
+  return zip;
+}
+
+bool Epub::openZip() const {
+  if (zip.isOpen()) {
+    return true;
+  }
+  return getZip().open();
+}
+
+void Epub::closeZip() const { zip.close(); }
+
 // load in the meta data for the epub file
 bool Epub::load(const bool buildIfMissing) {
   Serial.printf("[%lu] [EBP] Loading ePub: %s\n", millis(), filepath.c_str());
@@ -283,7 +312,7 @@ bool Epub::load(const bool buildIfMissing) {
   }
 
   // Build final book.bin
-  if (!bookMetadataCache->buildBookBin(filepath, bookMetadata)) {
+  if (!bookMetadataCache->buildBookBin(getZip(), bookMetadata)) {
     Serial.printf("[%lu] [EBP] Could not update mappings and sizes\n", millis());
     return false;
   }
@@ -309,6 +338,10 @@ bool Epub::clearCache() const {
     return true;
   }
 
+  // The zip index lives in the cache directory
+  zip.unloadFileStatIndex();
+  zipIndexLoaded = false;
+
   if (!SdMan.removeDir(cachePath.c_str())) {
     Serial.printf("[%lu] [EPB] Failed to clear cache\n", millis());
     return false;
@@ -370,40 +403,45 @@ bool Epub::generateCoverBmp(bool cropped) const {
     return false;
   }
 
-  if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
-      coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    Serial.printf("[%lu] [EBP] Generating BMP from JPG cover image\n", millis());
-    const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
+  const bool isJpg = coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
+                     coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg";
+  const bool isPng = coverImageHref.substr(coverImageHref.length() - 4) == ".png";
+  if (isJpg || isPng) {
+    const char* format = isPng ? "PNG" : "JPG";
+    Serial.printf("[%lu] [EBP] Generating BMP from %s cover image\n", millis(), format);
+    const auto coverTempPath = getCachePath() + (isPng ? "/.cover.png" : "/.cover.jpg");
 
-    FsFile coverJpg;
-    if (!SdMan.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
+    FsFile coverImage;
+    if (!SdMan.openFileForWrite("EBP", coverTempPath, coverImage)) {
       return false;
     }
-    readItemContentsToStream(coverImageHref, coverJpg, 1024);
-    coverJpg.close();
+    readItemContentsToStream(coverImageHref, coverImage, 1024);
+    coverImage.close();
 
-    if (!SdMan.openFileForRead("EBP", coverJpgTempPath, coverJpg)) {
+    if (!SdMan.openFileForRead("EBP", coverTempPath, coverImage)) {
       return false;
     }
 
     FsFile coverBmp;
     if (!SdMan.openFileForWrite("EBP", getCoverBmpPath(cropped), coverBmp)) {
-      coverJpg.close();
+      coverImage.close();
       return false;
     }
-    const bool success = JpegToBmpConverter::jpegFileToBmpStream(coverJpg, coverBmp);
-    coverJpg.close();
+    const bool success = isPng ? PngToBmpConverter::pngFileToBmpStream(coverImage, coverBmp)
+                               : JpegToBmpConverter::jpegFileToBmpStream(coverImage, coverBmp);
+    coverImage.close();
     coverBmp.close();
-    SdMan.remove(coverJpgTempPath.c_str());
+    SdMan.remove(coverTempPath.c_str());
 
     if (!success) {
-      Serial.printf("[%lu] [EBP] Failed to generate BMP from JPG cover image\n", millis());
+      Serial.printf("[%lu] [EBP] Failed to generate BMP from %s cover image\n", millis(), format);
       SdMan.remove(getCoverBmpPath(cropped).c_str());
     }
-    Serial.printf("[%lu] [EBP] Generated BMP from JPG cover image, success: %s\n", millis(), success ? "yes" : "no");
+    Serial.printf("[%lu] [EBP] Generated BMP from %s cover image, success: %s\n", millis(), format,
+                  success ? "yes" : "no");
     return success;
   } else {
-    Serial.printf("[%lu] [EBP] Cover image is not a JPG, skipping\n", millis());
+    Serial.printf("[%lu] [EBP] Cover image is not a JPG or PNG, skipping\n", millis());
   }
 
   return false;
@@ -417,7 +455,7 @@ uint8_t* Epub::readItemContentsToBytes(const std::string& itemHref, size_t* size
 
   const std::string path = FsHelpers::normalisePath(itemHref);
 
-  const auto content = ZipFile(filepath).readFileToMemory(path.c_str(), size, trailingNullByte);
+  const auto content = getZip().readFileToMemory(path.c_str(), size, trailingNullByte);
   if (!content) {
     Serial.printf("[%lu] [EBP] Failed to read item %s\n", millis(), path.c_str());
     return nullptr;
@@ -433,12 +471,39 @@ bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, con
   }
 
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize);
+  return getZip().readFileToStream(path.c_str(), out, chunkSize);
+}
+
+bool Epub::readItemContentsWithReader(const std::string& itemHref,
+                                      const std::function<bool(ZipFile::InflateReader&)>& readerFn,
+                                      bool* outOfMemory) const {
+  if (outOfMemory) {
+    *outOfMemory = false;
+  }
+  if (itemHref.empty()) {
+    Serial.printf("[%lu] [EBP] Failed to read item, empty href\n", millis());
+    return false;
+  }
+
+  const std::string path = FsHelpers::normalisePath(itemHref);
+  // The reader opens and closes the zip itself unless it is already held open
+  ZipFile::InflateReader reader(getZip());
+  if (!reader.open(path.c_str())) {
+    Serial.printf("[%lu] [EBP] Failed to open reader for item %s\n", millis(), path.c_str());
+    if (outOfMemory) {
+      *outOfMemory = reader.failedToAllocate();
+    }
+    return false;
+  }
+
+  const bool success = readerFn(reader);
+  reader.close();
+  return success;
 }
 
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).getInflatedFileSize(path.c_str(), size);
+  return getZip().getInflatedFileSize(path.c_str(), size);
 }
 
 int Epub::getSpineItemsCount() const {
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <Print.h>
+#include <ZipFile.h>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -9,8 +11,6 @@
 
 #include "Epub/BookMetadataCache.h"
 
-class ZipFile;
-
 class Epub {
   // the ncx file (EPUB 2)
   std::string tocNcxItem;
@@ -22,6 +22,9 @@ class Epub {
   std::string contentBasePath;
   // Uniq cache key based on filepath
   std::string cachePath;
+  // Archive handle shared by all item reads, keeping the EOCD details and zip index loaded between them
+  mutable ZipFile zip;
+  mutable bool zipIndexLoaded = false;
   // Spine and TOC cache
   std::unique_ptr<BookMetadataCache> bookMetadataCache;
 
@@ -29,9 +32,11 @@ class Epub {
   bool parseContentOpf(BookMetadataCache::BookMetadata& bookMetadata);
   bool parseTocNcxFile() const;
   bool parseTocNavFile() const;
+  ZipFile& getZip() const;
 
  public:
-  explicit Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
+  explicit Epub(std::string filepath, const std::string& cacheDir)
+      : filepath(std::move(filepath)), zip(this->filepath) {
     // create a cache key based on the filepath
     cachePath = cacheDir + "/epub_" + std::to_string(std::hash<std::string>{}(this->filepath));
   }
@@ -39,6 +44,9 @@ class Epub {
   std::string& getBasePath() { return contentBasePath; }
   bool load(bool buildIfMissing = true);
   bool clearCache() const;
+  // Keeps the EPUB file open across item reads until closeZip, otherwise each read opens and closes it
+  bool openZip() const;
+  void closeZip() const;
   void setupCacheDir() const;
   const std::string& getCachePath() const;
   const std::string& getPath() const;
@@ -49,6 +57,11 @@ class Epub {
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
+  // Opens a pull-based reader over the item and hands it to readerFn, returning false without calling readerFn if the
+  // reader could not be opened. outOfMemory is set if that was only because the inflate buffers could not be allocated
+  bool readItemContentsWithReader(const std::string& itemHref,
+                                  const std::function<bool(ZipFile::InflateReader&)>& readerFn,
+                                  bool* outOfMemory = nullptr) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
@@ -4,6 +4,7 @@
 #include <Serialization.h>
 #include <ZipFile.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "FsHelpers.h"
@@ -13,6 +14,164 @@ constexpr uint8_t BOOK_CACHE_VERSION = 4;
 constexpr char bookBinFile[] = "/book.bin";
 constexpr char tmpSpineBinFile[] = "/spine.bin.tmp";
 constexpr char tmpTocBinFile[] = "/toc.bin.tmp";
+// Temp files of fixed-size records for matching spine items up with TOC entries, each with a scratch file to sort it
+constexpr char tmpSpineKeysFile[] = "/spine.keys.tmp";
+constexpr char tmpTocKeysFile[] = "/toc.keys.tmp";
+constexpr char tmpTocLinksFile[] = "/toc.links.tmp";
+constexpr char sortScratchSuffix[] = ".sort";
+// Records sorted in RAM at once to make the first runs of a sort on SD
+constexpr uint32_t SORT_RUN_RECORDS = 512;
+// Records read or written per SD access while merging
+constexpr uint32_t RECORD_BUFFER_RECORDS = 32;
+
+// An href by hash, with the position of its entry in the temp file and the entry's index
+struct HrefKey {
+  uint32_t hrefHash;
+  uint32_t filePos;
+  uint16_t index;
+};
+
+bool byHashThenIndex(const HrefKey& a, const HrefKey& b) {
+  return a.hrefHash < b.hrefHash || (a.hrefHash == b.hrefHash && a.index < b.index);
+}
+
+// A TOC entry pointing at a spine item
+struct TocLink {
+  uint16_t spineIndex;
+  uint16_t tocIndex;
+};
+
+bool bySpineThenToc(const TocLink& a, const TocLink& b) {
+  return a.spineIndex < b.spineIndex || (a.spineIndex == b.spineIndex && a.tocIndex < b.tocIndex);
+}
+
+// Reads count records from first on, a buffer at a time
+template <typename Record>
+class RecordReader {
+ public:
+  RecordReader(FsFile& file, const uint32_t first, const uint32_t count) : file(file), left(count) {
+    file.seek(static_cast<uint64_t>(first) * sizeof(Record));
+  }
+
+  bool next(Record* record) {
+    if (pos == filled) {
+      const uint32_t want = std::min(left, RECORD_BUFFER_RECORDS);
+      if (want == 0 || file.read(buffer, want * sizeof(Record)) != static_cast<int>(want * sizeof(Record))) {
+        return false;
+      }
+      left -= want;
+      filled = want;
+      pos = 0;
+    }
+    *record = buffer[pos++];
+    return true;
+  }
+
+ private:
+  FsFile& file;
+  Record buffer[RECORD_BUFFER_RECORDS];
+  uint32_t left;
+  uint32_t filled = 0;
+  uint32_t pos = 0;
+};
+
+template <typename Record>
+class RecordWriter {
+ public:
+  explicit RecordWriter(FsFile& file) : file(file) {}
+
+  void add(const Record& record) {
+    buffer[count++] = record;
+    if (count == RECORD_BUFFER_RECORDS) {
+      flush();
+    }
+  }
+
+  void flush() {
+    file.write(buffer, count * sizeof(Record));
+    count = 0;
+  }
+
+ private:
+  FsFile& file;
+  Record buffer[RECORD_BUFFER_RECORDS];
+  uint32_t count = 0;
+};
+
+// Merge sort of the count records in path, which must be closed. Runs of SORT_RUN_RECORDS are sorted in RAM, then
+// merged pairwise a pass at a time between path and its scratch file, so the file is read and written
+// 1 + log2(count / SORT_RUN_RECORDS) times. Returns the file left holding the sorted records, or an empty string if
+// the SD card failed, and removes the other.
+template <typename Record, typename Less>
+std::string sortRecordFile(const std::string& path, const uint32_t count, Less less) {
+  std::string source = path;
+  std::string target = path + sortScratchSuffix;
+  FsFile in;
+  FsFile out;
+  if (!SdMan.openFileForRead("BMC", source, in) || !SdMan.openFileForWrite("BMC", target, out)) {
+    in.close();
+    return "";
+  }
+  bool ok = true;
+  std::vector<Record> run;
+  run.reserve(std::min(count, SORT_RUN_RECORDS));
+  for (uint32_t first = 0; ok && first < count; first += SORT_RUN_RECORDS) {
+    run.resize(std::min(count - first, SORT_RUN_RECORDS));
+    const int bytes = static_cast<int>(run.size() * sizeof(Record));
+    ok = in.read(run.data(), bytes) == bytes;
+    std::sort(run.begin(), run.end(), less);
+    ok = ok && out.write(run.data(), bytes) == static_cast<size_t>(bytes);
+  }
+  in.close();
+  out.close();
+
+  for (uint32_t width = SORT_RUN_RECORDS; ok && width < count; width *= 2) {
+    std::swap(source, target);
+    // Two handles on the source, one for each run of a pair
+    FsFile left;
+    FsFile right;
+    if (!SdMan.openFileForRead("BMC", source, left) || !SdMan.openFileForRead("BMC", source, right) ||
+        !SdMan.openFileForWrite("BMC", target, out)) {
+      left.close();
+      right.close();
+      ok = false;
+      break;
+    }
+    RecordWriter<Record> writer(out);
+    for (uint32_t first = 0; first < count; first += 2 * width) {
+      const uint32_t middle = std::min(count, first + width);
+      const uint32_t end = std::min(count, first + 2 * width);
+      RecordReader<Record> a(left, first, middle - first);
+      RecordReader<Record> b(right, middle, end - middle);
+      Record ra;
+      Record rb;
+      bool hasA = a.next(&ra);
+      bool hasB = b.next(&rb);
+      while (hasA || hasB) {
+        // Ties go to the left run, which keeps records that compare equal in file order
+        if (hasA && (!hasB || !less(rb, ra))) {
+          writer.add(ra);
+          hasA = a.next(&ra);
+        } else {
+          writer.add(rb);
+          hasB = b.next(&rb);
+        }
+      }
+    }
+    writer.flush();
+    ok = out.size() == static_cast<uint64_t>(count) * sizeof(Record);
+    left.close();
+    right.close();
+    out.close();
+  }
+
+  SdMan.remove(source.c_str());
+  if (!ok) {
+    SdMan.remove(target.c_str());
+    return "";
+  }
+  return target;
+}
 }  // namespace
 
 /* ============= WRITING / BUILDING FUNCTIONS ================ */
@@ -52,6 +211,7 @@ bool BookMetadataCache::beginTocPass() {
 }
 
 bool BookMetadataCache::endTocPass() {
+  resolveTocSpineIndexes();
   tocFile.close();
   spineFile.close();
   return true;
@@ -68,7 +228,7 @@ bool BookMetadataCache::endWrite() {
   return true;
 }
 
-bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMetadata& metadata) {
+bool BookMetadataCache::buildBookBin(ZipFile& zip, const BookMetadata& metadata) {
   // Open all three files, writing to meta, reading from spine and toc
   if (!SdMan.openFileForWrite("BMC", cachePath + bookBinFile, bookFile)) {
     return false;
@@ -122,40 +282,33 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
   // LUTs complete
   // Loop through spines from spine file matching up TOC indexes, calculating cumulative size and writing to book.bin
 
-  ZipFile zip(epubPath);
-  // Pre-open zip file to speed up size calculations
-  if (!zip.open()) {
+  // Pre-open zip file to speed up size calculations, unless the caller already holds it open
+  const bool zipWasOpen = zip.isOpen();
+  if (!zipWasOpen && !zip.open()) {
     Serial.printf("[%lu] [BMC] Could not open EPUB zip for size calculations\n", millis());
     bookFile.close();
     spineFile.close();
     tocFile.close();
     return false;
   }
-  // TODO: For large ZIPs loading the all localHeaderOffsets will crash.
-  //       However not having them loaded is extremely slow. Need a better solution here.
-  //       Perhaps only a cache of spine items or a better way to speedup lookups?
-  if (!zip.loadAllFileStatSlims()) {
-    Serial.printf("[%lu] [BMC] Could not load zip local header offsets for size calculations\n", millis());
-    bookFile.close();
-    spineFile.close();
-    tocFile.close();
-    zip.close();
-    return false;
-  }
+  // TOC entries pointing at spine items, sorted by spine index then TOC index, so the first one for each spine item
+  // is met walking both in order
+  FsFile linksFile;
+  const bool hasLinks = !tocLinksPath.empty() && SdMan.openFileForRead("BMC", tocLinksPath, linksFile);
+  RecordReader<TocLink> links(linksFile, 0, hasLinks ? tocLinkCount : 0);
+  TocLink link;
+  bool hasLink = hasLinks && links.next(&link);
+
   uint32_t cumSize = 0;
   spineFile.seek(0);
   int lastSpineTocIndex = -1;
   for (int i = 0; i < spineCount; i++) {
     auto spineEntry = readSpineEntry(spineFile);
 
-    tocFile.seek(0);
-    for (int j = 0; j < tocCount; j++) {
-      auto tocEntry = readTocEntry(tocFile);
-      if (tocEntry.spineIndex == i) {
-        spineEntry.tocIndex = j;
-        break;
-      }
+    while (hasLink && link.spineIndex < i) {
+      hasLink = links.next(&link);
     }
+    spineEntry.tocIndex = hasLink && link.spineIndex == i ? static_cast<int16_t>(link.tocIndex) : -1;
 
     // Not a huge deal if we don't fine a TOC entry for the spine entry, this is expected behaviour for EPUBs
     // Logging here is for debugging
@@ -181,7 +334,12 @@ bool BookMetadataCache::buildBookBin(const std::string& epubPath, const BookMeta
     writeSpineEntry(bookFile, spineEntry);
   }
   // Close opened zip file
-  zip.close();
+  if (!zipWasOpen) {
+    zip.close();
+  }
+  if (hasLinks) {
+    linksFile.close();
+  }
 
   // Loop through toc entries from toc file writing to book.bin
   tocFile.seek(0);
@@ -205,6 +363,13 @@ bool BookMetadataCache::cleanupTmpFiles() const {
   if (SdMan.exists((cachePath + tmpTocBinFile).c_str())) {
     SdMan.remove((cachePath + tmpTocBinFile).c_str());
   }
+  for (const char* keysFile : {tmpSpineKeysFile, tmpTocKeysFile, tmpTocLinksFile}) {
+    for (const auto& path : {cachePath + keysFile, cachePath + keysFile + sortScratchSuffix}) {
+      if (SdMan.exists(path.c_str())) {
+        SdMan.remove(path.c_str());
+      }
+    }
+  }
   return true;
 }
 
@@ -239,6 +404,7 @@ void BookMetadataCache::createSpineEntry(const std::string& href) {
   spineCount++;
 }
 
+// Spine index is resolved for all TOC entries at once in `endTocPass`
 void BookMetadataCache::createTocEntry(const std::string& title, const std::string& href, const std::string& anchor,
                                        const uint8_t level) {
   if (!buildMode || !tocFile || !spineFile) {
@@ -246,26 +412,132 @@ void BookMetadataCache::createTocEntry(const std::string& title, const std::stri
     return;
   }
 
-  int spineIndex = -1;
-  // find spine index
-  // TODO: This lookup is slow as need to scan through all items each time. We can't hold it all in memory due to size.
-  //       But perhaps we can load just the hrefs in a vector/list to do an index lookup?
-  spineFile.seek(0);
-  for (int i = 0; i < spineCount; i++) {
-    auto spineEntry = readSpineEntry(spineFile);
-    if (spineEntry.href == href) {
-      spineIndex = i;
-      break;
-    }
+  const TocEntry entry(title, href, anchor, level, -1);
+  writeTocEntry(tocFile, entry);
+  tocCount++;
+}
+
+// Sets each TOC entry's spine index to the first spine item with the same href, patching toc.bin.tmp in place, and
+// leaves the TOC entries sorted by spine index for buildBookBin. Both lists are keyed by href hash into record files
+// that are sorted on SD and merged in one pass, so with n spine and m TOC entries this reads O((n + m) log(n + m))
+// bytes and holds at most SORT_RUN_RECORDS records in RAM. Hrefs are compared in full only where hashes match.
+void BookMetadataCache::resolveTocSpineIndexes() {
+  tocLinksPath.clear();
+  if (tocCount == 0) {
+    return;
   }
 
-  if (spineIndex == -1) {
-    Serial.printf("[%lu] [BMC] addTocEntry: Could not find spine item for TOC href %s\n", millis(), href.c_str());
+  const std::string spineKeysPath = cachePath + tmpSpineKeysFile;
+  const std::string tocKeysPath = cachePath + tmpTocKeysFile;
+  FsFile keysFile;
+  if (!SdMan.openFileForWrite("BMC", spineKeysPath, keysFile)) {
+    return;
+  }
+  {
+    RecordWriter<HrefKey> writer(keysFile);
+    spineFile.seek(0);
+    for (uint16_t i = 0; i < spineCount; i++) {
+      const uint32_t pos = spineFile.position();
+      writer.add({FsHelpers::fnv1a32(readSpineEntry(spineFile).href), pos, i});
+    }
+    writer.flush();
+  }
+  keysFile.close();
+  if (!SdMan.openFileForWrite("BMC", tocKeysPath, keysFile)) {
+    return;
+  }
+  {
+    RecordWriter<HrefKey> writer(keysFile);
+    tocFile.seek(0);
+    for (uint16_t j = 0; j < tocCount; j++) {
+      const uint32_t pos = tocFile.position();
+      writer.add({FsHelpers::fnv1a32(readTocEntry(tocFile).href), pos, j});
+    }
+    writer.flush();
+  }
+  keysFile.close();
+
+  const std::string sortedSpinePath = sortRecordFile<HrefKey>(spineKeysPath, spineCount, byHashThenIndex);
+  const std::string sortedTocPath = sortRecordFile<HrefKey>(tocKeysPath, tocCount, byHashThenIndex);
+  FsFile sortedSpine;
+  FsFile sortedToc;
+  FsFile linksFile;
+  const std::string linksPath = cachePath + tmpTocLinksFile;
+  if (sortedSpinePath.empty() || sortedTocPath.empty() || !SdMan.openFileForRead("BMC", sortedSpinePath, sortedSpine) ||
+      !SdMan.openFileForRead("BMC", sortedTocPath, sortedToc) ||
+      !SdMan.openFileForWrite("BMC", linksPath, linksFile)) {
+    Serial.printf("[%lu] [BMC] Could not sort spine and TOC hrefs, TOC entries left without spine items\n", millis());
+    sortedSpine.close();
+    sortedToc.close();
+    return;
   }
 
-  const TocEntry entry(title, href, anchor, level, spineIndex);
-  writeTocEntry(tocFile, entry);
-  tocCount++;
+  // Both streams are in hash order, so the spine items sharing a TOC entry's hash are the ones read since the hash
+  // changed, in spine order. Real collisions are rare, the group is nearly always one item.
+  RecordReader<HrefKey> spineKeys(sortedSpine, 0, spineCount);
+  RecordReader<HrefKey> tocKeys(sortedToc, 0, tocCount);
+  RecordWriter<TocLink> links(linksFile);
+  uint32_t linkCount = 0;
+  std::vector<HrefKey> group;
+  HrefKey spineKey;
+  bool hasSpineKey = spineKeys.next(&spineKey);
+  HrefKey tocKey;
+  std::string spineHref;
+  // The last href resolved, as TOC entries for the same chapter follow each other in hash order
+  std::string lastHref;
+  int16_t lastSpineIndex = -1;
+  while (tocKeys.next(&tocKey)) {
+    if (group.empty() || group.front().hrefHash != tocKey.hrefHash) {
+      group.clear();
+      lastHref.clear();
+      while (hasSpineKey && spineKey.hrefHash < tocKey.hrefHash) {
+        hasSpineKey = spineKeys.next(&spineKey);
+      }
+      while (hasSpineKey && spineKey.hrefHash == tocKey.hrefHash) {
+        group.push_back(spineKey);
+        hasSpineKey = spineKeys.next(&spineKey);
+      }
+    }
+
+    tocFile.seek(tocKey.filePos);
+    const auto tocEntry = readTocEntry(tocFile);
+    int16_t spineIndex = -1;
+    if (!lastHref.empty() && tocEntry.href == lastHref) {
+      spineIndex = lastSpineIndex;
+    } else {
+      for (const auto& candidate : group) {
+        spineFile.seek(candidate.filePos);
+        serialization::readString(spineFile, spineHref);
+        if (spineHref == tocEntry.href) {
+          spineIndex = static_cast<int16_t>(candidate.index);
+          lastHref = tocEntry.href;
+          lastSpineIndex = spineIndex;
+          break;
+        }
+      }
+    }
+
+    if (spineIndex == -1) {
+      Serial.printf("[%lu] [BMC] addTocEntry: Could not find spine item for TOC href %s\n", millis(),
+                    tocEntry.href.c_str());
+      continue;
+    }
+
+    // spineIndex is the last field of the entry
+    tocFile.seek(tocFile.position() - sizeof(spineIndex));
+    serialization::writePod(tocFile, spineIndex);
+    links.add({static_cast<uint16_t>(spineIndex), tocKey.index});
+    linkCount++;
+  }
+  links.flush();
+  sortedSpine.close();
+  sortedToc.close();
+  linksFile.close();
+  SdMan.remove(sortedSpinePath.c_str());
+  SdMan.remove(sortedTocPath.c_str());
+
+  tocLinksPath = sortRecordFile<TocLink>(linksPath, linkCount, bySpineThenToc);
+  tocLinkCount = linkCount;
 }
 
 /* ============= READING / LOADING FUNCTIONS ================ */
@@ -294,9 +566,60 @@ bool BookMetadataCache::load() {
 
   loaded = true;
   Serial.printf("[%lu] [BMC] Loaded cache data: %d spine, %d TOC entries\n", millis(), spineCount, tocCount);
+  loadRamIndex();
   return true;
 }
 
+bool BookMetadataCache::loadRamIndex() {
+  ramIndexLoaded = false;
+  ramSpine.clear();
+  ramToc.clear();
+  ramStringPool.clear();
+
+  if (ramIndexBudget == 0) {
+    return false;
+  }
+
+  // Entries follow the LUTs, spine entries first, then TOC entries. Their on-disk size bounds the string pool.
+  const uint32_t entriesOffset = lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * tocCount;
+  const size_t entriesSize = bookFile.size() - entriesOffset;
+  const size_t recordsSize = sizeof(SpineRecord) * spineCount + sizeof(TocRecord) * tocCount;
+  if (recordsSize + entriesSize > ramIndexBudget) {
+    Serial.printf("[%lu] [BMC] Spine/TOC too large for RAM index (%u > %u bytes), reading from SD\n", millis(),
+                  recordsSize + entriesSize, ramIndexBudget);
+    return false;
+  }
+
+  ramSpine.reserve(spineCount);
+  ramToc.reserve(tocCount);
+  ramStringPool.reserve(entriesSize);
+
+  bookFile.seek(entriesOffset);
+  for (int i = 0; i < spineCount; i++) {
+    const auto entry = readSpineEntry(bookFile);
+    ramSpine.push_back({addToStringPool(entry.href), static_cast<uint32_t>(entry.cumulativeSize), entry.tocIndex});
+  }
+  for (int i = 0; i < tocCount; i++) {
+    const auto entry = readTocEntry(bookFile);
+    ramToc.push_back({addToStringPool(entry.title), addToStringPool(entry.href), addToStringPool(entry.anchor),
+                      entry.spineIndex, entry.level});
+  }
+
+  ramIndexLoaded = true;
+  Serial.printf("[%lu] [BMC] Loaded RAM index: %u bytes\n", millis(), recordsSize + ramStringPool.size());
+  return true;
+}
+
+BookMetadataCache::PoolString BookMetadataCache::addToStringPool(const std::string& str) {
+  const PoolString poolString{static_cast<uint32_t>(ramStringPool.size()), static_cast<uint16_t>(str.size())};
+  ramStringPool.append(str, 0, poolString.length);
+  return poolString;
+}
+
+std::string BookMetadataCache::fromStringPool(const PoolString& str) const {
+  return ramStringPool.substr(str.offset, str.length);
+}
+
 BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index) {
   if (!loaded) {
     Serial.printf("[%lu] [BMC] getSpineEntry called but cache not loaded\n", millis());
@@ -308,6 +631,11 @@ BookMetadataCache::SpineEntry BookMetadataCache::getSpineEntry(const int index)
     return {};
   }
 
+  if (ramIndexLoaded) {
+    const auto& record = ramSpine[index];
+    return {fromStringPool(record.href), record.cumulativeSize, record.tocIndex};
+  }
+
   // Seek to spine LUT item, read from LUT and get out data
   bookFile.seek(lutOffset + sizeof(uint32_t) * index);
   uint32_t spineEntryPos;
@@ -327,6 +655,12 @@ BookMetadataCache::TocEntry BookMetadataCache::getTocEntry(const int index) {
     return {};
   }
 
+  if (ramIndexLoaded) {
+    const auto& record = ramToc[index];
+    return {fromStringPool(record.title), fromStringPool(record.href), fromStringPool(record.anchor), record.level,
+            record.spineIndex};
+  }
+
   // Seek to TOC LUT item, read from LUT and get out data
   bookFile.seek(lutOffset + sizeof(uint32_t) * spineCount + sizeof(uint32_t) * index);
   uint32_t tocEntryPos;
@@ -3,6 +3,9 @@
 #include <SDCardManager.h>
 
 #include <string>
+#include <vector>
+
+class ZipFile;
 
 class BookMetadataCache {
  public:
@@ -40,28 +43,70 @@ class BookMetadataCache {
   };
 
  private:
+  // RAM index of the spine and TOC entries: fixed width records with their strings in one pool
+  struct PoolString {
+    uint32_t offset;
+    uint16_t length;
+  };
+
+  struct SpineRecord {
+    PoolString href;
+    uint32_t cumulativeSize;
+    int16_t tocIndex;
+  };
+
+  struct TocRecord {
+    PoolString title;
+    PoolString href;
+    PoolString anchor;
+    int16_t spineIndex;
+    uint8_t level;
+  };
+
   std::string cachePath;
-  size_t lutOffset;
+  uint32_t lutOffset;
   uint16_t spineCount;
   uint16_t tocCount;
   bool loaded;
   bool buildMode;
+  size_t ramIndexBudget;
+  bool ramIndexLoaded;
+  std::vector<SpineRecord> ramSpine;
+  std::vector<TocRecord> ramToc;
+  std::string ramStringPool;
 
   FsFile bookFile;
   // Temp file handles during build
   FsFile spineFile;
   FsFile tocFile;
+  // TOC entries by spine index, left on SD by resolveTocSpineIndexes for buildBookBin
+  std::string tocLinksPath;
+  uint32_t tocLinkCount;
 
   uint32_t writeSpineEntry(FsFile& file, const SpineEntry& entry) const;
   uint32_t writeTocEntry(FsFile& file, const TocEntry& entry) const;
   SpineEntry readSpineEntry(FsFile& file) const;
   TocEntry readTocEntry(FsFile& file) const;
+  void resolveTocSpineIndexes();
+  bool loadRamIndex();
+  PoolString addToStringPool(const std::string& str);
+  std::string fromStringPool(const PoolString& str) const;
 
  public:
   BookMetadata coreMetadata;
 
-  explicit BookMetadataCache(std::string cachePath)
-      : cachePath(std::move(cachePath)), lutOffset(0), spineCount(0), tocCount(0), loaded(false), buildMode(false) {}
+  static constexpr size_t DEFAULT_RAM_INDEX_BUDGET = 32 * 1024;
+
+  explicit BookMetadataCache(std::string cachePath, const size_t ramIndexBudget = DEFAULT_RAM_INDEX_BUDGET)
+      : cachePath(std::move(cachePath)),
+        lutOffset(0),
+        spineCount(0),
+        tocCount(0),
+        loaded(false),
+        buildMode(false),
+        ramIndexBudget(ramIndexBudget),
+        ramIndexLoaded(false),
+        tocLinkCount(0) {}
   ~BookMetadataCache() = default;
 
   // Building phase (stream to disk immediately)
@@ -76,9 +121,10 @@ class BookMetadataCache {
   bool cleanupTmpFiles() const;
 
   // Post-processing to update mappings and sizes
-  bool buildBookBin(const std::string& epubPath, const BookMetadata& metadata);
+  bool buildBookBin(ZipFile& zip, const BookMetadata& metadata);
 
   // Reading phase (read mode)
+  // Spine and TOC entries are served from RAM when they fit in the RAM index budget (0 disables it), otherwise from SD
   bool load();
   SpineEntry getSpineEntry(int index);
   TocEntry getTocEntry(int index);
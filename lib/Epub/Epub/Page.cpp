@@ -1,8 +1,19 @@
 #include "Page.h"
 
+#include <GfxRenderer.h>
 #include <HardwareSerial.h>
+#include <SDCardManager.h>
 #include <Serialization.h>
 
+#include <algorithm>
+
+namespace {
+// Image blobs start with their uint16_t width and height
+constexpr uint32_t IMAGE_BLOB_HEADER_SIZE = sizeof(uint16_t) + sizeof(uint16_t);
+// Rows are read and drawn in strips of at most this many bytes
+constexpr size_t IMAGE_STRIP_BYTES = 2048;
+}  // namespace
+
 void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
   block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
 }
@@ -25,6 +36,56 @@ std::unique_ptr<PageLine> PageLine::deserialize(FsFile& file) {
   return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
 }
 
+void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
+  if (!blob && !SdMan.openFileForRead("PGE", blobPath, blob)) {
+    return;
+  }
+
+  const size_t rowBytes = (width + 3) / 4;
+  const int stripRows = std::max<int>(1, IMAGE_STRIP_BYTES / rowBytes);
+  auto* strip = static_cast<uint8_t*>(malloc(stripRows * rowBytes));
+  if (!strip) {
+    Serial.printf("[%lu] [PGE] Failed to allocate image strip buffer\n", millis());
+    return;
+  }
+
+  blob.seek(IMAGE_BLOB_HEADER_SIZE);
+  for (int row = 0; row < height; row += stripRows) {
+    const int rows = std::min(stripRows, height - row);
+    if (blob.read(strip, rows * rowBytes) != static_cast<int>(rows * rowBytes)) {
+      Serial.printf("[%lu] [PGE] Image blob %s is truncated\n", millis(), blobPath.c_str());
+      break;
+    }
+    renderer.drawImageRows(strip, xPos + xOffset, yPos + yOffset + row, width, rows);
+  }
+
+  free(strip);
+}
+
+bool PageImage::serialize(FsFile& file) {
+  serialization::writePod(file, xPos);
+  serialization::writePod(file, yPos);
+  serialization::writePod(file, width);
+  serialization::writePod(file, height);
+  serialization::writeString(file, blobPath);
+  return true;
+}
+
+std::unique_ptr<PageImage> PageImage::deserialize(FsFile& file) {
+  int16_t xPos;
+  int16_t yPos;
+  uint16_t width;
+  uint16_t height;
+  std::string blobPath;
+  serialization::readPod(file, xPos);
+  serialization::readPod(file, yPos);
+  serialization::readPod(file, width);
+  serialization::readPod(file, height);
+  serialization::readString(file, blobPath);
+
+  return std::unique_ptr<PageImage>(new PageImage(std::move(blobPath), width, height, xPos, yPos));
+}
+
 void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
   for (auto& element : elements) {
     element->render(renderer, fontId, xOffset, yOffset);
@@ -36,8 +97,7 @@ bool Page::serialize(FsFile& file) const {
   serialization::writePod(file, count);
 
   for (const auto& el : elements) {
-    // Only PageLine exists currently
-    serialization::writePod(file, static_cast<uint8_t>(TAG_PageLine));
+    serialization::writePod(file, static_cast<uint8_t>(el->getTag()));
     if (!el->serialize(file)) {
       return false;
     }
@@ -59,6 +119,9 @@ std::unique_ptr<Page> Page::deserialize(FsFile& file) {
     if (tag == TAG_PageLine) {
       auto pl = PageLine::deserialize(file);
       page->elements.push_back(std::move(pl));
+    } else if (tag == TAG_PageImage) {
+      auto pi = PageImage::deserialize(file);
+      page->elements.push_back(std::move(pi));
     } else {
       Serial.printf("[%lu] [PGE] Deserialization failed: Unknown tag %u\n", millis(), tag);
       return nullptr;
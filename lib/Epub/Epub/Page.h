@@ -1,6 +1,7 @@
 #pragma once
 #include <SdFat.h>
 
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -8,6 +9,7 @@
 
 enum PageElementTag : uint8_t {
   TAG_PageLine = 1,
+  TAG_PageImage = 2,
 };
 
 // represents something that has been added to a page
@@ -19,6 +21,7 @@ class PageElement {
   virtual ~PageElement() = default;
   virtual void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) = 0;
   virtual bool serialize(FsFile& file) = 0;
+  virtual PageElementTag getTag() const = 0;
 };
 
 // a line from a block element
@@ -30,9 +33,32 @@ class PageLine final : public PageElement {
       : PageElement(xPos, yPos), block(std::move(block)) {}
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
   bool serialize(FsFile& file) override;
+  PageElementTag getTag() const override { return TAG_PageLine; }
   static std::unique_ptr<PageLine> deserialize(FsFile& file);
 };
 
+// an image converted to 2-bit rows in the book cache, streamed from SD when the page is rendered
+class PageImage final : public PageElement {
+  uint16_t width;
+  uint16_t height;
+  std::string blobPath;
+  // Opened on the first render and kept for the grayscale passes that render the page again
+  FsFile blob;
+
+ public:
+  PageImage(std::string blobPath, const uint16_t width, const uint16_t height, const int16_t xPos, const int16_t yPos)
+      : PageElement(xPos, yPos), width(width), height(height), blobPath(std::move(blobPath)) {}
+  ~PageImage() override {
+    if (blob) {
+      blob.close();
+    }
+  }
+  void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) override;
+  bool serialize(FsFile& file) override;
+  PageElementTag getTag() const override { return TAG_PageImage; }
+  static std::unique_ptr<PageImage> deserialize(FsFile& file);
+};
+
 class Page {
  public:
   // the list of block index and line numbers on this page
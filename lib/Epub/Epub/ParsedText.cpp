@@ -4,16 +4,19 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <vector>
 
 constexpr int MAX_COST = std::numeric_limits<int>::max();
 
-void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle) {
-  if (word.empty()) return;
+void ParsedText::addWord(const char* word, const EpdFontFamily::Style fontStyle) {
+  if (*word == '\0') return;
 
-  words.push_back(std::move(word));
+  wordOffsets.push_back(wordChars.size());
+  wordChars.append(word);
+  wordChars.push_back('\0');
   wordStyles.push_back(fontStyle);
 }
 
@@ -21,7 +24,7 @@ void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle)
 void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
                                        const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
                                        const bool includeLastLine) {
-  if (words.empty()) {
+  if (wordOffsets.empty()) {
     return;
   }
 
@@ -34,28 +37,44 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
   for (size_t i = 0; i < lineCount; ++i) {
     extractLine(i, pageWidth, spaceWidth, wordWidths, lineBreakIndices, processLine);
   }
+
+  // Consume the words of the extracted lines
+  eraseWords(lineCount > 0 ? lineBreakIndices[lineCount - 1] : 0);
+}
+
+void ParsedText::eraseWords(const size_t count) {
+  if (count >= wordOffsets.size()) {
+    wordChars.clear();
+    wordOffsets.clear();
+    wordStyles.clear();
+    return;
+  }
+
+  const uint32_t charsConsumed = wordOffsets[count];
+  wordChars.erase(0, charsConsumed);
+  wordOffsets.erase(wordOffsets.begin(), wordOffsets.begin() + count);
+  for (auto& offset : wordOffsets) {
+    offset -= charsConsumed;
+  }
+  wordStyles.erase(wordStyles.begin(), wordStyles.begin() + count);
 }
 
 std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
-  const size_t totalWordCount = words.size();
+  const size_t totalWordCount = wordOffsets.size();
 
   std::vector<uint16_t> wordWidths;
   wordWidths.reserve(totalWordCount);
 
   // add em-space at the beginning of first word in paragraph to indent
   if (!extraParagraphSpacing) {
-    std::string& first_word = words.front();
-    first_word.insert(0, "\xe2\x80\x83");
+    wordChars.insert(0, "\xe2\x80\x83");
+    for (size_t i = 1; i < totalWordCount; i++) {
+      wordOffsets[i] += 3;
+    }
   }
 
-  auto wordsIt = words.begin();
-  auto wordStylesIt = wordStyles.begin();
-
-  while (wordsIt != words.end()) {
-    wordWidths.push_back(renderer.getTextWidth(fontId, wordsIt->c_str(), *wordStylesIt));
-
-    std::advance(wordsIt, 1);
-    std::advance(wordStylesIt, 1);
+  for (size_t i = 0; i < totalWordCount; i++) {
+    wordWidths.push_back(renderer.getTextWidth(fontId, wordChars.c_str() + wordOffsets[i], wordStyles[i]));
   }
 
   return wordWidths;
@@ -63,7 +82,7 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
 
 std::vector<size_t> ParsedText::computeLineBreaks(const int pageWidth, const int spaceWidth,
                                                   const std::vector<uint16_t>& wordWidths) const {
-  const size_t totalWordCount = words.size();
+  const size_t totalWordCount = wordOffsets.size();
 
   // DP table to store the minimum badness (cost) of lines starting at index i
   std::vector<int> dp(totalWordCount);
@@ -142,7 +161,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const int pageWidth, const int
 
 void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
                              const std::vector<uint16_t>& wordWidths, const std::vector<size_t>& lineBreakIndices,
-                             const std::function<void(std::shared_ptr<TextBlock>)>& processLine) {
+                             const std::function<void(std::shared_ptr<TextBlock>)>& processLine) const {
   const size_t lineBreak = lineBreakIndices[breakIndex];
   const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
   const size_t lineWordCount = lineBreak - lastBreakAt;
@@ -171,25 +190,20 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
     xpos = (spareSpace - (lineWordCount - 1) * spaceWidth) / 2;
   }
 
+  const size_t charsStart = wordOffsets[lastBreakAt];
+  const size_t charsEnd = lineBreak < wordOffsets.size() ? wordOffsets[lineBreak] : wordChars.size();
+  auto line = std::make_shared<TextBlock>(lineWordCount, charsEnd - charsStart, style);
+
   // Pre-calculate X positions for words
-  std::list<uint16_t> lineXPos;
+  uint16_t* lineXPos = line->wordXpos();
   for (size_t i = lastBreakAt; i < lineBreak; i++) {
     const uint16_t currentWordWidth = wordWidths[i];
-    lineXPos.push_back(xpos);
+    lineXPos[i - lastBreakAt] = xpos;
     xpos += currentWordWidth + spacing;
   }
 
-  // Iterators always start at the beginning as we are moving content with splice below
-  auto wordEndIt = words.begin();
-  auto wordStyleEndIt = wordStyles.begin();
-  std::advance(wordEndIt, lineWordCount);
-  std::advance(wordStyleEndIt, lineWordCount);
-
-  // *** CRITICAL STEP: CONSUME DATA USING SPLICE ***
-  std::list<std::string> lineWords;
-  lineWords.splice(lineWords.begin(), words, words.begin(), wordEndIt);
-  std::list<EpdFontFamily::Style> lineWordStyles;
-  lineWordStyles.splice(lineWordStyles.begin(), wordStyles, wordStyles.begin(), wordStyleEndIt);
+  std::copy(wordStyles.begin() + lastBreakAt, wordStyles.begin() + lineBreak, line->wordStyles());
+  memcpy(line->wordChars(), wordChars.data() + charsStart, charsEnd - charsStart);
 
-  processLine(std::make_shared<TextBlock>(std::move(lineWords), std::move(lineXPos), std::move(lineWordStyles), style));
+  processLine(std::move(line));
 }
@@ -1,17 +1,28 @@
 #include "Section.h"
 
+#include <FsHelpers.h>
+#include <JpegToBmpConverter.h>
+#include <PngToBmpConverter.h>
 #include <SDCardManager.h>
 #include <Serialization.h>
 
+#include <algorithm>
+
 #include "Page.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 9;
+constexpr uint8_t SECTION_FILE_VERSION = 11;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint32_t);
 }  // namespace
 
+Section::~Section() {
+  if (file) {
+    file.close();
+  }
+}
+
 uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   if (!file) {
     Serial.printf("[%lu] [SCT] File not open for writing page %d\n", millis(), pageCount);
@@ -91,14 +102,43 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
     }
   }
 
+  uint32_t lutOffset;
   serialization::readPod(file, pageCount);
-  file.close();
+  serialization::readPod(file, lutOffset);
+  if (!loadPageLut(lutOffset)) {
+    file.close();
+    Serial.printf("[%lu] [SCT] Deserialization failed: Could not read page LUT\n", millis());
+    clearCache();
+    return false;
+  }
+
+  // The file stays open so page turns only need to seek to the page
   Serial.printf("[%lu] [SCT] Deserialization succeeded: %d pages\n", millis(), pageCount);
   return true;
 }
 
+bool Section::loadPageLut(const uint32_t lutOffset) {
+  pageLut.resize(pageCount);
+  if (pageCount == 0) {
+    return true;
+  }
+
+  const size_t lutSize = pageLut.size() * sizeof(uint32_t);
+  if (lutOffset < HEADER_SIZE || !file.seek(lutOffset) ||
+      file.read(reinterpret_cast<uint8_t*>(pageLut.data()), lutSize) != static_cast<int>(lutSize)) {
+    pageLut.clear();
+    return false;
+  }
+  return true;
+}
+
 // Your updated class method (assuming you are using the 'SD' object, which is a wrapper for a specific filesystem)
-bool Section::clearCache() const {
+bool Section::clearCache() {
+  if (file) {
+    file.close();
+  }
+  pageLut.clear();
+
   if (!SdMan.exists(filePath.c_str())) {
     Serial.printf("[%lu] [SCT] Cache does not exist, no action needed\n", millis());
     return true;
@@ -113,23 +153,10 @@ bool Section::clearCache() const {
   return true;
 }
 
-bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
-                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
-                                const uint16_t viewportHeight, const std::function<void()>& progressSetupFn,
-                                const std::function<void(int)>& progressFn) {
-  constexpr uint32_t MIN_SIZE_FOR_PROGRESS = 50 * 1024;  // 50KB
-  const auto localPath = epub->getSpineItem(spineIndex).href;
-  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
-
-  // Create cache directory if it doesn't exist
-  {
-    const auto sectionsDir = epub->getCachePath() + "/sections";
-    SdMan.mkdir(sectionsDir.c_str());
-  }
-
+bool Section::streamItemToTempFile(const std::string& localPath, const std::string& tmpHtmlPath,
+                                   uint32_t* fileSize) const {
   // Retry logic for SD card timing issues
   bool success = false;
-  uint32_t fileSize = 0;
   for (int attempt = 0; attempt < 3 && !success; attempt++) {
     if (attempt > 0) {
       Serial.printf("[%lu] [SCT] Retrying stream (attempt %d)...\n", millis(), attempt + 1);
@@ -146,7 +173,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
       continue;
     }
     success = epub->readItemContentsToStream(localPath, tmpHtml, 1024);
-    fileSize = tmpHtml.size();
+    *fileSize = tmpHtml.size();
     tmpHtml.close();
 
     // If streaming failed, remove the incomplete file immediately
@@ -156,15 +183,20 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     }
   }
 
-  if (!success) {
-    Serial.printf("[%lu] [SCT] Failed to stream item contents to temp file after retries\n", millis());
-    return false;
-  }
+  return success;
+}
 
-  Serial.printf("[%lu] [SCT] Streamed temp HTML to %s (%d bytes)\n", millis(), tmpHtmlPath.c_str(), fileSize);
+bool Section::buildSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                               const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                               const uint16_t viewportHeight, const size_t contentSize,
+                               const std::function<int(uint8_t*, size_t)>& readContentFn,
+                               const std::function<void()>& progressSetupFn,
+                               const std::function<void(int)>& progressFn, const std::function<bool()>& cancelFn) {
+  const auto chapterHref = epub->getSpineItem(spineIndex).href;
+  constexpr uint32_t MIN_SIZE_FOR_PROGRESS = 50 * 1024;  // 50KB
 
   // Only show progress bar for larger chapters where rendering overhead is worth it
-  if (progressSetupFn && fileSize >= MIN_SIZE_FOR_PROGRESS) {
+  if (progressSetupFn && contentSize >= MIN_SIZE_FOR_PROGRESS) {
     progressSetupFn();
   }
 
@@ -175,16 +207,34 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
                          viewportHeight);
   std::vector<uint32_t> lut = {};
 
+  // Cancellation is surfaced to the parser as a read error, which discards the partial section file below
+  auto cancellableReadFn = [&readContentFn, &cancelFn](uint8_t* buffer, const size_t size) {
+    if (cancelFn && cancelFn()) {
+      return -1;
+    }
+    return readContentFn(buffer, size);
+  };
+
   ChapterHtmlSlimParser visitor(
-      tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
-      viewportHeight,
+      contentSize, cancellableReadFn, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment,
+      viewportWidth, viewportHeight,
       [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      progressFn);
-  success = visitor.parseAndBuildPages();
-
-  SdMan.remove(tmpHtmlPath.c_str());
-  if (!success) {
-    Serial.printf("[%lu] [SCT] Failed to parse XML and build pages\n", millis());
+      progressFn,
+      [this, &chapterHref, &cancelFn, viewportWidth, viewportHeight](const char* src, std::string* blobPath,
+                                                                     uint16_t* width, uint16_t* height) {
+        return prepareImage(chapterHref, src, viewportWidth, viewportHeight, cancelFn, blobPath, width, height);
+      });
+  const bool success = visitor.parseAndBuildPages();
+  // Also checked once parsing is done, a cancel after the last read would otherwise keep a section missing the image
+  // it stopped
+  const bool cancelled = cancelFn && cancelFn();
+
+  if (!success || cancelled) {
+    if (cancelled) {
+      Serial.printf("[%lu] [SCT] Section build cancelled\n", millis());
+    } else {
+      Serial.printf("[%lu] [SCT] Failed to parse XML and build pages\n", millis());
+    }
     file.close();
     SdMan.remove(filePath.c_str());
     return false;
@@ -213,23 +263,175 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   serialization::writePod(file, pageCount);
   serialization::writePod(file, lutOffset);
   file.close();
+
+  // Keep the LUT from the build, the file is reopened for reading on the first page load
+  pageLut = std::move(lut);
+  return true;
+}
+
+bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                                const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                const uint16_t viewportHeight, const std::function<void()>& progressSetupFn,
+                                const std::function<void(int)>& progressFn,
+                                const std::function<bool()>& cancelFn) {
+  const auto localPath = epub->getSpineItem(spineIndex).href;
+
+  // Create cache directories if they don't exist
+  {
+    const auto sectionsDir = epub->getCachePath() + "/sections";
+    SdMan.mkdir(sectionsDir.c_str());
+    const auto imagesDir = epub->getCachePath() + "/images";
+    SdMan.mkdir(imagesDir.c_str());
+  }
+
+  // Inflate the chapter straight into the parser, avoiding a write and read back of the whole chapter on SD
+  const auto buildFromReader = [&](ZipFile::InflateReader& reader) {
+    Serial.printf("[%lu] [SCT] Streaming %s (%d bytes) from zip\n", millis(), localPath.c_str(),
+                  reader.getInflatedSize());
+    chapterReader = &reader;
+    const bool built = buildSectionFile(
+        fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+        reader.getInflatedSize(), [&reader](uint8_t* buffer, const size_t size) { return reader.read(buffer, size); },
+        progressSetupFn, progressFn, cancelFn);
+    chapterReader = nullptr;
+    return built;
+  };
+  bool outOfMemory = false;
+  const bool success = epub->readItemContentsWithReader(localPath, buildFromReader, &outOfMemory);
+  if (!outOfMemory) {
+    return success;
+  }
+
+  // Fall back to staging the chapter on SD if there wasn't enough memory to hold the inflator during parsing
+  Serial.printf("[%lu] [SCT] Not enough memory for zip reader, staging chapter to temp file\n", millis());
+  const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
+  uint32_t fileSize = 0;
+  if (!streamItemToTempFile(localPath, tmpHtmlPath, &fileSize)) {
+    Serial.printf("[%lu] [SCT] Failed to stream item contents to temp file after retries\n", millis());
+    return false;
+  }
+
+  Serial.printf("[%lu] [SCT] Streamed temp HTML to %s (%d bytes)\n", millis(), tmpHtmlPath.c_str(), fileSize);
+
+  FsFile tmpHtml;
+  if (!SdMan.openFileForRead("SCT", tmpHtmlPath, tmpHtml)) {
+    SdMan.remove(tmpHtmlPath.c_str());
+    return false;
+  }
+  const bool tmpSuccess = buildSectionFile(
+      fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight, fileSize,
+      [&tmpHtml](uint8_t* buffer, const size_t size) { return tmpHtml.read(buffer, size); }, progressSetupFn,
+      progressFn, cancelFn);
+  tmpHtml.close();
+  SdMan.remove(tmpHtmlPath.c_str());
+  return tmpSuccess;
+}
+
+bool Section::prepareImage(const std::string& chapterHref, const char* src, const uint16_t maxWidth,
+                           const uint16_t maxHeight, const std::function<bool()>& cancelFn, std::string* blobPath,
+                           uint16_t* width, uint16_t* height) const {
+  std::string imageHref = src;
+  if (imageHref.find("://") != std::string::npos || imageHref.compare(0, 5, "data:") == 0) {
+    return false;
+  }
+  const auto fragmentStart = imageHref.find_first_of("?#");
+  if (fragmentStart != std::string::npos) {
+    imageHref.resize(fragmentStart);
+  }
+  imageHref = FsHelpers::normalisePath(chapterHref.substr(0, chapterHref.find_last_of('/') + 1) + imageHref);
+
+  std::string extension = imageHref.substr(imageHref.find_last_of('.') + 1);
+  std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+  const bool isPng = extension == "png";
+  if (extension != "jpg" && extension != "jpeg" && !isPng) {
+    Serial.printf("[%lu] [SCT] Skipping unsupported image %s\n", millis(), imageHref.c_str());
+    return false;
+  }
+
+  // Blobs are shared by every section showing the image at this size, and kept until the book cache is cleared
+  *blobPath = epub->getCachePath() + "/images/" + std::to_string(std::hash<std::string>{}(imageHref)) + "_" +
+              std::to_string(maxWidth) + "x" + std::to_string(maxHeight) + ".bin";
+
+  FsFile blob;
+  if (SdMan.exists(blobPath->c_str()) && SdMan.openFileForRead("SCT", *blobPath, blob)) {
+    serialization::readPod(blob, *width);
+    serialization::readPod(blob, *height);
+    const size_t blobSize = blob.size();
+    blob.close();
+    // An interrupted conversion leaves the size header with fewer rows than it promises
+    const size_t expectedSize = sizeof(uint16_t) * 2 + static_cast<size_t>((*width + 3) / 4) * *height;
+    if (*width > 0 && *height > 0 && blobSize == expectedSize) {
+      return true;
+    }
+    SdMan.remove(blobPath->c_str());
+  }
+
+  // A cancelled build is abandoned at its next chapter read, skipping the image is enough to get there quickly
+  if (cancelFn && cancelFn()) {
+    return false;
+  }
+
+  // The decoders seek within the image, so stage it on SD. The chapter's zip reader resumes where it left off.
+  const auto tmpImagePath = epub->getCachePath() + "/.tmp_image";
+  FsFile image;
+  if (!SdMan.openFileForWrite("SCT", tmpImagePath, image)) {
+    return false;
+  }
+  // Inflating the image and decoding a PNG each need a 32KB dictionary, park the chapter's on SD until done
+  const auto spillPath = epub->getCachePath() + "/.tmp_inflate";
+  const bool suspended = chapterReader && chapterReader->suspend(spillPath);
+  bool success = epub->readItemContentsToStream(imageHref, image, 1024);
+  image.close();
+
+  int blobWidth = 0;
+  int blobHeight = 0;
+  if (success && SdMan.openFileForRead("SCT", tmpImagePath, image)) {
+    if (SdMan.openFileForWrite("SCT", *blobPath, blob)) {
+      // The converter writes the width and height header itself, so the whole blob goes out in aligned blocks
+      // A cancel stops the conversion between rows, and the partial blob is removed below
+      success = isPng ? PngToBmpConverter::pngFileToGray2Stream(image, blob, maxWidth, maxHeight, &blobWidth,
+                                                                &blobHeight, cancelFn)
+                      : JpegToBmpConverter::jpegFileToGray2Stream(image, blob, maxWidth, maxHeight, &blobWidth,
+                                                                  &blobHeight, cancelFn);
+      blob.close();
+    } else {
+      success = false;
+    }
+    image.close();
+  } else {
+    success = false;
+  }
+  SdMan.remove(tmpImagePath.c_str());
+  // If this fails the chapter's next read fails too, and the section build is abandoned
+  if (suspended && !chapterReader->resume()) {
+    success = false;
+  }
+
+  if (!success || blobWidth <= 0 || blobHeight <= 0) {
+    Serial.printf("[%lu] [SCT] Failed to convert image %s\n", millis(), imageHref.c_str());
+    SdMan.remove(blobPath->c_str());
+    return false;
+  }
+
+  Serial.printf("[%lu] [SCT] Converted image %s to %dx%d\n", millis(), imageHref.c_str(), blobWidth, blobHeight);
+  *width = blobWidth;
+  *height = blobHeight;
   return true;
 }
 
 std::unique_ptr<Page> Section::loadPageFromSectionFile() {
-  if (!SdMan.openFileForRead("SCT", filePath, file)) {
+  if (currentPage < 0 || currentPage >= static_cast<int>(pageLut.size())) {
+    Serial.printf("[%lu] [SCT] Page %d not in LUT of %zu pages\n", millis(), currentPage, pageLut.size());
     return nullptr;
   }
 
-  file.seek(HEADER_SIZE - sizeof(uint32_t));
-  uint32_t lutOffset;
-  serialization::readPod(file, lutOffset);
-  file.seek(lutOffset + sizeof(uint32_t) * currentPage);
-  uint32_t pagePos;
-  serialization::readPod(file, pagePos);
-  file.seek(pagePos);
+  if (!file && !SdMan.openFileForRead("SCT", filePath, file)) {
+    return nullptr;
+  }
 
-  auto page = Page::deserialize(file);
-  file.close();
-  return page;
+  if (!file.seek(pageLut[currentPage])) {
+    Serial.printf("[%lu] [SCT] Failed to seek to page %d\n", millis(), currentPage);
+    return nullptr;
+  }
+  return Page::deserialize(file);
 }
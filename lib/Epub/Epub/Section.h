@@ -1,6 +1,7 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "Epub.h"
 
@@ -12,11 +13,26 @@ class Section {
   const int spineIndex;
   GfxRenderer& renderer;
   std::string filePath;
+  // Written during a build, afterwards kept open for reading pages while this section is current
   FsFile file;
+  // Offset of each page in the section file
+  std::vector<uint32_t> pageLut;
+  // Set while a build streams the chapter from the zip, so image conversion can park its inflate state
+  ZipFile::InflateReader* chapterReader = nullptr;
 
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight);
   uint32_t onPageComplete(std::unique_ptr<Page> page);
+  bool buildSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                        uint16_t viewportWidth, uint16_t viewportHeight, size_t contentSize,
+                        const std::function<int(uint8_t*, size_t)>& readContentFn,
+                        const std::function<void()>& progressSetupFn, const std::function<void(int)>& progressFn,
+                        const std::function<bool()>& cancelFn);
+  bool streamItemToTempFile(const std::string& localPath, const std::string& tmpHtmlPath, uint32_t* fileSize) const;
+  bool prepareImage(const std::string& chapterHref, const char* src, uint16_t maxWidth, uint16_t maxHeight,
+                    const std::function<bool()>& cancelFn, std::string* blobPath, uint16_t* width,
+                    uint16_t* height) const;
+  bool loadPageLut(uint32_t lutOffset);
 
  public:
   uint16_t pageCount = 0;
@@ -27,13 +43,14 @@ class Section {
         spineIndex(spineIndex),
         renderer(renderer),
         filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin") {}
-  ~Section() = default;
+  ~Section();
   bool loadSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                        uint16_t viewportWidth, uint16_t viewportHeight);
-  bool clearCache() const;
+  bool clearCache();
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight,
                          const std::function<void()>& progressSetupFn = nullptr,
-                         const std::function<void(int)>& progressFn = nullptr);
+                         const std::function<void(int)>& progressFn = nullptr,
+                         const std::function<bool()>& cancelFn = nullptr);
   std::unique_ptr<Page> loadPageFromSectionFile();
 };
@@ -0,0 +1,107 @@
+#include "SectionPrebuilder.h"
+
+#include <HardwareSerial.h>
+
+#include "Section.h"
+
+SectionPrebuilder::SectionPrebuilder(const std::shared_ptr<Epub>& epub, GfxRenderer& renderer)
+    : epub(epub), renderer(renderer), cardMutex(xSemaphoreCreateMutex()) {}
+
+SectionPrebuilder::~SectionPrebuilder() {
+  // A task waiting out the idle period sees the cancel within one poll, a building one within a chunk
+  cancelRequested = true;
+  while (isRunning()) {
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+  }
+  vSemaphoreDelete(cardMutex);
+}
+
+void SectionPrebuilder::taskTrampoline(void* param) {
+  auto* self = static_cast<SectionPrebuilder*>(param);
+  self->taskLoop();
+}
+
+void SectionPrebuilder::start(const int index, const Layout& newLayout) {
+  xSemaphoreTake(cardMutex, portMAX_DELAY);
+  spineIndex = index;
+  layout = newLayout;
+  idleStart = millis();
+  cancelRequested = false;
+  if (!taskHandle) {
+    xTaskCreate(&SectionPrebuilder::taskTrampoline, "EpubPrebuildTask",
+                8192,              // Stack size
+                this,              // Parameters
+                tskIDLE_PRIORITY,  // Priority
+                &taskHandle        // Task handle
+    );
+  }
+  // Otherwise a task still waiting out the idle period starts it over and picks up the new spine index
+  xSemaphoreGive(cardMutex);
+}
+
+void SectionPrebuilder::stop() {
+  // The build checks this between chunks of chapter content, so waiting on the mutex is brief
+  cancelRequested = true;
+  xSemaphoreTake(cardMutex, portMAX_DELAY);
+  xSemaphoreGive(cardMutex);
+}
+
+bool SectionPrebuilder::tryLockCard() { return xSemaphoreTake(cardMutex, 0) == pdTRUE; }
+
+void SectionPrebuilder::unlockCard() { xSemaphoreGive(cardMutex); }
+
+bool SectionPrebuilder::isRunning() {
+  xSemaphoreTake(cardMutex, portMAX_DELAY);
+  const bool running = taskHandle != nullptr;
+  xSemaphoreGive(cardMutex);
+  return running;
+}
+
+void SectionPrebuilder::taskLoop() {
+  // Only start once the reader has been idle on the current page for a while
+  while (true) {
+    while (!cancelRequested && millis() - idleStart < IDLE_MS) {
+      vTaskDelay(50 / portTICK_PERIOD_MS);
+    }
+    xSemaphoreTake(cardMutex, portMAX_DELAY);
+    // start may have restarted the idle period while this waited for the mutex
+    if (cancelRequested || millis() - idleStart >= IDLE_MS) {
+      break;
+    }
+    xSemaphoreGive(cardMutex);
+  }
+
+  if (!cancelRequested) {
+    const int index = spineIndex;
+    const Layout buildLayout = layout;
+    buildSection(index + 1, buildLayout);
+    if (!cancelRequested) {
+      buildSection(index - 1, buildLayout);
+    }
+  }
+  taskHandle = nullptr;
+  xSemaphoreGive(cardMutex);
+
+  vTaskDelete(nullptr);
+}
+
+void SectionPrebuilder::buildSection(const int index, const Layout& buildLayout) {
+  if (index < 0 || index >= epub->getSpineItemsCount() || buildLayout.viewportWidth == 0 ||
+      buildLayout.viewportHeight == 0) {
+    return;
+  }
+
+  Section prebuilt(epub, index, renderer);
+  if (prebuilt.loadSectionFile(buildLayout.fontId, buildLayout.lineCompression, buildLayout.extraParagraphSpacing,
+                               buildLayout.paragraphAlignment, buildLayout.viewportWidth, buildLayout.viewportHeight)) {
+    return;
+  }
+
+  Serial.printf("[%lu] [SPB] Prebuilding section %d in background\n", millis(), index);
+  const auto start = millis();
+  if (prebuilt.createSectionFile(buildLayout.fontId, buildLayout.lineCompression, buildLayout.extraParagraphSpacing,
+                                 buildLayout.paragraphAlignment, buildLayout.viewportWidth, buildLayout.viewportHeight,
+                                 nullptr, nullptr, [this] { return cancelRequested.load(); })) {
+    Serial.printf("[%lu] [SPB] Prebuilt section %d in %lums\n", millis(), index, millis() - start);
+  }
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <memory>
+
+#include "Epub.h"
+
+class GfxRenderer;
+
+/**
+ * Builds the sections either side of the one being read in a background task, once the reader has sat on a page for
+ * a while, so turning into the next or previous chapter only loads its section file. The task holds cardMutex (never
+ * the renderer) while it touches the SD card, and a build checks for cancellation between chunks of chapter content.
+ *
+ * Usage:
+ *   SectionPrebuilder prebuilder(epub, renderer);
+ *   prebuilder.start(currentSpineIndex, layout);  // after each page render
+ *   prebuilder.stop();                            // before the reader uses the SD card itself
+ */
+class SectionPrebuilder {
+ public:
+  // How long the reader has to sit on a page before neighbouring sections are built
+  static constexpr unsigned long IDLE_MS = 1500;
+
+  // Section layout settings, the same ones the reader loads sections with
+  struct Layout {
+    int fontId;
+    float lineCompression;
+    bool extraParagraphSpacing;
+    uint8_t paragraphAlignment;
+    uint16_t viewportWidth;
+    uint16_t viewportHeight;
+  };
+
+  SectionPrebuilder(const std::shared_ptr<Epub>& epub, GfxRenderer& renderer);
+  // Cancels any build and waits for the task to exit
+  ~SectionPrebuilder();
+
+  // Disable copy
+  SectionPrebuilder(const SectionPrebuilder&) = delete;
+  SectionPrebuilder& operator=(const SectionPrebuilder&) = delete;
+
+  // Restarts the idle period for the sections either side of spineIndex, starting the task if none is running
+  void start(int spineIndex, const Layout& layout);
+  // Cancels any build, returning once the task no longer touches the SD card
+  void stop();
+  // For SD work that can wait for a build: takes the card only if the task is not using it, give it back with
+  // unlockCard
+  bool tryLockCard();
+  void unlockCard();
+  // Whether the task is still waiting out the idle period or building
+  bool isRunning();
+
+ private:
+  std::shared_ptr<Epub> epub;
+  GfxRenderer& renderer;
+  SemaphoreHandle_t cardMutex;
+  // Only trusted while holding cardMutex, the task clears it under the mutex as it exits
+  TaskHandle_t taskHandle = nullptr;
+  // Written by the caller under cardMutex, read by the task
+  Layout layout = {};
+  std::atomic<bool> cancelRequested{false};
+  std::atomic<int> spineIndex{0};
+  std::atomic<unsigned long> idleStart{0};
+
+  static void taskTrampoline(void* param);
+  void taskLoop();
+  void buildSection(int index, const Layout& buildLayout);
+};
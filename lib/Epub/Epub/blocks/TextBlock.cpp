@@ -3,39 +3,36 @@
 #include <GfxRenderer.h>
 #include <Serialization.h>
 
-void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int x, const int y) const {
-  // Validate iterator bounds before rendering
-  if (words.size() != wordXpos.size() || words.size() != wordStyles.size()) {
-    Serial.printf("[%lu] [TXB] Render skipped: size mismatch (words=%u, xpos=%u, styles=%u)\n", millis(),
-                  (uint32_t)words.size(), (uint32_t)wordXpos.size(), (uint32_t)wordStyles.size());
-    return;
-  }
+#include <cstring>
 
-  auto wordIt = words.begin();
-  auto wordStylesIt = wordStyles.begin();
-  auto wordXposIt = wordXpos.begin();
+TextBlock::TextBlock(const uint16_t wordCount, const size_t wordCharsSize, const Style style)
+    : wordData(new uint8_t[wordCount * (sizeof(uint16_t) + sizeof(EpdFontFamily::Style)) + wordCharsSize]),
+      wordCount(wordCount),
+      style(style) {}
 
-  for (size_t i = 0; i < words.size(); i++) {
-    renderer.drawText(fontId, *wordXposIt + x, y, wordIt->c_str(), true, *wordStylesIt);
+void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int x, const int y) const {
+  const uint16_t* xpos = wordXpos();
+  const EpdFontFamily::Style* styles = wordStyles();
+  const char* word = wordChars();
 
-    std::advance(wordIt, 1);
-    std::advance(wordStylesIt, 1);
-    std::advance(wordXposIt, 1);
+  for (uint16_t i = 0; i < wordCount; i++) {
+    renderer.drawText(fontId, xpos[i] + x, y, word, true, styles[i]);
+    word += strlen(word) + 1;
   }
 }
 
 bool TextBlock::serialize(FsFile& file) const {
-  if (words.size() != wordXpos.size() || words.size() != wordStyles.size()) {
-    Serial.printf("[%lu] [TXB] Serialization failed: size mismatch (words=%u, xpos=%u, styles=%u)\n", millis(),
-                  words.size(), wordXpos.size(), wordStyles.size());
-    return false;
-  }
-
   // Word data
-  serialization::writePod(file, static_cast<uint16_t>(words.size()));
-  for (const auto& w : words) serialization::writeString(file, w);
-  for (auto x : wordXpos) serialization::writePod(file, x);
-  for (auto s : wordStyles) serialization::writePod(file, s);
+  serialization::writePod(file, wordCount);
+  const char* word = wordChars();
+  for (uint16_t i = 0; i < wordCount; i++) {
+    const uint32_t len = strlen(word);
+    serialization::writePod(file, len);
+    file.write(reinterpret_cast<const uint8_t*>(word), len);
+    word += len + 1;
+  }
+  file.write(reinterpret_cast<const uint8_t*>(wordXpos()), wordCount * sizeof(uint16_t));
+  file.write(reinterpret_cast<const uint8_t*>(wordStyles()), wordCount * sizeof(EpdFontFamily::Style));
 
   // Block style
   serialization::writePod(file, style);
@@ -45,9 +42,6 @@ bool TextBlock::serialize(FsFile& file) const {
 
 std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
   uint16_t wc;
-  std::list<std::string> words;
-  std::list<uint16_t> wordXpos;
-  std::list<EpdFontFamily::Style> wordStyles;
   Style style;
 
   // Word count
@@ -59,16 +53,36 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
     return nullptr;
   }
 
+  // Size the word characters first so the whole line fits one allocation
+  const auto wordsStart = file.position();
+  size_t wordCharsSize = 0;
+  for (uint16_t i = 0; i < wc; i++) {
+    uint32_t len;
+    serialization::readPod(file, len);
+    if (len > 0xFFFF || !file.seekCur(len)) {
+      Serial.printf("[%lu] [TXB] Deserialization failed: bad word length %u\n", millis(), len);
+      return nullptr;
+    }
+    wordCharsSize += len + 1;
+  }
+  file.seek(wordsStart);
+
   // Word data
-  words.resize(wc);
-  wordXpos.resize(wc);
-  wordStyles.resize(wc);
-  for (auto& w : words) serialization::readString(file, w);
-  for (auto& x : wordXpos) serialization::readPod(file, x);
-  for (auto& s : wordStyles) serialization::readPod(file, s);
+  auto block = std::unique_ptr<TextBlock>(new TextBlock(wc, wordCharsSize, JUSTIFIED));
+  char* word = block->wordChars();
+  for (uint16_t i = 0; i < wc; i++) {
+    uint32_t len;
+    serialization::readPod(file, len);
+    file.read(reinterpret_cast<uint8_t*>(word), len);
+    word[len] = '\0';
+    word += len + 1;
+  }
+  file.read(reinterpret_cast<uint8_t*>(block->wordXpos()), wc * sizeof(uint16_t));
+  file.read(reinterpret_cast<uint8_t*>(block->wordStyles()), wc * sizeof(EpdFontFamily::Style));
 
   // Block style
   serialization::readPod(file, style);
+  block->setStyle(style);
 
-  return std::unique_ptr<TextBlock>(new TextBlock(std::move(words), std::move(wordXpos), std::move(wordStyles), style));
+  return block;
 }
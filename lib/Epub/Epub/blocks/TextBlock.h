@@ -2,7 +2,6 @@
 #include <EpdFontFamily.h>
 #include <SdFat.h>
 
-#include <list>
 #include <memory>
 #include <string>
 
@@ -19,19 +18,26 @@ class TextBlock final : public Block {
   };
 
  private:
-  std::list<std::string> words;
-  std::list<uint16_t> wordXpos;
-  std::list<EpdFontFamily::Style> wordStyles;
+  // All word data for the line lives in one allocation: the x positions, then the styles, then the NUL terminated
+  // words back to back
+  std::unique_ptr<uint8_t[]> wordData;
+  uint16_t wordCount;
   Style style;
 
  public:
-  explicit TextBlock(std::list<std::string> words, std::list<uint16_t> word_xpos,
-                     std::list<EpdFontFamily::Style> word_styles, const Style style)
-      : words(std::move(words)), wordXpos(std::move(word_xpos)), wordStyles(std::move(word_styles)), style(style) {}
+  explicit TextBlock(uint16_t wordCount, size_t wordCharsSize, Style style);
+  uint16_t* wordXpos() const { return reinterpret_cast<uint16_t*>(wordData.get()); }
+  EpdFontFamily::Style* wordStyles() const {
+    return reinterpret_cast<EpdFontFamily::Style*>(wordData.get() + wordCount * sizeof(uint16_t));
+  }
+  char* wordChars() const {
+    return reinterpret_cast<char*>(wordData.get() + wordCount * (sizeof(uint16_t) + sizeof(EpdFontFamily::Style)));
+  }
+  uint16_t getWordCount() const { return wordCount; }
   ~TextBlock() override = default;
   void setStyle(const Style style) { this->style = style; }
   Style getStyle() const { return style; }
-  bool isEmpty() override { return words.empty(); }
+  bool isEmpty() override { return wordCount == 0; }
   void layout(GfxRenderer& renderer) override {};
   // given a renderer works out where to break the words into lines
   void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
@@ -2,7 +2,6 @@
 
 #include <GfxRenderer.h>
 #include <HardwareSerial.h>
-#include <SDCardManager.h>
 #include <expat.h>
 
 #include "../Page.h"
@@ -40,6 +39,19 @@ bool matches(const char* tag_name, const char* possible_tags[], const int possib
   return false;
 }
 
+EpdFontFamily::Style ChapterHtmlSlimParser::currentFontStyle() const {
+  if (boldUntilDepth < depth && italicUntilDepth < depth) {
+    return EpdFontFamily::BOLD_ITALIC;
+  }
+  if (boldUntilDepth < depth) {
+    return EpdFontFamily::BOLD;
+  }
+  if (italicUntilDepth < depth) {
+    return EpdFontFamily::ITALIC;
+  }
+  return EpdFontFamily::REGULAR;
+}
+
 // start a new text block if needed
 void ChapterHtmlSlimParser::startNewTextBlock(const TextBlock::Style style) {
   if (currentTextBlock) {
@@ -64,7 +76,14 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   }
 
   if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) {
-    // TODO: Start processing image tags
+    if (self->imageFn && atts != nullptr) {
+      for (int i = 0; atts[i]; i += 2) {
+        if (strcmp(atts[i], "src") == 0) {
+          self->addImage(atts[i + 1]);
+          break;
+        }
+      }
+    }
     self->skipUntilDepth = self->depth;
     self->depth += 1;
     return;
@@ -115,14 +134,7 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     return;
   }
 
-  EpdFontFamily::Style fontStyle = EpdFontFamily::REGULAR;
-  if (self->boldUntilDepth < self->depth && self->italicUntilDepth < self->depth) {
-    fontStyle = EpdFontFamily::BOLD_ITALIC;
-  } else if (self->boldUntilDepth < self->depth) {
-    fontStyle = EpdFontFamily::BOLD;
-  } else if (self->italicUntilDepth < self->depth) {
-    fontStyle = EpdFontFamily::ITALIC;
-  }
+  const EpdFontFamily::Style fontStyle = self->currentFontStyle();
 
   for (int i = 0; i < len; i++) {
     if (isWhitespace(s[i])) {
@@ -186,17 +198,8 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
         matches(name, BOLD_TAGS, NUM_BOLD_TAGS) || matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS) || self->depth == 1;
 
     if (shouldBreakText) {
-      EpdFontFamily::Style fontStyle = EpdFontFamily::REGULAR;
-      if (self->boldUntilDepth < self->depth && self->italicUntilDepth < self->depth) {
-        fontStyle = EpdFontFamily::BOLD_ITALIC;
-      } else if (self->boldUntilDepth < self->depth) {
-        fontStyle = EpdFontFamily::BOLD;
-      } else if (self->italicUntilDepth < self->depth) {
-        fontStyle = EpdFontFamily::ITALIC;
-      }
-
       self->partWordBuffer[self->partWordBufferIndex] = '\0';
-      self->currentTextBlock->addWord(self->partWordBuffer, fontStyle);
+      self->currentTextBlock->addWord(self->partWordBuffer, self->currentFontStyle());
       self->partWordBufferIndex = 0;
     }
   }
@@ -230,14 +233,8 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
     return false;
   }
 
-  FsFile file;
-  if (!SdMan.openFileForRead("EHP", filepath, file)) {
-    XML_ParserFree(parser);
-    return false;
-  }
-
-  // Get file size for progress calculation
-  const size_t totalSize = file.size();
+  // Used for progress calculation
+  const size_t totalSize = contentSize;
   size_t bytesRead = 0;
   int lastProgress = -1;
 
@@ -253,19 +250,17 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
       XML_SetCharacterDataHandler(parser, nullptr);
       XML_ParserFree(parser);
-      file.close();
       return false;
     }
 
-    const size_t len = file.read(buf, 1024);
+    const int len = readContentFn(static_cast<uint8_t*>(buf), 1024);
 
-    if (len == 0 && file.available() > 0) {
-      Serial.printf("[%lu] [EHP] File read error\n", millis());
+    if (len < 0 || (len == 0 && bytesRead < totalSize)) {
+      Serial.printf("[%lu] [EHP] Content read error\n", millis());
       XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
       XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
       XML_SetCharacterDataHandler(parser, nullptr);
       XML_ParserFree(parser);
-      file.close();
       return false;
     }
 
@@ -280,7 +275,7 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       }
     }
 
-    done = file.available() == 0;
+    done = bytesRead >= totalSize;
 
     if (XML_ParseBuffer(parser, static_cast<int>(len), done) == XML_STATUS_ERROR) {
       Serial.printf("[%lu] [EHP] Parse error at line %lu:\n%s\n", millis(), XML_GetCurrentLineNumber(parser),
@@ -289,7 +284,6 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
       XML_SetCharacterDataHandler(parser, nullptr);
       XML_ParserFree(parser);
-      file.close();
       return false;
     }
   } while (!done);
@@ -298,7 +292,6 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
   XML_SetCharacterDataHandler(parser, nullptr);
   XML_ParserFree(parser);
-  file.close();
 
   // Process last page if there is still text
   if (currentTextBlock) {
@@ -324,6 +317,41 @@ void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
   currentPageNextY += lineHeight;
 }
 
+void ChapterHtmlSlimParser::addImage(const char* src) {
+  std::string blobPath;
+  uint16_t width = 0;
+  uint16_t height = 0;
+  if (!imageFn(src, &blobPath, &width, &height) || width == 0 || height == 0) {
+    return;
+  }
+
+  // Images sit on their own lines, so lay out the text that came before them first
+  if (partWordBufferIndex > 0) {
+    partWordBuffer[partWordBufferIndex] = '\0';
+    currentTextBlock->addWord(partWordBuffer, currentFontStyle());
+    partWordBufferIndex = 0;
+  }
+  startNewTextBlock(currentTextBlock->getStyle());
+
+  if (!currentPage) {
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+  if (currentPageNextY > 0 && currentPageNextY + height > viewportHeight) {
+    completePageFn(std::move(currentPage));
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+
+  const auto xPos = static_cast<int16_t>((viewportWidth - width) / 2);
+  currentPage->elements.push_back(std::make_shared<PageImage>(std::move(blobPath), width, height, xPos,
+                                                              currentPageNextY));
+  currentPageNextY += height;
+  if (extraParagraphSpacing) {
+    currentPageNextY += static_cast<int>(renderer.getLineHeight(fontId) * lineCompression) / 2;
+  }
+}
+
 void ChapterHtmlSlimParser::makePages() {
   if (!currentTextBlock) {
     Serial.printf("[%lu] [EHP] !! No text block to make pages for !!\n", millis());
@@ -5,6 +5,7 @@
 #include <climits>
 #include <functional>
 #include <memory>
+#include <string>
 
 #include "../ParsedText.h"
 #include "../blocks/TextBlock.h"
@@ -15,10 +16,20 @@ class GfxRenderer;
 #define MAX_WORD_SIZE 200
 
 class ChapterHtmlSlimParser {
-  const std::string& filepath;
+ public:
+  // Reads up to size bytes of chapter content into buffer, returning the bytes read (0 at the end) or -1 on error
+  using ReadContentFn = std::function<int(uint8_t* buffer, size_t size)>;
+  // Prepares the image at src (as written in the chapter) for display, returning false to skip it. On success
+  // blobPath names the 2-bit image blob and width and height give its size, which fits the viewport.
+  using ImageFn = std::function<bool(const char* src, std::string* blobPath, uint16_t* width, uint16_t* height)>;
+
+ private:
+  size_t contentSize;
+  ReadContentFn readContentFn;
   GfxRenderer& renderer;
   std::function<void(std::unique_ptr<Page>)> completePageFn;
   std::function<void(int)> progressFn;  // Progress callback (0-100)
+  ImageFn imageFn;                      // Images are skipped when not set
   int depth = 0;
   int skipUntilDepth = INT_MAX;
   int boldUntilDepth = INT_MAX;
@@ -37,21 +48,24 @@ class ChapterHtmlSlimParser {
   uint16_t viewportWidth;
   uint16_t viewportHeight;
 
+  EpdFontFamily::Style currentFontStyle() const;
   void startNewTextBlock(TextBlock::Style style);
   void makePages();
+  void addImage(const char* src);
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
   static void XMLCALL endElement(void* userData, const XML_Char* name);
 
  public:
-  explicit ChapterHtmlSlimParser(const std::string& filepath, GfxRenderer& renderer, const int fontId,
-                                 const float lineCompression, const bool extraParagraphSpacing,
+  explicit ChapterHtmlSlimParser(const size_t contentSize, ReadContentFn readContentFn, GfxRenderer& renderer,
+                                 const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                  const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                  const uint16_t viewportHeight,
                                  const std::function<void(std::unique_ptr<Page>)>& completePageFn,
-                                 const std::function<void(int)>& progressFn = nullptr)
-      : filepath(filepath),
+                                 const std::function<void(int)>& progressFn = nullptr, ImageFn imageFn = nullptr)
+      : contentSize(contentSize),
+        readContentFn(std::move(readContentFn)),
         renderer(renderer),
         fontId(fontId),
         lineCompression(lineCompression),
@@ -60,7 +74,8 @@ class ChapterHtmlSlimParser {
         viewportWidth(viewportWidth),
         viewportHeight(viewportHeight),
         completePageFn(completePageFn),
-        progressFn(progressFn) {}
+        progressFn(progressFn),
+        imageFn(std::move(imageFn)) {}
   ~ChapterHtmlSlimParser() = default;
   bool parseAndBuildPages();
   void addLineToPage(std::shared_ptr<TextBlock> line);
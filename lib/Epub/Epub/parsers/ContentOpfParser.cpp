@@ -9,6 +9,7 @@
 namespace {
 constexpr char MEDIA_TYPE_NCX[] = "application/x-dtbncx+xml";
 constexpr char itemCacheFile[] = "/.items.bin";
+constexpr char itemIndexFile[] = "/.items.idx";
 }  // namespace
 
 bool ContentOpfParser::setup() {
@@ -35,9 +36,111 @@ ContentOpfParser::~ContentOpfParser() {
   if (tempItemStore) {
     tempItemStore.close();
   }
+  if (tempItemIndex) {
+    tempItemIndex.close();
+  }
   if (SdMan.exists((cachePath + itemCacheFile).c_str())) {
     SdMan.remove((cachePath + itemCacheFile).c_str());
   }
+  if (SdMan.exists((cachePath + itemIndexFile).c_str())) {
+    SdMan.remove((cachePath + itemIndexFile).c_str());
+  }
+}
+
+// Builds an open-addressed (linear probing) hash table over the manifest items, keyed on item id.
+// Each slot holds the offset of the item in the item store + 1, with 0 marking an empty slot.
+// The table is assembled in RAM (4 bytes per slot) and then spilled to SD for the spine pass.
+bool ContentOpfParser::buildItemIndex() {
+  itemIndexSlots = 0;
+  if (itemCount == 0) {
+    return false;
+  }
+
+  // Keep load factor under ~0.7
+  uint32_t slotCount = 1;
+  while (slotCount < itemCount + itemCount / 2) {
+    slotCount <<= 1;
+  }
+
+  const auto slots = static_cast<uint32_t*>(calloc(slotCount, sizeof(uint32_t)));
+  if (!slots) {
+    Serial.printf("[%lu] [COF] Couldn't allocate memory for item index (%d slots), using linear lookup\n", millis(),
+                  slotCount);
+    return false;
+  }
+
+  if (!SdMan.openFileForRead("COF", cachePath + itemCacheFile, tempItemStore)) {
+    free(slots);
+    return false;
+  }
+
+  std::string itemId;
+  std::string href;
+  while (tempItemStore.available()) {
+    const uint32_t itemPos = tempItemStore.position();
+    serialization::readString(tempItemStore, itemId);
+    serialization::readString(tempItemStore, href);
+
+    uint32_t slot = FsHelpers::fnv1a32(itemId) & (slotCount - 1);
+    while (slots[slot] != 0) {
+      slot = (slot + 1) & (slotCount - 1);
+    }
+    slots[slot] = itemPos + 1;
+  }
+  tempItemStore.close();
+
+  if (!SdMan.openFileForWrite("COF", cachePath + itemIndexFile, tempItemIndex)) {
+    free(slots);
+    return false;
+  }
+  const size_t indexBytes = slotCount * sizeof(uint32_t);
+  const size_t written = tempItemIndex.write(reinterpret_cast<const uint8_t*>(slots), indexBytes);
+  tempItemIndex.close();
+  free(slots);
+
+  if (written != indexBytes) {
+    Serial.printf("[%lu] [COF] Couldn't write item index, using linear lookup\n", millis());
+    return false;
+  }
+
+  itemIndexSlots = slotCount;
+  return true;
+}
+
+bool ContentOpfParser::findItemHref(const std::string& itemId, std::string& href) {
+  std::string storedItemId;
+
+  if (itemIndexSlots > 0 && tempItemIndex) {
+    uint32_t slot = FsHelpers::fnv1a32(itemId) & (itemIndexSlots - 1);
+    for (uint32_t probes = 0; probes < itemIndexSlots; probes++) {
+      uint32_t itemPosPlusOne;
+      tempItemIndex.seek(slot * sizeof(uint32_t));
+      serialization::readPod(tempItemIndex, itemPosPlusOne);
+      if (itemPosPlusOne == 0) {
+        return false;
+      }
+
+      tempItemStore.seek(itemPosPlusOne - 1);
+      serialization::readString(tempItemStore, storedItemId);
+      if (storedItemId == itemId) {
+        serialization::readString(tempItemStore, href);
+        return true;
+      }
+      slot = (slot + 1) & (itemIndexSlots - 1);
+    }
+    return false;
+  }
+
+  // Fall back to scanning the whole item store
+  tempItemStore.seek(0);
+  while (tempItemStore.available()) {
+    serialization::readString(tempItemStore, storedItemId);
+    serialization::readString(tempItemStore, href);
+    if (storedItemId == itemId) {
+      return true;
+    }
+  }
+  return false;
 }
 
 size_t ContentOpfParser::write(const uint8_t data) { return write(&data, 1); }
@@ -124,6 +227,10 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
           "[%lu] [COF] Couldn't open temp items file for reading. This is probably going to be a fatal error.\n",
           millis());
     }
+    if (self->itemIndexSlots > 0 &&
+        !SdMan.openFileForRead("COF", self->cachePath + itemIndexFile, self->tempItemIndex)) {
+      Serial.printf("[%lu] [COF] Couldn't open temp item index for reading, using linear lookup\n", millis());
+    }
     return;
   }
 
@@ -178,6 +285,7 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
     // Write items down to SD card
     serialization::writeString(self->tempItemStore, itemId);
     serialization::writeString(self->tempItemStore, href);
+    self->itemCount++;
 
     if (itemId == self->coverItemId) {
       self->coverItemHref = href;
@@ -210,19 +318,10 @@ void XMLCALL ContentOpfParser::startElement(void* userData, const XML_Char* name
       for (int i = 0; atts[i]; i += 2) {
         if (strcmp(atts[i], "idref") == 0) {
           const std::string idref = atts[i + 1];
-          // Resolve the idref to href using items map
-          // TODO: This lookup is slow as need to scan through all items each time.
-          //       It can take up to 200ms per item when getting to 1500 items.
-          self->tempItemStore.seek(0);
-          std::string itemId;
+          // Resolve the idref to href using the item index
           std::string href;
-          while (self->tempItemStore.available()) {
-            serialization::readString(self->tempItemStore, itemId);
-            serialization::readString(self->tempItemStore, href);
-            if (itemId == idref) {
-              self->cache->createSpineEntry(href);
-              break;
-            }
+          if (self->findItemHref(idref, href)) {
+            self->cache->createSpineEntry(href);
           }
         }
       }
@@ -275,6 +374,9 @@ void XMLCALL ContentOpfParser::endElement(void* userData, const XML_Char* name)
   if (self->state == IN_SPINE && (strcmp(name, "spine") == 0 || strcmp(name, "opf:spine") == 0)) {
     self->state = IN_PACKAGE;
     self->tempItemStore.close();
+    if (self->tempItemIndex) {
+      self->tempItemIndex.close();
+    }
     return;
   }
 
@@ -287,6 +389,7 @@ void XMLCALL ContentOpfParser::endElement(void* userData, const XML_Char* name)
   if (self->state == IN_MANIFEST && (strcmp(name, "manifest") == 0 || strcmp(name, "opf:manifest") == 0)) {
     self->state = IN_PACKAGE;
     self->tempItemStore.close();
+    self->buildItemIndex();
     return;
   }
 
@@ -25,8 +25,14 @@ class ContentOpfParser final : public Print {
   ParserState state = START;
   BookMetadataCache* cache;
   FsFile tempItemStore;
+  FsFile tempItemIndex;
+  uint32_t itemCount = 0;
+  uint32_t itemIndexSlots = 0;
   std::string coverItemId;
 
+  bool buildItemIndex();
+  bool findItemHref(const std::string& itemId, std::string& href);
+
   static void startElement(void* userData, const XML_Char* name, const XML_Char** atts);
   static void characterData(void* userData, const XML_Char* s, int len);
   static void endElement(void* userData, const XML_Char* name);
@@ -37,3 +37,14 @@ std::string FsHelpers::normalisePath(const std::string& path) {
 
   return result;
 }
+
+uint32_t FsHelpers::fnv1a32(const char* str) {
+  uint32_t hash = 2166136261u;
+  while (*str) {
+    hash ^= static_cast<uint8_t>(*str++);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+uint32_t FsHelpers::fnv1a32(const std::string& str) { return fnv1a32(str.c_str()); }
@@ -1,7 +1,11 @@
 #pragma once
+#include <cstdint>
 #include <string>
 
 class FsHelpers {
  public:
   static std::string normalisePath(const std::string& path);
+  // 32-bit FNV-1a, for the path and id hashes kept in indexes on SD and in RAM
+  static uint32_t fnv1a32(const char* str);
+  static uint32_t fnv1a32(const std::string& str);
 };
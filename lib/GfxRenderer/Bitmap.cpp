@@ -1,5 +1,6 @@
 #include "Bitmap.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -12,6 +13,7 @@ constexpr bool USE_ATKINSON = true;  // Use Atkinson dithering instead of Floyd-
 // ============================================================================
 
 Bitmap::~Bitmap() {
+  free(blockBuffer);
   delete[] errorCurRow;
   delete[] errorNextRow;
 
@@ -19,28 +21,40 @@ Bitmap::~Bitmap() {
   delete fsDitherer;
 }
 
-uint16_t Bitmap::readLE16(FsFile& f) {
-  const int c0 = f.read();
-  const int c1 = f.read();
-  const auto b0 = static_cast<uint8_t>(c0 < 0 ? 0 : c0);
-  const auto b1 = static_cast<uint8_t>(c1 < 0 ? 0 : c1);
-  return static_cast<uint16_t>(b0) | (static_cast<uint16_t>(b1) << 8);
-}
+namespace {
+constexpr int FILE_HEADER_SIZE = 14;
+constexpr int INFO_HEADER_SIZE = 40;
+constexpr int SECTOR_SIZE = 512;
+// Read-ahead on top of one row, rows are taken from whole sectors wherever possible
+constexpr int BLOCK_READ_BYTES = 4096;
 
-uint32_t Bitmap::readLE32(FsFile& f) {
-  const int c0 = f.read();
-  const int c1 = f.read();
-  const int c2 = f.read();
-  const int c3 = f.read();
+uint16_t readLE16(const uint8_t* p) { return static_cast<uint16_t>(p[0] | p[1] << 8); }
 
-  const auto b0 = static_cast<uint8_t>(c0 < 0 ? 0 : c0);
-  const auto b1 = static_cast<uint8_t>(c1 < 0 ? 0 : c1);
-  const auto b2 = static_cast<uint8_t>(c2 < 0 ? 0 : c2);
-  const auto b3 = static_cast<uint8_t>(c3 < 0 ? 0 : c3);
+uint32_t readLE32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
 
-  return static_cast<uint32_t>(b0) | (static_cast<uint32_t>(b1) << 8) | (static_cast<uint32_t>(b2) << 16) |
-         (static_cast<uint32_t>(b3) << 24);
+// Packs 2-bit colors 4 to a byte. Colors are fetched strictly left to right, the ditherers depend on it.
+template <typename ColorAt>
+void packPixels(uint8_t* data, const int width, ColorAt colorAt) {
+  int x = 0;
+  for (; x + 4 <= width; x += 4) {
+    uint8_t packed = colorAt(x) << 6;
+    packed |= colorAt(x + 1) << 4;
+    packed |= colorAt(x + 2) << 2;
+    packed |= colorAt(x + 3);
+    *data++ = packed;
+  }
+  if (x < width) {
+    uint8_t packed = 0;
+    for (int shift = 6; x < width; x++, shift -= 2) {
+      packed |= colorAt(x) << shift;
+    }
+    *data = packed;
+  }
 }
+}  // namespace
 
 const char* Bitmap::errorToString(BmpReaderError err) {
   switch (err) {
@@ -84,25 +98,29 @@ BmpReaderError Bitmap::parseHeaders() {
   if (!file) return BmpReaderError::FileInvalid;
   if (!file.seek(0)) return BmpReaderError::SeekStartFailed;
 
+  // Both headers in one read, a short file reads as zeros like past its end
+  uint8_t header[FILE_HEADER_SIZE + INFO_HEADER_SIZE] = {};
+  file.read(header, sizeof(header));
+
   // --- BMP FILE HEADER ---
-  const uint16_t bfType = readLE16(file);
+  const uint16_t bfType = readLE16(header);
   if (bfType != 0x4D42) return BmpReaderError::NotBMP;
 
-  file.seekCur(8);
-  bfOffBits = readLE32(file);
+  bfOffBits = readLE32(header + 10);
 
   // --- DIB HEADER ---
-  const uint32_t biSize = readLE32(file);
+  const uint8_t* dib = header + FILE_HEADER_SIZE;
+  const uint32_t biSize = readLE32(dib);
   if (biSize < 40) return BmpReaderError::DIBTooSmall;
 
-  width = static_cast<int32_t>(readLE32(file));
-  const auto rawHeight = static_cast<int32_t>(readLE32(file));
+  width = static_cast<int32_t>(readLE32(dib + 4));
+  const auto rawHeight = static_cast<int32_t>(readLE32(dib + 8));
   topDown = rawHeight < 0;
   height = topDown ? -rawHeight : rawHeight;
 
-  const uint16_t planes = readLE16(file);
-  bpp = readLE16(file);
-  const uint32_t comp = readLE32(file);
+  const uint16_t planes = readLE16(dib + 12);
+  bpp = readLE16(dib + 14);
+  const uint32_t comp = readLE32(dib + 16);
   const bool validBpp = bpp == 1 || bpp == 2 || bpp == 8 || bpp == 24 || bpp == 32;
 
   if (planes != 1) return BmpReaderError::BadPlanes;
@@ -110,10 +128,9 @@ BmpReaderError Bitmap::parseHeaders() {
   // Allow BI_RGB (0) for all, and BI_BITFIELDS (3) for 32bpp which is common for BGRA masks.
   if (!(comp == 0 || (bpp == 32 && comp == 3))) return BmpReaderError::UnsupportedCompression;
 
-  file.seekCur(12);  // biSizeImage, biXPelsPerMeter, biYPelsPerMeter
-  const uint32_t colorsUsed = readLE32(file);
+  // Skipped: biSizeImage, biXPelsPerMeter, biYPelsPerMeter, and biClrImportant after colorsUsed
+  const uint32_t colorsUsed = readLE32(dib + 32);
   if (colorsUsed > 256u) return BmpReaderError::PaletteTooLarge;
-  file.seekCur(4);  // biClrImportant
 
   if (width <= 0 || height <= 0) return BmpReaderError::BadDimensions;
 
@@ -129,16 +146,25 @@ BmpReaderError Bitmap::parseHeaders() {
 
   for (int i = 0; i < 256; i++) paletteLum[i] = static_cast<uint8_t>(i);
   if (colorsUsed > 0) {
-    for (uint32_t i = 0; i < colorsUsed; i++) {
-      uint8_t rgb[4];
-      file.read(rgb, 4);  // Read B, G, R, Reserved in one go
-      paletteLum[i] = (77u * rgb[2] + 150u * rgb[1] + 29u * rgb[0]) >> 8;
+    // The palette follows the DIB header, which is longer than 40 bytes in V4 and V5 files
+    if (!file.seek(FILE_HEADER_SIZE + biSize)) return BmpReaderError::PaletteTooLarge;
+    uint8_t entries[64];
+    for (uint32_t first = 0; first < colorsUsed; first += sizeof(entries) / 4) {
+      const uint32_t count = std::min<uint32_t>(colorsUsed - first, sizeof(entries) / 4);
+      memset(entries, 0, sizeof(entries));
+      file.read(entries, count * 4);
+      for (uint32_t i = 0; i < count; i++) {
+        const uint8_t* rgb = entries + i * 4;  // B, G, R, Reserved
+        paletteLum[first + i] = (77u * rgb[2] + 150u * rgb[1] + 29u * rgb[0]) >> 8;
+      }
     }
   }
 
   if (!file.seek(bfOffBits)) {
     return BmpReaderError::SeekPixelDataFailed;
   }
+  filePosition = bfOffBits;
+  blockStart = blockEnd = 0;
 
   // Create ditherer if enabled (only for 2-bit output)
   // Use OUTPUT dimensions for dithering (after prescaling)
@@ -153,83 +179,90 @@ BmpReaderError Bitmap::parseHeaders() {
   return BmpReaderError::Ok;
 }
 
-// packed 2bpp output, 0 = black, 1 = dark gray, 2 = light gray, 3 = white
-BmpReaderError Bitmap::readNextRow(uint8_t* data, uint8_t* rowBuffer) const {
-  // Note: rowBuffer should be pre-allocated by the caller to size 'rowBytes'
-  if (file.read(rowBuffer, rowBytes) != rowBytes) return BmpReaderError::ShortReadRow;
+const uint8_t* Bitmap::nextRawRow() const {
+  if (blockEnd - blockStart < rowBytes) {
+    const int kept = blockEnd - blockStart;
+    memmove(blockBuffer, blockBuffer + blockStart, kept);
+    blockStart = 0;
+    blockEnd = kept;
+
+    // Stop on a sector boundary, so after the first block every read covers whole sectors, which SdFat reads
+    // straight into the buffer
+    int toRead = blockCapacity - kept;
+    toRead -= static_cast<int>((filePosition + toRead) % SECTOR_SIZE);
+    const int bytesRead = file.read(blockBuffer + kept, toRead);
+    if (bytesRead > 0) {
+      blockEnd += bytesRead;
+      filePosition += bytesRead;
+    }
+    if (blockEnd < rowBytes) return nullptr;
+  }
 
-  prevRowY += 1;
+  const uint8_t* row = blockBuffer + blockStart;
+  blockStart += rowBytes;
+  return row;
+}
 
-  uint8_t* outPtr = data;
-  uint8_t currentOutByte = 0;
-  int bitShift = 6;
-  int currentX = 0;
-
-  // Helper lambda to pack 2bpp color into the output stream
-  auto packPixel = [&](const uint8_t lum) {
-    uint8_t color;
-    if (atkinsonDitherer) {
-      color = atkinsonDitherer->processPixel(adjustPixel(lum), currentX);
-    } else if (fsDitherer) {
-      color = fsDitherer->processPixel(adjustPixel(lum), currentX);
-    } else {
-      if (bpp > 2) {
-        // Simple quantization or noise dithering
-        color = quantize(adjustPixel(lum), currentX, prevRowY);
-      } else {
-        // do not quantize 2bpp image
-        color = static_cast<uint8_t>(lum >> 6);
-      }
-    }
-    currentOutByte |= (color << bitShift);
-    if (bitShift == 0) {
-      *outPtr++ = currentOutByte;
-      currentOutByte = 0;
-      bitShift = 6;
-    } else {
-      bitShift -= 2;
-    }
-    currentX++;
-  };
+template <typename LumAt>
+void Bitmap::packRow(uint8_t* data, LumAt lumAt) const {
+  // One loop per quantizer, so the mode isn't checked for every pixel
+  if (atkinsonDitherer) {
+    packPixels(data, width, [&](const int x) { return atkinsonDitherer->processPixel(adjustPixel(lumAt(x)), x); });
+    atkinsonDitherer->nextRow();
+  } else if (fsDitherer) {
+    packPixels(data, width, [&](const int x) { return fsDitherer->processPixel(adjustPixel(lumAt(x)), x); });
+    fsDitherer->nextRow();
+  } else {
+    // Simple quantization or noise dithering
+    packPixels(data, width, [&](const int x) { return quantize(adjustPixel(lumAt(x)), x, prevRowY); });
+  }
+}
 
-  uint8_t lum;
+// packed 2bpp output, 0 = black, 1 = dark gray, 2 = light gray, 3 = white
+BmpReaderError Bitmap::readNextRow(uint8_t* data) const {
+  if (!blockBuffer) {
+    blockCapacity = rowBytes + BLOCK_READ_BYTES;
+    blockBuffer = static_cast<uint8_t*>(malloc(blockCapacity));
+    if (!blockBuffer) return BmpReaderError::OomRowBuffer;
+  }
+  const uint8_t* row = nextRawRow();
+  if (!row) return BmpReaderError::ShortReadRow;
+
+  prevRowY += 1;
 
+  const int outBytes = (width + 3) / 4;
   switch (bpp) {
-    case 32: {
-      const uint8_t* p = rowBuffer;
-      for (int x = 0; x < width; x++) {
-        lum = (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
-        packPixel(lum);
-        p += 4;
-      }
+    case 32:
+      packRow(data, [row](const int x) {
+        const uint8_t* p = row + x * 4;
+        return (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
+      });
       break;
-    }
-    case 24: {
-      const uint8_t* p = rowBuffer;
-      for (int x = 0; x < width; x++) {
-        lum = (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
-        packPixel(lum);
-        p += 3;
-      }
+    case 24:
+      packRow(data, [row](const int x) {
+        const uint8_t* p = row + x * 3;
+        return (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
+      });
       break;
-    }
-    case 8: {
-      for (int x = 0; x < width; x++) {
-        packPixel(paletteLum[rowBuffer[x]]);
-      }
+    case 8:
+      packRow(data, [this, row](const int x) { return paletteLum[row[x]]; });
       break;
-    }
     case 2: {
-      for (int x = 0; x < width; x++) {
-        lum = paletteLum[(rowBuffer[x >> 2] >> (6 - ((x & 3) * 2))) & 0x03];
-        packPixel(lum);
+      // do not quantize 2bpp image, each palette index maps straight to a level, 4 pixels per byte
+      uint8_t levels[4];
+      for (int i = 0; i < 4; i++) levels[i] = paletteLum[i] >> 6;
+      for (int i = 0; i < outBytes; i++) {
+        const uint8_t b = row[i];
+        data[i] = levels[b >> 6] << 6 | levels[(b >> 4) & 0x03] << 4 | levels[(b >> 2) & 0x03] << 2 | levels[b & 0x03];
       }
       break;
     }
     case 1: {
-      for (int x = 0; x < width; x++) {
-        lum = (rowBuffer[x >> 3] & (0x80 >> (x & 7))) ? 0xFF : 0x00;
-        packPixel(lum);
+      // Set bits are white and clear ones black, each bit widens to two
+      for (int i = 0; i < outBytes; i++) {
+        const uint8_t bits = (i & 1) ? row[i >> 1] & 0x0F : row[i >> 1] >> 4;
+        data[i] = ((bits & 0x08) ? 0xC0 : 0) | ((bits & 0x04) ? 0x30 : 0) | ((bits & 0x02) ? 0x0C : 0) |
+                  ((bits & 0x01) ? 0x03 : 0);
       }
       break;
     }
@@ -237,13 +270,8 @@ BmpReaderError Bitmap::readNextRow(uint8_t* data, uint8_t* rowBuffer) const {
       return BmpReaderError::UnsupportedBpp;
   }
 
-  if (atkinsonDitherer)
-    atkinsonDitherer->nextRow();
-  else if (fsDitherer)
-    fsDitherer->nextRow();
-
-  // Flush remaining bits if width is not a multiple of 4
-  if (bitShift != 6) *outPtr = currentOutByte;
+  // Bits past the last pixel are left clear when the width is not a multiple of 4
+  if (width & 3) data[outBytes - 1] &= static_cast<uint8_t>(0xFF << (8 - 2 * (width & 3)));
 
   return BmpReaderError::Ok;
 }
@@ -252,6 +280,8 @@ BmpReaderError Bitmap::rewindToData() const {
   if (!file.seek(bfOffBits)) {
     return BmpReaderError::SeekPixelDataFailed;
   }
+  filePosition = bfOffBits;
+  blockStart = blockEnd = 0;
 
   // Reset dithering when rewinding
   if (fsDitherer) fsDitherer->reset();
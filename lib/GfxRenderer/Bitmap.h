@@ -35,7 +35,8 @@ class Bitmap {
   explicit Bitmap(FsFile& file, bool dithering = false) : file(file), dithering(dithering) {}
   ~Bitmap();
   BmpReaderError parseHeaders();
-  BmpReaderError readNextRow(uint8_t* data, uint8_t* rowBuffer) const;
+  // Converts the next row to packed 2bpp, see Bitmap.cpp. Rows are read from the file several at a time.
+  BmpReaderError readNextRow(uint8_t* data) const;
   BmpReaderError rewindToData() const;
   int getWidth() const { return width; }
   int getHeight() const { return height; }
@@ -44,8 +45,9 @@ class Bitmap {
   int getRowBytes() const { return rowBytes; }
 
  private:
-  static uint16_t readLE16(FsFile& f);
-  static uint32_t readLE32(FsFile& f);
+  const uint8_t* nextRawRow() const;
+  template <typename LumAt>
+  void packRow(uint8_t* data, LumAt lumAt) const;
 
   FsFile& file;
   bool dithering = false;
@@ -57,6 +59,13 @@ class Bitmap {
   int rowBytes = 0;
   uint8_t paletteLum[256] = {};
 
+  // Raw pixel data read ahead in sector-aligned blocks, rows are used in place between blockStart and blockEnd
+  mutable uint8_t* blockBuffer = nullptr;
+  mutable int blockCapacity = 0;
+  mutable int blockStart = 0;
+  mutable int blockEnd = 0;
+  mutable uint32_t filePosition = 0;
+
   // Floyd-Steinberg dithering state (mutable for const methods)
   mutable int16_t* errorCurRow = nullptr;
   mutable int16_t* errorNextRow = nullptr;
@@ -0,0 +1,54 @@
+#include "BufferedPrint.h"
+
+#include <cstdlib>
+#include <cstring>
+
+BufferedPrint::BufferedPrint(Print& out, const size_t bufferSize)
+    : out(out), buffer(static_cast<uint8_t*>(malloc(bufferSize))), bufferSize(bufferSize) {}
+
+BufferedPrint::~BufferedPrint() { free(buffer); }
+
+void BufferedPrint::passOn(const uint8_t* data, const size_t size) {
+  if (out.write(data, size) != size) {
+    setWriteError();
+  }
+}
+
+size_t BufferedPrint::write(const uint8_t byte) { return write(&byte, 1); }
+
+size_t BufferedPrint::write(const uint8_t* data, const size_t size) {
+  if (!buffer) {
+    passOn(data, size);
+    return size;
+  }
+
+  size_t remaining = size;
+  while (remaining > 0) {
+    // Whole blocks skip the copy when nothing is waiting in front of them
+    if (buffered == 0 && remaining >= bufferSize) {
+      const size_t direct = remaining - remaining % bufferSize;
+      passOn(data, direct);
+      data += direct;
+      remaining -= direct;
+      continue;
+    }
+
+    const size_t chunk = remaining < bufferSize - buffered ? remaining : bufferSize - buffered;
+    memcpy(buffer + buffered, data, chunk);
+    buffered += chunk;
+    data += chunk;
+    remaining -= chunk;
+    if (buffered == bufferSize) {
+      passOn(buffer, buffered);
+      buffered = 0;
+    }
+  }
+  return size;
+}
+
+void BufferedPrint::flush() {
+  if (buffered > 0) {
+    passOn(buffer, buffered);
+    buffered = 0;
+  }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Print.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Collects small writes and passes them on a full buffer at a time. Sized as a multiple of the 512-byte sector and
+// started at the beginning of a file, every block lands on sector boundaries, which SdFat writes straight to the card
+// rather than through its one-sector cache. Call flush() before closing or seeking the target; getWriteError() is set
+// if the target ever took fewer bytes than offered.
+class BufferedPrint final : public Print {
+ public:
+  // 8 sectors, which never straddles a cluster on SD cards formatted with 4 KB or larger clusters
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 4096;
+
+  // Falls back to passing writes straight through if the buffer can't be allocated
+  explicit BufferedPrint(Print& out, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+  ~BufferedPrint() override;
+  BufferedPrint(const BufferedPrint& other) = delete;
+  BufferedPrint& operator=(const BufferedPrint& other) = delete;
+
+  size_t write(uint8_t byte) override;
+  size_t write(const uint8_t* data, size_t size) override;
+  void flush() override;
+
+ private:
+  Print& out;
+  uint8_t* buffer;
+  size_t bufferSize;
+  size_t buffered = 0;
+
+  void passOn(const uint8_t* data, size_t size);
+};
@@ -0,0 +1,317 @@
+#include "DitheredImageWriter.h"
+
+#include <HardwareSerial.h>
+#include <Print.h>
+
+#include <cstdlib>
+#include <cstring>
+
+#include "BitmapHelpers.h"
+
+// ============================================================================
+// IMAGE PROCESSING OPTIONS - Toggle these to test different configurations
+// ============================================================================
+constexpr bool USE_8BIT_OUTPUT = false;  // true: 8-bit grayscale (no quantization), false: 2-bit (4 levels)
+// Dithering method selection (only one should be true, or all false for simple quantization):
+constexpr bool USE_ATKINSON = true;          // Atkinson dithering (cleaner than F-S, less error diffusion)
+constexpr bool USE_FLOYD_STEINBERG = false;  // Floyd-Steinberg error diffusion (can cause "worm" artifacts)
+// Pre-resize to target display size (CRITICAL: avoids dithering artifacts from post-downsampling)
+constexpr bool USE_PRESCALE = true;  // true: scale image to target size before dithering
+// Inline images always scale down to the size they are given, whatever USE_PRESCALE says
+// ============================================================================
+
+namespace {
+inline void write16(Print& out, const uint16_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+}
+
+inline void write32(Print& out, const uint32_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+  out.write((value >> 16) & 0xFF);
+  out.write((value >> 24) & 0xFF);
+}
+
+inline void write32Signed(Print& out, const int32_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+  out.write((value >> 16) & 0xFF);
+  out.write((value >> 24) & 0xFF);
+}
+
+// Helper function: Write BMP header with 8-bit grayscale (256 levels)
+void writeBmpHeader8bit(Print& bmpOut, const int width, const int height) {
+  // Calculate row padding (each row must be multiple of 4 bytes)
+  const int bytesPerRow = (width + 3) / 4 * 4;  // 8 bits per pixel, padded
+  const int imageSize = bytesPerRow * height;
+  const uint32_t paletteSize = 256 * 4;  // 256 colors * 4 bytes (BGRA)
+  const uint32_t fileSize = 14 + 40 + paletteSize + imageSize;
+
+  // BMP File Header (14 bytes)
+  bmpOut.write('B');
+  bmpOut.write('M');
+  write32(bmpOut, fileSize);
+  write32(bmpOut, 0);                      // Reserved
+  write32(bmpOut, 14 + 40 + paletteSize);  // Offset to pixel data
+
+  // DIB Header (BITMAPINFOHEADER - 40 bytes)
+  write32(bmpOut, 40);
+  write32Signed(bmpOut, width);
+  write32Signed(bmpOut, -height);  // Negative height = top-down bitmap
+  write16(bmpOut, 1);              // Color planes
+  write16(bmpOut, 8);              // Bits per pixel (8 bits)
+  write32(bmpOut, 0);              // BI_RGB (no compression)
+  write32(bmpOut, imageSize);
+  write32(bmpOut, 2835);  // xPixelsPerMeter (72 DPI)
+  write32(bmpOut, 2835);  // yPixelsPerMeter (72 DPI)
+  write32(bmpOut, 256);   // colorsUsed
+  write32(bmpOut, 256);   // colorsImportant
+
+  // Color Palette (256 grayscale entries x 4 bytes = 1024 bytes)
+  for (int i = 0; i < 256; i++) {
+    bmpOut.write(static_cast<uint8_t>(i));  // Blue
+    bmpOut.write(static_cast<uint8_t>(i));  // Green
+    bmpOut.write(static_cast<uint8_t>(i));  // Red
+    bmpOut.write(static_cast<uint8_t>(0));  // Reserved
+  }
+}
+
+// Helper function: Write BMP header with 2-bit color depth
+void writeBmpHeader(Print& bmpOut, const int width, const int height) {
+  // Calculate row padding (each row must be multiple of 4 bytes)
+  const int bytesPerRow = (width * 2 + 31) / 32 * 4;  // 2 bits per pixel, round up
+  const int imageSize = bytesPerRow * height;
+  const uint32_t fileSize = 70 + imageSize;  // 14 (file header) + 40 (DIB header) + 16 (palette) + image
+
+  // BMP File Header (14 bytes)
+  bmpOut.write('B');
+  bmpOut.write('M');
+  write32(bmpOut, fileSize);  // File size
+  write32(bmpOut, 0);         // Reserved
+  write32(bmpOut, 70);        // Offset to pixel data
+
+  // DIB Header (BITMAPINFOHEADER - 40 bytes)
+  write32(bmpOut, 40);
+  write32Signed(bmpOut, width);
+  write32Signed(bmpOut, -height);  // Negative height = top-down bitmap
+  write16(bmpOut, 1);              // Color planes
+  write16(bmpOut, 2);              // Bits per pixel (2 bits)
+  write32(bmpOut, 0);              // BI_RGB (no compression)
+  write32(bmpOut, imageSize);
+  write32(bmpOut, 2835);  // xPixelsPerMeter (72 DPI)
+  write32(bmpOut, 2835);  // yPixelsPerMeter (72 DPI)
+  write32(bmpOut, 4);     // colorsUsed
+  write32(bmpOut, 4);     // colorsImportant
+
+  // Color Palette (4 colors x 4 bytes = 16 bytes)
+  // Format: Blue, Green, Red, Reserved (BGRA)
+  uint8_t palette[16] = {
+      0x00, 0x00, 0x00, 0x00,  // Color 0: Black
+      0x55, 0x55, 0x55, 0x00,  // Color 1: Dark gray (85)
+      0xAA, 0xAA, 0xAA, 0x00,  // Color 2: Light gray (170)
+      0xFF, 0xFF, 0xFF, 0x00   // Color 3: White
+  };
+  for (const uint8_t i : palette) {
+    bmpOut.write(i);
+  }
+}
+}  // namespace
+
+void DitheredImageWriter::getOutputSize(const int srcWidth, const int srcHeight, const int maxWidth,
+                                        const int maxHeight, const bool fitInside, int* outWidth, int* outHeight) {
+  *outWidth = srcWidth;
+  *outHeight = srcHeight;
+  if ((USE_PRESCALE || fitInside) && (srcWidth > maxWidth || srcHeight > maxHeight)) {
+    // Calculate scale to fit within target dimensions while maintaining aspect ratio
+    const float scaleToFitWidth = static_cast<float>(maxWidth) / srcWidth;
+    const float scaleToFitHeight = static_cast<float>(maxHeight) / srcHeight;
+    // Covers scale to the smaller dimension, so we can potentially crop later. Inline images must fit entirely.
+    // TODO: ideally, we already crop here.
+    const float scale = (scaleToFitWidth > scaleToFitHeight) != fitInside ? scaleToFitWidth : scaleToFitHeight;
+
+    *outWidth = static_cast<int>(srcWidth * scale);
+    *outHeight = static_cast<int>(srcHeight * scale);
+
+    // Ensure at least 1 pixel
+    if (*outWidth < 1) *outWidth = 1;
+    if (*outHeight < 1) *outHeight = 1;
+  }
+}
+
+DitheredImageWriter::DitheredImageWriter(Print& out, const int srcWidth, const int srcHeight, const int maxWidth,
+                                         const int maxHeight, const bool fitInside, const bool writeBmp)
+    : out(out),
+      srcWidth(srcWidth),
+      srcHeight(srcHeight),
+      writeBmp(writeBmp),
+      use8BitOutput(USE_8BIT_OUTPUT && writeBmp) {
+  getOutputSize(srcWidth, srcHeight, maxWidth, maxHeight, fitInside, &outWidth, &outHeight);
+  if (outWidth != srcWidth || outHeight != srcHeight) {
+    // Calculate fixed-point scale factors (source pixels per output pixel)
+    // scaleX_fp = (srcWidth << 16) / outWidth
+    scaleX_fp = (static_cast<uint32_t>(srcWidth) << 16) / outWidth;
+    scaleY_fp = (static_cast<uint32_t>(srcHeight) << 16) / outHeight;
+    needsScaling = true;
+
+    Serial.printf("[%lu] [IMG] Pre-scaling %dx%d -> %dx%d (fit to %dx%d)\n", millis(), srcWidth, srcHeight, outWidth,
+                  outHeight, maxWidth, maxHeight);
+  }
+}
+
+DitheredImageWriter::~DitheredImageWriter() {
+  delete[] rowAccum;
+  delete[] rowCount;
+  delete atkinsonDitherer;
+  delete fsDitherer;
+  free(rowBuffer);
+}
+
+bool DitheredImageWriter::begin() {
+  // Write BMP header with output dimensions, bare rows are not padded
+  if (!writeBmp) {
+    // Goes through the same buffer as the rows, so their blocks stay on sector boundaries
+    write16(out, outWidth);
+    write16(out, outHeight);
+    bytesPerRow = (outWidth + 3) / 4;
+  } else if (use8BitOutput) {
+    writeBmpHeader8bit(out, outWidth, outHeight);
+    bytesPerRow = (outWidth + 3) / 4 * 4;
+  } else {
+    writeBmpHeader(out, outWidth, outHeight);
+    bytesPerRow = (outWidth * 2 + 31) / 32 * 4;
+  }
+
+  // Allocate row buffer
+  rowBuffer = static_cast<uint8_t*>(malloc(bytesPerRow));
+  if (!rowBuffer) {
+    Serial.printf("[%lu] [IMG] Failed to allocate row buffer\n", millis());
+    return false;
+  }
+
+  // Create ditherer if enabled (only for 2-bit output)
+  // Use OUTPUT dimensions for dithering (after prescaling)
+  if (!use8BitOutput) {
+    if (USE_ATKINSON) {
+      atkinsonDitherer = new AtkinsonDitherer(outWidth);
+    } else if (USE_FLOYD_STEINBERG) {
+      fsDitherer = new FloydSteinbergDitherer(outWidth);
+    }
+  }
+
+  // For scaling: accumulate source rows into scaled output rows
+  // We need to track which source Y maps to which output Y
+  // Using fixed-point: srcY_fp = outY * scaleY_fp (gives source Y in 16.16 format)
+  if (needsScaling) {
+    rowAccum = new uint32_t[outWidth]();
+    rowCount = new uint16_t[outWidth]();
+    nextOutY_srcStart = scaleY_fp;  // First boundary is at scaleY_fp (source Y for outY=1)
+  }
+  return true;
+}
+
+template <typename GrayAt>
+void DitheredImageWriter::writeOutputRow(GrayAt grayAt) {
+  memset(rowBuffer, 0, bytesPerRow);
+
+  if (use8BitOutput) {
+    for (int x = 0; x < outWidth; x++) {
+      rowBuffer[x] = adjustPixel(grayAt(x));
+    }
+  } else {
+    for (int x = 0; x < outWidth; x++) {
+      const uint8_t gray = adjustPixel(grayAt(x));
+      uint8_t twoBit;
+      if (atkinsonDitherer) {
+        twoBit = atkinsonDitherer->processPixel(gray, x);
+      } else if (fsDitherer) {
+        twoBit = fsDitherer->processPixel(gray, x);
+      } else {
+        twoBit = quantize(gray, x, currentOutY);
+      }
+      if (!writeBmp) {
+        twoBit = 3 - twoBit;
+      }
+      const int byteIndex = (x * 2) / 8;
+      const int bitOffset = 6 - ((x * 2) % 8);
+      rowBuffer[byteIndex] |= (twoBit << bitOffset);
+    }
+    if (atkinsonDitherer)
+      atkinsonDitherer->nextRow();
+    else if (fsDitherer)
+      fsDitherer->nextRow();
+  }
+
+  out.write(rowBuffer, bytesPerRow);
+  currentOutY++;
+}
+
+bool DitheredImageWriter::finish() {
+  if (cancelled) {
+    Serial.printf("[%lu] [IMG] Image cancelled after %d of %d rows\n", millis(), srcY, srcHeight);
+    return false;
+  }
+  out.flush();
+  if (out.getWriteError()) {
+    Serial.printf("[%lu] [IMG] Failed to write image output\n", millis());
+    return false;
+  }
+  return true;
+}
+
+bool DitheredImageWriter::writeSourceRow(const uint8_t* grayRow) {
+  if (cancelled || (cancelFn && cancelFn())) {
+    cancelled = true;
+    return false;
+  }
+  if (srcY >= srcHeight) {
+    return true;
+  }
+  srcY++;
+
+  if (!needsScaling) {
+    // No scaling - direct output (1:1 mapping)
+    writeOutputRow([grayRow](const int x) { return grayRow[x]; });
+    return true;
+  }
+
+  // Fixed-point area averaging for exact fit scaling
+  // For each output pixel X, accumulate source pixels that map to it
+  // srcX range for outX: [outX * scaleX_fp >> 16, (outX+1) * scaleX_fp >> 16)
+  for (int outX = 0; outX < outWidth; outX++) {
+    // Calculate source X range for this output pixel
+    const int srcXStart = (static_cast<uint32_t>(outX) * scaleX_fp) >> 16;
+    const int srcXEnd = (static_cast<uint32_t>(outX + 1) * scaleX_fp) >> 16;
+
+    // Accumulate all source pixels in this range
+    int sum = 0;
+    int count = 0;
+    for (int srcX = srcXStart; srcX < srcXEnd && srcX < srcWidth; srcX++) {
+      sum += grayRow[srcX];
+      count++;
+    }
+
+    // Handle edge case: if no pixels in range, use nearest
+    if (count == 0 && srcXStart < srcWidth) {
+      sum = grayRow[srcXStart];
+      count = 1;
+    }
+
+    rowAccum[outX] += sum;
+    rowCount[outX] += count;
+  }
+
+  // Output row when the source Y (in fixed point) crosses into the next output row
+  const uint32_t srcY_fp = static_cast<uint32_t>(srcY) << 16;
+  if (srcY_fp >= nextOutY_srcStart && currentOutY < outHeight) {
+    writeOutputRow([this](const int x) { return (rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0; });
+
+    // Reset accumulators for next output row
+    memset(rowAccum, 0, outWidth * sizeof(uint32_t));
+    memset(rowCount, 0, outWidth * sizeof(uint16_t));
+
+    // Update boundary for next output row
+    nextOutY_srcStart = static_cast<uint32_t>(currentOutY + 1) * scaleY_fp;
+  }
+  return true;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "BufferedPrint.h"
+
+class AtkinsonDitherer;
+class FloydSteinbergDitherer;
+
+// Back end shared by the image converters. Takes 8-bit grayscale source rows top to bottom, box-filters them down to
+// the output size and dithers them to 2-bit, writing a BMP or bare rows as it goes. Output is collected into sector
+// sized blocks, so finish() must be called once the last row is in.
+class DitheredImageWriter {
+ public:
+  // Covers are scaled to fill this and cropped when drawn
+  static constexpr int COVER_MAX_WIDTH = 480;
+  static constexpr int COVER_MAX_HEIGHT = 800;
+
+  // fitInside scales the whole image into maxWidth x maxHeight, otherwise it is scaled to fill it like covers.
+  // Without writeBmp the output is the width and height as little-endian uint16_t, then bare rows of 2-bit pixels,
+  // 0 = white to 3 = black like EpdFont bitmaps, packed 4 to a byte with each row starting on a new byte.
+  DitheredImageWriter(Print& out, int srcWidth, int srcHeight, int maxWidth, int maxHeight, bool fitInside,
+                      bool writeBmp);
+  ~DitheredImageWriter();
+  DitheredImageWriter(const DitheredImageWriter& other) = delete;
+  DitheredImageWriter& operator=(const DitheredImageWriter& other) = delete;
+
+  // Size the output will have for a srcWidth x srcHeight source, so decoders can pick a cheaper decode scale
+  static void getOutputSize(int srcWidth, int srcHeight, int maxWidth, int maxHeight, bool fitInside, int* outWidth,
+                            int* outHeight);
+
+  // Checked before each source row, once it returns true every further row is dropped and finish() fails
+  void setCancelCheck(const std::function<bool()>& cancelFn) { this->cancelFn = cancelFn; }
+  // Writes the BMP or size header and allocates the row state, returning false if out of memory
+  bool begin();
+  // Takes the next source row of srcWidth gray pixels, rows past srcHeight are ignored. Returns false once cancelled,
+  // so the decoder can stop early.
+  bool writeSourceRow(const uint8_t* grayRow);
+  // Passes the buffered output on, returning false if any of it could not be written or the image was cancelled
+  bool finish();
+  int getWidth() const { return outWidth; }
+  int getHeight() const { return outHeight; }
+
+ private:
+  BufferedPrint out;
+  int srcWidth;
+  int srcHeight;
+  int outWidth;
+  int outHeight;
+  bool writeBmp;
+  bool use8BitOutput;
+  int bytesPerRow = 0;
+  // Fixed-point (16.16) source pixels per output pixel
+  uint32_t scaleX_fp = 65536;
+  uint32_t scaleY_fp = 65536;
+  bool needsScaling = false;
+  std::function<bool()> cancelFn;
+  bool cancelled = false;
+  uint8_t* rowBuffer = nullptr;
+  AtkinsonDitherer* atkinsonDitherer = nullptr;
+  FloydSteinbergDitherer* fsDitherer = nullptr;
+  uint32_t* rowAccum = nullptr;    // Accumulator for each output X (32-bit for larger sums)
+  uint16_t* rowCount = nullptr;    // Count of source pixels accumulated per output X
+  int srcY = 0;                    // Next source row
+  int currentOutY = 0;             // Current output row being accumulated
+  uint32_t nextOutY_srcStart = 0;  // Source Y where next output row starts (16.16 fixed point)
+
+  template <typename GrayAt>
+  void writeOutputRow(GrayAt grayAt);
+};
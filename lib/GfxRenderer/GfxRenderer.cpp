@@ -2,8 +2,209 @@
 
 #include <Utf8.h>
 
+#include <algorithm>
+
+namespace {
+// Glyph bitmaps are packed continuously across rows (not byte aligned per row), so glyph pixels are walked with a
+// sequential reader starting from any pixel position. Readers return the raw pixel value from the font.
+class Glyph1BitReader {
+  const uint8_t* byte;
+  uint8_t mask;
+
+ public:
+  Glyph1BitReader(const uint8_t* bitmap, const int pixelPosition)
+      : byte(bitmap + pixelPosition / 8), mask(0x80 >> (pixelPosition % 8)) {}
+
+  uint8_t next() {
+    const uint8_t value = (*byte & mask) ? 1 : 0;
+    mask >>= 1;
+    if (!mask) {
+      mask = 0x80;
+      byte++;
+    }
+    return value;
+  }
+};
+
+class Glyph2BitReader {
+  const uint8_t* byte;
+  int shift;
+
+ public:
+  Glyph2BitReader(const uint8_t* bitmap, const int pixelPosition)
+      : byte(bitmap + pixelPosition / 4), shift((3 - pixelPosition % 4) * 2) {}
+
+  uint8_t next() {
+    const uint8_t value = (*byte >> shift) & 0x3;
+    shift -= 2;
+    if (shift < 0) {
+      shift = 6;
+      byte++;
+    }
+    return value;
+  }
+};
+
+// Clipped glyph area, with the physical position of its first pixel and the physical steps along a glyph row (col*)
+// and down to the next glyph row (row*)
+struct GlyphBlit {
+  int startGlyphX, endGlyphX, startGlyphY, endGlyphY;
+  int physX, physY;
+  int colStepX, colStepY;
+  int rowStepX, rowStepY;
+};
+
+// A buffer a glyph is drawn into. Buffers may be split into chunks of whole panel rows, and each one selects which raw
+// glyph values it draws and with which pixel state
+struct GlyphPlane {
+  uint8_t* const* chunks;
+  int rowsPerChunk;
+  const bool* onForValue;
+  bool pixelState;
+
+  uint8_t* byteAt(const int physX, const int physY) const {
+    return chunks[physY / rowsPerChunk] + (physY % rowsPerChunk) * EInkDisplay::DISPLAY_WIDTH_BYTES + physX / 8;
+  }
+};
+
+inline void applyBits(uint8_t* target, const uint8_t bits, const bool pixelState) {
+  if (pixelState) {
+    *target &= ~bits;  // Clear bits
+  } else {
+    *target |= bits;  // Set bits
+  }
+}
+
+// Decodes each glyph pixel once and draws it into every plane
+template <typename Reader, size_t PlaneCount, typename MakeReader>
+void blitGlyph(const GlyphPlane (&planes)[PlaneCount], const GlyphBlit& blit, const int glyphWidth,
+               MakeReader makeReader) {
+  uint8_t* targets[PlaneCount];
+  int rowPhysX = blit.physX;
+  int rowPhysY = blit.physY;
+
+  for (int glyphY = blit.startGlyphY; glyphY < blit.endGlyphY; glyphY++) {
+    Reader reader = makeReader(glyphY * glyphWidth + blit.startGlyphX);
+    for (size_t p = 0; p < PlaneCount; p++) {
+      targets[p] = planes[p].byteAt(rowPhysX, rowPhysY);
+    }
+
+    if (blit.colStepY == 0) {
+      // Glyph row runs along a panel row: gather bits and apply them a whole byte at a time
+      uint8_t mask = 0x80 >> (rowPhysX % 8);
+      uint8_t bits[PlaneCount] = {};
+      for (int glyphX = blit.startGlyphX; glyphX < blit.endGlyphX; glyphX++) {
+        const uint8_t value = reader.next();
+        for (size_t p = 0; p < PlaneCount; p++) {
+          if (planes[p].onForValue[value]) {
+            bits[p] |= mask;
+          }
+        }
+        const bool byteDone = blit.colStepX > 0 ? mask == 0x01 : mask == 0x80;
+        mask = blit.colStepX > 0 ? mask >> 1 : mask << 1;
+        if (byteDone) {
+          for (size_t p = 0; p < PlaneCount; p++) {
+            applyBits(targets[p], bits[p], planes[p].pixelState);
+            bits[p] = 0;
+            targets[p] += blit.colStepX;
+          }
+          mask = blit.colStepX > 0 ? 0x80 : 0x01;
+        }
+      }
+      for (size_t p = 0; p < PlaneCount; p++) {
+        if (bits[p]) {
+          applyBits(targets[p], bits[p], planes[p].pixelState);
+        }
+      }
+    } else {
+      // Glyph row runs down a panel column: same bit in every byte, stepping a whole panel row each pixel
+      const uint8_t mask = 0x80 >> (rowPhysX % 8);
+      const int step = blit.colStepY * EInkDisplay::DISPLAY_WIDTH_BYTES;
+      int physY = rowPhysY;
+      int rowInChunk[PlaneCount];
+      for (size_t p = 0; p < PlaneCount; p++) {
+        rowInChunk[p] = physY % planes[p].rowsPerChunk;
+      }
+      for (int glyphX = blit.startGlyphX; glyphX < blit.endGlyphX; glyphX++) {
+        const uint8_t value = reader.next();
+        physY += blit.colStepY;
+        for (size_t p = 0; p < PlaneCount; p++) {
+          if (planes[p].onForValue[value]) {
+            applyBits(targets[p], mask, planes[p].pixelState);
+          }
+          rowInChunk[p] += blit.colStepY;
+          if (rowInChunk[p] >= 0 && rowInChunk[p] < planes[p].rowsPerChunk) {
+            targets[p] += step;
+          } else if (physY >= 0 && physY < EInkDisplay::DISPLAY_HEIGHT) {
+            // Stepped into another chunk
+            targets[p] = planes[p].byteAt(rowPhysX, physY);
+            rowInChunk[p] = physY % planes[p].rowsPerChunk;
+          }
+        }
+      }
+    }
+
+    rowPhysX += blit.rowStepX;
+    rowPhysY += blit.rowStepY;
+  }
+}
+}  // namespace
+
 void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
 
+const EpdFontFamily* GfxRenderer::getFontFamily(const int fontId) const {
+  const auto it = fontMap.find(fontId);
+  if (it == fontMap.end()) {
+    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+    return nullptr;
+  }
+  return &it->second;
+}
+
+const EpdGlyph* GfxRenderer::getGlyph(const EpdFont* font, const uint32_t cp) const {
+  if (cp - EpdFont::ASCII_FIRST <= EpdFont::ASCII_LAST - EpdFont::ASCII_FIRST) {
+    return font->getGlyph(cp);
+  }
+
+  GlyphCacheEntry& entry = glyphCache[(cp * 31 + (reinterpret_cast<uintptr_t>(font) >> 3)) % GLYPH_CACHE_SIZE];
+  if (entry.font != font || entry.cp != cp) {
+    glyphCacheMisses++;
+    entry.font = font;
+    entry.cp = cp;
+    entry.glyph = font->getGlyph(cp);
+  }
+  return entry.glyph;
+}
+
+// Same dimensions as EpdFont::getTextDimensions
+void GfxRenderer::getTextDimensions(const EpdFont* font, const char* text, int* w, int* h) const {
+  int minX = 0, minY = 0, maxX = 0, maxY = 0;
+  int cursorX = 0;
+  uint32_t cp;
+  const EpdGlyph* prevGlyph = nullptr;
+  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    const EpdGlyph* glyph = getGlyph(font, cp);
+    if (!glyph) {
+      glyph = getGlyph(font, '?');
+    }
+    if (!glyph) {
+      continue;
+    }
+
+    cursorX += font->getKerning(prevGlyph, glyph);
+    prevGlyph = glyph;
+
+    minX = std::min(minX, cursorX + glyph->left);
+    maxX = std::max(maxX, cursorX + glyph->left + glyph->width);
+    minY = std::min(minY, glyph->top - glyph->height);
+    maxY = std::max(maxY, static_cast<int>(glyph->top));
+    cursorX += glyph->advanceX;
+  }
+
+  *w = maxX - minX;
+  *h = maxY - minY;
+}
+
 void GfxRenderer::rotateCoordinates(const int x, const int y, int* rotatedX, int* rotatedY) const {
   switch (orientation) {
     case Portrait: {
@@ -67,13 +268,13 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* fontFamily = getFontFamily(fontId);
+  if (!fontFamily) {
     return 0;
   }
 
   int w = 0, h = 0;
-  fontMap.at(fontId).getTextDimensions(text, &w, &h, style);
+  getTextDimensions(fontFamily->getFont(style), text, &w, &h);
   return w;
 }
 
@@ -85,28 +286,44 @@ void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* te
 
 void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
                            const EpdFontFamily::Style style) const {
-  const int yPos = y + getFontAscenderSize(fontId);
-  int xpos = x;
-
   // cannot draw a NULL / empty string
   if (text == nullptr || *text == '\0') {
     return;
   }
 
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* fontFamily = getFontFamily(fontId);
+  if (!fontFamily) {
     return;
   }
-  const auto font = fontMap.at(fontId);
+  const EpdFont* font = fontFamily->getFont(style);
 
   // no printable characters
-  if (!font.hasPrintableChars(text, style)) {
+  int w = 0, h = 0;
+  getTextDimensions(font, text, &w, &h);
+  if (w <= 0 && h <= 0) {
     return;
   }
 
+  const int yPos = y + fontFamily->getData(EpdFontFamily::REGULAR)->ascender;
+  int xpos = x;
   uint32_t cp;
+  const EpdGlyph* prevGlyph = nullptr;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    renderChar(font, cp, &xpos, &yPos, black, style);
+    const EpdGlyph* glyph = getGlyph(font, cp);
+    if (!glyph) {
+      // TODO: Replace with fallback glyph property?
+      glyph = getGlyph(font, '?');
+    }
+
+    // no glyph?
+    if (!glyph) {
+      Serial.printf("[%lu] [GFX] No glyph for codepoint %d\n", millis(), cp);
+      continue;
+    }
+
+    xpos += font->getKerning(prevGlyph, glyph);
+    prevGlyph = glyph;
+    renderChar(font, glyph, &xpos, &yPos, black);
   }
 }
 
@@ -171,19 +388,84 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   }
   Serial.printf("[%lu] [GFX] Scaling by %f - %s\n", millis(), scale, isScaled ? "scaled" : "not scaled");
 
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    Serial.printf("[%lu] [GFX] !! No framebuffer\n", millis());
+    return;
+  }
+
   // Calculate output row size (2 bits per pixel, packed into bytes)
   // IMPORTANT: Use int, not uint8_t, to avoid overflow for images > 1020 pixels wide
   const int outputRowSize = (bitmap.getWidth() + 3) / 4;
+  const int visibleColumns = std::max(0, bitmap.getWidth() - 2 * cropPixX);
   auto* outputRow = static_cast<uint8_t*>(malloc(outputRowSize));
-  auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
+  // Screen column of each visible bitmap column, worked out once instead of per row
+  auto* columnX = static_cast<int16_t*>(malloc(std::max(1, visibleColumns) * sizeof(int16_t)));
 
-  if (!outputRow || !rowBytes) {
+  if (!outputRow || !columnX) {
     Serial.printf("[%lu] [GFX] !! Failed to allocate BMP row buffers\n", millis());
     free(outputRow);
-    free(rowBytes);
+    free(columnX);
     return;
   }
 
+  int columnCount = 0;
+  for (; columnCount < visibleColumns; columnCount++) {
+    int screenX = columnCount;
+    if (isScaled) {
+      screenX = std::floor(screenX * scale);
+    }
+    screenX += x;  // the offset should not be scaled
+    if (screenX >= getScreenWidth()) {
+      break;
+    }
+    columnX[columnCount] = static_cast<int16_t>(screenX);
+  }
+
+  // Bit n is set if pixel value n is drawn. BW modes clear bits for black, the grayscale passes set them.
+  uint8_t drawnValues = 0;
+  if (renderMode == BW || renderMode == BW_AND_GRAYSCALE) {
+    drawnValues = 0b0111;
+  } else if (renderMode == GRAYSCALE_MSB) {
+    drawnValues = 0b0110;
+  } else if (renderMode == GRAYSCALE_LSB) {
+    drawnValues = 0b0010;
+  }
+  const bool clearBits = renderMode == BW || renderMode == BW_AND_GRAYSCALE;
+
+  // Unscaled full-width rows in panel orientation map straight onto framebuffer rows, two packed bytes to one
+  const bool rowsAreAligned = orientation == LandscapeCounterClockwise && !isScaled && x == 0 && cropPixX == 0 &&
+                              columnCount == EInkDisplay::DISPLAY_WIDTH;
+  // In portrait the same rows each fill one panel column, so eight of them are gathered and written a byte at a time
+  const bool columnsAreAligned = (orientation == Portrait || orientation == PortraitInverted) && !isScaled && x == 0 &&
+                                 cropPixX == 0 && columnCount == EInkDisplay::DISPLAY_HEIGHT;
+  uint8_t columnMask[EInkDisplay::DISPLAY_HEIGHT];
+  int columnMaskByte = -1;
+  auto flushColumnMask = [&]() {
+    if (columnMaskByte < 0) {
+      return;
+    }
+    uint8_t* panelByte = frameBuffer + columnMaskByte;
+    for (int panelY = 0; panelY < EInkDisplay::DISPLAY_HEIGHT; panelY++) {
+      if (clearBits) {
+        *panelByte &= ~columnMask[panelY];
+      } else {
+        *panelByte |= columnMask[panelY];
+      }
+      panelByte += EInkDisplay::DISPLAY_WIDTH_BYTES;
+    }
+    columnMaskByte = -1;
+  };
+
+  uint8_t drawnMask[256] = {};
+  if (rowsAreAligned || columnsAreAligned) {
+    for (int packed = 0; packed < 256; packed++) {
+      for (int i = 0; i < 4; i++) {
+        if (drawnValues & (1 << ((packed >> (6 - 2 * i)) & 0x3))) drawnMask[packed] |= 0x8 >> i;
+      }
+    }
+  }
+
   for (int bmpY = 0; bmpY < (bitmap.getHeight() - cropPixY); bmpY++) {
     // The BMP's (0, 0) is the bottom-left corner (if the height is positive, top-left if negative).
     // Screen's (0, 0) is the top-left corner.
@@ -196,10 +478,11 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
       break;
     }
 
-    if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
+    if (bitmap.readNextRow(outputRow) != BmpReaderError::Ok) {
       Serial.printf("[%lu] [GFX] Failed to read row %d from bitmap\n", millis(), bmpY);
+      flushColumnMask();
       free(outputRow);
-      free(rowBytes);
+      free(columnX);
       return;
     }
 
@@ -208,30 +491,74 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
       continue;
     }
 
-    for (int bmpX = cropPixX; bmpX < bitmap.getWidth() - cropPixX; bmpX++) {
-      int screenX = bmpX - cropPixX;
-      if (isScaled) {
-        screenX = std::floor(screenX * scale);
+    // Every orientation is affine, so the panel position steps by a fixed amount per screen column
+    int originX = 0;
+    int originY = 0;
+    int stepX = 0;
+    int stepY = 0;
+    rotateCoordinates(0, screenY, &originX, &originY);
+    rotateCoordinates(1, screenY, &stepX, &stepY);
+    stepX -= originX;
+    stepY -= originY;
+
+    if (rowsAreAligned && originY >= 0 && originY < EInkDisplay::DISPLAY_HEIGHT) {
+      uint8_t* panelRow = frameBuffer + originY * EInkDisplay::DISPLAY_WIDTH_BYTES;
+      for (int i = 0; i < EInkDisplay::DISPLAY_WIDTH_BYTES; i++) {
+        const uint8_t mask = drawnMask[outputRow[2 * i]] << 4 | drawnMask[outputRow[2 * i + 1]];
+        if (clearBits) {
+          panelRow[i] &= ~mask;
+        } else {
+          panelRow[i] |= mask;
+        }
       }
-      screenX += x;  // the offset should not be scaled
-      if (screenX >= getScreenWidth()) {
-        break;
+      continue;
+    }
+
+    if (columnsAreAligned && originX >= 0 && originX < EInkDisplay::DISPLAY_WIDTH) {
+      if (originX / 8 != columnMaskByte) {
+        flushColumnMask();
+        memset(columnMask, 0, sizeof(columnMask));
+        columnMaskByte = originX / 8;
+      }
+      const uint8_t bit = 0x80 >> (originX % 8);
+      int panelY = originY;
+      for (int i = 0; i < EInkDisplay::DISPLAY_HEIGHT / 4; i++) {
+        const uint8_t drawn = drawnMask[outputRow[i]];
+        for (int pixel = 0; pixel < 4; pixel++, panelY += stepY) {
+          if (drawn & (0x8 >> pixel)) {
+            columnMask[panelY] |= bit;
+          }
+        }
       }
+      continue;
+    }
 
+    for (int column = 0; column < columnCount; column++) {
+      const int bmpX = column + cropPixX;
       const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+      if (!(drawnValues & (1 << val))) {
+        continue;
+      }
 
-      if (renderMode == BW && val < 3) {
-        drawPixel(screenX, screenY);
-      } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
-        drawPixel(screenX, screenY, false);
-      } else if (renderMode == GRAYSCALE_LSB && val == 1) {
-        drawPixel(screenX, screenY, false);
+      const int panelX = originX + columnX[column] * stepX;
+      const int panelY = originY + columnX[column] * stepY;
+      if (panelX < 0 || panelX >= EInkDisplay::DISPLAY_WIDTH || panelY < 0 || panelY >= EInkDisplay::DISPLAY_HEIGHT) {
+        continue;
+      }
+
+      uint8_t& panelByte = frameBuffer[panelY * EInkDisplay::DISPLAY_WIDTH_BYTES + panelX / 8];
+      const uint8_t bit = 0x80 >> (panelX % 8);
+      if (clearBits) {
+        panelByte &= ~bit;
+      } else {
+        panelByte |= bit;
       }
     }
   }
+  flushColumnMask();
 
   free(outputRow);
-  free(rowBytes);
+  free(columnX);
 }
 
 void GfxRenderer::clearScreen(const uint8_t color) const { einkDisplay.clearScreen(color); }
@@ -292,30 +619,30 @@ int GfxRenderer::getScreenHeight() const {
 }
 
 int GfxRenderer::getSpaceWidth(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* fontFamily = getFontFamily(fontId);
+  if (!fontFamily) {
     return 0;
   }
 
-  return fontMap.at(fontId).getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
+  return fontFamily->getGlyph(' ', EpdFontFamily::REGULAR)->advanceX;
 }
 
 int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* fontFamily = getFontFamily(fontId);
+  if (!fontFamily) {
     return 0;
   }
 
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
+  return fontFamily->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 int GfxRenderer::getLineHeight(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* fontFamily = getFontFamily(fontId);
+  if (!fontFamily) {
     return 0;
   }
 
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->advanceY;
+  return fontFamily->getData(EpdFontFamily::REGULAR)->advanceY;
 }
 
 void GfxRenderer::drawButtonHints(const int fontId, const char* btn1, const char* btn2, const char* btn3,
@@ -392,11 +719,11 @@ void GfxRenderer::drawSideButtonHints(const int fontId, const char* topBtn, cons
 }
 
 int GfxRenderer::getTextHeight(const int fontId) const {
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* fontFamily = getFontFamily(fontId);
+  if (!fontFamily) {
     return 0;
   }
-  return fontMap.at(fontId).getData(EpdFontFamily::REGULAR)->ascender;
+  return fontFamily->getData(EpdFontFamily::REGULAR)->ascender;
 }
 
 void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y, const char* text, const bool black,
@@ -406,14 +733,16 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
     return;
   }
 
-  if (fontMap.count(fontId) == 0) {
-    Serial.printf("[%lu] [GFX] Font %d not found\n", millis(), fontId);
+  const EpdFontFamily* fontFamily = getFontFamily(fontId);
+  if (!fontFamily) {
     return;
   }
-  const auto font = fontMap.at(fontId);
+  const EpdFont* font = fontFamily->getFont(style);
 
   // No printable characters
-  if (!font.hasPrintableChars(text, style)) {
+  int w = 0, h = 0;
+  getTextDimensions(font, text, &w, &h);
+  if (w <= 0 && h <= 0) {
     return;
   }
 
@@ -424,23 +753,27 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
   int yPos = y;  // Current Y position (decreases as we draw characters)
 
   uint32_t cp;
+  const EpdGlyph* prevGlyph = nullptr;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
-    const EpdGlyph* glyph = font.getGlyph(cp, style);
+    const EpdGlyph* glyph = getGlyph(font, cp);
     if (!glyph) {
-      glyph = font.getGlyph('?', style);
+      glyph = getGlyph(font, '?');
     }
     if (!glyph) {
       continue;
     }
 
-    const int is2Bit = font.getData(style)->is2Bit;
+    yPos -= font->getKerning(prevGlyph, glyph);
+    prevGlyph = glyph;
+
+    const int is2Bit = font->data->is2Bit;
     const uint32_t offset = glyph->dataOffset;
     const uint8_t width = glyph->width;
     const uint8_t height = glyph->height;
     const int left = glyph->left;
     const int top = glyph->top;
 
-    const uint8_t* bitmap = &font.getData(style)->bitmap[offset];
+    const uint8_t* bitmap = &font->data->bitmap[offset];
 
     if (bitmap != nullptr) {
       for (int glyphY = 0; glyphY < height; glyphY++) {
@@ -450,7 +783,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
           // 90° clockwise rotation transformation:
           // screenX = x + (ascender - top + glyphY)
           // screenY = yPos - (left + glyphX)
-          const int screenX = x + (font.getData(style)->ascender - top + glyphY);
+          const int screenX = x + (font->data->ascender - top + glyphY);
           const int screenY = yPos - left - glyphX;
 
           if (is2Bit) {
@@ -458,7 +791,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
             const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
             const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
 
-            if (renderMode == BW && bmpVal < 3) {
+            if ((renderMode == BW || renderMode == BW_AND_GRAYSCALE) && bmpVal < 3) {
               drawPixel(screenX, screenY, black);
             } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
               drawPixel(screenX, screenY, false);
@@ -601,68 +934,167 @@ void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
   }
 }
 
-void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp, int* x, const int* y,
-                             const bool pixelState, const EpdFontFamily::Style style) const {
-  const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
-  if (!glyph) {
-    // TODO: Replace with fallback glyph property?
-    glyph = fontFamily.getGlyph('?', style);
+void GfxRenderer::freeGrayscalePlanes() {
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    free(grayLsbChunks[i]);
+    free(grayMsbChunks[i]);
+    grayLsbChunks[i] = nullptr;
+    grayMsbChunks[i] = nullptr;
   }
+}
 
-  // no glyph?
-  if (!glyph) {
-    Serial.printf("[%lu] [GFX] No glyph for codepoint %d\n", millis(), cp);
+/**
+ * Allocates zeroed LSB and MSB planes so a BW_AND_GRAYSCALE render can produce the BW framebuffer and both grayscale
+ * planes from a single pass. Uses the same chunking as the BW buffer store. The planes take 96KB, so they are
+ * allocated for one page and given back with freeGrayscalePlanes once displayGrayscalePlanes has shown them.
+ * Returns false if the planes could not be allocated, in which case the per-plane render passes should be used.
+ */
+bool GfxRenderer::allocateGrayscalePlanes() {
+  freeGrayscalePlanes();
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    grayLsbChunks[i] = static_cast<uint8_t*>(calloc(1, BW_BUFFER_CHUNK_SIZE));
+    grayMsbChunks[i] = static_cast<uint8_t*>(calloc(1, BW_BUFFER_CHUNK_SIZE));
+    if (!grayLsbChunks[i] || !grayMsbChunks[i]) {
+      Serial.printf("[%lu] [GFX] Not enough memory for grayscale planes, using separate passes\n", millis());
+      freeGrayscalePlanes();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Sends the planes filled by a BW_AND_GRAYSCALE render to the display and shows them, leaving the BW framebuffer
+ * as it was. The BW framebuffer is swapped into the LSB plane's chunks while the planes go through the framebuffer.
+ */
+void GfxRenderer::displayGrayscalePlanes() {
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer || !grayLsbChunks[0] || !grayMsbChunks[0]) {
+    Serial.printf("[%lu] [GFX] !! Grayscale planes not allocated - this is likely a bug\n", millis());
     return;
   }
 
-  const int is2Bit = fontFamily.getData(style)->is2Bit;
-  const uint32_t offset = glyph->dataOffset;
-  const uint8_t width = glyph->width;
-  const uint8_t height = glyph->height;
-  const int left = glyph->left;
-
-  const uint8_t* bitmap = nullptr;
-  bitmap = &fontFamily.getData(style)->bitmap[offset];
-
-  if (bitmap != nullptr) {
-    for (int glyphY = 0; glyphY < height; glyphY++) {
-      const int screenY = *y - glyph->top + glyphY;
-      for (int glyphX = 0; glyphX < width; glyphX++) {
-        const int pixelPosition = glyphY * width + glyphX;
-        const int screenX = *x + left + glyphX;
-
-        if (is2Bit) {
-          const uint8_t byte = bitmap[pixelPosition / 4];
-          const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
-
-          if (renderMode == BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            drawPixel(screenX, screenY, false);
-          } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            drawPixel(screenX, screenY, false);
-          }
-        } else {
-          const uint8_t byte = bitmap[pixelPosition / 8];
-          const uint8_t bit_index = 7 - (pixelPosition % 8);
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    uint8_t* chunk = frameBuffer + i * BW_BUFFER_CHUNK_SIZE;
+    std::swap_ranges(chunk, chunk + BW_BUFFER_CHUNK_SIZE, grayLsbChunks[i]);
+  }
+  einkDisplay.copyGrayscaleLsbBuffers(frameBuffer);
 
-          if ((byte >> bit_index) & 1) {
-            drawPixel(screenX, screenY, pixelState);
-          }
-        }
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    memcpy(frameBuffer + i * BW_BUFFER_CHUNK_SIZE, grayMsbChunks[i], BW_BUFFER_CHUNK_SIZE);
+  }
+  einkDisplay.copyGrayscaleMsbBuffers(frameBuffer);
+
+  einkDisplay.displayGrayBuffer();
+
+  // Bring back the BW data
+  for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
+    memcpy(frameBuffer + i * BW_BUFFER_CHUNK_SIZE, grayLsbChunks[i], BW_BUFFER_CHUNK_SIZE);
+  }
+  einkDisplay.cleanupGrayscaleBuffers(frameBuffer);
+}
+
+void GfxRenderer::renderChar(const EpdFont* font, const EpdGlyph* glyph, int* x, const int* y,
+                             const bool pixelState) const {
+  drawPackedPixels(&font->data->bitmap[glyph->dataOffset], font->data->is2Bit, *x + glyph->left, *y - glyph->top,
+                   glyph->width, glyph->height, pixelState);
+  *x += glyph->advanceX;
+}
+
+void GfxRenderer::drawPackedPixels(const uint8_t* bitmap, const bool is2Bit, const int originX, const int originY,
+                                   const int width, const int height, const bool pixelState,
+                                   const bool thresholdGrays) const {
+  uint8_t* frameBuffer = einkDisplay.getFrameBuffer();
+  if (!frameBuffer) {
+    Serial.printf("[%lu] [GFX] !! No framebuffer\n", millis());
+    return;
+  }
+
+  // Clip the bitmap once against the logical screen, which maps exactly onto the physical panel
+  GlyphBlit blit = {};
+  blit.startGlyphX = std::max(0, -originX);
+  blit.endGlyphX = std::min(width, getScreenWidth() - originX);
+  blit.startGlyphY = std::max(0, -originY);
+  blit.endGlyphY = std::min(height, getScreenHeight() - originY);
+
+  if (blit.startGlyphX < blit.endGlyphX && blit.startGlyphY < blit.endGlyphY) {
+    rotateCoordinates(originX + blit.startGlyphX, originY + blit.startGlyphY, &blit.physX, &blit.physY);
+    // Physical direction of increasing logical x (along a glyph row) and y (down to the next row), see
+    // rotateCoordinates
+    switch (orientation) {
+      case Portrait:
+        blit.colStepY = -1;
+        blit.rowStepX = 1;
+        break;
+      case LandscapeClockwise:
+        blit.colStepX = -1;
+        blit.rowStepY = -1;
+        break;
+      case PortraitInverted:
+        blit.colStepY = 1;
+        blit.rowStepX = -1;
+        break;
+      case LandscapeCounterClockwise:
+        blit.colStepX = 1;
+        blit.rowStepY = 1;
+        break;
+    }
+
+    // The raw value from a 2-bit font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
+    // BW: everything but white (also paints over the grays)
+    // MSB: light and dark gray, LSB: dark gray only
+    // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
+    // 1-bit fonts draw their set bits with the requested pixel state in every mode
+    static constexpr bool bwOn[4] = {false, true, true, true};
+    static constexpr bool bwThresholdOn[4] = {false, false, true, true};
+    static constexpr bool msbOn[4] = {false, true, true, false};
+    static constexpr bool lsbOn[4] = {false, false, true, false};
+    static constexpr bool setBitOn[2] = {false, true};
+    const auto drawPlanes = [&](const auto& planes) {
+      if (is2Bit) {
+        blitGlyph<Glyph2BitReader>(planes, blit, width, [bitmap](const int pixelPosition) {
+          return Glyph2BitReader(bitmap, pixelPosition);
+        });
+      } else {
+        blitGlyph<Glyph1BitReader>(planes, blit, width, [bitmap](const int pixelPosition) {
+          return Glyph1BitReader(bitmap, pixelPosition);
+        });
       }
+    };
+
+    uint8_t* const frameBufferChunks[] = {frameBuffer};
+    if (renderMode == BW_AND_GRAYSCALE && grayLsbChunks[0] && grayMsbChunks[0]) {
+      // Decode once and emit the BW framebuffer and both grayscale planes together
+      const GlyphPlane planes[] = {
+          {frameBufferChunks, EInkDisplay::DISPLAY_HEIGHT, is2Bit ? bwOn : setBitOn, pixelState},
+          {grayLsbChunks, GRAY_PLANE_ROWS_PER_CHUNK, is2Bit ? lsbOn : setBitOn, is2Bit ? false : pixelState},
+          {grayMsbChunks, GRAY_PLANE_ROWS_PER_CHUNK, is2Bit ? msbOn : setBitOn, is2Bit ? false : pixelState},
+      };
+      drawPlanes(planes);
+    } else {
+      const bool* onForValue = setBitOn;
+      bool planeState = pixelState;
+      if (is2Bit) {
+        onForValue = renderMode == GRAYSCALE_MSB ? msbOn
+                     : renderMode == GRAYSCALE_LSB ? lsbOn
+                     : thresholdGrays              ? bwThresholdOn
+                                                   : bwOn;
+        planeState = renderMode == GRAYSCALE_MSB || renderMode == GRAYSCALE_LSB ? false : pixelState;
+      }
+      const GlyphPlane planes[] = {{frameBufferChunks, EInkDisplay::DISPLAY_HEIGHT, onForValue, planeState}};
+      drawPlanes(planes);
     }
   }
+}
 
-  *x += glyph->advanceX;
+void GfxRenderer::drawImageRows(const uint8_t* rows, const int x, const int y, const int width,
+                                const int rowCount) const {
+  // Rows start on a byte boundary, so each one is blitted as its own single-row bitmap
+  const int rowBytes = (width + 3) / 4;
+  for (int row = 0; row < rowCount; row++) {
+    drawPackedPixels(rows + row * rowBytes, true, x, y + row, width, 1, true, bwImageThreshold);
+  }
 }
 
 void GfxRenderer::getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const {
@@ -9,7 +9,9 @@
 
 class GfxRenderer {
  public:
-  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+  // BW_AND_GRAYSCALE draws text into the BW framebuffer and both grayscale planes in one pass, see
+  // allocateGrayscalePlanes. Other primitives only draw into the BW framebuffer in that mode.
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, BW_AND_GRAYSCALE };
 
   // Logical screen orientation from the perspective of callers
   enum Orientation {
@@ -24,20 +26,45 @@ class GfxRenderer {
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = EInkDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
   static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == EInkDisplay::BUFFER_SIZE,
                 "BW buffer chunking does not line up with display buffer size");
+  static constexpr int GRAY_PLANE_ROWS_PER_CHUNK = BW_BUFFER_CHUNK_SIZE / EInkDisplay::DISPLAY_WIDTH_BYTES;
+  static_assert(GRAY_PLANE_ROWS_PER_CHUNK * EInkDisplay::DISPLAY_WIDTH_BYTES == BW_BUFFER_CHUNK_SIZE,
+                "Grayscale plane chunks must hold whole panel rows");
 
   EInkDisplay& einkDisplay;
   RenderMode renderMode;
   Orientation orientation;
+  bool bwImageThreshold = false;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  uint8_t* grayLsbChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  uint8_t* grayMsbChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
   std::map<int, EpdFontFamily> fontMap;
-  void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
-                  EpdFontFamily::Style style) const;
+  // Direct-mapped cache of glyph lookups that miss EpdFont's ASCII fast path, keyed on the font resolved from
+  // (fontId, style) and the codepoint. Not locked, text is only measured or drawn by one task at a time.
+  struct GlyphCacheEntry {
+    const EpdFont* font;
+    uint32_t cp;
+    const EpdGlyph* glyph;
+  };
+  static constexpr size_t GLYPH_CACHE_SIZE = 128;
+  mutable GlyphCacheEntry glyphCache[GLYPH_CACHE_SIZE] = {};
+  mutable size_t glyphCacheMisses = 0;
+  const EpdFontFamily* getFontFamily(int fontId) const;
+  const EpdGlyph* getGlyph(const EpdFont* font, uint32_t cp) const;
+  void getTextDimensions(const EpdFont* font, const char* text, int* w, int* h) const;
+  void renderChar(const EpdFont* font, const EpdGlyph* glyph, int* x, const int* y, bool pixelState) const;
+  // Draws a bitmap packed like EpdFont glyph data with its top left corner at the logical origin, clipped to the screen
+  // thresholdGrays draws only the dark gray and black of 2-bit data in BW mode, for renders no grayscale passes follow
+  void drawPackedPixels(const uint8_t* bitmap, bool is2Bit, int originX, int originY, int width, int height,
+                        bool pixelState, bool thresholdGrays = false) const;
   void freeBwBufferChunks();
   void rotateCoordinates(int x, int y, int* rotatedX, int* rotatedY) const;
 
  public:
   explicit GfxRenderer(EInkDisplay& einkDisplay) : einkDisplay(einkDisplay), renderMode(BW), orientation(Portrait) {}
-  ~GfxRenderer() { freeBwBufferChunks(); }
+  ~GfxRenderer() {
+    freeBwBufferChunks();
+    freeGrayscalePlanes();
+  }
 
   static constexpr int VIEWABLE_MARGIN_TOP = 9;
   static constexpr int VIEWABLE_MARGIN_RIGHT = 3;
@@ -68,6 +95,9 @@ class GfxRenderer {
   void drawImage(const uint8_t bitmap[], int x, int y, int width, int height) const;
   void drawBitmap(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight, float cropX = 0,
                   float cropY = 0) const;
+  // Draws rows of 2-bit pixels (0 = white to 3 = black) packed 4 to a byte, each row starting on a new byte. Unlike
+  // the other primitives this also fills both grayscale planes in BW_AND_GRAYSCALE mode, like text.
+  void drawImageRows(const uint8_t* rows, int x, int y, int width, int rowCount) const;
 
   // Text
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
@@ -76,6 +106,8 @@ class GfxRenderer {
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
                 EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getSpaceWidth(int fontId) const;
+  // Glyph lookups the cache could not answer since construction, for measuring it
+  size_t getGlyphCacheMisses() const { return glyphCacheMisses; }
   int getFontAscenderSize(int fontId) const;
   int getLineHeight(int fontId) const;
   std::string truncatedText(int fontId, const char* text, int maxWidth,
@@ -94,12 +126,19 @@ class GfxRenderer {
  public:
   // Grayscale functions
   void setRenderMode(const RenderMode mode) { this->renderMode = mode; }
+  // Set for BW renders that are shown without grayscale passes. drawImageRows then draws light gray as white and dark
+  // gray as black, instead of every gray as black which is only right when the grayscale passes lighten them after.
+  void setBwImageThreshold(const bool threshold) { bwImageThreshold = threshold; }
   void copyGrayscaleLsbBuffers() const;
   void copyGrayscaleMsbBuffers() const;
   void displayGrayBuffer() const;
   bool storeBwBuffer();  // Returns true if buffer was stored successfully
   void restoreBwBuffer();
   void cleanupGrayscaleWithFrameBuffer() const;
+  // Returns true if both planes are allocated and zeroed for one BW_AND_GRAYSCALE render
+  bool allocateGrayscalePlanes();
+  void freeGrayscalePlanes();
+  void displayGrayscalePlanes();
 
   // Low level functions
   uint8_t* getFrameBuffer() const;
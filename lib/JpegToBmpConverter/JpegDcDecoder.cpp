@@ -0,0 +1,480 @@
+#include "JpegDcDecoder.h"
+
+#include <HardwareSerial.h>
+#include <SdFat.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr int M_SOF2 = 0xC2;
+constexpr int M_DHT = 0xC4;
+constexpr int M_DAC = 0xCC;
+constexpr int M_RST0 = 0xD0;
+constexpr int M_RST7 = 0xD7;
+constexpr int M_SOI = 0xD8;
+constexpr int M_EOI = 0xD9;
+constexpr int M_SOS = 0xDA;
+constexpr int M_DQT = 0xDB;
+constexpr int M_DRI = 0xDD;
+
+// Largest DC difference category for 8-bit samples
+constexpr int MAX_DC_CATEGORY = 11;
+}  // namespace
+
+JpegDcDecoder::~JpegDcDecoder() {
+  free(lumaRows);
+  free(chromaOffsets);
+}
+
+int JpegDcDecoder::readByte() {
+  if (bufferPos >= bufferFilled) {
+    bufferFilled = file.read(buffer, sizeof(buffer));
+    bufferPos = 0;
+    if (bufferFilled <= 0) {
+      bufferFilled = 0;
+      failed = true;
+      return -1;
+    }
+  }
+  return buffer[bufferPos++];
+}
+
+bool JpegDcDecoder::readU16(uint16_t* value) {
+  const int high = readByte();
+  const int low = readByte();
+  if (high < 0 || low < 0) {
+    return false;
+  }
+  *value = static_cast<uint16_t>(high << 8 | low);
+  return true;
+}
+
+bool JpegDcDecoder::skipSegment() {
+  uint16_t length;
+  if (!readU16(&length) || length < 2) {
+    return false;
+  }
+  for (int i = 2; i < length; i++) {
+    if (readByte() < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int JpegDcDecoder::nextMarker() {
+  if (pendingMarker) {
+    const int marker = pendingMarker;
+    pendingMarker = 0;
+    return marker;
+  }
+
+  int byte = readByte();
+  while (byte >= 0 && byte != 0xFF) {
+    byte = readByte();
+  }
+  // Any number of 0xFF fill bytes may precede the marker code
+  while (byte == 0xFF) {
+    byte = readByte();
+  }
+  return byte;
+}
+
+bool JpegDcDecoder::parseFrame() {
+  uint16_t length, frameHeight, frameWidth;
+  if (!readU16(&length)) {
+    return false;
+  }
+  const int precision = readByte();
+  if (!readU16(&frameHeight) || !readU16(&frameWidth)) {
+    return false;
+  }
+  componentCount = readByte();
+  if (precision != 8 || frameWidth == 0 || frameHeight == 0 ||
+      (componentCount != 1 && componentCount != MAX_COMPONENTS) || length != 8 + 3 * componentCount) {
+    Serial.printf("[%lu] [JPG] Unsupported progressive frame (%d-bit, %dx%d, %d components)\n", millis(), precision,
+                  frameWidth, frameHeight, componentCount);
+    return false;
+  }
+  width = frameWidth;
+  height = frameHeight;
+
+  for (int i = 0; i < componentCount; i++) {
+    Component& component = components[i];
+    component.id = readByte();
+    const int sampling = readByte();
+    component.h = sampling >> 4;
+    component.v = sampling & 0x0F;
+    component.quantTable = readByte() & 0x03;
+    if (component.h < 1 || component.h > 4 || component.v < 1 || component.v > 4 ||
+        component.h > components[0].h || component.v > components[0].v) {
+      // The 1/8 scale relies on luma having a block for every 8x8 pixels
+      Serial.printf("[%lu] [JPG] Unsupported sampling factors %dx%d on component %d\n", millis(), component.h,
+                    component.v, i);
+      return false;
+    }
+  }
+  return !failed;
+}
+
+bool JpegDcDecoder::parseHuffmanTables() {
+  uint16_t length;
+  if (!readU16(&length)) {
+    return false;
+  }
+  int remaining = length - 2;
+  while (remaining > 0) {
+    const int classAndId = readByte();
+    if (classAndId < 0 || (classAndId & 0x0F) > 3) {
+      return false;
+    }
+    uint8_t counts[16];
+    int total = 0;
+    for (uint8_t& count : counts) {
+      const int value = readByte();
+      if (value < 0) {
+        return false;
+      }
+      count = value;
+      total += value;
+    }
+    remaining -= 17 + total;
+
+    if (classAndId >> 4 != 0) {
+      // AC tables are never needed
+      for (int i = 0; i < total; i++) {
+        readByte();
+      }
+      continue;
+    }
+    if (total > MAX_HUFFMAN_VALUES) {
+      Serial.printf("[%lu] [JPG] DC Huffman table has %d values\n", millis(), total);
+      return false;
+    }
+    HuffmanTable& table = dcTables[classAndId & 0x0F];
+    memcpy(table.counts, counts, sizeof(counts));
+    for (int i = 0; i < total; i++) {
+      table.values[i] = readByte();
+    }
+    table.defined = true;
+  }
+  return remaining == 0 && !failed;
+}
+
+bool JpegDcDecoder::parseQuantTables() {
+  uint16_t length;
+  if (!readU16(&length)) {
+    return false;
+  }
+  int remaining = length - 2;
+  while (remaining > 0) {
+    const int precisionAndId = readByte();
+    if (precisionAndId < 0) {
+      return false;
+    }
+    const bool wide = precisionAndId >> 4 != 0;
+    // Only the first entry, which scales the DC coefficient, is kept
+    uint16_t dcQuant;
+    if (wide) {
+      if (!readU16(&dcQuant)) {
+        return false;
+      }
+    } else {
+      dcQuant = readByte();
+    }
+    quantDc[precisionAndId & 0x03] = dcQuant;
+    for (int i = 1; i < 64; i++) {
+      readByte();
+      if (wide) readByte();
+    }
+    remaining -= wide ? 129 : 65;
+  }
+  return remaining == 0 && !failed;
+}
+
+// Returns false if the scan header is bad, otherwise leaves scanComponentCount at 0 when the scan can't be used
+bool JpegDcDecoder::parseScan() {
+  uint16_t length;
+  if (!readU16(&length)) {
+    return false;
+  }
+  const int count = readByte();
+  if (count < 1 || count > componentCount || length != 6 + 2 * count) {
+    return false;
+  }
+
+  bool hasLuma = false;
+  scanHasChroma = false;
+  for (int i = 0; i < count; i++) {
+    const int id = readByte();
+    const int tables = readByte();
+    int index = 0;
+    while (index < componentCount && components[index].id != id) {
+      index++;
+    }
+    if (index == componentCount) {
+      return false;
+    }
+    components[index].dcTable = (tables >> 4) & 0x03;
+    scanComponents[i] = index;
+    hasLuma |= index == 0;
+    scanHasChroma |= index == 1;
+  }
+  const int spectralStart = readByte();
+  const int spectralEnd = readByte();
+  const int approximation = readByte();
+  successiveLow = approximation & 0x0F;
+
+  // Only a first DC scan holds the DC values, later ones refine them a bit at a time
+  scanComponentCount = 0;
+  if (spectralStart == 0 && spectralEnd == 0 && approximation >> 4 == 0 && hasLuma) {
+    scanComponentCount = count;
+  }
+  return !failed;
+}
+
+bool JpegDcDecoder::skipEntropyData() {
+  while (true) {
+    int byte = readByte();
+    if (byte != 0xFF) {
+      if (byte < 0) {
+        return false;
+      }
+      continue;
+    }
+    while (byte == 0xFF) {
+      byte = readByte();
+    }
+    // Stuffed zero bytes and restart markers are part of the scan
+    if (byte == 0 || (byte >= M_RST0 && byte <= M_RST7)) {
+      continue;
+    }
+    if (byte < 0) {
+      return false;
+    }
+    pendingMarker = byte;
+    return true;
+  }
+}
+
+bool JpegDcDecoder::begin() {
+  if (readByte() != 0xFF || readByte() != M_SOI) {
+    Serial.printf("[%lu] [JPG] Not a JPEG file\n", millis());
+    return false;
+  }
+
+  bool frameSeen = false;
+  while (true) {
+    const int marker = nextMarker();
+    bool ok = true;
+    if (marker == M_SOF2) {
+      ok = parseFrame();
+      frameSeen = ok;
+    } else if (marker == M_DHT) {
+      ok = parseHuffmanTables();
+    } else if (marker == M_DQT) {
+      ok = parseQuantTables();
+    } else if (marker == M_DRI) {
+      uint16_t length, interval;
+      ok = readU16(&length) && length == 4 && readU16(&interval);
+      restartInterval = interval;
+    } else if (marker == M_SOS) {
+      ok = frameSeen && parseScan();
+      if (ok && scanComponentCount > 0) {
+        break;
+      }
+      ok = ok && skipEntropyData();
+    } else if (marker < 0 || marker == M_EOI) {
+      Serial.printf("[%lu] [JPG] No DC scan found\n", millis());
+      return false;
+    } else if (marker >= 0xC0 && marker <= 0xCF && marker != M_DHT && marker != M_DAC) {
+      Serial.printf("[%lu] [JPG] Unsupported JPEG frame type 0x%02X\n", millis(), marker);
+      return false;
+    } else {
+      ok = skipSegment();
+    }
+    if (!ok) {
+      Serial.printf("[%lu] [JPG] Bad JPEG segment 0x%02X\n", millis(), marker);
+      return false;
+    }
+  }
+
+  for (int i = 0; i < scanComponentCount; i++) {
+    if (!dcTables[components[scanComponents[i]].dcTable].defined) {
+      Serial.printf("[%lu] [JPG] DC scan uses an undefined Huffman table\n", millis());
+      return false;
+    }
+  }
+
+  if (scanComponentCount == 1) {
+    // Non-interleaved scans have one block per MCU, in the component's own block grid
+    mcusPerRow = getDcWidth();
+    mcuRowsLeft = getDcHeight();
+    lumaStride = mcusPerRow;
+    rowsPerMcuRow = 1;
+  } else {
+    mcusPerRow = (width + 8 * components[0].h - 1) / (8 * components[0].h);
+    mcuRowsLeft = (height + 8 * components[0].v - 1) / (8 * components[0].v);
+    lumaStride = mcusPerRow * components[0].h;
+    rowsPerMcuRow = components[0].v;
+  }
+  rowInMcuRow = rowsPerMcuRow;
+  restartsLeft = restartInterval;
+  for (auto& component : components) {
+    component.dcPred = 0;
+  }
+
+  lumaRows = static_cast<int16_t*>(malloc(lumaStride * rowsPerMcuRow * sizeof(int16_t)));
+  if (scanComponentCount > 1 && scanHasChroma) {
+    chromaOffsets = static_cast<int16_t*>(malloc(mcusPerRow * sizeof(int16_t)));
+  }
+  if (!lumaRows || (scanComponentCount > 1 && scanHasChroma && !chromaOffsets)) {
+    Serial.printf("[%lu] [JPG] Failed to allocate DC block row (%d blocks)\n", millis(), lumaStride * rowsPerMcuRow);
+    return false;
+  }
+
+  Serial.printf("[%lu] [JPG] Progressive JPEG %dx%d, decoding DC scan of %d components at %dx%d\n", millis(), width,
+                height, scanComponentCount, getDcWidth(), getDcHeight());
+  return true;
+}
+
+int JpegDcDecoder::readBit() {
+  if (bitCount == 0) {
+    int byte = 0;
+    // Once a marker turns up the scan is over, pad with zeros like other decoders do
+    if (!pendingMarker) {
+      byte = readByte();
+      if (byte == 0xFF) {
+        int next = readByte();
+        while (next == 0xFF) {
+          next = readByte();
+        }
+        if (next != 0) {
+          pendingMarker = next < 0 ? M_EOI : next;
+          byte = 0;
+        }
+      } else if (byte < 0) {
+        byte = 0;
+      }
+    }
+    bitBuffer = byte;
+    bitCount = 8;
+  }
+  bitCount--;
+  return (bitBuffer >> bitCount) & 1;
+}
+
+int JpegDcDecoder::receiveBits(const int count) {
+  int value = 0;
+  for (int i = 0; i < count; i++) {
+    value = value << 1 | readBit();
+  }
+  return value;
+}
+
+// Canonical Huffman decode, one bit at a time
+int JpegDcDecoder::decodeHuffman(const HuffmanTable& table) {
+  int code = 0;
+  int first = 0;
+  int index = 0;
+  for (const uint8_t count : table.counts) {
+    code |= readBit();
+    if (code - first < count) {
+      return table.values[index + code - first];
+    }
+    index += count;
+    first = (first + count) << 1;
+    code <<= 1;
+  }
+  return -1;
+}
+
+bool JpegDcDecoder::decodeDc(Component& component, int* value) {
+  const int category = decodeHuffman(dcTables[component.dcTable]);
+  if (category < 0 || category > MAX_DC_CATEGORY) {
+    return false;
+  }
+  int diff = receiveBits(category);
+  if (category > 0 && diff < 1 << (category - 1)) {
+    diff -= (1 << category) - 1;
+  }
+  component.dcPred += diff;
+
+  // Dequantized DC over 8 is the block's mean offset from mid gray
+  const int coefficient = component.dcPred * (1 << successiveLow);
+  *value = (coefficient * quantDc[component.quantTable] + 4) >> 3;
+  return true;
+}
+
+bool JpegDcDecoder::processRestart() {
+  bitCount = 0;
+  const int marker = nextMarker();
+  if (marker != M_RST0 + (nextRestart & 7)) {
+    Serial.printf("[%lu] [JPG] Expected restart marker %d, got 0x%02X\n", millis(), nextRestart & 7, marker);
+    return false;
+  }
+  nextRestart++;
+  restartsLeft = restartInterval;
+  for (auto& component : components) {
+    component.dcPred = 0;
+  }
+  return true;
+}
+
+bool JpegDcDecoder::decodeMcuRow() {
+  for (int mcuX = 0; mcuX < mcusPerRow; mcuX++) {
+    if (restartInterval) {
+      if (restartsLeft == 0 && !processRestart()) {
+        return false;
+      }
+      restartsLeft--;
+    }
+
+    for (int i = 0; i < scanComponentCount; i++) {
+      const int index = scanComponents[i];
+      Component& component = components[index];
+      const int blocksH = scanComponentCount == 1 ? 1 : component.h;
+      const int blocksV = scanComponentCount == 1 ? 1 : component.v;
+      for (int blockY = 0; blockY < blocksV; blockY++) {
+        for (int blockX = 0; blockX < blocksH; blockX++) {
+          int value;
+          if (!decodeDc(component, &value)) {
+            Serial.printf("[%lu] [JPG] Bad DC code in MCU %d\n", millis(), mcuX);
+            return false;
+          }
+          if (index == 0) {
+            lumaRows[blockY * lumaStride + mcuX * blocksH + blockX] = static_cast<int16_t>(value);
+          } else if (index == 1 && chromaOffsets && blockX == 0 && blockY == 0) {
+            chromaOffsets[mcuX] = static_cast<int16_t>(value);
+          }
+        }
+      }
+    }
+  }
+  return !failed;
+}
+
+bool JpegDcDecoder::readRow(uint8_t* grayRow) {
+  if (rowInMcuRow == rowsPerMcuRow) {
+    if (mcuRowsLeft == 0 || !decodeMcuRow()) {
+      return false;
+    }
+    mcuRowsLeft--;
+    rowInMcuRow = 0;
+  }
+
+  const int16_t* luma = lumaRows + rowInMcuRow * lumaStride;
+  const int lumaPerMcu = scanComponentCount == 1 ? 1 : components[0].h;
+  for (int x = 0; x < getDcWidth(); x++) {
+    int gray = luma[x] + 128;
+    if (chromaOffsets) {
+      // Gray is (R + 2G + B) / 4 like the baseline path, which works out to about Y + 0.27 (Cb - 128) as Cr all but
+      // cancels
+      gray += chromaOffsets[x / lumaPerMcu] * 69 / 256;
+    }
+    grayRow[x] = static_cast<uint8_t>(gray < 0 ? 0 : gray > 255 ? 255 : gray);
+  }
+  rowInMcuRow++;
+  return true;
+}
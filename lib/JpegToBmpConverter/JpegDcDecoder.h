@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+
+class FsFile;
+
+// Decodes the first DC scan of a progressive JPEG into a 1/8 scale image, one gray pixel per 8x8 block. The AC scans
+// are never read, so only a row of blocks is held in memory whatever the image size.
+class JpegDcDecoder {
+ public:
+  explicit JpegDcDecoder(FsFile& file) : file(file) {}
+  ~JpegDcDecoder();
+  JpegDcDecoder(const JpegDcDecoder& other) = delete;
+  JpegDcDecoder& operator=(const JpegDcDecoder& other) = delete;
+
+  // Parses the headers up to the first DC scan covering the luma component and allocates the block row
+  bool begin();
+  int getWidth() const { return width; }
+  int getHeight() const { return height; }
+  int getDcWidth() const { return (width + 7) / 8; }
+  int getDcHeight() const { return (height + 7) / 8; }
+  // Decodes the next row of getDcWidth() gray pixels
+  bool readRow(uint8_t* grayRow);
+
+ private:
+  static constexpr int MAX_COMPONENTS = 3;
+  static constexpr int MAX_HUFFMAN_VALUES = 16;
+
+  struct HuffmanTable {
+    uint8_t counts[16];
+    uint8_t values[MAX_HUFFMAN_VALUES];
+    bool defined;
+  };
+
+  struct Component {
+    uint8_t id;
+    uint8_t h;
+    uint8_t v;
+    uint8_t quantTable;
+    uint8_t dcTable;
+    int dcPred;
+  };
+
+  FsFile& file;
+  uint8_t buffer[512];
+  int bufferPos = 0;
+  int bufferFilled = 0;
+  bool failed = false;
+
+  int width = 0;
+  int height = 0;
+  int componentCount = 0;
+  Component components[MAX_COMPONENTS] = {};
+  uint16_t quantDc[4] = {};
+  HuffmanTable dcTables[4] = {};
+  int restartInterval = 0;
+
+  // Current scan, by index into components
+  int scanComponents[MAX_COMPONENTS] = {};
+  int scanComponentCount = 0;
+  int successiveLow = 0;
+  bool scanHasChroma = false;
+  int mcusPerRow = 0;
+  int mcuRowsLeft = 0;
+  int restartsLeft = 0;
+  int nextRestart = 0;
+
+  // Bit reader over the entropy-coded data
+  uint32_t bitBuffer = 0;
+  int bitCount = 0;
+  int pendingMarker = 0;
+
+  // One MCU row of dequantized luma DC values, and the blue chroma offset for each MCU when the scan carries it
+  int16_t* lumaRows = nullptr;
+  int16_t* chromaOffsets = nullptr;
+  int lumaStride = 0;
+  int rowsPerMcuRow = 0;
+  int rowInMcuRow = 0;
+
+  int readByte();
+  bool readU16(uint16_t* value);
+  bool skipSegment();
+  int nextMarker();
+  bool parseFrame();
+  bool parseHuffmanTables();
+  bool parseQuantTables();
+  bool parseScan();
+  bool skipEntropyData();
+  int readBit();
+  int receiveBits(int count);
+  int decodeHuffman(const HuffmanTable& table);
+  bool decodeDc(Component& component, int* value);
+  bool processRestart();
+  bool decodeMcuRow();
+};
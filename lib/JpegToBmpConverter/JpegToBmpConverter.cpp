@@ -7,7 +7,8 @@
 #include <cstdio>
 #include <cstring>
 
-#include "BitmapHelpers.h"
+#include "DitheredImageWriter.h"
+#include "JpegDcDecoder.h"
 
 // Context structure for picojpeg callback
 struct JpegReadContext {
@@ -17,116 +18,6 @@ struct JpegReadContext {
   size_t bufferFilled;
 };
 
-// ============================================================================
-// IMAGE PROCESSING OPTIONS - Toggle these to test different configurations
-// ============================================================================
-constexpr bool USE_8BIT_OUTPUT = false;  // true: 8-bit grayscale (no quantization), false: 2-bit (4 levels)
-// Dithering method selection (only one should be true, or all false for simple quantization):
-constexpr bool USE_ATKINSON = true;          // Atkinson dithering (cleaner than F-S, less error diffusion)
-constexpr bool USE_FLOYD_STEINBERG = false;  // Floyd-Steinberg error diffusion (can cause "worm" artifacts)
-constexpr bool USE_NOISE_DITHERING = false;  // Hash-based noise dithering (good for downsampling)
-// Pre-resize to target display size (CRITICAL: avoids dithering artifacts from post-downsampling)
-constexpr bool USE_PRESCALE = true;     // true: scale image to target size before dithering
-constexpr int TARGET_MAX_WIDTH = 480;   // Max width for cover images (portrait display width)
-constexpr int TARGET_MAX_HEIGHT = 800;  // Max height for cover images (portrait display height)
-// ============================================================================
-
-inline void write16(Print& out, const uint16_t value) {
-  out.write(value & 0xFF);
-  out.write((value >> 8) & 0xFF);
-}
-
-inline void write32(Print& out, const uint32_t value) {
-  out.write(value & 0xFF);
-  out.write((value >> 8) & 0xFF);
-  out.write((value >> 16) & 0xFF);
-  out.write((value >> 24) & 0xFF);
-}
-
-inline void write32Signed(Print& out, const int32_t value) {
-  out.write(value & 0xFF);
-  out.write((value >> 8) & 0xFF);
-  out.write((value >> 16) & 0xFF);
-  out.write((value >> 24) & 0xFF);
-}
-
-// Helper function: Write BMP header with 8-bit grayscale (256 levels)
-void writeBmpHeader8bit(Print& bmpOut, const int width, const int height) {
-  // Calculate row padding (each row must be multiple of 4 bytes)
-  const int bytesPerRow = (width + 3) / 4 * 4;  // 8 bits per pixel, padded
-  const int imageSize = bytesPerRow * height;
-  const uint32_t paletteSize = 256 * 4;  // 256 colors * 4 bytes (BGRA)
-  const uint32_t fileSize = 14 + 40 + paletteSize + imageSize;
-
-  // BMP File Header (14 bytes)
-  bmpOut.write('B');
-  bmpOut.write('M');
-  write32(bmpOut, fileSize);
-  write32(bmpOut, 0);                      // Reserved
-  write32(bmpOut, 14 + 40 + paletteSize);  // Offset to pixel data
-
-  // DIB Header (BITMAPINFOHEADER - 40 bytes)
-  write32(bmpOut, 40);
-  write32Signed(bmpOut, width);
-  write32Signed(bmpOut, -height);  // Negative height = top-down bitmap
-  write16(bmpOut, 1);              // Color planes
-  write16(bmpOut, 8);              // Bits per pixel (8 bits)
-  write32(bmpOut, 0);              // BI_RGB (no compression)
-  write32(bmpOut, imageSize);
-  write32(bmpOut, 2835);  // xPixelsPerMeter (72 DPI)
-  write32(bmpOut, 2835);  // yPixelsPerMeter (72 DPI)
-  write32(bmpOut, 256);   // colorsUsed
-  write32(bmpOut, 256);   // colorsImportant
-
-  // Color Palette (256 grayscale entries x 4 bytes = 1024 bytes)
-  for (int i = 0; i < 256; i++) {
-    bmpOut.write(static_cast<uint8_t>(i));  // Blue
-    bmpOut.write(static_cast<uint8_t>(i));  // Green
-    bmpOut.write(static_cast<uint8_t>(i));  // Red
-    bmpOut.write(static_cast<uint8_t>(0));  // Reserved
-  }
-}
-
-// Helper function: Write BMP header with 2-bit color depth
-void JpegToBmpConverter::writeBmpHeader(Print& bmpOut, const int width, const int height) {
-  // Calculate row padding (each row must be multiple of 4 bytes)
-  const int bytesPerRow = (width * 2 + 31) / 32 * 4;  // 2 bits per pixel, round up
-  const int imageSize = bytesPerRow * height;
-  const uint32_t fileSize = 70 + imageSize;  // 14 (file header) + 40 (DIB header) + 16 (palette) + image
-
-  // BMP File Header (14 bytes)
-  bmpOut.write('B');
-  bmpOut.write('M');
-  write32(bmpOut, fileSize);  // File size
-  write32(bmpOut, 0);         // Reserved
-  write32(bmpOut, 70);        // Offset to pixel data
-
-  // DIB Header (BITMAPINFOHEADER - 40 bytes)
-  write32(bmpOut, 40);
-  write32Signed(bmpOut, width);
-  write32Signed(bmpOut, -height);  // Negative height = top-down bitmap
-  write16(bmpOut, 1);              // Color planes
-  write16(bmpOut, 2);              // Bits per pixel (2 bits)
-  write32(bmpOut, 0);              // BI_RGB (no compression)
-  write32(bmpOut, imageSize);
-  write32(bmpOut, 2835);  // xPixelsPerMeter (72 DPI)
-  write32(bmpOut, 2835);  // yPixelsPerMeter (72 DPI)
-  write32(bmpOut, 4);     // colorsUsed
-  write32(bmpOut, 4);     // colorsImportant
-
-  // Color Palette (4 colors x 4 bytes = 16 bytes)
-  // Format: Blue, Green, Red, Reserved (BGRA)
-  uint8_t palette[16] = {
-      0x00, 0x00, 0x00, 0x00,  // Color 0: Black
-      0x55, 0x55, 0x55, 0x00,  // Color 1: Dark gray (85)
-      0xAA, 0xAA, 0xAA, 0x00,  // Color 2: Light gray (170)
-      0xFF, 0xFF, 0xFF, 0x00   // Color 3: White
-  };
-  for (const uint8_t i : palette) {
-    bmpOut.write(i);
-  }
-}
-
 // Callback function for picojpeg to read JPEG data
 unsigned char JpegToBmpConverter::jpegReadCallback(unsigned char* pBuf, const unsigned char buf_size,
                                                    unsigned char* pBytes_actually_read, void* pCallback_data) {
@@ -159,131 +50,286 @@ unsigned char JpegToBmpConverter::jpegReadCallback(unsigned char* pBuf, const un
   return 0;  // Success
 }
 
-// Core function: Convert JPEG file to 2-bit BMP
-bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut) {
-  Serial.printf("[%lu] [JPG] Converting JPEG to BMP\n", millis());
+namespace {
+// Largest full-resolution MCU row of gray pixels, bigger images are decoded at 1/8 scale
+constexpr int MAX_MCU_ROW_BYTES = 65536;
+// A 1/8 scale image is enlarged at most back to full size
+constexpr int MAX_DC_SCALE_UP = 8;
+
+// Enlarges a 1/8 scale image by an integer factor, interpolating between block centres, and feeds it to the writer.
+// Rows come in one at a time and only the last two are kept.
+class DcImageUpscaler {
+ public:
+  DcImageUpscaler(DitheredImageWriter& writer, const int dcWidth, const int dcHeight, const int factor,
+                  const int width, const int height)
+      : writer(writer),
+        dcWidth(dcWidth),
+        dcHeight(dcHeight),
+        factor(factor),
+        width(width),
+        height(height) {}
+  ~DcImageUpscaler() {
+    free(rows[0]);
+    free(rows[1]);
+    free(outRow);
+  }
+  DcImageUpscaler(const DcImageUpscaler& other) = delete;
+  DcImageUpscaler& operator=(const DcImageUpscaler& other) = delete;
+
+  bool begin() {
+    rows[0] = static_cast<uint8_t*>(malloc(dcWidth));
+    rows[1] = static_cast<uint8_t*>(malloc(dcWidth));
+    outRow = static_cast<uint8_t*>(malloc(width));
+    return rows[0] && rows[1] && outRow;
+  }
 
-  // Setup context for picojpeg callback
-  JpegReadContext context = {.file = jpegFile, .bufferPos = 0, .bufferFilled = 0};
+  // Buffer the next 1/8 scale row is decoded into before pushRow
+  uint8_t* nextRow() { return rows[rowsIn & 1]; }
+
+  // Returns false once the writer has been cancelled
+  bool pushRow() {
+    const int newest = rowsIn++;
+    while (outY < height) {
+      int fracY;
+      const int row0 = sourcePosition(outY, dcHeight, &fracY);
+      const int row1 = fracY ? row0 + 1 : row0;
+      if (row1 > newest) {
+        return true;
+      }
+      const uint8_t* top = rows[row0 & 1];
+      const uint8_t* bottom = rows[row1 & 1];
+      for (int x = 0; x < width; x++) {
+        int fracX;
+        const int col0 = sourcePosition(x, dcWidth, &fracX);
+        const int col1 = fracX ? col0 + 1 : col0;
+        const int upper = top[col0] * (256 - fracX) + top[col1] * fracX;
+        const int lower = bottom[col0] * (256 - fracX) + bottom[col1] * fracX;
+        outRow[x] = static_cast<uint8_t>((upper * (256 - fracY) + lower * fracY + 32768) >> 16);
+      }
+      if (!writer.writeSourceRow(outRow)) {
+        return false;
+      }
+      outY++;
+    }
+    return true;
+  }
 
-  // Initialize picojpeg decoder
+ private:
+  DitheredImageWriter& writer;
+  int dcWidth;
+  int dcHeight;
+  int factor;
+  int width;
+  int height;
+  uint8_t* rows[2] = {nullptr, nullptr};
+  uint8_t* outRow = nullptr;
+  int rowsIn = 0;
+  int outY = 0;
+
+  // Maps an output pixel to the 1/8 scale block at or before its centre and the 1/256ths towards the next block
+  int sourcePosition(const int out, const int count, int* frac) const {
+    const int position = (2 * out + 1) * 128 / factor - 128;
+    if (position <= 0) {
+      *frac = 0;
+      return 0;
+    }
+    if (position >= (count - 1) * 256) {
+      *frac = 0;
+      return count - 1;
+    }
+    *frac = position & 0xFF;
+    return position >> 8;
+  }
+};
+
+// Smallest factor that brings a 1/8 scale image back up to the size the writer will scale it to, so the writer only
+// ever shrinks
+int dcScaleUp(const int width, const int height, const int outWidth, const int outHeight) {
+  const int dcWidth = (width + 7) / 8;
+  const int dcHeight = (height + 7) / 8;
+  int factor = 1;
+  while (factor < MAX_DC_SCALE_UP && (dcWidth * factor < outWidth || dcHeight * factor < outHeight)) {
+    factor++;
+  }
+  return factor;
+}
+}  // namespace
+
+// Decodes at 1/8 scale, from the first DC scan of a progressive JPEG or with picojpeg's reduce mode for baselines,
+// enlarging the result when the output needs more than that
+bool JpegToBmpConverter::jpegDcToStream(FsFile& jpegFile, const bool progressive, Print& out,
+                                        const int targetMaxWidth, const int targetMaxHeight, const bool fitInside,
+                                        const bool writeBmp, int* outWidthResult, int* outHeightResult,
+                                        const std::function<bool()>& cancelFn) {
+  JpegDcDecoder dcDecoder(jpegFile);
+  JpegReadContext context = {.file = jpegFile, .bufferPos = 0, .bufferFilled = 0};
   pjpeg_image_info_t imageInfo;
-  const unsigned char status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 0);
-  if (status != 0) {
-    Serial.printf("[%lu] [JPG] JPEG decode init failed with error code: %d\n", millis(), status);
+  int width, height;
+  if (progressive) {
+    if (!dcDecoder.begin()) {
+      return false;
+    }
+    width = dcDecoder.getWidth();
+    height = dcDecoder.getHeight();
+  } else {
+    const unsigned char status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 1);
+    if (status != 0) {
+      Serial.printf("[%lu] [JPG] JPEG reduced decode init failed with error code: %d\n", millis(), status);
+      return false;
+    }
+    width = imageInfo.m_width;
+    height = imageInfo.m_height;
+  }
+
+  int fullOutWidth, fullOutHeight;
+  DitheredImageWriter::getOutputSize(width, height, targetMaxWidth, targetMaxHeight, fitInside, &fullOutWidth,
+                                     &fullOutHeight);
+  const int factor = dcScaleUp(width, height, fullOutWidth, fullOutHeight);
+  const int dcWidth = (width + 7) / 8;
+  const int dcHeight = (height + 7) / 8;
+  // The enlarged image drops the padding of the last partial block
+  const int srcWidth = (width * factor + 7) / 8;
+  const int srcHeight = (height * factor + 7) / 8;
+  Serial.printf("[%lu] [JPG] Decoding at 1/8 scale (%dx%d), enlarged x%d\n", millis(), dcWidth, dcHeight, factor);
+
+  DitheredImageWriter writer(out, srcWidth, srcHeight, targetMaxWidth, targetMaxHeight, fitInside, writeBmp);
+  writer.setCancelCheck(cancelFn);
+  DcImageUpscaler upscaler(writer, dcWidth, dcHeight, factor, srcWidth, srcHeight);
+  if (!writer.begin() || !upscaler.begin()) {
+    Serial.printf("[%lu] [JPG] Failed to allocate 1/8 scale rows\n", millis());
     return false;
   }
 
-  Serial.printf("[%lu] [JPG] JPEG dimensions: %dx%d, components: %d, MCUs: %dx%d\n", millis(), imageInfo.m_width,
-                imageInfo.m_height, imageInfo.m_comps, imageInfo.m_MCUSPerRow, imageInfo.m_MCUSPerCol);
+  if (progressive) {
+    for (int y = 0; y < dcHeight; y++) {
+      if (!dcDecoder.readRow(upscaler.nextRow())) {
+        Serial.printf("[%lu] [JPG] DC scan ended at row %d of %d\n", millis(), y, dcHeight);
+        return false;
+      }
+      if (!upscaler.pushRow()) {
+        Serial.printf("[%lu] [JPG] Conversion cancelled at row %d of %d\n", millis(), y, dcHeight);
+        return false;
+      }
+    }
+  } else {
+    // In reduce mode each 8x8 block of the MCU buffer holds a single pixel, its first. picojpeg keeps the blocks of an
+    // MCU's lower half 128 bytes in, also for H1V2 whose upper half is a single block.
+    const int blocksPerMcuRow = imageInfo.m_MCUWidth / 8;
+    const int blockRowsPerMcu = imageInfo.m_MCUHeight / 8;
+    const int reducedStride = imageInfo.m_MCUSPerRow * blocksPerMcuRow;
+    auto* reducedRows = static_cast<uint8_t*>(malloc(reducedStride * blockRowsPerMcu));
+    if (!reducedRows) {
+      Serial.printf("[%lu] [JPG] Failed to allocate reduced MCU row (%d bytes)\n", millis(),
+                    reducedStride * blockRowsPerMcu);
+      return false;
+    }
 
-  // Safety limits to prevent memory issues on ESP32
-  constexpr int MAX_IMAGE_WIDTH = 2048;
-  constexpr int MAX_IMAGE_HEIGHT = 3072;
-  constexpr int MAX_MCU_ROW_BYTES = 65536;
+    for (int mcuY = 0; mcuY < imageInfo.m_MCUSPerCol; mcuY++) {
+      for (int mcuX = 0; mcuX < imageInfo.m_MCUSPerRow; mcuX++) {
+        const unsigned char mcuStatus = pjpeg_decode_mcu();
+        if (mcuStatus != 0) {
+          Serial.printf("[%lu] [JPG] JPEG reduced decode MCU failed at (%d, %d) with error code: %d\n", millis(), mcuX,
+                        mcuY, mcuStatus);
+          free(reducedRows);
+          return false;
+        }
+        for (int blockRow = 0; blockRow < blockRowsPerMcu; blockRow++) {
+          for (int blockCol = 0; blockCol < blocksPerMcuRow; blockCol++) {
+            const int offset = blockRow * 128 + blockCol * 64;
+            uint8_t gray;
+            if (imageInfo.m_comps == 1) {
+              gray = imageInfo.m_pMCUBufR[offset];
+            } else {
+              gray = (imageInfo.m_pMCUBufR[offset] * 25 + imageInfo.m_pMCUBufG[offset] * 50 +
+                      imageInfo.m_pMCUBufB[offset] * 25) /
+                     100;
+            }
+            reducedRows[blockRow * reducedStride + mcuX * blocksPerMcuRow + blockCol] = gray;
+          }
+        }
+      }
 
-  if (imageInfo.m_width > MAX_IMAGE_WIDTH || imageInfo.m_height > MAX_IMAGE_HEIGHT) {
-    Serial.printf("[%lu] [JPG] Image too large (%dx%d), max supported: %dx%d\n", millis(), imageInfo.m_width,
-                  imageInfo.m_height, MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
-    return false;
+      for (int blockRow = 0; blockRow < blockRowsPerMcu; blockRow++) {
+        if (mcuY * blockRowsPerMcu + blockRow >= dcHeight) break;
+        memcpy(upscaler.nextRow(), reducedRows + blockRow * reducedStride, dcWidth);
+        if (!upscaler.pushRow()) {
+          Serial.printf("[%lu] [JPG] Conversion cancelled at MCU row %d\n", millis(), mcuY);
+          free(reducedRows);
+          return false;
+        }
+      }
+    }
+    free(reducedRows);
   }
 
-  // Calculate output dimensions (pre-scale to fit display exactly)
-  int outWidth = imageInfo.m_width;
-  int outHeight = imageInfo.m_height;
-  // Use fixed-point scaling (16.16) for sub-pixel accuracy
-  uint32_t scaleX_fp = 65536;  // 1.0 in 16.16 fixed point
-  uint32_t scaleY_fp = 65536;
-  bool needsScaling = false;
-
-  if (USE_PRESCALE && (imageInfo.m_width > TARGET_MAX_WIDTH || imageInfo.m_height > TARGET_MAX_HEIGHT)) {
-    // Calculate scale to fit within target dimensions while maintaining aspect ratio
-    const float scaleToFitWidth = static_cast<float>(TARGET_MAX_WIDTH) / imageInfo.m_width;
-    const float scaleToFitHeight = static_cast<float>(TARGET_MAX_HEIGHT) / imageInfo.m_height;
-    // We scale to the smaller dimension, so we can potentially crop later.
-    // TODO: ideally, we already crop here.
-    const float scale = (scaleToFitWidth > scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
-
-    outWidth = static_cast<int>(imageInfo.m_width * scale);
-    outHeight = static_cast<int>(imageInfo.m_height * scale);
-
-    // Ensure at least 1 pixel
-    if (outWidth < 1) outWidth = 1;
-    if (outHeight < 1) outHeight = 1;
-
-    // Calculate fixed-point scale factors (source pixels per output pixel)
-    // scaleX_fp = (srcWidth << 16) / outWidth
-    scaleX_fp = (static_cast<uint32_t>(imageInfo.m_width) << 16) / outWidth;
-    scaleY_fp = (static_cast<uint32_t>(imageInfo.m_height) << 16) / outHeight;
-    needsScaling = true;
-
-    Serial.printf("[%lu] [JPG] Pre-scaling %dx%d -> %dx%d (fit to %dx%d)\n", millis(), imageInfo.m_width,
-                  imageInfo.m_height, outWidth, outHeight, TARGET_MAX_WIDTH, TARGET_MAX_HEIGHT);
+  if (!writer.finish()) {
+    return false;
   }
 
-  // Write BMP header with output dimensions
-  int bytesPerRow;
-  if (USE_8BIT_OUTPUT) {
-    writeBmpHeader8bit(bmpOut, outWidth, outHeight);
-    bytesPerRow = (outWidth + 3) / 4 * 4;
-  } else {
-    writeBmpHeader(bmpOut, outWidth, outHeight);
-    bytesPerRow = (outWidth * 2 + 31) / 32 * 4;
+  if (outWidthResult) {
+    *outWidthResult = writer.getWidth();
+  }
+  if (outHeightResult) {
+    *outHeightResult = writer.getHeight();
   }
+  Serial.printf("[%lu] [JPG] Successfully converted JPEG\n", millis());
+  return true;
+}
+
+// Core function: Convert JPEG file to a 2-bit BMP, or to bare 2-bit rows for inline images
+bool JpegToBmpConverter::jpegFileToStream(FsFile& jpegFile, Print& out, const int targetMaxWidth,
+                                          const int targetMaxHeight, const bool fitInside, const bool writeBmp,
+                                          int* outWidthResult, int* outHeightResult,
+                                          const std::function<bool()>& cancelFn) {
+  Serial.printf("[%lu] [JPG] Converting JPEG to %s\n", millis(), writeBmp ? "BMP" : "2-bit rows");
+
+  // Setup context for picojpeg callback
+  JpegReadContext context = {.file = jpegFile, .bufferPos = 0, .bufferFilled = 0};
 
-  // Allocate row buffer
-  auto* rowBuffer = static_cast<uint8_t*>(malloc(bytesPerRow));
-  if (!rowBuffer) {
-    Serial.printf("[%lu] [JPG] Failed to allocate row buffer\n", millis());
+  // Initialize picojpeg decoder
+  pjpeg_image_info_t imageInfo;
+  const unsigned char status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 0);
+  if (status == PJPG_UNSUPPORTED_MODE) {
+    // picojpeg only does baseline, but a progressive file's first scan gives the image at 1/8 scale
+    return jpegFile.seek(0) && jpegDcToStream(jpegFile, true, out, targetMaxWidth, targetMaxHeight, fitInside,
+                                              writeBmp, outWidthResult, outHeightResult, cancelFn);
+  }
+  if (status != 0) {
+    Serial.printf("[%lu] [JPG] JPEG decode init failed with error code: %d\n", millis(), status);
     return false;
   }
 
-  // Allocate a buffer for one MCU row worth of grayscale pixels
-  // This is the minimal memory needed for streaming conversion
+  Serial.printf("[%lu] [JPG] JPEG dimensions: %dx%d, components: %d, MCUs: %dx%d\n", millis(), imageInfo.m_width,
+                imageInfo.m_height, imageInfo.m_comps, imageInfo.m_MCUSPerRow, imageInfo.m_MCUSPerCol);
+
+  // Full resolution needs a whole MCU row of pixels, beyond the budget or when the output is no bigger than 1/8 scale
+  // anyway, reduce mode decodes just the DC of each block
   const int mcuPixelHeight = imageInfo.m_MCUHeight;
   const int mcuRowPixels = imageInfo.m_width * mcuPixelHeight;
+  int fullOutWidth, fullOutHeight;
+  DitheredImageWriter::getOutputSize(imageInfo.m_width, imageInfo.m_height, targetMaxWidth, targetMaxHeight, fitInside,
+                                     &fullOutWidth, &fullOutHeight);
+  if (mcuRowPixels > MAX_MCU_ROW_BYTES ||
+      dcScaleUp(imageInfo.m_width, imageInfo.m_height, fullOutWidth, fullOutHeight) == 1) {
+    return jpegFile.seek(0) && jpegDcToStream(jpegFile, false, out, targetMaxWidth, targetMaxHeight, fitInside,
+                                              writeBmp, outWidthResult, outHeightResult, cancelFn);
+  }
 
-  // Validate MCU row buffer size before allocation
-  if (mcuRowPixels > MAX_MCU_ROW_BYTES) {
-    Serial.printf("[%lu] [JPG] MCU row buffer too large (%d bytes), max: %d\n", millis(), mcuRowPixels,
-                  MAX_MCU_ROW_BYTES);
-    free(rowBuffer);
+  DitheredImageWriter writer(out, imageInfo.m_width, imageInfo.m_height, targetMaxWidth, targetMaxHeight, fitInside,
+                             writeBmp);
+  writer.setCancelCheck(cancelFn);
+  if (!writer.begin()) {
     return false;
   }
 
+  // Allocate a buffer for one MCU row worth of grayscale pixels
+  // This is the minimal memory needed for streaming conversion
   auto* mcuRowBuffer = static_cast<uint8_t*>(malloc(mcuRowPixels));
   if (!mcuRowBuffer) {
     Serial.printf("[%lu] [JPG] Failed to allocate MCU row buffer (%d bytes)\n", millis(), mcuRowPixels);
-    free(rowBuffer);
     return false;
   }
 
-  // Create ditherer if enabled (only for 2-bit output)
-  // Use OUTPUT dimensions for dithering (after prescaling)
-  AtkinsonDitherer* atkinsonDitherer = nullptr;
-  FloydSteinbergDitherer* fsDitherer = nullptr;
-  if (!USE_8BIT_OUTPUT) {
-    if (USE_ATKINSON) {
-      atkinsonDitherer = new AtkinsonDitherer(outWidth);
-    } else if (USE_FLOYD_STEINBERG) {
-      fsDitherer = new FloydSteinbergDitherer(outWidth);
-    }
-  }
-
-  // For scaling: accumulate source rows into scaled output rows
-  // We need to track which source Y maps to which output Y
-  // Using fixed-point: srcY_fp = outY * scaleY_fp (gives source Y in 16.16 format)
-  uint32_t* rowAccum = nullptr;    // Accumulator for each output X (32-bit for larger sums)
-  uint16_t* rowCount = nullptr;    // Count of source pixels accumulated per output X
-  int currentOutY = 0;             // Current output row being accumulated
-  uint32_t nextOutY_srcStart = 0;  // Source Y where next output row starts (16.16 fixed point)
-
-  if (needsScaling) {
-    rowAccum = new uint32_t[outWidth]();
-    rowCount = new uint16_t[outWidth]();
-    nextOutY_srcStart = scaleY_fp;  // First boundary is at scaleY_fp (source Y for outY=1)
-  }
-
   // Process MCUs row-by-row and write to BMP as we go (top-down)
   const int mcuPixelWidth = imageInfo.m_MCUWidth;
 
@@ -302,7 +348,6 @@ bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut) {
                         mcuStatus);
         }
         free(mcuRowBuffer);
-        free(rowBuffer);
         return false;
       }
 
@@ -318,9 +363,7 @@ bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut) {
           const int blockRow = blockY / 8;
           const int localX = blockX % 8;
           const int localY = blockY % 8;
-          const int blocksPerRow = mcuPixelWidth / 8;
-          const int blockIndex = blockRow * blocksPerRow + blockCol;
-          const int pixelOffset = blockIndex * 64 + localY * 8 + localX;
+          const int pixelOffset = blockRow * 128 + blockCol * 64 + localY * 8 + localX;
 
           uint8_t gray;
           if (imageInfo.m_comps == 1) {
@@ -342,131 +385,36 @@ bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut) {
     const int endRow = (mcuY + 1) * mcuPixelHeight;
 
     for (int y = startRow; y < endRow && y < imageInfo.m_height; y++) {
-      const int bufferY = y - startRow;
-
-      if (!needsScaling) {
-        // No scaling - direct output (1:1 mapping)
-        memset(rowBuffer, 0, bytesPerRow);
-
-        if (USE_8BIT_OUTPUT) {
-          for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = mcuRowBuffer[bufferY * imageInfo.m_width + x];
-            rowBuffer[x] = adjustPixel(gray);
-          }
-        } else {
-          for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = adjustPixel(mcuRowBuffer[bufferY * imageInfo.m_width + x]);
-            uint8_t twoBit;
-            if (atkinsonDitherer) {
-              twoBit = atkinsonDitherer->processPixel(gray, x);
-            } else if (fsDitherer) {
-              twoBit = fsDitherer->processPixel(gray, x);
-            } else {
-              twoBit = quantize(gray, x, y);
-            }
-            const int byteIndex = (x * 2) / 8;
-            const int bitOffset = 6 - ((x * 2) % 8);
-            rowBuffer[byteIndex] |= (twoBit << bitOffset);
-          }
-          if (atkinsonDitherer)
-            atkinsonDitherer->nextRow();
-          else if (fsDitherer)
-            fsDitherer->nextRow();
-        }
-        bmpOut.write(rowBuffer, bytesPerRow);
-      } else {
-        // Fixed-point area averaging for exact fit scaling
-        // For each output pixel X, accumulate source pixels that map to it
-        // srcX range for outX: [outX * scaleX_fp >> 16, (outX+1) * scaleX_fp >> 16)
-        const uint8_t* srcRow = mcuRowBuffer + bufferY * imageInfo.m_width;
-
-        for (int outX = 0; outX < outWidth; outX++) {
-          // Calculate source X range for this output pixel
-          const int srcXStart = (static_cast<uint32_t>(outX) * scaleX_fp) >> 16;
-          const int srcXEnd = (static_cast<uint32_t>(outX + 1) * scaleX_fp) >> 16;
-
-          // Accumulate all source pixels in this range
-          int sum = 0;
-          int count = 0;
-          for (int srcX = srcXStart; srcX < srcXEnd && srcX < imageInfo.m_width; srcX++) {
-            sum += srcRow[srcX];
-            count++;
-          }
-
-          // Handle edge case: if no pixels in range, use nearest
-          if (count == 0 && srcXStart < imageInfo.m_width) {
-            sum = srcRow[srcXStart];
-            count = 1;
-          }
-
-          rowAccum[outX] += sum;
-          rowCount[outX] += count;
-        }
-
-        // Check if we've crossed into the next output row
-        // Current source Y in fixed point: y << 16
-        const uint32_t srcY_fp = static_cast<uint32_t>(y + 1) << 16;
-
-        // Output row when source Y crosses the boundary
-        if (srcY_fp >= nextOutY_srcStart && currentOutY < outHeight) {
-          memset(rowBuffer, 0, bytesPerRow);
-
-          if (USE_8BIT_OUTPUT) {
-            for (int x = 0; x < outWidth; x++) {
-              const uint8_t gray = (rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0;
-              rowBuffer[x] = adjustPixel(gray);
-            }
-          } else {
-            for (int x = 0; x < outWidth; x++) {
-              const uint8_t gray = adjustPixel((rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0);
-              uint8_t twoBit;
-              if (atkinsonDitherer) {
-                twoBit = atkinsonDitherer->processPixel(gray, x);
-              } else if (fsDitherer) {
-                twoBit = fsDitherer->processPixel(gray, x);
-              } else {
-                twoBit = quantize(gray, x, currentOutY);
-              }
-              const int byteIndex = (x * 2) / 8;
-              const int bitOffset = 6 - ((x * 2) % 8);
-              rowBuffer[byteIndex] |= (twoBit << bitOffset);
-            }
-            if (atkinsonDitherer)
-              atkinsonDitherer->nextRow();
-            else if (fsDitherer)
-              fsDitherer->nextRow();
-          }
-
-          bmpOut.write(rowBuffer, bytesPerRow);
-          currentOutY++;
-
-          // Reset accumulators for next output row
-          memset(rowAccum, 0, outWidth * sizeof(uint32_t));
-          memset(rowCount, 0, outWidth * sizeof(uint16_t));
-
-          // Update boundary for next output row
-          nextOutY_srcStart = static_cast<uint32_t>(currentOutY + 1) * scaleY_fp;
-        }
+      if (!writer.writeSourceRow(mcuRowBuffer + (y - startRow) * imageInfo.m_width)) {
+        Serial.printf("[%lu] [JPG] Conversion cancelled at MCU row %d\n", millis(), mcuY);
+        free(mcuRowBuffer);
+        return false;
       }
     }
   }
 
-  // Clean up
-  if (rowAccum) {
-    delete[] rowAccum;
-  }
-  if (rowCount) {
-    delete[] rowCount;
+  free(mcuRowBuffer);
+
+  if (!writer.finish()) {
+    return false;
   }
-  if (atkinsonDitherer) {
-    delete atkinsonDitherer;
+
+  if (outWidthResult) {
+    *outWidthResult = writer.getWidth();
   }
-  if (fsDitherer) {
-    delete fsDitherer;
+  if (outHeightResult) {
+    *outHeightResult = writer.getHeight();
   }
-  free(mcuRowBuffer);
-  free(rowBuffer);
-
-  Serial.printf("[%lu] [JPG] Successfully converted JPEG to BMP\n", millis());
+  Serial.printf("[%lu] [JPG] Successfully converted JPEG\n", millis());
   return true;
 }
+
+bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut) {
+  return jpegFileToStream(jpegFile, bmpOut, DitheredImageWriter::COVER_MAX_WIDTH,
+                          DitheredImageWriter::COVER_MAX_HEIGHT, false, true, nullptr, nullptr, nullptr);
+}
+
+bool JpegToBmpConverter::jpegFileToGray2Stream(FsFile& jpegFile, Print& out, const int maxWidth, const int maxHeight,
+                                               int* outWidth, int* outHeight, const std::function<bool()>& cancelFn) {
+  return jpegFileToStream(jpegFile, out, maxWidth, maxHeight, true, false, outWidth, outHeight, cancelFn);
+}
@@ -1,15 +1,27 @@
 #pragma once
 
+#include <functional>
+
 class FsFile;
 class Print;
 class ZipFile;
 
 class JpegToBmpConverter {
-  static void writeBmpHeader(Print& bmpOut, int width, int height);
   // [COMMENTED OUT] static uint8_t grayscaleTo2Bit(uint8_t grayscale, int x, int y);
   static unsigned char jpegReadCallback(unsigned char* pBuf, unsigned char buf_size,
                                         unsigned char* pBytes_actually_read, void* pCallback_data);
+  static bool jpegDcToStream(FsFile& jpegFile, bool progressive, Print& out, int targetMaxWidth, int targetMaxHeight,
+                             bool fitInside, bool writeBmp, int* outWidthResult, int* outHeightResult,
+                             const std::function<bool()>& cancelFn);
+  static bool jpegFileToStream(FsFile& jpegFile, Print& out, int targetMaxWidth, int targetMaxHeight, bool fitInside,
+                               bool writeBmp, int* outWidthResult, int* outHeightResult,
+                               const std::function<bool()>& cancelFn);
 
  public:
   static bool jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut);
+  // Scales the image down to fit maxWidth x maxHeight and writes its width and height as little-endian uint16_t, then
+  // bare rows of 2-bit pixels, 0 = white to 3 = black like EpdFont bitmaps, packed 4 to a byte with each row starting
+  // on a new byte. Stops between rows, returning false, once cancelFn returns true.
+  static bool jpegFileToGray2Stream(FsFile& jpegFile, Print& out, int maxWidth, int maxHeight, int* outWidth,
+                                    int* outHeight, const std::function<bool()>& cancelFn = nullptr);
 };
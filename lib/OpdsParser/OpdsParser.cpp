@@ -4,7 +4,9 @@
 
 #include <cstring>
 
-OpdsParser::~OpdsParser() {
+OpdsParser::~OpdsParser() { freeParser(); }
+
+void OpdsParser::freeParser() {
   if (parser) {
     XML_StopParser(parser, XML_FALSE);
     XML_SetElementHandler(parser, nullptr, nullptr);
@@ -15,7 +17,21 @@ OpdsParser::~OpdsParser() {
 }
 
 bool OpdsParser::parse(const char* xmlData, const size_t length) {
+  if (!setup()) {
+    return false;
+  }
+
+  if (write(reinterpret_cast<const uint8_t*>(xmlData), length) != length) {
+    return false;
+  }
+
+  return finish();
+}
+
+bool OpdsParser::setup() {
+  freeParser();
   clear();
+  parseError = false;
 
   parser = XML_ParserCreate(nullptr);
   if (!parser) {
@@ -26,40 +42,62 @@ bool OpdsParser::parse(const char* xmlData, const size_t length) {
   XML_SetUserData(parser, this);
   XML_SetElementHandler(parser, startElement, endElement);
   XML_SetCharacterDataHandler(parser, characterData);
+  return true;
+}
+
+size_t OpdsParser::write(const uint8_t data) { return write(&data, 1); }
+
+size_t OpdsParser::write(const uint8_t* buffer, const size_t size) {
+  if (!parser) return 0;
 
   // Parse in chunks to avoid large buffer allocations
-  const char* currentPos = xmlData;
-  size_t remaining = length;
+  const uint8_t* currentPos = buffer;
+  size_t remaining = size;
   constexpr size_t chunkSize = 1024;
 
   while (remaining > 0) {
     void* const buf = XML_GetBuffer(parser, chunkSize);
     if (!buf) {
       Serial.printf("[%lu] [OPDS] Couldn't allocate memory for buffer\n", millis());
-      XML_ParserFree(parser);
-      parser = nullptr;
-      return false;
+      parseError = true;
+      freeParser();
+      return 0;
     }
 
     const size_t toRead = remaining < chunkSize ? remaining : chunkSize;
     memcpy(buf, currentPos, toRead);
 
-    const bool isFinal = (remaining == toRead);
-    if (XML_ParseBuffer(parser, static_cast<int>(toRead), isFinal) == XML_STATUS_ERROR) {
+    // The total length isn't known up front, the end of the document is signalled by finish()
+    if (XML_ParseBuffer(parser, static_cast<int>(toRead), XML_FALSE) == XML_STATUS_ERROR) {
       Serial.printf("[%lu] [OPDS] Parse error at line %lu: %s\n", millis(), XML_GetCurrentLineNumber(parser),
                     XML_ErrorString(XML_GetErrorCode(parser)));
-      XML_ParserFree(parser);
-      parser = nullptr;
-      return false;
+      parseError = true;
+      freeParser();
+      return 0;
     }
 
     currentPos += toRead;
     remaining -= toRead;
   }
 
+  return size;
+}
+
+bool OpdsParser::finish() {
+  if (!parser) {
+    return false;
+  }
+
+  if (XML_ParseBuffer(parser, 0, XML_TRUE) == XML_STATUS_ERROR) {
+    Serial.printf("[%lu] [OPDS] Parse error at line %lu: %s\n", millis(), XML_GetCurrentLineNumber(parser),
+                  XML_ErrorString(XML_GetErrorCode(parser)));
+    parseError = true;
+    freeParser();
+    return false;
+  }
+
   // Clean up parser
-  XML_ParserFree(parser);
-  parser = nullptr;
+  freeParser();
 
   Serial.printf("[%lu] [OPDS] Parsed %zu entries\n", millis(), entries.size());
   return true;
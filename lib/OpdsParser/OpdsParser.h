@@ -1,4 +1,5 @@
 #pragma once
+#include <Print.h>
 #include <expat.h>
 
 #include <string>
@@ -29,6 +30,8 @@ using OpdsBook = OpdsEntry;
 /**
  * Parser for OPDS (Open Publication Distribution System) Atom feeds.
  * Uses the Expat XML parser to parse OPDS catalog entries.
+ * The feed can be written to it in chunks as it arrives (setup, write..., finish), so only Expat's buffer
+ * is held rather than the whole document.
  *
  * Usage:
  *   OpdsParser parser;
@@ -42,10 +45,10 @@ using OpdsBook = OpdsEntry;
  *     }
  *   }
  */
-class OpdsParser {
+class OpdsParser final : public Print {
  public:
   OpdsParser() = default;
-  ~OpdsParser();
+  ~OpdsParser() override;
 
   // Disable copy
   OpdsParser(const OpdsParser&) = delete;
@@ -59,6 +62,30 @@ class OpdsParser {
    */
   bool parse(const char* xmlData, size_t length);
 
+  /**
+   * Start an incremental parse, clearing any previous entries. Feed the document through write().
+   * @return true if the parser was created
+   */
+  bool setup();
+
+  /**
+   * Feed the next chunk of the document.
+   * @return size on success, 0 once a parse error has occurred
+   */
+  size_t write(uint8_t) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  /**
+   * Finish an incremental parse once the whole document has been written.
+   * @return true if the document was well formed
+   */
+  bool finish();
+
+  /**
+   * Whether the document written so far failed to parse (as opposed to never being started).
+   */
+  bool hasError() const { return parseError; }
+
   /**
    * Get the parsed entries (both navigation and book entries).
    * @return Vector of OpdsEntry entries
@@ -85,7 +112,10 @@ class OpdsParser {
   // Helper to find attribute value
   static const char* findAttribute(const XML_Char** atts, const char* name);
 
+  void freeParser();
+
   XML_Parser parser = nullptr;
+  bool parseError = false;
   std::vector<OpdsEntry> entries;
   OpdsEntry currentEntry;
   std::string currentText;
@@ -0,0 +1,405 @@
+#include "PngToBmpConverter.h"
+
+#include <DitheredImageWriter.h>
+#include <HardwareSerial.h>
+#include <SdFat.h>
+#include <miniz.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+// Memory grows with the width only (two scanlines), the height just has to fit the prescaler's fixed point maths
+constexpr uint32_t MAX_IMAGE_WIDTH = 2048;
+constexpr uint32_t MAX_IMAGE_HEIGHT = 16384;
+constexpr size_t INPUT_CHUNK_SIZE = 1024;
+
+enum PngColorType : uint8_t {
+  COLOR_GRAY = 0,
+  COLOR_RGB = 2,
+  COLOR_PALETTE = 3,
+  COLOR_GRAY_ALPHA = 4,
+  COLOR_RGBA = 6,
+};
+
+uint32_t readU32BE(const uint8_t* bytes) {
+  return static_cast<uint32_t>(bytes[0]) << 24 | static_cast<uint32_t>(bytes[1]) << 16 |
+         static_cast<uint32_t>(bytes[2]) << 8 | bytes[3];
+}
+
+bool readChunkHeader(FsFile& file, uint32_t* length, char type[4]) {
+  uint8_t header[8];
+  if (file.read(header, sizeof(header)) != sizeof(header)) {
+    return false;
+  }
+  *length = readU32BE(header);
+  memcpy(type, header + 4, 4);
+  return true;
+}
+
+bool skipBytes(FsFile& file, const uint32_t count) { return file.seek(file.position() + count); }
+
+// Same weights as the JPEG path
+uint8_t rgbToGray(const int r, const int g, const int b) { return (r * 25 + g * 50 + b * 25) / 100; }
+
+// E-ink paper is white, so transparency is composited onto white
+uint8_t compositeOnWhite(const int gray, const int alpha) { return (gray * alpha + 255 * (255 - alpha)) / 255; }
+
+int paeth(const int a, const int b, const int c) {
+  const int p = a + b - c;
+  const int pa = abs(p - a);
+  const int pb = abs(p - b);
+  const int pc = abs(p - c);
+  if (pa <= pb && pa <= pc) return a;
+  if (pb <= pc) return b;
+  return c;
+}
+
+// Pulls the zlib stream out of consecutive IDAT chunks, skipping their CRCs and headers
+class IdatReader {
+  FsFile& file;
+  uint32_t chunkRemaining;
+  bool finished = false;
+
+ public:
+  IdatReader(FsFile& file, const uint32_t firstChunkLength) : file(file), chunkRemaining(firstChunkLength) {}
+
+  bool isFinished() const { return finished; }
+
+  size_t read(uint8_t* buffer, const size_t size) {
+    while (chunkRemaining == 0 && !finished) {
+      uint32_t length;
+      char type[4];
+      if (!skipBytes(file, 4) || !readChunkHeader(file, &length, type) || memcmp(type, "IDAT", 4) != 0) {
+        finished = true;
+        return 0;
+      }
+      chunkRemaining = length;
+    }
+    if (finished) {
+      return 0;
+    }
+
+    const int bytesRead = file.read(buffer, size < chunkRemaining ? size : chunkRemaining);
+    if (bytesRead <= 0) {
+      finished = true;
+      return 0;
+    }
+    chunkRemaining -= bytesRead;
+    return bytesRead;
+  }
+};
+
+// Working memory for one decode, freed together however the decode ends
+struct PngDecodeBuffers {
+  tinfl_decompressor* inflator = nullptr;
+  uint8_t* dictionary = nullptr;
+  uint8_t* input = nullptr;
+  uint8_t* currentLine = nullptr;  // Filter type byte followed by the scanline
+  uint8_t* previousLine = nullptr;
+  uint8_t* grayRow = nullptr;
+
+  ~PngDecodeBuffers() {
+    free(inflator);
+    free(dictionary);
+    free(input);
+    free(currentLine);
+    free(previousLine);
+    free(grayRow);
+  }
+};
+}  // namespace
+
+bool PngToBmpConverter::pngFileToStream(FsFile& pngFile, Print& out, const int targetMaxWidth,
+                                        const int targetMaxHeight, const bool fitInside, const bool writeBmp,
+                                        int* outWidthResult, int* outHeightResult,
+                                        const std::function<bool()>& cancelFn) {
+  Serial.printf("[%lu] [PNG] Converting PNG to %s\n", millis(), writeBmp ? "BMP" : "2-bit rows");
+
+  uint8_t signature[sizeof(PNG_SIGNATURE)];
+  if (pngFile.read(signature, sizeof(signature)) != sizeof(signature) ||
+      memcmp(signature, PNG_SIGNATURE, sizeof(signature)) != 0) {
+    Serial.printf("[%lu] [PNG] Not a PNG file\n", millis());
+    return false;
+  }
+
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint8_t bitDepth = 0;
+  uint8_t colorType = 0;
+  // Palette entries as gray, composited with their tRNS alpha if there is one
+  uint8_t paletteGray[256];
+  memset(paletteGray, 0xFF, sizeof(paletteGray));
+  uint32_t paletteSize = 0;
+
+  // Read the chunks ahead of the image data
+  uint32_t chunkLength;
+  char chunkType[4];
+  while (true) {
+    if (!readChunkHeader(pngFile, &chunkLength, chunkType)) {
+      Serial.printf("[%lu] [PNG] Unexpected end of file before image data\n", millis());
+      return false;
+    }
+
+    if (memcmp(chunkType, "IHDR", 4) == 0) {
+      uint8_t ihdr[13];
+      if (chunkLength != sizeof(ihdr) || pngFile.read(ihdr, sizeof(ihdr)) != sizeof(ihdr)) {
+        Serial.printf("[%lu] [PNG] Invalid IHDR chunk\n", millis());
+        return false;
+      }
+      width = readU32BE(ihdr);
+      height = readU32BE(ihdr + 4);
+      bitDepth = ihdr[8];
+      colorType = ihdr[9];
+      if (ihdr[10] != 0 || ihdr[11] != 0) {
+        Serial.printf("[%lu] [PNG] Unknown compression or filter method\n", millis());
+        return false;
+      }
+      if (ihdr[12] != 0) {
+        // Adam7 passes would need the whole image in memory
+        Serial.printf("[%lu] [PNG] Interlaced PNGs are not supported\n", millis());
+        return false;
+      }
+      skipBytes(pngFile, 4);
+    } else if (memcmp(chunkType, "PLTE", 4) == 0) {
+      if (chunkLength > sizeof(paletteGray) * 3 || chunkLength % 3 != 0) {
+        Serial.printf("[%lu] [PNG] Invalid PLTE chunk\n", millis());
+        return false;
+      }
+      paletteSize = chunkLength / 3;
+      for (uint32_t i = 0; i < paletteSize; i++) {
+        uint8_t rgb[3];
+        if (pngFile.read(rgb, sizeof(rgb)) != sizeof(rgb)) {
+          Serial.printf("[%lu] [PNG] Invalid PLTE chunk\n", millis());
+          return false;
+        }
+        paletteGray[i] = rgbToGray(rgb[0], rgb[1], rgb[2]);
+      }
+      skipBytes(pngFile, 4);
+    } else if (memcmp(chunkType, "tRNS", 4) == 0 && colorType == COLOR_PALETTE) {
+      uint8_t alpha[256];
+      if (chunkLength > sizeof(alpha) || pngFile.read(alpha, chunkLength) != static_cast<int>(chunkLength)) {
+        Serial.printf("[%lu] [PNG] Invalid tRNS chunk\n", millis());
+        return false;
+      }
+      for (uint32_t i = 0; i < chunkLength && i < paletteSize; i++) {
+        paletteGray[i] = compositeOnWhite(paletteGray[i], alpha[i]);
+      }
+      skipBytes(pngFile, 4);
+    } else if (memcmp(chunkType, "IDAT", 4) == 0) {
+      break;
+    } else if (memcmp(chunkType, "IEND", 4) == 0) {
+      Serial.printf("[%lu] [PNG] No image data\n", millis());
+      return false;
+    } else {
+      // Ancillary chunks, including tRNS colour keys for non-palette images, are ignored
+      skipBytes(pngFile, chunkLength + 4);
+    }
+  }
+
+  int channels;
+  switch (colorType) {
+    case COLOR_GRAY:
+      channels = 1;
+      break;
+    case COLOR_RGB:
+      channels = 3;
+      break;
+    case COLOR_PALETTE:
+      channels = 1;
+      break;
+    case COLOR_GRAY_ALPHA:
+      channels = 2;
+      break;
+    case COLOR_RGBA:
+      channels = 4;
+      break;
+    default:
+      Serial.printf("[%lu] [PNG] Unknown color type %d\n", millis(), colorType);
+      return false;
+  }
+  const bool validDepth = colorType == COLOR_GRAY
+                              ? (bitDepth == 1 || bitDepth == 2 || bitDepth == 4 || bitDepth == 8 || bitDepth == 16)
+                          : colorType == COLOR_PALETTE ? (bitDepth == 1 || bitDepth == 2 || bitDepth == 4 || bitDepth == 8)
+                                                       : (bitDepth == 8 || bitDepth == 16);
+  if (!validDepth || (colorType == COLOR_PALETTE && paletteSize == 0)) {
+    Serial.printf("[%lu] [PNG] Invalid bit depth %d for color type %d\n", millis(), bitDepth, colorType);
+    return false;
+  }
+
+  Serial.printf("[%lu] [PNG] PNG dimensions: %lux%lu, color type: %d, bit depth: %d\n", millis(), width, height,
+                colorType, bitDepth);
+
+  if (width == 0 || height == 0 || width > MAX_IMAGE_WIDTH || height > MAX_IMAGE_HEIGHT) {
+    Serial.printf("[%lu] [PNG] Unsupported image size (%lux%lu), max supported: %lux%lu\n", millis(), width, height,
+                  MAX_IMAGE_WIDTH, MAX_IMAGE_HEIGHT);
+    return false;
+  }
+
+  const int bitsPerPixel = channels * bitDepth;
+  const size_t stride = (width * bitsPerPixel + 7) / 8;
+  // Filters work on whole bytes, looking back one pixel or one byte for sub-byte pixels
+  const size_t filterDistance = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;
+
+  PngDecodeBuffers buffers;
+  buffers.inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+  buffers.dictionary = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+  buffers.input = static_cast<uint8_t*>(malloc(INPUT_CHUNK_SIZE));
+  buffers.currentLine = static_cast<uint8_t*>(malloc(stride + 1));
+  buffers.previousLine = static_cast<uint8_t*>(calloc(stride, 1));
+  buffers.grayRow = static_cast<uint8_t*>(malloc(width));
+  if (!buffers.inflator || !buffers.dictionary || !buffers.input || !buffers.currentLine || !buffers.previousLine ||
+      !buffers.grayRow) {
+    Serial.printf("[%lu] [PNG] Failed to allocate decode buffers (scanline %zu bytes)\n", millis(), stride);
+    return false;
+  }
+  tinfl_init(buffers.inflator);
+
+  DitheredImageWriter writer(out, width, height, targetMaxWidth, targetMaxHeight, fitInside, writeBmp);
+  writer.setCancelCheck(cancelFn);
+  if (!writer.begin()) {
+    return false;
+  }
+
+  IdatReader idat(pngFile, chunkLength);
+  size_t inputFilled = 0;
+  size_t inputCursor = 0;
+  size_t dictionaryCursor = 0;
+  size_t lineFilled = 0;
+  uint32_t rowsDone = 0;
+
+  while (rowsDone < height) {
+    if (inputCursor >= inputFilled && !idat.isFinished()) {
+      inputFilled = idat.read(buffers.input, INPUT_CHUNK_SIZE);
+      inputCursor = 0;
+    }
+
+    size_t inBytes = inputFilled - inputCursor;
+    size_t outBytes = TINFL_LZ_DICT_SIZE - dictionaryCursor;
+    const tinfl_status status = tinfl_decompress(
+        buffers.inflator, buffers.input + inputCursor, &inBytes, buffers.dictionary,
+        buffers.dictionary + dictionaryCursor, &outBytes,
+        TINFL_FLAG_PARSE_ZLIB_HEADER | (idat.isFinished() ? 0 : TINFL_FLAG_HAS_MORE_INPUT));
+    inputCursor += inBytes;
+
+    // Hand the inflated bytes to the scanline they belong to, unfiltering each one as it completes
+    const uint8_t* inflated = buffers.dictionary + dictionaryCursor;
+    size_t remaining = outBytes;
+    while (remaining > 0 && rowsDone < height) {
+      const size_t toCopy = remaining < stride + 1 - lineFilled ? remaining : stride + 1 - lineFilled;
+      memcpy(buffers.currentLine + lineFilled, inflated, toCopy);
+      inflated += toCopy;
+      remaining -= toCopy;
+      lineFilled += toCopy;
+      if (lineFilled < stride + 1) {
+        break;
+      }
+      lineFilled = 0;
+
+      const uint8_t filter = buffers.currentLine[0];
+      uint8_t* line = buffers.currentLine + 1;
+      const uint8_t* prior = buffers.previousLine;
+      for (size_t i = 0; i < stride; i++) {
+        const int a = i >= filterDistance ? line[i - filterDistance] : 0;
+        const int b = prior[i];
+        const int c = i >= filterDistance ? prior[i - filterDistance] : 0;
+        switch (filter) {
+          case 0:
+            break;
+          case 1:
+            line[i] += a;
+            break;
+          case 2:
+            line[i] += b;
+            break;
+          case 3:
+            line[i] += (a + b) / 2;
+            break;
+          case 4:
+            line[i] += paeth(a, b, c);
+            break;
+          default:
+            Serial.printf("[%lu] [PNG] Invalid filter type %d on row %lu\n", millis(), filter, rowsDone);
+            return false;
+        }
+      }
+
+      // 16-bit samples only keep their high byte
+      const int sampleBytes = bitDepth == 16 ? 2 : 1;
+      for (uint32_t x = 0; x < width; x++) {
+        uint8_t gray;
+        if (bitDepth < 8) {
+          const uint32_t bit = x * bitDepth;
+          const int value = (line[bit / 8] >> (8 - bitDepth - bit % 8)) & ((1 << bitDepth) - 1);
+          gray = colorType == COLOR_PALETTE ? paletteGray[value] : value * 255 / ((1 << bitDepth) - 1);
+        } else {
+          const uint8_t* pixel = line + x * channels * sampleBytes;
+          switch (colorType) {
+            case COLOR_GRAY:
+              gray = pixel[0];
+              break;
+            case COLOR_PALETTE:
+              gray = paletteGray[pixel[0]];
+              break;
+            case COLOR_GRAY_ALPHA:
+              gray = compositeOnWhite(pixel[0], pixel[sampleBytes]);
+              break;
+            case COLOR_RGB:
+              gray = rgbToGray(pixel[0], pixel[sampleBytes], pixel[2 * sampleBytes]);
+              break;
+            default:
+              gray = compositeOnWhite(rgbToGray(pixel[0], pixel[sampleBytes], pixel[2 * sampleBytes]),
+                                      pixel[3 * sampleBytes]);
+              break;
+          }
+        }
+        buffers.grayRow[x] = gray;
+      }
+      if (!writer.writeSourceRow(buffers.grayRow)) {
+        Serial.printf("[%lu] [PNG] Conversion cancelled at row %lu of %lu\n", millis(), rowsDone, height);
+        return false;
+      }
+      rowsDone++;
+
+      // The unfiltered row is the prior row for the next one
+      memcpy(buffers.previousLine, line, stride);
+    }
+    dictionaryCursor = (dictionaryCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+    if (status < 0) {
+      Serial.printf("[%lu] [PNG] tinfl_decompress() failed with status %d\n", millis(), status);
+      return false;
+    }
+    if (status == TINFL_STATUS_DONE || (status == TINFL_STATUS_NEEDS_MORE_INPUT && idat.isFinished())) {
+      break;
+    }
+  }
+
+  if (rowsDone < height) {
+    Serial.printf("[%lu] [PNG] Image data ended after %lu of %lu rows\n", millis(), rowsDone, height);
+    return false;
+  }
+  if (!writer.finish()) {
+    return false;
+  }
+
+  if (outWidthResult) {
+    *outWidthResult = writer.getWidth();
+  }
+  if (outHeightResult) {
+    *outHeightResult = writer.getHeight();
+  }
+  Serial.printf("[%lu] [PNG] Successfully converted PNG\n", millis());
+  return true;
+}
+
+bool PngToBmpConverter::pngFileToBmpStream(FsFile& pngFile, Print& bmpOut) {
+  return pngFileToStream(pngFile, bmpOut, DitheredImageWriter::COVER_MAX_WIDTH, DitheredImageWriter::COVER_MAX_HEIGHT,
+                         false, true, nullptr, nullptr, nullptr);
+}
+
+bool PngToBmpConverter::pngFileToGray2Stream(FsFile& pngFile, Print& out, const int maxWidth, const int maxHeight,
+                                             int* outWidth, int* outHeight, const std::function<bool()>& cancelFn) {
+  return pngFileToStream(pngFile, out, maxWidth, maxHeight, true, false, outWidth, outHeight, cancelFn);
+}
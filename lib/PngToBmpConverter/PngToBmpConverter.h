@@ -0,0 +1,20 @@
+#pragma once
+
+#include <functional>
+
+class FsFile;
+class Print;
+
+// Streams a PNG through tinfl a scanline at a time into the same prescale and dithering pipeline as JPEGs, so memory
+// depends on the image width only
+class PngToBmpConverter {
+  static bool pngFileToStream(FsFile& pngFile, Print& out, int targetMaxWidth, int targetMaxHeight, bool fitInside,
+                              bool writeBmp, int* outWidthResult, int* outHeightResult,
+                              const std::function<bool()>& cancelFn);
+
+ public:
+  static bool pngFileToBmpStream(FsFile& pngFile, Print& bmpOut);
+  // Same output and cancelling as JpegToBmpConverter::jpegFileToGray2Stream
+  static bool pngFileToGray2Stream(FsFile& pngFile, Print& out, int maxWidth, int maxHeight, int* outWidth,
+                                   int* outHeight, const std::function<bool()>& cancelFn = nullptr);
+};
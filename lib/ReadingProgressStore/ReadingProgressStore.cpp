@@ -0,0 +1,91 @@
+#include "ReadingProgressStore.h"
+
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+
+#include <cstring>
+
+namespace {
+// A reset loses at most this many page turns, or this much time if the reader loop keeps polling isFlushDue
+constexpr uint16_t FLUSH_PAGE_INTERVAL = 10;
+constexpr unsigned long FLUSH_INTERVAL_MS = 30 * 1000;
+// Below this every position is written straight away, the device may shut off at any point
+constexpr uint16_t LOW_BATTERY_PERCENT = 10;
+}  // namespace
+
+bool ReadingProgressStore::load(uint8_t* out) {
+  FsFile f;
+  if (!SdMan.openFileForRead("RPS", path, f)) {
+    if (!SdMan.openFileForRead("RPS", tmpPath, f)) {
+      return false;
+    }
+    // A reset between removing progress.bin and renaming the temp file over it leaves only the temp file, finish the
+    // rename so the next write can't truncate the only copy
+    if (!f.rename(path.c_str())) {
+      Serial.printf("[%lu] [RPS] Failed to recover %s\n", millis(), tmpPath.c_str());
+    }
+  }
+
+  const bool loaded = f.read(data, DATA_SIZE) == DATA_SIZE;
+  f.close();
+  if (!loaded) {
+    memset(data, 0, DATA_SIZE);
+    return false;
+  }
+
+  memcpy(out, data, DATA_SIZE);
+  return true;
+}
+
+void ReadingProgressStore::update(const uint8_t* newData, const uint16_t batteryPercent) {
+  if (memcmp(data, newData, DATA_SIZE) == 0) {
+    return;
+  }
+
+  memcpy(data, newData, DATA_SIZE);
+  if (!dirty) {
+    dirty = true;
+    firstPendingTime = millis();
+  }
+  pendingUpdates++;
+
+  if (isFlushDue() || batteryPercent <= LOW_BATTERY_PERCENT) {
+    flush();
+  }
+}
+
+bool ReadingProgressStore::isFlushDue() const {
+  return dirty && (pendingUpdates >= FLUSH_PAGE_INTERVAL || millis() - firstPendingTime >= FLUSH_INTERVAL_MS);
+}
+
+bool ReadingProgressStore::flush() {
+  if (!dirty) {
+    return true;
+  }
+
+  FsFile f;
+  if (!SdMan.openFileForWrite("RPS", tmpPath, f)) {
+    return false;
+  }
+
+  if (f.write(data, DATA_SIZE) != DATA_SIZE || !f.sync()) {
+    Serial.printf("[%lu] [RPS] Failed to write %s\n", millis(), tmpPath.c_str());
+    f.close();
+    return false;
+  }
+
+  // SdFat won't rename over an existing file
+  if (SdMan.exists(path.c_str())) {
+    SdMan.remove(path.c_str());
+  }
+  if (!f.rename(path.c_str())) {
+    Serial.printf("[%lu] [RPS] Failed to rename %s\n", millis(), tmpPath.c_str());
+    f.close();
+    return false;
+  }
+  f.close();
+
+  dirty = false;
+  pendingUpdates = 0;
+  return true;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Keeps a book's latest reading position in RAM and only writes it to progress.bin every few page turns or seconds,
+ * when the battery is low, or when flushed explicitly (readers flush on exit, which also covers going to sleep).
+ * Writes go to a temp file that is then renamed over progress.bin, so a reset mid-write keeps the previous position.
+ */
+class ReadingProgressStore {
+ public:
+  static constexpr size_t DATA_SIZE = 4;
+
+ private:
+  std::string path;
+  std::string tmpPath;
+  uint8_t data[DATA_SIZE] = {};
+  bool dirty = false;
+  uint16_t pendingUpdates = 0;
+  unsigned long firstPendingTime = 0;
+
+ public:
+  explicit ReadingProgressStore(const std::string& cachePath)
+      : path(cachePath + "/progress.bin"), tmpPath(cachePath + "/progress.tmp") {}
+
+  // Reads the saved position into out, returns false if there is none
+  bool load(uint8_t* out);
+  // Records the current position, writing it out if a flush threshold has been reached or the battery is low
+  void update(const uint8_t* newData, uint16_t batteryPercent);
+  bool isFlushDue() const;
+  bool flush();
+};
@@ -92,6 +92,9 @@ class Xtc {
   // Progress calculation
   uint8_t calculateProgress(uint32_t currentPage) const;
 
+  // Check pages against the MD5 in their header while loading them, see XtcParser::setVerifyChecksums
+  void setVerifyChecksums(bool verify);
+
   // Check if file is loaded
   bool isLoaded() const { return loaded; }
 
@@ -10,17 +10,78 @@
 #include <FsHelpers.h>
 #include <HardwareSerial.h>
 #include <SDCardManager.h>
+#include <esp_rom_md5.h>
 
+#include <algorithm>
 #include <cstring>
 
 namespace xtc {
 
+namespace {
+/**
+ * Incremental PackBits decoder
+ * Keeps its position inside a run between calls, so input and output can be fed in pieces of any size.
+ */
+class PackBitsDecoder {
+  size_t literalLeft = 0;
+  size_t repeatLeft = 0;
+  bool repeatByteNeeded = false;
+  uint8_t repeatByte = 0;
+
+ public:
+  // Decodes until the input is used up or the output is full, returns bytes written and sets inUsed to bytes consumed
+  size_t decode(const uint8_t* in, const size_t inSize, size_t& inUsed, uint8_t* out, const size_t outSize) {
+    size_t inPos = 0;
+    size_t outPos = 0;
+
+    while (outPos < outSize) {
+      if (literalLeft > 0) {
+        if (inPos == inSize) {
+          break;
+        }
+        const size_t n = std::min({literalLeft, inSize - inPos, outSize - outPos});
+        memcpy(out + outPos, in + inPos, n);
+        inPos += n;
+        outPos += n;
+        literalLeft -= n;
+      } else if (repeatByteNeeded) {
+        if (inPos == inSize) {
+          break;
+        }
+        repeatByte = in[inPos++];
+        repeatByteNeeded = false;
+      } else if (repeatLeft > 0) {
+        const size_t n = std::min(repeatLeft, outSize - outPos);
+        memset(out + outPos, repeatByte, n);
+        outPos += n;
+        repeatLeft -= n;
+      } else {
+        if (inPos == inSize) {
+          break;
+        }
+        const auto control = static_cast<int8_t>(in[inPos++]);
+        if (control >= 0) {
+          literalLeft = control + 1;
+        } else if (control != -128) {
+          repeatLeft = 1 - control;
+          repeatByteNeeded = true;
+        }
+      }
+    }
+
+    inUsed = inPos;
+    return outPos;
+  }
+};
+}  // namespace
+
 XtcParser::XtcParser()
     : m_isOpen(false),
       m_defaultWidth(DISPLAY_WIDTH),
       m_defaultHeight(DISPLAY_HEIGHT),
       m_bitDepth(1),
       m_hasChapters(false),
+      m_verifyChecksums(false),
       m_lastError(XtcError::OK) {
   memset(&m_header, 0, sizeof(m_header));
 }
@@ -296,15 +357,13 @@ bool XtcParser::getPageInfo(uint32_t pageIndex, PageInfo& info) const {
   return true;
 }
 
-size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSize) {
+XtcError XtcParser::readPageHeader(const uint32_t pageIndex, XtgPageHeader& pageHeader, size_t& bitmapSize) {
   if (!m_isOpen) {
-    m_lastError = XtcError::FILE_NOT_FOUND;
-    return 0;
+    return XtcError::FILE_NOT_FOUND;
   }
 
   if (pageIndex >= m_header.pageCount) {
-    m_lastError = XtcError::PAGE_OUT_OF_RANGE;
-    return 0;
+    return XtcError::PAGE_OUT_OF_RANGE;
   }
 
   const PageInfo& page = m_pageTable[pageIndex];
@@ -312,17 +371,14 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
   // Seek to page data
   if (!m_file.seek(page.offset)) {
     Serial.printf("[%lu] [XTC] Failed to seek to page %u at offset %lu\n", millis(), pageIndex, page.offset);
-    m_lastError = XtcError::READ_ERROR;
-    return 0;
+    return XtcError::READ_ERROR;
   }
 
   // Read page header (XTG for 1-bit, XTH for 2-bit - same structure)
-  XtgPageHeader pageHeader;
   size_t headerRead = m_file.read(reinterpret_cast<uint8_t*>(&pageHeader), sizeof(XtgPageHeader));
   if (headerRead != sizeof(XtgPageHeader)) {
     Serial.printf("[%lu] [XTC] Failed to read page header for page %u\n", millis(), pageIndex);
-    m_lastError = XtcError::READ_ERROR;
-    return 0;
+    return XtcError::READ_ERROR;
   }
 
   // Verify page magic (XTG for 1-bit, XTH for 2-bit)
@@ -330,14 +386,18 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
   if (pageHeader.magic != expectedMagic) {
     Serial.printf("[%lu] [XTC] Invalid page magic for page %u: 0x%08X (expected 0x%08X)\n", millis(), pageIndex,
                   pageHeader.magic, expectedMagic);
-    m_lastError = XtcError::INVALID_MAGIC;
-    return 0;
+    return XtcError::INVALID_MAGIC;
+  }
+
+  if (pageHeader.compression != XTG_COMPRESSION_NONE && pageHeader.compression != XTG_COMPRESSION_PACKBITS) {
+    Serial.printf("[%lu] [XTC] Unsupported compression %u for page %u\n", millis(), pageHeader.compression,
+                  pageIndex);
+    return XtcError::DECOMPRESSION_ERROR;
   }
 
   // Calculate bitmap size based on bit depth
   // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
   // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
-  size_t bitmapSize;
   if (m_bitDepth == 2) {
     // XTH: two bit planes, each containing (width * height) bits rounded up to bytes
     bitmapSize = ((static_cast<size_t>(pageHeader.width) * pageHeader.height + 7) / 8) * 2;
@@ -345,6 +405,88 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
     bitmapSize = ((pageHeader.width + 7) / 8) * pageHeader.height;
   }
 
+  return XtcError::OK;
+}
+
+XtcError XtcParser::readPageBitmap(
+    const XtgPageHeader& pageHeader, const size_t bitmapSize, uint8_t* out, const size_t outSize,
+    const std::function<void(const uint8_t* data, size_t size, size_t offset)>& callback) {
+  const bool verify = m_verifyChecksums && pageHeader.md5 != 0;
+  md5_context_t md5;
+  if (verify) {
+    esp_rom_md5_init(&md5);
+  }
+
+  PackBitsDecoder decoder;
+  uint8_t packed[256];
+  size_t packedPos = 0;
+  size_t packedLen = 0;
+  size_t packedLeft = pageHeader.dataSize;
+  size_t totalRead = 0;
+
+  while (totalRead < bitmapSize) {
+    const size_t toRead = std::min(outSize, bitmapSize - totalRead);
+    size_t filled = 0;
+
+    if (pageHeader.compression == XTG_COMPRESSION_NONE) {
+      filled = m_file.read(out, toRead);
+      if (filled == 0) {
+        Serial.printf("[%lu] [XTC] Page read error: expected %u, got %u\n", millis(), bitmapSize, totalRead);
+        return XtcError::READ_ERROR;
+      }
+    } else {
+      while (true) {
+        size_t used = 0;
+        filled += decoder.decode(packed + packedPos, packedLen - packedPos, used, out + filled, toRead - filled);
+        packedPos += used;
+        if (filled == toRead) {
+          break;
+        }
+
+        // The decoder only stops short when it needs more input
+        if (packedLeft == 0) {
+          Serial.printf("[%lu] [XTC] Packed page data ended at %u of %u bytes\n", millis(), totalRead + filled,
+                        bitmapSize);
+          return XtcError::DECOMPRESSION_ERROR;
+        }
+        packedLen = m_file.read(packed, std::min(sizeof(packed), packedLeft));
+        if (packedLen == 0) {
+          return XtcError::READ_ERROR;
+        }
+        packedLeft -= packedLen;
+        packedPos = 0;
+      }
+    }
+
+    if (verify) {
+      esp_rom_md5_update(&md5, out, filled);
+    }
+    if (callback) {
+      callback(out, filled, totalRead);
+    }
+    totalRead += filled;
+  }
+
+  if (verify) {
+    uint8_t digest[16];
+    esp_rom_md5_final(digest, &md5);
+    if (memcmp(digest, &pageHeader.md5, sizeof(pageHeader.md5)) != 0) {
+      Serial.printf("[%lu] [XTC] Page checksum mismatch\n", millis());
+      return XtcError::CHECKSUM_MISMATCH;
+    }
+  }
+
+  return XtcError::OK;
+}
+
+size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSize) {
+  XtgPageHeader pageHeader;
+  size_t bitmapSize;
+  m_lastError = readPageHeader(pageIndex, pageHeader, bitmapSize);
+  if (m_lastError != XtcError::OK) {
+    return 0;
+  }
+
   // Check buffer size
   if (bufferSize < bitmapSize) {
     Serial.printf("[%lu] [XTC] Buffer too small: need %u, have %u\n", millis(), bitmapSize, bufferSize);
@@ -353,70 +495,29 @@ size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSiz
   }
 
   // Read bitmap data
-  size_t bytesRead = m_file.read(buffer, bitmapSize);
-  if (bytesRead != bitmapSize) {
-    Serial.printf("[%lu] [XTC] Page read error: expected %u, got %u\n", millis(), bitmapSize, bytesRead);
-    m_lastError = XtcError::READ_ERROR;
+  m_lastError = readPageBitmap(pageHeader, bitmapSize, buffer, bitmapSize, nullptr);
+  if (m_lastError != XtcError::OK) {
+    Serial.printf("[%lu] [XTC] Failed to load page %u: %s\n", millis(), pageIndex, errorToString(m_lastError));
     return 0;
   }
 
-  m_lastError = XtcError::OK;
-  return bytesRead;
+  return bitmapSize;
 }
 
 XtcError XtcParser::loadPageStreaming(uint32_t pageIndex,
                                       std::function<void(const uint8_t* data, size_t size, size_t offset)> callback,
                                       size_t chunkSize) {
-  if (!m_isOpen) {
-    return XtcError::FILE_NOT_FOUND;
-  }
-
-  if (pageIndex >= m_header.pageCount) {
-    return XtcError::PAGE_OUT_OF_RANGE;
-  }
-
-  const PageInfo& page = m_pageTable[pageIndex];
-
-  // Seek to page data
-  if (!m_file.seek(page.offset)) {
-    return XtcError::READ_ERROR;
-  }
-
-  // Read and skip page header (XTG for 1-bit, XTH for 2-bit)
   XtgPageHeader pageHeader;
-  size_t headerRead = m_file.read(reinterpret_cast<uint8_t*>(&pageHeader), sizeof(XtgPageHeader));
-  const uint32_t expectedMagic = (m_bitDepth == 2) ? XTH_MAGIC : XTG_MAGIC;
-  if (headerRead != sizeof(XtgPageHeader) || pageHeader.magic != expectedMagic) {
-    return XtcError::READ_ERROR;
-  }
-
-  // Calculate bitmap size based on bit depth
-  // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
-  // XTH (2-bit): Two bit planes, ((width * height + 7) / 8) * 2 bytes
   size_t bitmapSize;
-  if (m_bitDepth == 2) {
-    bitmapSize = ((static_cast<size_t>(pageHeader.width) * pageHeader.height + 7) / 8) * 2;
-  } else {
-    bitmapSize = ((pageHeader.width + 7) / 8) * pageHeader.height;
+  m_lastError = readPageHeader(pageIndex, pageHeader, bitmapSize);
+  if (m_lastError != XtcError::OK) {
+    return m_lastError;
   }
 
   // Read in chunks
   std::vector<uint8_t> chunk(chunkSize);
-  size_t totalRead = 0;
-
-  while (totalRead < bitmapSize) {
-    size_t toRead = std::min(chunkSize, bitmapSize - totalRead);
-    size_t bytesRead = m_file.read(chunk.data(), toRead);
-
-    if (bytesRead == 0) {
-      return XtcError::READ_ERROR;
-    }
-
-    callback(chunk.data(), bytesRead, totalRead);
-    totalRead += bytesRead;
-  }
-
-  return XtcError::OK;
+  m_lastError = readPageBitmap(pageHeader, bitmapSize, chunk.data(), chunkSize, callback);
+  return m_lastError;
 }
 
 bool XtcParser::isValidXtcFile(const char* filepath) {
@@ -44,8 +44,11 @@ class XtcParser {
   // Page information
   bool getPageInfo(uint32_t pageIndex, PageInfo& info) const;
 
+  // Check page bitmaps against the MD5 in their page header when one is present (off by default)
+  void setVerifyChecksums(const bool verify) { m_verifyChecksums = verify; }
+
   /**
-   * Load page bitmap (raw 1-bit data, skipping XTG header)
+   * Load page bitmap (raw bitmap data, skipping XTG/XTH header and decompressing if needed)
    *
    * @param pageIndex Page index (0-based)
    * @param buffer Output buffer (caller allocated)
@@ -56,7 +59,8 @@ class XtcParser {
 
   /**
    * Streaming page load
-   * Memory-efficient method that reads page data in chunks.
+   * Memory-efficient method that reads page data in chunks, decompressing it on the fly.
+   * Offsets passed to the callback are into the uncompressed bitmap.
    *
    * @param pageIndex Page index
    * @param callback Callback function to receive data chunks
@@ -90,6 +94,7 @@ class XtcParser {
   uint16_t m_defaultHeight;
   uint8_t m_bitDepth;  // 1 = XTC/XTG (1-bit), 2 = XTCH/XTH (2-bit)
   bool m_hasChapters;
+  bool m_verifyChecksums;
   XtcError m_lastError;
 
   // Internal helper functions
@@ -97,6 +102,9 @@ class XtcParser {
   XtcError readPageTable();
   XtcError readTitle();
   XtcError readChapters();
+  XtcError readPageHeader(uint32_t pageIndex, XtgPageHeader& pageHeader, size_t& bitmapSize);
+  XtcError readPageBitmap(const XtgPageHeader& pageHeader, size_t bitmapSize, uint8_t* out, size_t outSize,
+                          const std::function<void(const uint8_t* data, size_t size, size_t offset)>& callback);
 };
 
 }  // namespace xtc
@@ -27,6 +27,10 @@ constexpr uint32_t XTG_MAGIC = 0x00475458;  // "XTG\0" for 1-bit page data
 // "XTH\0" = 0x58, 0x54, 0x48, 0x00
 constexpr uint32_t XTH_MAGIC = 0x00485458;  // "XTH\0" for 2-bit page data
 
+// XTG/XTH page compression (XtgPageHeader::compression)
+constexpr uint8_t XTG_COMPRESSION_NONE = 0;
+constexpr uint8_t XTG_COMPRESSION_PACKBITS = 1;
+
 // XTeink X4 display resolution
 constexpr uint16_t DISPLAY_WIDTH = 480;
 constexpr uint16_t DISPLAY_HEIGHT = 800;
@@ -68,9 +72,9 @@ struct XtgPageHeader {
   uint16_t width;       // 0x04: Image width (pixels)
   uint16_t height;      // 0x06: Image height (pixels)
   uint8_t colorMode;    // 0x08: Color mode (0=monochrome)
-  uint8_t compression;  // 0x09: Compression (0=uncompressed)
-  uint32_t dataSize;    // 0x0A: Image data size (bytes)
-  uint64_t md5;         // 0x0E: MD5 checksum (first 8 bytes, optional)
+  uint8_t compression;  // 0x09: Compression (0=uncompressed, 1=PackBits)
+  uint32_t dataSize;    // 0x0A: Image data size (bytes, as stored)
+  uint64_t md5;         // 0x0E: MD5 checksum of the uncompressed bitmap (first 8 bytes, optional, 0 if unset)
   // Followed by bitmap data at offset 0x16 (22)
   //
   // XTG (1-bit): Row-major, 8 pixels/byte, MSB first
@@ -81,6 +85,11 @@ struct XtgPageHeader {
   //   First plane: Bit1 for all pixels
   //   Second plane: Bit2 for all pixels
   //   pixelValue = (bit1 << 1) | bit2
+  //
+  // PackBits compression packs the whole bitmap above as one byte stream of runs:
+  //   control byte n in 0..127: copy the next n + 1 bytes
+  //   control byte n in -127..-1: repeat the next byte 1 - n times
+  //   control byte -128: no-op
 };
 #pragma pack(pop)
 
@@ -112,6 +121,7 @@ enum class XtcError {
   WRITE_ERROR,
   MEMORY_ERROR,
   DECOMPRESSION_ERROR,
+  CHECKSUM_MISMATCH,
 };
 
 // Convert error code to string
@@ -137,6 +147,8 @@ inline const char* errorToString(XtcError err) {
       return "Memory allocation error";
     case XtcError::DECOMPRESSION_ERROR:
       return "Decompression error";
+    case XtcError::CHECKSUM_MISMATCH:
+      return "Checksum mismatch";
     default:
       return "Unknown error";
   }
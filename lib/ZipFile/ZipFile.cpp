@@ -1,9 +1,14 @@
 #include "ZipFile.h"
 
+#include <FsHelpers.h>
 #include <HardwareSerial.h>
 #include <SDCardManager.h>
+#include <Serialization.h>
 #include <miniz.h>
 
+#include <algorithm>
+#include <vector>
+
 bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t* outputBuf, const size_t inflatedSize) {
   // Setup inflator
   const auto inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
@@ -28,6 +33,46 @@ bool inflateOneShot(const uint8_t* inputBuf, const size_t deflatedSize, uint8_t*
   return true;
 }
 
+namespace {
+constexpr uint8_t FILE_STAT_INDEX_VERSION = 1;
+constexpr uint32_t FILE_STAT_INDEX_HEADER_SIZE = sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint32_t);
+// Most index entries sorted in RAM at once while building the index (48KB), fewer if the heap is short. Archives up
+// to this size are indexed in a single central directory pass.
+constexpr uint32_t FILE_STAT_INDEX_MAX_BATCH = 2048;
+constexpr uint32_t FILE_STAT_INDEX_MIN_BATCH = 128;
+// Largest fence index held in RAM, about 14k entries. Bigger archives fall back to scanning the central directory.
+constexpr size_t FENCE_INDEX_MAX_BYTES = 32 * 1024;
+
+uint16_t fenceHashName(const char* name) {
+  const uint32_t hash = FsHelpers::fnv1a32(name);
+  return static_cast<uint16_t>(hash ^ (hash >> 16));
+}
+}  // namespace
+
+bool ZipFile::readCentralDirEntry(FileStatSlim* fileStat, char* itemName, const size_t itemNameSize) {
+  uint32_t sig;
+  if (file.read(&sig, 4) != 4 || sig != 0x02014b50) return false;  // End of list
+
+  file.seekCur(6);
+  file.read(&fileStat->method, 2);
+  file.seekCur(8);
+  file.read(&fileStat->compressedSize, 4);
+  file.read(&fileStat->uncompressedSize, 4);
+  uint16_t nameLen, m, k;
+  file.read(&nameLen, 2);
+  file.read(&m, 2);
+  file.read(&k, 2);
+  file.seekCur(8);
+  file.read(&fileStat->localHeaderOffset, 4);
+  const size_t nameReadLen = nameLen < itemNameSize ? nameLen : itemNameSize - 1;
+  file.read(itemName, nameReadLen);
+  itemName[nameReadLen] = '\0';
+
+  // Skip the rest of this entry (truncated name + extra field + comment)
+  file.seekCur(nameLen - nameReadLen + m + k);
+  return true;
+}
+
 bool ZipFile::loadAllFileStatSlims() {
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
@@ -43,43 +88,327 @@ bool ZipFile::loadAllFileStatSlims() {
 
   file.seek(zipDetails.centralDirOffset);
 
-  uint32_t sig;
   char itemName[256];
   fileStatSlimCache.clear();
   fileStatSlimCache.reserve(zipDetails.totalEntries);
 
   while (file.available()) {
-    file.read(&sig, 4);
-    if (sig != 0x02014b50) break;  // End of list
-
     FileStatSlim fileStat = {};
+    if (!readCentralDirEntry(&fileStat, itemName, sizeof(itemName))) break;
+    fileStatSlimCache.emplace(itemName, fileStat);
+  }
+
+  if (!wasOpen) {
+    close();
+  }
+  return true;
+}
+
+bool ZipFile::writeFileStatIndex(const std::string& indexPath) {
+  // Take the largest batch the heap allows, so most archives are sorted in one pass over the central directory
+  uint32_t batchCapacity = std::max<uint32_t>(zipDetails.totalEntries, 1);
+  batchCapacity = std::min(batchCapacity, FILE_STAT_INDEX_MAX_BATCH);
+  FileStatIndexEntry* batch = nullptr;
+  while (!(batch = static_cast<FileStatIndexEntry*>(malloc(batchCapacity * sizeof(FileStatIndexEntry)))) &&
+         batchCapacity > FILE_STAT_INDEX_MIN_BATCH) {
+    batchCapacity /= 2;
+  }
+  if (!batch) {
+    Serial.printf("[%lu] [ZIP] Not enough memory to build file stat index\n", millis());
+    return false;
+  }
 
-    file.seekCur(6);
-    file.read(&fileStat.method, 2);
-    file.seekCur(8);
-    file.read(&fileStat.compressedSize, 4);
-    file.read(&fileStat.uncompressedSize, 4);
-    uint16_t nameLen, m, k;
-    file.read(&nameLen, 2);
-    file.read(&m, 2);
-    file.read(&k, 2);
-    file.seekCur(8);
-    file.read(&fileStat.localHeaderOffset, 4);
-    file.read(itemName, nameLen);
-    itemName[nameLen] = '\0';
+  FsFile outFile;
+  if (!SdMan.openFileForWrite("ZIP", indexPath, outFile)) {
+    free(batch);
+    return false;
+  }
 
-    fileStatSlimCache.emplace(itemName, fileStat);
+  // Every write is checked, a full card must not leave a truncated index behind
+  auto writeBytes = [&outFile](const void* data, const size_t size) {
+    return outFile.write(static_cast<const uint8_t*>(data), size) == size;
+  };
+
+  // Version is written as 0 until the index is complete, so a partially written index is never trusted
+  const uint8_t pendingVersion = 0;
+  bool writeOk = writeBytes(&pendingVersion, sizeof(pendingVersion)) &&
+                 writeBytes(&zipDetails.totalEntries, sizeof(zipDetails.totalEntries)) &&
+                 writeBytes(&zipDetails.centralDirOffset, sizeof(zipDetails.centralDirOffset));
+
+  // When the archive doesn't fit one batch, entries are bucketed by hash range and each pass re-reads the central
+  // directory. A quarter of each batch is left as slack for uneven ranges.
+  const uint32_t passCount = zipDetails.totalEntries <= batchCapacity
+                                 ? 1
+                                 : (zipDetails.totalEntries + batchCapacity * 3 / 4 - 1) / (batchCapacity * 3 / 4);
+
+  char itemName[256];
+  uint16_t entryCount = 0;
+  for (uint32_t pass = 0; writeOk && pass < passCount; pass++) {
+    const uint64_t hashStart = (static_cast<uint64_t>(pass) << 32) / passCount;
+    const uint64_t hashEnd = (static_cast<uint64_t>(pass + 1) << 32) / passCount;
+
+    uint32_t batchSize = 0;
+    file.seek(zipDetails.centralDirOffset);
+    while (file.available()) {
+      FileStatIndexEntry entry = {};
+      entry.centralDirRecordOffset = file.position();
+      if (!readCentralDirEntry(&entry.fileStat, itemName, sizeof(itemName))) break;
+
+      entry.nameHash = FsHelpers::fnv1a32(itemName);
+      if (entry.nameHash < hashStart || entry.nameHash >= hashEnd) {
+        continue;
+      }
+      if (batchSize == batchCapacity) {
+        Serial.printf("[%lu] [ZIP] Hash range %d overflowed its batch of %d entries\n", millis(),
+                      static_cast<int>(pass), static_cast<int>(batchCapacity));
+        writeOk = false;
+        break;
+      }
+      batch[batchSize++] = entry;
+    }
+
+    std::sort(batch, batch + batchSize, [](const FileStatIndexEntry& a, const FileStatIndexEntry& b) {
+      return a.nameHash < b.nameHash;
+    });
+    writeOk = writeOk && writeBytes(batch, batchSize * sizeof(FileStatIndexEntry));
+    entryCount += batchSize;
+  }
+  free(batch);
+
+  if (writeOk && entryCount != zipDetails.totalEntries) {
+    Serial.printf("[%lu] [ZIP] Indexed %d entries but central directory reports %d\n", millis(), entryCount,
+                  zipDetails.totalEntries);
+    writeOk = false;
+  }
+
+  writeOk = writeOk && outFile.seek(0) && writeBytes(&FILE_STAT_INDEX_VERSION, sizeof(FILE_STAT_INDEX_VERSION));
+  // Closing flushes the last cached sector, which can fail too
+  writeOk = outFile.close() && writeOk;
+  if (!writeOk) {
+    Serial.printf("[%lu] [ZIP] Failed to write file stat index: %s\n", millis(), indexPath.c_str());
+    SdMan.remove(indexPath.c_str());
+    return false;
+  }
+
+  Serial.printf("[%lu] [ZIP] Wrote file stat index with %d entries in %d passes\n", millis(), entryCount, passCount);
+  return true;
+}
+
+bool ZipFile::loadFileStatIndex(const std::string& indexPath) {
+  if (indexFile) {
+    indexFile.close();
+  }
+  indexEntryCount = 0;
+
+  const bool wasOpen = isOpen();
+  if (!wasOpen && !open()) {
+    return false;
+  }
+
+  if (!loadZipDetails()) {
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
+
+  // Returns true if the index on disk exists and matches this archive, leaving indexFile open
+  auto openExistingIndex = [this, &indexPath]() {
+    if (!SdMan.exists(indexPath.c_str()) || !SdMan.openFileForRead("ZIP", indexPath, indexFile)) {
+      return false;
+    }
+
+    uint8_t version;
+    uint16_t totalEntries;
+    uint32_t centralDirOffset;
+    serialization::readPod(indexFile, version);
+    serialization::readPod(indexFile, totalEntries);
+    serialization::readPod(indexFile, centralDirOffset);
+
+    if (version != FILE_STAT_INDEX_VERSION || totalEntries != zipDetails.totalEntries ||
+        centralDirOffset != zipDetails.centralDirOffset ||
+        indexFile.size() != FILE_STAT_INDEX_HEADER_SIZE + totalEntries * sizeof(FileStatIndexEntry)) {
+      indexFile.close();
+      return false;
+    }
+
+    indexEntryCount = totalEntries;
+    return true;
+  };
+
+  bool success = openExistingIndex();
+  if (!success) {
+    Serial.printf("[%lu] [ZIP] File stat index missing or stale, building: %s\n", millis(), indexPath.c_str());
+    success = writeFileStatIndex(indexPath) && openExistingIndex();
+  }
+  if (success) {
+    // Lookups go to the on-disk index first, so the fence index would only hold RAM
+    unloadFenceIndex();
+  }
+
+  if (!wasOpen) {
+    close();
+  }
+  return success;
+}
+
+void ZipFile::unloadFileStatIndex() {
+  if (indexFile) {
+    indexFile.close();
+  }
+  indexEntryCount = 0;
+}
+
+bool ZipFile::loadFenceIndex(const uint16_t spacing) {
+  unloadFenceIndex();
+  if (spacing == 0) {
+    return false;
+  }
+
+  const bool wasOpen = isOpen();
+  if (!wasOpen && !open()) {
+    return false;
+  }
+
+  if (!loadZipDetails()) {
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
+
+  const size_t fenceCount = (zipDetails.totalEntries + spacing - 1) / spacing;
+  const size_t indexBytes = zipDetails.totalEntries * sizeof(uint16_t) + fenceCount * sizeof(uint32_t);
+  if (indexBytes > FENCE_INDEX_MAX_BYTES) {
+    Serial.printf("[%lu] [ZIP] Fence index for %d entries would need %d bytes, not building it\n", millis(),
+                  zipDetails.totalEntries, static_cast<int>(indexBytes));
+    if (!wasOpen) {
+      close();
+    }
+    return false;
+  }
+  fenceNameHashes.reserve(zipDetails.totalEntries);
+  fenceOffsets.reserve(fenceCount);
+
+  file.seek(zipDetails.centralDirOffset);
+  char itemName[256];
+  while (file.available()) {
+    const uint32_t recordOffset = file.position();
+    FileStatSlim fileStat = {};
+    if (!readCentralDirEntry(&fileStat, itemName, sizeof(itemName))) break;
 
-    // Skip the rest of this entry (extra field + comment)
-    file.seekCur(m + k);
+    if (fenceNameHashes.size() % spacing == 0) {
+      fenceOffsets.push_back(recordOffset);
+    }
+    fenceNameHashes.push_back(fenceHashName(itemName));
   }
 
   if (!wasOpen) {
     close();
   }
+
+  const int entryCount = fenceNameHashes.size();
+  if (entryCount != zipDetails.totalEntries) {
+    Serial.printf("[%lu] [ZIP] Fenced %d entries but central directory reports %d\n", millis(), entryCount,
+                  zipDetails.totalEntries);
+    unloadFenceIndex();
+    return false;
+  }
+
+  fenceSpacing = spacing;
+  Serial.printf("[%lu] [ZIP] Built fence index with %d entries and %d fences (%d bytes)\n", millis(), entryCount,
+                static_cast<int>(fenceOffsets.size()), static_cast<int>(indexBytes));
+  return true;
+}
+
+void ZipFile::unloadFenceIndex() {
+  fenceNameHashes.clear();
+  fenceNameHashes.shrink_to_fit();
+  fenceOffsets.clear();
+  fenceOffsets.shrink_to_fit();
+  fenceSpacing = 0;
+}
+
+bool ZipFile::lookupFenceIndex(const char* filename, FileStatSlim* fileStat) {
+  const uint16_t nameHash = fenceHashName(filename);
+  char itemName[256];
+
+  for (size_t i = 0; i < fenceNameHashes.size(); i++) {
+    if (fenceNameHashes[i] != nameHash) {
+      continue;
+    }
+
+    // Jump to the nearest fence and skip forward to the candidate record
+    file.seek(fenceOffsets[i / fenceSpacing]);
+    bool readOk = true;
+    for (size_t skip = i % fenceSpacing; readOk && skip > 0; skip--) {
+      readOk = readCentralDirEntry(fileStat, itemName, 1);
+    }
+    if (readOk && readCentralDirEntry(fileStat, itemName, sizeof(itemName)) && strcmp(itemName, filename) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool ZipFile::centralDirNameEquals(const uint32_t centralDirRecordOffset, const char* filename) {
+  uint16_t nameLen;
+  file.seek(centralDirRecordOffset + 28);
+  file.read(&nameLen, 2);
+  if (nameLen != strlen(filename)) {
+    return false;
+  }
+
+  file.seek(centralDirRecordOffset + 46);
+  char buffer[64];
+  size_t compared = 0;
+  while (compared < nameLen) {
+    const size_t toRead = nameLen - compared < sizeof(buffer) ? nameLen - compared : sizeof(buffer);
+    if (file.read(buffer, toRead) != static_cast<int>(toRead) || memcmp(buffer, filename + compared, toRead) != 0) {
+      return false;
+    }
+    compared += toRead;
+  }
   return true;
 }
 
+bool ZipFile::lookupFileStatIndex(const char* filename, FileStatSlim* fileStat) {
+  const uint32_t nameHash = FsHelpers::fnv1a32(filename);
+
+  // Binary search for the first entry with a matching hash
+  uint32_t low = 0;
+  uint32_t high = indexEntryCount;
+  while (low < high) {
+    const uint32_t mid = low + (high - low) / 2;
+    uint32_t midHash;
+    indexFile.seek(FILE_STAT_INDEX_HEADER_SIZE + mid * sizeof(FileStatIndexEntry));
+    serialization::readPod(indexFile, midHash);
+    if (midHash < nameHash) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  // Walk all entries sharing the hash, verifying the name against the central directory
+  indexFile.seek(FILE_STAT_INDEX_HEADER_SIZE + low * sizeof(FileStatIndexEntry));
+  for (uint32_t i = low; i < indexEntryCount; i++) {
+    FileStatIndexEntry entry;
+    serialization::readPod(indexFile, entry);
+    if (entry.nameHash != nameHash) {
+      break;
+    }
+
+    if (centralDirNameEquals(entry.centralDirRecordOffset, filename)) {
+      *fileStat = entry.fileStat;
+      return true;
+    }
+  }
+
+  return false;
+}
+
 bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
   if (!fileStatSlimCache.empty()) {
     const auto it = fileStatSlimCache.find(filename);
@@ -95,6 +424,22 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
     return false;
   }
 
+  if (indexFile) {
+    const bool found = lookupFileStatIndex(filename, fileStat);
+    if (!wasOpen) {
+      close();
+    }
+    return found;
+  }
+
+  if (fenceSpacing > 0) {
+    const bool found = lookupFenceIndex(filename, fileStat);
+    if (!wasOpen) {
+      close();
+    }
+    return found;
+  }
+
   if (!loadZipDetails()) {
     if (!wasOpen) {
       close();
@@ -104,35 +449,16 @@ bool ZipFile::loadFileStatSlim(const char* filename, FileStatSlim* fileStat) {
 
   file.seek(zipDetails.centralDirOffset);
 
-  uint32_t sig;
   char itemName[256];
   bool found = false;
 
   while (file.available()) {
-    file.read(&sig, 4);
-    if (sig != 0x02014b50) break;  // End of list
-
-    file.seekCur(6);
-    file.read(&fileStat->method, 2);
-    file.seekCur(8);
-    file.read(&fileStat->compressedSize, 4);
-    file.read(&fileStat->uncompressedSize, 4);
-    uint16_t nameLen, m, k;
-    file.read(&nameLen, 2);
-    file.read(&m, 2);
-    file.read(&k, 2);
-    file.seekCur(8);
-    file.read(&fileStat->localHeaderOffset, 4);
-    file.read(itemName, nameLen);
-    itemName[nameLen] = '\0';
+    if (!readCentralDirEntry(fileStat, itemName, sizeof(itemName))) break;
 
     if (strcmp(itemName, filename) == 0) {
       found = true;
       break;
     }
-
-    // Skip the rest of this entry (extra field + comment)
-    file.seekCur(m + k);
   }
 
   if (!wasOpen) {
@@ -370,11 +696,17 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
 
   FileStatSlim fileStat = {};
   if (!loadFileStatSlim(filename, &fileStat)) {
+    if (!wasOpen) {
+      close();
+    }
     return false;
   }
 
   const long fileOffset = getDataOffset(fileStat);
   if (fileOffset < 0) {
+    if (!wasOpen) {
+      close();
+    }
     return false;
   }
 
@@ -548,3 +880,236 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
   Serial.printf("[%lu] [ZIP] Unsupported compression method\n", millis());
   return false;
 }
+
+bool ZipFile::InflateReader::open(const char* filename) {
+  close();
+  outOfMemory = false;
+
+  if (!zip.isOpen()) {
+    if (!zip.open()) {
+      return false;
+    }
+    ownsZipOpen = true;
+  }
+
+  if (!zip.loadFileStatSlim(filename, &fileStat)) {
+    close();
+    return false;
+  }
+
+  const long fileOffset = zip.getDataOffset(fileStat);
+  if (fileOffset < 0) {
+    close();
+    return false;
+  }
+  zip.file.seek(fileOffset);
+  dataCursor = fileOffset;
+  finished = false;
+
+  if (fileStat.method == MZ_NO_COMPRESSION) {
+    storedRemaining = fileStat.uncompressedSize;
+    return true;
+  }
+
+  if (fileStat.method != MZ_DEFLATED) {
+    Serial.printf("[%lu] [ZIP] Unsupported compression method\n", millis());
+    close();
+    return false;
+  }
+
+  inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+  inputBuffer = static_cast<uint8_t*>(malloc(inputChunkSize));
+  dictionary = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+  if (!inflator || !inputBuffer || !dictionary) {
+    Serial.printf("[%lu] [ZIP] Failed to allocate memory for inflate reader\n", millis());
+    close();
+    outOfMemory = true;
+    return false;
+  }
+  memset(inflator, 0, sizeof(tinfl_decompressor));
+  tinfl_init(inflator);
+
+  compressedRemaining = fileStat.compressedSize;
+  inputFilled = 0;
+  inputCursor = 0;
+  dictionaryWriteCursor = 0;
+  pendingOutputCursor = 0;
+  pendingOutputBytes = 0;
+  return true;
+}
+
+int ZipFile::InflateReader::read(uint8_t* buffer, const size_t size) {
+  if (!zip.isOpen()) {
+    return -1;
+  }
+
+  if (fileStat.method == MZ_NO_COMPRESSION) {
+    const size_t toRead = storedRemaining < size ? storedRemaining : size;
+    if (toRead == 0) {
+      return 0;
+    }
+    if (!seekToDataCursor()) {
+      return -1;
+    }
+    const int dataRead = zip.file.read(buffer, toRead);
+    if (dataRead <= 0) {
+      Serial.printf("[%lu] [ZIP] Could not read more bytes\n", millis());
+      return -1;
+    }
+    storedRemaining -= dataRead;
+    dataCursor += dataRead;
+    return dataRead;
+  }
+
+  if (!inflator) {
+    return -1;
+  }
+
+  size_t produced = 0;
+  while (produced < size) {
+    // Hand out anything already inflated into the dictionary before inflating more
+    if (pendingOutputBytes > 0) {
+      const size_t toCopy = pendingOutputBytes < size - produced ? pendingOutputBytes : size - produced;
+      memcpy(buffer + produced, dictionary + pendingOutputCursor, toCopy);
+      produced += toCopy;
+      pendingOutputCursor += toCopy;
+      pendingOutputBytes -= toCopy;
+      continue;
+    }
+
+    if (finished) {
+      break;
+    }
+
+    // Load more compressed bytes when needed
+    if (inputCursor >= inputFilled && compressedRemaining > 0) {
+      if (!seekToDataCursor()) {
+        return -1;
+      }
+      const int dataRead =
+          zip.file.read(inputBuffer, compressedRemaining < inputChunkSize ? compressedRemaining : inputChunkSize);
+      if (dataRead <= 0) {
+        Serial.printf("[%lu] [ZIP] Could not read more compressed bytes\n", millis());
+        return -1;
+      }
+      inputFilled = dataRead;
+      inputCursor = 0;
+      compressedRemaining -= dataRead;
+      dataCursor += dataRead;
+    }
+
+    size_t inBytes = inputFilled - inputCursor;
+    size_t outBytes = TINFL_LZ_DICT_SIZE - dictionaryWriteCursor;
+    const tinfl_status status =
+        tinfl_decompress(inflator, inputBuffer + inputCursor, &inBytes, dictionary, dictionary + dictionaryWriteCursor,
+                         &outBytes, compressedRemaining > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0);
+    inputCursor += inBytes;
+
+    // Output is always written contiguously up to the end of the dictionary, so it can be handed out as one run
+    pendingOutputCursor = dictionaryWriteCursor;
+    pendingOutputBytes = outBytes;
+    dictionaryWriteCursor = (dictionaryWriteCursor + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+
+    if (status < 0) {
+      Serial.printf("[%lu] [ZIP] tinfl_decompress() failed with status %d\n", millis(), status);
+      return -1;
+    }
+
+    if (status == TINFL_STATUS_DONE) {
+      finished = true;
+    } else if (inBytes == 0 && outBytes == 0 && inputCursor >= inputFilled && compressedRemaining == 0) {
+      Serial.printf("[%lu] [ZIP] Unexpected EOF\n", millis());
+      return -1;
+    }
+  }
+
+  return static_cast<int>(produced);
+}
+
+bool ZipFile::InflateReader::seekToDataCursor() {
+  // Other reads on the same archive may have moved the file position since the last refill
+  if (zip.file.position() != dataCursor && !zip.file.seek(dataCursor)) {
+    Serial.printf("[%lu] [ZIP] Could not seek back to entry data\n", millis());
+    return false;
+  }
+  return true;
+}
+
+bool ZipFile::InflateReader::suspend(const std::string& path) {
+  // Stored entries hold no inflate state
+  if (!inflator) {
+    return true;
+  }
+
+  FsFile spill;
+  if (!SdMan.openFileForWrite("ZIP", path, spill)) {
+    return false;
+  }
+  bool success = spill.write(reinterpret_cast<const uint8_t*>(inflator), sizeof(tinfl_decompressor)) ==
+                     sizeof(tinfl_decompressor) &&
+                 spill.write(dictionary, TINFL_LZ_DICT_SIZE) == TINFL_LZ_DICT_SIZE;
+  success = spill.close() && success;
+  if (!success) {
+    Serial.printf("[%lu] [ZIP] Failed to suspend inflate reader to %s\n", millis(), path.c_str());
+    SdMan.remove(path.c_str());
+    return false;
+  }
+
+  free(inflator);
+  free(dictionary);
+  inflator = nullptr;
+  dictionary = nullptr;
+  spillPath = path;
+  return true;
+}
+
+bool ZipFile::InflateReader::resume() {
+  if (spillPath.empty()) {
+    return true;
+  }
+
+  inflator = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+  dictionary = static_cast<uint8_t*>(malloc(TINFL_LZ_DICT_SIZE));
+  FsFile spill;
+  bool success = inflator && dictionary && SdMan.openFileForRead("ZIP", spillPath, spill);
+  if (success) {
+    success = spill.read(reinterpret_cast<uint8_t*>(inflator), sizeof(tinfl_decompressor)) ==
+                  sizeof(tinfl_decompressor) &&
+              spill.read(dictionary, TINFL_LZ_DICT_SIZE) == TINFL_LZ_DICT_SIZE;
+    spill.close();
+  }
+  SdMan.remove(spillPath.c_str());
+  spillPath.clear();
+
+  if (!success) {
+    Serial.printf("[%lu] [ZIP] Failed to resume inflate reader\n", millis());
+    // Leaves read() failing rather than inflating from a partial state
+    free(inflator);
+    free(dictionary);
+    inflator = nullptr;
+    dictionary = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void ZipFile::InflateReader::close() {
+  free(inflator);
+  free(inputBuffer);
+  free(dictionary);
+  inflator = nullptr;
+  inputBuffer = nullptr;
+  dictionary = nullptr;
+  pendingOutputBytes = 0;
+  storedRemaining = 0;
+  finished = true;
+  if (!spillPath.empty()) {
+    SdMan.remove(spillPath.c_str());
+    spillPath.clear();
+  }
+
+  if (ownsZipOpen) {
+    zip.close();
+    ownsZipOpen = false;
+  }
+}
@@ -3,6 +3,9 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+struct tinfl_decompressor_tag;
 
 class ZipFile {
  public:
@@ -19,28 +22,103 @@ class ZipFile {
     bool isSet;
   };
 
+  // Record in the on-disk file stat index, sorted by nameHash
+  struct FileStatIndexEntry {
+    uint32_t nameHash;
+    uint32_t centralDirRecordOffset;  // Used to verify the name on hash match
+    FileStatSlim fileStat;
+  };
+
  private:
   const std::string& filePath;
   FsFile file;
   ZipDetails zipDetails = {0, 0, false};
   std::unordered_map<std::string, FileStatSlim> fileStatSlimCache;
+  FsFile indexFile;
+  uint16_t indexEntryCount = 0;
+  // In-RAM fence index: a 16 bit name hash per central directory record and the offset of every fenceSpacing-th record
+  std::vector<uint16_t> fenceNameHashes;
+  std::vector<uint32_t> fenceOffsets;
+  uint16_t fenceSpacing = 0;
 
+  bool readCentralDirEntry(FileStatSlim* fileStat, char* itemName, size_t itemNameSize);
   bool loadFileStatSlim(const char* filename, FileStatSlim* fileStat);
+  bool lookupFileStatIndex(const char* filename, FileStatSlim* fileStat);
+  bool lookupFenceIndex(const char* filename, FileStatSlim* fileStat);
+  bool centralDirNameEquals(uint32_t centralDirRecordOffset, const char* filename);
+  bool writeFileStatIndex(const std::string& indexPath);
   long getDataOffset(const FileStatSlim& fileStat);
   bool loadZipDetails();
 
  public:
   explicit ZipFile(const std::string& filePath) : filePath(filePath) {}
-  ~ZipFile() = default;
-  // Zip file can be opened and closed by hand in order to allow for quick calculation of inflated file size
-  // It is NOT recommended to pre-open it for any kind of inflation due to memory constraints
+  ~ZipFile() {
+    if (indexFile) {
+      indexFile.close();
+    }
+  }
+  // The archive can be opened once and shared by every lookup and read that follows, saving an open per call.
+  // Holding it open only costs one FsFile handle; the inflation buffers belong to each read, not to the open archive.
   bool isOpen() const { return !!file; }
   bool open();
   bool close();
   bool loadAllFileStatSlims();
+  // Use (building it first if missing or stale) a sorted on-disk index of the central directory for lookups.
+  // This keeps lookups at O(log n) SD reads with constant RAM, unlike loadAllFileStatSlims.
+  bool loadFileStatIndex(const std::string& indexPath);
+  // Go back to central directory lookups, e.g. before the index file is deleted
+  void unloadFileStatIndex();
+  // Build an in-RAM fence index in one central directory pass, for when the on-disk index is unavailable and the
+  // central directory is too large for loadAllFileStatSlims. Uses 2 bytes per entry plus 4 bytes per fence, and a
+  // lookup scans at most spacing records from the nearest fence. Fails for archives whose index would exceed 32KB.
+  bool loadFenceIndex(uint16_t spacing);
+  void unloadFenceIndex();
   bool getInflatedFileSize(const char* filename, size_t* size);
-  // Due to the memory required to run each of these, it is recommended to not preopen the zip file for multiple
-  // These functions will open and close the zip as needed
+  // Each of these opens the archive if it is not open and closes it again when done, while an archive the caller
+  // opened is left open for the next call
   uint8_t* readFileToMemory(const char* filename, size_t* size = nullptr, bool trailingNullByte = false);
   bool readFileToStream(const char* filename, Print& out, size_t chunkSize);
+
+  // Pull-based reader for a single entry, only inflating as much as each read() asks for.
+  // Holds the inflator, a chunk of compressed input and the 32KB dictionary until closed.
+  class InflateReader {
+    ZipFile& zip;
+    FileStatSlim fileStat = {};
+    bool ownsZipOpen = false;
+    bool finished = false;
+    bool outOfMemory = false;
+    tinfl_decompressor_tag* inflator = nullptr;
+    uint8_t* inputBuffer = nullptr;
+    size_t inputChunkSize;
+    size_t inputFilled = 0;
+    size_t inputCursor = 0;
+    size_t compressedRemaining = 0;
+    uint8_t* dictionary = nullptr;
+    size_t dictionaryWriteCursor = 0;
+    size_t pendingOutputCursor = 0;
+    size_t pendingOutputBytes = 0;
+    size_t storedRemaining = 0;
+    // Archive offset of the next entry byte to read, so other reads on the zip can interleave with this one
+    uint32_t dataCursor = 0;
+    // Set while the inflator and dictionary are parked on SD by suspend
+    std::string spillPath;
+
+    bool seekToDataCursor();
+
+   public:
+    explicit InflateReader(ZipFile& zip, const size_t inputChunkSize = 1024)
+        : zip(zip), inputChunkSize(inputChunkSize) {}
+    ~InflateReader() { close(); }
+    bool open(const char* filename);
+    // True if the last open found the entry but could not allocate the inflate buffers
+    bool failedToAllocate() const { return outOfMemory; }
+    // Returns the number of bytes read, which is only less than size at the end of the entry, or -1 on error
+    int read(uint8_t* buffer, size_t size);
+    size_t getInflatedSize() const { return fileStat.uncompressedSize; }
+    // Writes the inflator and dictionary to path and frees them, so another entry can be inflated without holding
+    // two dictionaries. read() fails until resume() has loaded them back.
+    bool suspend(const std::string& path);
+    bool resume();
+    void close();
+  };
 };
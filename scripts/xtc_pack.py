@@ -0,0 +1,146 @@
+"""Repack the pages of an XTC/XTCH file with PackBits compression.
+
+Usage: python scripts/xtc_pack.py input.xtc output.xtc [--md5]
+
+Every page is packed, decoded again to check the round trip, and kept raw if packing does not make it smaller.
+With --md5 the first 8 bytes of each page bitmap's MD5 are stored in the page header, so the reader can verify them.
+"""
+
+import hashlib
+import struct
+import sys
+import time
+
+XTC_HEADER = struct.Struct("<IBBHIIIIQQQII")
+PAGE_TABLE_ENTRY = struct.Struct("<QIHH")
+PAGE_HEADER = struct.Struct("<IHHBBIQ")
+
+XTCH_MAGIC = 0x48435458
+COMPRESSION_NONE = 0
+COMPRESSION_PACKBITS = 1
+
+
+def packbits(data: bytes) -> bytes:
+    out = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 2:
+            out.append(257 - run)
+            out.append(data[i])
+            i += run
+            continue
+
+        start = i
+        i += 1
+        while i < n and i - start < 128:
+            if i + 2 < n and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def unpackbits(data: bytes, size: int) -> bytes:
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        control = data[i]
+        i += 1
+        if control < 128:
+            out += data[i:i + control + 1]
+            i += control + 1
+        elif control != 128:
+            out += bytes([data[i]]) * (257 - control)
+            i += 1
+    return bytes(out[:size])
+
+
+def bitmap_size(width: int, height: int, bit_depth: int) -> int:
+    if bit_depth == 2:
+        return (width * height + 7) // 8 * 2
+    return (width + 7) // 8 * height
+
+
+def main() -> int:
+    args = [a for a in sys.argv[1:] if not a.startswith("--")]
+    store_md5 = "--md5" in sys.argv
+    if len(args) != 2:
+        print(__doc__)
+        return 1
+
+    with open(args[0], "rb") as f:
+        src = f.read()
+
+    header = list(XTC_HEADER.unpack_from(src, 0))
+    magic, page_count, page_table_offset = header[0], header[3], header[8]
+    bit_depth = 2 if magic == XTCH_MAGIC else 1
+
+    entries = [PAGE_TABLE_ENTRY.unpack_from(src, page_table_offset + i * PAGE_TABLE_ENTRY.size)
+               for i in range(page_count)]
+    data_start = min(e[0] for e in entries)
+    if page_table_offset + page_count * PAGE_TABLE_ENTRY.size > data_start:
+        print("Page table must come before the page data")
+        return 1
+
+    # Only what comes before the first page is carried over, so the pages must run back to back to the end of the
+    # file. Anything after or between them would be dropped, and offsets pointing at it would dangle.
+    end = data_start
+    for offset, size, _, _ in sorted(entries):
+        if offset != end:
+            print(f"Unexpected data at offset {end}, the pages must run back to back to the end of the file")
+            return 1
+        end = offset + size
+    if end != len(src):
+        print(f"Unexpected data after the last page at offset {end}, the pages must run to the end of the file")
+        return 1
+
+    # Everything before the first page (header, metadata, chapters, page table) is kept as is
+    out = bytearray(src[:data_start])
+    raw_total = 0
+    packed_total = 0
+    decode_time = 0.0
+
+    for i, (offset, _, width, height) in enumerate(entries):
+        magic, pw, ph, color_mode, compression, _, _ = PAGE_HEADER.unpack_from(src, offset)
+        if compression != COMPRESSION_NONE:
+            print(f"Page {i} is already compressed")
+            return 1
+        size = bitmap_size(pw, ph, bit_depth)
+        bitmap = src[offset + PAGE_HEADER.size:offset + PAGE_HEADER.size + size]
+
+        packed = packbits(bitmap)
+        start = time.perf_counter()
+        if unpackbits(packed, size) != bitmap:
+            print(f"Page {i} failed the round trip")
+            return 1
+        decode_time += time.perf_counter() - start
+
+        if len(packed) < size:
+            compression, payload = COMPRESSION_PACKBITS, packed
+        else:
+            compression, payload = COMPRESSION_NONE, bitmap
+        md5 = struct.unpack("<Q", hashlib.md5(bitmap).digest()[:8])[0] if store_md5 else 0
+
+        new_offset = len(out)
+        out += PAGE_HEADER.pack(magic, pw, ph, color_mode, compression, len(payload), md5)
+        out += payload
+        PAGE_TABLE_ENTRY.pack_into(out, page_table_offset + i * PAGE_TABLE_ENTRY.size, new_offset,
+                                   PAGE_HEADER.size + len(payload), width, height)
+        raw_total += size
+        packed_total += len(payload)
+
+    with open(args[1], "wb") as f:
+        f.write(out)
+
+    print(f"{page_count} pages: {raw_total} -> {packed_total} bytes "
+          f"({100 * packed_total / max(raw_total, 1):.1f}%), host decode {1000 * decode_time / page_count:.2f}ms/page")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -90,6 +90,8 @@ class CrossPointSettings {
   char opdsServerUrl[128] = "";
   // Hide battery percentage
   uint8_t hideBatteryPercentage = HIDE_NEVER;
+  // Check XTC pages against the MD5 stored in their header while loading them
+  uint8_t verifyXtcPages = 0;
 
   ~CrossPointSettings() = default;
 
@@ -264,16 +264,23 @@ void OpdsBookBrowserActivity::fetchFeed(const std::string& path) {
   std::string url = UrlUtils::buildUrl(serverUrl, path);
   Serial.printf("[%lu] [OPDS] Fetching: %s\n", millis(), url.c_str());
 
-  std::string content;
-  if (!HttpDownloader::fetchUrl(url, content)) {
+  // The feed is parsed as it downloads so it never has to fit in memory as a whole
+  OpdsParser parser;
+  if (!parser.setup()) {
     state = BrowserState::ERROR;
-    errorMessage = "Failed to fetch feed";
+    errorMessage = "Failed to parse feed";
     updateRequired = true;
     return;
   }
 
-  OpdsParser parser;
-  if (!parser.parse(content.c_str(), content.size())) {
+  if (!HttpDownloader::fetchUrl(url, parser)) {
+    state = BrowserState::ERROR;
+    errorMessage = parser.hasError() ? "Failed to parse feed" : "Failed to fetch feed";
+    updateRequired = true;
+    return;
+  }
+
+  if (!parser.finish()) {
     state = BrowserState::ERROR;
     errorMessage = "Failed to parse feed";
     updateRequired = true;
@@ -1,12 +1,11 @@
 #include "CalibreWirelessActivity.h"
 
+#include <ArduinoJson.h>
 #include <GfxRenderer.h>
 #include <HardwareSerial.h>
 #include <SDCardManager.h>
 #include <WiFi.h>
 
-#include <cstring>
-
 #include "MappedInputManager.h"
 #include "ScreenComponents.h"
 #include "fontIds.h"
@@ -15,6 +14,13 @@
 namespace {
 constexpr uint16_t UDP_PORTS[] = {54982, 48123, 39001, 44044, 59678};
 constexpr uint16_t LOCAL_UDP_PORT = 8134;  // Port to receive responses
+// Largest message that can be parsed, anything bigger is skipped with an error reply. The connection used to be reset
+// once 100000 bytes were buffered, so this keeps every message that ever got through. When the heap is too fragmented
+// for it the size is halved down to MIN_RECV_BUFFER_SIZE, which still holds the init and book messages Calibre sends.
+constexpr size_t RECV_BUFFER_SIZE = 100 * 1024;
+constexpr size_t MIN_RECV_BUFFER_SIZE = 16 * 1024;
+// Book data is written to SD in blocks of this size, a multiple of the 512 byte sector size
+constexpr size_t TRANSFER_BUFFER_SIZE = 8 * 1024;
 }  // namespace
 
 void CalibreWirelessActivity::displayTaskTrampoline(void* param) {
@@ -44,7 +50,15 @@ void CalibreWirelessActivity::onEnter() {
   currentFileSize = 0;
   bytesReceived = 0;
   inBinaryMode = false;
-  recvBuffer.clear();
+  if (!recvBuffer.allocate(RECV_BUFFER_SIZE, MIN_RECV_BUFFER_SIZE)) {
+    Serial.printf("[%lu] [CAL] Failed to allocate receive buffer, largest free block %u bytes\n", millis(),
+                  ESP.getMaxAllocHeap());
+    state = WirelessState::ERROR;
+    errorMessage = "Not enough memory";
+  } else {
+    Serial.printf("[%lu] [CAL] Receive buffer %zu bytes, largest free block left %u bytes\n", millis(),
+                  recvBuffer.capacity(), ESP.getMaxAllocHeap());
+  }
 
   updateRequired = true;
 
@@ -72,11 +86,6 @@ void CalibreWirelessActivity::onExit() {
     tcpClient.stop();
   }
 
-  // Close any open file
-  if (currentFile) {
-    currentFile.close();
-  }
-
   // Acquire stateMutex before deleting network task to avoid race condition
   xSemaphoreTake(stateMutex, portMAX_DELAY);
   if (networkTaskHandle) {
@@ -85,6 +94,13 @@ void CalibreWirelessActivity::onExit() {
   }
   xSemaphoreGive(stateMutex);
 
+  // A book still being received is incomplete, anything else open is closed
+  if (inBinaryMode) {
+    discardCurrentFile();
+  } else if (currentFile) {
+    currentFile.close();
+  }
+
   // Acquire renderingMutex before deleting display task
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
   if (displayTaskHandle) {
@@ -96,6 +112,8 @@ void CalibreWirelessActivity::onExit() {
 
   vSemaphoreDelete(stateMutex);
   stateMutex = nullptr;
+
+  recvBuffer.release();
 }
 
 void CalibreWirelessActivity::loop() {
@@ -142,7 +160,8 @@ void CalibreWirelessActivity::networkTaskLoop() {
         break;
     }
 
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    // Poll more often during a book transfer so the socket's receive window is drained quickly
+    vTaskDelay((inBinaryMode ? 1 : 10) / portTICK_PERIOD_MS);
   }
 }
 
@@ -256,140 +275,96 @@ void CalibreWirelessActivity::listenForDiscovery() {
 }
 
 void CalibreWirelessActivity::handleTcpClient() {
+  // A connection lost mid-book is handled by receiveBinaryData, which also removes the partial file
+  if (inBinaryMode) {
+    receiveBinaryData();
+    return;
+  }
+
   if (!tcpClient.connected()) {
     setState(WirelessState::DISCONNECTED);
     setStatus("Calibre disconnected");
     return;
   }
 
-  if (inBinaryMode) {
-    receiveBinaryData();
+  std::string_view message;
+  if (!readJsonMessage(message)) {
     return;
   }
 
-  std::string message;
-  if (readJsonMessage(message)) {
-    // Parse opcode from JSON array format: [opcode, {...}]
-    // Find the opcode (first number after '[')
-    size_t start = message.find('[');
-    if (start != std::string::npos) {
-      start++;
-      size_t end = message.find(',', start);
-      if (end != std::string::npos) {
-        const int opcodeInt = std::stoi(message.substr(start, end - start));
-        if (opcodeInt < 0 || opcodeInt >= OpCode::ERROR) {
-          Serial.printf("[%lu] [CAL] Invalid opcode: %d\n", millis(), opcodeInt);
-          sendJsonResponse(OpCode::OK, "{}");
-          return;
-        }
-        const auto opcode = static_cast<OpCode>(opcodeInt);
-
-        // Extract data object (everything after the comma until the last ']')
-        size_t dataStart = end + 1;
-        size_t dataEnd = message.rfind(']');
-        std::string data = "";
-        if (dataEnd != std::string::npos && dataEnd > dataStart) {
-          data = message.substr(dataStart, dataEnd - dataStart);
-        }
-
-        handleCommand(opcode, data);
-      }
-    }
+  // Parse opcode from JSON array format: [opcode, {...}]
+  // Find the opcode (first number after '[')
+  size_t start = message.find('[');
+  if (start == std::string_view::npos) {
+    return;
+  }
+  start++;
+  const size_t end = message.find(',', start);
+  if (end == std::string_view::npos) {
+    return;
   }
-}
 
-bool CalibreWirelessActivity::readJsonMessage(std::string& message) {
-  // Read available data into buffer
-  int available = tcpClient.available();
-  if (available > 0) {
-    // Limit buffer growth to prevent memory issues
-    if (recvBuffer.size() > 100000) {
-      recvBuffer.clear();
-      return false;
-    }
-    // Read in chunks
-    char buf[1024];
-    while (available > 0) {
-      int toRead = std::min(available, static_cast<int>(sizeof(buf)));
-      int bytesRead = tcpClient.read(reinterpret_cast<uint8_t*>(buf), toRead);
-      if (bytesRead > 0) {
-        recvBuffer.append(buf, bytesRead);
-        available -= bytesRead;
-      } else {
-        break;
-      }
+  int opcodeInt = 0;
+  for (size_t i = start; i < end; i++) {
+    if (message[i] < '0' || message[i] > '9') {
+      opcodeInt = -1;
+      break;
     }
+    opcodeInt = opcodeInt * 10 + (message[i] - '0');
   }
-
-  if (recvBuffer.empty()) {
-    return false;
+  if (opcodeInt < 0 || opcodeInt >= OpCode::ERROR) {
+    Serial.printf("[%lu] [CAL] Invalid opcode: %d\n", millis(), opcodeInt);
+    sendJsonResponse(OpCode::OK, "{}");
+    return;
   }
+  const auto opcode = static_cast<OpCode>(opcodeInt);
 
-  // Find '[' which marks the start of JSON
-  size_t bracketPos = recvBuffer.find('[');
-  if (bracketPos == std::string::npos) {
-    // No '[' found - if buffer is getting large, something is wrong
-    if (recvBuffer.size() > 1000) {
-      recvBuffer.clear();
-    }
-    return false;
+  // Extract data object (everything after the comma until the last ']')
+  const size_t dataStart = end + 1;
+  const size_t dataEnd = message.rfind(']');
+  std::string_view data;
+  if (dataEnd != std::string_view::npos && dataEnd > dataStart) {
+    data = message.substr(dataStart, dataEnd - dataStart);
   }
 
-  // Try to extract length from digits before '['
-  // Calibre ALWAYS sends a length prefix, so if it's not valid digits, it's garbage
-  size_t msgLen = 0;
-  bool validPrefix = false;
-
-  if (bracketPos > 0 && bracketPos <= 12) {
-    // Check if prefix is all digits
-    bool allDigits = true;
-    for (size_t i = 0; i < bracketPos; i++) {
-      char c = recvBuffer[i];
-      if (c < '0' || c > '9') {
-        allDigits = false;
-        break;
-      }
-    }
-    if (allDigits) {
-      msgLen = std::stoul(recvBuffer.substr(0, bracketPos));
-      validPrefix = true;
-    }
-  }
+  handleCommand(opcode, data);
+}
 
-  if (!validPrefix) {
-    // Not a valid length prefix - discard everything up to '[' and treat '[' as start
-    if (bracketPos > 0) {
-      recvBuffer = recvBuffer.substr(bracketPos);
-    }
-    // Without length prefix, we can't reliably parse - wait for more data
-    // that hopefully starts with a proper length prefix
-    return false;
+void CalibreWirelessActivity::fillRecvBuffer() {
+  const int available = tcpClient.available();
+  if (available <= 0) {
+    return;
   }
 
-  // Sanity check the message length
-  if (msgLen > 1000000) {
-    recvBuffer = recvBuffer.substr(bracketPos + 1);  // Skip past this '[' and try again
-    return false;
+  size_t space;
+  uint8_t* dest = recvBuffer.prepareWrite(available, &space);
+  if (space == 0) {
+    return;
   }
 
-  // Check if we have the complete message
-  size_t totalNeeded = bracketPos + msgLen;
-  if (recvBuffer.size() < totalNeeded) {
-    // Not enough data yet - wait for more
-    return false;
+  const int bytesRead = tcpClient.read(dest, space);
+  if (bytesRead > 0) {
+    recvBuffer.commitWrite(bytesRead);
   }
+}
 
-  // Extract the message
-  message = recvBuffer.substr(bracketPos, msgLen);
+bool CalibreWirelessActivity::readJsonMessage(std::string_view& message) {
+  fillRecvBuffer();
 
-  // Keep the rest in buffer (may contain binary data or next message)
-  if (recvBuffer.size() > totalNeeded) {
-    recvBuffer = recvBuffer.substr(totalNeeded);
-  } else {
-    recvBuffer.clear();
+  switch (recvBuffer.next(message)) {
+    case CalibreMessageBuffer::Result::MESSAGE:
+      return true;
+    case CalibreMessageBuffer::Result::TOO_LARGE:
+      // Calibre waits for a reply to every message, so answer from the opcode while the rest is dropped
+      if (message == std::to_string(OpCode::NOOP)) {
+        sendJsonResponse(OpCode::NOOP, "{}");
+      } else {
+        sendJsonResponse(OpCode::ERROR, "{\"message\":\"Message too large\"}");
+      }
+      return false;
+    default:
+      return false;
   }
-
-  return true;
 }
 
 void CalibreWirelessActivity::sendJsonResponse(const OpCode opcode, const std::string& data) {
@@ -402,7 +377,7 @@ void CalibreWirelessActivity::sendJsonResponse(const OpCode opcode, const std::s
   tcpClient.flush();
 }
 
-void CalibreWirelessActivity::handleCommand(const OpCode opcode, const std::string& data) {
+void CalibreWirelessActivity::handleCommand(const OpCode opcode, const std::string_view data) {
   switch (opcode) {
     case OpCode::GET_INITIALIZATION_INFO:
       handleGetInitializationInfo(data);
@@ -453,7 +428,7 @@ void CalibreWirelessActivity::handleCommand(const OpCode opcode, const std::stri
   }
 }
 
-void CalibreWirelessActivity::handleGetInitializationInfo(const std::string& data) {
+void CalibreWirelessActivity::handleGetInitializationInfo(const std::string_view data) {
   setState(WirelessState::WAITING);
   setStatus("Connected to " + calibreHostname +
             "\nWaiting for transfer...\n\nIf transfer fails, enable\n'Ignore free space' in Calibre's\nSmartDevice "
@@ -515,58 +490,21 @@ void CalibreWirelessActivity::handleGetBookCount() {
   sendJsonResponse(OpCode::OK, response);
 }
 
-void CalibreWirelessActivity::handleSendBook(const std::string& data) {
-  // Manually extract lpath and length from SEND_BOOK data
-  // Full JSON parsing crashes on large metadata, so we just extract what we need
-
-  // Extract "lpath" field - format: "lpath": "value"
-  std::string lpath;
-  size_t lpathPos = data.find("\"lpath\"");
-  if (lpathPos != std::string::npos) {
-    size_t colonPos = data.find(':', lpathPos + 7);
-    if (colonPos != std::string::npos) {
-      size_t quoteStart = data.find('"', colonPos + 1);
-      if (quoteStart != std::string::npos) {
-        size_t quoteEnd = data.find('"', quoteStart + 1);
-        if (quoteEnd != std::string::npos) {
-          lpath = data.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-        }
-      }
-    }
+void CalibreWirelessActivity::handleSendBook(const std::string_view data) {
+  // Only lpath and the top level length are needed. Full JSON parsing crashes on large metadata, so the filter keeps
+  // the metadata object (which has nested "length" fields of its own, e.g. cover image length) out of the document.
+  JsonDocument filter;
+  filter["lpath"] = true;
+  filter["length"] = true;
+  JsonDocument doc;
+  const DeserializationError error =
+      deserializeJson(doc, data.data(), data.size(), DeserializationOption::Filter(filter));
+  if (error) {
+    Serial.printf("[%lu] [CAL] SEND_BOOK parse failed: %s\n", millis(), error.c_str());
   }
 
-  // Extract top-level "length" field - must track depth to skip nested objects
-  // The metadata contains nested "length" fields (e.g., cover image length)
-  size_t length = 0;
-  int depth = 0;
-  for (size_t i = 0; i < data.size(); i++) {
-    char c = data[i];
-    if (c == '{' || c == '[') {
-      depth++;
-    } else if (c == '}' || c == ']') {
-      depth--;
-    } else if (depth == 1 && c == '"') {
-      // At top level, check if this is "length"
-      if (i + 9 < data.size() && data.substr(i, 8) == "\"length\"") {
-        // Found top-level "length" - extract the number after ':'
-        size_t colonPos = data.find(':', i + 8);
-        if (colonPos != std::string::npos) {
-          size_t numStart = colonPos + 1;
-          while (numStart < data.size() && (data[numStart] == ' ' || data[numStart] == '\t')) {
-            numStart++;
-          }
-          size_t numEnd = numStart;
-          while (numEnd < data.size() && data[numEnd] >= '0' && data[numEnd] <= '9') {
-            numEnd++;
-          }
-          if (numEnd > numStart) {
-            length = std::stoul(data.substr(numStart, numEnd - numStart));
-            break;
-          }
-        }
-      }
-    }
-  }
+  const std::string lpath = doc["lpath"] | "";
+  const size_t length = doc["length"] | static_cast<size_t>(0);
 
   if (lpath.empty() || length == 0) {
     sendJsonResponse(OpCode::ERROR, "{\"message\":\"Invalid book data\"}");
@@ -598,41 +536,43 @@ void CalibreWirelessActivity::handleSendBook(const std::string& data) {
     return;
   }
 
+  // Reserve the whole book up front so the writes don't have to search the FAT for free clusters as the file grows
+  if (!currentFile.preAllocate(length)) {
+    Serial.printf("[%lu] [CAL] Could not preallocate %zu bytes for %s\n", millis(), length, currentFilename.c_str());
+  }
+
+  if (!bookWriter.begin(currentFile, TRANSFER_BUFFER_SIZE)) {
+    discardCurrentFile();
+    setError("Not enough memory");
+    sendJsonResponse(OpCode::ERROR, "{\"message\":\"Not enough memory\"}");
+    return;
+  }
+
   // Send OK to start receiving binary data
   sendJsonResponse(OpCode::OK, "{}");
 
-  // Switch to binary mode
+  // Switch to binary mode, any book data that arrived with the JSON is taken from recvBuffer first
   inBinaryMode = true;
   binaryBytesRemaining = length;
-
-  // Check if recvBuffer has leftover data (binary file data that arrived with the JSON)
-  if (!recvBuffer.empty()) {
-    size_t toWrite = std::min(recvBuffer.size(), binaryBytesRemaining);
-    size_t written = currentFile.write(reinterpret_cast<const uint8_t*>(recvBuffer.data()), toWrite);
-    bytesReceived += written;
-    binaryBytesRemaining -= written;
-    recvBuffer = recvBuffer.substr(toWrite);
-    updateRequired = true;
-  }
 }
 
-void CalibreWirelessActivity::handleSendBookMetadata(const std::string& data) {
+void CalibreWirelessActivity::handleSendBookMetadata(const std::string_view data) {
   // We receive metadata after the book - just acknowledge
   sendJsonResponse(OpCode::OK, "{}");
 }
 
-void CalibreWirelessActivity::handleDisplayMessage(const std::string& data) {
+void CalibreWirelessActivity::handleDisplayMessage(const std::string_view data) {
   // Calibre may send messages to display
   // Check messageKind - 1 means password error
-  if (data.find("\"messageKind\":1") != std::string::npos) {
+  if (data.find("\"messageKind\":1") != std::string_view::npos) {
     setError("Password required");
   }
   sendJsonResponse(OpCode::OK, "{}");
 }
 
-void CalibreWirelessActivity::handleNoop(const std::string& data) {
+void CalibreWirelessActivity::handleNoop(const std::string_view data) {
   // Check for ejecting flag
-  if (data.find("\"ejecting\":true") != std::string::npos) {
+  if (data.find("\"ejecting\":true") != std::string_view::npos) {
     setState(WirelessState::DISCONNECTED);
     setStatus("Calibre disconnected");
   }
@@ -640,39 +580,69 @@ void CalibreWirelessActivity::handleNoop(const std::string& data) {
 }
 
 void CalibreWirelessActivity::receiveBinaryData() {
-  const int available = tcpClient.available();
-  if (available == 0) {
-    // Check if connection is still alive
-    if (!tcpClient.connected()) {
-      currentFile.close();
-      inBinaryMode = false;
-      setError("Transfer interrupted");
+  while (binaryBytesRemaining > 0) {
+    size_t room;
+    uint8_t* buffer = bookWriter.reserve(&room);
+    if (!buffer) {
+      discardCurrentFile();
+      setError("Failed to write file");
+      return;
     }
-    return;
-  }
+    room = std::min(room, binaryBytesRemaining);
+    size_t bytesRead;
+
+    if (recvBuffer.unread() > 0) {
+      // Book data that arrived together with the SEND_BOOK message
+      bytesRead = recvBuffer.take(buffer, room);
+    } else {
+      const int available = tcpClient.available();
+      if (available <= 0) {
+        // Check if connection is still alive
+        if (!tcpClient.connected()) {
+          discardCurrentFile();
+          setError("Transfer interrupted");
+        }
+        return;
+      }
 
-  uint8_t buffer[1024];
-  const size_t toRead = std::min(sizeof(buffer), binaryBytesRemaining);
-  const size_t bytesRead = tcpClient.read(buffer, toRead);
+      const int result = tcpClient.read(buffer, std::min(room, static_cast<size_t>(available)));
+      if (result <= 0) {
+        return;
+      }
+      bytesRead = static_cast<size_t>(result);
+    }
 
-  if (bytesRead > 0) {
-    currentFile.write(buffer, bytesRead);
+    bookWriter.commit(bytesRead);
     bytesReceived += bytesRead;
     binaryBytesRemaining -= bytesRead;
     updateRequired = true;
+  }
 
-    if (binaryBytesRemaining == 0) {
-      // Transfer complete
-      currentFile.flush();
-      currentFile.close();
-      inBinaryMode = false;
+  // Transfer complete. The file was preallocated from the advertised length, cut it to what was actually received.
+  if (!bookWriter.end() || !currentFile.truncate(bytesReceived)) {
+    discardCurrentFile();
+    setError("Failed to write file");
+    sendJsonResponse(OpCode::ERROR, "{\"message\":\"Failed to write file\"}");
+    return;
+  }
+  currentFile.close();
+  inBinaryMode = false;
 
-      setState(WirelessState::WAITING);
-      setStatus("Received: " + currentFilename + "\nWaiting for more...");
+  setState(WirelessState::WAITING);
+  setStatus("Received: " + currentFilename + "\nWaiting for more...");
 
-      // Send OK to acknowledge completion
-      sendJsonResponse(OpCode::OK, "{}");
-    }
+  // Send OK to acknowledge completion
+  sendJsonResponse(OpCode::OK, "{}");
+}
+
+void CalibreWirelessActivity::discardCurrentFile() {
+  bookWriter.end();
+  currentFile.close();
+  inBinaryMode = false;
+
+  // The file was preallocated to the full book length, so a partial copy would be listed as a corrupt book
+  if (!SdMan.remove(currentFilename.c_str())) {
+    Serial.printf("[%lu] [CAL] Failed to remove partial file %s\n", millis(), currentFilename.c_str());
   }
 }
 
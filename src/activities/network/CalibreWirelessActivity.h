@@ -1,4 +1,6 @@
 #pragma once
+#include <CalibreMessageBuffer.h>
+#include <DoubleBufferedFileWriter.h>
 #include <SDCardManager.h>
 #include <WiFiClient.h>
 #include <WiFiUdp.h>
@@ -8,6 +10,7 @@
 
 #include <functional>
 #include <string>
+#include <string_view>
 
 #include "activities/Activity.h"
 
@@ -91,7 +94,10 @@ class CalibreWirelessActivity final : public Activity {
   bool inBinaryMode = false;
   size_t binaryBytesRemaining = 0;
   FsFile currentFile;
-  std::string recvBuffer;  // Buffer for incoming data (like KOReader)
+  // Incoming protocol bytes, messages are parsed in place
+  CalibreMessageBuffer recvBuffer;
+  // Book data is received into one buffer while the writer task writes the other to currentFile
+  DoubleBufferedFileWriter bookWriter;
 
   static void displayTaskTrampoline(void* param);
   static void networkTaskTrampoline(void* param);
@@ -102,20 +108,24 @@ class CalibreWirelessActivity final : public Activity {
   // Network operations
   void listenForDiscovery();
   void handleTcpClient();
-  bool readJsonMessage(std::string& message);
+  void fillRecvBuffer();
+  // The message points into recvBuffer and stays valid until the next call
+  bool readJsonMessage(std::string_view& message);
   void sendJsonResponse(OpCode opcode, const std::string& data);
-  void handleCommand(OpCode opcode, const std::string& data);
+  void handleCommand(OpCode opcode, std::string_view data);
   void receiveBinaryData();
+  // Stops any transfer and removes the partly received book
+  void discardCurrentFile();
 
   // Protocol handlers
-  void handleGetInitializationInfo(const std::string& data);
+  void handleGetInitializationInfo(std::string_view data);
   void handleGetDeviceInformation();
   void handleFreeSpace();
   void handleGetBookCount();
-  void handleSendBook(const std::string& data);
-  void handleSendBookMetadata(const std::string& data);
-  void handleDisplayMessage(const std::string& data);
-  void handleNoop(const std::string& data);
+  void handleSendBook(std::string_view data);
+  void handleSendBookMetadata(std::string_view data);
+  void handleDisplayMessage(std::string_view data);
+  void handleNoop(std::string_view data);
 
   // Utility
   std::string getDeviceUuid() const;
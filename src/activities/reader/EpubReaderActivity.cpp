@@ -3,8 +3,8 @@
 #include <Epub/Page.h>
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
-#include <SDCardManager.h>
 
+#include "Battery.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "EpubReaderChapterSelectionActivity.h"
@@ -52,16 +52,16 @@ void EpubReaderActivity::onEnter() {
   renderingMutex = xSemaphoreCreateMutex();
 
   epub->setupCacheDir();
-
-  FsFile f;
-  if (SdMan.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    if (f.read(data, 4) == 4) {
-      currentSpineIndex = data[0] + (data[1] << 8);
-      nextPageNumber = data[2] + (data[3] << 8);
-      Serial.printf("[%lu] [ERS] Loaded cache: %d, %d\n", millis(), currentSpineIndex, nextPageNumber);
-    }
-    f.close();
+  // Section builds and image reads all go through the same open archive while the book is open
+  epub->openZip();
+  prebuilder.reset(new SectionPrebuilder(epub, renderer));
+
+  progressStore.reset(new ReadingProgressStore(epub->getCachePath()));
+  uint8_t data[ReadingProgressStore::DATA_SIZE];
+  if (progressStore->load(data)) {
+    currentSpineIndex = data[0] + (data[1] << 8);
+    nextPageNumber = data[2] + (data[3] << 8);
+    Serial.printf("[%lu] [ERS] Loaded cache: %d, %d\n", millis(), currentSpineIndex, nextPageNumber);
   }
   // We may want a better condition to detect if we are opening for the first time.
   // This will trigger if the book is re-opened at Chapter 0.
@@ -92,6 +92,9 @@ void EpubReaderActivity::onEnter() {
 void EpubReaderActivity::onExit() {
   ActivityWithSubactivity::onExit();
 
+  // Free the SD card of any background section build before tearing down
+  stopPrebuild();
+
   // Reset orientation back to portrait for the rest of the UI
   renderer.setOrientation(GfxRenderer::Orientation::Portrait);
 
@@ -103,7 +106,16 @@ void EpubReaderActivity::onExit() {
   }
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
+  // Only once the display task is gone, as it starts builds. This waits for a task still idling to exit.
+  prebuilder.reset();
+  if (progressStore) {
+    progressStore->flush();
+    progressStore.reset();
+  }
   section.reset();
+  if (epub) {
+    epub->closeZip();
+  }
   epub.reset();
 }
 
@@ -114,10 +126,21 @@ void EpubReaderActivity::loop() {
     return;
   }
 
+  // Any input takes priority over background work, and frees the SD card for whatever the input leads to
+  if (mappedInput.wasAnyPressed() || mappedInput.wasAnyReleased()) {
+    stopPrebuild();
+  }
+
   // Enter chapter selection activity
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     // Don't start activity transition while rendering
     xSemaphoreTake(renderingMutex, portMAX_DELAY);
+    // A render that finished while this waited for the mutex may have started a build again, and nothing stops one
+    // while the chapter list has the SD card and the renderer
+    stopPrebuild();
+    // The chapter list reads the SD card from its own task, which the timed flush below does not lock against, so
+    // write the position out now and let the timed flush sit out while the list is open
+    progressStore->flush();
     exitActivity();
     enterNewActivity(new EpubReaderChapterSelectionActivity(
         this->renderer, this->mappedInput, epub, currentSpineIndex,
@@ -218,14 +241,39 @@ void EpubReaderActivity::displayTaskLoop() {
   while (true) {
     if (updateRequired) {
       updateRequired = false;
+      stopPrebuild();
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       renderScreen();
+      // Still under the mutex, so a chapter list opened since the render is seen and no build starts beside it
+      if (section && !subActivity) {
+        startPrebuild();
+      }
+      xSemaphoreGive(renderingMutex);
+    } else if (!subActivity && progressStore && progressStore->isFlushDue() && prebuilder->tryLockCard()) {
+      // Timed progress write while idle on a page, left for later if a background build has the SD card
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      if (!subActivity) {
+        progressStore->flush();
+      }
       xSemaphoreGive(renderingMutex);
+      prebuilder->unlockCard();
     }
     vTaskDelay(10 / portTICK_PERIOD_MS);
   }
 }
 
+void EpubReaderActivity::startPrebuild() {
+  prebuilder->start(currentSpineIndex,
+                    {SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(), SETTINGS.extraParagraphSpacing,
+                     SETTINGS.paragraphAlignment, viewportWidth, viewportHeight});
+}
+
+void EpubReaderActivity::stopPrebuild() {
+  if (prebuilder) {
+    prebuilder->stop();
+  }
+}
+
 // TODO: Failure handling
 void EpubReaderActivity::renderScreen() {
   if (!epub) {
@@ -258,14 +306,14 @@ void EpubReaderActivity::renderScreen() {
   orientedMarginRight += SETTINGS.screenMargin;
   orientedMarginBottom += statusBarMargin;
 
+  viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
+  viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
+
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
     Serial.printf("[%lu] [ERS] Loading file: %s, index: %d\n", millis(), filepath.c_str(), currentSpineIndex);
     section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
 
-    const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
-    const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
-
     if (!section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                   SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
                                   viewportHeight)) {
@@ -360,22 +408,28 @@ void EpubReaderActivity::renderScreen() {
     Serial.printf("[%lu] [ERS] Rendered page in %dms\n", millis(), millis() - start);
   }
 
-  FsFile f;
-  if (SdMan.openFileForWrite("ERS", epub->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    data[0] = currentSpineIndex & 0xFF;
-    data[1] = (currentSpineIndex >> 8) & 0xFF;
-    data[2] = section->currentPage & 0xFF;
-    data[3] = (section->currentPage >> 8) & 0xFF;
-    f.write(data, 4);
-    f.close();
-  }
+  uint8_t data[ReadingProgressStore::DATA_SIZE];
+  data[0] = currentSpineIndex & 0xFF;
+  data[1] = (currentSpineIndex >> 8) & 0xFF;
+  data[2] = section->currentPage & 0xFF;
+  data[3] = (section->currentPage >> 8) & 0xFF;
+  progressStore->update(data, battery.readPercentage());
 }
 
 void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
                                         const int orientedMarginRight, const int orientedMarginBottom,
                                         const int orientedMarginLeft) {
+  // Produce the BW page and both grayscale planes from one pass. The planes are only held for this page so section
+  // builds get the 96KB back, without the room for them the separate passes below are used.
+  const bool singlePassGrayscale = SETTINGS.textAntiAliasing && renderer.allocateGrayscalePlanes();
+  if (singlePassGrayscale) {
+    renderer.setRenderMode(GfxRenderer::BW_AND_GRAYSCALE);
+  }
+  // Without anti-aliasing this BW render is all that is shown, so images must not draw their grays as black
+  renderer.setBwImageThreshold(!SETTINGS.textAntiAliasing);
   page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderer.setBwImageThreshold(false);
+  renderer.setRenderMode(GfxRenderer::BW);
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
   if (pagesUntilFullRefresh <= 1) {
     renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
@@ -385,6 +439,12 @@ void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int or
     pagesUntilFullRefresh--;
   }
 
+  if (singlePassGrayscale) {
+    renderer.displayGrayscalePlanes();
+    renderer.freeGrayscalePlanes();
+    return;
+  }
+
   // Save bw buffer to reset buffer state after grayscale data sync
   renderer.storeBwBuffer();
 
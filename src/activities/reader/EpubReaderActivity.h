@@ -1,6 +1,8 @@
 #pragma once
 #include <Epub.h>
 #include <Epub/Section.h>
+#include <Epub/SectionPrebuilder.h>
+#include <ReadingProgressStore.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <freertos/task.h>
@@ -10,8 +12,13 @@
 class EpubReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
+  std::unique_ptr<ReadingProgressStore> progressStore = nullptr;
   TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
+  // Background build of the neighbouring sections, from onEnter to onExit
+  std::unique_ptr<SectionPrebuilder> prebuilder = nullptr;
+  uint16_t viewportWidth = 0;
+  uint16_t viewportHeight = 0;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
   int pagesUntilFullRefresh = 0;
@@ -21,6 +28,8 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
 
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
+  void startPrebuild();
+  void stopPrebuild();
   void renderScreen();
   void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
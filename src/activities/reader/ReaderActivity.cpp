@@ -1,5 +1,6 @@
 #include "ReaderActivity.h"
 
+#include "CrossPointSettings.h"
 #include "Epub.h"
 #include "EpubReaderActivity.h"
 #include "FileSelectionActivity.h"
@@ -43,6 +44,7 @@ std::unique_ptr<Xtc> ReaderActivity::loadXtc(const std::string& path) {
 
   auto xtc = std::unique_ptr<Xtc>(new Xtc(path, "/.crosspoint"));
   if (xtc->load()) {
+    xtc->setVerifyChecksums(SETTINGS.verifyXtcPages);
     return xtc;
   }
 
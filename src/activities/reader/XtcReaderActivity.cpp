@@ -9,8 +9,8 @@
 
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
-#include <SDCardManager.h>
 
+#include "Battery.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "MappedInputManager.h"
@@ -67,6 +67,10 @@ void XtcReaderActivity::onExit() {
   }
   vSemaphoreDelete(renderingMutex);
   renderingMutex = nullptr;
+  if (progressStore) {
+    progressStore->flush();
+    progressStore.reset();
+  }
   xtc.reset();
 }
 
@@ -81,6 +85,8 @@ void XtcReaderActivity::loop() {
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     if (xtc && xtc->hasChapters() && !xtc->getChapters().empty()) {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      // The timed flush sits out while the chapter list is open, so write the position out now
+      progressStore->flush();
       exitActivity();
       enterNewActivity(new XtcReaderChapterSelectionActivity(
           this->renderer, this->mappedInput, xtc, currentPage,
@@ -153,6 +159,14 @@ void XtcReaderActivity::displayTaskLoop() {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       renderScreen();
       xSemaphoreGive(renderingMutex);
+    } else if (!subActivity && progressStore && progressStore->isFlushDue()) {
+      // Timed progress write while idle on a page. A subactivity reads the SD card from its own task, so the write
+      // waits until it is closed.
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      if (!subActivity) {
+        progressStore->flush();
+      }
+      xSemaphoreGive(renderingMutex);
     }
     vTaskDelay(10 / portTICK_PERIOD_MS);
   }
@@ -181,15 +195,58 @@ void XtcReaderActivity::renderPage() {
   const uint16_t pageHeight = xtc->getPageHeight();
   const uint8_t bitDepth = xtc->getBitDepth();
 
+  if (bitDepth != 2) {
+    // 1-bit mode: Row-major, 8 pixels per byte, MSB first
+    // Rows are drawn as they stream in, so no page buffer is needed
+    const size_t srcRowBytes = (pageWidth + 7) / 8;  // 60 bytes for 480 width
+
+    renderer.clearScreen();
+    const xtc::XtcError err = xtc->loadPageStreaming(
+        currentPage,
+        [&](const uint8_t* data, const size_t size, const size_t offset) {
+          for (size_t i = 0; i < size; i++) {
+            // XTC: 0 = black, 1 = white; white pixels are already cleared by clearScreen()
+            const uint8_t srcByte = data[i];
+            if (srcByte == 0xFF) {
+              continue;
+            }
+            const uint16_t srcY = (offset + i) / srcRowBytes;
+            const uint16_t byteX = ((offset + i) % srcRowBytes) * 8;
+            for (uint16_t bit = 0; bit < 8 && byteX + bit < pageWidth; bit++) {
+              if (!(srcByte & (0x80 >> bit))) {
+                renderer.drawPixel(byteX + bit, srcY, true);
+              }
+            }
+          }
+        },
+        srcRowBytes * 16);
+    if (err != xtc::XtcError::OK) {
+      Serial.printf("[%lu] [XTR] Failed to load page %lu: %s\n", millis(), currentPage, xtc::errorToString(err));
+      renderer.clearScreen();
+      renderer.drawCenteredText(UI_12_FONT_ID, 300, "Page load error", true, EpdFontFamily::BOLD);
+      renderer.displayBuffer();
+      return;
+    }
+
+    // XTC pages already have status bar pre-rendered, no need to add our own
+
+    // Display with appropriate refresh
+    if (pagesUntilFullRefresh <= 1) {
+      renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
+      pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
+    } else {
+      renderer.displayBuffer();
+      pagesUntilFullRefresh--;
+    }
+
+    Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (1-bit)\n", millis(), currentPage + 1, xtc->getPageCount());
+    return;
+  }
+
   // Calculate buffer size for one page
-  // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
   // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
-  size_t pageBufferSize;
-  if (bitDepth == 2) {
-    pageBufferSize = ((static_cast<size_t>(pageWidth) * pageHeight + 7) / 8) * 2;
-  } else {
-    pageBufferSize = ((pageWidth + 7) / 8) * pageHeight;
-  }
+  // The planes are read several times below, so the whole page is loaded first
+  const size_t pageBufferSize = ((static_cast<size_t>(pageWidth) * pageHeight + 7) / 8) * 2;
 
   // Allocate page buffer
   uint8_t* pageBuffer = static_cast<uint8_t*>(malloc(pageBufferSize));
@@ -217,8 +274,6 @@ void XtcReaderActivity::renderPage() {
 
   // Copy page bitmap using GfxRenderer's drawPixel
   // XTC/XTCH pages are pre-rendered with status bar included, so render full page
-  const uint16_t maxSrcY = pageHeight;
-
   if (bitDepth == 2) {
     // XTH 2-bit mode: Two bit planes, column-major order
     // - Columns scanned right to left (x = width-1 down to 0)
@@ -319,71 +374,28 @@ void XtcReaderActivity::renderPage() {
 
     Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (2-bit grayscale)\n", millis(), currentPage + 1,
                   xtc->getPageCount());
-    return;
-  } else {
-    // 1-bit mode: 8 pixels per byte, MSB first
-    const size_t srcRowBytes = (pageWidth + 7) / 8;  // 60 bytes for 480 width
-
-    for (uint16_t srcY = 0; srcY < maxSrcY; srcY++) {
-      const size_t srcRowStart = srcY * srcRowBytes;
-
-      for (uint16_t srcX = 0; srcX < pageWidth; srcX++) {
-        // Read source pixel (MSB first, bit 7 = leftmost pixel)
-        const size_t srcByte = srcRowStart + srcX / 8;
-        const size_t srcBit = 7 - (srcX % 8);
-        const bool isBlack = !((pageBuffer[srcByte] >> srcBit) & 1);  // XTC: 0 = black, 1 = white
-
-        if (isBlack) {
-          renderer.drawPixel(srcX, srcY, true);
-        }
-      }
-    }
   }
-  // White pixels are already cleared by clearScreen()
-
-  free(pageBuffer);
-
-  // XTC pages already have status bar pre-rendered, no need to add our own
-
-  // Display with appropriate refresh
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(EInkDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
-
-  Serial.printf("[%lu] [XTR] Rendered page %lu/%lu (%u-bit)\n", millis(), currentPage + 1, xtc->getPageCount(),
-                bitDepth);
 }
 
-void XtcReaderActivity::saveProgress() const {
-  FsFile f;
-  if (SdMan.openFileForWrite("XTR", xtc->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    data[0] = currentPage & 0xFF;
-    data[1] = (currentPage >> 8) & 0xFF;
-    data[2] = (currentPage >> 16) & 0xFF;
-    data[3] = (currentPage >> 24) & 0xFF;
-    f.write(data, 4);
-    f.close();
-  }
+void XtcReaderActivity::saveProgress() {
+  uint8_t data[ReadingProgressStore::DATA_SIZE];
+  data[0] = currentPage & 0xFF;
+  data[1] = (currentPage >> 8) & 0xFF;
+  data[2] = (currentPage >> 16) & 0xFF;
+  data[3] = (currentPage >> 24) & 0xFF;
+  progressStore->update(data, battery.readPercentage());
 }
 
 void XtcReaderActivity::loadProgress() {
-  FsFile f;
-  if (SdMan.openFileForRead("XTR", xtc->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[4];
-    if (f.read(data, 4) == 4) {
-      currentPage = data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
-      Serial.printf("[%lu] [XTR] Loaded progress: page %lu\n", millis(), currentPage);
-
-      // Validate page number
-      if (currentPage >= xtc->getPageCount()) {
-        currentPage = 0;
-      }
+  progressStore.reset(new ReadingProgressStore(xtc->getCachePath()));
+  uint8_t data[ReadingProgressStore::DATA_SIZE];
+  if (progressStore->load(data)) {
+    currentPage = data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
+    Serial.printf("[%lu] [XTR] Loaded progress: page %lu\n", millis(), currentPage);
+
+    // Validate page number
+    if (currentPage >= xtc->getPageCount()) {
+      currentPage = 0;
     }
-    f.close();
   }
 }
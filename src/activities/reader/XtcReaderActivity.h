@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <ReadingProgressStore.h>
 #include <Xtc.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
@@ -16,6 +17,7 @@
 
 class XtcReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Xtc> xtc;
+  std::unique_ptr<ReadingProgressStore> progressStore = nullptr;
   TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
   uint32_t currentPage = 0;
@@ -28,7 +30,7 @@ class XtcReaderActivity final : public ActivityWithSubactivity {
   [[noreturn]] void displayTaskLoop();
   void renderScreen();
   void renderPage();
-  void saveProgress() const;
+  void saveProgress();
   void loadProgress();
 
  public:
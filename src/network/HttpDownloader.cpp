@@ -6,7 +6,7 @@
 
 #include <memory>
 
-bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent) {
+bool HttpDownloader::fetchUrl(const std::string& url, Print& out) {
   const std::unique_ptr<WiFiClientSecure> client(new WiFiClientSecure());
   client->setInsecure();
   HTTPClient http;
@@ -16,6 +16,8 @@ bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent) {
   http.begin(*client, url.c_str());
   http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
   http.addHeader("User-Agent", "CrossPoint-ESP32-" CROSSPOINT_VERSION);
+  // HTTP/1.0 rules out chunked transfer encoding, so the raw stream is exactly the body
+  http.useHTTP10(true);
 
   const int httpCode = http.GET();
   if (httpCode != HTTP_CODE_OK) {
@@ -24,10 +26,48 @@ bool HttpDownloader::fetchUrl(const std::string& url, std::string& outContent) {
     return false;
   }
 
-  outContent = http.getString().c_str();
+  WiFiClient* stream = http.getStreamPtr();
+  if (!stream) {
+    Serial.printf("[%lu] [HTTP] Failed to get stream\n", millis());
+    http.end();
+    return false;
+  }
+
+  // -1 if the server didn't send a Content-Length, in which case read until the connection closes
+  const int contentLength = http.getSize();
+  uint8_t buffer[DOWNLOAD_CHUNK_SIZE];
+  size_t fetched = 0;
+
+  while ((http.connected() || stream->available()) &&
+         (contentLength < 0 || fetched < static_cast<size_t>(contentLength))) {
+    const size_t available = stream->available();
+    if (available == 0) {
+      delay(1);
+      continue;
+    }
+
+    const size_t toRead = available < DOWNLOAD_CHUNK_SIZE ? available : DOWNLOAD_CHUNK_SIZE;
+    const size_t bytesRead = stream->readBytes(buffer, toRead);
+    if (bytesRead == 0) {
+      break;
+    }
+
+    if (out.write(buffer, bytesRead) != bytesRead) {
+      Serial.printf("[%lu] [HTTP] Output rejected data after %zu bytes\n", millis(), fetched);
+      http.end();
+      return false;
+    }
+    fetched += bytesRead;
+  }
+
   http.end();
 
-  Serial.printf("[%lu] [HTTP] Fetched %zu bytes\n", millis(), outContent.size());
+  if (contentLength >= 0 && fetched != static_cast<size_t>(contentLength)) {
+    Serial.printf("[%lu] [HTTP] Size mismatch: got %zu, expected %d\n", millis(), fetched, contentLength);
+    return false;
+  }
+
+  Serial.printf("[%lu] [HTTP] Fetched %zu bytes\n", millis(), fetched);
   return true;
 }
 
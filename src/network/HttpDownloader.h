@@ -1,4 +1,5 @@
 #pragma once
+#include <Print.h>
 #include <SDCardManager.h>
 
 #include <functional>
@@ -20,12 +21,12 @@ class HttpDownloader {
   };
 
   /**
-   * Fetch text content from a URL.
+   * Fetch content from a URL, writing it to out as it arrives rather than holding it all in memory.
    * @param url The URL to fetch
-   * @param outContent The fetched content (output)
-   * @return true if fetch succeeded, false on error
+   * @param out Receives the body in chunks, fetching stops if it doesn't accept a whole chunk
+   * @return true if the whole body was fetched and written, false on error
    */
-  static bool fetchUrl(const std::string& url, std::string& outContent);
+  static bool fetchUrl(const std::string& url, Print& out);
 
   /**
    * Download a file to the SD card.
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+
+// In-memory panel: the framebuffer is kept on the host and can be written out as a PBM image, refreshes are counted
+// and the last grayscale planes sent are kept
+class EInkDisplay {
+ public:
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
+
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  EInkDisplay();
+  ~EInkDisplay();
+  EInkDisplay(const EInkDisplay& other) = delete;
+  EInkDisplay& operator=(const EInkDisplay& other) = delete;
+
+  void begin() {}
+  void clearScreen(uint8_t color = 0xFF) const;
+  void drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                 bool fromProgmem = false) const;
+  uint8_t* getFrameBuffer() const { return frameBuffer; }
+  void displayBuffer(RefreshMode mode = FAST_REFRESH);
+  void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) const;
+  void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) const;
+  void cleanupGrayscaleBuffers(const uint8_t* bwBuffer) {}
+  void displayGrayBuffer();
+  void grayscaleRevert() {}
+  void deepSleep() {}
+
+  // Host only: counts of refreshes, and the framebuffer written out in panel orientation as a P4 PBM
+  int getRefreshCount() const { return refreshCount; }
+  int getGrayRefreshCount() const { return grayRefreshCount; }
+  const uint8_t* getGrayscaleLsbBuffer() const { return grayLsbBuffer; }
+  const uint8_t* getGrayscaleMsbBuffer() const { return grayMsbBuffer; }
+  bool dumpPbm(const char* hostPath) const;
+
+ private:
+  uint8_t* frameBuffer;
+  uint8_t* grayLsbBuffer;
+  uint8_t* grayMsbBuffer;
+  int refreshCount = 0;
+  int grayRefreshCount = 0;
+};
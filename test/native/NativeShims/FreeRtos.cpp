@@ -0,0 +1,91 @@
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <pthread.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct HostTask {};
+
+struct HostQueue {
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::deque<std::vector<uint8_t>> items;
+  size_t length;
+  size_t itemSize;
+};
+
+namespace {
+template <typename Ready>
+bool waitFor(HostQueue* queue, std::unique_lock<std::mutex>& lock, const TickType_t ticksToWait, Ready ready) {
+  if (ticksToWait == portMAX_DELAY) {
+    queue->changed.wait(lock, ready);
+    return true;
+  }
+  return queue->changed.wait_for(lock, std::chrono::milliseconds(ticksToWait), ready);
+}
+}  // namespace
+
+BaseType_t xTaskCreate(const TaskFunction_t function, const char*, uint32_t, void* parameter, UBaseType_t,
+                       TaskHandle_t* handle) {
+  static HostTask task;
+  std::thread(function, parameter).detach();
+  if (handle) {
+    *handle = &task;
+  }
+  return pdPASS;
+}
+
+void vTaskDelete(const TaskHandle_t task) {
+  if (!task) {
+    pthread_exit(nullptr);
+  }
+}
+
+void vTaskDelay(const TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+QueueHandle_t xQueueCreate(const UBaseType_t length, const UBaseType_t itemSize) {
+  auto* queue = new HostQueue;
+  queue->length = length;
+  queue->itemSize = itemSize;
+  return queue;
+}
+
+void vQueueDelete(const QueueHandle_t queue) { delete queue; }
+
+BaseType_t xQueueSend(const QueueHandle_t queue, const void* item, const TickType_t ticksToWait) {
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!waitFor(queue, lock, ticksToWait, [queue] { return queue->items.size() < queue->length; })) {
+    return pdFALSE;
+  }
+  const auto* bytes = static_cast<const uint8_t*>(item);
+  queue->items.emplace_back(bytes, bytes + (bytes ? queue->itemSize : 0));
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(const QueueHandle_t queue, void* item, const TickType_t ticksToWait) {
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!waitFor(queue, lock, ticksToWait, [queue] { return !queue->items.empty(); })) {
+    return pdFALSE;
+  }
+  if (item) {
+    memcpy(item, queue->items.front().data(), queue->items.front().size());
+  }
+  queue->items.pop_front();
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() { return xQueueCreate(1, 0); }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  const SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+  xSemaphoreGive(mutex);
+  return mutex;
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+
+#include "Print.h"
+
+// The core's timing functions, which the libraries reach through this header as they do on the device
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+// Host only: moves millis() and micros() on without waiting, for code that acts on how much time has passed
+void advanceClock(unsigned long ms);
+
+// Log output goes to stdout when CROSSPOINT_LOG is set in the environment, and is dropped otherwise
+class HardwareSerial {
+ public:
+  void begin(unsigned long baud) {}
+  int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+  size_t println(const char* str);
+};
+
+extern HardwareSerial Serial;
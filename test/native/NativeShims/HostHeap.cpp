@@ -0,0 +1,117 @@
+#include "HostHeap.h"
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+
+#include <atomic>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace {
+std::atomic<size_t> allocationCount{0};
+std::atomic<long long> currentBytes{0};
+std::atomic<long long> baseBytes{0};
+std::atomic<long long> peak{0};
+std::atomic<size_t> failSize{0};
+std::atomic<int> failCount{0};
+
+bool shouldFail(const size_t size) {
+  if (failCount.load() <= 0 || size != failSize.load()) {
+    return false;
+  }
+  return failCount.fetch_sub(1) > 0;
+}
+
+void track(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+  allocationCount++;
+  const long long now = currentBytes += malloc_usable_size(ptr);
+  long long seen = peak.load();
+  while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+  }
+}
+
+void untrack(void* ptr) {
+  if (ptr) {
+    currentBytes -= malloc_usable_size(ptr);
+  }
+}
+}  // namespace
+
+extern "C" {
+void* malloc(const size_t size) {
+  if (shouldFail(size)) {
+    return nullptr;
+  }
+  void* ptr = __libc_malloc(size);
+  track(ptr);
+  return ptr;
+}
+
+void* calloc(const size_t count, const size_t size) {
+  if (shouldFail(count * size)) {
+    return nullptr;
+  }
+  void* ptr = __libc_calloc(count, size);
+  track(ptr);
+  return ptr;
+}
+
+void* realloc(void* ptr, const size_t size) {
+  if (shouldFail(size)) {
+    return nullptr;
+  }
+  const size_t oldSize = ptr ? malloc_usable_size(ptr) : 0;
+  void* moved = __libc_realloc(ptr, size);
+  if (moved) {
+    currentBytes -= oldSize;
+    track(moved);
+  }
+  return moved;
+}
+
+void free(void* ptr) {
+  untrack(ptr);
+  __libc_free(ptr);
+}
+}
+
+bool HostHeap::available() { return true; }
+
+void HostHeap::reset() {
+  allocationCount = 0;
+  baseBytes = currentBytes.load();
+  peak = currentBytes.load();
+}
+
+size_t HostHeap::allocations() { return allocationCount; }
+
+size_t HostHeap::peakBytes() { return static_cast<size_t>(peak - baseBytes); }
+
+size_t HostHeap::heldBytes() {
+  const long long held = currentBytes - baseBytes;
+  return held > 0 ? static_cast<size_t>(held) : 0;
+}
+
+void HostHeap::failAllocations(const size_t size, const int count) {
+  failSize = size;
+  failCount = count;
+}
+
+#else
+
+bool HostHeap::available() { return false; }
+void HostHeap::reset() {}
+size_t HostHeap::allocations() { return 0; }
+size_t HostHeap::peakBytes() { return 0; }
+size_t HostHeap::heldBytes() { return 0; }
+void HostHeap::failAllocations(size_t, int) {}
+
+#endif
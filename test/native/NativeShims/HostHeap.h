@@ -0,0 +1,16 @@
+#pragma once
+#include <cstddef>
+
+// Host only: counts the heap use of the code under test, and fails chosen allocations to reach out of memory paths.
+// Works by taking over malloc, which is only done against glibc. Elsewhere available() is false and nothing is counted.
+namespace HostHeap {
+bool available();
+// Starts counting afresh, with the peak measured from what is allocated now
+void reset();
+size_t allocations();
+size_t peakBytes();
+// Bytes allocated since the last reset() and not freed yet
+size_t heldBytes();
+// The next count allocations of exactly size bytes return null
+void failAllocations(size_t size, int count = 1);
+}  // namespace HostHeap
@@ -0,0 +1,332 @@
+#include <Arduino.h>
+#include <EInkDisplay.h>
+#include <SDCardManager.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <thread>
+
+HardwareSerial Serial;
+SDCardManager SdMan;
+
+namespace {
+const auto startTime = std::chrono::steady_clock::now();
+std::atomic<unsigned long> clockAdvanceMs{0};
+
+bool removeHostTree(const std::string& path) {
+  struct stat st = {};
+  if (lstat(path.c_str(), &st) != 0) {
+    return false;
+  }
+  if (!S_ISDIR(st.st_mode)) {
+    return unlink(path.c_str()) == 0;
+  }
+  DIR* dir = opendir(path.c_str());
+  if (!dir) {
+    return false;
+  }
+  bool success = true;
+  while (const dirent* entry = readdir(dir)) {
+    const std::string name = entry->d_name;
+    if (name != "." && name != "..") {
+      success = removeHostTree(path + "/" + name) && success;
+    }
+  }
+  closedir(dir);
+  return ::rmdir(path.c_str()) == 0 && success;
+}
+}  // namespace
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count() +
+         clockAdvanceMs;
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count() +
+         clockAdvanceMs * 1000;
+}
+
+void delay(const unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+void advanceClock(const unsigned long ms) { clockAdvanceMs += ms; }
+
+int HardwareSerial::printf(const char* format, ...) {
+  static const bool enabled = getenv("CROSSPOINT_LOG") != nullptr;
+  if (!enabled) {
+    return 0;
+  }
+  va_list args;
+  va_start(args, format);
+  const int written = vprintf(format, args);
+  va_end(args);
+  return written;
+}
+
+size_t HardwareSerial::println(const char* str) { return printf("%s\n", str); }
+
+bool FsFile::openOnHost(const std::string& path, const bool forWrite) {
+  close();
+  FILE* file = fopen(path.c_str(), forWrite ? "w+b" : "rb");
+  if (!file) {
+    return false;
+  }
+  handle.reset(file, fclose);
+  hostPath = path;
+  writable = forWrite;
+  SdMan.opCounts().opens++;
+  return true;
+}
+
+int FsFile::read(void* buffer, const size_t count) {
+  if (!handle) {
+    return -1;
+  }
+  const size_t bytesRead = fread(buffer, 1, count, handle.get());
+  SdMan.opCounts().reads++;
+  SdMan.opCounts().bytesRead += bytesRead;
+  return static_cast<int>(bytesRead);
+}
+
+int FsFile::read() {
+  uint8_t byte;
+  return read(&byte, 1) == 1 ? byte : -1;
+}
+
+int FsFile::peek() {
+  const int byte = read();
+  if (byte >= 0) {
+    fseek(handle.get(), -1, SEEK_CUR);
+  }
+  return byte;
+}
+
+int FsFile::available() {
+  if (!handle) {
+    return 0;
+  }
+  const uint64_t remaining = size() - position();
+  return remaining > INT32_MAX ? INT32_MAX : static_cast<int>(remaining);
+}
+
+size_t FsFile::write(const uint8_t byte) { return write(&byte, 1); }
+
+size_t FsFile::write(const uint8_t* buffer, const size_t size) {
+  if (!handle || !writable) {
+    return 0;
+  }
+  if (!SdMan.takeWrite()) {
+    return 0;
+  }
+  SdMan.waitForWrite(size);
+  SdMan.opCounts().writes++;
+  const long allowed = SdMan.takeWriteBudget(static_cast<long>(size));
+  return fwrite(buffer, 1, allowed, handle.get());
+}
+
+void FsFile::flush() {
+  if (handle) {
+    fflush(handle.get());
+  }
+}
+
+bool FsFile::sync() {
+  return handle && writable && SdMan.takeWrite() && fflush(handle.get()) == 0;
+}
+
+bool FsFile::rename(const char* newPath) {
+  const std::string newHostPath = SdMan.hostPath(newPath);
+  struct stat st = {};
+  if (!handle || stat(newHostPath.c_str(), &st) == 0 || !SdMan.takeWrite() ||
+      ::rename(hostPath.c_str(), newHostPath.c_str()) != 0) {
+    return false;
+  }
+  hostPath = newHostPath;
+  return true;
+}
+
+bool FsFile::seek(const uint64_t position) {
+  SdMan.opCounts().seeks++;
+  return handle && fseek(handle.get(), position, SEEK_SET) == 0;
+}
+
+bool FsFile::seekCur(const int64_t offset) {
+  SdMan.opCounts().seeks++;
+  return handle && fseek(handle.get(), offset, SEEK_CUR) == 0;
+}
+
+uint64_t FsFile::position() const { return handle ? ftell(handle.get()) : 0; }
+
+uint64_t FsFile::size() const {
+  if (!handle) {
+    return 0;
+  }
+  struct stat st = {};
+  fflush(handle.get());
+  return fstat(fileno(handle.get()), &st) == 0 ? st.st_size : 0;
+}
+
+bool FsFile::close() {
+  if (!handle) {
+    return false;
+  }
+  const bool success = fflush(handle.get()) == 0;
+  handle.reset();
+  writable = false;
+  return success;
+}
+
+const std::string& SDCardManager::hostRoot() {
+  if (root.empty()) {
+    const char* configured = getenv("CROSSPOINT_SD_ROOT");
+    if (configured) {
+      root = configured;
+    } else {
+      char pattern[] = "/tmp/crosspoint-sd-XXXXXX";
+      root = mkdtemp(pattern);
+    }
+  }
+  return root;
+}
+
+std::string SDCardManager::hostPath(const char* path) {
+  std::string hostPath = hostRoot();
+  if (path[0] != '/') {
+    hostPath += '/';
+  }
+  return hostPath + path;
+}
+
+long SDCardManager::takeWriteBudget(const long bytes) {
+  if (writeBudget < 0) {
+    return bytes;
+  }
+  const long allowed = bytes < writeBudget ? bytes : writeBudget;
+  writeBudget -= allowed;
+  return allowed;
+}
+
+void SDCardManager::waitForWrite(const size_t bytes) const {
+  const unsigned long micros = writeMicros + writeMicrosPerKilobyte * bytes / 1024;
+  if (micros > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(micros));
+  }
+}
+
+bool SDCardManager::exists(const char* path) {
+  struct stat st = {};
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool SDCardManager::mkdir(const char* path, const bool pFlag) {
+  const std::string full = hostPath(path);
+  if (pFlag) {
+    for (size_t slash = full.find('/', hostRoot().size() + 1); slash != std::string::npos;
+         slash = full.find('/', slash + 1)) {
+      ::mkdir(full.substr(0, slash).c_str(), 0755);
+    }
+  }
+  return ::mkdir(full.c_str(), 0755) == 0;
+}
+
+bool SDCardManager::takeWrite() {
+  if (writesBeforePowerCut == 0) {
+    return false;
+  }
+  if (writesBeforePowerCut > 0) {
+    writesBeforePowerCut--;
+  }
+  return true;
+}
+
+bool SDCardManager::remove(const char* path) { return takeWrite() && unlink(hostPath(path).c_str()) == 0; }
+
+bool SDCardManager::rmdir(const char* path) { return ::rmdir(hostPath(path).c_str()) == 0; }
+
+bool SDCardManager::removeDir(const char* path) { return removeHostTree(hostPath(path)); }
+
+bool SDCardManager::rename(const char* oldPath, const char* newPath) {
+  return takeWrite() && ::rename(hostPath(oldPath).c_str(), hostPath(newPath).c_str()) == 0;
+}
+
+bool SDCardManager::openFileForRead(const char* moduleName, const char* path, FsFile& file) {
+  if (!file.openOnHost(hostPath(path), false)) {
+    Serial.printf("[%lu] [%s] Failed to open file for reading: %s\n", millis(), moduleName, path);
+    return false;
+  }
+  return true;
+}
+
+bool SDCardManager::openFileForRead(const char* moduleName, const std::string& path, FsFile& file) {
+  return openFileForRead(moduleName, path.c_str(), file);
+}
+
+bool SDCardManager::openFileForWrite(const char* moduleName, const char* path, FsFile& file) {
+  if (!takeWrite() || !file.openOnHost(hostPath(path), true)) {
+    Serial.printf("[%lu] [%s] Failed to open file for writing: %s\n", millis(), moduleName, path);
+    return false;
+  }
+  return true;
+}
+
+bool SDCardManager::openFileForWrite(const char* moduleName, const std::string& path, FsFile& file) {
+  return openFileForWrite(moduleName, path.c_str(), file);
+}
+
+EInkDisplay::EInkDisplay()
+    : frameBuffer(new uint8_t[BUFFER_SIZE]),
+      grayLsbBuffer(new uint8_t[BUFFER_SIZE]()),
+      grayMsbBuffer(new uint8_t[BUFFER_SIZE]()) {
+  clearScreen();
+}
+
+EInkDisplay::~EInkDisplay() {
+  delete[] frameBuffer;
+  delete[] grayLsbBuffer;
+  delete[] grayMsbBuffer;
+}
+
+void EInkDisplay::clearScreen(const uint8_t color) const { memset(frameBuffer, color, BUFFER_SIZE); }
+
+void EInkDisplay::drawImage(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
+                            const uint16_t h, bool) const {
+  const int rowBytes = (w + 7) / 8;
+  for (int row = 0; row < h && y + row < DISPLAY_HEIGHT; row++) {
+    for (int col = 0; col < w && x + col < DISPLAY_WIDTH; col++) {
+      const bool white = imageData[row * rowBytes + col / 8] & (0x80 >> (col % 8));
+      uint8_t& panelByte = frameBuffer[(y + row) * DISPLAY_WIDTH_BYTES + (x + col) / 8];
+      const uint8_t bit = 0x80 >> ((x + col) % 8);
+      panelByte = white ? panelByte | bit : panelByte & ~bit;
+    }
+  }
+}
+
+void EInkDisplay::displayBuffer(RefreshMode) { refreshCount++; }
+
+void EInkDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) const {
+  memcpy(grayLsbBuffer, lsbBuffer, BUFFER_SIZE);
+}
+
+void EInkDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) const {
+  memcpy(grayMsbBuffer, msbBuffer, BUFFER_SIZE);
+}
+
+void EInkDisplay::displayGrayBuffer() { grayRefreshCount++; }
+
+bool EInkDisplay::dumpPbm(const char* hostPath) const {
+  FILE* file = fopen(hostPath, "wb");
+  if (!file) {
+    return false;
+  }
+  fprintf(file, "P4\n%d %d\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  // The panel stores white as set bits, PBM stores black as set bits
+  bool success = true;
+  for (uint32_t i = 0; i < BUFFER_SIZE && success; i++) {
+    success = fputc(static_cast<uint8_t>(~frameBuffer[i]), file) != EOF;
+  }
+  return fclose(file) == 0 && success;
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Subset of the Arduino core's Print used by the libraries
+class Print {
+  int writeError = 0;
+
+ protected:
+  void setWriteError(const int err = 1) { writeError = err; }
+
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t byte) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (size-- > 0 && write(*buffer++) == 1) {
+      written++;
+    }
+    return written;
+  }
+  size_t write(const char* str) { return str ? write(reinterpret_cast<const uint8_t*>(str), strlen(str)) : 0; }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+  int getWriteError() const { return writeError; }
+  void clearWriteError() { setWriteError(0); }
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <string>
+
+#include "SdFat.h"
+
+// SD card paths map onto a host directory, a fresh temporary one unless CROSSPOINT_SD_ROOT is set
+class SDCardManager {
+ public:
+  bool begin() { return true; }
+  bool exists(const char* path);
+  bool mkdir(const char* path, bool pFlag = true);
+  bool remove(const char* path);
+  bool rmdir(const char* path);
+  bool removeDir(const char* path);
+  bool rename(const char* oldPath, const char* newPath);
+  bool openFileForRead(const char* moduleName, const char* path, FsFile& file);
+  bool openFileForRead(const char* moduleName, const std::string& path, FsFile& file);
+  bool openFileForWrite(const char* moduleName, const char* path, FsFile& file);
+  bool openFileForWrite(const char* moduleName, const std::string& path, FsFile& file);
+
+  // Host only: the directory standing in for the card root, and the host path of a card path
+  const std::string& hostRoot();
+  std::string hostPath(const char* path);
+  // Host only: writes past this many more bytes come up short, as on a full card. Negative means unlimited.
+  void setWriteBudget(long bytes) { writeBudget = bytes; }
+  long takeWriteBudget(long bytes);
+  // Host only: each write takes this long, standing in for the card's per command overhead and transfer rate
+  void setWriteLatency(const unsigned long microsPerWrite, const unsigned long microsPerKilobyte) {
+    writeMicros = microsPerWrite;
+    writeMicrosPerKilobyte = microsPerKilobyte;
+  }
+  void waitForWrite(size_t bytes) const;
+  // Host only: after this many more card writes (opening for write, writing, syncing, removing or renaming) every
+  // one fails, as if the device had reset at that point. Negative restores power.
+  void cutPowerAfter(const long writes) { writesBeforePowerCut = writes; }
+  bool powerIsCut() const { return writesBeforePowerCut == 0; }
+  bool takeWrite();
+
+  // Host only: card operations since the last resetOpCounts(), as the SD card would see them
+  struct OpCounts {
+    size_t opens = 0;
+    size_t seeks = 0;
+    size_t reads = 0;
+    size_t bytesRead = 0;
+    size_t writes = 0;
+  };
+  OpCounts& opCounts() { return ops; }
+  void resetOpCounts() { ops = {}; }
+
+ private:
+  std::string root;
+  long writeBudget = -1;
+  unsigned long writeMicros = 0;
+  unsigned long writeMicrosPerKilobyte = 0;
+  long writesBeforePowerCut = -1;
+  OpCounts ops;
+};
+
+extern SDCardManager SdMan;
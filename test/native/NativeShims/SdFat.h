@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "Arduino.h"
+
+// FsFile backed by a host file. Copies share the underlying handle like SdFat's, which closes once the last copy does.
+class FsFile : public Stream {
+  std::shared_ptr<FILE> handle;
+  std::string hostPath;
+  bool writable = false;
+
+ public:
+  bool openOnHost(const std::string& path, bool forWrite);
+  bool isOpen() const { return handle != nullptr; }
+  explicit operator bool() const { return isOpen(); }
+
+  int read(void* buffer, size_t count);
+  int read() override;
+  int peek() override;
+  int available() override;
+  size_t write(uint8_t byte) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  size_t write(const void* buffer, const size_t size) { return write(static_cast<const uint8_t*>(buffer), size); }
+  void flush() override;
+  bool sync();
+  // Renames the open file to a card path, failing like SdFat if something is already there
+  bool rename(const char* newPath);
+  bool seek(uint64_t position);
+  bool seekSet(const uint64_t position) { return seek(position); }
+  bool seekCur(int64_t offset);
+  uint64_t position() const;
+  uint64_t curPosition() const { return position(); }
+  uint64_t size() const;
+  uint64_t fileSize() const { return size(); }
+  bool close();
+};
@@ -0,0 +1,96 @@
+#pragma once
+#include <miniz.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Print.h"
+#include "SDCardManager.h"
+
+// Host only: archives and card files for the suites that need a ZIP or an EPUB on the card. Writers return false if
+// miniz fails, for the caller to assert on.
+namespace TestArchives {
+// Collects everything printed to it, for the suites that read back what a converter or the zip reader wrote
+class MemoryPrint final : public Print {
+ public:
+  std::string data;
+
+  size_t write(const uint8_t byte) override { return write(&byte, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    data.append(reinterpret_cast<const char*>(buffer), size);
+    return size;
+  }
+  uint8_t byteAt(const size_t offset) const { return static_cast<uint8_t>(data[offset]); }
+};
+
+struct ZipEntry {
+  std::string name;
+  std::string data;
+  bool deflate = true;
+};
+
+inline bool writeZip(const std::string& path, const std::vector<ZipEntry>& entries) {
+  mz_zip_archive archive = {};
+  if (!mz_zip_writer_init_file(&archive, SdMan.hostPath(path.c_str()).c_str(), 0)) {
+    return false;
+  }
+  bool written = true;
+  for (const auto& entry : entries) {
+    written = written && mz_zip_writer_add_mem(&archive, entry.name.c_str(), entry.data.data(), entry.data.size(),
+                                               entry.deflate ? MZ_DEFAULT_COMPRESSION : MZ_NO_COMPRESSION);
+  }
+  written = written && mz_zip_writer_finalize_archive(&archive);
+  return mz_zip_writer_end(&archive) && written;
+}
+
+// An item under OEBPS, with its href relative to content.opf
+struct EpubItem {
+  std::string href;
+  std::string data;
+  std::string mediaType = "application/xhtml+xml";
+};
+
+// An EPUB 2 book whose spine is the chapters in order, with the resources in the manifest only
+inline bool writeEpub(const std::string& path, const std::vector<EpubItem>& chapters,
+                      const std::vector<EpubItem>& resources = {}) {
+  const std::string container =
+      "<?xml version=\"1.0\"?><container version=\"1.0\" xmlns=\"urn:oasis:names:tc:opendocument:xmlns:container\">"
+      "<rootfiles><rootfile full-path=\"OEBPS/content.opf\" media-type=\"application/oebps-package+xml\"/>"
+      "</rootfiles></container>";
+  std::string manifest;
+  std::string spine;
+  for (size_t i = 0; i < chapters.size(); i++) {
+    const std::string id = "chapter" + std::to_string(i);
+    manifest += "<item id=\"" + id + "\" href=\"" + chapters[i].href + "\" media-type=\"" + chapters[i].mediaType +
+                "\"/>";
+    spine += "<itemref idref=\"" + id + "\"/>";
+  }
+  for (size_t i = 0; i < resources.size(); i++) {
+    manifest += "<item id=\"resource" + std::to_string(i) + "\" href=\"" + resources[i].href + "\" media-type=\"" +
+                resources[i].mediaType + "\"/>";
+  }
+  const std::string opf =
+      "<?xml version=\"1.0\"?><package xmlns=\"http://www.idpf.org/2007/opf\" version=\"2.0\">"
+      "<metadata xmlns:dc=\"http://purl.org/dc/elements/1.1/\"><dc:title>Section</dc:title></metadata><manifest>" +
+      manifest + "</manifest><spine>" + spine + "</spine></package>";
+
+  std::vector<ZipEntry> entries = {{"mimetype", "application/epub+zip", false},
+                                   {"META-INF/container.xml", container},
+                                   {"OEBPS/content.opf", opf}};
+  for (const auto& chapter : chapters) {
+    entries.push_back({"OEBPS/" + chapter.href, chapter.data});
+  }
+  for (const auto& resource : resources) {
+    // Images are stored as they are in most EPUBs, deflating them gains nothing
+    entries.push_back({"OEBPS/" + resource.href, resource.data, resource.mediaType.rfind("image/", 0) != 0});
+  }
+  return writeZip(path, entries);
+}
+
+inline std::string readCardFile(const std::string& path) {
+  std::ifstream in(SdMan.hostPath(path.c_str()), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+}  // namespace TestArchives
@@ -0,0 +1,537 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Host only: a small JPEG encoder for the suites that convert images, covering the layouts the decoders meet in books.
+// Baseline or progressive, gray or YCbCr with the luma sampling chosen and chroma at 1x1, with optional restart
+// intervals. A progressive file starts with its DC scans, interleaved or one per component and optionally with
+// successive approximation, and follows them with an AC scan per component. Huffman tables are built from the
+// symbols each scan uses.
+namespace TestJpeg {
+struct Options {
+  bool progressive = false;
+  // Luma blocks per MCU across and down, ignored for gray images
+  int lumaH = 1;
+  int lumaV = 1;
+  // MCUs between restart markers, 0 for none
+  int restartInterval = 0;
+  // Progressive only: one DC scan for all components, or a DC scan for each
+  bool interleavedDc = true;
+  // Progressive only: low bits the first DC scan leaves to a refinement scan
+  int dcSuccessiveLow = 0;
+  int quality = 75;
+};
+
+namespace detail {
+// Annex K tables in natural order
+constexpr uint8_t LUMA_QUANT[64] = {16, 11, 10, 16, 24,  40,  51,  61,  12, 12, 14, 19, 26,  58,  60,  55,
+                                    14, 13, 16, 24, 40,  57,  69,  56,  14, 17, 22, 29, 51,  87,  80,  62,
+                                    18, 22, 37, 56, 68,  109, 103, 77,  24, 35, 55, 64, 81,  104, 113, 92,
+                                    49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99};
+constexpr uint8_t CHROMA_QUANT[64] = {17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99,
+                                      24, 26, 56, 99, 99, 99, 99, 99, 47, 66, 99, 99, 99, 99, 99, 99,
+                                      99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+                                      99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99};
+
+// Natural index of each zigzag position
+inline std::array<int, 64> zigzag() {
+  std::array<int, 64> order = {};
+  int k = 0;
+  for (int diagonal = 0; diagonal < 15; diagonal++) {
+    for (int i = 0; i <= diagonal; i++) {
+      const int row = diagonal % 2 == 0 ? diagonal - i : i;
+      const int col = diagonal - row;
+      if (row < 8 && col < 8) {
+        order[k++] = row * 8 + col;
+      }
+    }
+  }
+  return order;
+}
+
+struct HuffmanTable {
+  uint8_t counts[16] = {};
+  std::vector<uint8_t> values;
+  uint16_t codes[256] = {};
+  uint8_t sizes[256] = {};
+};
+
+// Code lengths from the symbol counts, limited to 16 bits, as in Annex K.2
+inline HuffmanTable buildTable(const std::array<long, 256>& counts) {
+  long freq[257];
+  int codeSize[257] = {};
+  int others[257];
+  for (int i = 0; i < 256; i++) {
+    freq[i] = counts[i];
+  }
+  // A reserved symbol, so no real code is all ones
+  freq[256] = 1;
+  for (int& other : others) {
+    other = -1;
+  }
+
+  while (true) {
+    int c1 = -1;
+    long least = LONG_MAX;
+    for (int i = 0; i <= 256; i++) {
+      if (freq[i] && freq[i] <= least) {
+        least = freq[i];
+        c1 = i;
+      }
+    }
+    int c2 = -1;
+    least = LONG_MAX;
+    for (int i = 0; i <= 256; i++) {
+      if (freq[i] && freq[i] <= least && i != c1) {
+        least = freq[i];
+        c2 = i;
+      }
+    }
+    if (c2 < 0) {
+      break;
+    }
+    freq[c1] += freq[c2];
+    freq[c2] = 0;
+    codeSize[c1]++;
+    while (others[c1] >= 0) {
+      c1 = others[c1];
+      codeSize[c1]++;
+    }
+    others[c1] = c2;
+    codeSize[c2]++;
+    while (others[c2] >= 0) {
+      c2 = others[c2];
+      codeSize[c2]++;
+    }
+  }
+
+  int bits[33] = {};
+  for (const int size : codeSize) {
+    if (size) {
+      bits[size]++;
+    }
+  }
+  for (int i = 32; i > 16; i--) {
+    while (bits[i] > 0) {
+      int j = i - 2;
+      while (bits[j] == 0) {
+        j--;
+      }
+      bits[i] -= 2;
+      bits[i - 1]++;
+      bits[j + 1] += 2;
+      bits[j]--;
+    }
+  }
+  int longest = 16;
+  while (bits[longest] == 0) {
+    longest--;
+  }
+  bits[longest]--;
+
+  HuffmanTable table;
+  for (int i = 0; i < 16; i++) {
+    table.counts[i] = bits[i + 1];
+  }
+  for (int size = 1; size <= 32; size++) {
+    for (int symbol = 0; symbol < 256; symbol++) {
+      if (codeSize[symbol] == size) {
+        table.values.push_back(symbol);
+      }
+    }
+  }
+  uint16_t code = 0;
+  size_t k = 0;
+  for (int size = 1; size <= 16; size++) {
+    for (int n = 0; n < table.counts[size - 1]; n++) {
+      table.codes[table.values[k]] = code++;
+      table.sizes[table.values[k]] = size;
+      k++;
+    }
+    code <<= 1;
+  }
+  return table;
+}
+
+// Magnitude category of a coefficient and its low bits as stored after the Huffman symbol
+inline int category(const int value) {
+  int magnitude = value < 0 ? -value : value;
+  int bits = 0;
+  while (magnitude) {
+    bits++;
+    magnitude >>= 1;
+  }
+  return bits;
+}
+
+inline uint32_t valueBits(const int value, const int bits) {
+  return static_cast<uint32_t>(value < 0 ? value - 1 : value) & ((1u << bits) - 1);
+}
+
+inline void put16(std::string& out, const int value) {
+  out += static_cast<char>(value >> 8);
+  out += static_cast<char>(value & 0xFF);
+}
+
+// Entropy coder for one scan. The first pass only counts symbols for the tables the second pass codes with.
+class ScanCoder {
+ public:
+  bool counting = true;
+  // [0] DC, [1] AC, by table id
+  std::array<long, 256> counts[2][2] = {};
+  HuffmanTable tables[2][2];
+  std::string* out = nullptr;
+
+  void symbol(const int tableClass, const int id, const int value) {
+    if (counting) {
+      counts[tableClass][id][value]++;
+    } else {
+      bits(tables[tableClass][id].codes[value], tables[tableClass][id].sizes[value]);
+    }
+  }
+
+  void bits(const uint32_t value, const int count) {
+    if (counting || count == 0) {
+      return;
+    }
+    accumulator = accumulator << count | (value & ((1u << count) - 1));
+    accumulated += count;
+    while (accumulated >= 8) {
+      accumulated -= 8;
+      emit(static_cast<uint8_t>(accumulator >> accumulated));
+    }
+  }
+
+  // Pads the last byte with ones
+  void flush() {
+    if (!counting && accumulated > 0) {
+      bits(0x7F, 8 - accumulated);
+    }
+    accumulator = 0;
+    accumulated = 0;
+  }
+
+  void marker(const int code) {
+    flush();
+    if (!counting) {
+      *out += static_cast<char>(0xFF);
+      *out += static_cast<char>(code);
+    }
+  }
+
+ private:
+  uint32_t accumulator = 0;
+  int accumulated = 0;
+
+  void emit(const uint8_t byte) {
+    *out += static_cast<char>(byte);
+    if (byte == 0xFF) {
+      *out += '\0';
+    }
+  }
+};
+
+struct Component {
+  int h;
+  int v;
+  int quantTable;
+  // Blocks across and down in the MCU-padded grid, and in the component's own extent
+  int gridWidth;
+  int gridHeight;
+  int blocksWide;
+  int blocksHigh;
+  // Quantized coefficients of each block in zigzag order
+  std::vector<std::array<int16_t, 64>> blocks;
+};
+}  // namespace detail
+
+// Encodes 8-bit pixels, one byte each for gray or three for RGB. There is no APP0 segment, the decoders only need
+// the frame.
+inline std::string encode(const std::vector<uint8_t>& pixels, const int width, const int height, const int channels,
+                          const Options& options = {}) {
+  using namespace detail;
+  const auto order = zigzag();
+  const int componentCount = channels == 1 ? 1 : 3;
+  const int hMax = componentCount == 1 ? 1 : options.lumaH;
+  const int vMax = componentCount == 1 ? 1 : options.lumaV;
+  const int mcusWide = (width + 8 * hMax - 1) / (8 * hMax);
+  const int mcusHigh = (height + 8 * vMax - 1) / (8 * vMax);
+
+  const int scale = options.quality < 50 ? 5000 / options.quality : 200 - options.quality * 2;
+  uint8_t quant[2][64];
+  for (int i = 0; i < 64; i++) {
+    quant[0][i] = static_cast<uint8_t>(std::min(255, std::max(1, (LUMA_QUANT[i] * scale + 50) / 100)));
+    quant[1][i] = static_cast<uint8_t>(std::min(255, std::max(1, (CHROMA_QUANT[i] * scale + 50) / 100)));
+  }
+
+  float cosines[8][8];
+  for (int x = 0; x < 8; x++) {
+    for (int u = 0; u < 8; u++) {
+      cosines[x][u] = static_cast<float>(std::cos((2 * x + 1) * u * M_PI / 16));
+    }
+  }
+
+  // Full resolution planes
+  std::vector<float> planes[3];
+  for (int c = 0; c < componentCount; c++) {
+    planes[c].resize(static_cast<size_t>(width) * height);
+  }
+  for (size_t i = 0; i < static_cast<size_t>(width) * height; i++) {
+    if (componentCount == 1) {
+      planes[0][i] = pixels[i];
+      continue;
+    }
+    const float r = pixels[i * 3];
+    const float g = pixels[i * 3 + 1];
+    const float b = pixels[i * 3 + 2];
+    planes[0][i] = 0.299f * r + 0.587f * g + 0.114f * b;
+    planes[1][i] = -0.168736f * r - 0.331264f * g + 0.5f * b + 128;
+    planes[2][i] = 0.5f * r - 0.418688f * g - 0.081312f * b + 128;
+  }
+
+  Component components[3];
+  for (int c = 0; c < componentCount; c++) {
+    Component& component = components[c];
+    component.h = c == 0 ? hMax : 1;
+    component.v = c == 0 ? vMax : 1;
+    component.quantTable = c == 0 ? 0 : 1;
+    component.gridWidth = mcusWide * component.h;
+    component.gridHeight = mcusHigh * component.v;
+    const int planeWidth = (width * component.h + hMax - 1) / hMax;
+    const int planeHeight = (height * component.v + vMax - 1) / vMax;
+    component.blocksWide = (planeWidth + 7) / 8;
+    component.blocksHigh = (planeHeight + 7) / 8;
+    const int stepX = hMax / component.h;
+    const int stepY = vMax / component.v;
+
+    // Subsampled by averaging, with the edges repeated into the padding
+    auto sample = [&](int x, int y) {
+      x = std::min(x, planeWidth - 1);
+      y = std::min(y, planeHeight - 1);
+      float sum = 0;
+      for (int dy = 0; dy < stepY; dy++) {
+        for (int dx = 0; dx < stepX; dx++) {
+          const int sx = std::min(x * stepX + dx, width - 1);
+          const int sy = std::min(y * stepY + dy, height - 1);
+          sum += planes[c][static_cast<size_t>(sy) * width + sx];
+        }
+      }
+      return sum / (stepX * stepY);
+    };
+
+    component.blocks.resize(static_cast<size_t>(component.gridWidth) * component.gridHeight);
+    for (int by = 0; by < component.gridHeight; by++) {
+      for (int bx = 0; bx < component.gridWidth; bx++) {
+        float block[64];
+        for (int y = 0; y < 8; y++) {
+          for (int x = 0; x < 8; x++) {
+            block[y * 8 + x] = sample(bx * 8 + x, by * 8 + y) - 128;
+          }
+        }
+        // Separable DCT, rows then columns
+        float rows[64];
+        for (int y = 0; y < 8; y++) {
+          for (int u = 0; u < 8; u++) {
+            float sum = 0;
+            for (int x = 0; x < 8; x++) {
+              sum += block[y * 8 + x] * cosines[x][u];
+            }
+            rows[y * 8 + u] = sum;
+          }
+        }
+        auto& coefficients = component.blocks[static_cast<size_t>(by) * component.gridWidth + bx];
+        for (int k = 0; k < 64; k++) {
+          const int u = order[k] % 8;
+          const int v = order[k] / 8;
+          float sum = 0;
+          for (int y = 0; y < 8; y++) {
+            sum += rows[y * 8 + u] * cosines[y][v];
+          }
+          const float cu = u == 0 ? M_SQRT1_2 : 1;
+          const float cv = v == 0 ? M_SQRT1_2 : 1;
+          const int q = quant[component.quantTable][order[k]];
+          coefficients[k] = static_cast<int16_t>(std::lround(sum * cu * cv / 4 / q));
+        }
+      }
+    }
+  }
+
+  std::string out = "\xFF\xD8";
+  out += "\xFF\xDB";
+  put16(out, 2 + 65 * (componentCount == 1 ? 1 : 2));
+  for (int t = 0; t < (componentCount == 1 ? 1 : 2); t++) {
+    out += static_cast<char>(t);
+    for (int k = 0; k < 64; k++) {
+      out += static_cast<char>(quant[t][order[k]]);
+    }
+  }
+  out += options.progressive ? "\xFF\xC2" : "\xFF\xC0";
+  put16(out, 8 + 3 * componentCount);
+  out += '\x08';
+  put16(out, height);
+  put16(out, width);
+  out += static_cast<char>(componentCount);
+  for (int c = 0; c < componentCount; c++) {
+    out += static_cast<char>(c + 1);
+    out += static_cast<char>(components[c].h << 4 | components[c].v);
+    out += static_cast<char>(components[c].quantTable);
+  }
+  if (options.restartInterval > 0) {
+    out += "\xFF\xDD";
+    put16(out, 4);
+    put16(out, options.restartInterval);
+  }
+
+  // Ss, Se, Ah and Al of a scan over the given components
+  auto writeScan = [&](const std::vector<int>& scanComponents, const int ss, const int se, const int ah, const int al) {
+    const bool interleaved = scanComponents.size() > 1;
+    // Each MCU as its blocks in coding order, by component and grid index
+    std::vector<std::vector<std::pair<int, size_t>>> mcus;
+    if (interleaved) {
+      for (int my = 0; my < mcusHigh; my++) {
+        for (int mx = 0; mx < mcusWide; mx++) {
+          std::vector<std::pair<int, size_t>> mcu;
+          for (const int c : scanComponents) {
+            const Component& component = components[c];
+            for (int y = 0; y < component.v; y++) {
+              for (int x = 0; x < component.h; x++) {
+                mcu.emplace_back(c, static_cast<size_t>(my * component.v + y) * component.gridWidth +
+                                        mx * component.h + x);
+              }
+            }
+          }
+          mcus.push_back(mcu);
+        }
+      }
+    } else {
+      const int c = scanComponents[0];
+      const Component& component = components[c];
+      for (int by = 0; by < component.blocksHigh; by++) {
+        for (int bx = 0; bx < component.blocksWide; bx++) {
+          mcus.push_back({{c, static_cast<size_t>(by) * component.gridWidth + bx}});
+        }
+      }
+    }
+
+    ScanCoder coder;
+    coder.out = &out;
+    for (int pass = 0; pass < 2; pass++) {
+      coder.counting = pass == 0;
+      int predictions[3] = {};
+      for (size_t i = 0; i < mcus.size(); i++) {
+        if (options.restartInterval > 0 && i > 0 && i % options.restartInterval == 0) {
+          coder.marker(0xD0 + static_cast<int>((i / options.restartInterval - 1) % 8));
+          predictions[0] = predictions[1] = predictions[2] = 0;
+        }
+        for (const auto& [c, index] : mcus[i]) {
+          const auto& coefficients = components[c].blocks[index];
+          const int table = c == 0 ? 0 : 1;
+          if (ss == 0 && ah > 0) {
+            coder.bits((coefficients[0] >> al) & 1, 1);
+            continue;
+          }
+          if (ss == 0) {
+            const int dc = coefficients[0] >> al;
+            const int diff = dc - predictions[c];
+            predictions[c] = dc;
+            const int size = category(diff);
+            coder.symbol(0, table, size);
+            coder.bits(valueBits(diff, size), size);
+          }
+          if (se > 0) {
+            int run = 0;
+            for (int k = std::max(ss, 1); k <= se; k++) {
+              const int value = coefficients[k];
+              if (value == 0) {
+                run++;
+                continue;
+              }
+              while (run > 15) {
+                coder.symbol(1, table, 0xF0);
+                run -= 16;
+              }
+              const int size = category(value);
+              coder.symbol(1, table, run << 4 | size);
+              coder.bits(valueBits(value, size), size);
+              run = 0;
+            }
+            if (run > 0) {
+              // EOB, or in a progressive scan an end-of-band run of one block
+              coder.symbol(1, table, 0x00);
+            }
+          }
+        }
+      }
+      if (pass == 0) {
+        std::string tables;
+        for (int tableClass = 0; tableClass < 2; tableClass++) {
+          for (int id = 0; id < 2; id++) {
+            long used = 0;
+            for (const long count : coder.counts[tableClass][id]) {
+              used += count;
+            }
+            if (used == 0) {
+              continue;
+            }
+            coder.tables[tableClass][id] = buildTable(coder.counts[tableClass][id]);
+            const HuffmanTable& built = coder.tables[tableClass][id];
+            tables += static_cast<char>(tableClass << 4 | id);
+            tables.append(reinterpret_cast<const char*>(built.counts), 16);
+            tables.append(built.values.begin(), built.values.end());
+          }
+        }
+        if (!tables.empty()) {
+          out += "\xFF\xC4";
+          put16(out, 2 + static_cast<int>(tables.size()));
+          out += tables;
+        }
+        out += "\xFF\xDA";
+        put16(out, 6 + 2 * static_cast<int>(scanComponents.size()));
+        out += static_cast<char>(scanComponents.size());
+        for (const int c : scanComponents) {
+          out += static_cast<char>(c + 1);
+          out += static_cast<char>(c == 0 ? 0x00 : 0x11);
+        }
+        out += static_cast<char>(ss);
+        out += static_cast<char>(se);
+        out += static_cast<char>(ah << 4 | al);
+      }
+    }
+    coder.flush();
+  };
+
+  std::vector<int> all;
+  for (int c = 0; c < componentCount; c++) {
+    all.push_back(c);
+  }
+  if (!options.progressive) {
+    writeScan(all, 0, 63, 0, 0);
+  } else {
+    const int al = options.dcSuccessiveLow;
+    if (options.interleavedDc) {
+      writeScan(all, 0, 0, 0, al);
+    } else {
+      for (const int c : all) {
+        writeScan({c}, 0, 0, 0, al);
+      }
+    }
+    if (al > 0 && options.interleavedDc) {
+      writeScan(all, 0, 0, al, 0);
+    } else if (al > 0) {
+      for (const int c : all) {
+        writeScan({c}, 0, 0, al, 0);
+      }
+    }
+    for (const int c : all) {
+      writeScan({c}, 1, 63, 0, 0);
+    }
+  }
+  out += "\xFF\xD9";
+  return out;
+}
+}  // namespace TestJpeg
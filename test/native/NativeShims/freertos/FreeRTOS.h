@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+// Host stand-in for the parts of FreeRTOS the libraries use. Tasks are threads, queues and semaphores block on a
+// condition variable, and ticks are milliseconds.
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) (ms)
+#define tskIDLE_PRIORITY 0
@@ -0,0 +1,13 @@
+#pragma once
+#include "queue.h"
+
+// Semaphores are queues of empty items, as in FreeRTOS
+typedef QueueHandle_t SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateMutex();
+inline void vSemaphoreDelete(const SemaphoreHandle_t semaphore) { vQueueDelete(semaphore); }
+inline BaseType_t xSemaphoreTake(const SemaphoreHandle_t semaphore, const TickType_t ticksToWait) {
+  return xQueueReceive(semaphore, nullptr, ticksToWait);
+}
+inline BaseType_t xSemaphoreGive(const SemaphoreHandle_t semaphore) { return xQueueSend(semaphore, nullptr, 0); }
@@ -0,0 +1,13 @@
+#pragma once
+#include "FreeRTOS.h"
+
+struct HostTask;
+typedef HostTask* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+// The stack depth and priority are ignored
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth, void* parameter,
+                       UBaseType_t priority, TaskHandle_t* handle);
+// Only a task deleting itself is supported, as a thread can't be stopped from outside
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
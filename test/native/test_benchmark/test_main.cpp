@@ -0,0 +1,153 @@
+#include <EInkDisplay.h>
+#include <EpdFont.h>
+#include <Epub.h>
+#include <GfxRenderer.h>
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <dirent.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Epub/Page.h"
+#include "Epub/Section.h"
+
+// Times the reader pipeline over every EPUB in CROSSPOINT_BENCH_CORPUS: opening the book, the cover, laying out each
+// chapter and rendering its pages. Host timings only say how the code paths compare against each other, the SD card
+// and the panel are not part of them. Pages are written out as PBM images when CROSSPOINT_BENCH_PBM_DIR is set.
+namespace {
+constexpr int FONT_ID = 1;
+constexpr int MARGIN = 8;
+
+EInkDisplay display;
+GfxRenderer renderer(display);
+EpdFont regularFont(&bookerly_14_regular);
+EpdFont boldFont(&bookerly_14_bold);
+EpdFont italicFont(&bookerly_14_italic);
+EpdFont boldItalicFont(&bookerly_14_bolditalic);
+
+struct Timings {
+  unsigned long loadUs = 0;
+  unsigned long coverUs = 0;
+  unsigned long layoutUs = 0;
+  unsigned long renderUs = 0;
+  int sections = 0;
+  int pages = 0;
+};
+
+std::vector<std::string> listEpubs(const char* dir) {
+  std::vector<std::string> names;
+  DIR* handle = opendir(dir);
+  if (!handle) {
+    return names;
+  }
+  while (const dirent* entry = readdir(handle)) {
+    const std::string name = entry->d_name;
+    if (name.size() > 5 && name.compare(name.size() - 5, 5, ".epub") == 0) {
+      names.push_back(name);
+    }
+  }
+  closedir(handle);
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+bool copyToCard(const std::string& hostSource, const std::string& cardPath) {
+  std::ifstream in(hostSource, std::ios::binary);
+  std::ofstream out(SdMan.hostPath(cardPath.c_str()), std::ios::binary);
+  out << in.rdbuf();
+  return in && out;
+}
+
+void report(const std::string& name, const Timings& t) {
+  char line[256];
+  snprintf(line, sizeof(line), "%s: load %.1fms, cover %.1fms, layout %.1fms (%d sections), render %.1fms (%d pages)",
+           name.c_str(), t.loadUs / 1000.0, t.coverUs / 1000.0, t.layoutUs / 1000.0, t.sections, t.renderUs / 1000.0,
+           t.pages);
+  TEST_MESSAGE(line);
+}
+
+void benchmarkBook(const std::string& name, const char* pbmDir) {
+  const std::string cardPath = "/bench/" + name;
+  TEST_ASSERT_TRUE(copyToCard(std::string(getenv("CROSSPOINT_BENCH_CORPUS")) + "/" + name, cardPath));
+
+  Timings t;
+  auto epub = std::make_shared<Epub>(cardPath, "/.crosspoint");
+  unsigned long start = micros();
+  TEST_ASSERT_TRUE_MESSAGE(epub->load(), name.c_str());
+  t.loadUs = micros() - start;
+
+  start = micros();
+  epub->generateCoverBmp();
+  t.coverUs = micros() - start;
+
+  const uint16_t viewportWidth = renderer.getScreenWidth() - MARGIN * 2;
+  const uint16_t viewportHeight = renderer.getScreenHeight() - MARGIN * 2;
+  for (int spineIndex = 0; spineIndex < epub->getSpineItemsCount(); spineIndex++) {
+    Section section(epub, spineIndex, renderer);
+    start = micros();
+    if (!section.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, viewportWidth, viewportHeight)) {
+      continue;
+    }
+    t.layoutUs += micros() - start;
+    t.sections++;
+
+    for (section.currentPage = 0; section.currentPage < section.pageCount; section.currentPage++) {
+      start = micros();
+      const auto page = section.loadPageFromSectionFile();
+      TEST_ASSERT_NOT_NULL(page);
+      renderer.clearScreen();
+      // Only the BW framebuffer is timed and dumped, as the reader shows it without anti-aliasing
+      renderer.setBwImageThreshold(true);
+      page->render(renderer, FONT_ID, MARGIN, MARGIN);
+      renderer.setBwImageThreshold(false);
+      t.renderUs += micros() - start;
+      t.pages++;
+
+      if (pbmDir) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s-%03d-%03d.pbm", pbmDir, name.c_str(), spineIndex, section.currentPage);
+        display.dumpPbm(path);
+      }
+    }
+  }
+  report(name, t);
+}
+}  // namespace
+
+void setUp() {
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regularFont, &boldFont, &italicFont, &boldItalicFont));
+  SdMan.mkdir("/bench");
+}
+
+void tearDown() {}
+
+void test_reader_pipeline() {
+  const char* corpus = getenv("CROSSPOINT_BENCH_CORPUS");
+  if (!corpus) {
+    TEST_IGNORE_MESSAGE("Set CROSSPOINT_BENCH_CORPUS to a directory of EPUB files to run the benchmark");
+  }
+  const auto names = listEpubs(corpus);
+  if (names.empty()) {
+    TEST_IGNORE_MESSAGE("No EPUB files in CROSSPOINT_BENCH_CORPUS");
+  }
+  for (const auto& name : names) {
+    benchmarkBook(name, getenv("CROSSPOINT_BENCH_PBM_DIR"));
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_reader_pipeline);
+  return UNITY_END();
+}
@@ -0,0 +1,228 @@
+#include <Bitmap.h>
+#include <SDCardManager.h>
+#include <unity.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+const char* const BMP_PATH = "/image.bmp";
+
+struct BmpSpec {
+  int width;
+  int height;
+  uint16_t bpp;
+  bool topDown;
+  // 40 for BITMAPINFOHEADER, 124 for BITMAPV5HEADER
+  uint32_t dibSize;
+};
+
+void appendLE(std::vector<uint8_t>& out, const uint32_t value, const int bytes) {
+  for (int i = 0; i < bytes; i++) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+// Random pixels, and a random palette for the indexed depths, so every row and palette entry differs
+std::vector<uint8_t> makeBmp(const BmpSpec& spec, const uint32_t seed) {
+  std::mt19937 random(seed);
+  const uint32_t colors = spec.bpp <= 8 ? 1u << spec.bpp : 0;
+  const uint32_t rowBytes = (spec.width * spec.bpp + 31) / 32 * 4;
+  // A gap between the palette and the pixels, which the reader has to skip with bfOffBits
+  const uint32_t dataOffset = 14 + spec.dibSize + colors * 4 + 6;
+
+  std::vector<uint8_t> bmp;
+  bmp.push_back('B');
+  bmp.push_back('M');
+  appendLE(bmp, dataOffset + rowBytes * spec.height, 4);
+  appendLE(bmp, 0, 4);
+  appendLE(bmp, dataOffset, 4);
+
+  appendLE(bmp, spec.dibSize, 4);
+  appendLE(bmp, spec.width, 4);
+  appendLE(bmp, spec.topDown ? -spec.height : spec.height, 4);
+  appendLE(bmp, 1, 2);
+  appendLE(bmp, spec.bpp, 2);
+  appendLE(bmp, 0, 4);
+  appendLE(bmp, rowBytes * spec.height, 4);
+  appendLE(bmp, 2835, 4);
+  appendLE(bmp, 2835, 4);
+  appendLE(bmp, colors, 4);
+  appendLE(bmp, 0, 4);
+  bmp.resize(14 + spec.dibSize, 0);
+
+  for (uint32_t i = 0; i < colors; i++) {
+    appendLE(bmp, random() & 0xFFFFFF, 4);
+  }
+  bmp.resize(dataOffset, 0);
+  for (int y = 0; y < spec.height; y++) {
+    for (uint32_t i = 0; i < rowBytes; i++) {
+      bmp.push_back(static_cast<uint8_t>(random()));
+    }
+  }
+  return bmp;
+}
+
+void writeCardFile(const std::vector<uint8_t>& data) {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", BMP_PATH, file));
+  file.write(data.data(), data.size());
+  file.close();
+}
+
+uint32_t readLE(const std::vector<uint8_t>& data, const size_t offset, const int bytes) {
+  uint32_t value = 0;
+  for (int i = 0; i < bytes; i++) {
+    value |= static_cast<uint32_t>(data[offset + i]) << (8 * i);
+  }
+  return value;
+}
+
+uint8_t luminance(const uint8_t* bgr) { return (77u * bgr[2] + 150u * bgr[1] + 29u * bgr[0]) >> 8; }
+
+// The rows as the per-pixel reader produced them: each row read on its own, then one pixel at a time to 2-bit
+std::vector<std::vector<uint8_t>> referenceRows(const std::vector<uint8_t>& bmp, const BmpSpec& spec,
+                                                const bool dithering) {
+  const uint32_t dataOffset = readLE(bmp, 10, 4);
+  const uint32_t rowBytes = (spec.width * spec.bpp + 31) / 32 * 4;
+  const uint8_t* palette = bmp.data() + 14 + spec.dibSize;
+  AtkinsonDitherer ditherer(spec.width);
+  const bool dithered = dithering && spec.bpp > 2;
+
+  std::vector<std::vector<uint8_t>> rows;
+  for (int y = 0; y < spec.height; y++) {
+    const uint8_t* row = bmp.data() + dataOffset + y * rowBytes;
+    std::vector<uint8_t> packed((spec.width + 3) / 4, 0);
+    for (int x = 0; x < spec.width; x++) {
+      uint8_t level;
+      if (spec.bpp == 1) {
+        level = (row[x / 8] >> (7 - x % 8)) & 1 ? 3 : 0;
+      } else if (spec.bpp == 2) {
+        level = luminance(palette + ((row[x / 4] >> (6 - x % 4 * 2)) & 3) * 4) >> 6;
+      } else {
+        const uint8_t lum = spec.bpp == 8 ? luminance(palette + row[x] * 4) : luminance(row + x * spec.bpp / 8);
+        level = dithered ? ditherer.processPixel(adjustPixel(lum), x) : quantize(adjustPixel(lum), x, y);
+      }
+      packed[x / 4] |= level << (6 - x % 4 * 2);
+    }
+    if (dithered) {
+      ditherer.nextRow();
+    }
+    rows.push_back(packed);
+  }
+  return rows;
+}
+
+void checkRowsMatch(const BmpSpec& spec, const bool dithering, const uint32_t seed) {
+  const auto bmp = makeBmp(spec, seed);
+  writeCardFile(bmp);
+  const auto expected = referenceRows(bmp, spec, dithering);
+
+  char name[96];
+  snprintf(name, sizeof(name), "%dx%d %d bpp%s%s, %u byte DIB", spec.width, spec.height, spec.bpp,
+           spec.topDown ? " top-down" : "", dithering ? " dithered" : "", spec.dibSize);
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", BMP_PATH, file));
+  Bitmap bitmap(file, dithering);
+  TEST_ASSERT_EQUAL_MESSAGE(BmpReaderError::Ok, bitmap.parseHeaders(), name);
+  TEST_ASSERT_EQUAL_MESSAGE(spec.width, bitmap.getWidth(), name);
+  TEST_ASSERT_EQUAL_MESSAGE(spec.height, bitmap.getHeight(), name);
+  TEST_ASSERT_EQUAL_MESSAGE(spec.topDown, bitmap.isTopDown(), name);
+
+  std::vector<uint8_t> row((spec.width + 3) / 4);
+  // Twice, the second time after rewinding as the grayscale passes do
+  for (int pass = 0; pass < 2; pass++) {
+    for (int y = 0; y < spec.height; y++) {
+      TEST_ASSERT_EQUAL_MESSAGE(BmpReaderError::Ok, bitmap.readNextRow(row.data()), name);
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected[y].data(), row.data(), row.size(), name);
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(BmpReaderError::ShortReadRow, bitmap.readNextRow(row.data()), name);
+    TEST_ASSERT_EQUAL_MESSAGE(BmpReaderError::Ok, bitmap.rewindToData(), name);
+  }
+  file.close();
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+// Widths that end a row part way through a byte, a 32 bit word and a sector, at every supported depth
+void test_rows_match_per_pixel_reader() {
+  uint32_t seed = 1;
+  for (const uint16_t bpp : {1, 2, 8, 24, 32}) {
+    for (const int width : {1, 3, 37, 171, 480, 481}) {
+      for (const bool topDown : {false, true}) {
+        checkRowsMatch({width, 23, bpp, topDown, 40}, false, seed++);
+      }
+      checkRowsMatch({width, 23, bpp, false, 40}, true, seed++);
+    }
+  }
+}
+
+// V4 and V5 headers put the palette further from the start of the file
+void test_palette_follows_long_dib_header() {
+  for (const uint16_t bpp : {2, 8}) {
+    for (const uint32_t dibSize : {108, 124}) {
+      checkRowsMatch({37, 9, bpp, false, dibSize}, false, bpp + dibSize);
+    }
+  }
+}
+
+// A full-screen cover is read a block at a time instead of a read per row
+void test_cover_rows_are_read_in_blocks() {
+  const BmpSpec spec = {480, 800, 24, true, 40};
+  const auto bmp = makeBmp(spec, 99);
+  writeCardFile(bmp);
+
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", BMP_PATH, file));
+  Bitmap bitmap(file);
+  TEST_ASSERT_EQUAL(BmpReaderError::Ok, bitmap.parseHeaders());
+  std::vector<uint8_t> row(120);
+  SdMan.resetOpCounts();
+  for (int y = 0; y < spec.height; y++) {
+    TEST_ASSERT_EQUAL(BmpReaderError::Ok, bitmap.readNextRow(row.data()));
+  }
+  const auto ops = SdMan.opCounts();
+  file.close();
+
+  const size_t dataBytes = static_cast<size_t>(bitmap.getRowBytes()) * spec.height;
+  TEST_ASSERT_EQUAL_size_t(dataBytes, ops.bytesRead);
+  TEST_ASSERT_LESS_OR_EQUAL(dataBytes / 4096 + 2, ops.reads);
+  char line[128];
+  snprintf(line, sizeof(line), "480x800 24 bpp cover: %zu reads for %d rows, %zu seeks", ops.reads, spec.height,
+           ops.seeks);
+  TEST_MESSAGE(line);
+}
+
+void test_truncated_pixel_data_fails_the_missing_rows() {
+  const BmpSpec spec = {37, 10, 24, false, 40};
+  auto bmp = makeBmp(spec, 7);
+  const int rowBytes = (spec.width * spec.bpp + 31) / 32 * 4;
+  // Six whole rows and part of the seventh
+  bmp.resize(readLE(bmp, 10, 4) + rowBytes * 6 + rowBytes / 2);
+  writeCardFile(bmp);
+
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", BMP_PATH, file));
+  Bitmap bitmap(file);
+  TEST_ASSERT_EQUAL(BmpReaderError::Ok, bitmap.parseHeaders());
+  std::vector<uint8_t> row(10);
+  for (int y = 0; y < 6; y++) {
+    TEST_ASSERT_EQUAL(BmpReaderError::Ok, bitmap.readNextRow(row.data()));
+  }
+  TEST_ASSERT_EQUAL(BmpReaderError::ShortReadRow, bitmap.readNextRow(row.data()));
+  file.close();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_rows_match_per_pixel_reader);
+  RUN_TEST(test_palette_follows_long_dib_header);
+  RUN_TEST(test_cover_rows_are_read_in_blocks);
+  RUN_TEST(test_truncated_pixel_data_fails_the_missing_rows);
+  return UNITY_END();
+}
@@ -0,0 +1,311 @@
+#include <HostHeap.h>
+#include <SDCardManager.h>
+#include <TestArchives.h>
+#include <ZipFile.h>
+#include <miniz.h>
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+#include "Epub/BookMetadataCache.h"
+
+// Builds book.bin for synthetic books through the same calls the OPF and TOC parsers make, then reads it back
+namespace {
+constexpr char CACHE_PATH[] = "/cache";
+constexpr char EPUB_PATH[] = "/book.epub";
+constexpr int LOOKUP_ROUNDS = 10;
+
+struct SyntheticBook {
+  std::vector<std::string> spineHrefs;
+  std::vector<size_t> itemSizes;
+  std::vector<BookMetadataCache::TocEntry> toc;
+};
+
+// Two or three TOC entries per chapter with anchors past the first, every tenth chapter without one, and some entries
+// pointing outside the spine
+SyntheticBook makeBook(const int spineCount, const int tocCount) {
+  SyntheticBook book;
+  for (int i = 0; i < spineCount; i++) {
+    book.spineHrefs.push_back("OEBPS/text/part" + std::to_string(i / 100) + "/chapter" + std::to_string(i) + ".xhtml");
+    book.itemSizes.push_back(64 + i % 200);
+  }
+  int lastTarget = -1;
+  for (int j = 0; j < tocCount; j++) {
+    int target = static_cast<int>(static_cast<long>(j) * spineCount / tocCount);
+    if (target % 10 == 9) {
+      target--;
+    }
+    const std::string href = j % 97 == 50 ? "OEBPS/text/notes.xhtml" : book.spineHrefs[target];
+    const std::string anchor = target == lastTarget ? "section" + std::to_string(j) : "";
+    const std::string title = "Chapter " + std::to_string(j) + std::string(j % 23, '.');
+    book.toc.emplace_back(title, href, anchor, static_cast<uint8_t>(1 + j % 3), -1);
+    lastTarget = target;
+  }
+  return book;
+}
+
+void writeEpub(const SyntheticBook& book) {
+  std::vector<TestArchives::ZipEntry> entries;
+  for (size_t i = 0; i < book.spineHrefs.size(); i++) {
+    entries.push_back({book.spineHrefs[i], std::string(book.itemSizes[i], static_cast<char>('a' + i % 26)), false});
+  }
+  TEST_ASSERT_TRUE(TestArchives::writeZip(EPUB_PATH, entries));
+}
+
+// Returns how long the cache took to build, spine and TOC passes included, with the card operations it took
+unsigned long buildBookBin(const SyntheticBook& book, SDCardManager::OpCounts* opsOut = nullptr) {
+  writeEpub(book);
+  SdMan.removeDir(CACHE_PATH);
+  SdMan.mkdir(CACHE_PATH);
+
+  SdMan.resetOpCounts();
+  const unsigned long start = micros();
+  BookMetadataCache cache(CACHE_PATH);
+  TEST_ASSERT_TRUE(cache.beginWrite());
+  TEST_ASSERT_TRUE(cache.beginContentOpfPass());
+  for (const auto& href : book.spineHrefs) {
+    cache.createSpineEntry(href);
+  }
+  TEST_ASSERT_TRUE(cache.endContentOpfPass());
+  TEST_ASSERT_TRUE(cache.beginTocPass());
+  for (const auto& entry : book.toc) {
+    cache.createTocEntry(entry.title, entry.href, entry.anchor, entry.level);
+  }
+  TEST_ASSERT_TRUE(cache.endTocPass());
+  TEST_ASSERT_TRUE(cache.endWrite());
+
+  // The zip index is loaded first, as Epub does
+  const std::string epubPath = EPUB_PATH;
+  ZipFile zip(epubPath);
+  TEST_ASSERT_TRUE(zip.loadFileStatIndex(std::string(CACHE_PATH) + "/zip.idx"));
+  BookMetadataCache::BookMetadata metadata;
+  metadata.title = "Synthetic";
+  TEST_ASSERT_TRUE(cache.buildBookBin(zip, metadata));
+  TEST_ASSERT_TRUE(cache.cleanupTmpFiles());
+  const unsigned long elapsed = micros() - start;
+  if (opsOut) {
+    *opsOut = SdMan.opCounts();
+  }
+  return elapsed;
+}
+
+void assertSameSpineEntry(const BookMetadataCache::SpineEntry& expected, const BookMetadataCache::SpineEntry& actual) {
+  TEST_ASSERT_EQUAL_STRING(expected.href.c_str(), actual.href.c_str());
+  TEST_ASSERT_EQUAL_size_t(expected.cumulativeSize, actual.cumulativeSize);
+  TEST_ASSERT_EQUAL(expected.tocIndex, actual.tocIndex);
+}
+
+void assertSameTocEntry(const BookMetadataCache::TocEntry& expected, const BookMetadataCache::TocEntry& actual) {
+  TEST_ASSERT_EQUAL_STRING(expected.title.c_str(), actual.title.c_str());
+  TEST_ASSERT_EQUAL_STRING(expected.href.c_str(), actual.href.c_str());
+  TEST_ASSERT_EQUAL_STRING(expected.anchor.c_str(), actual.anchor.c_str());
+  TEST_ASSERT_EQUAL(expected.level, actual.level);
+  TEST_ASSERT_EQUAL(expected.spineIndex, actual.spineIndex);
+}
+
+template <typename T>
+void appendPod(std::string& out, const T& value) {
+  out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void appendString(std::string& out, const std::string& str) {
+  appendPod(out, static_cast<uint32_t>(str.size()));
+  out += str;
+}
+
+// book.bin as the per-entry scans wrote it: each TOC entry points at the first spine item with its href, and each
+// spine item at the first TOC entry pointing at it, or else at the previous spine item's
+std::string referenceBookBin(const SyntheticBook& book) {
+  std::vector<BookMetadataCache::TocEntry> toc = book.toc;
+  for (auto& entry : toc) {
+    for (size_t i = 0; i < book.spineHrefs.size(); i++) {
+      if (book.spineHrefs[i] == entry.href) {
+        entry.spineIndex = static_cast<int16_t>(i);
+        break;
+      }
+    }
+  }
+
+  std::string spineEntries;
+  std::vector<uint32_t> spineOffsets;
+  int16_t lastTocIndex = -1;
+  uint32_t cumulativeSize = 0;
+  for (size_t i = 0; i < book.spineHrefs.size(); i++) {
+    int16_t tocIndex = lastTocIndex;
+    for (size_t j = 0; j < toc.size(); j++) {
+      if (toc[j].spineIndex == static_cast<int16_t>(i)) {
+        tocIndex = static_cast<int16_t>(j);
+        break;
+      }
+    }
+    lastTocIndex = tocIndex;
+    cumulativeSize += book.itemSizes[i];
+    spineOffsets.push_back(spineEntries.size());
+    appendString(spineEntries, book.spineHrefs[i]);
+    appendPod(spineEntries, static_cast<size_t>(cumulativeSize));
+    appendPod(spineEntries, tocIndex);
+  }
+
+  std::string tocEntries;
+  std::vector<uint32_t> tocOffsets;
+  for (const auto& entry : toc) {
+    tocOffsets.push_back(tocEntries.size());
+    appendString(tocEntries, entry.title);
+    appendString(tocEntries, entry.href);
+    appendString(tocEntries, entry.anchor);
+    appendPod(tocEntries, entry.level);
+    appendPod(tocEntries, entry.spineIndex);
+  }
+
+  std::string metadata;
+  for (const char* str : {"Synthetic", "", "", ""}) {
+    appendString(metadata, str);
+  }
+  constexpr uint8_t version = 4;
+  const uint32_t lutOffset = sizeof(version) + sizeof(uint32_t) + sizeof(uint16_t) * 2 + metadata.size();
+  const uint32_t entriesOffset = lutOffset + sizeof(uint32_t) * (spineOffsets.size() + tocOffsets.size());
+
+  std::string out;
+  appendPod(out, version);
+  appendPod(out, lutOffset);
+  appendPod(out, static_cast<uint16_t>(book.spineHrefs.size()));
+  appendPod(out, static_cast<uint16_t>(toc.size()));
+  out += metadata;
+  for (const uint32_t offset : spineOffsets) {
+    appendPod(out, entriesOffset + offset);
+  }
+  for (const uint32_t offset : tocOffsets) {
+    appendPod(out, static_cast<uint32_t>(entriesOffset + spineEntries.size() + offset));
+  }
+  return out + spineEntries + tocEntries;
+}
+
+// Average time of a lookup over every spine and TOC entry, with the card operations they took
+double lookupMicros(BookMetadataCache& cache, SDCardManager::OpCounts* opsOut) {
+  SdMan.resetOpCounts();
+  const unsigned long start = micros();
+  for (int round = 0; round < LOOKUP_ROUNDS; round++) {
+    for (int i = 0; i < cache.getSpineCount(); i++) {
+      cache.getSpineEntry(i);
+    }
+    for (int i = 0; i < cache.getTocCount(); i++) {
+      cache.getTocEntry(i);
+    }
+  }
+  const unsigned long elapsed = micros() - start;
+  *opsOut = SdMan.opCounts();
+  return static_cast<double>(elapsed) / (LOOKUP_ROUNDS * (cache.getSpineCount() + cache.getTocCount()));
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+// Lookups served from the RAM index have to return what reading book.bin returns, without touching the card
+void test_ram_index_matches_sd() {
+  buildBookBin(makeBook(2000, 5000));
+
+  HostHeap::reset();
+  BookMetadataCache sdCache(CACHE_PATH, 0);
+  TEST_ASSERT_TRUE(sdCache.load());
+  const size_t sdHeld = HostHeap::heldBytes();
+
+  constexpr size_t budget = 1024 * 1024;
+  HostHeap::reset();
+  BookMetadataCache ramCache(CACHE_PATH, budget);
+  TEST_ASSERT_TRUE(ramCache.load());
+  const size_t ramHeld = HostHeap::heldBytes();
+
+  TEST_ASSERT_EQUAL(2000, ramCache.getSpineCount());
+  TEST_ASSERT_EQUAL(5000, ramCache.getTocCount());
+  for (int i = 0; i < ramCache.getSpineCount(); i++) {
+    assertSameSpineEntry(sdCache.getSpineEntry(i), ramCache.getSpineEntry(i));
+  }
+  for (int i = 0; i < ramCache.getTocCount(); i++) {
+    assertSameTocEntry(sdCache.getTocEntry(i), ramCache.getTocEntry(i));
+  }
+
+  SDCardManager::OpCounts sdOps;
+  SDCardManager::OpCounts ramOps;
+  const double sdUs = lookupMicros(sdCache, &sdOps);
+  const double ramUs = lookupMicros(ramCache, &ramOps);
+  TEST_ASSERT_EQUAL_size_t(0, ramOps.seeks + ramOps.reads);
+  TEST_ASSERT_GREATER_THAN(0, sdOps.seeks);
+  if (HostHeap::available()) {
+    TEST_ASSERT_LESS_THAN(budget, ramHeld);
+  }
+
+  const double lookups = LOOKUP_ROUNDS * 7000.0;
+  char line[192];
+  snprintf(line, sizeof(line),
+           "2000 spine, 5000 TOC entries: SD %.2fus with %.1f seeks and %.1f reads per lookup, RAM %.2fus; "
+           "resident %zu bytes on SD, %zu bytes with the RAM index",
+           sdUs, sdOps.seeks / lookups, sdOps.reads / lookups, ramUs, sdHeld, ramHeld);
+  TEST_MESSAGE(line);
+}
+
+// The default budget holds a typical book and leaves a 5000 entry TOC on the card
+void test_default_budget_falls_back_to_sd() {
+  SDCardManager::OpCounts ops;
+
+  buildBookBin(makeBook(100, 250));
+  BookMetadataCache smallCache(CACHE_PATH);
+  TEST_ASSERT_TRUE(smallCache.load());
+  lookupMicros(smallCache, &ops);
+  TEST_ASSERT_EQUAL_size_t(0, ops.seeks + ops.reads);
+
+  buildBookBin(makeBook(2000, 5000));
+  BookMetadataCache largeCache(CACHE_PATH);
+  TEST_ASSERT_TRUE(largeCache.load());
+  lookupMicros(largeCache, &ops);
+  TEST_ASSERT_GREATER_THAN(0, ops.seeks);
+}
+
+// The sorted cross-reference passes have to write the same book.bin as scanning the other list for every entry,
+// across sort run boundaries and with TOC hrefs and spine items that have no match
+void test_book_bin_matches_per_entry_scans() {
+  for (const auto& counts : {std::make_pair(1, 3), std::make_pair(30, 0), std::make_pair(513, 1200)}) {
+    const auto book = makeBook(counts.first, counts.second);
+    buildBookBin(book);
+    TEST_ASSERT_TRUE(TestArchives::readCardFile(std::string(CACHE_PATH) + "/book.bin") == referenceBookBin(book));
+  }
+
+  const auto book = makeBook(2000, 5000);
+  const unsigned long buildUs = buildBookBin(book);
+  TEST_ASSERT_TRUE(TestArchives::readCardFile(std::string(CACHE_PATH) + "/book.bin") == referenceBookBin(book));
+
+  char line[128];
+  snprintf(line, sizeof(line), "2000 spine, 5000 TOC entries: cache built in %.1fms", buildUs / 1000.0);
+  TEST_MESSAGE(line);
+}
+
+// Matching spine items with TOC entries has to stay near linear in the book's size: four times the entries may read
+// under six times the bytes, where a rescan of the TOC per batch of spine items reads about sixteen times as many
+void test_book_bin_build_reads_scale_with_book_size() {
+  SDCardManager::OpCounts smallOps;
+  SDCardManager::OpCounts largeOps;
+  buildBookBin(makeBook(2000, 5000), &smallOps);
+  const auto largeBook = makeBook(8000, 20000);
+  const unsigned long largeUs = buildBookBin(largeBook, &largeOps);
+  TEST_ASSERT_TRUE(TestArchives::readCardFile(std::string(CACHE_PATH) + "/book.bin") == referenceBookBin(largeBook));
+
+  const double ratio = static_cast<double>(largeOps.bytesRead) / smallOps.bytesRead;
+  char line[192];
+  snprintf(line, sizeof(line),
+           "Cache build reads %zu bytes for 2000 spine, 5000 TOC entries and %zu bytes (%.2fx) for 8000, 20000 in "
+           "%.1fms",
+           smallOps.bytesRead, largeOps.bytesRead, ratio, largeUs / 1000.0);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_TRUE_MESSAGE(largeOps.bytesRead < 6 * smallOps.bytesRead, line);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_ram_index_matches_sd);
+  RUN_TEST(test_default_budget_falls_back_to_sd);
+  RUN_TEST(test_book_bin_matches_per_entry_scans);
+  RUN_TEST(test_book_bin_build_reads_scale_with_book_size);
+  return UNITY_END();
+}
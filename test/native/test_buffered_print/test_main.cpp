@@ -0,0 +1,92 @@
+#include <BufferedPrint.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+// Records every write it is passed, and can be told to come up short like a full card
+class RecordingPrint final : public Print {
+ public:
+  std::string data;
+  std::vector<size_t> writeSizes;
+  size_t capacity = SIZE_MAX;
+
+  size_t write(const uint8_t byte) override { return write(&byte, 1); }
+  size_t write(const uint8_t* buffer, const size_t size) override {
+    const size_t accepted = size < capacity - data.size() ? size : capacity - data.size();
+    data.append(reinterpret_cast<const char*>(buffer), accepted);
+    writeSizes.push_back(size);
+    return accepted;
+  }
+};
+
+std::string makeBytes(const size_t size) {
+  std::string bytes(size, '\0');
+  for (size_t i = 0; i < size; i++) {
+    bytes[i] = static_cast<char>(i * 31 + i / 7);
+  }
+  return bytes;
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_passes_on_whole_blocks() {
+  const std::string bytes = makeBytes(20000);
+  RecordingPrint target;
+  {
+    BufferedPrint out(target, 512);
+    const size_t sizes[] = {1, 3, 700, 2048, 5, 511, 4096, 1};
+    size_t offset = 0;
+    for (size_t i = 0; offset < bytes.size(); i++) {
+      const size_t size = std::min(sizes[i % (sizeof(sizes) / sizeof(sizes[0]))], bytes.size() - offset);
+      TEST_ASSERT_EQUAL_size_t(size, out.write(reinterpret_cast<const uint8_t*>(bytes.data()) + offset, size));
+      offset += size;
+    }
+    out.flush();
+    TEST_ASSERT_EQUAL_INT(0, out.getWriteError());
+  }
+
+  TEST_ASSERT_TRUE(target.data == bytes);
+  // Every write but the final flush is a multiple of the block size
+  for (size_t i = 0; i + 1 < target.writeSizes.size(); i++) {
+    TEST_ASSERT_EQUAL_size_t(0, target.writeSizes[i] % 512);
+  }
+}
+
+void test_single_bytes_are_collected() {
+  RecordingPrint target;
+  BufferedPrint out(target, 64);
+  for (int i = 0; i < 200; i++) {
+    out.write(static_cast<uint8_t>(i));
+  }
+  TEST_ASSERT_EQUAL_size_t(3, target.writeSizes.size());
+  out.flush();
+  TEST_ASSERT_EQUAL_size_t(4, target.writeSizes.size());
+  TEST_ASSERT_EQUAL_size_t(200, target.data.size());
+  TEST_ASSERT_EQUAL_UINT8(199, static_cast<uint8_t>(target.data[199]));
+}
+
+void test_short_write_sets_write_error() {
+  RecordingPrint target;
+  target.capacity = 1000;
+  BufferedPrint out(target, 512);
+  const std::string bytes = makeBytes(1500);
+  out.write(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
+  out.flush();
+  TEST_ASSERT_NOT_EQUAL(0, out.getWriteError());
+  TEST_ASSERT_EQUAL_size_t(1000, target.data.size());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_passes_on_whole_blocks);
+  RUN_TEST(test_single_bytes_are_collected);
+  RUN_TEST(test_short_write_sets_write_error);
+  return UNITY_END();
+}
@@ -0,0 +1,318 @@
+#include <CalibreMessageBuffer.h>
+#include <HostHeap.h>
+#include <SDCardManager.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// Replays a Calibre session from the SD card through the buffer in the segment sizes a TCP stream hands over, the way
+// CalibreWirelessActivity reads it
+namespace {
+constexpr char SESSION_PATH[] = "/calibre_session.bin";
+constexpr size_t BUFFER_SIZE = 100 * 1024;
+constexpr size_t MAX_SEGMENT_SIZE = 1460;
+
+// A message, or the book data that follows SEND_BOOK
+struct Event {
+  bool binary;
+  std::string bytes;
+};
+
+std::string frame(const int opcode, const std::string& data) {
+  const std::string json = "[" + std::to_string(opcode) + "," + data + "]";
+  return std::to_string(json.size()) + json;
+}
+
+void addMessage(std::vector<Event>& session, const int opcode, const std::string& data) {
+  session.push_back({false, frame(opcode, data)});
+}
+
+std::string metadata(const int i) {
+  std::string json = "{\"title\":\"Book " + std::to_string(i) + " [Vol. " + std::to_string(i % 7) +
+                     "]\",\"authors\":[\"Author " + std::to_string(i % 41) + "\"],\"lpath\":\"Author/Book " +
+                     std::to_string(i) + ".epub\",\"comments\":\"";
+  json.append(100 + i * 37 % 4000, 'c');
+  return json + "\"}";
+}
+
+// Init, device info and free space, a book list, book data with '[' and digits in it, NOOPs and messages too large
+// for the buffer
+std::vector<Event> makeSession(const int bookCount) {
+  std::vector<Event> session;
+  std::mt19937 random(14);
+  addMessage(session, 9, "{\"serverProtocolVersion\":1,\"validExtensions\":[\"epub\"],\"passwordChallenge\":\"\"}");
+  addMessage(session, 3, "{}");
+  addMessage(session, 5, "{}");
+  addMessage(session, 6, "{\"count\":" + std::to_string(bookCount) + ",\"collections\":{}}");
+  for (int i = 0; i < bookCount; i++) {
+    addMessage(session, 7, metadata(i));
+    if (i % 50 == 0) {
+      addMessage(session, 12, "{}");
+    }
+    if (i % 400 == 123) {
+      std::string book(200 * 1024 + i, '\0');
+      for (auto& c : book) {
+        c = static_cast<char>(random());
+      }
+      addMessage(session, 8,
+                 "{\"lpath\":\"Book " + std::to_string(i) + ".epub\",\"length\":" + std::to_string(book.size()) + "}");
+      session.push_back({true, book});
+    }
+    if (i % 700 == 300) {
+      addMessage(session, i % 1400 == 300 ? 12 : 7, "{\"comments\":\"" + std::string(BUFFER_SIZE + i, 'x') + "\"}");
+    }
+  }
+  return session;
+}
+
+size_t writeSession(const std::vector<Event>& session) {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", SESSION_PATH, file));
+  size_t size = 0;
+  for (const auto& event : session) {
+    TEST_ASSERT_EQUAL_size_t(event.bytes.size(), file.write(event.bytes.data(), event.bytes.size()));
+    size += event.bytes.size();
+  }
+  file.close();
+  return size;
+}
+
+struct Replay {
+  size_t messages = 0;
+  size_t tooLarge = 0;
+  size_t binaryBytes = 0;
+  unsigned long micros = 0;
+  size_t allocations = 0;
+};
+
+// Checks every message and book against the session as it is read back
+Replay replay(const std::vector<Event>& session, const size_t bufferSize) {
+  CalibreMessageBuffer messages;
+  TEST_ASSERT_TRUE(messages.allocate(bufferSize, bufferSize));
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", SESSION_PATH, file));
+  // The C library allocates its buffer for the file on the first read, which isn't the buffer's doing
+  uint8_t first;
+  TEST_ASSERT_EQUAL(1, file.read(&first, 1));
+  TEST_ASSERT_TRUE(file.seek(0));
+  std::mt19937 random(15);
+  std::uniform_int_distribution<size_t> segmentSize(1, MAX_SEGMENT_SIZE);
+  std::vector<uint8_t> book;
+  for (const auto& event : session) {
+    book.reserve(event.binary ? std::max(book.capacity(), event.bytes.size()) : book.capacity());
+  }
+
+  Replay result;
+  HostHeap::reset();
+  const unsigned long start = micros();
+  size_t next = 0;
+  bool endOfFile = false;
+  while (next < session.size()) {
+    const Event& expected = session[next];
+    if (expected.binary) {
+      if (messages.unread() > 0) {
+        const size_t offset = book.size();
+        book.resize(std::min(expected.bytes.size(), offset + messages.unread()));
+        TEST_ASSERT_EQUAL_size_t(book.size() - offset, messages.take(book.data() + offset, book.size() - offset));
+        if (book.size() == expected.bytes.size()) {
+          TEST_ASSERT_EQUAL_MEMORY(expected.bytes.data(), book.data(), book.size());
+          result.binaryBytes += book.size();
+          book.clear();
+          next++;
+        }
+        continue;
+      }
+    } else {
+      std::string_view message;
+      const auto found = messages.next(message);
+      const std::string_view json = std::string_view(expected.bytes).substr(expected.bytes.find('['));
+      if (found == CalibreMessageBuffer::Result::MESSAGE) {
+        TEST_ASSERT_TRUE(json == message);
+        result.messages++;
+        next++;
+        continue;
+      }
+      if (found == CalibreMessageBuffer::Result::TOO_LARGE) {
+        TEST_ASSERT_TRUE(json.size() > bufferSize);
+        TEST_ASSERT_TRUE(json.substr(1, json.find(',') - 1) == message);
+        result.tooLarge++;
+        next++;
+        continue;
+      }
+    }
+
+    TEST_ASSERT_FALSE(endOfFile);
+    size_t space;
+    uint8_t* dest = messages.prepareWrite(segmentSize(random), &space);
+    TEST_ASSERT_GREATER_THAN(0, space);
+    const int bytesRead = file.read(dest, space);
+    endOfFile = bytesRead <= 0;
+    messages.commitWrite(std::max(bytesRead, 0));
+  }
+  result.micros = micros() - start;
+  result.allocations = HostHeap::allocations();
+
+  std::string_view message;
+  TEST_ASSERT_TRUE(messages.next(message) == CalibreMessageBuffer::Result::NONE);
+  TEST_ASSERT_EQUAL_size_t(0, messages.unread());
+  file.close();
+  return result;
+}
+
+// How the activity framed messages before, appending to a std::string and cutting each message off with substr
+Replay replayWithString(const size_t sessionSize) {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", SESSION_PATH, file));
+  std::mt19937 random(15);
+  std::uniform_int_distribution<size_t> segmentSize(1, MAX_SEGMENT_SIZE);
+  char segment[MAX_SEGMENT_SIZE];
+  std::string recvBuffer;
+  size_t binaryRemaining = 0;
+  size_t consumed = 0;
+
+  Replay result;
+  HostHeap::reset();
+  const unsigned long start = micros();
+  while (consumed < sessionSize) {
+    const int bytesRead = file.read(segment, segmentSize(random));
+    TEST_ASSERT_GREATER_THAN(0, bytesRead);
+    recvBuffer.append(segment, bytesRead);
+    while (!recvBuffer.empty()) {
+      if (binaryRemaining > 0) {
+        const size_t toWrite = std::min(recvBuffer.size(), binaryRemaining);
+        binaryRemaining -= toWrite;
+        consumed += toWrite;
+        recvBuffer = recvBuffer.substr(toWrite);
+        continue;
+      }
+      const size_t bracketPos = recvBuffer.find('[');
+      if (bracketPos == std::string::npos) {
+        break;
+      }
+      const size_t totalNeeded = bracketPos + std::stoul(recvBuffer.substr(0, bracketPos));
+      if (recvBuffer.size() < totalNeeded) {
+        break;
+      }
+      const std::string message = recvBuffer.substr(bracketPos, totalNeeded - bracketPos);
+      recvBuffer = recvBuffer.substr(totalNeeded);
+      consumed += totalNeeded;
+      result.messages++;
+      if (message.compare(0, 3, "[8,") == 0) {
+        binaryRemaining = std::stoul(message.substr(message.find("\"length\":") + 9));
+      }
+    }
+  }
+  result.micros = micros() - start;
+  result.allocations = HostHeap::allocations();
+  file.close();
+  return result;
+}
+
+void feed(CalibreMessageBuffer& messages, const std::string& bytes) {
+  size_t space;
+  uint8_t* dest = messages.prepareWrite(bytes.size(), &space);
+  TEST_ASSERT_EQUAL_size_t(bytes.size(), space);
+  memcpy(dest, bytes.data(), space);
+  messages.commitWrite(space);
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_session_replay() {
+  const auto session = makeSession(3000);
+  const size_t sessionSize = writeSession(session);
+  const Replay replayed = replay(session, BUFFER_SIZE);
+  TEST_ASSERT_EQUAL_size_t(4, replayed.tooLarge);
+  TEST_ASSERT_EQUAL_size_t(8, replayed.binaryBytes / (200 * 1024));
+  TEST_ASSERT_EQUAL_size_t(session.size() - 8 - 4, replayed.messages);
+
+  char line[192];
+  snprintf(line, sizeof(line), "%zu byte session, %zu messages: %.1f MB/s", sessionSize, replayed.messages,
+           sessionSize / (replayed.micros > 0 ? replayed.micros : 1.0));
+  TEST_MESSAGE(line);
+  if (!HostHeap::available()) {
+    return;
+  }
+  TEST_ASSERT_EQUAL_size_t(0, replayed.allocations);
+
+  // The oversized messages are left out, the string version would hold each one whole
+  std::vector<Event> withoutOversized;
+  std::copy_if(session.begin(), session.end(), std::back_inserter(withoutOversized),
+               [](const Event& event) { return event.binary || event.bytes.size() < BUFFER_SIZE; });
+  const size_t fittingSize = writeSession(withoutOversized);
+  const Replay inPlace = replay(withoutOversized, BUFFER_SIZE);
+  const Replay withString = replayWithString(fittingSize);
+  TEST_ASSERT_EQUAL_size_t(inPlace.messages, withString.messages);
+  snprintf(line, sizeof(line), "In place: %zu allocations, %lu us. std::string with substr: %zu allocations, %lu us",
+           inPlace.allocations, inPlace.micros, withString.allocations, withString.micros);
+  TEST_MESSAGE(line);
+}
+
+// The smallest buffer the activity falls back to still carries the session, with more messages dropped as too large
+void test_session_replay_with_minimum_buffer() {
+  const auto session = makeSession(600);
+  writeSession(session);
+  const Replay replayed = replay(session, 16 * 1024);
+  TEST_ASSERT_EQUAL_size_t(1, replayed.tooLarge);
+  TEST_ASSERT_EQUAL_size_t(2 * (200 * 1024) + 123 + 523, replayed.binaryBytes);
+}
+
+// An oversized message is answered from its opcode once, even when it arrives a byte at a time
+void test_too_large_reports_opcode_once() {
+  CalibreMessageBuffer messages;
+  TEST_ASSERT_TRUE(messages.allocate(64, 64));
+  const std::string bytes = frame(12, "{\"comments\":\"" + std::string(500, 'x') + "\"}") + frame(3, "{}");
+  std::string_view message;
+  int tooLarge = 0;
+  int found = 0;
+  for (const char c : bytes) {
+    feed(messages, std::string(1, c));
+    switch (messages.next(message)) {
+      case CalibreMessageBuffer::Result::TOO_LARGE:
+        TEST_ASSERT_TRUE(message == "12");
+        tooLarge++;
+        break;
+      case CalibreMessageBuffer::Result::MESSAGE:
+        TEST_ASSERT_TRUE(message == "[3,{}]");
+        found++;
+        break;
+      default:
+        break;
+    }
+  }
+  TEST_ASSERT_EQUAL(1, tooLarge);
+  TEST_ASSERT_EQUAL(1, found);
+}
+
+// Unread data without a '[' in it is dropped once it could no longer be a length prefix
+void test_drops_data_without_message_start() {
+  CalibreMessageBuffer messages;
+  TEST_ASSERT_TRUE(messages.allocate(4096, 4096));
+  std::string_view message;
+  feed(messages, std::string(1000, '7'));
+  TEST_ASSERT_TRUE(messages.next(message) == CalibreMessageBuffer::Result::NONE);
+  TEST_ASSERT_EQUAL_size_t(1000, messages.unread());
+  feed(messages, "7");
+  TEST_ASSERT_TRUE(messages.next(message) == CalibreMessageBuffer::Result::NONE);
+  TEST_ASSERT_EQUAL_size_t(0, messages.unread());
+
+  feed(messages, frame(3, "{}"));
+  TEST_ASSERT_TRUE(messages.next(message) == CalibreMessageBuffer::Result::MESSAGE);
+  TEST_ASSERT_TRUE(message == "[3,{}]");
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_session_replay);
+  RUN_TEST(test_session_replay_with_minimum_buffer);
+  RUN_TEST(test_too_large_reports_opcode_once);
+  RUN_TEST(test_drops_data_without_message_start);
+  return UNITY_END();
+}
@@ -0,0 +1,182 @@
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <unity.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Epub/BookMetadataCache.h"
+#include "Epub/parsers/ContentOpfParser.h"
+
+// The spine is resolved through a hash index over the manifest ids, with a scan of the manifest as the fallback. Both
+// must give the spine the ids name in the manifest, in spine order.
+namespace {
+constexpr char CACHE_PATH[] = "/cache";
+constexpr char BASE_PATH[] = "OEBPS/";
+
+struct Item {
+  std::string id;
+  std::string href;
+};
+
+// Same hash and table size as the parser, to pick ids that share a slot
+uint32_t hashItemId(const std::string& itemId) {
+  uint32_t hash = 2166136261u;
+  for (const char c : itemId) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+uint32_t slotCountFor(const uint32_t itemCount) {
+  uint32_t slotCount = 1;
+  while (slotCount < itemCount + itemCount / 2) {
+    slotCount <<= 1;
+  }
+  return slotCount;
+}
+
+std::vector<Item> numberedItems(const int count) {
+  std::vector<Item> items;
+  for (int i = 0; i < count; i++) {
+    items.push_back({"item" + std::to_string(i), "text/chapter" + std::to_string(i) + ".xhtml"});
+  }
+  return items;
+}
+
+// Spine order differs from manifest order, and an idref the manifest does not have is dropped
+std::vector<std::string> spineIdsFor(const std::vector<Item>& items) {
+  std::vector<std::string> ids;
+  for (size_t i = 0; i < items.size(); i++) {
+    ids.push_back(items[(i * 7 + 3) % items.size()].id);
+  }
+  ids.insert(ids.begin() + ids.size() / 2, "missing");
+  return ids;
+}
+
+std::string buildOpf(const std::vector<Item>& items, const std::vector<std::string>& spineIds) {
+  std::string opf = "<?xml version=\"1.0\"?>\n<package xmlns=\"http://www.idpf.org/2007/opf\" version=\"2.0\">\n";
+  opf += "<metadata xmlns:dc=\"http://purl.org/dc/elements/1.1/\"><dc:title>Spine</dc:title></metadata>\n<manifest>\n";
+  for (const auto& item : items) {
+    opf += "<item id=\"" + item.id + "\" href=\"" + item.href + "\" media-type=\"application/xhtml+xml\"/>\n";
+  }
+  opf += "</manifest>\n<spine>\n";
+  for (const auto& id : spineIds) {
+    opf += "<itemref idref=\"" + id + "\"/>\n";
+  }
+  return opf + "</spine>\n</package>\n";
+}
+
+// What a scan of the manifest gives for each idref
+std::vector<std::string> linearSpine(const std::vector<Item>& items, const std::vector<std::string>& spineIds) {
+  std::vector<std::string> hrefs;
+  for (const auto& id : spineIds) {
+    for (const auto& item : items) {
+      if (item.id == id) {
+        hrefs.push_back(BASE_PATH + item.href);
+        break;
+      }
+    }
+  }
+  return hrefs;
+}
+
+std::vector<std::string> parseSpine(const std::string& opf) {
+  BookMetadataCache cache(CACHE_PATH);
+  TEST_ASSERT_TRUE(cache.beginWrite());
+  TEST_ASSERT_TRUE(cache.beginContentOpfPass());
+  {
+    const std::string cachePath = CACHE_PATH;
+    const std::string basePath = BASE_PATH;
+    ContentOpfParser parser(cachePath, basePath, opf.size(), &cache);
+    TEST_ASSERT_TRUE(parser.setup());
+    // Odd sized writes, as the zip reader hands them over
+    for (size_t offset = 0; offset < opf.size(); offset += 700) {
+      const size_t size = opf.size() - offset < 700 ? opf.size() - offset : 700;
+      TEST_ASSERT_EQUAL_size_t(size, parser.write(reinterpret_cast<const uint8_t*>(opf.data()) + offset, size));
+    }
+  }
+  TEST_ASSERT_TRUE(cache.endContentOpfPass());
+
+  std::vector<std::string> hrefs;
+  FsFile spine;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", std::string(CACHE_PATH) + "/spine.bin.tmp", spine));
+  while (spine.available()) {
+    std::string href;
+    size_t cumulativeSize;
+    int16_t tocIndex;
+    serialization::readString(spine, href);
+    serialization::readPod(spine, cumulativeSize);
+    serialization::readPod(spine, tocIndex);
+    hrefs.push_back(href);
+  }
+  spine.close();
+  TEST_ASSERT_TRUE(cache.cleanupTmpFiles());
+  return hrefs;
+}
+
+void assertSpineMatchesScan(const std::vector<Item>& items) {
+  const auto spineIds = spineIdsFor(items);
+  const auto expected = linearSpine(items, spineIds);
+  const auto actual = parseSpine(buildOpf(items, spineIds));
+  TEST_ASSERT_EQUAL_size_t(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    TEST_ASSERT_EQUAL_STRING(expected[i].c_str(), actual[i].c_str());
+  }
+}
+}  // namespace
+
+void setUp() { SdMan.mkdir(CACHE_PATH); }
+
+void tearDown() {}
+
+void test_hashed_spine_matches_scan() {
+  for (const int count : {10, 11, 12, 13, 21, 64, 100, 257, 1000}) {
+    assertSpineMatchesScan(numberedItems(count));
+  }
+}
+
+// Ids sharing the first slot and the last, so probes step past taken slots and wrap around the end of the table
+void test_colliding_ids_probe_past_each_other() {
+  constexpr int count = 40;
+  const uint32_t slotCount = slotCountFor(count);
+  std::map<uint32_t, std::vector<std::string>> idsBySlot;
+  for (int i = 0; idsBySlot[0].size() < 4 || idsBySlot[slotCount - 1].size() < 4; i++) {
+    const std::string id = "c" + std::to_string(i);
+    idsBySlot[hashItemId(id) & (slotCount - 1)].push_back(id);
+  }
+
+  std::vector<Item> items;
+  for (const uint32_t slot : {slotCount - 1, 0u}) {
+    for (size_t i = 0; i < 4; i++) {
+      const auto& id = idsBySlot[slot][i];
+      items.push_back({id, "text/" + id + ".xhtml"});
+    }
+  }
+  for (int i = 0; items.size() < count; i++) {
+    items.push_back({"item" + std::to_string(i), "text/chapter" + std::to_string(i) + ".xhtml"});
+  }
+  TEST_ASSERT_EQUAL(slotCount, slotCountFor(items.size()));
+  assertSpineMatchesScan(items);
+}
+
+// A directory in the way of the index file leaves the parser scanning the manifest
+void test_scan_when_index_cannot_be_written() {
+  const std::string indexPath = std::string(CACHE_PATH) + "/.items.idx";
+  TEST_ASSERT_TRUE(SdMan.mkdir(indexPath.c_str()));
+  for (const int count : {10, 100}) {
+    assertSpineMatchesScan(numberedItems(count));
+  }
+  TEST_ASSERT_TRUE(SdMan.rmdir(indexPath.c_str()));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_hashed_spine_matches_scan);
+  RUN_TEST(test_colliding_ids_probe_past_each_other);
+  RUN_TEST(test_scan_when_index_cannot_be_written);
+  return UNITY_END();
+}
@@ -0,0 +1,124 @@
+#include <DitheredImageWriter.h>
+#include <TestArchives.h>
+#include <unity.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+uint16_t read16(const std::string& data, const size_t offset) {
+  return static_cast<uint8_t>(data[offset]) | static_cast<uint8_t>(data[offset + 1]) << 8;
+}
+
+uint32_t read32(const std::string& data, const size_t offset) {
+  return static_cast<uint8_t>(data[offset]) | static_cast<uint8_t>(data[offset + 1]) << 8 |
+         static_cast<uint8_t>(data[offset + 2]) << 16 | static_cast<uint32_t>(static_cast<uint8_t>(data[offset + 3]))
+                                                            << 24;
+}
+
+std::string convertUniform(const int width, const int height, const uint8_t gray, const bool writeBmp) {
+  TestArchives::MemoryPrint out;
+  DitheredImageWriter writer(out, width, height, width, height, true, writeBmp);
+  TEST_ASSERT_TRUE(writer.begin());
+  const std::vector<uint8_t> row(width, gray);
+  for (int y = 0; y < height; y++) {
+    writer.writeSourceRow(row.data());
+  }
+  TEST_ASSERT_TRUE(writer.finish());
+  return out.data;
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_output_size_keeps_aspect_ratio() {
+  int width;
+  int height;
+  DitheredImageWriter::getOutputSize(400, 300, 480, 800, true, &width, &height);
+  TEST_ASSERT_EQUAL(400, width);
+  TEST_ASSERT_EQUAL(300, height);
+
+  // Inline images fit inside the box
+  DitheredImageWriter::getOutputSize(1000, 500, 480, 800, true, &width, &height);
+  TEST_ASSERT_EQUAL(480, width);
+  TEST_ASSERT_EQUAL(240, height);
+
+  // Covers fill it and are cropped later
+  DitheredImageWriter::getOutputSize(1000, 1000, 480, 800, false, &width, &height);
+  TEST_ASSERT_EQUAL(800, width);
+  TEST_ASSERT_EQUAL(800, height);
+}
+
+void test_bmp_header_matches_rows() {
+  const std::string bmp = convertUniform(13, 7, 0x80, true);
+  const size_t bytesPerRow = (13 * 2 + 31) / 32 * 4;
+  TEST_ASSERT_EQUAL('B', bmp[0]);
+  TEST_ASSERT_EQUAL('M', bmp[1]);
+  TEST_ASSERT_EQUAL_size_t(bmp.size(), read32(bmp, 2));
+  TEST_ASSERT_EQUAL(70, read32(bmp, 10));
+  TEST_ASSERT_EQUAL(13, read32(bmp, 18));
+  TEST_ASSERT_EQUAL(-7, static_cast<int32_t>(read32(bmp, 22)));
+  TEST_ASSERT_EQUAL_size_t(70 + bytesPerRow * 7, bmp.size());
+}
+
+void test_bare_rows_use_font_levels() {
+  // Width and height, then 0 = white to 3 = black, four pixels to a byte and no row padding
+  constexpr size_t headerSize = 4;
+  const std::string white = convertUniform(10, 3, 0xFF, false);
+  const std::string black = convertUniform(10, 3, 0x00, false);
+  TEST_ASSERT_EQUAL_size_t(headerSize + 3 * 3, white.size());
+  TEST_ASSERT_EQUAL_size_t(headerSize + 3 * 3, black.size());
+  TEST_ASSERT_EQUAL(10, read16(white, 0));
+  TEST_ASSERT_EQUAL(3, read16(white, 2));
+  for (size_t i = 0; i < 3 * 3; i++) {
+    const uint8_t mask = i % 3 == 2 ? 0xF0 : 0xFF;
+    TEST_ASSERT_EQUAL_UINT8(0x00, static_cast<uint8_t>(white[headerSize + i]) & mask);
+    TEST_ASSERT_EQUAL_UINT8(0xFF & mask, static_cast<uint8_t>(black[headerSize + i]) & mask);
+  }
+}
+
+void test_downscaled_rows_are_written_once() {
+  TestArchives::MemoryPrint out;
+  DitheredImageWriter writer(out, 64, 64, 16, 16, true, false);
+  TEST_ASSERT_TRUE(writer.begin());
+  TEST_ASSERT_EQUAL(16, writer.getWidth());
+  TEST_ASSERT_EQUAL(16, writer.getHeight());
+  const std::vector<uint8_t> row(64, 0x00);
+  // Rows past the source height are ignored
+  for (int y = 0; y < 80; y++) {
+    writer.writeSourceRow(row.data());
+  }
+  TEST_ASSERT_TRUE(writer.finish());
+  TEST_ASSERT_EQUAL_size_t(4 + 16 * 4, out.data.size());
+}
+
+// The decoders stop on the first refused row, and the partial output is never reported as an image
+void test_cancel_stops_between_rows() {
+  TestArchives::MemoryPrint out;
+  DitheredImageWriter writer(out, 64, 64, 64, 64, true, false);
+  int checks = 0;
+  writer.setCancelCheck([&checks] { return ++checks > 10; });
+  TEST_ASSERT_TRUE(writer.begin());
+  const std::vector<uint8_t> row(64, 0x80);
+  for (int y = 0; y < 10; y++) {
+    TEST_ASSERT_TRUE(writer.writeSourceRow(row.data()));
+  }
+  TEST_ASSERT_FALSE(writer.writeSourceRow(row.data()));
+  // Stays cancelled without asking again
+  TEST_ASSERT_FALSE(writer.writeSourceRow(row.data()));
+  TEST_ASSERT_EQUAL(11, checks);
+  TEST_ASSERT_FALSE(writer.finish());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_output_size_keeps_aspect_ratio);
+  RUN_TEST(test_bmp_header_matches_rows);
+  RUN_TEST(test_bare_rows_use_font_levels);
+  RUN_TEST(test_downscaled_rows_are_written_once);
+  RUN_TEST(test_cancel_stops_between_rows);
+  return UNITY_END();
+}
@@ -0,0 +1,226 @@
+#include <DoubleBufferedFileWriter.h>
+#include <HostHeap.h>
+#include <SDCardManager.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Receives a book from a loopback TCP peer onto a slow SD card stand-in, the way CalibreWirelessActivity does, once
+// writing every read straight to the file and once through the writer's two buffers
+namespace {
+constexpr char BOOK_PATH[] = "/book.epub";
+constexpr size_t BOOK_SIZE = 512 * 1024;
+constexpr size_t TCP_SEGMENT_SIZE = 1460;
+// About what the device gets over WiFi
+constexpr size_t NETWORK_BYTES_PER_SECOND = 1024 * 1024;
+// A write command costs the card about 1.5ms on top of 1ms per KB, so small writes are dominated by the overhead
+constexpr unsigned long SD_MICROS_PER_WRITE = 1500;
+constexpr unsigned long SD_MICROS_PER_KILOBYTE = 1000;
+// A small receive window as on the device, so the peer waits for the reader instead of the kernel buffering the book
+constexpr int SOCKET_BUFFER_SIZE = 4096;
+
+std::vector<uint8_t> makeBook() {
+  std::vector<uint8_t> book(BOOK_SIZE);
+  std::mt19937 random(15);
+  for (auto& byte : book) {
+    byte = static_cast<uint8_t>(random());
+  }
+  return book;
+}
+
+// Calibre's side: sends the book in TCP segments, no faster than the network carries them
+void sendBook(const int listener, const std::vector<uint8_t>& book) {
+  const int peer = accept(listener, nullptr, nullptr);
+  TEST_ASSERT_GREATER_OR_EQUAL(0, peer);
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t sent = 0; sent < book.size();) {
+    const size_t size = std::min(TCP_SEGMENT_SIZE, book.size() - sent);
+    const ssize_t result = send(peer, book.data() + sent, size, 0);
+    TEST_ASSERT_GREATER_THAN(0, result);
+    sent += result;
+    std::this_thread::sleep_until(start + std::chrono::microseconds(sent * 1000000 / NETWORK_BYTES_PER_SECOND));
+  }
+  close(peer);
+}
+
+// Connects to a peer thread sending the book over loopback TCP
+int connectToPeer(std::thread& peer, const std::vector<uint8_t>& book) {
+  const int listener = socket(AF_INET, SOCK_STREAM, 0);
+  TEST_ASSERT_GREATER_OR_EQUAL(0, listener);
+  setsockopt(listener, SOL_SOCKET, SO_SNDBUF, &SOCKET_BUFFER_SIZE, sizeof(SOCKET_BUFFER_SIZE));
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addressSize = sizeof(address);
+  TEST_ASSERT_EQUAL(0, bind(listener, reinterpret_cast<sockaddr*>(&address), addressSize));
+  TEST_ASSERT_EQUAL(0, listen(listener, 1));
+  TEST_ASSERT_EQUAL(0, getsockname(listener, reinterpret_cast<sockaddr*>(&address), &addressSize));
+  peer = std::thread([listener, &book] {
+    sendBook(listener, book);
+    close(listener);
+  });
+
+  const int client = socket(AF_INET, SOCK_STREAM, 0);
+  setsockopt(client, SOL_SOCKET, SO_RCVBUF, &SOCKET_BUFFER_SIZE, sizeof(SOCKET_BUFFER_SIZE));
+  TEST_ASSERT_EQUAL(0, connect(client, reinterpret_cast<sockaddr*>(&address), addressSize));
+  return client;
+}
+
+// What receiveBinaryData did before, writing each read of up to chunkSize bytes before reading on
+size_t receiveDirect(const int client, FsFile& file, const size_t chunkSize) {
+  std::vector<uint8_t> chunk(chunkSize);
+  size_t received = 0;
+  while (received < BOOK_SIZE) {
+    const ssize_t result = recv(client, chunk.data(), std::min(chunkSize, BOOK_SIZE - received), 0);
+    if (result <= 0) {
+      break;
+    }
+    TEST_ASSERT_EQUAL_size_t(result, file.write(chunk.data(), result));
+    received += result;
+  }
+  return received;
+}
+
+size_t receiveDoubleBuffered(const int client, FsFile& file, const size_t bufferSize) {
+  DoubleBufferedFileWriter writer;
+  TEST_ASSERT_TRUE(writer.begin(file, bufferSize));
+  size_t received = 0;
+  while (received < BOOK_SIZE) {
+    size_t room;
+    uint8_t* buffer = writer.reserve(&room);
+    TEST_ASSERT_NOT_NULL(buffer);
+    const ssize_t result = recv(client, buffer, std::min(room, BOOK_SIZE - received), 0);
+    if (result <= 0) {
+      break;
+    }
+    writer.commit(result);
+    received += result;
+  }
+  TEST_ASSERT_TRUE(writer.end());
+  return received;
+}
+
+// Receives the book with the given buffer size and returns the rate in KB/s
+size_t transferRate(const std::vector<uint8_t>& book, const size_t bufferSize, const bool doubleBuffered) {
+  std::thread peer;
+  const int client = connectToPeer(peer, book);
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", BOOK_PATH, file));
+
+  const auto start = std::chrono::steady_clock::now();
+  const size_t received = doubleBuffered ? receiveDoubleBuffered(client, file, bufferSize)
+                                         : receiveDirect(client, file, bufferSize);
+  const auto micros =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  file.close();
+  close(client);
+  peer.join();
+
+  TEST_ASSERT_EQUAL_size_t(BOOK_SIZE, received);
+  std::ifstream written(SdMan.hostPath(BOOK_PATH), std::ios::binary);
+  const std::vector<uint8_t> contents((std::istreambuf_iterator<char>(written)), std::istreambuf_iterator<char>());
+  TEST_ASSERT_TRUE(contents == book);
+  return received * 1000000 / 1024 / micros;
+}
+}  // namespace
+
+void setUp() { SdMan.setWriteLatency(SD_MICROS_PER_WRITE, SD_MICROS_PER_KILOBYTE); }
+
+void tearDown() {
+  SdMan.setWriteLatency(0, 0);
+  SdMan.setWriteBudget(-1);
+}
+
+void test_transfer_rate_per_buffer_size() {
+  const auto book = makeBook();
+  const size_t direct = transferRate(book, 1024, false);
+  char line[128];
+  snprintf(line, sizeof(line), "Direct 1KB writes: %zu KB/s", direct);
+  TEST_MESSAGE(line);
+  snprintf(line, sizeof(line), "Direct 8KB writes: %zu KB/s", transferRate(book, 8 * 1024, false));
+  TEST_MESSAGE(line);
+
+  size_t doubleBuffered8k = 0;
+  for (const size_t bufferSize : {4 * 1024, 8 * 1024, 16 * 1024}) {
+    const size_t rate = transferRate(book, bufferSize, true);
+    snprintf(line, sizeof(line), "Double buffered %zuKB: %zu KB/s", bufferSize / 1024, rate);
+    TEST_MESSAGE(line);
+    doubleBuffered8k = bufferSize == 8 * 1024 ? rate : doubleBuffered8k;
+  }
+  TEST_ASSERT_GREATER_THAN(direct * 3 / 2, doubleBuffered8k);
+}
+
+// A card that fills up fails the transfer rather than dropping data silently
+void test_write_failure_is_reported() {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", BOOK_PATH, file));
+  SdMan.setWriteLatency(0, 0);
+  SdMan.setWriteBudget(20000);
+
+  DoubleBufferedFileWriter writer;
+  TEST_ASSERT_TRUE(writer.begin(file, 4096));
+  size_t offered = 0;
+  size_t room;
+  uint8_t* buffer;
+  while ((buffer = writer.reserve(&room)) != nullptr) {
+    TEST_ASSERT_LESS_THAN(BOOK_SIZE, offered);
+    memset(buffer, 'b', room);
+    writer.commit(room);
+    offered += room;
+  }
+  TEST_ASSERT_FALSE(writer.end());
+  TEST_ASSERT_FALSE(writer.active());
+  file.close();
+}
+
+void test_begin_frees_everything_on_failure() {
+  if (!HostHeap::available()) {
+    TEST_IGNORE_MESSAGE("Needs HostHeap to fail allocations");
+  }
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", BOOK_PATH, file));
+  HostHeap::reset();
+  HostHeap::failAllocations(12345);
+  DoubleBufferedFileWriter writer;
+  TEST_ASSERT_FALSE(writer.begin(file, 12345));
+  TEST_ASSERT_FALSE(writer.active());
+  TEST_ASSERT_EQUAL_size_t(0, HostHeap::heldBytes());
+  file.close();
+}
+
+// The last, partly filled buffer is written out by end()
+void test_end_writes_partial_buffer() {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", BOOK_PATH, file));
+  DoubleBufferedFileWriter writer;
+  TEST_ASSERT_TRUE(writer.begin(file, 4096));
+  size_t room;
+  memset(writer.reserve(&room), 'c', 100);
+  writer.commit(100);
+  TEST_ASSERT_TRUE(writer.end());
+  file.close();
+  FsFile written;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", BOOK_PATH, written));
+  TEST_ASSERT_EQUAL(100, written.size());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_transfer_rate_per_buffer_size);
+  RUN_TEST(test_write_failure_is_reported);
+  RUN_TEST(test_begin_frees_everything_on_failure);
+  RUN_TEST(test_end_writes_partial_buffer);
+  return UNITY_END();
+}
@@ -0,0 +1,251 @@
+#include <EpdFont.h>
+#include <HardwareSerial.h>
+#include <builtinFonts/all.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+const EpdFontData* const kernedFonts[] = {&bookerly_14_regular, &notosans_14_italic, &opendyslexic_8_bolditalic};
+
+struct Face {
+  const char* name;
+  const EpdFontData* data;
+};
+const Face builtinFaces[] = {
+    {"bookerly_12_bold", &bookerly_12_bold},
+    {"bookerly_12_bolditalic", &bookerly_12_bolditalic},
+    {"bookerly_12_italic", &bookerly_12_italic},
+    {"bookerly_12_regular", &bookerly_12_regular},
+    {"bookerly_14_bold", &bookerly_14_bold},
+    {"bookerly_14_bolditalic", &bookerly_14_bolditalic},
+    {"bookerly_14_italic", &bookerly_14_italic},
+    {"bookerly_14_regular", &bookerly_14_regular},
+    {"bookerly_16_bold", &bookerly_16_bold},
+    {"bookerly_16_bolditalic", &bookerly_16_bolditalic},
+    {"bookerly_16_italic", &bookerly_16_italic},
+    {"bookerly_16_regular", &bookerly_16_regular},
+    {"bookerly_18_bold", &bookerly_18_bold},
+    {"bookerly_18_bolditalic", &bookerly_18_bolditalic},
+    {"bookerly_18_italic", &bookerly_18_italic},
+    {"bookerly_18_regular", &bookerly_18_regular},
+    {"notosans_12_bold", &notosans_12_bold},
+    {"notosans_12_bolditalic", &notosans_12_bolditalic},
+    {"notosans_12_italic", &notosans_12_italic},
+    {"notosans_12_regular", &notosans_12_regular},
+    {"notosans_14_bold", &notosans_14_bold},
+    {"notosans_14_bolditalic", &notosans_14_bolditalic},
+    {"notosans_14_italic", &notosans_14_italic},
+    {"notosans_14_regular", &notosans_14_regular},
+    {"notosans_16_bold", &notosans_16_bold},
+    {"notosans_16_bolditalic", &notosans_16_bolditalic},
+    {"notosans_16_italic", &notosans_16_italic},
+    {"notosans_16_regular", &notosans_16_regular},
+    {"notosans_18_bold", &notosans_18_bold},
+    {"notosans_18_bolditalic", &notosans_18_bolditalic},
+    {"notosans_18_italic", &notosans_18_italic},
+    {"notosans_18_regular", &notosans_18_regular},
+    {"notosans_8_regular", &notosans_8_regular},
+    {"opendyslexic_10_bold", &opendyslexic_10_bold},
+    {"opendyslexic_10_bolditalic", &opendyslexic_10_bolditalic},
+    {"opendyslexic_10_italic", &opendyslexic_10_italic},
+    {"opendyslexic_10_regular", &opendyslexic_10_regular},
+    {"opendyslexic_12_bold", &opendyslexic_12_bold},
+    {"opendyslexic_12_bolditalic", &opendyslexic_12_bolditalic},
+    {"opendyslexic_12_italic", &opendyslexic_12_italic},
+    {"opendyslexic_12_regular", &opendyslexic_12_regular},
+    {"opendyslexic_14_bold", &opendyslexic_14_bold},
+    {"opendyslexic_14_bolditalic", &opendyslexic_14_bolditalic},
+    {"opendyslexic_14_italic", &opendyslexic_14_italic},
+    {"opendyslexic_14_regular", &opendyslexic_14_regular},
+    {"opendyslexic_8_bold", &opendyslexic_8_bold},
+    {"opendyslexic_8_bolditalic", &opendyslexic_8_bolditalic},
+    {"opendyslexic_8_italic", &opendyslexic_8_italic},
+    {"opendyslexic_8_regular", &opendyslexic_8_regular},
+    {"ubuntu_10_bold", &ubuntu_10_bold},
+    {"ubuntu_10_regular", &ubuntu_10_regular},
+    {"ubuntu_12_bold", &ubuntu_12_bold},
+    {"ubuntu_12_regular", &ubuntu_12_regular},
+};
+
+// A paragraph of ordinary English prose, with the capitals and punctuation that most pairs involve
+constexpr char LAYOUT_TEXT[] =
+    "\"Very well,\" said Tom, watching the yellow lanterns of the village. \"We'll take the AVENUE by the water, "
+    "then. You've lately told me that Yvonne, Walter and Paul were away.\" WAVY trees, a ferry, Tuesday; P.T. Barnum's "
+    "\"LAVA\" and Ty Ford's wagon. Everyone took coffee, and by seven o'clock they were all asleep.";
+
+uint32_t glyphCount(const EpdFontData* data) {
+  const EpdUnicodeInterval& last = data->intervals[data->intervalCount - 1];
+  return last.offset + last.last - last.first + 1;
+}
+
+// Kerning looked up by walking every pair of the left class, to check the binary search against
+int kerningByScan(const EpdFontData* data, const EpdGlyph* left, const EpdGlyph* right) {
+  const uint8_t leftClass = data->kernLeftClasses[left - data->glyph];
+  const uint8_t rightClass = data->kernRightClasses[right - data->glyph];
+  if (leftClass == 0 || rightClass == 0) {
+    return 0;
+  }
+  for (int i = data->kernPairOffsets[leftClass - 1]; i < data->kernPairOffsets[leftClass]; i++) {
+    if (data->kernPairs[i].rightClass == rightClass) {
+      return data->kernPairs[i].adjustX;
+    }
+  }
+  return 0;
+}
+uint8_t leftClassCount(const EpdFontData* data) {
+  return *std::max_element(data->kernLeftClasses, data->kernLeftClasses + glyphCount(data));
+}
+
+// Flash taken by the kerning tables: both class arrays, the pair offsets and the pairs
+size_t kerningTableBytes(const EpdFontData* data) {
+  if (!data->kernPairs) {
+    return 0;
+  }
+  const uint8_t leftClasses = leftClassCount(data);
+  return 2 * glyphCount(data) + (leftClasses + 1) * sizeof(uint16_t) +
+         data->kernPairOffsets[leftClasses] * sizeof(EpdKernPair);
+}
+
+// Measures every word of the paragraph as layout does, returning nanoseconds per glyph
+double measureWords(const EpdFont& font, const std::vector<std::string>& words, const int repeats) {
+  size_t glyphs = 0;
+  int width;
+  int height;
+  int sink = 0;
+  const unsigned long start = micros();
+  for (int r = 0; r < repeats; r++) {
+    for (const auto& word : words) {
+      font.getTextDimensions(word.c_str(), &width, &height);
+      sink += width;
+      glyphs += word.size();
+    }
+  }
+  const unsigned long elapsed = micros() - start;
+  TEST_ASSERT_GREATER_THAN(0, sink);
+  return elapsed * 1000.0 / glyphs;
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_get_glyph_matches_intervals() {
+  for (const EpdFontData* data : kernedFonts) {
+    const EpdFont font(data);
+    for (uint32_t i = 0; i < data->intervalCount; i++) {
+      const EpdUnicodeInterval& interval = data->intervals[i];
+      for (uint32_t cp = interval.first; cp <= interval.last; cp++) {
+        TEST_ASSERT_TRUE(font.getGlyph(cp) == &data->glyph[interval.offset + cp - interval.first]);
+      }
+    }
+    TEST_ASSERT_NULL(font.getGlyph(0x10FFFF));
+  }
+}
+
+void test_kerning_matches_pair_tables() {
+  for (const EpdFontData* data : kernedFonts) {
+    TEST_ASSERT_NOT_NULL(data->kernPairs);
+    const EpdFont font(data);
+    const uint32_t count = glyphCount(data);
+    for (uint32_t left = 0; left < count; left++) {
+      for (uint32_t right = 0; right < count; right += 3) {
+        const EpdGlyph* leftGlyph = &data->glyph[left];
+        const EpdGlyph* rightGlyph = &data->glyph[right];
+        TEST_ASSERT_EQUAL_INT(kerningByScan(data, leftGlyph, rightGlyph), font.getKerning(leftGlyph, rightGlyph));
+      }
+    }
+  }
+}
+
+void test_kerning_tightens_av() {
+  const EpdFont font(&bookerly_14_regular);
+  TEST_ASSERT_LESS_THAN(0, font.getKerning(font.getGlyph('A'), font.getGlyph('V')));
+  TEST_ASSERT_EQUAL_INT(0, font.getKerning(nullptr, font.getGlyph('V')));
+
+  int kernedWidth;
+  int height;
+  font.getTextDimensions("AV", &kernedWidth, &height);
+  int spacedWidth;
+  font.getTextDimensions("A V", &spacedWidth, &height);
+  TEST_ASSERT_LESS_THAN(spacedWidth - font.getGlyph(' ')->advanceX, kernedWidth);
+}
+
+void test_spaces_never_kern() {
+  for (const EpdFontData* data : kernedFonts) {
+    const EpdFont font(data);
+    const EpdGlyph* space = font.getGlyph(' ');
+    for (uint32_t i = 0; i < glyphCount(data); i++) {
+      TEST_ASSERT_EQUAL_INT(0, font.getKerning(space, &data->glyph[i]));
+      TEST_ASSERT_EQUAL_INT(0, font.getKerning(&data->glyph[i], space));
+    }
+  }
+}
+
+void test_font_without_tables_never_kerns() {
+  TEST_ASSERT_NULL(opendyslexic_8_regular.kernPairs);
+  const EpdFont font(&opendyslexic_8_regular);
+  TEST_ASSERT_EQUAL_INT(0, font.getKerning(font.getGlyph('A'), font.getGlyph('V')));
+}
+
+// The flash each face spends on kerning, and what the lookups add to measuring words for layout
+void test_kerning_table_size_and_layout_time() {
+  std::vector<std::string> words;
+  const char* text = LAYOUT_TEXT;
+  while (*text) {
+    const size_t length = strcspn(text, " ");
+    words.emplace_back(text, length);
+    text += length + (text[length] ? 1 : 0);
+  }
+
+  char line[160];
+  size_t totalBytes = 0;
+  for (const Face& face : builtinFaces) {
+    const size_t bytes = kerningTableBytes(face.data);
+    totalBytes += bytes;
+    if (bytes == 0) {
+      continue;
+    }
+    const EpdFont kerned(face.data);
+    EpdFontData unkernedData = *face.data;
+    unkernedData.kernPairs = nullptr;
+    const EpdFont unkerned(&unkernedData);
+
+    int kernedWidth;
+    int unkernedWidth;
+    int height;
+    kerned.getTextDimensions(LAYOUT_TEXT, &kernedWidth, &height);
+    unkerned.getTextDimensions(LAYOUT_TEXT, &unkernedWidth, &height);
+    TEST_ASSERT_NOT_EQUAL(unkernedWidth, kernedWidth);
+
+    // Alternated so that neither side gets a warmer cache, keeping the fastest round of each against host noise
+    double kernedNs = 1e9;
+    double unkernedNs = 1e9;
+    for (int round = 0; round < 5; round++) {
+      unkernedNs = std::min(unkernedNs, measureWords(unkerned, words, 100));
+      kernedNs = std::min(kernedNs, measureWords(kerned, words, 100));
+    }
+    snprintf(line, sizeof(line), "%-26s %4d pairs, %5zu bytes; layout %.1f ns/glyph kerned, %.1f without (%+.0f%%)",
+             face.name, face.data->kernPairOffsets[leftClassCount(face.data)], bytes, kernedNs, unkernedNs,
+             (kernedNs / unkernedNs - 1) * 100);
+    TEST_MESSAGE(line);
+  }
+  snprintf(line, sizeof(line), "%zu builtin faces, %zu bytes of kerning tables", sizeof(builtinFaces) /
+           sizeof(builtinFaces[0]), totalBytes);
+  TEST_MESSAGE(line);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_get_glyph_matches_intervals);
+  RUN_TEST(test_kerning_matches_pair_tables);
+  RUN_TEST(test_kerning_tightens_av);
+  RUN_TEST(test_spaces_never_kern);
+  RUN_TEST(test_font_without_tables_never_kerns);
+  RUN_TEST(test_kerning_table_size_and_layout_time);
+  return UNITY_END();
+}
@@ -0,0 +1,545 @@
+#include <Bitmap.h>
+#include <EInkDisplay.h>
+#include <EpdFont.h>
+#include <GfxRenderer.h>
+#include <SDCardManager.h>
+#include <Utf8.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <builtinFonts/ubuntu_10_regular.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr int FONT_2BIT = 1;
+constexpr int FONT_1BIT = 2;
+constexpr int FONT_BOOK = 3;
+
+EInkDisplay display;
+GfxRenderer renderer(display);
+EpdFont font2Bit(&bookerly_14_regular);
+EpdFont font1Bit(&ubuntu_10_regular);
+EpdFont boldFont(&bookerly_14_bold);
+EpdFont italicFont(&bookerly_14_italic);
+EpdFont boldItalicFont(&bookerly_14_bolditalic);
+const EpdFontFamily bookFamily(&font2Bit, &boldFont, &italicFont, &boldItalicFont);
+
+const GfxRenderer::Orientation orientations[] = {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise,
+                                                 GfxRenderer::PortraitInverted,
+                                                 GfxRenderer::LandscapeCounterClockwise};
+const GfxRenderer::RenderMode modes[] = {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB};
+
+struct PlacedGlyph {
+  char text[2];
+  int x;
+  int y;
+};
+
+// Printable ASCII laid edge to edge in rows, starting above and left of the screen and running past its right and
+// bottom edges so glyphs are clipped on every side
+std::vector<PlacedGlyph> densePage(const EpdFont& font) {
+  std::vector<PlacedGlyph> placed;
+  const int lineHeight = font.data->advanceY;
+  char c = '!';
+  for (int y = -lineHeight / 2; y < renderer.getScreenHeight() + lineHeight / 2; y += lineHeight) {
+    for (int x = -7; x < renderer.getScreenWidth() + 7;) {
+      placed.push_back({{c, '\0'}, x, y});
+      x += font.getGlyph(c)->advanceX;
+      c = c == '~' ? '!' : c + 1;
+    }
+  }
+  return placed;
+}
+
+// The per-pixel glyph drawing the blitter replaced
+void drawGlyphByPixel(const EpdFont& font, const PlacedGlyph& placed, const GfxRenderer::RenderMode mode,
+                      const bool pixelState) {
+  const EpdGlyph* glyph = font.getGlyph(placed.text[0]);
+  const uint8_t* bitmap = &font.data->bitmap[glyph->dataOffset];
+  const int baseline = placed.y + font.data->ascender;
+  for (int glyphY = 0; glyphY < glyph->height; glyphY++) {
+    const int screenY = baseline - glyph->top + glyphY;
+    for (int glyphX = 0; glyphX < glyph->width; glyphX++) {
+      const int pixelPosition = glyphY * glyph->width + glyphX;
+      const int screenX = placed.x + glyph->left + glyphX;
+      if (font.data->is2Bit) {
+        // 0 -> black, 1 -> dark gray, 2 -> light gray, 3 -> white
+        const uint8_t bmpVal = 3 - ((bitmap[pixelPosition / 4] >> ((3 - pixelPosition % 4) * 2)) & 0x3);
+        if (mode == GfxRenderer::BW && bmpVal < 3) {
+          renderer.drawPixel(screenX, screenY, pixelState);
+        } else if (mode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+          renderer.drawPixel(screenX, screenY, false);
+        } else if (mode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
+          renderer.drawPixel(screenX, screenY, false);
+        }
+      } else if ((bitmap[pixelPosition / 8] >> (7 - pixelPosition % 8)) & 1) {
+        renderer.drawPixel(screenX, screenY, pixelState);
+      }
+    }
+  }
+}
+
+std::vector<uint8_t> frame() {
+  const uint8_t* buffer = renderer.getFrameBuffer();
+  return std::vector<uint8_t>(buffer, buffer + GfxRenderer::getBufferSize());
+}
+
+void checkFont(const int fontId, const EpdFont& font, const char* name) {
+  unsigned long blitUs = 0;
+  unsigned long pixelUs = 0;
+  for (const auto orientation : orientations) {
+    renderer.setOrientation(orientation);
+    const auto page = densePage(font);
+    for (const auto mode : modes) {
+      for (const bool pixelState : {true, false}) {
+        const uint8_t background = pixelState ? 0xFF : 0x00;
+        renderer.setRenderMode(mode);
+
+        renderer.clearScreen(background);
+        unsigned long start = micros();
+        for (const auto& placed : page) {
+          renderer.drawText(fontId, placed.x, placed.y, placed.text, pixelState);
+        }
+        blitUs += micros() - start;
+        const auto blitted = frame();
+
+        renderer.clearScreen(background);
+        start = micros();
+        for (const auto& placed : page) {
+          drawGlyphByPixel(font, placed, mode, pixelState);
+        }
+        pixelUs += micros() - start;
+
+        TEST_ASSERT_TRUE_MESSAGE(blitted == frame(), name);
+      }
+    }
+  }
+  renderer.setOrientation(GfxRenderer::Portrait);
+  renderer.setRenderMode(GfxRenderer::BW);
+
+  char line[128];
+  snprintf(line, sizeof(line), "%s, 24 dense pages: blitter %.1fms, per pixel %.1fms", name, blitUs / 1000.0,
+           pixelUs / 1000.0);
+  TEST_MESSAGE(line);
+}
+
+// A page of text in both fonts over a block of image rows in all four levels, as a reader page with an image
+void drawMixedPage() {
+  const int width = renderer.getScreenWidth() - 40;
+  std::vector<uint8_t> rows((width + 3) / 4 * 64);
+  for (int y = 0; y < 64; y++) {
+    for (int x = 0; x < width; x++) {
+      rows[y * ((width + 3) / 4) + x / 4] |= ((x / 8 + y / 8) % 4) << (6 - (x % 4) * 2);
+    }
+  }
+  renderer.drawImageRows(rows.data(), 20, 100, width, 64);
+  const char* const text = "The quick brown fox jumps over the lazy dog, 0123456789 (AVAWA).";
+  for (int y = 0; y < renderer.getScreenHeight(); y += 40) {
+    renderer.drawText(y % 80 == 0 ? FONT_2BIT : FONT_1BIT, 10 - y % 17, y, text);
+  }
+}
+
+struct Word {
+  std::string text;
+  EpdFontFamily::Style style;
+};
+
+// Words of a European language chapter: mostly ASCII, with accents, curly quotes, dashes and ellipses, now and then a
+// Greek or Cyrillic name and a word the font has no glyphs for
+std::vector<Word> makeChapter(const size_t wordCount) {
+  const char* const words[] = {
+      "the",     "reader",   "turned",    "page",        "and",          "said",      "nothing",  "for",
+      "a",       "while",    "evening",   "river",       "window",       "of",        "to",       "was",
+      "café",    "naïve",    "déjà",      "façade",      "élan",         "über",      "Mädchen",  "Straße",
+      "größer",  "señor",    "año",       "mañana",      "niño",         "Ærøskøbing", "Łódź",    "čaj",
+      "“Well,”", "‘quite’",  "time—and",  "so…",         "«non»",        "„ja“",      "€20",      "½",
+      "Ἀθῆναι",  "Москва",   "λόγος",     "Пётр",        "東京",         "→",         "✓",        "№5",
+  };
+  constexpr size_t WORD_COUNT = sizeof(words) / sizeof(words[0]);
+  std::mt19937 random(18);
+  std::vector<Word> chapter;
+  chapter.reserve(wordCount);
+  for (size_t i = 0; i < wordCount; i++) {
+    // Three in four words are plain English, the rest are picked from the whole list
+    const size_t index = random() % 4 != 0 ? random() % 16 : random() % WORD_COUNT;
+    const auto style = random() % 20 == 0 ? EpdFontFamily::ITALIC
+                       : random() % 50 == 0 ? EpdFontFamily::BOLD
+                                            : EpdFontFamily::REGULAR;
+    chapter.push_back({words[index], style});
+  }
+  return chapter;
+}
+
+// Every codepoint from U+00A0 to U+052F in words of five, more than the cache holds so entries are evicted, with the
+// ones the font lacks measured as '?'
+std::vector<std::string> makeCodepointSweep() {
+  std::vector<std::string> words;
+  std::string word;
+  for (uint32_t cp = 0xA0; cp <= 0x52F; cp++) {
+    word += static_cast<char>(0xC0 | (cp >> 6));
+    word += static_cast<char>(0x80 | (cp & 0x3F));
+    if (word.size() == 10) {
+      words.push_back(word);
+      word.clear();
+    }
+  }
+  words.push_back(word);
+  return words;
+}
+
+size_t nonAsciiCodepoints(const char* text) {
+  size_t count = 0;
+  uint32_t cp;
+  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
+    count += cp > EpdFont::ASCII_LAST;
+  }
+  return count;
+}
+
+int uncachedWidth(const Word& word) {
+  int w = 0, h = 0;
+  bookFamily.getTextDimensions(word.text.c_str(), &w, &h, word.style);
+  return w;
+}
+
+const char* const BMP_PATH = "/image.bmp";
+
+void appendLE(std::vector<uint8_t>& out, const uint32_t value, const int bytes) {
+  for (int i = 0; i < bytes; i++) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+// A BMP of random pixels, with a random palette for the indexed depths, written to BMP_PATH
+void writeBmp(const int width, const int height, const uint16_t bpp, const bool topDown, const uint32_t seed) {
+  std::mt19937 random(seed);
+  const uint32_t colors = bpp <= 8 ? 1u << bpp : 0;
+  const uint32_t rowBytes = (width * bpp + 31) / 32 * 4;
+  const uint32_t dataOffset = 14 + 40 + colors * 4;
+  std::vector<uint8_t> bmp = {'B', 'M'};
+  appendLE(bmp, dataOffset + rowBytes * height, 4);
+  appendLE(bmp, 0, 4);
+  appendLE(bmp, dataOffset, 4);
+  appendLE(bmp, 40, 4);
+  appendLE(bmp, width, 4);
+  appendLE(bmp, topDown ? -height : height, 4);
+  appendLE(bmp, 1, 2);
+  appendLE(bmp, bpp, 2);
+  appendLE(bmp, 0, 4);
+  appendLE(bmp, rowBytes * height, 4);
+  appendLE(bmp, 2835, 4);
+  appendLE(bmp, 2835, 4);
+  appendLE(bmp, colors, 4);
+  appendLE(bmp, 0, 4);
+  for (uint32_t i = 0; i < colors; i++) {
+    appendLE(bmp, random() & 0xFFFFFF, 4);
+  }
+  for (uint32_t i = 0; i < rowBytes * height; i++) {
+    bmp.push_back(static_cast<uint8_t>(random()));
+  }
+
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", BMP_PATH, file));
+  file.write(bmp.data(), bmp.size());
+  file.close();
+}
+
+struct Placement {
+  const char* name;
+  int width;
+  int height;
+  bool topDown;
+  int x;
+  int y;
+  int maxWidth;
+  int maxHeight;
+  float cropX;
+  float cropY;
+};
+
+// Unscaled screen-sized bitmaps at the origin take the row blit in LandscapeCounterClockwise and the column masks in
+// portrait, everything else steps panel coordinates per pixel
+std::vector<Placement> bitmapPlacements() {
+  const int w = renderer.getScreenWidth();
+  const int h = renderer.getScreenHeight();
+  return {
+      {"full screen", w, h, true, 0, 0, 0, 0, 0, 0},
+      {"full screen bottom-up", w, h, false, 0, 0, 0, 0, 0, 0},
+      {"scaled to fit", w * 5 / 4, h * 5 / 4, false, 0, 0, w, h, 0, 0},
+      {"cropped", w, h, true, 0, 0, 0, 0, 0.1f, 0.2f},
+      {"offset", 301, 203, false, 37, 55, 0, 0, 0, 0},
+      {"over the bottom right edges", 301, 203, true, w - 100, h - 50, 0, 0, 0, 0},
+      {"over the top left edges", 301, 203, false, -40, -30, 0, 0, 0, 0},
+  };
+}
+
+// The drawBitmap loop before the row blits: every drawn pixel through drawPixel
+void drawBitmapByPixel(const Bitmap& bitmap, const Placement& placement, const GfxRenderer::RenderMode mode) {
+  float scale = 1.0f;
+  bool isScaled = false;
+  const int cropPixX = std::floor(bitmap.getWidth() * placement.cropX / 2.0f);
+  const int cropPixY = std::floor(bitmap.getHeight() * placement.cropY / 2.0f);
+  if (placement.maxWidth > 0 && (1.0f - placement.cropX) * bitmap.getWidth() > placement.maxWidth) {
+    scale = static_cast<float>(placement.maxWidth) / static_cast<float>((1.0f - placement.cropX) * bitmap.getWidth());
+    isScaled = true;
+  }
+  if (placement.maxHeight > 0 && (1.0f - placement.cropY) * bitmap.getHeight() > placement.maxHeight) {
+    scale = std::min(scale, static_cast<float>(placement.maxHeight) /
+                                static_cast<float>((1.0f - placement.cropY) * bitmap.getHeight()));
+    isScaled = true;
+  }
+
+  std::vector<uint8_t> outputRow((bitmap.getWidth() + 3) / 4);
+  for (int bmpY = 0; bmpY < bitmap.getHeight() - cropPixY; bmpY++) {
+    int screenY = -cropPixY + (bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY);
+    if (isScaled) {
+      screenY = std::floor(screenY * scale);
+    }
+    screenY += placement.y;
+    if (screenY >= renderer.getScreenHeight()) {
+      break;
+    }
+    TEST_ASSERT_EQUAL(BmpReaderError::Ok, bitmap.readNextRow(outputRow.data()));
+    if (bmpY < cropPixY) {
+      continue;
+    }
+    for (int bmpX = cropPixX; bmpX < bitmap.getWidth() - cropPixX; bmpX++) {
+      int screenX = bmpX - cropPixX;
+      if (isScaled) {
+        screenX = std::floor(screenX * scale);
+      }
+      screenX += placement.x;
+      if (screenX >= renderer.getScreenWidth()) {
+        break;
+      }
+      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+      if ((mode == GfxRenderer::BW || mode == GfxRenderer::BW_AND_GRAYSCALE) && val < 3) {
+        renderer.drawPixel(screenX, screenY);
+      } else if (mode == GfxRenderer::GRAYSCALE_MSB && (val == 1 || val == 2)) {
+        renderer.drawPixel(screenX, screenY, false);
+      } else if (mode == GfxRenderer::GRAYSCALE_LSB && val == 1) {
+        renderer.drawPixel(screenX, screenY, false);
+      }
+    }
+  }
+}
+}  // namespace
+
+void setUp() {
+  renderer.insertFont(FONT_2BIT, EpdFontFamily(&font2Bit));
+  renderer.insertFont(FONT_1BIT, EpdFontFamily(&font1Bit));
+  renderer.insertFont(FONT_BOOK, bookFamily);
+}
+
+void tearDown() {}
+
+void test_blitter_matches_per_pixel_2bit() { checkFont(FONT_2BIT, font2Bit, "Bookerly 14, 2-bit"); }
+
+void test_blitter_matches_per_pixel_1bit() { checkFont(FONT_1BIT, font1Bit, "Ubuntu 10, 1-bit"); }
+
+// One BW_AND_GRAYSCALE render has to leave the same BW framebuffer and grayscale planes as rendering the page once
+// in each mode
+void test_single_pass_planes_match_three_passes() {
+  for (const auto orientation : orientations) {
+    renderer.setOrientation(orientation);
+
+    renderer.clearScreen();
+    renderer.setRenderMode(GfxRenderer::BW);
+    drawMixedPage();
+    const auto bw = frame();
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+    drawMixedPage();
+    const auto lsb = frame();
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+    drawMixedPage();
+    const auto msb = frame();
+    // Both planes have grays in them, so matching means something
+    TEST_ASSERT_TRUE(std::any_of(lsb.begin(), lsb.end(), [](const uint8_t byte) { return byte != 0; }));
+    TEST_ASSERT_TRUE(std::any_of(msb.begin(), msb.end(), [](const uint8_t byte) { return byte != 0; }));
+
+    // Planes are allocated for each page, as the reader does
+    renderer.clearScreen();
+    TEST_ASSERT_TRUE(renderer.allocateGrayscalePlanes());
+    renderer.setRenderMode(GfxRenderer::BW_AND_GRAYSCALE);
+    drawMixedPage();
+    renderer.displayGrayscalePlanes();
+    renderer.freeGrayscalePlanes();
+    const uint8_t* singleLsb = display.getGrayscaleLsbBuffer();
+    const uint8_t* singleMsb = display.getGrayscaleMsbBuffer();
+
+    TEST_ASSERT_TRUE(frame() == bw);
+    TEST_ASSERT_EQUAL_MEMORY(lsb.data(), singleLsb, lsb.size());
+    TEST_ASSERT_EQUAL_MEMORY(msb.data(), singleMsb, msb.size());
+  }
+  renderer.setOrientation(GfxRenderer::Portrait);
+  renderer.setRenderMode(GfxRenderer::BW);
+}
+
+// Widths measured through the glyph cache are the font's own, in every style and after entries are evicted
+void test_cached_widths_match_font() {
+  std::vector<Word> words;
+  for (const auto& text : makeCodepointSweep()) {
+    for (const auto style :
+         {EpdFontFamily::REGULAR, EpdFontFamily::BOLD, EpdFontFamily::ITALIC, EpdFontFamily::BOLD_ITALIC}) {
+      words.push_back({text, style});
+    }
+  }
+  const auto chapter = makeChapter(5000);
+  words.insert(words.end(), chapter.begin(), chapter.end());
+
+  // Twice over, the second time the cache is full of other fonts' and codepoints' glyphs
+  for (int pass = 0; pass < 2; pass++) {
+    for (const auto& word : words) {
+      TEST_ASSERT_EQUAL_INT_MESSAGE(uncachedWidth(word), renderer.getTextWidth(FONT_BOOK, word.text.c_str(), word.style),
+                                    word.text.c_str());
+    }
+  }
+}
+
+// Measures a chapter's words the way the section layout does, through the cache and straight from the fonts
+void test_chapter_glyph_cache_hit_rate() {
+  const auto chapter = makeChapter(60000);
+  size_t codepoints = 0;
+  size_t nonAscii = 0;
+  for (const auto& word : chapter) {
+    const char* text = word.text.c_str();
+    while (utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text))) {
+      codepoints++;
+    }
+    nonAscii += nonAsciiCodepoints(word.text.c_str());
+  }
+
+  // Each way is timed on its second pass, so neither pays for warming up the host's caches
+  long cachedTotal = 0;
+  long uncachedTotal = 0;
+  unsigned long cachedUs = 0;
+  unsigned long uncachedUs = 0;
+  size_t misses = 0;
+  for (int pass = 0; pass < 2; pass++) {
+    cachedTotal = 0;
+    uncachedTotal = 0;
+    const size_t missesBefore = renderer.getGlyphCacheMisses();
+    unsigned long start = micros();
+    for (const auto& word : chapter) {
+      cachedTotal += renderer.getTextWidth(FONT_BOOK, word.text.c_str(), word.style);
+    }
+    cachedUs = micros() - start;
+    misses = renderer.getGlyphCacheMisses() - missesBefore;
+    start = micros();
+    for (const auto& word : chapter) {
+      uncachedTotal += uncachedWidth(word);
+    }
+    uncachedUs = micros() - start;
+  }
+  TEST_ASSERT_EQUAL(uncachedTotal, cachedTotal);
+
+  const double hitRate = 100.0 * (nonAscii - misses) / nonAscii;
+  char line[192];
+  snprintf(line, sizeof(line), "%zu words, %zu codepoints: %.1f%% ASCII fast path, %zu cache lookups, %.1f%% hits",
+           chapter.size(), codepoints, 100.0 * (codepoints - nonAscii) / codepoints, nonAscii, hitRate);
+  TEST_MESSAGE(line);
+  snprintf(line, sizeof(line), "Widths through the cache %.1fms, straight from the fonts %.1fms", cachedUs / 1000.0,
+           uncachedUs / 1000.0);
+  TEST_MESSAGE(line);
+  // One entry per slot, so codepoints and styles that share a slot evict each other
+  TEST_ASSERT_GREATER_THAN(70.0, hitRate);
+}
+
+// drawBitmap draws the same framebuffer as the per-pixel loop it replaced, over a random background so stray writes
+// show, for every depth, orientation, render mode and placement. Timed by the path each case takes.
+void test_draw_bitmap_matches_per_pixel() {
+  const GfxRenderer::RenderMode bitmapModes[] = {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB,
+                                                 GfxRenderer::GRAYSCALE_MSB, GfxRenderer::BW_AND_GRAYSCALE};
+  const char* const pathNames[] = {"row blit", "column masks", "affine steps"};
+  unsigned long blitUs[3] = {};
+  unsigned long pixelUs[3] = {};
+  int draws[3] = {};
+  std::mt19937 random(25);
+  std::vector<uint8_t> background(GfxRenderer::getBufferSize());
+  uint32_t seed = 1;
+
+  for (const uint16_t bpp : {1, 2, 8, 24, 32}) {
+    for (const auto orientation : orientations) {
+      renderer.setOrientation(orientation);
+      for (const auto& placement : bitmapPlacements()) {
+        writeBmp(placement.width, placement.height, bpp, placement.topDown, seed++);
+        const bool aligned = placement.x == 0 && placement.y == 0 && placement.maxWidth == 0 &&
+                             placement.cropX == 0 && placement.width == renderer.getScreenWidth();
+        int path = 2;
+        if (aligned && orientation == GfxRenderer::LandscapeCounterClockwise) {
+          path = 0;
+        } else if (aligned && orientation != GfxRenderer::LandscapeClockwise) {
+          path = 1;
+        }
+        for (const auto mode : bitmapModes) {
+          renderer.setRenderMode(mode);
+          char name[128];
+          snprintf(name, sizeof(name), "%d bpp, orientation %d, mode %d, %s", bpp, orientation, mode,
+                   placement.name);
+          for (auto& byte : background) {
+            byte = static_cast<uint8_t>(random());
+          }
+
+          // Dithering on for the depths that dither, both readers see the same rows
+          FsFile file;
+          TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", BMP_PATH, file));
+          Bitmap blitted(file, true);
+          TEST_ASSERT_EQUAL_MESSAGE(BmpReaderError::Ok, blitted.parseHeaders(), name);
+          std::copy(background.begin(), background.end(), renderer.getFrameBuffer());
+          unsigned long start = micros();
+          renderer.drawBitmap(blitted, placement.x, placement.y, placement.maxWidth, placement.maxHeight,
+                              placement.cropX, placement.cropY);
+          blitUs[path] += micros() - start;
+          const auto drawn = frame();
+          file.close();
+
+          TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", BMP_PATH, file));
+          Bitmap reference(file, true);
+          TEST_ASSERT_EQUAL_MESSAGE(BmpReaderError::Ok, reference.parseHeaders(), name);
+          std::copy(background.begin(), background.end(), renderer.getFrameBuffer());
+          start = micros();
+          drawBitmapByPixel(reference, placement, mode);
+          pixelUs[path] += micros() - start;
+          file.close();
+
+          TEST_ASSERT_TRUE_MESSAGE(drawn == frame(), name);
+          // A grayscale pass may have no pixels to draw, a small palette need not have the grays it draws
+          if (mode == GfxRenderer::BW || mode == GfxRenderer::BW_AND_GRAYSCALE) {
+            TEST_ASSERT_FALSE_MESSAGE(drawn == background, name);
+          }
+          draws[path]++;
+        }
+      }
+    }
+  }
+  renderer.setOrientation(GfxRenderer::Portrait);
+  renderer.setRenderMode(GfxRenderer::BW);
+
+  for (int path = 0; path < 3; path++) {
+    TEST_ASSERT_GREATER_THAN(0, draws[path]);
+    char line[128];
+    snprintf(line, sizeof(line), "%s: %d draws, drawBitmap %.1fms, per pixel %.1fms", pathNames[path], draws[path],
+             blitUs[path] / 1000.0, pixelUs[path] / 1000.0);
+    TEST_MESSAGE(line);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_blitter_matches_per_pixel_2bit);
+  RUN_TEST(test_blitter_matches_per_pixel_1bit);
+  RUN_TEST(test_single_pass_planes_match_three_passes);
+  RUN_TEST(test_cached_widths_match_font);
+  RUN_TEST(test_chapter_glyph_cache_hit_rate);
+  RUN_TEST(test_draw_bitmap_matches_per_pixel);
+  return UNITY_END();
+}
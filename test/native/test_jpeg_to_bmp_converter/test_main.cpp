@@ -0,0 +1,419 @@
+#include <HostHeap.h>
+#include <JpegDcDecoder.h>
+#include <JpegToBmpConverter.h>
+#include <SDCardManager.h>
+#include <TestArchives.h>
+#include <TestJpeg.h>
+#include <unity.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// The same 32x32 checkerboard of 8x8 blocks saved with each luma sampling picojpeg supports, so every layout of
+// blocks in its MCU buffer is read back. Black blocks are where the block column and row add up to an even number.
+namespace {
+// h1v1
+const uint8_t H1V1[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03,
+    0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a,
+    0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15,
+    0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03,
+    0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x20, 0x00, 0x20, 0x03, 0x01, 0x11, 0x00,
+    0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x16, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x09, 0xff, 0xc4, 0x00, 0x14, 0x10, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x14, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc4,
+    0x00, 0x14, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xca, 0xa0, 0x2a, 0x80,
+    0x15, 0x70, 0x2a, 0x80, 0x40, 0x2a, 0xe0, 0x55, 0x00, 0x2a, 0xe0, 0x80, 0xaa, 0x00, 0x55, 0xc0, 0xaa, 0x01, 0x00,
+    0xab, 0x81, 0x54, 0x00, 0xab, 0x83, 0xff, 0xd9,
+};
+
+// h2v1
+const uint8_t H2V1[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03,
+    0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a,
+    0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15,
+    0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03,
+    0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x20, 0x00, 0x20, 0x03, 0x01, 0x21, 0x00,
+    0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x16, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x09, 0xff, 0xc4, 0x00, 0x14, 0x10, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x14, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc4,
+    0x00, 0x14, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xca, 0xa2, 0xa8, 0x01,
+    0x57, 0x2a, 0x80, 0x42, 0xae, 0x05, 0x50, 0x2a, 0xe0, 0x8a, 0xa0, 0x05, 0x5c, 0xaa, 0x01, 0x0a, 0xb8, 0x15, 0x40,
+    0xab, 0x83, 0xff, 0xd9,
+};
+
+// h1v2
+const uint8_t H1V2[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03,
+    0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a,
+    0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15,
+    0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03,
+    0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x20, 0x00, 0x20, 0x03, 0x01, 0x12, 0x00,
+    0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x16, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x09, 0xff, 0xc4, 0x00, 0x14, 0x10, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x14, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc4,
+    0x00, 0x14, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xca, 0xa2, 0xa8, 0x04,
+    0x2a, 0xe0, 0x8a, 0xa0, 0x10, 0xab, 0x82, 0x2a, 0x80, 0x42, 0xae, 0x08, 0xaa, 0x01, 0x0a, 0xb8, 0x3f, 0xff, 0xd9,
+};
+
+// h2v2
+const uint8_t H2V2[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03,
+    0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a,
+    0x0b, 0x0b, 0x0d, 0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15,
+    0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03,
+    0x04, 0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x20, 0x00, 0x20, 0x03, 0x01, 0x22, 0x00,
+    0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00, 0x16, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x09, 0xff, 0xc4, 0x00, 0x14, 0x10, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc4, 0x00, 0x14, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc4,
+    0x00, 0x14, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xca, 0xa2, 0xa8, 0x42,
+    0xae, 0x08, 0xaa, 0x10, 0xab, 0x82, 0x2a, 0x84, 0x2a, 0xe0, 0x8a, 0xa1, 0x0a, 0xb8, 0x3f, 0xff, 0xd9,
+};
+struct Sample {
+  const char* name;
+  const uint8_t* data;
+  size_t size;
+};
+
+const Sample SAMPLES[] = {
+    {"H1V1", H1V1, sizeof(H1V1)},
+    {"H2V1", H2V1, sizeof(H2V1)},
+    {"H1V2", H1V2, sizeof(H1V2)},
+    {"H2V2", H2V2, sizeof(H2V2)},
+};
+
+// Converts the sample to 2-bit rows of at most maxSize x maxSize and returns the pixel levels, 3 = black
+std::vector<uint8_t> toGray2(const Sample& sample, const int maxSize, int* width, int* height) {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", "/sample.jpg", file));
+  file.write(sample.data, sample.size);
+  file.close();
+
+  TestArchives::MemoryPrint out;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", "/sample.jpg", file));
+  TEST_ASSERT_TRUE_MESSAGE(JpegToBmpConverter::jpegFileToGray2Stream(file, out, maxSize, maxSize, width, height),
+                           sample.name);
+  file.close();
+
+  // Rows follow the little-endian width and height
+  constexpr int headerSize = 4;
+  TEST_ASSERT_EQUAL(*width, out.byteAt(0) | out.byteAt(1) << 8);
+  TEST_ASSERT_EQUAL(*height, out.byteAt(2) | out.byteAt(3) << 8);
+  const int rowBytes = (*width + 3) / 4;
+  TEST_ASSERT_EQUAL(headerSize + rowBytes * *height, out.data.size());
+  std::vector<uint8_t> levels;
+  for (int y = 0; y < *height; y++) {
+    for (int x = 0; x < *width; x++) {
+      levels.push_back((out.byteAt(headerSize + y * rowBytes + x / 4) >> (6 - (x % 4) * 2)) & 0x03);
+    }
+  }
+  return levels;
+}
+
+uint8_t expectedLevel(const int blockX, const int blockY) { return (blockX + blockY) % 2 == 0 ? 3 : 0; }
+
+// A stand-in for a photo: shading across the frame, a bright disc and fine stripes, so blocks carry AC detail and
+// the DC of neighbouring blocks differs
+std::vector<uint8_t> makePhoto(const int width, const int height, const int channels) {
+  std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * channels);
+  const float radius = std::min(width, height) * 0.25f;
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      const float shade = 150.0f * x / width + 80.0f * y / height;
+      const float dx = x - width * 0.6f;
+      const float dy = y - height * 0.4f;
+      const float disc = dx * dx + dy * dy < radius * radius ? 70.0f : 0.0f;
+      const float stripe = (x / 3 + y / 5) % 2 * 20.0f;
+      const int r = std::min(255, static_cast<int>(shade + disc + stripe));
+      const int g = std::min(255, static_cast<int>(shade * 0.8f + disc / 2 + stripe));
+      const int b = std::min(255, static_cast<int>(230 - shade * 0.7f + stripe));
+      uint8_t* pixel = &pixels[(static_cast<size_t>(y) * width + x) * channels];
+      if (channels == 1) {
+        pixel[0] = static_cast<uint8_t>((r + 2 * g + b) / 4);
+      } else {
+        pixel[0] = static_cast<uint8_t>(r);
+        pixel[1] = static_cast<uint8_t>(g);
+        pixel[2] = static_cast<uint8_t>(b);
+      }
+    }
+  }
+  return pixels;
+}
+
+struct CorpusEntry {
+  const char* name;
+  int width;
+  int height;
+  int channels;
+  TestJpeg::Options options;
+};
+
+// The layouts met in books. The oversized baselines have an MCU row wider than the decoder's budget.
+const CorpusEntry CORPUS[] = {
+    {"baseline gray", 600, 400, 1, {}},
+    {"baseline H1V1", 600, 400, 3, {}},
+    {"baseline H2V1", 600, 400, 3, {.lumaH = 2}},
+    {"baseline H2V2", 600, 400, 3, {.lumaH = 2, .lumaV = 2}},
+    {"baseline H2V2, restart every 3 MCUs", 600, 400, 3, {.lumaH = 2, .lumaV = 2, .restartInterval = 3}},
+    {"baseline gray 8800x600", 8800, 600, 1, {}},
+    {"baseline H2V2 4400x600", 4400, 600, 3, {.lumaH = 2, .lumaV = 2}},
+    {"progressive gray", 600, 400, 1, {.progressive = true}},
+    {"progressive H1V1", 600, 400, 3, {.progressive = true}},
+    {"progressive H2V1", 600, 400, 3, {.progressive = true, .lumaH = 2}},
+    {"progressive H2V2", 600, 400, 3, {.progressive = true, .lumaH = 2, .lumaV = 2}},
+    {"progressive H2V2, DC scan per component",
+     600,
+     400,
+     3,
+     {.progressive = true, .lumaH = 2, .lumaV = 2, .interleavedDc = false}},
+    {"progressive H1V1, restart every 7 MCUs", 600, 400, 3, {.progressive = true, .restartInterval = 7}},
+    {"progressive H2V2, DC scan per component, restart every 5",
+     600,
+     400,
+     3,
+     {.progressive = true, .lumaH = 2, .lumaV = 2, .restartInterval = 5, .interleavedDc = false}},
+    {"progressive H2V1, DC successive approximation",
+     600,
+     400,
+     3,
+     {.progressive = true, .lumaH = 2, .dcSuccessiveLow = 1}},
+    {"progressive gray, DC successive approximation, restart every 4",
+     600,
+     400,
+     1,
+     {.progressive = true, .restartInterval = 4, .dcSuccessiveLow = 2}},
+    {"progressive H2V2 2400x3200", 2400, 3200, 3, {.progressive = true, .lumaH = 2, .lumaV = 2}},
+};
+
+void writeJpeg(const std::string& jpeg) {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", "/corpus.jpg", file));
+  file.write(reinterpret_cast<const uint8_t*>(jpeg.data()), jpeg.size());
+  file.close();
+}
+
+// What the DC decoder should give for a block: the mean luma of its pixels, plus the share of blue chroma the decoder
+// adds for the blocks of its MCU when the first DC scan carries chroma
+int expectedDc(const std::vector<uint8_t>& pixels, const CorpusEntry& entry, const int blockX, const int blockY) {
+  const int mcuWidth = entry.channels == 1 ? 8 : 8 * entry.options.lumaH;
+  const int mcuHeight = entry.channels == 1 ? 8 : 8 * entry.options.lumaV;
+  auto mean = [&](const int left, const int top, const int w, const int h, const int component) {
+    double sum = 0;
+    for (int y = top; y < top + h; y++) {
+      for (int x = left; x < left + w; x++) {
+        const uint8_t* pixel = &pixels[(static_cast<size_t>(std::min(y, entry.height - 1)) * entry.width +
+                                        std::min(x, entry.width - 1)) *
+                                       entry.channels];
+        if (entry.channels == 1) {
+          sum += pixel[0];
+        } else if (component == 0) {
+          sum += 0.299 * pixel[0] + 0.587 * pixel[1] + 0.114 * pixel[2];
+        } else {
+          sum += -0.168736 * pixel[0] - 0.331264 * pixel[1] + 0.5 * pixel[2];
+        }
+      }
+    }
+    return sum / (w * h);
+  };
+  double gray = mean(blockX * 8, blockY * 8, 8, 8, 0);
+  if (entry.channels == 3 && entry.options.interleavedDc) {
+    gray += mean(blockX * 8 / mcuWidth * mcuWidth, blockY * 8 / mcuHeight * mcuHeight, mcuWidth, mcuHeight, 1) * 69 /
+            256;
+  }
+  return static_cast<int>(std::lround(std::min(255.0, std::max(0.0, gray))));
+}
+
+// Pearson correlation of two equal length series
+double correlation(const std::vector<double>& a, const std::vector<double>& b) {
+  double meanA = 0, meanB = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    meanA += a[i];
+    meanB += b[i];
+  }
+  meanA /= a.size();
+  meanB /= b.size();
+  double covariance = 0, varianceA = 0, varianceB = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    covariance += (a[i] - meanA) * (b[i] - meanB);
+    varianceA += (a[i] - meanA) * (a[i] - meanA);
+    varianceB += (b[i] - meanB) * (b[i] - meanB);
+  }
+  return covariance / std::sqrt(varianceA * varianceB);
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+// A 4x4 output is no larger than 1/8 scale, so this takes the reduce mode path with one pixel per block
+void test_reduced_decode_keeps_block_order() {
+  for (const auto& sample : SAMPLES) {
+    int width, height;
+    const auto levels = toGray2(sample, 4, &width, &height);
+    TEST_ASSERT_EQUAL(4, width);
+    TEST_ASSERT_EQUAL(4, height);
+    for (int y = 0; y < 4; y++) {
+      for (int x = 0; x < 4; x++) {
+        TEST_ASSERT_EQUAL_MESSAGE(expectedLevel(x, y), levels[y * 4 + x], sample.name);
+      }
+    }
+  }
+}
+
+void test_full_decode_keeps_block_order() {
+  for (const auto& sample : SAMPLES) {
+    int width, height;
+    const auto levels = toGray2(sample, 32, &width, &height);
+    TEST_ASSERT_EQUAL(32, width);
+    TEST_ASSERT_EQUAL(32, height);
+    for (int blockY = 0; blockY < 4; blockY++) {
+      for (int blockX = 0; blockX < 4; blockX++) {
+        TEST_ASSERT_EQUAL_MESSAGE(expectedLevel(blockX, blockY), levels[(blockY * 8 + 4) * 32 + blockX * 8 + 4],
+                                  sample.name);
+      }
+    }
+  }
+}
+
+// Every progressive layout's first DC scan decodes to the block means of the source
+void test_dc_scan_matches_block_means() {
+  for (const auto& entry : CORPUS) {
+    if (!entry.options.progressive) {
+      continue;
+    }
+    const auto pixels = makePhoto(entry.width, entry.height, entry.channels);
+    writeJpeg(TestJpeg::encode(pixels, entry.width, entry.height, entry.channels, entry.options));
+
+    FsFile file;
+    TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", "/corpus.jpg", file));
+    JpegDcDecoder decoder(file);
+    TEST_ASSERT_TRUE_MESSAGE(decoder.begin(), entry.name);
+    TEST_ASSERT_EQUAL_MESSAGE(entry.width, decoder.getWidth(), entry.name);
+    TEST_ASSERT_EQUAL_MESSAGE(entry.height, decoder.getHeight(), entry.name);
+    std::vector<uint8_t> row(decoder.getDcWidth());
+    int worst = 0;
+    for (int y = 0; y < decoder.getDcHeight(); y++) {
+      TEST_ASSERT_TRUE_MESSAGE(decoder.readRow(row.data()), entry.name);
+      for (int x = 0; x < decoder.getDcWidth(); x++) {
+        worst = std::max(worst, std::abs(row[x] - expectedDc(pixels, entry, x, y)));
+      }
+    }
+    file.close();
+    // Quantization of the DC, and of the chroma DC, and the dropped low bits under successive approximation
+    char message[160];
+    snprintf(message, sizeof(message), "%s: worst block off by %d", entry.name, worst);
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(2 + (1 << entry.options.dcSuccessiveLow), worst, message);
+  }
+}
+
+// Converts the whole corpus to the 2-bit rows a page image is cached as, timing each and measuring its peak heap. The
+// output follows the source: its 16x16 tiles correlate with the source's mean gray over the same area.
+void test_corpus_converts() {
+  constexpr int maxWidth = 480;
+  constexpr int maxHeight = 800;
+  int converted = 0;
+  for (const auto& entry : CORPUS) {
+    const auto pixels = makePhoto(entry.width, entry.height, entry.channels);
+    const std::string jpeg = TestJpeg::encode(pixels, entry.width, entry.height, entry.channels, entry.options);
+    writeJpeg(jpeg);
+
+    TestArchives::MemoryPrint out;
+    out.data.reserve(4 + (maxWidth / 4) * maxHeight);
+    int width = 0, height = 0;
+    FsFile file;
+    TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", "/corpus.jpg", file));
+    HostHeap::reset();
+    const auto start = std::chrono::steady_clock::now();
+    const bool ok = JpegToBmpConverter::jpegFileToGray2Stream(file, out, maxWidth, maxHeight, &width, &height);
+    const auto us =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    const size_t peak = HostHeap::peakBytes();
+    file.close();
+
+    char line[224];
+    if (!ok) {
+      snprintf(line, sizeof(line), "%s: conversion failed", entry.name);
+      TEST_MESSAGE(line);
+      continue;
+    }
+    converted++;
+
+    const int rowBytes = (width + 3) / 4;
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(4 + static_cast<size_t>(rowBytes) * height, out.data.size(), entry.name);
+    std::vector<double> outputTiles, sourceTiles;
+    for (int tileY = 0; tileY + 16 <= height; tileY += 16) {
+      for (int tileX = 0; tileX + 16 <= width; tileX += 16) {
+        double level = 0;
+        for (int y = tileY; y < tileY + 16; y++) {
+          for (int x = tileX; x < tileX + 16; x++) {
+            level += (out.byteAt(4 + y * rowBytes + x / 4) >> (6 - (x % 4) * 2)) & 0x03;
+          }
+        }
+        outputTiles.push_back(-level);
+        double gray = 0;
+        const int left = tileX * entry.width / width;
+        const int right = std::max(left + 1, (tileX + 16) * entry.width / width);
+        const int top = tileY * entry.height / height;
+        const int bottom = std::max(top + 1, (tileY + 16) * entry.height / height);
+        for (int y = top; y < bottom; y++) {
+          for (int x = left; x < right; x++) {
+            const uint8_t* pixel = &pixels[(static_cast<size_t>(y) * entry.width + x) * entry.channels];
+            gray += entry.channels == 1 ? pixel[0] : (pixel[0] + 2 * pixel[1] + pixel[2]) / 4.0;
+          }
+        }
+        sourceTiles.push_back(gray / ((right - left) * (bottom - top)));
+      }
+    }
+    const double match = correlation(outputTiles, sourceTiles);
+    snprintf(line, sizeof(line), "%s: %zu byte JPEG to %dx%d in %.1fms, peak heap %zu bytes, tiles correlate %.3f",
+             entry.name, jpeg.size(), width, height, us / 1000.0, HostHeap::available() ? peak : 0, match);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_TRUE_MESSAGE(match > 0.9, line);
+    // No layout may hold a row of the source at full width, the widest here is 8800 pixels
+    if (HostHeap::available()) {
+      TEST_ASSERT_LESS_THAN_size_t_MESSAGE(64 * 1024, peak, line);
+    }
+  }
+  const int total = sizeof(CORPUS) / sizeof(CORPUS[0]);
+  char summary[64];
+  snprintf(summary, sizeof(summary), "%d of %d converted", converted, total);
+  TEST_MESSAGE(summary);
+  TEST_ASSERT_EQUAL_MESSAGE(total, converted, summary);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_reduced_decode_keeps_block_order);
+  RUN_TEST(test_full_decode_keeps_block_order);
+  RUN_TEST(test_dc_scan_matches_block_means);
+  RUN_TEST(test_corpus_converts);
+  return UNITY_END();
+}
@@ -0,0 +1,170 @@
+#include <HostHeap.h>
+#include <OpdsParser.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// HttpDownloader::fetchUrl copies the response into the parser as the network hands it over. These tests stand in
+// for the network with a feed generated as it is written, so the whole document never exists in memory.
+namespace {
+constexpr size_t NETWORK_CHUNK_SIZE = 1460;
+
+// Every 11th book has no acquisition link
+bool hasLink(const int i) { return i % 3 == 0 || i % 11 != 7; }
+
+// Books with authors and acquisition links, catalog links, an entry without a link that is dropped, titles with
+// entities and multi-byte characters, and a long summary the parser skips over
+std::string feedEntry(const int i) {
+  const std::string prefix = i % 5 == 4 ? "atom:" : "";
+  std::string entry = "<" + prefix + "entry>\n<" + prefix + "title>Volume " + std::to_string(i) +
+                      " &amp; Les Mis\xC3\xA9rables \xE6\x9D\xB1\xE4\xBA\xAC</" + prefix + "title>\n";
+  entry += "<id>urn:uuid:" + std::to_string(1000000 + i) + "</id>\n";
+  if (i % 3 == 0) {
+    entry += "<link rel=\"subsection\" type=\"application/atom+xml;profile=opds-catalog\" href=\"/opds/catalog/" +
+             std::to_string(i) + "\"/>\n";
+  } else if (hasLink(i)) {
+    entry += "<author><name>Author " + std::to_string(i % 37) + "</name></author>\n";
+    entry += "<link rel=\"http://opds-spec.org/acquisition\" type=\"application/epub+zip\" href=\"/get/epub/" +
+             std::to_string(i) + "\"/>\n";
+  }
+  entry += "<summary>";
+  for (int j = 0; j < 60; j++) {
+    entry += "A long description that the reader never shows. ";
+  }
+  return entry + "</summary>\n</" + prefix + "entry>\n";
+}
+
+std::string feedHeader() {
+  return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<feed xmlns=\"http://www.w3.org/2005/Atom\" "
+         "xmlns:atom=\"http://www.w3.org/2005/Atom\">\n<title>Catalog</title>\n<id>urn:catalog</id>\n";
+}
+
+// Writes the feed in chunkSize pieces as it is generated, the way fetchUrl writes what the stream returns
+size_t streamFeed(Print& out, const int entryCount, const size_t chunkSize) {
+  std::string pending = feedHeader();
+  size_t written = 0;
+  for (int i = 0; i <= entryCount; i++) {
+    pending += i < entryCount ? feedEntry(i) : "</feed>\n";
+    size_t offset = 0;
+    while (pending.size() - offset >= chunkSize || (i == entryCount && offset < pending.size())) {
+      const size_t size = std::min(chunkSize, pending.size() - offset);
+      TEST_ASSERT_EQUAL_size_t(size, out.write(reinterpret_cast<const uint8_t*>(pending.data()) + offset, size));
+      offset += size;
+    }
+    written += offset;
+    pending.erase(0, offset);
+  }
+  return written;
+}
+
+std::string wholeFeed(const int entryCount) {
+  std::string feed = feedHeader();
+  for (int i = 0; i < entryCount; i++) {
+    feed += feedEntry(i);
+  }
+  return feed + "</feed>\n";
+}
+
+void assertSameEntries(const std::vector<OpdsEntry>& expected, const std::vector<OpdsEntry>& actual) {
+  TEST_ASSERT_EQUAL_size_t(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    TEST_ASSERT_TRUE(expected[i].type == actual[i].type);
+    TEST_ASSERT_EQUAL_STRING(expected[i].title.c_str(), actual[i].title.c_str());
+    TEST_ASSERT_EQUAL_STRING(expected[i].author.c_str(), actual[i].author.c_str());
+    TEST_ASSERT_EQUAL_STRING(expected[i].href.c_str(), actual[i].href.c_str());
+    TEST_ASSERT_EQUAL_STRING(expected[i].id.c_str(), actual[i].id.c_str());
+  }
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_streamed_feed_matches_whole_parse() {
+  constexpr int entryCount = 300;
+  OpdsParser whole;
+  const std::string feed = wholeFeed(entryCount);
+  TEST_ASSERT_TRUE(whole.parse(feed.data(), feed.size()));
+
+  // Entries lacking a link are dropped, the rest keep their fields
+  const auto& entries = whole.getEntries();
+  int linkedCount = 0;
+  for (int i = 0; i < entryCount; i++) {
+    linkedCount += hasLink(i);
+  }
+  TEST_ASSERT_EQUAL(linkedCount, entries.size());
+  TEST_ASSERT_TRUE(entries[0].type == OpdsEntryType::NAVIGATION);
+  TEST_ASSERT_EQUAL_STRING("/opds/catalog/0", entries[0].href.c_str());
+  TEST_ASSERT_TRUE(entries[1].type == OpdsEntryType::BOOK);
+  TEST_ASSERT_EQUAL_STRING("Volume 1 & Les Mis\xC3\xA9rables \xE6\x9D\xB1\xE4\xBA\xAC", entries[1].title.c_str());
+  TEST_ASSERT_EQUAL_STRING("Author 1", entries[1].author.c_str());
+  TEST_ASSERT_EQUAL_STRING("/get/epub/1", entries[1].href.c_str());
+  TEST_ASSERT_EQUAL_STRING("urn:uuid:1000001", entries[1].id.c_str());
+  TEST_ASSERT_EQUAL_STRING("/get/epub/4", entries[4].href.c_str());
+
+  // Chunks that split tags, entities and multi-byte characters
+  for (const size_t chunkSize : {size_t{3}, size_t{1023}, NETWORK_CHUNK_SIZE, size_t{4096}}) {
+    OpdsParser streamed;
+    TEST_ASSERT_TRUE(streamed.setup());
+    TEST_ASSERT_EQUAL_size_t(feed.size(), streamFeed(streamed, entryCount, chunkSize));
+    TEST_ASSERT_TRUE(streamed.finish());
+    assertSameEntries(entries, streamed.getEntries());
+  }
+}
+
+// Beyond the entries it keeps, parsing a streamed feed holds Expat's buffers rather than the document
+void test_streamed_feed_heap_is_bounded() {
+  if (!HostHeap::available()) {
+    TEST_IGNORE_MESSAGE("Needs HostHeap to measure the heap");
+  }
+  constexpr int entryCount = 350;
+
+  HostHeap::reset();
+  OpdsParser streamed;
+  TEST_ASSERT_TRUE(streamed.setup());
+  const size_t feedSize = streamFeed(streamed, entryCount, NETWORK_CHUNK_SIZE);
+  TEST_ASSERT_TRUE(streamed.finish());
+  const size_t streamedPeak = HostHeap::peakBytes();
+  const size_t entriesHeld = HostHeap::heldBytes();
+
+  // What fetching the body into a string and parsing it in one go costs
+  const std::string feed = wholeFeed(entryCount);
+  HostHeap::reset();
+  {
+    const std::string body(feed);
+    OpdsParser whole;
+    TEST_ASSERT_TRUE(whole.parse(body.data(), body.size()));
+  }
+  const size_t wholePeak = HostHeap::peakBytes();
+
+  char line[192];
+  snprintf(line, sizeof(line),
+           "%zu byte feed, %zu entries holding %zu bytes: peak %zu bytes streamed, %zu bytes parsed as one string",
+           feedSize, streamed.getEntries().size(), entriesHeld, streamedPeak, wholePeak);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_GREATER_THAN(1024 * 1024, feedSize);
+  TEST_ASSERT_LESS_THAN(64 * 1024, streamedPeak - entriesHeld);
+}
+
+// fetchUrl stops the download once the parser rejects a chunk
+void test_malformed_feed_rejects_writes() {
+  const char feed[] = "<feed><entry><title>Broken</entry></feed>";
+  OpdsParser parser;
+  TEST_ASSERT_TRUE(parser.setup());
+  TEST_ASSERT_FALSE(parser.hasError());
+  TEST_ASSERT_EQUAL_size_t(0, parser.write(reinterpret_cast<const uint8_t*>(feed), strlen(feed)));
+  TEST_ASSERT_TRUE(parser.hasError());
+  TEST_ASSERT_FALSE(parser.finish());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_streamed_feed_matches_whole_parse);
+  RUN_TEST(test_streamed_feed_heap_is_bounded);
+  RUN_TEST(test_malformed_feed_rejects_writes);
+  return UNITY_END();
+}
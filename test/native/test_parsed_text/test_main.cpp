@@ -0,0 +1,132 @@
+#include <EInkDisplay.h>
+#include <EpdFont.h>
+#include <GfxRenderer.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <unity.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Epub/ParsedText.h"
+
+namespace {
+constexpr int FONT_ID = 1;
+constexpr uint16_t VIEWPORT_WIDTH = 400;
+
+const char* const paragraph =
+    "It was the best of times, it was the worst of times, it was the age of wisdom, it was the age of foolishness, "
+    "it was the epoch of belief, it was the epoch of incredulity, it was the season of Light, it was the season of "
+    "Darkness, it was the spring of hope, it was the winter of despair.";
+
+EInkDisplay display;
+GfxRenderer renderer(display);
+EpdFont regularFont(&bookerly_14_regular);
+EpdFont boldFont(&bookerly_14_bold);
+
+std::vector<std::string> splitWords(const std::string& text) {
+  std::vector<std::string> words;
+  size_t start = 0;
+  while (start < text.size()) {
+    const size_t end = text.find(' ', start);
+    words.push_back(text.substr(start, end - start));
+    start = end == std::string::npos ? text.size() : end + 1;
+  }
+  return words;
+}
+
+ParsedText makeParagraph(const std::vector<std::string>& words, const TextBlock::Style style) {
+  ParsedText text(style, true);
+  for (size_t i = 0; i < words.size(); i++) {
+    text.addWord(words[i].c_str(), i % 5 == 0 ? EpdFontFamily::BOLD : EpdFontFamily::REGULAR);
+  }
+  return text;
+}
+
+std::vector<std::shared_ptr<TextBlock>> layout(ParsedText& text, const bool includeLastLine) {
+  std::vector<std::shared_ptr<TextBlock>> lines;
+  text.layoutAndExtractLines(renderer, FONT_ID, VIEWPORT_WIDTH,
+                             [&lines](std::shared_ptr<TextBlock> line) { lines.push_back(std::move(line)); },
+                             includeLastLine);
+  return lines;
+}
+
+// Checks every word ends inside the viewport and appends the words of the line to out
+void collectLine(const TextBlock& line, std::vector<std::string>* out) {
+  const char* word = line.wordChars();
+  for (uint16_t i = 0; i < line.getWordCount(); i++) {
+    const int width = renderer.getTextWidth(FONT_ID, word, line.wordStyles()[i]);
+    TEST_ASSERT_LESS_OR_EQUAL(VIEWPORT_WIDTH, line.wordXpos()[i] + width);
+    if (i > 0) {
+      TEST_ASSERT_GREATER_THAN(line.wordXpos()[i - 1], line.wordXpos()[i]);
+    }
+    out->emplace_back(word);
+    word += strlen(word) + 1;
+  }
+}
+}  // namespace
+
+void setUp() { renderer.insertFont(FONT_ID, EpdFontFamily(&regularFont, &boldFont)); }
+
+void tearDown() {}
+
+void test_lines_fit_and_keep_word_order() {
+  const auto words = splitWords(paragraph);
+  for (const auto style : {TextBlock::JUSTIFIED, TextBlock::LEFT_ALIGN, TextBlock::CENTER_ALIGN,
+                           TextBlock::RIGHT_ALIGN}) {
+    ParsedText text = makeParagraph(words, style);
+    const auto lines = layout(text, true);
+    TEST_ASSERT_GREATER_THAN(1, lines.size());
+    std::vector<std::string> laidOut;
+    for (const auto& line : lines) {
+      collectLine(*line, &laidOut);
+    }
+    TEST_ASSERT_TRUE(laidOut == words);
+    TEST_ASSERT_TRUE(text.isEmpty());
+  }
+}
+
+void test_last_line_is_kept_for_more_words() {
+  const auto words = splitWords(paragraph);
+  ParsedText text = makeParagraph(words, TextBlock::JUSTIFIED);
+  const auto lines = layout(text, false);
+  std::vector<std::string> laidOut;
+  for (const auto& line : lines) {
+    collectLine(*line, &laidOut);
+  }
+  TEST_ASSERT_GREATER_THAN(0, text.size());
+  TEST_ASSERT_EQUAL_size_t(words.size(), laidOut.size() + text.size());
+
+  // The held back words come out first once the paragraph is finished
+  for (const auto* word : {"and", "so", "on."}) {
+    text.addWord(word, EpdFontFamily::REGULAR);
+  }
+  for (const auto& line : layout(text, true)) {
+    collectLine(*line, &laidOut);
+  }
+  TEST_ASSERT_EQUAL_size_t(words.size() + 3, laidOut.size());
+  for (size_t i = 0; i < words.size(); i++) {
+    TEST_ASSERT_EQUAL_STRING(words[i].c_str(), laidOut[i].c_str());
+  }
+}
+
+void test_oversized_word_gets_its_own_line() {
+  const std::string longWord(120, 'm');
+  ParsedText text(TextBlock::LEFT_ALIGN, true);
+  text.addWord("before", EpdFontFamily::REGULAR);
+  text.addWord(longWord.c_str(), EpdFontFamily::REGULAR);
+  text.addWord("after", EpdFontFamily::REGULAR);
+  const auto lines = layout(text, true);
+  TEST_ASSERT_EQUAL_size_t(3, lines.size());
+  TEST_ASSERT_EQUAL_STRING(longWord.c_str(), lines[1]->wordChars());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_lines_fit_and_keep_word_order);
+  RUN_TEST(test_last_line_is_kept_for_more_words);
+  RUN_TEST(test_oversized_word_gets_its_own_line);
+  return UNITY_END();
+}
@@ -0,0 +1,292 @@
+#include <HostHeap.h>
+#include <PngToBmpConverter.h>
+#include <SDCardManager.h>
+#include <TestArchives.h>
+#include <miniz.h>
+#include <unity.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+enum ColorType : uint8_t { GRAY = 0, RGB = 2, PALETTE = 3, GRAY_ALPHA = 4, RGBA = 6 };
+
+struct Format {
+  const char* name;
+  ColorType colorType;
+  uint8_t bitDepth;
+  // Palette images only: white is transparent black instead of an opaque white entry
+  bool transparentPalette;
+};
+
+// Every colour type at every bit depth PNG allows for it. Images with alpha draw white as transparent black, so they
+// only come out right when composited onto the paper.
+const Format FORMATS[] = {
+    {"gray 1", GRAY, 1, false},
+    {"gray 2", GRAY, 2, false},
+    {"gray 4", GRAY, 4, false},
+    {"gray 8", GRAY, 8, false},
+    {"gray 16", GRAY, 16, false},
+    {"rgb 8", RGB, 8, false},
+    {"rgb 16", RGB, 16, false},
+    {"palette 1", PALETTE, 1, false},
+    {"palette 2", PALETTE, 2, false},
+    {"palette 4", PALETTE, 4, false},
+    {"palette 8", PALETTE, 8, false},
+    {"palette 4 tRNS", PALETTE, 4, true},
+    {"gray alpha 8", GRAY_ALPHA, 8, false},
+    {"gray alpha 16", GRAY_ALPHA, 16, false},
+    {"rgba 8", RGBA, 8, false},
+    {"rgba 16", RGBA, 16, false},
+};
+
+int channelCount(const ColorType colorType) {
+  switch (colorType) {
+    case RGB:
+      return 3;
+    case GRAY_ALPHA:
+      return 2;
+    case RGBA:
+      return 4;
+    default:
+      return 1;
+  }
+}
+
+// 4x4 blocks, black where the block column and row add up to an even number
+bool isBlack(const int x, const int y) { return (x / 4 + y / 4) % 2 == 0; }
+
+void appendU32(std::string& out, const uint32_t value) {
+  out += static_cast<char>(value >> 24);
+  out += static_cast<char>(value >> 16);
+  out += static_cast<char>(value >> 8);
+  out += static_cast<char>(value);
+}
+
+void appendChunk(std::string& png, const char* type, const std::string& data) {
+  appendU32(png, data.size());
+  const std::string typed = type + data;
+  png += typed;
+  appendU32(png, mz_crc32(MZ_CRC32_INIT, reinterpret_cast<const uint8_t*>(typed.data()), typed.size()));
+}
+
+// The raw scanline of row y, before filtering
+std::vector<uint8_t> rawRow(const Format& format, const int width, const int y) {
+  const int maxSample = (1 << format.bitDepth) - 1;
+  const int channels = channelCount(format.colorType);
+  std::vector<uint8_t> row((width * channels * format.bitDepth + 7) / 8);
+  for (int x = 0; x < width; x++) {
+    const bool black = isBlack(x, y);
+    int samples[4];
+    switch (format.colorType) {
+      case GRAY:
+        samples[0] = black ? 0 : maxSample;
+        break;
+      case RGB:
+        samples[0] = samples[1] = samples[2] = black ? 0 : maxSample;
+        break;
+      case PALETTE:
+        // The last entry is black, the others white or transparent
+        samples[0] = black ? maxSample : x % maxSample;
+        break;
+      case GRAY_ALPHA:
+        samples[0] = 0;
+        samples[1] = black ? maxSample : 0;
+        break;
+      case RGBA:
+        samples[0] = samples[1] = samples[2] = 0;
+        samples[3] = black ? maxSample : 0;
+        break;
+    }
+    for (int c = 0; c < channels; c++) {
+      if (format.bitDepth == 16) {
+        row[(x * channels + c) * 2] = samples[c] >> 8;
+        row[(x * channels + c) * 2 + 1] = samples[c] & 0xFF;
+      } else if (format.bitDepth == 8) {
+        row[x * channels + c] = samples[c];
+      } else {
+        const int bit = x * format.bitDepth;
+        row[bit / 8] |= samples[c] << (8 - format.bitDepth - bit % 8);
+      }
+    }
+  }
+  return row;
+}
+
+int paeth(const int a, const int b, const int c) {
+  const int p = a + b - c;
+  const int pa = abs(p - a);
+  const int pb = abs(p - b);
+  const int pc = abs(p - c);
+  if (pa <= pb && pa <= pc) return a;
+  if (pb <= pc) return b;
+  return c;
+}
+
+// Encodes the checkerboard, cycling through the five filter types row by row and splitting the image data over IDAT
+// chunks of idatSize bytes
+std::string encodePng(const Format& format, const int width, const int height, const size_t idatSize = 100,
+                      const bool interlaced = false) {
+  const int bitsPerPixel = channelCount(format.colorType) * format.bitDepth;
+  const size_t distance = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;
+  std::vector<uint8_t> filtered;
+  std::vector<uint8_t> prior;
+  for (int y = 0; y < height; y++) {
+    const auto row = rawRow(format, width, y);
+    prior.resize(row.size());
+    const uint8_t filter = y % 5;
+    filtered.push_back(filter);
+    for (size_t i = 0; i < row.size(); i++) {
+      const int a = i >= distance ? row[i - distance] : 0;
+      const int b = prior[i];
+      const int c = i >= distance ? prior[i - distance] : 0;
+      const int predicted = filter == 1   ? a
+                            : filter == 2 ? b
+                            : filter == 3 ? (a + b) / 2
+                            : filter == 4 ? paeth(a, b, c)
+                                          : 0;
+      filtered.push_back(static_cast<uint8_t>(row[i] - predicted));
+    }
+    prior = row;
+  }
+  mz_ulong compressedSize = mz_compressBound(filtered.size());
+  std::vector<uint8_t> compressed(compressedSize);
+  TEST_ASSERT_EQUAL(MZ_OK, mz_compress2(compressed.data(), &compressedSize, filtered.data(), filtered.size(), 6));
+
+  std::string png = "\x89PNG\r\n\x1a\n";
+  std::string ihdr;
+  appendU32(ihdr, width);
+  appendU32(ihdr, height);
+  ihdr += static_cast<char>(format.bitDepth);
+  ihdr += static_cast<char>(format.colorType);
+  ihdr += std::string(2, '\0');
+  ihdr += static_cast<char>(interlaced ? 1 : 0);
+  appendChunk(png, "IHDR", ihdr);
+  appendChunk(png, "tEXt", std::string("Comment\0made by test_png_to_bmp_converter", 41));
+  if (format.colorType == PALETTE) {
+    const int entries = 1 << format.bitDepth;
+    std::string palette;
+    std::string alpha;
+    for (int i = 0; i < entries; i++) {
+      const char level = i == entries - 1 || format.transparentPalette ? 0 : static_cast<char>(0xFF);
+      palette += std::string(3, level);
+      alpha += static_cast<char>(i == entries - 1 ? 0xFF : 0);
+    }
+    appendChunk(png, "PLTE", palette);
+    if (format.transparentPalette) {
+      appendChunk(png, "tRNS", alpha);
+    }
+  }
+  for (size_t offset = 0; offset < compressedSize; offset += idatSize) {
+    const size_t size = compressedSize - offset < idatSize ? compressedSize - offset : idatSize;
+    appendChunk(png, "IDAT", std::string(reinterpret_cast<const char*>(compressed.data()) + offset, size));
+  }
+  appendChunk(png, "IEND", "");
+  return png;
+}
+
+// Converts the PNG to 2-bit rows of at most maxSize x maxSize, returning false if the converter does
+bool toGray2(const std::string& png, const int maxSize, TestArchives::MemoryPrint& out, int* width, int* height) {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForWrite("TEST", "/sample.png", file));
+  file.write(reinterpret_cast<const uint8_t*>(png.data()), png.size());
+  file.close();
+
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", "/sample.png", file));
+  const bool converted = PngToBmpConverter::pngFileToGray2Stream(file, out, maxSize, maxSize, width, height);
+  file.close();
+  return converted;
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+// Every format decodes to the same checkerboard, at an odd width so sub-byte rows end part way through a byte
+void test_every_format_decodes_checkerboard() {
+  constexpr int WIDTH = 37;
+  constexpr int HEIGHT = 21;
+  for (const auto& format : FORMATS) {
+    TestArchives::MemoryPrint out;
+    int width, height;
+    TEST_ASSERT_TRUE_MESSAGE(toGray2(encodePng(format, WIDTH, HEIGHT), 64, out, &width, &height), format.name);
+    TEST_ASSERT_EQUAL_MESSAGE(WIDTH, width, format.name);
+    TEST_ASSERT_EQUAL_MESSAGE(HEIGHT, height, format.name);
+
+    // Rows follow the little-endian width and height
+    constexpr int headerSize = 4;
+    const int rowBytes = (WIDTH + 3) / 4;
+    TEST_ASSERT_EQUAL_MESSAGE(headerSize + rowBytes * HEIGHT, out.data.size(), format.name);
+    for (int y = 0; y < HEIGHT; y++) {
+      for (int x = 0; x < WIDTH; x++) {
+        const int level = (out.byteAt(headerSize + y * rowBytes + x / 4) >> (6 - (x % 4) * 2)) & 0x03;
+        TEST_ASSERT_EQUAL_MESSAGE(isBlack(x, y) ? 3 : 0, level, format.name);
+      }
+    }
+  }
+}
+
+// Image data split into IDAT chunks of any size, down to a byte each, reads the same
+void test_idat_chunk_size_does_not_matter() {
+  const Format& format = FORMATS[5];
+  TestArchives::MemoryPrint expected;
+  int width, height;
+  TEST_ASSERT_TRUE(toGray2(encodePng(format, 37, 21, 100000), 64, expected, &width, &height));
+  for (const size_t idatSize : {1, 7, 1023, 1024, 1025}) {
+    TestArchives::MemoryPrint out;
+    TEST_ASSERT_TRUE(toGray2(encodePng(format, 37, 21, idatSize), 64, out, &width, &height));
+    TEST_ASSERT_TRUE(out.data == expected.data);
+  }
+}
+
+// Decoding holds two scanlines and the inflate state, so a taller image needs no more memory
+void test_memory_does_not_grow_with_height() {
+  if (!HostHeap::available()) {
+    TEST_IGNORE_MESSAGE("Needs HostHeap to measure peak heap use");
+  }
+  const Format& format = FORMATS[14];
+  size_t peaks[2];
+  const int heights[] = {100, 4000};
+  for (int i = 0; i < 2; i++) {
+    const std::string png = encodePng(format, 600, heights[i], 8192);
+    TestArchives::MemoryPrint out;
+    // The output rows are reserved up front so they do not count
+    out.data.reserve(4 + 150 * heights[i]);
+    int width, height;
+    HostHeap::reset();
+    TEST_ASSERT_TRUE(toGray2(png, 8000, out, &width, &height));
+    peaks[i] = HostHeap::peakBytes();
+    TEST_ASSERT_EQUAL(600, width);
+    TEST_ASSERT_EQUAL(heights[i], height);
+  }
+  char line[128];
+  snprintf(line, sizeof(line), "600px wide RGBA: peak heap %zu bytes at 100 rows, %zu bytes at 4000 rows", peaks[0],
+           peaks[1]);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_EQUAL_size_t(peaks[0], peaks[1]);
+}
+
+void test_rejects_unsupported_and_broken_files() {
+  TestArchives::MemoryPrint out;
+  int width, height;
+  TEST_ASSERT_FALSE(toGray2("GIF89a", 64, out, &width, &height));
+  TEST_ASSERT_FALSE(toGray2(encodePng(FORMATS[3], 37, 21, 100, true), 64, out, &width, &height));
+  TEST_ASSERT_FALSE(toGray2(encodePng(FORMATS[3], 4000, 10), 64, out, &width, &height));
+
+  // Image data that ends rows early
+  std::string truncated = encodePng(FORMATS[3], 37, 21, 40);
+  truncated.resize(truncated.find("IDAT") + 30);
+  TEST_ASSERT_FALSE(toGray2(truncated, 64, out, &width, &height));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_every_format_decodes_checkerboard);
+  RUN_TEST(test_idat_chunk_size_does_not_matter);
+  RUN_TEST(test_memory_does_not_grow_with_height);
+  RUN_TEST(test_rejects_unsupported_and_broken_files);
+  return UNITY_END();
+}
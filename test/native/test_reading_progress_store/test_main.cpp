@@ -0,0 +1,170 @@
+#include <ReadingProgressStore.h>
+#include <SDCardManager.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Reads a book a page at a time on a simulated clock, resetting the device now and then, and checks what each reset
+// brings back
+namespace {
+constexpr char CACHE_PATH[] = "/.crosspoint/book";
+constexpr int PAGE_TURNS = 1000;
+// The display task polls isFlushDue about this often while the reader sits on a page
+constexpr unsigned long POLL_MS = 1000;
+// The loss window ReadingProgressStore promises, the timed write happens at the first poll after 30s
+constexpr int MAX_LOST_TURNS = 10;
+constexpr unsigned long MAX_LOST_MS = 30 * 1000 + POLL_MS;
+
+struct Reading {
+  const char* name;
+  unsigned long minPageMs;
+  unsigned long maxPageMs;
+  uint16_t batteryPercent;
+};
+
+struct Result {
+  size_t writes = 0;
+  int resets = 0;
+  int worstLostTurns = 0;
+  unsigned long worstLostMs = 0;
+};
+
+// Positions are the page turn they were reached on, so a loaded position says how many turns were lost
+void encode(const uint32_t turn, uint8_t* data) {
+  for (size_t i = 0; i < ReadingProgressStore::DATA_SIZE; i++) {
+    data[i] = (turn >> (8 * i)) & 0xFF;
+  }
+}
+
+uint32_t decode(const uint8_t* data) {
+  uint32_t turn = 0;
+  for (size_t i = 0; i < ReadingProgressStore::DATA_SIZE; i++) {
+    turn |= static_cast<uint32_t>(data[i]) << (8 * i);
+  }
+  return turn;
+}
+
+Result read(const Reading& reading, const uint32_t seed) {
+  SdMan.removeDir("/.crosspoint");
+  SdMan.mkdir(CACHE_PATH);
+  SdMan.resetOpCounts();
+  std::mt19937 random(seed);
+  std::uniform_int_distribution<unsigned long> pageMs(reading.minPageMs, reading.maxPageMs);
+  std::uniform_int_distribution<long> writesBeforeCut(0, 4);
+  // When each turn was made, turn 0 is the position the book opens at
+  std::vector<unsigned long> turnTimes = {millis()};
+  auto store = std::make_unique<ReadingProgressStore>(CACHE_PATH);
+
+  Result result;
+  const auto reset = [&](const uint32_t turn) {
+    SdMan.cutPowerAfter(-1);
+    store = std::make_unique<ReadingProgressStore>(CACHE_PATH);
+    uint8_t data[ReadingProgressStore::DATA_SIZE];
+    // Nothing is saved until the first write, the book opens at its start then
+    const uint32_t loaded = store->load(data) ? decode(data) : 0;
+    TEST_ASSERT_LESS_OR_EQUAL(turn, loaded);
+    const int lostTurns = static_cast<int>(turn - loaded);
+    const unsigned long lostMs = lostTurns > 0 ? millis() - turnTimes[loaded + 1] : 0;
+    TEST_ASSERT_LESS_OR_EQUAL(MAX_LOST_TURNS, lostTurns);
+    TEST_ASSERT_LESS_OR_EQUAL(MAX_LOST_MS, lostMs);
+    result.resets++;
+    result.worstLostTurns = std::max(result.worstLostTurns, lostTurns);
+    result.worstLostMs = std::max(result.worstLostMs, lostMs);
+    // The reader picks up from the loaded position, it is where the device shows the book again
+    turnTimes.resize(loaded + 1);
+    return loaded;
+  };
+
+  uint32_t turn = 0;
+  for (int i = 0; i < PAGE_TURNS; i++) {
+    // About 1 in 40 turns the device resets somewhere inside the next card write
+    if (random() % 40 == 0) {
+      SdMan.cutPowerAfter(writesBeforeCut(random));
+    }
+
+    turn++;
+    turnTimes.push_back(millis());
+    uint8_t data[ReadingProgressStore::DATA_SIZE];
+    encode(turn, data);
+    store->update(data, reading.batteryPercent);
+
+    for (unsigned long onPage = 0, dwell = pageMs(random); onPage < dwell && !SdMan.powerIsCut(); onPage += POLL_MS) {
+      advanceClock(std::min(POLL_MS, dwell - onPage));
+      if (store->isFlushDue()) {
+        store->flush();
+      }
+    }
+    // And about 1 in 50 turns it resets between writes
+    if (SdMan.powerIsCut() || random() % 50 == 0) {
+      turn = reset(turn);
+    }
+  }
+  store->flush();
+  result.writes = SdMan.opCounts().writes;
+  return result;
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() { SdMan.cutPowerAfter(-1); }
+
+// Every reset brings back a position that was reached, no more than 10 turns or about 30s behind
+void test_page_turns_with_resets() {
+  const Reading readings[] = {
+      {"fast flipping, 1-3s/page", 1000, 3000, 100},
+      {"steady reading, 20-90s/page", 20000, 90000, 100},
+      {"mixed, 1-60s/page", 1000, 60000, 100},
+      {"low battery, 1-60s/page", 1000, 60000, 5},
+  };
+  for (const auto& reading : readings) {
+    const Result result = read(reading, 17);
+    char line[160];
+    snprintf(line, sizeof(line), "%d turns, %s: %zu writes, %d resets, worst loss %d turns / %lus", PAGE_TURNS,
+             reading.name, result.writes, result.resets, result.worstLostTurns, result.worstLostMs / 1000);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_GREATER_THAN(0, result.resets);
+    TEST_ASSERT_LESS_OR_EQUAL(PAGE_TURNS, result.writes);
+  }
+
+  const Result fast = read(readings[0], 17);
+  TEST_ASSERT_LESS_THAN(PAGE_TURNS / 5, fast.writes);
+  const Result lowBattery = read(readings[3], 17);
+  TEST_ASSERT_LESS_OR_EQUAL(1, lowBattery.worstLostTurns);
+}
+
+// A reset between removing progress.bin and renaming the temp file over it leaves only the temp file
+void test_load_recovers_temp_file() {
+  SdMan.removeDir("/.crosspoint");
+  SdMan.mkdir(CACHE_PATH);
+  uint8_t data[ReadingProgressStore::DATA_SIZE];
+  {
+    ReadingProgressStore store(CACHE_PATH);
+    encode(7, data);
+    store.update(data, 100);
+    TEST_ASSERT_TRUE(store.flush());
+    encode(8, data);
+    store.update(data, 100);
+    // Opening, writing and syncing the temp file and removing progress.bin go through, the rename does not
+    SdMan.cutPowerAfter(4);
+    TEST_ASSERT_FALSE(store.flush());
+  }
+  SdMan.cutPowerAfter(-1);
+  TEST_ASSERT_FALSE(SdMan.exists("/.crosspoint/book/progress.bin"));
+
+  ReadingProgressStore store(CACHE_PATH);
+  TEST_ASSERT_TRUE(store.load(data));
+  TEST_ASSERT_EQUAL_UINT32(8, decode(data));
+  TEST_ASSERT_TRUE(SdMan.exists("/.crosspoint/book/progress.bin"));
+  TEST_ASSERT_FALSE(SdMan.exists("/.crosspoint/book/progress.tmp"));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_page_turns_with_resets);
+  RUN_TEST(test_load_recovers_temp_file);
+  return UNITY_END();
+}
@@ -0,0 +1,617 @@
+#include <EInkDisplay.h>
+#include <EpdFont.h>
+#include <Epub.h>
+#include <GfxRenderer.h>
+#include <HostHeap.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <TestArchives.h>
+#include <TestJpeg.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+#include <miniz.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Epub/Page.h"
+#include "Epub/Section.h"
+#include "Epub/SectionPrebuilder.h"
+
+namespace {
+constexpr int FONT_ID = 1;
+constexpr uint16_t VIEWPORT_WIDTH = 464;
+constexpr uint16_t VIEWPORT_HEIGHT = 784;
+constexpr char EPUB_PATH[] = "/book.epub";
+constexpr int PAGE_TURNS = 100;
+constexpr int BOOK_CHAPTERS = 24;
+const SectionPrebuilder::Layout LAYOUT = {FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH, VIEWPORT_HEIGHT};
+// Where the section file header keeps the LUT offset, its last field
+constexpr uint32_t LUT_OFFSET_POSITION = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) +
+                                         sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t);
+
+EInkDisplay display;
+GfxRenderer renderer(display);
+EpdFont regularFont(&bookerly_14_regular);
+EpdFont boldFont(&bookerly_14_bold);
+EpdFont italicFont(&bookerly_14_italic);
+EpdFont boldItalicFont(&bookerly_14_bolditalic);
+
+// Paragraphs of words from a fixed pseudo-random sequence with some bold and italic runs, about size bytes long
+std::string makeChapter(const size_t size) {
+  static const char* words[] = {"the ", "reader ", "turned ", "a ", "page ", "of ", "her ", "book, ", "quietly. "};
+  std::string html =
+      "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<html xmlns=\"http://www.w3.org/1999/xhtml\"><head><title>Chapter"
+      "</title></head><body><h1>Chapter</h1>\n";
+  uint32_t seed = 1;
+  while (html.size() < size) {
+    html += "<p>";
+    for (int i = 0; i < 120; i++) {
+      seed = seed * 1103515245 + 12345;
+      const char* word = words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+      if (i % 23 == 5) {
+        html += std::string("<b>") + word + "</b>";
+      } else if (i % 31 == 7) {
+        html += std::string("<i>") + word + "</i>";
+      } else {
+        html += word;
+      }
+    }
+    html += "</p>\n";
+  }
+  return html + "</body></html>\n";
+}
+
+void writeEpub(const std::string& chapter) {
+  TEST_ASSERT_TRUE(TestArchives::writeEpub(EPUB_PATH, {{"chapter.xhtml", chapter}}));
+}
+
+// Builds the chapter's section file and returns its bytes, with the build time in usOut
+std::string buildSection(const std::shared_ptr<Epub>& epub, unsigned long* usOut) {
+  Section section(epub, 0, renderer);
+  section.clearCache();
+  const unsigned long start = micros();
+  TEST_ASSERT_TRUE(section.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                             VIEWPORT_HEIGHT));
+  *usOut = micros() - start;
+  TEST_ASSERT_GREATER_THAN(10, section.pageCount);
+  return TestArchives::readCardFile(epub->getCachePath() + "/sections/0.bin");
+}
+
+// How a page was loaded before the section kept its file and LUT: open, look up the page in the LUT, read it, close
+std::unique_ptr<Page> loadPageReopening(const std::string& path, const int pageIndex) {
+  FsFile file;
+  TEST_ASSERT_TRUE(SdMan.openFileForRead("TEST", path, file));
+  uint32_t lutOffset;
+  uint32_t pageOffset;
+  file.seek(LUT_OFFSET_POSITION);
+  serialization::readPod(file, lutOffset);
+  file.seek(lutOffset + sizeof(uint32_t) * pageIndex);
+  serialization::readPod(file, pageOffset);
+  file.seek(pageOffset);
+  auto page = Page::deserialize(file);
+  file.close();
+  return page;
+}
+
+// A three chapter book with nothing cached, and the middle chapter laid out as the reader would on opening it
+std::shared_ptr<Epub> openThreeChapterBook(const size_t chapterSize) {
+  std::vector<TestArchives::EpubItem> chapters;
+  for (int i = 0; i < 3; i++) {
+    chapters.push_back({"chapter" + std::to_string(i) + ".xhtml", makeChapter(chapterSize + i * 1024)});
+  }
+  TEST_ASSERT_TRUE(TestArchives::writeEpub(EPUB_PATH, chapters));
+  const auto epub = std::make_shared<Epub>(EPUB_PATH, "/.crosspoint");
+  epub->clearCache();
+  TEST_ASSERT_TRUE(epub->load());
+  TEST_ASSERT_TRUE(epub->openZip());
+  Section current(epub, 1, renderer);
+  TEST_ASSERT_TRUE(current.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                             VIEWPORT_HEIGHT));
+  return epub;
+}
+
+std::string sectionPath(const std::shared_ptr<Epub>& epub, const int spineIndex) {
+  return epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin";
+}
+
+// A gray PNG with a gradient across it, encoded by miniz
+std::string makePng(const int width, const int height, const int channels) {
+  std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * channels);
+  for (size_t i = 0; i < pixels.size(); i++) {
+    pixels[i] = static_cast<uint8_t>(i / channels % width * 255 / width);
+  }
+  size_t size = 0;
+  void* png = tdefl_write_image_to_png_file_in_memory(pixels.data(), width, height, channels, &size);
+  TEST_ASSERT_NOT_NULL(png);
+  std::string data(static_cast<const char*>(png), size);
+  mz_free(png);
+  return data;
+}
+
+// An RGB JPEG of a dark disc on a gradient
+std::string makeJpeg(const int width, const int height, const TestJpeg::Options& options) {
+  std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 3);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      const int dx = x - width / 2;
+      const int dy = y - height / 2;
+      const bool disc = dx * dx + dy * dy < width * width / 16;
+      uint8_t* pixel = &pixels[(static_cast<size_t>(y) * width + x) * 3];
+      pixel[0] = disc ? 20 : static_cast<uint8_t>(x * 255 / width);
+      pixel[1] = disc ? 20 : static_cast<uint8_t>(y * 255 / height);
+      pixel[2] = disc ? 60 : 200;
+    }
+  }
+  return TestJpeg::encode(pixels, width, height, 3, options);
+}
+
+// Where a section built at the test viewport caches the image at href, relative to the book's root
+std::string imageBlobPath(const std::shared_ptr<Epub>& epub, const std::string& href) {
+  return epub->getCachePath() + "/images/" + std::to_string(std::hash<std::string>{}(href)) + "_" +
+         std::to_string(VIEWPORT_WIDTH) + "x" + std::to_string(VIEWPORT_HEIGHT) + ".bin";
+}
+
+// Files left in the book's image cache
+size_t countImageBlobs(const std::shared_ptr<Epub>& epub) {
+  const std::string dir = SdMan.hostPath((epub->getCachePath() + "/images").c_str());
+  if (!std::filesystem::is_directory(dir)) {
+    return 0;
+  }
+  return std::distance(std::filesystem::directory_iterator(dir), std::filesystem::directory_iterator());
+}
+
+// Waits in real time for the task to finish, failing after timeoutMs
+void waitForPrebuild(SectionPrebuilder& prebuilder, const unsigned long timeoutMs) {
+  const auto start = std::chrono::steady_clock::now();
+  while (prebuilder.isRunning()) {
+    TEST_ASSERT_LESS_THAN(timeoutMs, std::chrono::duration_cast<std::chrono::milliseconds>(
+                                         std::chrono::steady_clock::now() - start)
+                                         .count());
+    delay(5);
+  }
+}
+}  // namespace
+
+void setUp() {
+  renderer.insertFont(FONT_ID, EpdFontFamily(&regularFont, &boldFont, &italicFont, &boldItalicFont));
+  HostHeap::failAllocations(0, 0);
+}
+
+void tearDown() { HostHeap::failAllocations(0, 0); }
+
+// Chapters are inflated straight into the parser, and staged on SD only when the inflate buffers don't fit. Both
+// must lay out the same pages.
+void test_streamed_section_matches_staged() {
+  if (!HostHeap::available()) {
+    TEST_IGNORE_MESSAGE("Needs HostHeap to force the staged path");
+  }
+  writeEpub(makeChapter(400 * 1024));
+  const auto epub = std::make_shared<Epub>(EPUB_PATH, "/.crosspoint");
+  TEST_ASSERT_TRUE(epub->load());
+
+  unsigned long streamedUs;
+  const std::string streamed = buildSection(epub, &streamedUs);
+
+  // Failing the stream reader's dictionary leaves the staged path, which inflates to a temp file with its own
+  HostHeap::failAllocations(TINFL_LZ_DICT_SIZE);
+  unsigned long stagedUs;
+  const std::string staged = buildSection(epub, &stagedUs);
+  TEST_ASSERT_FALSE(SdMan.exists((epub->getCachePath() + "/.tmp_0.html").c_str()));
+
+  TEST_ASSERT_EQUAL_size_t(staged.size(), streamed.size());
+  TEST_ASSERT_TRUE(staged == streamed);
+
+  char line[128];
+  snprintf(line, sizeof(line), "400KB chapter: streamed %.1fms, staged %.1fms, section %zu bytes",
+           streamedUs / 1000.0, stagedUs / 1000.0, streamed.size());
+  TEST_MESSAGE(line);
+}
+
+// Layout keeps each page's words in one arena, so allocations follow pages and lines rather than words
+void test_layout_heap_per_chapter() {
+  if (!HostHeap::available()) {
+    TEST_IGNORE_MESSAGE("Needs HostHeap to count allocations");
+  }
+  const std::string chapter = makeChapter(100 * 1024);
+  const size_t wordCount = std::count(chapter.begin(), chapter.end(), ' ');
+  writeEpub(chapter);
+  const auto epub = std::make_shared<Epub>(EPUB_PATH, "/.crosspoint");
+  TEST_ASSERT_TRUE(epub->load());
+
+  Section section(epub, 0, renderer);
+  section.clearCache();
+  HostHeap::reset();
+  TEST_ASSERT_TRUE(section.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                             VIEWPORT_HEIGHT));
+  const size_t layoutAllocations = HostHeap::allocations();
+  const size_t layoutPeak = HostHeap::peakBytes();
+
+  HostHeap::reset();
+  size_t lineCount = 0;
+  for (section.currentPage = 0; section.currentPage < section.pageCount; section.currentPage++) {
+    const auto page = section.loadPageFromSectionFile();
+    TEST_ASSERT_NOT_NULL(page);
+    lineCount += page->elements.size();
+  }
+  const size_t loadAllocations = HostHeap::allocations();
+  const size_t loadPeak = HostHeap::peakBytes();
+
+  char line[192];
+  snprintf(line, sizeof(line),
+           "100KB chapter, %zu words in %zu lines on %d pages: layout %zu allocations, peak %zu bytes; page loads %zu "
+           "allocations, peak %zu bytes",
+           wordCount, lineCount, section.pageCount, layoutAllocations, layoutPeak, loadAllocations, loadPeak);
+  TEST_MESSAGE(line);
+  // A list node per word per list would be three allocations for every word
+  TEST_ASSERT_LESS_THAN(wordCount, layoutAllocations);
+  TEST_ASSERT_LESS_THAN(lineCount * 8, loadAllocations);
+}
+
+// A page turn is one seek to the page, where it used to reopen the section file and look the page up in its LUT
+void test_page_turn_card_operations() {
+  writeEpub(makeChapter(400 * 1024));
+  const auto epub = std::make_shared<Epub>(EPUB_PATH, "/.crosspoint");
+  TEST_ASSERT_TRUE(epub->load());
+  {
+    Section built(epub, 0, renderer);
+    built.clearCache();
+    TEST_ASSERT_TRUE(built.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                             VIEWPORT_HEIGHT));
+  }
+  const std::string path = epub->getCachePath() + "/sections/0.bin";
+
+  Section section(epub, 0, renderer);
+  SdMan.resetOpCounts();
+  TEST_ASSERT_TRUE(
+      section.loadSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH, VIEWPORT_HEIGHT));
+  const SDCardManager::OpCounts load = SdMan.opCounts();
+  TEST_ASSERT_GREATER_THAN(PAGE_TURNS, section.pageCount);
+
+  // Forward through the chapter, then back two pages at a time
+  std::vector<int> turns;
+  for (int i = 0; i < PAGE_TURNS; i++) {
+    turns.push_back(i < PAGE_TURNS * 3 / 4 ? i : turns.back() - 2);
+  }
+
+  SdMan.resetOpCounts();
+  std::vector<size_t> lineCounts;
+  for (const int pageIndex : turns) {
+    section.currentPage = pageIndex;
+    const auto page = section.loadPageFromSectionFile();
+    TEST_ASSERT_NOT_NULL(page);
+    lineCounts.push_back(page->elements.size());
+  }
+  const SDCardManager::OpCounts kept = SdMan.opCounts();
+
+  SdMan.resetOpCounts();
+  for (int i = 0; i < PAGE_TURNS; i++) {
+    const auto page = loadPageReopening(path, turns[i]);
+    TEST_ASSERT_NOT_NULL(page);
+    TEST_ASSERT_EQUAL_size_t(lineCounts[i], page->elements.size());
+  }
+  const SDCardManager::OpCounts reopened = SdMan.opCounts();
+
+  char line[192];
+  snprintf(line, sizeof(line), "%d pages, section load: %zu opens, %zu seeks, %zu reads", section.pageCount,
+           load.opens, load.seeks, load.reads);
+  TEST_MESSAGE(line);
+  snprintf(line, sizeof(line), "%d page turns: kept open %zu opens, %zu seeks, %zu reads; reopened %zu opens, %zu "
+           "seeks, %zu reads", PAGE_TURNS, kept.opens, kept.seeks, kept.reads, reopened.opens, reopened.seeks,
+           reopened.reads);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_EQUAL_size_t(0, kept.opens);
+  TEST_ASSERT_EQUAL_size_t(PAGE_TURNS, reopened.opens);
+  // Both read the same pages, the LUT lookups are what is saved
+  TEST_ASSERT_EQUAL_size_t(reopened.seeks - 2 * PAGE_TURNS, kept.seeks);
+  TEST_ASSERT_EQUAL_size_t(reopened.reads - 2 * PAGE_TURNS, kept.reads);
+}
+
+// Holding the EPUB open across a whole book's section builds, as the reader does, where every chapter used to reopen
+// the archive. Its central directory details and index stay loaded either way, so only the opens differ.
+void test_book_build_card_operations() {
+  std::vector<TestArchives::EpubItem> chapters;
+  for (int i = 0; i < BOOK_CHAPTERS; i++) {
+    chapters.push_back({"chapter" + std::to_string(i) + ".xhtml", makeChapter(16 * 1024 + i * 1024)});
+  }
+  TEST_ASSERT_TRUE(TestArchives::writeEpub(EPUB_PATH, chapters));
+  const auto epub = std::make_shared<Epub>(EPUB_PATH, "/.crosspoint");
+  // The earlier tests' one-chapter book left its spine cached under the same path
+  epub->clearCache();
+  TEST_ASSERT_TRUE(epub->load());
+  TEST_ASSERT_EQUAL(BOOK_CHAPTERS, epub->getSpineItemsCount());
+
+  const auto buildBook = [&epub](const bool keepOpen, std::vector<uint16_t>* pageCounts) {
+    for (int i = 0; i < BOOK_CHAPTERS; i++) {
+      Section(epub, i, renderer).clearCache();
+    }
+    if (keepOpen) {
+      TEST_ASSERT_TRUE(epub->openZip());
+    }
+    SdMan.resetOpCounts();
+    for (int i = 0; i < BOOK_CHAPTERS; i++) {
+      Section section(epub, i, renderer);
+      TEST_ASSERT_TRUE(section.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                                 VIEWPORT_HEIGHT));
+      pageCounts->push_back(section.pageCount);
+    }
+    const SDCardManager::OpCounts ops = SdMan.opCounts();
+    epub->closeZip();
+    return ops;
+  };
+
+  std::vector<uint16_t> reopenedPages;
+  std::vector<uint16_t> keptPages;
+  const SDCardManager::OpCounts reopened = buildBook(false, &reopenedPages);
+  const SDCardManager::OpCounts kept = buildBook(true, &keptPages);
+  TEST_ASSERT_TRUE(reopenedPages == keptPages);
+
+  char line[192];
+  snprintf(line, sizeof(line), "%d chapters, reopening the EPUB: %zu opens, %zu seeks, %zu reads, %zu bytes",
+           BOOK_CHAPTERS, reopened.opens, reopened.seeks, reopened.reads, reopened.bytesRead);
+  TEST_MESSAGE(line);
+  snprintf(line, sizeof(line), "%d chapters, EPUB kept open: %zu opens, %zu seeks, %zu reads, %zu bytes", BOOK_CHAPTERS,
+           kept.opens, kept.seeks, kept.reads, kept.bytesRead);
+  TEST_MESSAGE(line);
+  // One open of the archive saved per chapter, and nothing read twice to make up for it
+  TEST_ASSERT_LESS_OR_EQUAL(reopened.opens - BOOK_CHAPTERS, kept.opens);
+  TEST_ASSERT_LESS_OR_EQUAL(reopened.seeks, kept.seeks);
+  TEST_ASSERT_LESS_OR_EQUAL(reopened.bytesRead, kept.bytesRead);
+}
+
+// Once the reader has sat on a page, the chapters either side are built in the background, and turning into one
+// loads its section file without inflating or parsing the chapter
+void test_page_turn_into_prebuilt_chapter() {
+  const auto epub = openThreeChapterBook(200 * 1024);
+  SectionPrebuilder prebuilder(epub, renderer);
+  prebuilder.start(1, LAYOUT);
+
+  // Nothing is built while the idle period runs, the clock is moved past it instead of waiting
+  delay(100);
+  TEST_ASSERT_FALSE(SdMan.exists(sectionPath(epub, 2).c_str()));
+  TEST_ASSERT_TRUE(prebuilder.isRunning());
+  advanceClock(SectionPrebuilder::IDLE_MS);
+  waitForPrebuild(prebuilder, 10000);
+  TEST_ASSERT_TRUE(SdMan.exists(sectionPath(epub, 2).c_str()));
+  TEST_ASSERT_TRUE(SdMan.exists(sectionPath(epub, 0).c_str()));
+
+  // Turning from the last page of chapter 1 onto the first of chapter 2, as renderScreen does
+  SdMan.resetOpCounts();
+  unsigned long start = micros();
+  Section next(epub, 2, renderer);
+  TEST_ASSERT_TRUE(next.loadSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH, VIEWPORT_HEIGHT));
+  TEST_ASSERT_NOT_NULL(next.loadPageFromSectionFile());
+  const unsigned long prebuiltUs = micros() - start;
+  const SDCardManager::OpCounts prebuiltOps = SdMan.opCounts();
+  // Only the section file is opened and read, while the archive stays open, untouched
+  TEST_ASSERT_EQUAL_size_t(1, prebuiltOps.opens);
+  TEST_ASSERT_LESS_THAN(TestArchives::readCardFile(sectionPath(epub, 2)).size(), prebuiltOps.bytesRead);
+
+  // The same turn without the prebuild, building the section in the foreground
+  Section cold(epub, 2, renderer);
+  cold.clearCache();
+  SdMan.resetOpCounts();
+  start = micros();
+  TEST_ASSERT_FALSE(cold.loadSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH, VIEWPORT_HEIGHT));
+  TEST_ASSERT_TRUE(cold.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                          VIEWPORT_HEIGHT));
+  TEST_ASSERT_NOT_NULL(cold.loadPageFromSectionFile());
+  const unsigned long coldUs = micros() - start;
+  const SDCardManager::OpCounts coldOps = SdMan.opCounts();
+  epub->closeZip();
+
+  char line[192];
+  snprintf(line, sizeof(line),
+           "turn into a 200KB chapter: prebuilt %.2fms, %zu reads, %zu bytes; built on the turn %.1fms, %zu reads, "
+           "%zu bytes",
+           prebuiltUs / 1000.0, prebuiltOps.reads, prebuiltOps.bytesRead, coldUs / 1000.0, coldOps.reads,
+           coldOps.bytesRead);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_GREATER_THAN(prebuiltOps.bytesRead, coldOps.bytesRead);
+}
+
+// A key press stops a background build between chunks of chapter content, without waiting for the chapter, and the
+// partial section file is removed
+void test_prebuild_cancel_stops_between_chunks() {
+  const auto epub = openThreeChapterBook(40 * 1024);
+  // Slow card writes, so the build is still running when it is cancelled
+  SdMan.setWriteLatency(20, 0);
+  unsigned long buildUs;
+  {
+    Section timed(epub, 2, renderer);
+    const unsigned long start = micros();
+    TEST_ASSERT_TRUE(timed.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                             VIEWPORT_HEIGHT));
+    buildUs = micros() - start;
+    timed.clearCache();
+  }
+
+  SectionPrebuilder prebuilder(epub, renderer);
+  prebuilder.start(1, LAYOUT);
+  advanceClock(SectionPrebuilder::IDLE_MS);
+  while (!SdMan.exists(sectionPath(epub, 2).c_str())) {
+    delay(1);
+  }
+  delay(buildUs / 4000);
+
+  const unsigned long start = micros();
+  prebuilder.stop();
+  const unsigned long stopUs = micros() - start;
+  SdMan.setWriteLatency(0, 0);
+  epub->closeZip();
+
+  TEST_ASSERT_FALSE(prebuilder.isRunning());
+  TEST_ASSERT_FALSE(SdMan.exists(sectionPath(epub, 2).c_str()));
+  // Chapter 0 is never started once chapter 2 was cancelled
+  TEST_ASSERT_FALSE(SdMan.exists(sectionPath(epub, 0).c_str()));
+
+  char line[128];
+  snprintf(line, sizeof(line), "40KB chapter with slow card writes: build %.1fms, stopped in %.1fms", buildUs / 1000.0,
+           stopUs / 1000.0);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_LESS_THAN(buildUs / 4, stopUs);
+}
+
+// A cancel while an image is converted stops it between rows, and leaves neither the partial blob nor the section
+void test_cancel_during_image_conversion() {
+  const std::string chapter = makeChapter(4 * 1024);
+  const std::string withImage =
+      chapter.substr(0, chapter.rfind("</body>")) + "<p><img src=\"images/big.png\" alt=\"\"/></p></body></html>\n";
+  TEST_ASSERT_TRUE(TestArchives::writeEpub(EPUB_PATH, {{"chapter.xhtml", withImage}},
+                                           {{"images/big.png", makePng(1200, 1600, 1), "image/png"}}));
+  const auto epub = std::make_shared<Epub>(EPUB_PATH, "/.crosspoint");
+  epub->clearCache();
+  TEST_ASSERT_TRUE(epub->load());
+
+  // Counting the checks, to cancel part way into the image's 1600 rows
+  int checks = 0;
+  Section section(epub, 0, renderer);
+  TEST_ASSERT_FALSE(section.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                              VIEWPORT_HEIGHT, nullptr, nullptr, [&checks] { return ++checks > 400; }));
+  TEST_ASSERT_LESS_THAN(420, checks);
+  TEST_ASSERT_EQUAL_size_t(0, countImageBlobs(epub));
+  TEST_ASSERT_FALSE(SdMan.exists((epub->getCachePath() + "/sections/0.bin").c_str()));
+  TEST_ASSERT_FALSE(SdMan.exists((epub->getCachePath() + "/.tmp_image").c_str()));
+
+  // Without the cancel the same chapter converts its image
+  TEST_ASSERT_TRUE(section.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                             VIEWPORT_HEIGHT));
+  TEST_ASSERT_EQUAL_size_t(1, countImageBlobs(epub));
+}
+
+// A chapter showing a progressive and a baseline JPEG and a PNG, one of them twice, converts each image once into a
+// blob named for it. Another chapter reaching the same PNG by a different relative path reuses the blob, and pages
+// draw the blobs where the section placed them.
+void test_chapter_with_images() {
+  const std::string text = makeChapter(8 * 1024);
+  const std::string body = text.substr(0, text.rfind("</body>"));
+  const std::string chapter0 = body +
+                               "<p><img src=\"images/photo.jpg\" alt=\"\"/></p>"
+                               "<p><img src=\"images/small.jpg\" alt=\"\"/></p>"
+                               "<p><img src=\"images/chart.png\" alt=\"\"/></p>"
+                               "<p><img src=\"images/small.jpg#again\" alt=\"\"/></p></body></html>\n";
+  const std::string chapter1 = body + "<p><img src=\"text/../images/chart.png\" alt=\"\"/></p></body></html>\n";
+  const std::vector<TestArchives::EpubItem> images = {
+      {"images/photo.jpg", makeJpeg(1200, 1600, {.progressive = true, .lumaH = 2, .lumaV = 2}), "image/jpeg"},
+      {"images/small.jpg", makeJpeg(300, 200, {.lumaH = 2, .lumaV = 1}), "image/jpeg"},
+      {"images/chart.png", makePng(400, 300, 3), "image/png"},
+  };
+  TEST_ASSERT_TRUE(TestArchives::writeEpub(EPUB_PATH, {{"chapter0.xhtml", chapter0}, {"chapter1.xhtml", chapter1}},
+                                           images));
+  const auto epub = std::make_shared<Epub>(EPUB_PATH, "/.crosspoint");
+  epub->clearCache();
+  TEST_ASSERT_TRUE(epub->load());
+
+  Section section(epub, 0, renderer);
+  HostHeap::reset();
+  unsigned long start = micros();
+  TEST_ASSERT_TRUE(section.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                             VIEWPORT_HEIGHT));
+  const unsigned long firstBuildUs = micros() - start;
+  const size_t buildPeak = HostHeap::peakBytes();
+  TEST_ASSERT_EQUAL_size_t(images.size(), countImageBlobs(epub));
+
+  // Each blob is its size header and whole rows of 2-bit pixels, fitted to the viewport
+  size_t blobBytes = 0;
+  for (const auto& image : images) {
+    const std::string blob = TestArchives::readCardFile(imageBlobPath(epub, "OEBPS/" + image.href));
+    TEST_ASSERT_GREATER_OR_EQUAL(4, blob.size());
+    const int width = static_cast<uint8_t>(blob[0]) | static_cast<uint8_t>(blob[1]) << 8;
+    const int height = static_cast<uint8_t>(blob[2]) | static_cast<uint8_t>(blob[3]) << 8;
+    TEST_ASSERT_TRUE(width > 0 && width <= VIEWPORT_WIDTH);
+    TEST_ASSERT_TRUE(height > 0 && height <= VIEWPORT_HEIGHT);
+    TEST_ASSERT_EQUAL_size_t(4 + static_cast<size_t>((width + 3) / 4) * height, blob.size());
+    blobBytes += blob.size();
+  }
+
+  // Every image on the pages draws the same as its blob drawn in one go at the same place, in document order
+  const char* const shown[] = {"OEBPS/images/photo.jpg", "OEBPS/images/small.jpg", "OEBPS/images/chart.png",
+                               "OEBPS/images/small.jpg"};
+  constexpr int xOffset = 8;
+  constexpr int yOffset = 12;
+  std::vector<uint8_t> rendered(GfxRenderer::getBufferSize());
+  int imagesDrawn = 0;
+  unsigned long renderUs = 0;
+  size_t renderPeak = 0;
+  for (section.currentPage = 0; section.currentPage < section.pageCount; section.currentPage++) {
+    const auto page = section.loadPageFromSectionFile();
+    TEST_ASSERT_NOT_NULL(page.get());
+    for (const auto& element : page->elements) {
+      if (element->getTag() != TAG_PageImage) {
+        continue;
+      }
+      TEST_ASSERT_LESS_THAN(4, imagesDrawn);
+      renderer.clearScreen();
+      HostHeap::reset();
+      start = micros();
+      element->render(renderer, FONT_ID, xOffset, yOffset);
+      renderUs += micros() - start;
+      renderPeak = std::max(renderPeak, HostHeap::peakBytes());
+      std::copy(renderer.getFrameBuffer(), renderer.getFrameBuffer() + rendered.size(), rendered.begin());
+      TEST_ASSERT_TRUE(std::any_of(rendered.begin(), rendered.end(), [](const uint8_t byte) { return byte != 0xFF; }));
+
+      const std::string blob = TestArchives::readCardFile(imageBlobPath(epub, shown[imagesDrawn]));
+      const int width = static_cast<uint8_t>(blob[0]) | static_cast<uint8_t>(blob[1]) << 8;
+      const int height = static_cast<uint8_t>(blob[2]) | static_cast<uint8_t>(blob[3]) << 8;
+      renderer.clearScreen();
+      renderer.drawImageRows(reinterpret_cast<const uint8_t*>(blob.data()) + 4, element->xPos + xOffset,
+                             element->yPos + yOffset, width, height);
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE(renderer.getFrameBuffer(), rendered.data(), rendered.size(), shown[imagesDrawn]);
+      imagesDrawn++;
+    }
+  }
+  TEST_ASSERT_EQUAL(4, imagesDrawn);
+
+  // Rebuilding the section, and building the other chapter, convert nothing: the blobs keep their write times
+  std::vector<std::filesystem::file_time_type> written;
+  for (const auto& image : images) {
+    written.push_back(
+        std::filesystem::last_write_time(SdMan.hostPath(imageBlobPath(epub, "OEBPS/" + image.href).c_str())));
+  }
+  section.clearCache();
+  start = micros();
+  TEST_ASSERT_TRUE(section.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                             VIEWPORT_HEIGHT));
+  const unsigned long rebuildUs = micros() - start;
+  Section other(epub, 1, renderer);
+  TEST_ASSERT_TRUE(other.createSectionFile(FONT_ID, 1.0f, false, TextBlock::JUSTIFIED, VIEWPORT_WIDTH,
+                                           VIEWPORT_HEIGHT));
+  TEST_ASSERT_EQUAL_size_t(images.size(), countImageBlobs(epub));
+  for (size_t i = 0; i < images.size(); i++) {
+    TEST_ASSERT_TRUE_MESSAGE(written[i] == std::filesystem::last_write_time(SdMan.hostPath(
+                                               imageBlobPath(epub, "OEBPS/" + images[i].href).c_str())),
+                             images[i].href.c_str());
+  }
+
+  char line[200];
+  snprintf(line, sizeof(line),
+           "Chapter with 3 images: built in %.1fms with peak heap %zu bytes, rebuilt in %.1fms reusing the blobs",
+           firstBuildUs / 1000.0, HostHeap::available() ? buildPeak : 0, rebuildUs / 1000.0);
+  TEST_MESSAGE(line);
+  snprintf(line, sizeof(line), "Image cache: %zu bytes for 3 images, %zu per image", blobBytes,
+           blobBytes / images.size());
+  TEST_MESSAGE(line);
+  snprintf(line, sizeof(line), "Drew %d page images in %.2fms, peak heap %zu bytes", imagesDrawn, renderUs / 1000.0,
+           HostHeap::available() ? renderPeak : 0);
+  TEST_MESSAGE(line);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_streamed_section_matches_staged);
+  RUN_TEST(test_layout_heap_per_chapter);
+  RUN_TEST(test_page_turn_card_operations);
+  RUN_TEST(test_book_build_card_operations);
+  RUN_TEST(test_page_turn_into_prebuilt_chapter);
+  RUN_TEST(test_prebuild_cancel_stops_between_chunks);
+  RUN_TEST(test_cancel_during_image_conversion);
+  RUN_TEST(test_chapter_with_images);
+  return UNITY_END();
+}
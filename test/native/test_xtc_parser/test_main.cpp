@@ -0,0 +1,216 @@
+#include <SDCardManager.h>
+#include <Xtc/XtcParser.h>
+#include <esp_rom_md5.h>
+#include <unity.h>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Builds XTC and XTCH files the way scripts/xtc_pack.py packs them and reads every page back through XtcParser
+namespace {
+constexpr uint16_t WIDTH = xtc::DISPLAY_WIDTH;
+constexpr uint16_t HEIGHT = xtc::DISPLAY_HEIGHT;
+
+enum class Packing { Raw, PackBits, PackBitsWithMd5, PackBitsWithBadMd5, Truncated };
+
+struct TestPage {
+  std::vector<uint8_t> bitmap;
+  Packing packing;
+};
+
+// Same runs as packbits() in scripts/xtc_pack.py
+std::vector<uint8_t> packBits(const std::vector<uint8_t>& data) {
+  std::vector<uint8_t> out;
+  size_t i = 0;
+  while (i < data.size()) {
+    size_t run = 1;
+    while (i + run < data.size() && run < 128 && data[i + run] == data[i]) {
+      run++;
+    }
+    if (run >= 2) {
+      out.push_back(static_cast<uint8_t>(257 - run));
+      out.push_back(data[i]);
+      i += run;
+      continue;
+    }
+
+    const size_t start = i++;
+    while (i < data.size() && i - start < 128) {
+      if (i + 2 < data.size() && data[i] == data[i + 1] && data[i] == data[i + 2]) {
+        break;
+      }
+      i++;
+    }
+    out.push_back(static_cast<uint8_t>(i - start - 1));
+    out.insert(out.end(), data.begin() + start, data.begin() + i);
+  }
+  return out;
+}
+
+uint64_t md5Prefix(const std::vector<uint8_t>& data) {
+  md5_context_t context;
+  esp_rom_md5_init(&context);
+  esp_rom_md5_update(&context, data.data(), data.size());
+  uint8_t digest[ESP_ROM_MD5_DIGEST_LEN];
+  esp_rom_md5_final(digest, &context);
+  uint64_t prefix;
+  memcpy(&prefix, digest, sizeof(prefix));
+  return prefix;
+}
+
+size_t bitmapSize(const uint8_t bitDepth) {
+  return bitDepth == 2 ? (WIDTH * HEIGHT + 7) / 8 * 2 : (WIDTH + 7) / 8 * HEIGHT;
+}
+
+// Blank margins around lines of word-like runs, as a pre-rendered text page
+std::vector<uint8_t> textPage(const uint8_t bitDepth, uint32_t seed) {
+  std::vector<uint8_t> bitmap(bitmapSize(bitDepth), bitDepth == 2 ? 0x00 : 0xFF);
+  for (size_t line = 60; line + 20 < bitmap.size() / 60; line += 32) {
+    for (size_t i = 0; i < 16; i++) {
+      seed = seed * 1103515245 + 12345;
+      const size_t row = (line + i) * 60 + 4;
+      for (size_t x = 0; x < 52; x++) {
+        if ((seed >> (x % 24)) & 1) {
+          bitmap[row + x] = static_cast<uint8_t>(seed >> 8);
+        }
+      }
+    }
+  }
+  return bitmap;
+}
+
+std::string writeXtc(const char* path, const uint8_t bitDepth, const std::vector<TestPage>& pages) {
+  std::vector<uint8_t> data;
+  std::vector<xtc::PageTableEntry> table;
+  const size_t dataStart = sizeof(xtc::XtcHeader) + pages.size() * sizeof(xtc::PageTableEntry);
+  for (const auto& page : pages) {
+    xtc::XtgPageHeader header = {};
+    header.magic = bitDepth == 2 ? xtc::XTH_MAGIC : xtc::XTG_MAGIC;
+    header.width = WIDTH;
+    header.height = HEIGHT;
+    std::vector<uint8_t> payload = page.packing == Packing::Raw ? page.bitmap : packBits(page.bitmap);
+    header.compression = page.packing == Packing::Raw ? xtc::XTG_COMPRESSION_NONE : xtc::XTG_COMPRESSION_PACKBITS;
+    if (page.packing == Packing::PackBitsWithMd5) {
+      header.md5 = md5Prefix(page.bitmap);
+    } else if (page.packing == Packing::PackBitsWithBadMd5) {
+      header.md5 = md5Prefix(page.bitmap) ^ 1;
+    } else if (page.packing == Packing::Truncated) {
+      payload.resize(payload.size() / 2);
+    }
+    header.dataSize = payload.size();
+
+    table.push_back({dataStart + data.size(), static_cast<uint32_t>(sizeof(header) + payload.size()), WIDTH, HEIGHT});
+    const auto* headerBytes = reinterpret_cast<const uint8_t*>(&header);
+    data.insert(data.end(), headerBytes, headerBytes + sizeof(header));
+    data.insert(data.end(), payload.begin(), payload.end());
+  }
+
+  xtc::XtcHeader header = {};
+  header.magic = bitDepth == 2 ? xtc::XTCH_MAGIC : xtc::XTC_MAGIC;
+  header.versionMajor = 1;
+  header.pageCount = pages.size();
+  header.pageTableOffset = sizeof(header);
+  header.dataOffset = dataStart;
+
+  std::ofstream out(SdMan.hostPath(path), std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(table[0]));
+  out.write(reinterpret_cast<const char*>(data.data()), data.size());
+  TEST_ASSERT_TRUE(out.good());
+  return path;
+}
+
+std::vector<uint8_t> loadStreaming(xtc::XtcParser& parser, const uint32_t page, const size_t chunkSize,
+                                   xtc::XtcError* error) {
+  std::vector<uint8_t> out;
+  *error = parser.loadPageStreaming(
+      page,
+      [&out](const uint8_t* data, const size_t size, const size_t offset) {
+        TEST_ASSERT_EQUAL_size_t(out.size(), offset);
+        out.insert(out.end(), data, data + size);
+      },
+      chunkSize);
+  return out;
+}
+
+void checkRoundTrip(const uint8_t bitDepth) {
+  std::vector<TestPage> pages;
+  for (const auto packing : {Packing::Raw, Packing::PackBits, Packing::PackBitsWithMd5}) {
+    pages.push_back({textPage(bitDepth, pages.size() + 1), packing});
+  }
+  xtc::XtcParser parser;
+  TEST_ASSERT_TRUE(parser.open(writeXtc("/book.xtc", bitDepth, pages).c_str()) == xtc::XtcError::OK);
+  TEST_ASSERT_EQUAL(bitDepth, parser.getBitDepth());
+  parser.setVerifyChecksums(true);
+
+  std::vector<uint8_t> buffer(bitmapSize(bitDepth));
+  unsigned long decodeUs = 0;
+  size_t packedBytes = 0;
+  for (uint32_t i = 0; i < pages.size(); i++) {
+    const unsigned long start = micros();
+    TEST_ASSERT_EQUAL_size_t(buffer.size(), parser.loadPage(i, buffer.data(), buffer.size()));
+    decodeUs += micros() - start;
+    TEST_ASSERT_TRUE(buffer == pages[i].bitmap);
+
+    // Chunks that end inside PackBits runs
+    for (const size_t chunkSize : {1024, 777, 1}) {
+      xtc::XtcError error;
+      TEST_ASSERT_TRUE(loadStreaming(parser, i, chunkSize, &error) == pages[i].bitmap);
+      TEST_ASSERT_TRUE(error == xtc::XtcError::OK);
+    }
+
+    xtc::PageInfo info;
+    TEST_ASSERT_TRUE(parser.getPageInfo(i, info));
+    packedBytes += info.size - sizeof(xtc::XtgPageHeader);
+  }
+
+  char line[128];
+  snprintf(line, sizeof(line), "%d-bit: %zu -> %zu bytes over %zu pages, %.2fms per page load", bitDepth,
+           buffer.size() * pages.size(), packedBytes, pages.size(), decodeUs / 1000.0 / pages.size());
+  TEST_MESSAGE(line);
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_packed_xtc_pages_round_trip() { checkRoundTrip(1); }
+
+void test_packed_xtch_pages_round_trip() { checkRoundTrip(2); }
+
+void test_checksums_only_fail_when_verifying() {
+  const std::vector<TestPage> pages = {{textPage(1, 7), Packing::PackBitsWithBadMd5}};
+  xtc::XtcParser parser;
+  TEST_ASSERT_TRUE(parser.open(writeXtc("/bad_md5.xtc", 1, pages).c_str()) == xtc::XtcError::OK);
+  std::vector<uint8_t> buffer(bitmapSize(1));
+  TEST_ASSERT_EQUAL_size_t(buffer.size(), parser.loadPage(0, buffer.data(), buffer.size()));
+
+  parser.setVerifyChecksums(true);
+  TEST_ASSERT_EQUAL_size_t(0, parser.loadPage(0, buffer.data(), buffer.size()));
+  xtc::XtcError error;
+  loadStreaming(parser, 0, 1024, &error);
+  TEST_ASSERT_TRUE(error == xtc::XtcError::CHECKSUM_MISMATCH);
+}
+
+void test_truncated_packed_page_fails() {
+  const std::vector<TestPage> pages = {{textPage(2, 9), Packing::Truncated}};
+  xtc::XtcParser parser;
+  TEST_ASSERT_TRUE(parser.open(writeXtc("/truncated.xtch", 2, pages).c_str()) == xtc::XtcError::OK);
+  std::vector<uint8_t> buffer(bitmapSize(2));
+  TEST_ASSERT_EQUAL_size_t(0, parser.loadPage(0, buffer.data(), buffer.size()));
+  xtc::XtcError error;
+  loadStreaming(parser, 0, 1024, &error);
+  TEST_ASSERT_TRUE(error == xtc::XtcError::DECOMPRESSION_ERROR);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_packed_xtc_pages_round_trip);
+  RUN_TEST(test_packed_xtch_pages_round_trip);
+  RUN_TEST(test_checksums_only_fail_when_verifying);
+  RUN_TEST(test_truncated_packed_page_fails);
+  return UNITY_END();
+}
@@ -0,0 +1,374 @@
+#include <HostHeap.h>
+#include <SDCardManager.h>
+#include <TestArchives.h>
+#include <ZipFile.h>
+#include <miniz.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+const std::string smallZipPath = "/small.zip";
+const std::string bigZipPath = "/big.zip";
+const std::string indexPath = "/big.idx";
+constexpr size_t INDEX_HEADER_SIZE = 7;
+
+// Words from a fixed pseudo-random sequence, so deflate has something to work with
+std::string makeText(const size_t size, uint32_t seed) {
+  static const char* words[] = {"the ", "reader ", "turned ", "a ", "page ", "of ", "her ", "book, ", "quietly. "};
+  std::string text;
+  while (text.size() < size) {
+    seed = seed * 1103515245 + 12345;
+    text += words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+  }
+  text.resize(size);
+  return text;
+}
+
+void writeZip(const std::string& path, const std::vector<std::pair<std::string, std::string>>& entries,
+              const bool deflate) {
+  std::vector<TestArchives::ZipEntry> zipEntries;
+  for (const auto& entry : entries) {
+    zipEntries.push_back({entry.first, entry.second, deflate});
+  }
+  TEST_ASSERT_TRUE(TestArchives::writeZip(path, zipEntries));
+}
+
+// The name hash of the on-disk index, FNV-1a
+uint32_t indexHash(const std::string& name) {
+  uint32_t hash = 2166136261u;
+  for (const char c : name) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// The fence index's 16 bit fold of it, to make names that share a hash
+uint16_t fenceHash(const std::string& name) {
+  const uint32_t hash = indexHash(name);
+  return static_cast<uint16_t>(hash ^ (hash >> 16));
+}
+
+std::string entryName(const int i) {
+  char name[48];
+  snprintf(name, sizeof(name), "OEBPS/Text/part%04d_split_%03d.xhtml", i / 7, i % 7);
+  return name;
+}
+
+// Entry names as a large EPUB's, with sizes that differ for any 4093 entries in a row so a lookup that lands on the
+// wrong record shows
+std::vector<std::pair<std::string, std::string>> makeBookEntries(const int count) {
+  std::vector<std::pair<std::string, std::string>> entries;
+  for (int i = 0; i < count; i++) {
+    entries.push_back({entryName(i), std::string(1 + i % 4093, 'a' + i % 26)});
+  }
+  // A second name for the hash of an early entry, placed last so its lookup passes over the early one
+  const uint16_t target = fenceHash(entries[3].first);
+  for (int i = 0;; i++) {
+    const std::string name = "OEBPS/Images/figure" + std::to_string(i) + ".png";
+    if (fenceHash(name) == target) {
+      entries.push_back({name, std::string(4094, 'z')});
+      break;
+    }
+  }
+  return entries;
+}
+
+// Looks up the inflated size of every step-th entry, with the card operations the lookups took
+SDCardManager::OpCounts lookupEntries(ZipFile& zip, const std::vector<std::pair<std::string, std::string>>& entries,
+                                      const size_t step) {
+  SdMan.resetOpCounts();
+  for (size_t i = 0; i < entries.size(); i += step) {
+    const auto& entry = entries[i];
+    size_t size = 0;
+    TEST_ASSERT_TRUE_MESSAGE(zip.getInflatedFileSize(entry.first.c_str(), &size), entry.first.c_str());
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(entry.second.size(), size, entry.first.c_str());
+  }
+  return SdMan.opCounts();
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_reads_stored_and_deflated_entries() {
+  const std::string text = makeText(100000, 1);
+  writeZip(smallZipPath, {{"mimetype", "application/epub+zip"}, {"OEBPS/text.xhtml", text}}, true);
+  ZipFile zip(smallZipPath);
+
+  size_t size = 0;
+  uint8_t* data = zip.readFileToMemory("OEBPS/text.xhtml", &size, true);
+  TEST_ASSERT_NOT_NULL(data);
+  TEST_ASSERT_EQUAL_size_t(text.size(), size);
+  TEST_ASSERT_EQUAL_STRING(text.c_str(), reinterpret_cast<const char*>(data));
+  free(data);
+
+  TestArchives::MemoryPrint out;
+  TEST_ASSERT_TRUE(zip.readFileToStream("mimetype", out, 1024));
+  TEST_ASSERT_EQUAL_STRING("application/epub+zip", out.data.c_str());
+  TEST_ASSERT_NULL(zip.readFileToMemory("OEBPS/missing.xhtml"));
+}
+
+void test_inflate_reader_survives_suspend() {
+  const std::string chapter = makeText(300000, 2);
+  const std::string image = makeText(50000, 3);
+  writeZip(smallZipPath, {{"chapter.xhtml", chapter}, {"image.png", image}}, true);
+  ZipFile zip(smallZipPath);
+  TEST_ASSERT_TRUE(zip.open());
+
+  ZipFile::InflateReader reader(zip);
+  TEST_ASSERT_TRUE(reader.open("chapter.xhtml"));
+  TEST_ASSERT_EQUAL_size_t(chapter.size(), reader.getInflatedSize());
+  std::string read;
+  uint8_t buffer[777];
+  int chunks = 0;
+  int bytes;
+  while ((bytes = reader.read(buffer, sizeof(buffer))) > 0) {
+    read.append(reinterpret_cast<const char*>(buffer), bytes);
+    // Inflate another entry with the chapter's state parked on SD, as section builds do for images
+    if (++chunks % 50 == 0) {
+      TEST_ASSERT_TRUE(reader.suspend("/spill.bin"));
+      TEST_ASSERT_EQUAL_INT(-1, reader.read(buffer, 1));
+      TestArchives::MemoryPrint out;
+      TEST_ASSERT_TRUE(zip.readFileToStream("image.png", out, 1024));
+      TEST_ASSERT_TRUE(out.data == image);
+      TEST_ASSERT_TRUE(reader.resume());
+    }
+  }
+  TEST_ASSERT_EQUAL_INT(0, bytes);
+  TEST_ASSERT_TRUE(read == chapter);
+  TEST_ASSERT_FALSE(SdMan.exists("/spill.bin"));
+  reader.close();
+  zip.close();
+}
+
+void test_inflate_reader_missing_entry_is_not_out_of_memory() {
+  writeZip(smallZipPath, {{"chapter.xhtml", makeText(1000, 4)}}, true);
+  ZipFile zip(smallZipPath);
+  ZipFile::InflateReader reader(zip);
+  TEST_ASSERT_FALSE(reader.open("missing.xhtml"));
+  TEST_ASSERT_FALSE(reader.failedToAllocate());
+}
+
+// Lookups through the fence index find what a central directory scan finds, at every spacing and past a hash shared
+// by two names
+void test_fence_index_matches_scan() {
+  const auto entries = makeBookEntries(3000);
+  writeZip(bigZipPath, entries, false);
+  ZipFile zip(bigZipPath);
+  TEST_ASSERT_TRUE(zip.open());
+
+  // A scan reads every record up to the one it is after, so it only looks up every 30th entry
+  const auto scanOps = lookupEntries(zip, entries, 30);
+  char line[160];
+  snprintf(line, sizeof(line), "3001 entries, scanning: %.1f reads per lookup", scanOps.reads / 101.0);
+  TEST_MESSAGE(line);
+
+  for (const uint16_t spacing : {1, 8, 32, 256}) {
+    TEST_ASSERT_TRUE(zip.loadFenceIndex(spacing));
+    // Every entry is found, then the scan's sample is counted again
+    lookupEntries(zip, entries, 1);
+    const auto fenceOps = lookupEntries(zip, entries, 30);
+    TEST_ASSERT_LESS_THAN(scanOps.reads, fenceOps.reads);
+    size_t size = 0;
+    TEST_ASSERT_FALSE(zip.getInflatedFileSize("OEBPS/Text/missing.xhtml", &size));
+
+    snprintf(line, sizeof(line), "spacing %u: %zu bytes of index, %.1f reads per lookup", spacing,
+             3001 * sizeof(uint16_t) + (3001 + spacing - 1) / spacing * sizeof(uint32_t), fenceOps.reads / 101.0);
+    TEST_MESSAGE(line);
+  }
+
+  // Entry data is read from the record the fence index found
+  for (const size_t i : {size_t{0}, size_t{3}, size_t{1234}, entries.size() - 1}) {
+    size_t size = 0;
+    uint8_t* data = zip.readFileToMemory(entries[i].first.c_str(), &size);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_EQUAL_size_t(entries[i].second.size(), size);
+    TEST_ASSERT_EQUAL_MEMORY(entries[i].second.data(), data, size);
+    free(data);
+  }
+
+  // Without the index lookups scan again
+  zip.unloadFenceIndex();
+  lookupEntries(zip, entries, 300);
+  zip.close();
+}
+
+// An index over 32KB is refused and lookups go on scanning the central directory
+void test_fence_index_over_cap_is_refused() {
+  const auto entries = makeBookEntries(16000);
+  writeZip(bigZipPath, entries, false);
+  ZipFile zip(bigZipPath);
+  // 32002 bytes of hashes, then 4 bytes a fence
+  TEST_ASSERT_TRUE(zip.loadFenceIndex(1000));
+  TEST_ASSERT_FALSE(zip.loadFenceIndex(64));
+
+  size_t size = 0;
+  TEST_ASSERT_TRUE(zip.getInflatedFileSize(entries.back().first.c_str(), &size));
+  TEST_ASSERT_EQUAL_size_t(entries.back().second.size(), size);
+}
+
+// Lookups through the on-disk index at the entry counts of a short book, a long one and a large omnibus. 10000 entries
+// take more than one batch, so that index is built in several passes.
+void test_file_stat_index_lookups() {
+  for (const int count : {100, 1000, 10000}) {
+    const auto entries = makeBookEntries(count);
+    writeZip(bigZipPath, entries, false);
+    SdMan.remove(indexPath.c_str());
+    ZipFile zip(bigZipPath);
+    TEST_ASSERT_TRUE(zip.open());
+
+    SdMan.resetOpCounts();
+    unsigned long start = micros();
+    TEST_ASSERT_TRUE(zip.loadFileStatIndex(indexPath));
+    const unsigned long buildUs = micros() - start;
+    const size_t buildReads = SdMan.opCounts().reads;
+    TEST_ASSERT_EQUAL_size_t(INDEX_HEADER_SIZE + entries.size() * sizeof(ZipFile::FileStatIndexEntry),
+                             TestArchives::readCardFile(indexPath).size());
+
+    start = micros();
+    const auto indexOps = lookupEntries(zip, entries, 1);
+    const unsigned long indexUs = micros() - start;
+    size_t size = 0;
+    TEST_ASSERT_FALSE(zip.getInflatedFileSize("OEBPS/Text/missing.xhtml", &size));
+
+    // A scan reads every record up to the one it is after, so it only looks up about 100 entries
+    zip.unloadFileStatIndex();
+    const size_t step = std::max<size_t>(1, entries.size() / 100);
+    const size_t scanLookups = (entries.size() + step - 1) / step;
+    start = micros();
+    const auto scanOps = lookupEntries(zip, entries, step);
+    const unsigned long scanUs = micros() - start;
+    zip.close();
+
+    // Opening the archive again uses the index already on the card
+    ZipFile reopened(bigZipPath);
+    SdMan.resetOpCounts();
+    TEST_ASSERT_TRUE(reopened.loadFileStatIndex(indexPath));
+    TEST_ASSERT_EQUAL_size_t(0, SdMan.opCounts().writes);
+
+    char line[224];
+    snprintf(line, sizeof(line),
+             "%zu entries: index built in %.1fms with %zu reads; lookup %.1fus and %.1f reads through the index, "
+             "%.1fus and %.1f reads scanning",
+             entries.size(), buildUs / 1000.0, buildReads, static_cast<double>(indexUs) / entries.size(),
+             static_cast<double>(indexOps.reads) / entries.size(), static_cast<double>(scanUs) / scanLookups,
+             static_cast<double>(scanOps.reads) / scanLookups);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_LESS_THAN(scanOps.reads / scanLookups, indexOps.reads / entries.size());
+  }
+}
+
+// With the heap too short for one batch the index is built over several hash ranges, and a range holding more
+// entries than a batch gives up on the index instead of writing a partial one
+void test_file_stat_index_small_batches() {
+  if (!HostHeap::available()) {
+    TEST_IGNORE_MESSAGE("Needs HostHeap to fail allocations");
+  }
+  const auto entries = makeBookEntries(300);
+  const size_t fullBatchBytes = entries.size() * sizeof(ZipFile::FileStatIndexEntry);
+  writeZip(bigZipPath, entries, false);
+
+  SdMan.remove(indexPath.c_str());
+  ZipFile zip(bigZipPath);
+  SdMan.resetOpCounts();
+  TEST_ASSERT_TRUE(zip.loadFileStatIndex(indexPath));
+  const size_t onePassReads = SdMan.opCounts().reads;
+
+  // Half a batch, so three hash ranges of up to 3/4 of it each
+  SdMan.remove(indexPath.c_str());
+  ZipFile halfBatch(bigZipPath);
+  HostHeap::failAllocations(fullBatchBytes);
+  SdMan.resetOpCounts();
+  TEST_ASSERT_TRUE(halfBatch.loadFileStatIndex(indexPath));
+  HostHeap::failAllocations(0, 0);
+  TEST_ASSERT_GREATER_OR_EQUAL(3 * onePassReads, SdMan.opCounts().reads + onePassReads / 10);
+
+  const std::string index = TestArchives::readCardFile(indexPath);
+  TEST_ASSERT_EQUAL_size_t(INDEX_HEADER_SIZE + fullBatchBytes, index.size());
+  uint32_t previousHash = 0;
+  for (size_t i = 0; i < entries.size(); i++) {
+    ZipFile::FileStatIndexEntry entry;
+    memcpy(&entry, index.data() + INDEX_HEADER_SIZE + i * sizeof(entry), sizeof(entry));
+    TEST_ASSERT_GREATER_OR_EQUAL(previousHash, entry.nameHash);
+    previousHash = entry.nameHash;
+  }
+  lookupEntries(halfBatch, entries, 1);
+
+  // 200 of 300 names in the first third of the hash space overflow its half batch
+  std::vector<std::pair<std::string, std::string>> skewed;
+  for (int i = 0, low = 0, high = 0; low + high < 300; i++) {
+    const std::string name = entryName(i);
+    const bool isLow = indexHash(name) < 0x55555555u;
+    if (isLow ? low < 200 : high < 100) {
+      skewed.push_back({name, std::string(1 + i % 4093, 'a')});
+      (isLow ? low : high)++;
+    }
+  }
+  writeZip(bigZipPath, skewed, false);
+  SdMan.remove(indexPath.c_str());
+  ZipFile overflowed(bigZipPath);
+  HostHeap::failAllocations(skewed.size() * sizeof(ZipFile::FileStatIndexEntry));
+  TEST_ASSERT_FALSE(overflowed.loadFileStatIndex(indexPath));
+  HostHeap::failAllocations(0, 0);
+  TEST_ASSERT_FALSE(SdMan.exists(indexPath.c_str()));
+  // The archive still reads through the fence index the reader falls back to
+  TEST_ASSERT_TRUE(overflowed.loadFenceIndex(8));
+  lookupEntries(overflowed, skewed, 1);
+}
+
+// A build cut short by a full card or a reset never leaves an index that a later open would trust
+void test_interrupted_index_build_is_not_trusted() {
+  const auto entries = makeBookEntries(1000);
+  const long indexSize = INDEX_HEADER_SIZE + entries.size() * sizeof(ZipFile::FileStatIndexEntry);
+  writeZip(bigZipPath, entries, false);
+
+  for (const long budget : {0L, 1L, 6L, 7L, 100L, indexSize / 2, indexSize - 1}) {
+    SdMan.remove(indexPath.c_str());
+    ZipFile zip(bigZipPath);
+    SdMan.setWriteBudget(budget);
+    TEST_ASSERT_FALSE(zip.loadFileStatIndex(indexPath));
+    SdMan.setWriteBudget(-1);
+    TEST_ASSERT_FALSE(SdMan.exists(indexPath.c_str()));
+    lookupEntries(zip, entries, 100);
+  }
+
+  // A reset also stops the partial index being removed, so it is left with its version byte still 0
+  for (long writes = 0;; writes++) {
+    SdMan.remove(indexPath.c_str());
+    ZipFile zip(bigZipPath);
+    SdMan.cutPowerAfter(writes);
+    const bool built = zip.loadFileStatIndex(indexPath);
+    SdMan.cutPowerAfter(-1);
+    if (built) {
+      TEST_ASSERT_EQUAL(1, TestArchives::readCardFile(indexPath)[0]);
+      break;
+    }
+    if (SdMan.exists(indexPath.c_str())) {
+      TEST_ASSERT_EQUAL(0, TestArchives::readCardFile(indexPath)[0]);
+    }
+
+    ZipFile rebooted(bigZipPath);
+    TEST_ASSERT_TRUE(rebooted.loadFileStatIndex(indexPath));
+    TEST_ASSERT_EQUAL(1, TestArchives::readCardFile(indexPath)[0]);
+    lookupEntries(rebooted, entries, 100);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_reads_stored_and_deflated_entries);
+  RUN_TEST(test_inflate_reader_survives_suspend);
+  RUN_TEST(test_inflate_reader_missing_entry_is_not_out_of_memory);
+  RUN_TEST(test_fence_index_matches_scan);
+  RUN_TEST(test_fence_index_over_cap_is_refused);
+  RUN_TEST(test_file_stat_index_lookups);
+  RUN_TEST(test_file_stat_index_small_batches);
+  RUN_TEST(test_interrupted_index_build_is_not_trusted);
+  return UNITY_END();
+}